@@ -32,8 +32,9 @@ cdef class InferRequest:
     cpdef async_infer(self, inputs = ?)
     cpdef wait(self, timeout = ?)
     cpdef get_perf_counts(self)
+    cpdef set_completion_callback(self, py_callback, py_data = ?)
     cdef public:
-        _inputs, _outputs
+        _inputs, _outputs, _input_arrays, _py_callback, _py_data
 
 cdef class IENetwork:
     cdef C.IENetwork impl
@@ -90,14 +90,66 @@ cdef class ExecutableNetwork:
         current_request.async_infer(inputs)
         return current_request
 
+    def infer_batch(self, inputs_list):
+        """Infers every dict of the inputs of the list and returns the list of the dicts of the outputs in the same
+        order. The inferences are spread over all the requests of the network natively, without the GIL, the arrays
+        of the inputs are read in place. The completion callbacks of the requests are called as usual."""
+        cdef vector[map[string, void *]] c_inputs
+        cdef map[string, void *] c_item
+        cdef map[string, void *] c_outputs
+        cdef size_t data
+        cdef C.IEExecNetwork *impl = self.impl.get()
+        request = self.requests[0]
+        # the arrays of the inputs converted to the precision and layout of the inputs, kept until the inference ends
+        arrays = []
+        for item in inputs_list:
+            if set(item) != set(request.inputs):
+                raise ValueError("Expected the inputs {}, got {}".format(sorted(request.inputs), sorted(item)))
+            c_item.clear()
+            for name, value in item.items():
+                buffer = request.inputs[name]
+                array = np.ascontiguousarray(value, dtype=buffer.dtype)
+                if array.size != buffer.size:
+                    raise ValueError("The input {} of the shape {} is expected, got {}".format(name, buffer.shape,
+                                                                                            array.shape))
+                arrays.append(array)
+                data = array.ctypes.data
+                c_item[name.encode()] = <void *> data
+            c_inputs.push_back(c_item)
+
+        # the outputs of all the items are stacked, the results are the views of them
+        results = {name: np.empty((len(inputs_list),) + buffer.shape, dtype=buffer.dtype)
+                   for name, buffer in request.outputs.items()}
+        for name, array in results.items():
+            data = array.ctypes.data
+            c_outputs[name.encode()] = <void *> data
+
+        try:
+            with nogil:
+                impl.inferBatch(c_inputs, c_outputs)
+        finally:
+            # the requests read their own input blobs again
+            for infer_request in self.requests:
+                infer_request._input_arrays.clear()
+        return [{name: array[i] for name, array in results.items()} for i in range(len(inputs_list))]
+
     @property
     def requests(self):
         return self._requests
 
+cdef void user_callback(void *py_request, int status) with gil:
+    cdef InferRequest request = <InferRequest> py_request
+    if request._py_callback is not None:
+        request._py_callback(status, request._py_data)
+
 cdef class InferRequest:
     def __init__(self):
         self._inputs = {}
         self._outputs = {}
+        # the numpy arrays the inputs are read from without copying, they are kept alive until replaced
+        self._input_arrays = {}
+        self._py_callback = None
+        self._py_data = None
 
     cpdef BlobBuffer _get_input_buffer(self, const string & blob_name):
         cdef BlobBuffer buffer = BlobBuffer()
@@ -110,21 +162,35 @@ cdef class InferRequest:
         return buffer
 
     cpdef infer(self, inputs=None):
+        cdef C.InferRequestWrap *impl = self.impl
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            impl.infer()
 
     cpdef async_infer(self, inputs=None):
+        cdef C.InferRequestWrap *impl = self.impl
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer_async()
+        with nogil:
+            impl.infer_async()
 
     cpdef wait(self, timeout=None):
-        if timeout is None:
-            timeout = -1
-        return deref(self.impl).wait(<int64_t> timeout)
+        cdef C.InferRequestWrap *impl = self.impl
+        cdef int64_t c_timeout = -1 if timeout is None else timeout
+        cdef int status
+        with nogil:
+            status = impl.wait(c_timeout)
+        return status
+
+    cpdef set_completion_callback(self, py_callback, py_data=None):
+        """Sets the callable called as py_callback(status, py_data) when the asynchronous inference is completed.
+        It is called from the thread of the plugin, so the other requests can be started meanwhile."""
+        self._py_callback = py_callback
+        self._py_data = py_data
+        deref(self.impl).setCyCallback(user_callback, <void *> self)
 
     cpdef get_perf_counts(self):
         cdef map[string, C.ProfileInfo] c_profile = deref(self.impl).getPerformanceCounts()
@@ -147,8 +213,33 @@ cdef class InferRequest:
 
     def _fill_inputs(self, inputs):
         for k, v in inputs.items():
+            if self._set_input_array(k, v):
+                continue
+            if k in self._input_arrays:
+                deref(self.impl).resetInputBlob(k.encode())
+                del self._input_arrays[k]
             self.inputs[k][:] = v
 
+    def _set_input_array(self, name, array):
+        # the array is read in place if its memory is the dense tensor of the input,
+        # the strided NCHW view of the NHWC data (e.g. the transposed image) is read as the NHWC blob
+        if not isinstance(array, np.ndarray) or not array.flags['ALIGNED']:
+            return False
+        buffer = self.inputs[name]
+        if array.dtype != buffer.dtype or array.shape != buffer.shape:
+            return False
+        if array.flags['C_CONTIGUOUS']:
+            layout = ""
+        elif array.ndim == 4 and array.transpose(0, 2, 3, 1).flags['C_CONTIGUOUS']:
+            layout = "NHWC"
+        else:
+            return False
+
+        cdef size_t data = array.ctypes.data
+        deref(self.impl).setInputBlob(name.encode(), <void *> data, layout.encode())
+        self._input_arrays[name] = array
+        return True
+
 cdef class IENetwork:
     @property
     def name(self):
@@ -251,7 +342,13 @@ cdef class IEPlugin:
             for k, v in config.items():
                 c_config[to_std_string(k)] = to_std_string(v)
 
-        exec_net.impl = move(self.impl.load(network.impl, num_requests, c_config))
+        cdef C.IEPlugin *impl = &self.impl
+        cdef C.IENetwork *c_network = &network.impl
+        cdef unique_ptr[C.IEExecNetwork] c_exec_net
+        # the network is loaded without the GIL, so the other threads run meanwhile (see load_async)
+        with nogil:
+            c_exec_net = move(impl.load(deref(c_network), num_requests, c_config))
+        exec_net.impl = move(c_exec_net)
 
         requests = []
         for i in range(deref(exec_net.impl).infer_requests.size()):
@@ -275,6 +372,15 @@ cdef class IEPlugin:
 
         return exec_net
 
+    def load_async(self, IENetwork network, int num_requests=1, config=None):
+        """Loads the network like load on a separate thread and returns the concurrent.futures.Future of the
+        ExecutableNetwork, the interpreter is not blocked meanwhile"""
+        from concurrent.futures import ThreadPoolExecutor
+        executor = ThreadPoolExecutor(max_workers=1)
+        future = executor.submit(self.load, network, num_requests, config)
+        executor.shutdown(wait=False)
+        return future
+
     cpdef void set_initial_affinity(self,IENetwork net) except *:
         if self.device.find("HETERO") == -1:
             raise RuntimeError("set_initial_affinity method applicable only for HETERO device")
@@ -310,7 +416,13 @@ cdef class IEPlugin:
 cdef class IENetReader:
     def read(self, model: str, weights: str) -> IENetwork:
         cdef IENetwork net = IENetwork()
-        net.impl = self.impl.read(model.encode(), weights.encode())
+        cdef C.IENetReader *impl = &self.impl
+        cdef string c_model = model.encode()
+        cdef string c_weights = weights.encode()
+        cdef C.IENetwork c_net
+        with nogil:
+            c_net = impl.read(c_model, c_weights)
+        net.impl = c_net
         return net
 
 cdef class BlobBuffer:
@@ -6,6 +6,8 @@
 #include "ie_api_impl.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "ie_iinfer_request.hpp"
+#include <cstdint>
+#include <cstring>
 #define stringify( name ) # name
 #define IE_CHECK_CALL(expr) {                       \
     auto ret = (expr);                              \
@@ -265,6 +267,62 @@ void InferenceEnginePython::IEExecNetwork::infer()
     request.request_ptr->Infer(&response);
 }
 
+void InferenceEnginePython::IEExecNetwork::inferBatch(const std::vector<std::map<std::string, void *>> &inputs,
+                                                      const std::map<std::string, void *> &outputs)
+{
+    InferenceEngine::ResponseDesc response;
+    const size_t requests_count = infer_requests.size();
+    if (requests_count == 0) {
+        THROW_IE_EXCEPTION << "The network " << name << " has no infer requests";
+    }
+
+    // the item i is inferred by the request i % requests_count, which completes its previous item first,
+    // so the items are started and completed in order while every request is busy
+    auto complete = [&](size_t item) {
+        InferRequestWrap &request = infer_requests[item % requests_count];
+        IE_CHECK_CALL(request.request_ptr->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &response))
+        for (const auto &output : outputs) {
+            const InferenceEngine::Blob::Ptr &blob = request.outputs.at(output.first);
+            std::memcpy(static_cast<uint8_t *>(output.second) + item * blob->byteSize(),
+                        blob->buffer().as<const uint8_t *>(), blob->byteSize());
+        }
+    };
+    auto reset_inputs = [&]() {
+        for (auto &request : infer_requests) {
+            for (const auto &input : request.inputs) {
+                request.resetInputBlob(input.first);
+            }
+        }
+    };
+
+    size_t completed = 0;
+    try {
+        for (size_t item = 0; item < inputs.size(); ++item) {
+            if (item >= requests_count) {
+                complete(completed++);
+            }
+            InferRequestWrap &request = infer_requests[item % requests_count];
+            // the inputs are read from the memory of the caller without the copying
+            for (const auto &input : inputs[item]) {
+                request.setInputBlob(input.first, input.second, "");
+            }
+            IE_CHECK_CALL(request.request_ptr->StartAsync(&response))
+        }
+        while (completed < inputs.size()) {
+            complete(completed++);
+        }
+    } catch (...) {
+        // the started inferences read the memory of the caller, it is not returned before they complete
+        for (auto &request : infer_requests) {
+            request.request_ptr->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &response);
+        }
+        try {
+            reset_inputs();
+        } catch (...) {}
+        throw;
+    }
+    reset_inputs();
+}
 
 InferenceEngine::Blob::Ptr &InferenceEnginePython::InferRequestWrap::getInputBlob(const std::string &blob_name)
 {
@@ -310,6 +368,71 @@ int InferenceEnginePython::InferRequestWrap::wait(int64_t timeout) {
     return static_cast<int >(code);
 }
 
+static void completion_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
+    InferenceEngine::ResponseDesc response;
+    InferenceEnginePython::InferRequestWrap *wrap = nullptr;
+    request->GetUserData(reinterpret_cast<void **>(&wrap), &response);
+    if (wrap != nullptr && wrap->user_callback != nullptr) {
+        wrap->user_callback(wrap->user_data, static_cast<int>(code));
+    }
+}
+
+void InferenceEnginePython::InferRequestWrap::setCyCallback(cy_callback callback, void *data) {
+    InferenceEngine::ResponseDesc response;
+    user_callback = callback;
+    user_data = data;
+    IE_CHECK_CALL(request_ptr->SetUserData(this, &response))
+    IE_CHECK_CALL(request_ptr->SetCompletionCallback(completion_callback))
+}
+
+template <class T>
+static InferenceEngine::Blob::Ptr wrap_buffer(const InferenceEngine::TensorDesc &desc, void *data) {
+    return InferenceEngine::make_shared_blob<T>(desc, static_cast<T *>(data));
+}
+
+void InferenceEnginePython::InferRequestWrap::setInputBlob(const std::string &blob_name, void *data,
+                                                            const std::string &layout) {
+    // the blob is created over the memory of the array, so the inference reads it without the copying
+    InferenceEngine::TensorDesc desc = inputs.at(blob_name)->getTensorDesc();
+    if (layout == "NHWC") {
+        desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), InferenceEngine::Layout::NHWC);
+    }
+
+    InferenceEngine::Blob::Ptr blob;
+    switch (desc.getPrecision()) {
+        case InferenceEngine::Precision::FP32:
+            blob = wrap_buffer<float>(desc, data);
+            break;
+        case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::Q78:
+        case InferenceEngine::Precision::I16:
+            blob = wrap_buffer<int16_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::U8:
+            blob = wrap_buffer<uint8_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::I8:
+            blob = wrap_buffer<int8_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::U16:
+            blob = wrap_buffer<uint16_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::I32:
+            blob = wrap_buffer<int32_t>(desc, data);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported precision of the input " << blob_name;
+    }
+
+    InferenceEngine::ResponseDesc response;
+    IE_CHECK_CALL(request_ptr->SetBlob(blob_name.c_str(), blob, &response))
+}
+
+void InferenceEnginePython::InferRequestWrap::resetInputBlob(const std::string &blob_name) {
+    InferenceEngine::ResponseDesc response;
+    IE_CHECK_CALL(request_ptr->SetBlob(blob_name.c_str(), inputs.at(blob_name), &response))
+}
+
 std::map<std::string, InferenceEnginePython::ProfileInfo> InferenceEnginePython::InferRequestWrap::getPerformanceCounts(){
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perf_counts;
     InferenceEngine::ResponseDesc response;
@@ -63,14 +63,22 @@ struct IENetReader {
     std::vector<std::pair<std::string, std::string>> getLayers();
 };
 
+typedef void (*cy_callback)(void *user_data, int status);
+
 struct InferRequestWrap {
     InferenceEngine::IInferRequest::Ptr request_ptr;
     InferenceEngine::BlobMap inputs;
     InferenceEngine::BlobMap outputs;
+    // called from the thread of the plugin when the asynchronous inference is completed
+    cy_callback user_callback = nullptr;
+    void *user_data = nullptr;
 
     void infer();
     void infer_async();
     int  wait(int64_t timeout);
+    void setCyCallback(cy_callback callback, void *data);
+    void setInputBlob(const std::string &blob_name, void *data, const std::string &layout);
+    void resetInputBlob(const std::string &blob_name);
     InferenceEngine::Blob::Ptr &getInputBlob(const std::string &blob_name);
     InferenceEngine::Blob::Ptr &getOutputBlob(const std::string &blob_name);
     std::vector<std::string> getInputsList();
@@ -88,6 +96,9 @@ struct IEExecNetwork {
     int next_req_index = 0;
     bool async;
     void infer();
+    // infers the items over all the requests, the outputs of the item i are written at i * the size of the output
+    void inferBatch(const std::vector<std::map<std::string, void *>> &inputs,
+                    const std::map<std::string, void *> &outputs);
 };
 
 
@@ -66,6 +66,7 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
 
     cdef cppclass IEExecNetwork:
         vector[InferRequestWrap] infer_requests
+        void inferBatch(const vector[map[string, void *]] &inputs, const map[string, void *] &outputs) nogil except +
 
     cdef cppclass IENetwork:
         string name
@@ -82,7 +83,7 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
     cdef cppclass IEPlugin:
         IEPlugin() except +
         IEPlugin(const string &, const vector[string] &) except +
-        unique_ptr[IEExecNetwork] load(IENetwork & net, int num_requests, const map[string, string]& config) except +
+        unique_ptr[IEExecNetwork] load(IENetwork & net, int num_requests, const map[string, string]& config) nogil except +
         void addCpuExtension(const string &) except +
         void setConfig(const map[string, string]&) except +
         void setInitialAffinity(IENetwork & net) except +
@@ -91,7 +92,7 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         string version
 
     cdef cppclass IENetReader:
-        IENetwork read(const string &, const string &) except +
+        IENetwork read(const string &, const string &) nogil except +
 
     cdef cppclass InferRequestWrap:
         vector[string] getInputsList() except +
@@ -99,9 +100,12 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         Blob.Ptr& getOutputBlob(const string &blob_name) except +
         Blob.Ptr& getInputBlob(const string &blob_name) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        void infer() nogil except +
+        void infer_async() nogil except +
+        int wait(int64_t timeout) nogil except +
+        void setCyCallback(void (*)(void*, int), void *) except +
+        void setInputBlob(const string &blob_name, void *data, const string &layout) except +
+        void resetInputBlob(const string &blob_name) except +
 
     cdef T* get_buffer[T](Blob &)
 
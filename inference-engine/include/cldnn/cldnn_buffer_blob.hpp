@@ -0,0 +1,124 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header for the blobs over the OpenCL buffers of the application consumed by the clDNN plugin without copies
+ *
+ * @file cldnn_buffer_blob.hpp
+ */
+#pragma once
+
+#include <memory>
+#include <CL/cl.h>
+#include "../ie_blob.h"
+#include "cldnn_shared_context.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class CLDNNBufferAllocator
+ * @brief The allocator of the blobs over an OpenCL buffer, the host access maps the buffer in the queue.
+ * The allocator retains the buffer and the queue, the handle it allocates is the buffer.
+ */
+class CLDNNBufferAllocator : public IAllocator {
+public:
+    CLDNNBufferAllocator(cl_mem buffer, cl_command_queue queue) : _buffer(buffer), _queue(queue) {
+        clRetainMemObject(_buffer);
+        clRetainCommandQueue(_queue);
+    }
+
+    void *lock(void * /*handle*/, LockOp = LOCK_FOR_WRITE) noexcept override {
+        if (_lockCount == 0) {
+            cl_int status = CL_SUCCESS;
+            _mapped = clEnqueueMapBuffer(_queue, _buffer, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0, _size,
+                                         0, nullptr, nullptr, &status);
+            if (status != CL_SUCCESS) {
+                _mapped = nullptr;
+                return nullptr;
+            }
+        }
+        _lockCount++;
+        return _mapped;
+    }
+
+    void unlock(void * /*handle*/) noexcept override {
+        if (_lockCount > 0 && --_lockCount == 0) {
+            clEnqueueUnmapMemObject(_queue, _buffer, _mapped, 0, nullptr, nullptr);
+            _mapped = nullptr;
+        }
+    }
+
+    void *alloc(size_t size) noexcept override {
+        _size = size;
+        return _buffer;
+    }
+
+    bool free(void * /*handle*/) noexcept override {
+        // the buffer is owned by the application
+        return true;
+    }
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+protected:
+    ~CLDNNBufferAllocator() override {
+        clReleaseCommandQueue(_queue);
+        clReleaseMemObject(_buffer);
+    }
+
+private:
+    cl_mem _buffer;
+    cl_command_queue _queue;
+    size_t _size = 0;
+    size_t _lockCount = 0;
+    void *_mapped = nullptr;
+};
+
+/**
+ * @class CLDNNBufferBlob
+ * @brief The blob of the given precision over an OpenCL buffer (cl_mem) created by the application, e.g. the output
+ * of a decoding pipeline. The inference reads the buffer after the commands enqueued before to the queue of the
+ * plugin (CLDNNConfigParams::KEY_CLDNN_QUEUE), the commands of the other queues have to complete before the inference.
+ * The buffer holds the input in the layout of the network input, the pre-processing of such an input reads it on the host.
+ */
+template <typename T>
+class CLDNNBufferBlob : public TBlob<T>, public ICLDNNBufferBlob {
+public:
+    using Ptr = std::shared_ptr<CLDNNBufferBlob<T>>;
+
+    /**
+     * @brief Creates the blob over the buffer, the queue maps the buffer when the blob is accessed on the host
+     */
+    CLDNNBufferBlob(const TensorDesc &tensorDesc, cl_mem buffer, cl_command_queue queue)
+        : TBlob<T>(tensorDesc, details::shared_from_irelease(
+            static_cast<IAllocator *>(new CLDNNBufferAllocator(buffer, queue)))),
+          _buffer(buffer) {
+        TBlob<T>::allocate();
+    }
+
+    void *clBuffer() const noexcept override {
+        return _buffer;
+    }
+
+private:
+    cl_mem _buffer;
+};
+
+/**
+ * @brief Creates a blob over the OpenCL buffer of the application
+ * @tparam Type The element type of the blob
+ * @param tensorDesc The tensor descriptor of the network input
+ * @param buffer The OpenCL buffer of the context passed to the plugin
+ * @param queue The OpenCL queue mapping the buffer when the blob is accessed on the host
+ */
+template <typename Type>
+inline typename CLDNNBufferBlob<Type>::Ptr make_cldnn_buffer_blob(const TensorDesc &tensorDesc, cl_mem buffer,
+                                                                  cl_command_queue queue) {
+    return std::make_shared<CLDNNBufferBlob<Type>>(tensorDesc, buffer, queue);
+}
+
+}  // namespace InferenceEngine
@@ -41,12 +41,44 @@ DECLARE_CLDNN_CONFIG_KEY(PLUGIN_PRIORITY);
 */
 DECLARE_CLDNN_CONFIG_KEY(PLUGIN_THROTTLE);
 
+/**
+* @brief This key makes the network of a lower queue priority (KEY_CLDNN_PLUGIN_PRIORITY) give way to the networks
+* of a higher one running on the device at the same time. The execution waits for the inferences of the higher
+* priority after every slice of the given number of primitives, so a latency critical network waits for a slice of
+* a batch network instead of the whole inference. The value is a non-negative integer, 0 (default) disables the slicing.
+* The option is ignored with KEY_CLDNN_SHARED_MEM_POOL, whose networks run one at a time
+*/
+DECLARE_CLDNN_CONFIG_KEY(PREEMPTION_SLICE);
+
+/**
+* @brief This key makes the clDNN plugin collect the performance counters of 1 of the given number of inferences
+* of a request, without KEY_PERF_COUNT. GetPerformanceCounts reports the averages of the last sampled inferences and
+* the host time of enqueueing the network (the "enqueue" entry). The value is a non-negative integer, 0 (default)
+* disables the sampling
+*/
+DECLARE_CLDNN_CONFIG_KEY(PROFILING_SAMPLE);
+
 /**
 * @brief This key controls clDNN memory pool optimization.
 * Turned off by default.
 */
 DECLARE_CLDNN_CONFIG_KEY(MEM_POOL);
 
+/**
+* @brief This key enables the memory pool shared by the networks loaded with it (YES / NO, default NO).
+* The intermediate buffers are reused across the networks, so the inferences of the networks are executed
+* one at a time. The engine options are taken from the first of the networks. The weights of the same content
+* and layout (e.g. of the same model loaded with different options) are uploaded once for all of them.
+*/
+DECLARE_CLDNN_CONFIG_KEY(SHARED_MEM_POOL);
+
+/**
+* @brief This key controls the out-of-order execution queue of clDNN.
+* The primitives which don't depend on each other are reordered to run concurrently, the queue synchronizes
+* them by the dependencies of the network primitives. Turned on by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(OUT_OF_ORDER_QUEUE);
+
 /**
 * @brief This key defines the directory name to which clDNN graph visualization will be dumped.
 */
@@ -57,5 +89,51 @@ DECLARE_CLDNN_CONFIG_KEY(GRAPH_DUMPS_DIR);
 */
 DECLARE_CLDNN_CONFIG_KEY(SOURCES_DUMPS_DIR);
 
+/**
+* @brief This key defines the directory in which the compiled OpenCL programs are cached.
+* The programs found in the cache are not compiled again, which reduces the time of the network loading.
+*/
+DECLARE_CLDNN_CONFIG_KEY(KERNEL_CACHE_DIR);
+
+/**
+* @brief This key defines the number of threads compiling the OpenCL programs in parallel during the network loading.
+* The value is a positive integer, all the host cores are used by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(COMPILATION_THREADS);
+
+/**
+* @brief This key makes the clDNN plugin run an FP32 network with fp16 kernels (YES / NO, default NO).
+* The weights are converted to fp16 once during the network loading, the inputs and the outputs keep the precision
+* set by the application and are converted on the device by the input and output reorders.
+*/
+DECLARE_CLDNN_CONFIG_KEY(FP16_INFERENCE);
+
+/**
+* @brief This key makes the clDNN plugin run the networks on the OpenCL context (cl_context) of the application,
+* so the network inputs are bound to the OpenCL buffers of the application without copies (see CLDNNBufferBlob).
+* The value is the handle of the context as an unsigned integer, see makeSharedContextConfig() in
+* cldnn_shared_context.hpp. The networks run on the device of KEY_CLDNN_QUEUE or on the first device of the context.
+*/
+DECLARE_CLDNN_CONFIG_KEY(CONTEXT);
+
+/**
+* @brief This key makes the clDNN plugin enqueue the kernels to the OpenCL command queue (cl_command_queue)
+* of KEY_CLDNN_CONTEXT, so the inference is ordered after the commands the application enqueued before,
+* e.g. the decoding of the input frame. The value is the handle of the queue as an unsigned integer.
+* The performance counters and the kernel tuning need a queue created with CL_QUEUE_PROFILING_ENABLE.
+*/
+DECLARE_CLDNN_CONFIG_KEY(QUEUE);
+
+/**
+* @brief The value of PluginConfigParams::KEY_TUNING_MODE making the clDNN plugin tune the kernels in the background,
+* the default mode of the plugin. The network is loaded with the kernels found in the tuning cache and the heuristic
+* kernels for the rest, then the missing kernels are timed by a background thread while the device is idle and the
+* winners are appended to the cache, which the next loads use. The cache is the PluginConfigParams::KEY_TUNING_FILE,
+* by default the tuning_cache.txt file in KEY_CLDNN_KERNEL_CACHE_DIR or in the cache directory of the user.
+* The file keeps the winners by the device and the driver version, it is safe to share between the processes and the
+* files of several hosts are merged by concatenation.
+*/
+DECLARE_CLDNN_CONFIG_VALUE(TUNING_BACKGROUND);
+
 }  // namespace CLDNNConfigParams
 }  // namespace InferenceEngine
@@ -0,0 +1,52 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header for running the clDNN plugin on the OpenCL context of the application,
+ *        the blobs over the OpenCL buffers are in cldnn_buffer_blob.hpp
+ *
+ * @file cldnn_shared_context.hpp
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include "cldnn_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @interface ICLDNNBufferBlob
+ * @brief The blob over an OpenCL buffer, the clDNN plugin binds it to the network input without a copy
+ * when the network runs on the context of the buffer (CLDNNConfigParams::KEY_CLDNN_CONTEXT)
+ */
+class ICLDNNBufferBlob {
+public:
+    /**
+     * @brief Returns the OpenCL buffer (cl_mem) of the blob
+     */
+    virtual void *clBuffer() const noexcept = 0;
+
+protected:
+    virtual ~ICLDNNBufferBlob() = default;
+};
+
+/**
+ * @brief Returns the plugin config running the networks on the OpenCL context and queue of the application
+ * @param context The OpenCL context (cl_context) the inputs are shared in
+ * @param queue The OpenCL queue (cl_command_queue) of the context the kernels are enqueued to,
+ * nullptr makes the plugin create its own
+ */
+inline std::map<std::string, std::string> makeSharedContextConfig(void *context, void *queue = nullptr) {
+    std::map<std::string, std::string> config;
+    config[CLDNNConfigParams::KEY_CLDNN_CONTEXT] = std::to_string(reinterpret_cast<uintptr_t>(context));
+    if (queue != nullptr) {
+        config[CLDNNConfigParams::KEY_CLDNN_QUEUE] = std::to_string(reinterpret_cast<uintptr_t>(queue));
+    }
+    return config;
+}
+
+}  // namespace InferenceEngine
@@ -62,10 +62,10 @@ public:
 
     /**
      * @brief Wraps original method
-     * ICNNNetReader::ReadWeights
+     * ICNNNetReader::ReadWeights(const char*, bool, ResponseDesc*)
      */
-    void ReadWeights(const std::string &filepath) const {
-        CALL_STATUS_FNC(ReadWeights, filepath.c_str());
+    void ReadWeights(const std::string &filepath, bool mmap = false) const {
+        CALL_STATUS_FNC(ReadWeights, filepath.c_str(), mmap);
     }
 
     /**
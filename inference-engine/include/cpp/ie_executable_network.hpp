@@ -100,6 +100,81 @@ public:
         CALL_STATUS_FNC(GetMappedTopology, deployedTopology);
     }
 
+    /**
+    * @brief Gets the memory used by the executable network
+    * @return MemoryFootprint object holding the sizes in bytes
+    */
+    MemoryFootprint GetMemoryFootprint() {
+        MemoryFootprint footprint;
+        CALL_STATUS_FNC(GetMemoryFootprint, footprint);
+        return footprint;
+    }
+
+    /**
+    * @brief Gets the hints to size the pool of the infer requests
+    * @return ExecutableNetworkMetrics object
+    */
+    ExecutableNetworkMetrics GetMetrics() {
+        ExecutableNetworkMetrics metrics;
+        CALL_STATUS_FNC(GetMetrics, metrics);
+        return metrics;
+    }
+
+    /**
+    * @brief Changes the shapes of the inputs of the loaded network, the infer requests created after the call infer them
+    * @param inputShapes The new shapes of the inputs by their names
+    */
+    void Reshape(const ICNNNetwork::InputShapes &inputShapes) {
+        CALL_STATUS_FNC(Reshape, inputShapes);
+    }
+
+    /**
+    * @brief Releases the intermediate data and the device buffers of the idle network, the next inference allocates
+    * them again
+    */
+    void Trim() {
+        CALL_STATUS_FNC(Trim, false);
+    }
+
+    /**
+    * @brief Releases the memory of the idle network as Trim does, together with the networks compiled for the other
+    * shapes of the inputs and their weights
+    */
+    void Hibernate() {
+        CALL_STATUS_FNC(Trim, true);
+    }
+
+    /**
+    * @brief Starts the asynchronous inferences of the requests created by the network, their tasks are queued at once
+    * @param requests The requests to start
+    */
+    void StartAsync(std::vector<InferRequest> &requests) {
+        auto actualRequests = toActualRequests(requests);
+        CALL_STATUS_FNC(StartAsyncRequests, actualRequests.data(), actualRequests.size());
+    }
+
+    /**
+    * @brief Waits for all the started requests, see IExecutableNetwork::WaitRequests
+    * @param requests The requests to wait for
+    * @param millis_timeout Maximum duration in milliseconds to block for
+    * @return OK if all the requests succeeded, GENERAL_ERROR if some failed, RESULT_NOT_READY on the timeout
+    */
+    StatusCode WaitAll(std::vector<InferRequest> &requests, int64_t millis_timeout) {
+        size_t completed = 0;
+        return waitRequests(requests, true, millis_timeout, completed);
+    }
+
+    /**
+    * @brief Waits for the first completed request of the started ones, see IExecutableNetwork::WaitRequests
+    * @param requests The requests to wait for
+    * @param millis_timeout Maximum duration in milliseconds to block for
+    * @param completed Receives the index of the completed request
+    * @return The status of the completed request, RESULT_NOT_READY on the timeout
+    */
+    StatusCode WaitAny(std::vector<InferRequest> &requests, int64_t millis_timeout, size_t &completed) {
+        return waitRequests(requests, false, millis_timeout, completed);
+    }
+
     /**
     * cast operator is used when this wrapper initialized by LoadNetwork
     * @return
@@ -132,6 +207,26 @@ public:
 
 
     using Ptr = std::shared_ptr<ExecutableNetwork>;
+
+private:
+    static std::vector<IInferRequest::Ptr> toActualRequests(std::vector<InferRequest> &requests) {
+        std::vector<IInferRequest::Ptr> actualRequests;
+        for (auto &request : requests) {
+            actualRequests.push_back(static_cast<IInferRequest::Ptr &>(request));
+        }
+        return actualRequests;
+    }
+
+    StatusCode waitRequests(std::vector<InferRequest> &requests, bool waitAll, int64_t millis_timeout,
+                            size_t &completed) {
+        auto actualRequests = toActualRequests(requests);
+        ResponseDesc resp;
+        auto status = actual->WaitRequests(actualRequests.data(), actualRequests.size(), waitAll, millis_timeout,
+                                           &completed, &resp);
+        if (status != OK && status != GENERAL_ERROR && status != RESULT_NOT_READY && status != INFER_NOT_STARTED)
+            InferenceEngine::details::extract_exception(status, resp.msg);
+        return status;
+    }
 };
 
 }  // namespace InferenceEngine
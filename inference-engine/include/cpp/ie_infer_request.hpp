@@ -12,6 +12,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include "ie_iinfer_request.hpp"
 #include "details/ie_exception_conversion.hpp"
 
@@ -145,6 +146,30 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @brief Wraps original method
+     * IInferRequest::SetROIs
+     */
+    void SetROIs(const std::string &name, const Blob::Ptr &frame, const std::vector<ROI> &rois) {
+        CALL_STATUS_FNC(SetROIs, name.c_str(), frame, rois);
+    }
+
+    /**
+     * @brief Wraps original method
+     * IInferRequest::SetSequenceStates
+     */
+    void SetSequenceStates(const std::vector<SequenceState::Ptr> &sequences) {
+        CALL_STATUS_FNC(SetSequenceStates, sequences);
+    }
+
+    /**
+     * @brief Wraps original method
+     * IInferRequest::SetRequestedOutputs
+     */
+    void SetRequestedOutputs(const std::vector<std::string> &outputs) {
+        CALL_STATUS_FNC(SetRequestedOutputs, outputs);
+    }
+
     /**
      * constructs InferRequest from initialised shared_pointer
      * @param actual
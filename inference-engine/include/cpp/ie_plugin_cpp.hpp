@@ -9,11 +9,14 @@
  */
 #pragma once
 
+#include <chrono>
+#include <future>
 #include <map>
 #include <string>
 #include <memory>
 
 #include "ie_plugin.hpp"
+#include "ie_load_profile.hpp"
 #include "details/ie_exception_conversion.hpp"
 #include "cpp/ie_executable_network.hpp"
 #include "ie_plugin_ptr.hpp"
@@ -22,6 +25,44 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief A handle of the network being loaded in the background by InferencePlugin::LoadNetworkAsync
+ */
+class LoadNetworkTask {
+public:
+    LoadNetworkTask() = default;
+
+    LoadNetworkTask(const std::shared_future<ExecutableNetwork> &network, const LoadProgress::Ptr &progress)
+            : _network(network), _progress(progress) {}
+
+    /**
+     * @brief Stops the loading at the next phase boundary, Get() throws then
+     */
+    void Cancel() {
+        if (_progress) _progress->cancel();
+    }
+
+    /**
+     * @brief Waits for the loading to finish
+     * @param millis_timeout The maximum time to wait
+     * @return true if the loading finished, successfully or not
+     */
+    bool Wait(int64_t millis_timeout) const {
+        return _network.wait_for(std::chrono::milliseconds(millis_timeout)) == std::future_status::ready;
+    }
+
+    /**
+     * @brief Waits for the loading to finish and returns the network, rethrows the error of the loading
+     */
+    ExecutableNetwork Get() const {
+        return _network.get();
+    }
+
+private:
+    std::shared_future<ExecutableNetwork> _network;
+    LoadProgress::Ptr _progress;
+};
+
 /**
  * @brief This class is a C++ API wrapper for IInferencePlugin.
  * It can throw exceptions safely for the application, where it is properly handled.
@@ -77,6 +118,44 @@ public:
         return ExecutableNetwork(ret);
     }
 
+    /**
+     * @brief Wraps original method
+     * IInferencePlugin::LoadNetwork(IExecutableNetwork::Ptr&, ICNNNetwork&, const std::map<std::string, std::string> &,
+     * const std::shared_ptr<IAllocator>&, ResponseDesc*).
+     */
+    ExecutableNetwork LoadNetwork(CNNNetwork network, const std::map<std::string, std::string> &config,
+                                  const std::shared_ptr<IAllocator> &allocator) {
+        IExecutableNetwork::Ptr ret;
+        CALL_STATUS_FNC(LoadNetwork, ret, network, config, allocator);
+        if (ret.get() == nullptr) THROW_IE_EXCEPTION << "Internal error: pointer to executable network is null";
+        return ExecutableNetwork(ret);
+    }
+
+    /**
+     * @brief Loads the network on a separate thread, so the calling thread keeps serving the loaded ones.
+     * The plugin reports the phases of the loading (graph optimization, primitive selection, kernel compilation
+     * and others depending on the plugin) to the callback on the loading thread. The network must stay alive
+     * until the loading finishes, destroying the last handle of an unfinished loading waits for it.
+     * @param network The network to load
+     * @param config The config of the loading as for LoadNetwork
+     * @param onPhase The callback receiving the name of each started phase
+     * @return The handle to wait for the executable network on or to cancel the loading
+     */
+    LoadNetworkTask LoadNetworkAsync(CNNNetwork network, const std::map<std::string, std::string> &config,
+                                     const LoadProgress::Callback &onPhase = {}) {
+        auto progress = std::make_shared<LoadProgress>(onPhase);
+        InferencePlugin plugin = *this;
+        auto future = std::async(std::launch::async, [plugin, network, config, progress]() mutable {
+            struct ProgressScope {
+                explicit ProgressScope(const LoadProgress::Ptr &progress) { LoadProgress::setCurrent(progress); }
+                ~ProgressScope() { LoadProgress::setCurrent(nullptr); }
+            } scope(progress);
+            LoadProgress::phaseStarted("start");
+            return plugin.LoadNetwork(network, config);
+        });
+        return LoadNetworkTask(future.share(), progress);
+    }
+
     /**
      * @brief Wraps original method
      * IInferencePlugin::Infer(const BlobMap&, BlobMap&, ResponseDesc *resp)
@@ -30,5 +30,29 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the pipelined execution of the subgraphs.
+ * The value is the number of the sub-requests of every subgraph shared by all the infer requests of the network,
+ * so the subgraphs of the consecutive requests are executed on their devices at the same time.
+ * 0 (default) disables the pipeline, every infer request executes its own sub-requests one after another.
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_DEPTH);
+
+/**
+ * @brief The key for enabling of the automatic assigning of the layers by their execution time.
+ * The network is profiled on every device of the TARGET_FALLBACK list and the layers are assigned to minimize the
+ * execution time including the copying of the blobs between the devices.
+ * It is applied only when no layer of the network has affinity. This option should be used with values:
+ * CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(AUTO_AFFINITY);
+
+/**
+ * @brief The key for the file caching the affinities assigned by KEY_HETERO_AUTO_AFFINITY.
+ * If the file exists, the affinities are read from it instead of profiling the network, otherwise the profiled
+ * affinities are written to it. The file holds one "<layer name> <device>" line per layer.
+ */
+DECLARE_HETERO_CONFIG_KEY(AFFINITY_FILE);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -63,4 +63,18 @@ public:
  */
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateDefaultAllocator() noexcept;
 
+/**
+ * @brief Creates the allocator of a named shared memory segment, the blobs of the processes using the segment of
+ * the same name share the data. E.g. the process decoding the frames creates the segment and the blob of a frame
+ * in it, the inference process opens it and sets the blob of the same layout to the infer request (see
+ * IInferRequest::SetBlob), so the frame is not copied on the way. The allocator serves a single blob of the
+ * segment size, the process creating the segment removes its name when the allocator is released.
+ * @param name The name of the segment
+ * @param size The bytes of the created segment, the opened one is mapped whole if 0
+ * @param create Creates the segment if true (fails if it exists), opens the existing one otherwise
+ * @return The Inference Engine IAllocator* instance or nullptr if the segment cannot be created or mapped
+ */
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateSharedMemoryAllocator(const char *name, size_t size,
+                                                                            bool create) noexcept;
+
 }  // namespace InferenceEngine
@@ -77,6 +77,8 @@ enum Layout : uint8_t {
     // I/O data layouts
     NCHW = 1,
     NHWC = 2,
+    NCDHW = 3,
+    NDHWC = 4,
 
     // weight layouts
     OIHW = 64,
@@ -135,6 +137,20 @@ struct InferenceEngineProfileInfo {
      * @brief An execution index of the unit
      */
     unsigned execution_index;
+
+    /**
+     * @brief The number of the executions the statistics below are collected over. The statistics are filled
+     * by the plugins measuring every execution of the layer (CPU), zeros mean they are not available
+     */
+    unsigned num_runs = 0;
+    /**
+     * @brief The minimum, median (50th percentile), 99th percentile and maximum time in microseconds
+     * that one execution of the layer took
+     */
+    long long minRealTime_uSec = 0;
+    long long p50RealTime_uSec = 0;
+    long long p99RealTime_uSec = 0;
+    long long maxRealTime_uSec = 0;
 };
 
 
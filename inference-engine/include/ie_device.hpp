@@ -29,7 +29,8 @@ enum class TargetDevice : uint8_t {
     eFPGA = 4,
     eMYRIAD = 5,
     eGNA = 7,
-    eHETERO = 8
+    eHETERO = 8,
+    eMULTI = 9
 };
 
 /**
@@ -52,7 +53,8 @@ class TargetDeviceInfo {
             DECL_DEVICE(FPGA),
             DECL_DEVICE(MYRIAD),
             DECL_DEVICE(GNA),
-            DECL_DEVICE(HETERO)
+            DECL_DEVICE(HETERO),
+            DECL_DEVICE(MULTI)
         };
 #undef DECLARE
         return g_allDeviceInfos;
@@ -67,7 +69,8 @@ class TargetDeviceInfo {
             { "MYRIAD", InferenceEngine::TargetDevice::eMYRIAD },
             { "GNA", InferenceEngine::TargetDevice::eGNA },
             { "BALANCED", InferenceEngine::TargetDevice::eBalanced },
-            { "HETERO", InferenceEngine::TargetDevice::eHETERO }
+            { "HETERO", InferenceEngine::TargetDevice::eHETERO },
+            { "MULTI", InferenceEngine::TargetDevice::eMULTI }
         };
         auto val = deviceFromNameMap.find(deviceName);
         return val != deviceFromNameMap.end() ? val->second : InferenceEngine::TargetDevice::eDefault;
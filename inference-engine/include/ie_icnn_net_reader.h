@@ -64,6 +64,21 @@ public:
      */
     virtual StatusCode ReadWeights(const char *filepath, ResponseDesc *resp) noexcept = 0;
 
+    /**
+     * @brief Loads and sets the weights buffer directly from the IR .bin file.
+     * With mmap set, the file is mapped to memory copy-on-write instead of being read: the blobs of the layers
+     * are views into the mapping that is shared by all the processes using the same file, and the pages are
+     * copied only when they are modified. If the file cannot be mapped, it is read as usual.
+     * The default implementation always reads the file.
+     * @param filepath Full path to the .bin file
+     * @param mmap Whether the file is mapped to memory
+     * @param resp Response message
+     * @return Result code
+     */
+    virtual StatusCode ReadWeights(const char *filepath, bool mmap, ResponseDesc *resp) noexcept {
+        return ReadWeights(filepath, resp);
+    }
+
     /**
      * @brief Returns a pointer to the built network
      * @param resp Response message
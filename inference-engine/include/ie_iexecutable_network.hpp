@@ -14,6 +14,9 @@
 #include "ie_iinfer_request.hpp"
 #include "ie_imemory_state.hpp"
 #include "ie_input_info.hpp"
+#include "ie_icnn_network.hpp"
+#include <algorithm>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -26,6 +29,128 @@ namespace InferenceEngine {
  */
 using ConstOutputsDataMap = std::map<std::string, CDataPtr>;
 
+/**
+ * @brief The memory used by an executable network in bytes
+ */
+struct MemoryFootprint {
+    /**
+     * @brief The constant data of the network: weights, biases and the precomputed constants
+     */
+    size_t weights = 0;
+    /**
+     * @brief The intermediate data of the layers, allocated once per stream of the network
+     */
+    size_t workspace = 0;
+    /**
+     * @brief The inputs and outputs of one inference
+     */
+    size_t io = 0;
+    /**
+     * @brief The memory allocated by every infer request created from the network
+     */
+    size_t perRequest = 0;
+    /**
+     * @brief The largest memory used by the network since it was loaded. The plugins allocating the memory of the
+     * infer requests on the device include it as well
+     */
+    size_t peak = 0;
+};
+
+/**
+ * @brief The distribution of one of the latencies of the inferences of an executable network. The bucket i counts
+ * the latencies from 2^i up to 2^(i+1) microseconds, the first bucket counts the shorter ones as well and the last
+ * one the longer ones.
+ */
+struct LatencyHistogram {
+    /**
+     * @brief The number of the buckets, the last one starts at 2^23 microseconds (8.4 s)
+     */
+    enum { BucketsCount = 24 };
+
+    /**
+     * @brief The number of the latencies measured so far
+     */
+    uint64_t count = 0;
+    /**
+     * @brief The average latency in microseconds, 0 before the first one
+     */
+    double averageMicros = 0;
+    /**
+     * @brief The longest latency in microseconds
+     */
+    uint64_t maxMicros = 0;
+    /**
+     * @brief The number of the latencies in every bucket, BucketsCount of them
+     */
+    std::vector<uint64_t> buckets = std::vector<uint64_t>(BucketsCount, 0);
+
+    /**
+     * @brief Estimates the percentile of the latencies by the upper bound of its bucket
+     * @param fraction - the fraction of the latencies not longer than the result, e.g. 0.99
+     * @return the latency in microseconds, 0 if none is measured
+     */
+    uint64_t percentileMicros(double fraction) const {
+        uint64_t rank = static_cast<uint64_t>(fraction * count);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < buckets.size(); i++) {
+            seen += buckets[i];
+            if (seen > rank)
+                return std::min<uint64_t>(uint64_t(2) << i, maxMicros);
+        }
+        return maxMicros;
+    }
+};
+
+/**
+ * @brief The hints to size the pool of the infer requests of an executable network and the latencies of its
+ * inferences. The latencies and the request counts are measured always, they do not need the per-layer performance
+ * counters (KEY_PERF_COUNT).
+ */
+struct ExecutableNetworkMetrics {
+    /**
+     * @brief The number of the infer requests running at once that saturate the device
+     */
+    unsigned int optimalInferRequests = 1;
+    /**
+     * @brief The number of the streams executing the infer requests of the network in parallel
+     */
+    unsigned int streams = 1;
+    /**
+     * @brief The infer requests of the network started and not completed yet: queued or running
+     */
+    unsigned int queueDepth = 0;
+    /**
+     * @brief The average time of an inference in microseconds over the inferences completed so far, 0 before
+     * the first one
+     */
+    double averageExecutionTime = 0;
+    /**
+     * @brief The asynchronous inferences started and waiting for the executor, pre-processed ahead or not
+     */
+    unsigned int queuedRequests = 0;
+    /**
+     * @brief The inferences running on the device
+     */
+    unsigned int runningRequests = 0;
+    /**
+     * @brief The completed inferences waiting for their callbacks or running them
+     */
+    unsigned int callbackRequests = 0;
+    /**
+     * @brief The time from StartAsync until the inference starts: the time in the queues of the executors and the
+     * pre-processing running ahead of the inference
+     */
+    LatencyHistogram queueLatency;
+    /**
+     * @brief The time of the inferences, the synchronous ones included
+     */
+    LatencyHistogram executionLatency;
+    /**
+     * @brief The time from the completion of an inference until its callback starts on the callback executor
+     */
+    LatencyHistogram callbackLatency;
+};
+
 /**
  * @brief This is an interface of an executable network
  */
@@ -89,6 +214,74 @@ public:
      * @return Status code of the operation: OK (0) for success, OUT_OF_BOUNDS (-6) no memory state for given index
      */
     virtual StatusCode  QueryState(IMemoryState::Ptr & pState, size_t  idx, ResponseDesc *resp) noexcept = 0;
+
+    /**
+     * @brief Gets the memory used by the executable network, e.g. to fit the networks into a memory limit
+     * @param footprint Reference to the MemoryFootprint object to fill
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not report the memory
+     */
+    virtual StatusCode GetMemoryFootprint(MemoryFootprint &footprint, ResponseDesc *resp) noexcept = 0;
+
+    /**
+     * @brief Gets the hints to size the pool of the infer requests, e.g. by an autoscaler
+     * @param metrics Reference to the ExecutableNetworkMetrics object to fill
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not report them
+     */
+    virtual StatusCode GetMetrics(ExecutableNetworkMetrics &metrics, ResponseDesc *resp) noexcept = 0;
+
+    /**
+     * @brief Changes the shapes of the inputs of the loaded network without loading it again. The infer requests
+     * created after the call infer the new shapes, the requests created before keep the shapes they were created with
+     * @param inputShapes The new shapes of the inputs by their names, the inputs not listed keep their shapes
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin cannot reshape the
+     * loaded network
+     */
+    virtual StatusCode Reshape(const ICNNNetwork::InputShapes &inputShapes, ResponseDesc *resp) noexcept = 0;
+
+    /**
+     * @brief Starts the asynchronous inferences of a group of the requests created by the executable network:
+     * the requests are prepared first and their tasks are queued at once
+     * @param requests Pointer to the array of the requests
+     * @param count Number of the requests
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, REQUEST_BUSY if some of the requests are busy, the
+     * other requests are started then
+     */
+    virtual StatusCode StartAsyncRequests(IInferRequest::Ptr *requests, size_t count, ResponseDesc *resp) noexcept = 0;
+
+    /**
+     * @brief Waits for all or any of a group of the requests started asynchronously. The requests created by the
+     * executable network notify one condition variable on completion, so no polling of the requests is involved.
+     * The completed requests stay completed until they are started again.
+     * @param requests Pointer to the array of the requests, the requests never started are skipped
+     * @param count Number of the requests
+     * @param waitAll True to wait for all the requests, false for the first completed one
+     * @param millis_timeout Maximum duration in milliseconds to block for, IInferRequest::WaitMode::RESULT_READY
+     * blocks until the requests complete, IInferRequest::WaitMode::STATUS_ONLY returns at once
+     * @param completed Optional: receives the index of the completed request, if waitAll is false
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) if the awaited requests succeeded, GENERAL_ERROR if some of them
+     * failed (their Wait reports the error), RESULT_NOT_READY on the timeout, INFER_NOT_STARTED if none of the requests
+     * was started
+     */
+    virtual StatusCode WaitRequests(IInferRequest::Ptr *requests, size_t count, bool waitAll, int64_t millis_timeout,
+                                    size_t *completed, ResponseDesc *resp) noexcept = 0;
+
+    /**
+     * @brief Releases the memory the idle executable network keeps between the inferences while the compiled network
+     * is kept: the intermediate data of the layers and the device buffers. The next inference allocates the released
+     * memory again, which is much faster than loading the network again. The output blobs of the earlier inferences
+     * may be invalidated, the results are to be read before the network is trimmed.
+     * @param releaseWeights True to release also the networks compiled for the other shapes of the inputs (see
+     * Reshape) together with their weights, they are compiled again when those shapes are used
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, REQUEST_BUSY if some of the requests of the network
+     * infer, NOT_IMPLEMENTED if the plugin cannot release the memory
+     */
+    virtual StatusCode Trim(bool releaseWeights, ResponseDesc *resp) noexcept { return NOT_IMPLEMENTED; }
 };
 
 }  // namespace InferenceEngine
@@ -42,7 +42,10 @@ struct DataConfig {
      */
     TensorDesc desc;
     /**
-     * @brief Index of in-place memory. If -1 memory cannot be in-place
+     * @brief Index of in-place memory. If -1 memory cannot be in-place.
+     * For the output it is the index of the input, which memory the output may share. The plugin drops the hint
+     * if the input is read by other layers or its dimensions differ, so the implementation must produce the same
+     * result whether the blobs are shared or not.
      */
     int inPlace = -1;
     /**
@@ -12,9 +12,11 @@
 
 #include "ie_common.h"
 #include <ie_blob.h>
+#include <ie_imemory_state.hpp>
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <details/ie_irelease.hpp>
 
 namespace InferenceEngine {
@@ -133,6 +135,40 @@ public:
     * @return Enumeration of the resulted action: OK (0) for success
     */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Sets a frame and the ROIs inside of it for an input with the resize algorithm set.
+    * Every ROI is cropped from the frame and resized to the image of the same index in the batch of the input.
+    * @note: Memory allocation does not happen, the frame must be valid until the inference is completed
+    * @param name Name of the input.
+    * @param frame Reference to the frame, its precision must match the input precision.
+    * @param rois ROIs inside of the frame, not more than the batch of the input.
+    * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if occurred)
+    * @return Enumeration of the resulted action: OK (0) for success
+    */
+    virtual StatusCode SetROIs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois,
+                               ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Sets the sequences the following inferences of the request read and advance the memory states of,
+    * one sequence per sample of the batch (see SequenceState). An empty vector makes the request use the states
+    * of the executable network again.
+    * @param sequences States of the sequences, not more than the batch of the request.
+    * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if occurred)
+    * @return Enumeration of the resulted action: OK (0) for success
+    */
+    virtual StatusCode SetSequenceStates(const std::vector<SequenceState::Ptr> &sequences,
+                                         ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Sets the outputs the following inferences of the request compute, the plugin may skip the layers the
+    * other outputs only depend on, so the blobs of the other outputs are left as they are. An empty vector makes the
+    * request compute all the outputs again.
+    * @param outputs Names of the outputs of the network.
+    * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if occurred)
+    * @return Enumeration of the resulted action: OK (0) for success, NOT_FOUND for an unknown output
+    */
+    virtual StatusCode SetRequestedOutputs(const std::vector<std::string> &outputs, ResponseDesc *resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
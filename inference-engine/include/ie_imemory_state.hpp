@@ -9,7 +9,10 @@
  */
 
 #pragma once
+#include <map>
 #include <memory>
+#include <string>
+#include <utility>
 #include "details/ie_no_copy.hpp"
 #include "ie_common.h"
 #include "ie_blob.h"
@@ -58,4 +61,38 @@ class IMemoryState : public details::no_copy {
     virtual StatusCode GetLastState(Blob::CPtr & lastState, ResponseDesc *resp) const noexcept = 0;
 };
 
+/**
+ * @brief The states of the memory layers of one sequence (e.g. of one stream of a speech recognition), kept apart
+ * from the infer requests, so a few requests serve many interleaved sequences: a request set to the sequence by
+ * IInferRequest::SetSequenceStates reads and advances the states of the sequence instead of its own ones.
+ * The buffers are allocated by the plugin on the first inference of the sequence, the states start from zeros.
+ * A sequence may be set to several requests, but must not be inferred by them at the same time.
+ */
+class SequenceState {
+public:
+    using Ptr = std::shared_ptr<SequenceState>;
+
+    /**
+     * @brief Starts the sequence over, its states are zeros on its next inference
+     */
+    void Reset() {
+        buffers.clear();
+    }
+
+    /**
+     * @brief Returns the state of the memory layer of the given id after the last inference of the sequence
+     * or nullptr if the sequence was not inferred yet
+     */
+    Blob::CPtr GetLastState(const std::string &id) const {
+        auto it = buffers.find(id);
+        return it == buffers.end() ? nullptr : it->second.first;
+    }
+
+    /**
+     * @brief The buffers of the states by the id of the memory layer, managed by the plugin:
+     * the current state and a buffer the plugin may produce the next state to
+     */
+    std::map<std::string, std::pair<Blob::Ptr, Blob::Ptr>> buffers;
+};
+
 }  // namespace InferenceEngine
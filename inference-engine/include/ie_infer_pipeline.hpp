@@ -0,0 +1,143 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the streaming inference pipeline
+ * @file ie_infer_pipeline.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ie_api.h"
+#include "cpp/ie_infer_request.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief One frame of the stream passing through the stages of the pipeline
+ */
+struct PipelineFrame {
+    using Ptr = std::shared_ptr<PipelineFrame>;
+
+    /** @brief The position of the frame in the stream, the sink receives the frames in this order */
+    uint64_t index = 0;
+    /**
+     * @brief The request the frame is inferred with. It is taken from the pool of the pipeline before the
+     * pre-processing and returned after the post-processing, so the sink receives the frame without it.
+     */
+    InferRequest::Ptr request;
+    /** @brief The data of the application, e.g. the decoded image and then the detections */
+    std::shared_ptr<void> data;
+};
+
+/**
+ * @brief The configuration of the pipeline stages
+ */
+struct InferPipelineConfig {
+    /** @brief The number of the threads pre-processing the frames */
+    size_t preprocessWorkers = 1;
+    /** @brief The number of the frames inferred at once, 0 infers as many as the pipeline has requests */
+    size_t inferWorkers = 0;
+    /** @brief The number of the threads post-processing the frames */
+    size_t postprocessWorkers = 1;
+    /**
+     * @brief The number of the frames waiting in front of every stage. The stage before a full queue blocks, so
+     * the decoding does not run ahead of the inference.
+     */
+    size_t queueCapacity = 2;
+};
+
+/**
+ * @brief The time the frames spent in one stage of the pipeline
+ */
+struct PipelineStageStatistics {
+    /** @brief The name of the stage: "decode", "preprocess", "infer", "postprocess" or "sink" */
+    std::string name;
+    /** @brief The number of the frames the stage processed */
+    size_t frames;
+    /** @brief The total time the stage processed the frames */
+    double busyMs;
+    /** @brief The total time the frames waited in the queue in front of the stage (and for a free request) */
+    double waitMs;
+};
+
+/**
+ * @class InferPipeline
+ * @brief Runs the stream of the frames through the decode, preprocess, infer, postprocess and sink stages on its
+ * own threads, the stages of different frames overlap. The stages are connected by the bounded queues and the
+ * number of the frames in flight is bounded by the requests of the pipeline (backpressure). The frames may be
+ * pre-processed, inferred and post-processed out of order by several workers, the sink receives them in the order
+ * they were decoded.
+ *
+ * The stages record their events to the inference trace (KEY_TRACE_FILE) under the "pipeline" category, the time of
+ * the stages is returned by statistics().
+ */
+class INFERENCE_ENGINE_API_CLASS(InferPipeline) {
+public:
+    using Ptr = std::shared_ptr<InferPipeline>;
+
+    /**
+     * @brief Decodes the next frame into its data, returns false at the end of the stream
+     */
+    using Source = std::function<bool(PipelineFrame &frame)>;
+
+    /**
+     * @brief Processes the frame: the pre-processing fills the input blobs of the request of the frame, the
+     * post-processing reads its output blobs into the data of the frame, the sink consumes the frame
+     */
+    using Stage = std::function<void(PipelineFrame &frame)>;
+
+    /**
+     * @brief Creates the pipeline, the threads are started by start()
+     * @param requests - the requests of one executable network, the frames are inferred with them in turn
+     * @param config - the worker counts and the queue capacity of the stages
+     * @param decode - the source of the frames, it runs on a single thread
+     * @param preprocess - fills the inputs of the request of the frame
+     * @param postprocess - takes the outputs of the request of the frame, may be empty
+     * @param sink - consumes the frames in the order of the stream, it runs on a single thread
+     */
+    InferPipeline(const std::vector<InferRequest::Ptr> &requests, const InferPipelineConfig &config,
+                  const Source &decode, const Stage &preprocess, const Stage &postprocess, const Stage &sink);
+
+    /**
+     * @brief Stops the pipeline and waits for its threads
+     */
+    ~InferPipeline();
+
+    /**
+     * @brief Starts the threads of the stages
+     */
+    void start();
+
+    /**
+     * @brief Waits until the sink receives the last frame of the stream or the pipeline is stopped.
+     * Rethrows the first exception thrown by a stage, the failed stage stops the pipeline.
+     */
+    void wait();
+
+    /**
+     * @brief Stops the pipeline: the stages finish the frames they are processing, the queued frames are dropped
+     */
+    void stop();
+
+    /**
+     * @brief Returns the time of the stages in the order of the stages
+     */
+    std::vector<PipelineStageStatistics> statistics() const;
+
+    InferPipeline(const InferPipeline &) = delete;
+    InferPipeline &operator=(const InferPipeline &) = delete;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace InferenceEngine
@@ -125,7 +125,11 @@ public:
      * @return float value
      */
     float GetParamAsFloat(const char* param, float def) const {
-        std::string val = GetParamAsString(param, std::to_string(def).c_str());
+        auto it = params.find(param);
+        if (it == params.end()) {
+            return def;
+        }
+        const std::string& val = it->second;
         try {
             return std::stof(val);
         } catch (...) {
@@ -201,7 +205,11 @@ public:
      * @return An int value for the specified parameter
      */
     int GetParamAsInt(const char *param, int def) const {
-        std::string val = GetParamAsString(param, std::to_string(def).c_str());
+        auto it = params.find(param);
+        if (it == params.end()) {
+            return def;
+        }
+        const std::string& val = it->second;
         try {
             return std::stoi(val);
         } catch (...) {
@@ -277,7 +285,11 @@ public:
      * @return An unsigned integer value for the specified parameter
      */
     unsigned int GetParamAsUInt(const char *param, unsigned int def) const {
-        std::string val = GetParamAsString(param, std::to_string(def).c_str());
+        auto it = params.find(param);
+        if (it == params.end()) {
+            return def;
+        }
+        const std::string& val = it->second;
         std::string message = "Cannot parse parameter " + std::string(param) + " from IR for layer " + name
                               + ". Value " + val + " cannot be casted to int.";
         try {
@@ -374,7 +386,11 @@ public:
      * @return An bool value for the specified parameter
      */
     bool GetParamsAsBool(const char *param, bool def) const {
-        std::string val = GetParamAsString(param, std::to_string(def).c_str());
+        auto it = params.find(param);
+        if (it == params.end()) {
+            return def;
+        }
+        const std::string& val = it->second;
         std::string loweredCaseValue;
         std::transform(val.begin(), val.end(), std::back_inserter(loweredCaseValue), [](char value) {
             return std::tolower(value);
@@ -472,6 +488,10 @@ public:
      * @brief A convolution kernel height
      */
     unsigned int _kernel_y = 0;
+    /**
+     * @brief A convolution kernel depth, used by the 3D convolutions of the 5D inputs
+     */
+    unsigned int _kernel_z = 1;
     /**
      * @brief An input convolution stride width
      */
@@ -480,6 +500,10 @@ public:
      * @brief An Input convolution stride height
      */
     unsigned int _stride_y = 1;
+    /**
+     * @brief An input convolution stride depth
+     */
+    unsigned int _stride_z = 1;
     /**
      * @brief A number of output feature maps (size) generating the 3'rd output dimension
      */
@@ -492,6 +516,10 @@ public:
      * @brief Input padding height
      */
     unsigned int _padding_y = 0;
+    /**
+     * @brief Input padding depth
+     */
+    unsigned int _padding_z = 0;
     /**
      * @brief Dilation width
      */
@@ -500,6 +528,10 @@ public:
      * @brief Dilation height
      */
     unsigned int _dilation_y = 1;
+    /**
+     * @brief Dilation depth
+     */
+    unsigned int _dilation_z = 1;
     /**
      * @brief Number of groups
      */
@@ -576,6 +608,10 @@ public:
      * @brief Pooling kernel height
      */
     unsigned int _kernel_y = 0;
+    /**
+     * @brief Pooling kernel depth, used by the 3D pooling of the 5D inputs
+     */
+    unsigned int _kernel_z = 1;
     /**
      * @brief Input Pooling stride width
      */
@@ -584,6 +620,10 @@ public:
      * @brief Input Pooling stride height
      */
     unsigned int _stride_y = 0;
+    /**
+     * @brief Input Pooling stride depth
+     */
+    unsigned int _stride_z = 1;
     /**
      * @brief Input padding width
      */
@@ -592,6 +632,10 @@ public:
      * @brief Input padding height
      */
     unsigned int _padding_y = 0;
+    /**
+     * @brief Input padding depth
+     */
+    unsigned int _padding_z = 0;
 
     /**
      * @enum PoolType
@@ -972,4 +1016,53 @@ public:
     using WeightableLayer::WeightableLayer;
 };
 
+/**
+ * @brief This class represents a general matrix multiplication layer
+ * Formula is: output = alpha * op(A) * op(B) + beta * C
+ * The matrices are the two innermost dimensions of the inputs, the outer ones are the batch and are broadcast
+ * where one of the inputs has 1. The third input C is optional and is broadcast to the output.
+ */
+class GemmLayer : public CNNLayer {
+public:
+    /**
+     * @brief A scale factor of the product
+     */
+    float alpha = 1.f;
+    /**
+     * @brief A scale factor of the third input
+     */
+    float beta = 1.f;
+    /**
+     * @brief A flag that indicates if the matrices of the first input are transposed
+     */
+    bool transpose_a = false;
+    /**
+     * @brief A flag that indicates if the matrices of the second input are transposed
+     */
+    bool transpose_b = false;
+
+    /**
+     * @brief Creates a new GemmLayer instance.
+     */
+    using CNNLayer::CNNLayer;
+};
+
+/**
+ * @brief This class represents a gather layer (the embedding lookup)
+ * The slices of the first input (the dictionary) along the axis are taken at the indices of the second input.
+ * The output shape is the dictionary shape with the axis dimension replaced by the shape of the indices.
+ */
+class GatherLayer : public CNNLayer {
+public:
+    /**
+     * @brief The axis of the dictionary to take the slices along, the negative one counts from the end
+     */
+    int axis = 0;
+
+    /**
+     * @brief Creates a new GatherLayer instance.
+     */
+    using CNNLayer::CNNLayer;
+};
+
 }  // namespace InferenceEngine
@@ -228,6 +228,10 @@ public:
             case Layout::NHWC:
                 inconsistentLayout = dims.size() != 4;
                 break;
+            case Layout::NCDHW:
+            case Layout::NDHWC:
+                inconsistentLayout = dims.size() != 5;
+                break;
             case Layout::CHW:
                 inconsistentLayout = dims.size() != 3;
                 break;
@@ -0,0 +1,138 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the profile of the network loading
+ * @file ie_load_profile.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The time spent in one phase of the network loading
+ */
+struct LoadPhase {
+    /** @brief The name of the phase, e.g. "parse", "shape infer" or "kernel compile" */
+    std::string name;
+    /** @brief The total time of the phase since the profile was reset */
+    double totalMs;
+    /** @brief The number of times the phase ran since the profile was reset */
+    size_t count;
+};
+
+/**
+ * @class LoadProfile
+ * @brief Accumulates the time of the phases of reading and loading the networks: parsing and validation of the IR,
+ * reading the weights, shape inference and the phases of the plugins (graph optimization, primitive selection,
+ * memory planning, kernel compilation, weight upload). The profile is shared by the reader and all the plugins of
+ * the process, so the application resets it, reads and loads a network and takes the phases. A phase may contain
+ * another one, e.g. the topology build of the GPU plugin contains the weight upload.
+ */
+class INFERENCE_ENGINE_API_CLASS(LoadProfile) {
+public:
+    static LoadProfile &instance();
+
+    /**
+     * @brief Forgets the recorded phases
+     */
+    void reset();
+
+    /**
+     * @brief Adds the time to the phase, the phase is created on the first call
+     */
+    void add(const std::string &phase, double ms);
+
+    /**
+     * @brief Returns the phases in the order they first ran
+     */
+    std::vector<LoadPhase> phases() const;
+
+private:
+    LoadProfile() = default;
+
+    mutable std::mutex _mutex;
+    std::vector<LoadPhase> _phases;
+};
+
+/**
+ * @class LoadProgress
+ * @brief Reports the phases of one network loading to the application and lets it cancel the loading.
+ * The progress is attached to the loading thread, the phases of the plugins started on the thread call the callback
+ * and throw when the loading is cancelled, so the loading stops at the next phase boundary.
+ */
+class INFERENCE_ENGINE_API_CLASS(LoadProgress) {
+public:
+    using Ptr = std::shared_ptr<LoadProgress>;
+
+    /**
+     * @brief The callback receiving the name of the started phase
+     */
+    using Callback = std::function<void(const std::string &phase)>;
+
+    explicit LoadProgress(const Callback &callback) : _callback(callback), _cancelled(false) {}
+
+    /**
+     * @brief Requests the loading to stop at the next phase boundary
+     */
+    void cancel() {
+        _cancelled = true;
+    }
+
+    bool cancelled() const {
+        return _cancelled;
+    }
+
+    /**
+     * @brief Attaches the progress to the calling thread, nullptr detaches it
+     */
+    static void setCurrent(const Ptr &progress);
+
+    /**
+     * @brief Reports the start of the phase to the progress of the calling thread if any
+     * Throws if the loading is cancelled
+     */
+    static void phaseStarted(const char *phase);
+
+private:
+    Callback _callback;
+    std::atomic<bool> _cancelled;
+};
+
+/**
+ * @class LoadPhaseScope
+ * @brief Adds the time from the construction to the destruction to the phase of the load profile
+ */
+class LoadPhaseScope {
+public:
+    explicit LoadPhaseScope(const char *phase) : _phase(phase) {
+        LoadProgress::phaseStarted(phase);
+        _begin = std::chrono::steady_clock::now();
+    }
+
+    ~LoadPhaseScope() {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - _begin;
+        LoadProfile::instance().add(_phase, elapsed.count());
+    }
+
+    LoadPhaseScope(const LoadPhaseScope &) = delete;
+    LoadPhaseScope &operator=(const LoadPhaseScope &) = delete;
+
+private:
+    const char *_phase;
+    std::chrono::steady_clock::time_point _begin;
+};
+
+}  // namespace InferenceEngine
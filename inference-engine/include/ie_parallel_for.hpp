@@ -0,0 +1,256 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The parallel loops of the CPU plugin and the extensions over the threading runtime selected at build time.
+ * IE_THREAD is IE_THREAD_OMP (default), IE_THREAD_TBB or IE_THREAD_SEQ (see the THREADING option of the build).
+ * The iterations are split into the contiguous static ranges of the threads, like schedule(static) of OpenMP.
+ * @file ie_parallel_for.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#define IE_THREAD_TBB 0
+#define IE_THREAD_OMP 1
+#define IE_THREAD_SEQ 2
+
+#ifndef IE_THREAD
+#define IE_THREAD IE_THREAD_OMP
+#endif
+
+#if IE_THREAD == IE_THREAD_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#elif IE_THREAD == IE_THREAD_OMP
+#include <omp.h>
+#endif
+
+namespace InferenceEngine {
+
+/**
+ * @brief Returns the number of the threads the parallel loops of the calling thread are split into
+ */
+inline int parallel_get_max_threads() {
+#if IE_THREAD == IE_THREAD_TBB
+    return tbb::this_task_arena::max_concurrency();
+#elif IE_THREAD == IE_THREAD_OMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+/**
+ * @brief Returns the index of the calling thread among the threads of the parallel loop, it is below
+ * parallel_get_max_threads(), so it indexes the per thread buffers
+ */
+inline int parallel_get_thread_num() {
+#if IE_THREAD == IE_THREAD_TBB
+    int index = tbb::this_task_arena::current_thread_index();
+    return index == tbb::task_arena::not_initialized ? 0 : index;
+#elif IE_THREAD == IE_THREAD_OMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Limits the threads of the parallel loops of the calling thread, the TBB runtime keeps the arena it runs in
+ */
+inline void parallel_set_num_threads(int threads) {
+#if IE_THREAD == IE_THREAD_OMP
+    omp_set_num_threads(threads);
+#else
+    (void)threads;
+#endif
+}
+
+/**
+ * @brief Splits n items between team threads, the thread tid gets [start, end)
+ */
+template <typename T, typename Q>
+inline void splitter(T n, Q team, Q tid, T &start, T &end) {
+    if (team <= 1 || n == 0) {
+        start = 0;
+        end = n;
+    } else {
+        // the first n % team threads get one item more
+        T n1 = (n + static_cast<T>(team) - 1) / static_cast<T>(team);
+        T n2 = n1 - 1;
+        T T1 = n - n2 * static_cast<T>(team);
+        end = static_cast<T>(tid) < T1 ? n1 : n2;
+        start = static_cast<T>(tid) <= T1 ? static_cast<T>(tid) * n1 : T1 * n1 + (static_cast<T>(tid) - T1) * n2;
+    }
+    end += start;
+}
+
+/**
+ * @brief Runs func(ithr, nthr) on nthr threads, 0 takes all the threads of the runtime
+ */
+template <typename F>
+void parallel_nt(int nthr, const F &func) {
+#if IE_THREAD == IE_THREAD_TBB
+    if (nthr == 0) nthr = parallel_get_max_threads();
+    if (nthr == 1) {
+        func(0, 1);
+        return;
+    }
+    tbb::parallel_for(0, nthr, [&](int ithr) { func(ithr, nthr); }, tbb::static_partitioner());
+#elif IE_THREAD == IE_THREAD_OMP
+    if (nthr == 1) {
+        func(0, 1);
+        return;
+    }
+    if (nthr == 0) nthr = parallel_get_max_threads();
+    #pragma omp parallel num_threads(nthr)
+    func(omp_get_thread_num(), omp_get_num_threads());
+#else
+    (void)nthr;
+    func(0, 1);
+#endif
+}
+
+template <typename T0, typename F>
+void for_1d(int ithr, int nthr, const T0 &D0, const F &func) {
+    T0 d0, end;
+    splitter(D0, nthr, ithr, d0, end);
+    for (; d0 < end; ++d0) func(d0);
+}
+
+template <typename T0, typename T1, typename F>
+void for_2d(int ithr, int nthr, const T0 &D0, const T1 &D1, const F &func) {
+    const size_t work_amount = static_cast<size_t>(D0) * D1;
+    if (work_amount == 0) return;
+    size_t start, end;
+    splitter(work_amount, nthr, ithr, start, end);
+
+    T0 d0 = static_cast<T0>(start / D1);
+    T1 d1 = static_cast<T1>(start % D1);
+    for (size_t iwork = start; iwork < end; ++iwork) {
+        func(d0, d1);
+        if (++d1 == D1) {
+            d1 = 0;
+            ++d0;
+        }
+    }
+}
+
+template <typename T0, typename T1, typename T2, typename F>
+void for_3d(int ithr, int nthr, const T0 &D0, const T1 &D1, const T2 &D2, const F &func) {
+    const size_t work_amount = static_cast<size_t>(D0) * D1 * D2;
+    if (work_amount == 0) return;
+    size_t start, end;
+    splitter(work_amount, nthr, ithr, start, end);
+
+    T0 d0 = static_cast<T0>(start / D2 / D1);
+    T1 d1 = static_cast<T1>(start / D2 % D1);
+    T2 d2 = static_cast<T2>(start % D2);
+    for (size_t iwork = start; iwork < end; ++iwork) {
+        func(d0, d1, d2);
+        if (++d2 == D2) {
+            d2 = 0;
+            if (++d1 == D1) {
+                d1 = 0;
+                ++d0;
+            }
+        }
+    }
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename F>
+void for_4d(int ithr, int nthr, const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3, const F &func) {
+    const size_t work_amount = static_cast<size_t>(D0) * D1 * D2 * D3;
+    if (work_amount == 0) return;
+    size_t start, end;
+    splitter(work_amount, nthr, ithr, start, end);
+
+    T0 d0 = static_cast<T0>(start / D3 / D2 / D1);
+    T1 d1 = static_cast<T1>(start / D3 / D2 % D1);
+    T2 d2 = static_cast<T2>(start / D3 % D2);
+    T3 d3 = static_cast<T3>(start % D3);
+    for (size_t iwork = start; iwork < end; ++iwork) {
+        func(d0, d1, d2, d3);
+        if (++d3 == D3) {
+            d3 = 0;
+            if (++d2 == D2) {
+                d2 = 0;
+                if (++d1 == D1) {
+                    d1 = 0;
+                    ++d0;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Runs func(d0) for d0 in [0, D0) in parallel
+ */
+template <typename T0, typename F>
+void parallel_for(const T0 &D0, const F &func) {
+    parallel_nt(0, [&](int ithr, int nthr) { for_1d(ithr, nthr, D0, func); });
+}
+
+/**
+ * @brief Runs func(d0) for d0 in [0, D0) in parallel, the free threads take the iterations one by one, so it suits
+ * the iterations of the very different costs
+ */
+template <typename T0, typename F>
+void parallel_for_dynamic(const T0 &D0, const F &func) {
+#if IE_THREAD == IE_THREAD_TBB
+    tbb::parallel_for(T0(0), D0, [&](T0 d0) { func(d0); });
+#elif IE_THREAD == IE_THREAD_OMP
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (T0 d0 = 0; d0 < D0; ++d0) func(d0);
+#else
+    for (T0 d0 = 0; d0 < D0; ++d0) func(d0);
+#endif
+}
+
+/**
+ * @brief Runs func(d0, d1) over the D0 x D1 grid in parallel, the grid is split as a whole like collapse(2)
+ */
+template <typename T0, typename T1, typename F>
+void parallel_nd(const T0 &D0, const T1 &D1, const F &func) {
+    parallel_nt(0, [&](int ithr, int nthr) { for_2d(ithr, nthr, D0, D1, func); });
+}
+
+/**
+ * @brief Runs func(d0, d1, d2) over the D0 x D1 x D2 grid in parallel
+ */
+template <typename T0, typename T1, typename T2, typename F>
+void parallel_nd(const T0 &D0, const T1 &D1, const T2 &D2, const F &func) {
+    parallel_nt(0, [&](int ithr, int nthr) { for_3d(ithr, nthr, D0, D1, D2, func); });
+}
+
+/**
+ * @brief Runs func(d0, d1, d2, d3) over the D0 x D1 x D2 x D3 grid in parallel
+ */
+template <typename T0, typename T1, typename T2, typename T3, typename F>
+void parallel_nd(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3, const F &func) {
+    parallel_nt(0, [&](int ithr, int nthr) { for_4d(ithr, nthr, D0, D1, D2, D3, func); });
+}
+
+/**
+ * @brief Returns the sum of func(d0) for d0 in [0, D0) computed in parallel
+ */
+template <typename T0, typename R, typename F>
+R parallel_sum(const T0 &D0, const R &input, const F &func) {
+    const int nthr = parallel_get_max_threads();
+    std::vector<R> partial(nthr, R(0));
+    parallel_nt(nthr, [&](int ithr, int team) {
+        R sum = R(0);
+        for_1d(ithr, team, D0, [&](T0 d0) { sum += func(d0); });
+        partial[ithr] = sum;
+    });
+    R sum = input;
+    for (int i = 0; i < nthr; i++) sum += partial[i];
+    return sum;
+}
+
+}  // namespace InferenceEngine
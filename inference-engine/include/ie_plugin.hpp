@@ -16,6 +16,7 @@
 #include "ie_error.hpp"
 #include "ie_version.hpp"
 #include "ie_iexecutable_network.hpp"
+#include "ie_allocator.hpp"
 #include <string>
 #include <vector>
 #include <memory>
@@ -86,6 +87,26 @@ public:
     LoadNetwork(IExecutableNetwork::Ptr &ret, ICNNNetwork &network, const std::map<std::string, std::string> &config,
                 ResponseDesc *resp) noexcept = 0;
 
+    /**
+     * @brief Creates an executable network which allocates its memory with the given allocator.
+     * The allocator is used for the intermediate data, the repacked weights and the input/output blobs created by
+     * the plugin, so it may provide, for example, huge pages or pinned memory
+     * @param ret Reference to a shared ptr of the returned network interface
+     * @param network Network object acquired from CNNNetReader
+     * @param config Map of pairs: (config parameter name, config parameter value) relevant only for this load operation
+     * @param allocator Allocator of the memory of the network, nullptr means the default one of the plugin
+     * @param resp Pointer to the response message that holds a description of an error if any occurred
+     * @return Status code of the operation. OK if succeeded, NOT_IMPLEMENTED if the plugin does not support allocators
+     */
+    virtual StatusCode
+    LoadNetwork(IExecutableNetwork::Ptr &ret, ICNNNetwork &network, const std::map<std::string, std::string> &config,
+                const std::shared_ptr<IAllocator> &allocator, ResponseDesc *resp) noexcept {
+        if (allocator == nullptr) {
+            return LoadNetwork(ret, network, config, resp);
+        }
+        return NOT_IMPLEMENTED;
+    }
+
     /**
      * @brief Creates an executable network from a previously exported network
      * @param ret Reference to a shared ptr of the returned network interface
@@ -45,6 +45,208 @@ DECLARE_CONFIG_VALUE(NO);
 */
 DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 
+/**
+* @brief The name for setting the number of the threads executing the inference of the network on the CPU.
+* By default the network takes one thread per physical core available to the process (the hyper-threads are skipped).
+* The setting is per network, so the networks of one process can run on the teams of the different size. It is
+* passed to IInferencePlugin::LoadNetwork(), this option should be used with the non-negative integer value,
+* 0 (default) takes all the physical cores (or the cores of KEY_CPU_CORES)
+*/
+DECLARE_CONFIG_KEY(CPU_THREADS_NUM);
+
+/**
+* @brief The name for setting the cores executing the inference of the network on the CPU, e.g. "0-7" or "8-27,56".
+* The threads of the network are pinned to the listed logical cpus (see KEY_CPU_BIND_THREAD), so the networks of
+* one process can run on the disjoint sets of the cores without disturbing each other. The streams of the network
+* (KEY_CPU_THROUGHPUT_STREAMS) split the listed cpus between them. It is passed to IInferencePlugin::LoadNetwork(),
+* this option should be used with the comma separated list of the cpus and the ranges of the cpus, the empty list
+* (default) takes the physical cores available to the process
+*/
+DECLARE_CONFIG_KEY(CPU_CORES);
+
+/**
+* @brief Optimize CPU execution to maximize throughput.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* - KEY_CPU_THROUGHPUT_NUMA creates as many streams as needed to accomodate NUMA and avoid associated penalties
+* - KEY_CPU_THROUGHPUT_AUTO creates bare minimum of streams to improve the performance,
+*   this is the most portable option if you have no insights into how many cores you target machine will have
+*   (and what is the optimal number of streams)
+* - finally, specifying the positive integer value creates the requested number of streams
+*/
+DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
+DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
+DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
+
+/**
+* @brief Optimize GPU plugin execution to maximize throughput.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with the positive integer value
+* which is the number of streams (1 by default). Every stream is a separate network sharing the compiled kernels
+* and the weights of the others, the async requests are spread over the streams, so the host-side work of a request
+* overlaps with the kernels of another one.
+*/
+DECLARE_CONFIG_KEY(GPU_THROUGHPUT_STREAMS);
+
+/**
+* @brief The name for setting the work stealing execution of the CPU streams.
+* The requests are spread over the own queues of the streams and the idle streams take the requests queued
+* to the busy ones, so many requests started at the same time do not compete for a single queue.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_THROUGHPUT_WORK_STEALING);
+
+/**
+* @brief The name for setting parallel execution of independent branches of the topology on CPU.
+* The independent layers are executed at the same time, each by its own part of the threads, which is
+* beneficial for the latency of multi-branch topologies. It is passed to IInferencePlugin::SetConfig(),
+* this option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+* @brief The name for setting the allocator of the intermediate, weights and input/output memory on CPU.
+* PluginConfigParams::CPU_ALLOCATOR_HUGE_PAGES aligns every buffer to 2 MB and asks the system to back it with
+* huge pages, which reduces the TLB misses on the large activations. A custom allocator is passed with
+* IInferencePlugin::LoadNetwork() taking an IAllocator. It is passed to IInferencePlugin::SetConfig(),
+* this option should be used with values: PluginConfigParams::CPU_ALLOCATOR_SYSTEM (default) or
+* PluginConfigParams::CPU_ALLOCATOR_HUGE_PAGES
+*/
+DECLARE_CONFIG_VALUE(CPU_ALLOCATOR_SYSTEM);
+DECLARE_CONFIG_VALUE(CPU_ALLOCATOR_HUGE_PAGES);
+DECLARE_CONFIG_KEY(CPU_MEMORY_ALLOCATOR);
+
+/**
+* @brief The name for setting the memory domain of the network loaded to CPU.
+* The networks loaded with the same non-empty domain id share the memory of their intermediate data, so the
+* resident memory is the largest of their workspaces rather than the sum of them. The constant data stays private.
+* The networks of the domain must never be executed at the same time, so the option requires
+* KEY_EXCLUSIVE_ASYNC_REQUESTS=YES and the synchronous requests must not be run from different threads.
+* It is passed to IInferencePlugin::LoadNetwork(), the value is any string id, empty (default) means no sharing
+*/
+DECLARE_CONFIG_KEY(CPU_MEMORY_DOMAIN);
+
+/**
+* @brief The name for setting the number of the graphs the CPU network keeps compiled for the reshaped inputs.
+* With a positive value an input blob of other dimensions (of the same rank) can be set to the infer request.
+* The next inference reshapes a copy of the network to the dimensions of the input blobs and compiles a graph for it,
+* the most recently used graphs are kept, so switching back to their input shapes costs no compilation.
+* The output blobs of the request are reallocated on the shapes change, so they are to be taken with GetBlob again.
+* It is passed to IInferencePlugin::LoadNetwork(), this option should be used with the non-negative integer value,
+* 0 (default) disables the input shapes change. The option is not compatible with the streams and dynamic batch
+*/
+DECLARE_CONFIG_KEY(CPU_RESHAPE_CACHE_SIZE);
+
+/**
+* @brief The name for setting the time window (in microseconds) of the auto-batching of the CPU asynchronous requests.
+* The requests started within the window from the first of them are executed as one inference: their inputs are
+* stacked into the batch of the network, and the outputs are copied back to every request before its callback.
+* The network is loaded with its batch as the largest one, the requests set their own batch with SetBatch
+* (1 is typical) and must have no pre-processing. The requests of the network batch are executed alone.
+* It is passed to IInferencePlugin::LoadNetwork(), this option should be used with the non-negative integer value,
+* 0 (default) disables the auto-batching. The option requires KEY_DYN_BATCH_ENABLED=YES
+*/
+DECLARE_CONFIG_KEY(CPU_AUTO_BATCH_TIMEOUT);
+
+/**
+* @brief The name for setting the number of the samples the CPU network is executed for at once.
+* The graph is compiled for the given batch and the inference runs it over the batch of the network part by part,
+* so the intermediate data of a large batch do not have to fit the memory. The last part may be smaller.
+* It is passed to IInferencePlugin::LoadNetwork(), this option should be used with the non-negative integer value,
+* 0 (default) executes the whole batch. The option is not compatible with the dynamic batch and the reshape cache
+*/
+DECLARE_CONFIG_KEY(CPU_BATCH_TILE);
+
+/**
+* @brief The name for setting the number of the horizontal bands the images of the CPU network are executed in.
+* The graph is compiled for one band and the inference runs it band by band: the bands overlap by the rows of the
+* receptive fields of the layers, so the stitched outputs are equal to the outputs of the whole images while the
+* intermediate data take the memory of one band. The network must be fully convolutional: the convolutions,
+* deconvolutions, poolings, elementwise layers and the layers working along the channels only, with the inputs
+* of the same height, FP32 or U8, and without the mean image.
+* It is passed to IInferencePlugin::LoadNetwork(), this option should be used with the non-negative integer value,
+* 0 (default) and 1 execute the whole images. The option is not compatible with the dynamic batch and the reshape cache
+*/
+DECLARE_CONFIG_KEY(CPU_SPATIAL_TILES);
+
+/**
+* @brief The name for setting the priority of the asynchronous requests of the network.
+* The executors shared by the networks (KEY_EXCLUSIVE_ASYNC_REQUESTS=YES, which is the default of the HETERO plugin)
+* run the queued inference of the highest priority first, the inferences of the same priority in FIFO order.
+* It is passed to IInferencePlugin::LoadNetwork(), this option should be used with the integer value,
+* the higher value means the higher priority, 0 is the default. The HETERO plugin passes it to the subnetworks
+*/
+DECLARE_CONFIG_KEY(REQUEST_PRIORITY);
+
+/**
+* @brief The name for setting the preemption of the CPU network by the requests of a higher priority.
+* The inference of the network checks the shared executor between the nodes of the graph and executes the queued
+* inferences of the networks of a higher priority (KEY_REQUEST_PRIORITY) first, so a latency critical network does
+* not wait for the whole inference of a batch network. The option requires KEY_EXCLUSIVE_ASYNC_REQUESTS=YES and
+* is not compatible with KEY_CPU_MEMORY_DOMAIN. It is passed to IInferencePlugin::LoadNetwork(), this option should
+* be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_PREEMPTION);
+
+/**
+* @brief The name for setting the number of the threads the completion callbacks of the asynchronous requests run on.
+* The callbacks of the network run on a single thread by default, so a slow callback delays the completion of the
+* other requests. More threads run the callbacks of the different requests in parallel, 0 runs every callback inline
+* on the thread that completed the inference, which saves the thread switch but holds the inference thread for the
+* callback. The callbacks running in parallel must be thread-safe. It is passed to IInferencePlugin::LoadNetwork(),
+* this option should be used with the non-negative integer value, 1 is the default
+*/
+DECLARE_CONFIG_KEY(CALLBACK_THREADS);
+
+/**
+* @brief The name for setting the release of the weights of the network once the plugin copied them to its own memory.
+* The plugin drops the blobs of the layers of the network passed to LoadNetwork, so the weights read by CNNNetReader
+* are freed at the end of the load instead of being held by the application network as long as it lives. The
+* network can not be loaded again or exported afterwards. It is passed to IInferencePlugin::LoadNetwork(), this
+* option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(RELEASE_WEIGHTS);
+
+/**
+* @brief The name for setting the latency mode of the synchronous inference of the CPU plugin, the value is the time
+* in microseconds the waits spin for the completion before they block. Infer runs the graph on the calling thread
+* instead of passing it to the executor, the OpenMP threads spin between the inferences at least for this time
+* instead of going to sleep, and Wait of the asynchronous requests polls the completion for the time before it blocks.
+* The mode trades the CPU time of the spinning cores for the wake up latencies, it is meant for the back to back
+* inferences of a single request. It is passed to IInferencePlugin::LoadNetwork(), this option should be used with
+* the non-negative integer value, 0 (default) disables the mode
+*/
+DECLARE_CONFIG_KEY(CPU_LATENCY_SPIN);
+
+/**
+* @brief The name for setting the outputs of the CPU network, which are reduced to the index of the largest channel.
+* The output of the dimensions N x C x H x W (or N x C) becomes N x 1 x H x W (or N x 1) holding the argmax of the
+* channels, e.g. the class map of a segmentation network or the class id of a classifier, so the inference writes
+* one U8 or I32 value instead of C FP32 scores. The precision of such an output must be set to U8 (up to 256 channels)
+* or I32 through OutputsDataMap. It is passed to IInferencePlugin::LoadNetwork(), this option should be used with
+* the comma separated list of the output names, empty (default) keeps the outputs as they are
+*/
+DECLARE_CONFIG_KEY(CPU_ARGMAX_OUTPUTS);
+
+/**
+* @brief The name for setting the BF16 mode of the CPU plugin: the FP32 weights of the fully connected layers are
+* converted to BF16 at the network load and the layers accumulate their products in FP32, which halves the weights
+* the memory-bound layers read per inference at the cost of the 8bit mantissa of the weights. The inputs and the
+* outputs of the network may be set to Precision::BF16, they are converted at the boundaries of the graph. It is
+* passed to IInferencePlugin::LoadNetwork(), this option should be used with values: PluginConfigParams::YES or
+* PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(ENFORCE_BF16);
+
+/**
+* @brief The name for setting the warm-up of the CPU network: every graph (stream) runs an inference on zero inputs
+* at the end of the load, on the thread executing its inferences, so the first inference of the application does not
+* pay for the first touch of the memory of the graph, the start of the threads and the first calls of the kernels.
+* The networks with the memory layers are not warmed up, the inference would change their states. It is passed to
+* IInferencePlugin::LoadNetwork(), this option should be used with values: PluginConfigParams::YES or
+* PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_WARM_UP);
+
 /**
 * @brief The name for setting performance counters option.
 * It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
@@ -52,6 +254,22 @@ DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 */
 DECLARE_CONFIG_KEY(PERF_COUNT);
 
+/**
+* @brief The name for setting the file the timeline of the inference is written to in the Chrome trace format
+* (chrome://tracing, Perfetto UI). The timeline holds the queueing and the stages of the tasks, the execution of
+* the CPU nodes and the GPU primitives (the latter require KEY_PERF_COUNT=YES at the network load).
+* It is passed to IInferencePlugin::SetConfig() or LoadNetwork(), the recording is shared by all the plugins of
+* the process. The empty value stops the recording and writes the file.
+*/
+DECLARE_CONFIG_KEY(TRACE_FILE);
+
+/**
+* @brief The name for setting the duration (in milliseconds) of the recording started by KEY_TRACE_FILE.
+* The file is written once the window ends. This option should be used with the non-negative integer value,
+* 0 (default) records until the recording is stopped or the process exits.
+*/
+DECLARE_CONFIG_KEY(TRACE_WINDOW);
+
 /**
 * @brief The key defines dynamic limit of batch processing.
 * Specified value is applied to all following Infer() calls. Inference Engine processes
@@ -90,7 +308,8 @@ DECLARE_CONFIG_KEY(DUMP_KERNELS);
 /**
 * @brief This key controls performance tuning done or used by the plugin.
 * This option should be used with values: PluginConfigParams::TUNING_CREATE,
-* PluginConfigParams::TUNING_USE_EXISTING or PluginConfigParams::TUNING_DISABLED (default)
+* PluginConfigParams::TUNING_USE_EXISTING or PluginConfigParams::TUNING_DISABLED (default).
+* The clDNN plugin also takes CLDNNConfigParams::CLDNN_TUNING_BACKGROUND, which is its default.
 */
 DECLARE_CONFIG_KEY(TUNING_MODE);
 
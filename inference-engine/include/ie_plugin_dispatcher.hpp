@@ -10,9 +10,15 @@
 #pragma once
 
 #include "ie_plugin_ptr.hpp"
+#include <algorithm>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <cpp/ie_plugin_cpp.hpp>
+#include <cpp/ie_cnn_net_reader.h>
 
 namespace InferenceEngine {
 /**
@@ -24,7 +30,8 @@ public:
      * @brief A constructor
      * @param pp Vector of paths to plugin directories
      */
-    explicit PluginDispatcher(const std::vector<std::string> &pp) : pluginDirs(pp) {}
+    explicit PluginDispatcher(const std::vector<std::string> &pp)
+            : pluginDirs(pp), preloaded(std::make_shared<PreloadedPlugins>()) {}
 
     /**
     * @brief Loads a plugin from plugin directories
@@ -49,18 +56,42 @@ public:
     * @return A pointer to the plugin
     */
     InferencePlugin getPluginByDevice(const std::string& deviceName) const {
-        InferenceEnginePluginPtr ptr;
-        // looking for HETERO: if can find, add everything after ':' to the options of hetero plugin
-        if (deviceName.find("HETERO:") == 0) {
-            ptr = getSuitablePlugin(InferenceEngine::TargetDeviceInfo::fromStr("HETERO"));
-            if (ptr) {
-                InferenceEngine::ResponseDesc response;
-                ptr->SetConfig({ { "TARGET_FALLBACK", deviceName.substr(7, deviceName.length() - 7) } }, &response);
-            }
-        } else {
-            ptr = getSuitablePlugin(InferenceEngine::TargetDeviceInfo::fromStr(deviceName));
+        std::shared_future<InferencePlugin> plugin;
+        {
+            std::lock_guard<std::mutex> lock(preloaded->mutex);
+            auto found = preloaded->plugins.find(deviceName);
+            if (found != preloaded->plugins.end())
+                plugin = found->second;
         }
-        return InferencePlugin(ptr);
+        if (plugin.valid())
+            return plugin.get();
+        return loadPluginByDevice(deviceName);
+    }
+
+    /**
+    * @brief Starts loading the plugin suitable for the device in the background. Besides opening the plugin library,
+    * a tiny network is loaded to the plugin and inferred once, so the device context is created and the common
+    * kernels are compiled while the application reads its network. The next getPluginByDevice() calls of this
+    * dispatcher (and its copies) for the device return the preloaded plugin, waiting for it if needed.
+    * The warm-up is best effort, its failures are ignored, failing to open the plugin is reported by the handle.
+    * @param deviceName A device string as for getPluginByDevice()
+    * @return A handle to wait for the plugin on
+    */
+    std::shared_future<InferencePlugin> Preload(const std::string& deviceName) const {
+        std::lock_guard<std::mutex> lock(preloaded->mutex);
+        auto found = preloaded->plugins.find(deviceName);
+        if (found != preloaded->plugins.end())
+            return found->second;
+
+        // the task gets its own dispatcher, the preloaded plugins must not hold a reference to themselves
+        std::vector<std::string> dirs = pluginDirs;
+        auto plugin = std::async(std::launch::async, [dirs, deviceName]() {
+            InferencePlugin plugin = PluginDispatcher(dirs).loadPluginByDevice(deviceName);
+            warmUp(plugin);
+            return plugin;
+        }).share();
+        preloaded->plugins[deviceName] = plugin;
+        return plugin;
     }
 
     /**
@@ -87,6 +118,32 @@ public:
     }
 
 protected:
+    /**
+    * @brief Loads a plugin suitable for the device string from directories, bypassing the preloaded plugins
+    * @return A pointer to the plugin
+    */
+    InferencePlugin loadPluginByDevice(const std::string& deviceName) const {
+        InferenceEnginePluginPtr ptr;
+        // looking for HETERO: if can find, add everything after ':' to the options of hetero plugin
+        if (deviceName.find("HETERO:") == 0) {
+            ptr = getSuitablePlugin(InferenceEngine::TargetDeviceInfo::fromStr("HETERO"));
+            if (ptr) {
+                InferenceEngine::ResponseDesc response;
+                ptr->SetConfig({ { "TARGET_FALLBACK", deviceName.substr(7, deviceName.length() - 7) } }, &response);
+            }
+        } else if (deviceName.find("MULTI:") == 0) {
+            // the same for MULTI: the devices after ':' are the devices of the multi-device plugin
+            ptr = getSuitablePlugin(InferenceEngine::TargetDeviceInfo::fromStr("MULTI"));
+            if (ptr) {
+                InferenceEngine::ResponseDesc response;
+                ptr->SetConfig({ { "MULTI_DEVICE_PRIORITIES", deviceName.substr(6, deviceName.length() - 6) } }, &response);
+            }
+        } else {
+            ptr = getSuitablePlugin(InferenceEngine::TargetDeviceInfo::fromStr(deviceName));
+        }
+        return InferencePlugin(ptr);
+    }
+
     /**
     * @brief Creates path to the plugin
     * @param path Path to the plugin
@@ -111,7 +168,54 @@ protected:
 #endif
     }
 
+    /**
+    * @brief Loads a tiny convolution network to the plugin and infers it once
+    * @param plugin The plugin to warm up
+    */
+    static void warmUp(InferencePlugin &plugin) {
+        static const char model[] =
+            "<net name=\"WarmUp\" version=\"2\" precision=\"FP32\" batch=\"1\"><layers>"
+            "<layer name=\"in\" type=\"Input\" precision=\"FP32\" id=\"0\">"
+            "<output><port id=\"0\"><dim>1</dim><dim>3</dim><dim>16</dim><dim>16</dim></port></output></layer>"
+            "<layer name=\"conv\" type=\"Convolution\" precision=\"FP32\" id=\"1\">"
+            "<convolution stride-x=\"1\" stride-y=\"1\" pad-x=\"1\" pad-y=\"1\" kernel-x=\"3\" kernel-y=\"3\" "
+            "output=\"8\" group=\"1\"/><weights offset=\"0\" size=\"864\"/><biases offset=\"864\" size=\"32\"/>"
+            "<input><port id=\"1\"><dim>1</dim><dim>3</dim><dim>16</dim><dim>16</dim></port></input>"
+            "<output><port id=\"2\"><dim>1</dim><dim>8</dim><dim>16</dim><dim>16</dim></port></output></layer>"
+            "<layer name=\"relu\" type=\"ReLU\" precision=\"FP32\" id=\"2\">"
+            "<input><port id=\"3\"><dim>1</dim><dim>8</dim><dim>16</dim><dim>16</dim></port></input>"
+            "<output><port id=\"4\"><dim>1</dim><dim>8</dim><dim>16</dim><dim>16</dim></port></output></layer>"
+            "<layer name=\"pool\" type=\"Pooling\" precision=\"FP32\" id=\"3\">"
+            "<pooling kernel-x=\"2\" kernel-y=\"2\" stride-x=\"2\" stride-y=\"2\" pool-method=\"max\"/>"
+            "<input><port id=\"5\"><dim>1</dim><dim>8</dim><dim>16</dim><dim>16</dim></port></input>"
+            "<output><port id=\"6\"><dim>1</dim><dim>8</dim><dim>8</dim><dim>8</dim></port></output></layer>"
+            "</layers><edges>"
+            "<edge from-layer=\"0\" from-port=\"0\" to-layer=\"1\" to-port=\"1\"/>"
+            "<edge from-layer=\"1\" from-port=\"2\" to-layer=\"2\" to-port=\"3\"/>"
+            "<edge from-layer=\"2\" from-port=\"4\" to-layer=\"3\" to-port=\"5\"/>"
+            "</edges></net>";
+        try {
+            CNNNetReader reader;
+            reader.ReadNetwork(model, sizeof(model) - 1);
+            TBlob<uint8_t>::Ptr weights = std::make_shared<TBlob<uint8_t>>(Precision::U8, C, SizeVector{896});
+            weights->allocate();
+            uint8_t *data = weights->data();
+            std::fill(data, data + weights->size(), 0);
+            reader.SetWeights(weights);
+            InferRequest request = plugin.LoadNetwork(reader.getNetwork(), {}).CreateInferRequest();
+            request.Infer();
+        } catch (...) {
+            // the device may not support the layers or the precision, the plugin is still usable
+        }
+    }
+
 private:
+    struct PreloadedPlugins {
+        std::mutex mutex;
+        std::map<std::string, std::shared_future<InferencePlugin>> plugins;
+    };
+
     std::vector<std::string> pluginDirs;
+    std::shared_ptr<PreloadedPlugins> preloaded;
 };
 }  // namespace InferenceEngine
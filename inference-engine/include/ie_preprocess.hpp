@@ -51,6 +51,20 @@ enum ResizeAlgorithm {
     RESIZE_AREA
 };
 
+/**
+ * @enum ColorFormat
+ * @brief Represents the color format of the input image, which is converted during pre-processing to the BGR
+ * color order expected by the network.
+ */
+enum ColorFormat {
+    RAW = 0,    ///< the image is used as is, no color conversion
+    RGB,        ///< 3 channels, NCHW or NHWC U8 image
+    BGR,        ///< 3 channels, NCHW or NHWC U8 image
+    RGBX,       ///< 4 channels (the last one is ignored), NHWC U8 image
+    BGRX,       ///< 4 channels (the last one is ignored), NHWC U8 image
+    NV12,       ///< 1 channel U8 image of 3/2 of the image height: Y plane followed by the interleaved UV plane
+};
+
 /**
  * @brief This class stores pre-process information for the input
  */
@@ -62,6 +76,9 @@ class PreProcessInfo {
     // Resize Algorithm to be applied for input before inference if needed.
     ResizeAlgorithm _resizeAlg = NO_RESIZE;
 
+    // Color format of the input image to be converted before inference if needed.
+    ColorFormat _colorFormat = RAW;
+
 public:
     /**
      * @brief Overloaded [] operator to safely get the channel by an index. 
@@ -184,5 +201,30 @@ public:
     ResizeAlgorithm getResizeAlgorithm() const {
         return _resizeAlg;
     }
+
+    /**
+     * @brief Sets the color format of the input image, which is converted to the network input during
+     * pre-processing together with the resize and the layout conversion.
+     * @param fmt Color format of the input image.
+     */
+    void setColorFormat(const ColorFormat &fmt) {
+        _colorFormat = fmt;
+    }
+
+    /**
+     * @brief Gets the color format of the input image.
+     * @return Color format.
+     */
+    ColorFormat getColorFormat() const {
+        return _colorFormat;
+    }
+
+    /**
+     * @brief Checks whether the input blob is pre-processed (resized or color converted) before inference.
+     * @return true if pre-processing is required
+     */
+    bool isPreProcessingRequired() const {
+        return _resizeAlg != NO_RESIZE || _colorFormat != RAW;
+    }
 };
 }  // namespace InferenceEngine
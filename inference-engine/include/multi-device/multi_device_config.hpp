@@ -0,0 +1,46 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for Multi-Device plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods of plugins
+ *
+ * @file multi_device_config.hpp
+ */
+
+#pragma once
+
+#include <string>
+#include "../ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+namespace MultiDeviceConfigParams {
+
+#define MULTI_CONFIG_KEY(name) InferenceEngine::MultiDeviceConfigParams::_CONFIG_KEY(MULTI_##name)
+#define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
+#define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
+
+/**
+ * @brief The key for the devices executing the network, e.g. "CPU(4),GPU(8)".
+ * The whole network is loaded on every listed device and the infer requests of the network are executed by the
+ * device which has a free request and the best measured throughput. The number in the brackets is the number of the
+ * requests of the device running at the same time (2 by default). The devices are tried in the listed order until
+ * their throughput is measured. "MULTI:CPU,GPU" passed to PluginDispatcher sets the key to "CPU,GPU".
+ */
+DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
+
+/**
+ * @brief The key for splitting the batch of an infer request between the devices.
+ * The value is the number of the samples of a slice, the network is loaded on the devices with the batch of a slice
+ * and every slice of the request is executed by the device chosen as for a whole request, so the faster devices
+ * execute more slices. The slices are the views of the inputs and the outputs of the request, nothing is copied.
+ * The batch of the network must be a multiple of the value, all the inputs and the outputs must have the batch as
+ * their first dimension. 0 (default) disables the splitting.
+ */
+DECLARE_MULTI_CONFIG_KEY(BATCH_SLICE);
+
+}  // namespace MultiDeviceConfigParams
+}  // namespace InferenceEngine
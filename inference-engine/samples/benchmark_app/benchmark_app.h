@@ -0,0 +1,157 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message.";
+
+/// @brief message for model argument
+static const char model_message[] = "Required. Path to an .xml file with a trained model.";
+
+/// @brief message for plugin_path argument
+static const char plugin_path_message[] = "Path to a plugin folder.";
+
+/// @brief message for assigning cnn calculation to device
+static const char target_device_message[] = "Specify the target device to infer on; CPU, GPU, FPGA or MYRIAD is acceptable. " \
+                                            "Benchmark will look for a suitable plugin for device specified (CPU by default)";
+
+/// @brief message for the execution mode
+static const char api_message[] = "Execution mode: sync or async (default async)";
+
+/// @brief message for iterations count
+static const char iterations_count_message[] = "Number of iterations. If neither -niter nor -t is set, " \
+                                               "the benchmark runs for 60 seconds";
+
+/// @brief message for the execution time limit
+static const char execution_time_message[] = "Time limit of the execution in seconds. With -niter the benchmark stops " \
+                                             "on whichever limit comes first";
+
+/// @brief message for the infer requests number
+static const char ninfer_request_message[] = "Number of infer requests executed in parallel in async mode (default 2)";
+
+/// @brief message for the streams number
+static const char nstreams_message[] = "Number of streams of the CPU or GPU plugin (plugin default if not set). " \
+                                       "For CPU, NUMA and AUTO are accepted as well";
+
+/// @brief message for the batch size
+static const char batch_size_message[] = "Batch size of the network (the batch of the model if not set)";
+
+/// @brief message for performance counters
+static const char performance_counter_message[] = "Enables per-layer performance report with the achieved GFLOPS and " \
+                                                  "bandwidth of the layers";
+
+/// @brief message for the peak compute
+static const char peak_gflops_message[] = "Peak GFLOPS of the device, with -peak_gbs the per-layer report classifies " \
+                                          "the layers as compute-bound or memory-bound";
+
+/// @brief message for the peak bandwidth
+static const char peak_gbs_message[] = "Peak memory bandwidth of the device in GB/s";
+
+/// @brief message for the json report
+static const char report_message[] = "Path to the file the report is written to in JSON format";
+
+/// @brief message for clDNN custom kernels desc
+static const char custom_cldnn_message[] = "Required for clDNN (GPU)-targeted custom kernels."\
+                                            "Absolute path to the xml file with the kernels desc.";
+
+/// @brief message for user library argument
+static const char custom_cpu_library_message[] = "Required for MKLDNN (CPU)-targeted custom layers." \
+                                                 "Absolute path to a shared library with the kernels impl.";
+
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Define parameter for set model file <br>
+/// It is a required parameter
+DEFINE_string(m, "", model_message);
+
+/// @brief Define parameter for set path to plugins <br>
+DEFINE_string(pp, "", plugin_path_message);
+
+/// @brief device the target device to infer on <br>
+DEFINE_string(d, "CPU", target_device_message);
+
+/// @brief Execution mode, sync or async <br>
+DEFINE_string(api, "async", api_message);
+
+/// @brief Iterations count (0 if not limited)
+DEFINE_int32(niter, 0, iterations_count_message);
+
+/// @brief Execution time limit in seconds (0 if not limited)
+DEFINE_int32(t, 0, execution_time_message);
+
+/// @brief Number of infer requests
+DEFINE_int32(nireq, 2, ninfer_request_message);
+
+/// @brief Number of streams of the plugin
+DEFINE_string(nstreams, "", nstreams_message);
+
+/// @brief Batch size of the network (0 for the batch of the model)
+DEFINE_int32(b, 0, batch_size_message);
+
+/// @brief Enable per-layer performance report
+DEFINE_bool(pc, false, performance_counter_message);
+
+/// @brief Peak GFLOPS of the device (0 if unknown)
+DEFINE_double(peak_gflops, 0.0, peak_gflops_message);
+
+/// @brief Peak memory bandwidth of the device in GB/s (0 if unknown)
+DEFINE_double(peak_gbs, 0.0, peak_gbs_message);
+
+/// @brief Path to the JSON report
+DEFINE_string(report, "", report_message);
+
+/// @brief Define parameter for clDNN custom kernels path <br>
+/// Default is ./lib
+DEFINE_string(c, "", custom_cldnn_message);
+
+/// @brief Absolute path to CPU library with user layers <br>
+/// It is a optional parameter
+DEFINE_string(l, "", custom_cpu_library_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "benchmark_app [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                      " << help_message << std::endl;
+    std::cout << "    -m \"<path>\"             " << model_message << std::endl;
+    std::cout << "      -l \"<absolute_path>\"    " << custom_cpu_library_message << std::endl;
+    std::cout << "          Or" << std::endl;
+    std::cout << "      -c \"<absolute_path>\"    " << custom_cldnn_message << std::endl;
+    std::cout << "    -pp \"<path>\"            " << plugin_path_message << std::endl;
+    std::cout << "    -d \"<device>\"           " << target_device_message << std::endl;
+    std::cout << "    -api \"<sync/async>\"     " << api_message << std::endl;
+    std::cout << "    -niter \"<integer>\"      " << iterations_count_message << std::endl;
+    std::cout << "    -t \"<integer>\"          " << execution_time_message << std::endl;
+    std::cout << "    -nireq \"<integer>\"      " << ninfer_request_message << std::endl;
+    std::cout << "    -nstreams \"<value>\"     " << nstreams_message << std::endl;
+    std::cout << "    -b \"<integer>\"          " << batch_size_message << std::endl;
+    std::cout << "    -pc                     " << performance_counter_message << std::endl;
+    std::cout << "      -peak_gflops \"<value>\"  " << peak_gflops_message << std::endl;
+    std::cout << "      -peak_gbs \"<value>\"     " << peak_gbs_message << std::endl;
+    std::cout << "    -report \"<path>\"        " << report_message << std::endl;
+}
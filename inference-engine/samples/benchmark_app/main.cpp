@@ -0,0 +1,503 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+/**
+* @brief The entry point of the benchmark application
+* @file benchmark_app/main.cpp
+* @example benchmark_app/main.cpp
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include <ext_list.hpp>
+
+#include "benchmark_app.h"
+
+using namespace InferenceEngine;
+
+typedef std::chrono::high_resolution_clock Time;
+typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+/// @brief the default execution time in seconds if neither -niter nor -t is set
+static const int defaultExecutionTime = 60;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validation of input args--------------------------------------
+    slog::info << "Parsing input parameters" << slog::endl;
+
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::logic_error("Parameter -m is not set");
+    }
+
+    if (FLAGS_api != "sync" && FLAGS_api != "async") {
+        throw std::logic_error("Parameter -api must be sync or async");
+    }
+
+    if (FLAGS_niter < 0 || FLAGS_t < 0) {
+        throw std::logic_error("Parameters -niter and -t must not be negative");
+    }
+
+    if (FLAGS_nireq < 1) {
+        throw std::logic_error("Parameter -nireq must be more than 0 ! (default 2)");
+    }
+
+    if (FLAGS_b < 0) {
+        throw std::logic_error("Parameter -b must not be negative");
+    }
+
+    return true;
+}
+
+/**
+* @brief Fills the blob with the uniformly distributed random values, the same seed is used for every run
+*/
+template <typename T, typename Distribution>
+void fillRandom(Blob::Ptr &blob, Distribution distribution) {
+    static std::mt19937 generator(0);
+    T *data = blob->buffer().as<T *>();
+    for (size_t i = 0; i < blob->size(); i++) {
+        data[i] = static_cast<T>(distribution(generator));
+    }
+}
+
+/**
+* @brief Creates the synthetic input of the precision and the layout set in the input info
+*/
+Blob::Ptr createInput(const InputInfo::Ptr &info) {
+    const TensorDesc &desc = info->getTensorDesc();
+    Blob::Ptr blob;
+    switch (desc.getPrecision()) {
+    case Precision::FP32:
+        blob = make_shared_blob<float>(desc);
+        blob->allocate();
+        fillRandom<float>(blob, std::uniform_real_distribution<float>(0.f, 255.f));
+        break;
+    case Precision::U8:
+        blob = make_shared_blob<uint8_t>(desc);
+        blob->allocate();
+        fillRandom<uint8_t>(blob, std::uniform_int_distribution<int>(0, 255));
+        break;
+    case Precision::I16:
+        blob = make_shared_blob<int16_t>(desc);
+        blob->allocate();
+        fillRandom<int16_t>(blob, std::uniform_int_distribution<int>(0, 255));
+        break;
+    case Precision::U16:
+        blob = make_shared_blob<uint16_t>(desc);
+        blob->allocate();
+        fillRandom<uint16_t>(blob, std::uniform_int_distribution<int>(0, 255));
+        break;
+    case Precision::I32:
+        blob = make_shared_blob<int32_t>(desc);
+        blob->allocate();
+        fillRandom<int32_t>(blob, std::uniform_int_distribution<int>(0, 255));
+        break;
+    default:
+        throw std::logic_error("Unsupported input precision " + std::string(desc.getPrecision().name()));
+    }
+    return blob;
+}
+
+/**
+* @brief Returns the value of the sorted latencies below which the given percent of them lies (the nearest rank)
+*/
+double percentile(const std::vector<double> &sorted, double percent) {
+    if (sorted.empty())
+        return 0.0;
+    size_t rank = static_cast<size_t>(std::ceil(percent / 100.0 * sorted.size()));
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+/**
+* @brief Quotes the string for the JSON report
+*/
+std::string jsonString(const std::string &value) {
+    std::ostringstream quoted;
+    quoted << '"';
+    for (char c : value) {
+        switch (c) {
+        case '"':  quoted << "\\\""; break;
+        case '\\': quoted << "\\\\"; break;
+        case '\n': quoted << "\\n"; break;
+        case '\t': quoted << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                quoted << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                       << std::dec << std::setfill(' ');
+            else
+                quoted << c;
+        }
+    }
+    quoted << '"';
+    return quoted.str();
+}
+
+/**
+* @class InferRequestsQueue
+* @brief Keeps the infer requests of the async mode. The completed requests record their latency and return
+* to the queue of the idle ones, so the main thread starts the next iteration on any idle request.
+*/
+class InferRequestsQueue {
+public:
+    InferRequestsQueue(ExecutableNetwork &network, size_t count, const BlobMap &inputs) {
+        startTimes.resize(count);
+        for (size_t id = 0; id < count; id++) {
+            requests.push_back(network.CreateInferRequestPtr());
+            requests[id]->SetInput(inputs);
+            requests[id]->SetCompletionCallback([this, id]() { finished(id); });
+            idle.push(id);
+        }
+    }
+
+    /**
+    * @brief Waits for an idle request, the failures of the completed request are thrown here
+    */
+    size_t getIdle() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condVar.wait(lock, [this]() { return !idle.empty(); });
+        size_t id = idle.front();
+        idle.pop();
+        lock.unlock();
+        // the request is not busy after its callback returns, Wait also reports its status
+        StatusCode status = requests[id]->Wait(IInferRequest::WaitMode::RESULT_READY);
+        if (status != OK && status != INFER_NOT_STARTED)
+            throw std::logic_error("Inference failed with the status " + std::to_string(status));
+        return id;
+    }
+
+    void start(size_t id) {
+        startTimes[id] = Time::now();
+        requests[id]->StartAsync();
+    }
+
+    void waitAll() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condVar.wait(lock, [this]() { return idle.size() == requests.size(); });
+    }
+
+    InferRequest &get(size_t id) {
+        return *requests[id];
+    }
+
+    std::vector<double> latencies;
+
+private:
+    void finished(size_t id) {
+        double latency = std::chrono::duration_cast<ms>(Time::now() - startTimes[id]).count();
+        std::lock_guard<std::mutex> lock(mutex);
+        latencies.push_back(latency);
+        idle.push(id);
+        condVar.notify_one();
+    }
+
+    std::vector<InferRequest::Ptr> requests;
+    std::vector<Time::time_point> startTimes;
+    std::queue<size_t> idle;
+    std::mutex mutex;
+    std::condition_variable condVar;
+};
+
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        // ------------------------------ Parsing and validation of input args ---------------------------------
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+        bool async = FLAGS_api == "async";
+        size_t nireq = async ? FLAGS_nireq : 1;
+        int executionTime = FLAGS_t;
+        if (FLAGS_niter == 0 && FLAGS_t == 0) {
+            executionTime = defaultExecutionTime;
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 1. Load Plugin for inference engine -------------------------------------
+        slog::info << "Loading plugin" << slog::endl;
+        InferencePlugin plugin = PluginDispatcher({ FLAGS_pp, "../../../lib/intel64" , "" }).getPluginByDevice(FLAGS_d);
+
+        /** Loading default extensions **/
+        if (FLAGS_d.find("CPU") != std::string::npos) {
+            plugin.AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+        }
+
+        if (!FLAGS_l.empty()) {
+            // CPU(MKLDNN) extensions are loaded as a shared library and passed as a pointer to base extension
+            IExtensionPtr extension_ptr = make_so_pointer<IExtension>(FLAGS_l);
+            plugin.AddExtension(extension_ptr);
+            slog::info << "CPU Extension loaded: " << FLAGS_l << slog::endl;
+        }
+        if (!FLAGS_c.empty()) {
+            // clDNN Extensions are loaded from an .xml description and OpenCL kernel files
+            plugin.SetConfig({{PluginConfigParams::KEY_CONFIG_FILE, FLAGS_c}});
+            slog::info << "GPU Extension loaded: " << FLAGS_c << slog::endl;
+        }
+
+        /** Printing plugin version **/
+        printPluginVersion(plugin, std::cout);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 2. Read IR Generated by ModelOptimizer (.xml and .bin files) ------------
+        slog::info << "Loading network files" << slog::endl;
+
+        CNNNetReader networkReader;
+        networkReader.ReadNetwork(FLAGS_m);
+        networkReader.ReadWeights(fileNameNoExt(FLAGS_m) + ".bin");
+        CNNNetwork network = networkReader.getNetwork();
+
+        if (FLAGS_b != 0) {
+            network.setBatchSize(FLAGS_b);
+        }
+        size_t batchSize = network.getBatchSize();
+        slog::info << "Batch size is " << batchSize << slog::endl;
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 3. Prepare synthetic inputs ---------------------------------------------
+        slog::info << "Preparing synthetic input blobs" << slog::endl;
+
+        InputsDataMap inputInfo(network.getInputsInfo());
+        BlobMap inputs;
+        for (auto &item : inputInfo) {
+            Precision precision = item.second->getPrecision();
+            if (precision != Precision::FP32 && precision != Precision::U8 && precision != Precision::I16 &&
+                    precision != Precision::U16 && precision != Precision::I32) {
+                item.second->setPrecision(Precision::FP32);
+            }
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 4. Loading model to the plugin ------------------------------------------
+        slog::info << "Loading model to the plugin" << slog::endl;
+
+        std::map<std::string, std::string> config;
+        if (FLAGS_pc) {
+            config[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
+        }
+        if (!FLAGS_nstreams.empty()) {
+            if (FLAGS_d.find("CPU") != std::string::npos) {
+                config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] =
+                        FLAGS_nstreams == "NUMA" ? PluginConfigParams::CPU_THROUGHPUT_NUMA :
+                        FLAGS_nstreams == "AUTO" ? PluginConfigParams::CPU_THROUGHPUT_AUTO : FLAGS_nstreams;
+            } else if (FLAGS_d.find("GPU") != std::string::npos) {
+                config[PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS] = FLAGS_nstreams;
+            } else {
+                slog::warn << "-nstreams is ignored for the device " << FLAGS_d << slog::endl;
+            }
+        }
+
+        auto loadStart = Time::now();
+        ExecutableNetwork executableNetwork = plugin.LoadNetwork(network, config);
+        double loadTime = std::chrono::duration_cast<ms>(Time::now() - loadStart).count();
+        slog::info << "Load time: " << loadTime << " ms" << slog::endl;
+
+        /** The input info is final after the load, so the blobs are created now **/
+        for (auto &item : inputInfo) {
+            inputs[item.first] = createInput(item.second);
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 5. Do inference ---------------------------------------------------------
+        std::vector<double> latencies;
+        size_t iterations = 0;
+        double firstInferenceTime = 0.0;
+        double totalTime = 0.0;
+        std::map<std::string, InferenceEngineProfileInfo> performanceMap;
+
+        auto timeLimitReached = [&](const Time::time_point &start) {
+            return executionTime != 0 && Time::now() - start >= std::chrono::seconds(executionTime);
+        };
+        auto iterationsLimitReached = [&]() {
+            return FLAGS_niter != 0 && iterations >= static_cast<size_t>(FLAGS_niter);
+        };
+
+        slog::info << "Start inference " << (async ? "asynchronously" : "synchronously");
+        if (async) {
+            slog::info << ", " << nireq << " requests";
+        }
+        if (FLAGS_niter != 0) {
+            slog::info << ", limit: " << FLAGS_niter << " iterations";
+        }
+        if (executionTime != 0) {
+            slog::info << ", limit: " << executionTime << " seconds";
+        }
+        slog::info << slog::endl;
+
+        if (!async) {
+            InferRequest request = executableNetwork.CreateInferRequest();
+            request.SetInput(inputs);
+
+            /** The first inference allocates and initializes the memory, so it is not included **/
+            auto firstStart = Time::now();
+            request.Infer();
+            firstInferenceTime = std::chrono::duration_cast<ms>(Time::now() - firstStart).count();
+
+            auto start = Time::now();
+            while (!iterationsLimitReached() && !timeLimitReached(start)) {
+                auto iterationStart = Time::now();
+                request.Infer();
+                latencies.push_back(std::chrono::duration_cast<ms>(Time::now() - iterationStart).count());
+                iterations++;
+            }
+            totalTime = std::chrono::duration_cast<ms>(Time::now() - start).count();
+
+            if (FLAGS_pc) {
+                performanceMap = request.GetPerformanceCounts();
+            }
+        } else {
+            InferRequestsQueue queue(executableNetwork, nireq, inputs);
+
+            /** The first inference allocates and initializes the memory, so it is not included **/
+            size_t first = queue.getIdle();
+            auto firstStart = Time::now();
+            queue.start(first);
+            queue.waitAll();
+            firstInferenceTime = std::chrono::duration_cast<ms>(Time::now() - firstStart).count();
+            queue.latencies.clear();
+
+            auto start = Time::now();
+            while (!iterationsLimitReached() && !timeLimitReached(start)) {
+                queue.start(queue.getIdle());
+                iterations++;
+            }
+            queue.waitAll();
+            totalTime = std::chrono::duration_cast<ms>(Time::now() - start).count();
+            latencies = queue.latencies;
+
+            if (FLAGS_pc) {
+                performanceMap = queue.get(queue.getIdle()).GetPerformanceCounts();
+            }
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 6. Report the results ---------------------------------------------------
+        std::sort(latencies.begin(), latencies.end());
+        double throughput = totalTime > 0.0 ? 1000.0 * iterations * batchSize / totalTime : 0.0;
+        double average = 0.0;
+        for (double latency : latencies) {
+            average += latency;
+        }
+        average = latencies.empty() ? 0.0 : average / latencies.size();
+
+        if (FLAGS_pc) {
+            printPerformanceCounts(performanceMap, std::cout);
+            printRoofline(performanceMap, network, std::cout, FLAGS_peak_gflops, FLAGS_peak_gbs);
+        }
+
+        std::cout << std::endl;
+        std::cout << "Load time:            " << loadTime << " ms" << std::endl;
+        std::cout << "First inference:      " << firstInferenceTime << " ms" << std::endl;
+        std::cout << "Iterations:           " << iterations << std::endl;
+        std::cout << "Duration:             " << totalTime << " ms" << std::endl;
+        std::cout << "Latency (average):    " << average << " ms" << std::endl;
+        std::cout << "Latency (p50):        " << percentile(latencies, 50) << " ms" << std::endl;
+        std::cout << "Latency (p90):        " << percentile(latencies, 90) << " ms" << std::endl;
+        std::cout << "Latency (p99):        " << percentile(latencies, 99) << " ms" << std::endl;
+        std::cout << "Throughput:           " << throughput << " FPS" << std::endl;
+        std::cout << std::endl;
+
+        if (!FLAGS_report.empty()) {
+            std::ofstream report(FLAGS_report);
+            if (!report.is_open()) {
+                throw std::logic_error("Cannot open the report file " + FLAGS_report);
+            }
+            report << "{" << std::endl;
+            report << "  \"model\": " << jsonString(FLAGS_m) << "," << std::endl;
+            report << "  \"device\": " << jsonString(FLAGS_d) << "," << std::endl;
+            report << "  \"api\": " << jsonString(FLAGS_api) << "," << std::endl;
+            report << "  \"batch\": " << batchSize << "," << std::endl;
+            report << "  \"nireq\": " << nireq << "," << std::endl;
+            report << "  \"nstreams\": " << jsonString(FLAGS_nstreams) << "," << std::endl;
+            report << "  \"load_time_ms\": " << loadTime << "," << std::endl;
+            report << "  \"first_inference_ms\": " << firstInferenceTime << "," << std::endl;
+            report << "  \"iterations\": " << iterations << "," << std::endl;
+            report << "  \"duration_ms\": " << totalTime << "," << std::endl;
+            report << "  \"throughput_fps\": " << throughput << "," << std::endl;
+            report << "  \"latency_ms\": {\"avg\": " << average
+                   << ", \"min\": " << (latencies.empty() ? 0.0 : latencies.front())
+                   << ", \"max\": " << (latencies.empty() ? 0.0 : latencies.back())
+                   << ", \"p50\": " << percentile(latencies, 50)
+                   << ", \"p90\": " << percentile(latencies, 90)
+                   << ", \"p99\": " << percentile(latencies, 99) << "}," << std::endl;
+            report << "  \"layers\": [";
+            bool firstLayer = true;
+            for (const auto &layer : performanceMap) {
+                const InferenceEngineProfileInfo &info = layer.second;
+                std::string status = info.status == InferenceEngineProfileInfo::EXECUTED ? "EXECUTED" :
+                                     info.status == InferenceEngineProfileInfo::NOT_RUN ? "NOT_RUN" : "OPTIMIZED_OUT";
+                LayerCost cost;
+                try {
+                    cost = getLayerCost(network.getLayerByName(layer.first.c_str()));
+                } catch (const details::InferenceEngineException &) {
+                    // the layers added by the plugin are not in the network
+                }
+                report << (firstLayer ? "" : ",") << std::endl;
+                report << "    {\"name\": " << jsonString(layer.first)
+                       << ", \"type\": " << jsonString(info.layer_type)
+                       << ", \"exec_type\": " << jsonString(info.exec_type)
+                       << ", \"status\": " << jsonString(status)
+                       << ", \"real_time_us\": " << info.realTime_uSec
+                       << ", \"cpu_time_us\": " << info.cpu_uSec
+                       << ", \"runs\": " << info.num_runs
+                       << ", \"min_us\": " << info.minRealTime_uSec
+                       << ", \"p50_us\": " << info.p50RealTime_uSec
+                       << ", \"p99_us\": " << info.p99RealTime_uSec
+                       << ", \"max_us\": " << info.maxRealTime_uSec
+                       << ", \"flops\": " << cost.flops
+                       << ", \"bytes\": " << cost.bytes << "}";
+                firstLayer = false;
+            }
+            report << std::endl << "  ]" << std::endl;
+            report << "}" << std::endl;
+            slog::info << "The report is written to " << FLAGS_report << slog::endl;
+        }
+    }
+    catch (const std::exception& error) {
+        slog::err << error.what() << slog::endl;
+        return 1;
+    }
+    catch (...) {
+        slog::err << "Unknown/internal exception happened." << slog::endl;
+        return 1;
+    }
+
+    slog::info << "Execution successful" << slog::endl;
+    return 0;
+}
@@ -0,0 +1,327 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include <cnn_network_int8_normalizer.hpp>
+#include <cnn_network_stats_impl.hpp>
+#include <ie_util_internal.hpp>
+
+#include "calibrator.hpp"
+#include "console_progress.hpp"
+#include "image_decoder.hpp"
+#include "image_prefetcher.hpp"
+
+using namespace InferenceEngine;
+using InferenceEngine::details::InferenceEngineException;
+
+void LayerStatistics::extendHistogram(float value) {
+    // the range is doubled until the value fits, every doubling merges the pairs of the neighbouring bins
+    size_t factor = 1;
+    while (_histogramRange * factor < value) {
+        factor *= 2;
+    }
+    if (factor == 1) return;
+
+    std::vector<size_t> histogram(HISTOGRAM_BINS, 0);
+    for (size_t i = 0; i < HISTOGRAM_BINS; i++) {
+        histogram[i / factor] += _histogram[i];
+    }
+    _histogram.swap(histogram);
+    _histogramRange *= factor;
+}
+
+void LayerStatistics::addData(const float* data, size_t batch, size_t channels, size_t planeSize) {
+    if (_min.empty()) {
+        _min.assign(channels, std::numeric_limits<float>::max());
+        _max.assign(channels, std::numeric_limits<float>::lowest());
+        _histogram.assign(HISTOGRAM_BINS, 0);
+    }
+    if (_min.size() != channels)
+        THROW_IE_EXCEPTION << "The number of channels of the layer is changed";
+
+    float absMax = 0.0f;
+    for (size_t i = 0; i < batch * channels * planeSize; i++) {
+        absMax = std::max(absMax, std::fabs(data[i]));
+    }
+    if (_histogramRange == 0.0f) {
+        _histogramRange = absMax;
+    } else {
+        extendHistogram(absMax);
+    }
+
+    for (size_t n = 0; n < batch; n++) {
+        for (size_t c = 0; c < channels; c++) {
+            const float* plane = data + (n * channels + c) * planeSize;
+            for (size_t i = 0; i < planeSize; i++) {
+                _min[c] = std::min(_min[c], plane[i]);
+                _max[c] = std::max(_max[c], plane[i]);
+
+                size_t bin = _histogramRange > 0.0f ?
+                             static_cast<size_t>(std::fabs(plane[i]) / _histogramRange * HISTOGRAM_BINS) : 0;
+                _histogram[std::min(bin, HISTOGRAM_BINS - 1)]++;
+            }
+        }
+    }
+    _count += batch * channels * planeSize;
+}
+
+float LayerStatistics::getThreshold(float percentile) const {
+    size_t limit = static_cast<size_t>(std::ceil(_count * percentile / 100.0f));
+    size_t accumulated = 0;
+    for (size_t i = 0; i < _histogram.size(); i++) {
+        accumulated += _histogram[i];
+        if (accumulated >= limit) {
+            return _histogramRange * (i + 1) / HISTOGRAM_BINS;
+        }
+    }
+    return _histogramRange;
+}
+
+NetworkNodeStatsPtr LayerStatistics::toNodeStats(float percentile) const {
+    NetworkNodeStatsPtr nodeStats(new NetworkNodeStats());
+    float threshold = percentile < 100.0f ? getThreshold(percentile) : std::numeric_limits<float>::max();
+    for (size_t c = 0; c < _min.size(); c++) {
+        nodeStats->_minOutputs.push_back(std::max(_min[c], -threshold));
+        nodeStats->_maxOutputs.push_back(std::min(_max[c], threshold));
+    }
+    return nodeStats;
+}
+
+Int8Calibrator::Int8Calibrator(const std::string& modelPath, InferencePlugin plugin, int batch, size_t nireq,
+                               size_t decodeThreads, PreprocessingOptions preprocessingOptions, bool zeroBackground)
+    : _modelPath(modelPath), _plugin(plugin), _batch(batch), _nireq(std::max<size_t>(nireq, 1)),
+      _decodeThreads(decodeThreads), _preprocessingOptions(preprocessingOptions), _zeroBackground(zeroBackground) {
+}
+
+CNNNetwork Int8Calibrator::readNetwork() {
+    CNNNetReader networkReader;
+    networkReader.ReadNetwork(_modelPath);
+    if (!networkReader.isParseSuccess()) THROW_IE_EXCEPTION << "cannot load a failed Model";
+    networkReader.ReadWeights(fileNameNoExt(_modelPath) + ".bin");
+
+    CNNNetwork network = networkReader.getNetwork();
+    if (_batch == 0) {
+        _batch = network.getBatchSize();
+    } else {
+        network.setBatchSize(_batch);
+    }
+    if (network.getInputsInfo().size() != 1) {
+        THROW_IE_EXCEPTION << "This tool accepts networks having only one input";
+    }
+    // the statistics of the input are gathered from the blob filled by the decoder
+    network.getInputsInfo().begin()->second->setPrecision(Precision::FP32);
+    for (auto& output : network.getOutputsInfo()) {
+        output.second->setPrecision(Precision::FP32);
+    }
+    return network;
+}
+
+CNNNetwork Int8Calibrator::readNetwork(const std::map<std::string, NetworkNodeStatsPtr>& stats,
+                                       const std::set<std::string>& fp32Layers) {
+    CNNNetwork network = readNetwork();
+    if (stats.empty()) return network;
+
+    for (const auto& layerName : fp32Layers) {
+        network.getLayerByName(layerName.c_str())->params["quantization_level"] = "FP32";
+    }
+
+    details::CNNNetworkStatsImpl networkStats(stats);
+    details::CNNNetworkInt8Normalizer normalizer;
+    normalizer.NormalizeNetwork(network, networkStats);
+    return network;
+}
+
+void Int8Calibrator::processImages(CNNNetwork& network, const ImagesList& images, const ResultCallback& onResult) {
+    ExecutableNetwork executableNetwork = _plugin.LoadNetwork(network, {});
+    std::string inputName = network.getInputsInfo().begin()->first;
+
+    std::vector<InferRequest> requests;
+    std::vector<std::vector<int>> labels(_nireq);
+    std::vector<bool> started(_nireq, false);
+    for (size_t i = 0; i < _nireq; i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+    }
+
+    // the images are decoded on a pool of threads, a batch ahead for every request
+    std::vector<std::string> names;
+    for (const auto& image : images) {
+        names.push_back(image.second);
+    }
+    ImagePrefetcher prefetcher(names, network.getInputsInfo().begin()->second->getDims(), _preprocessingOptions,
+                               _decodeThreads, _nireq * _batch * 2);
+
+    ImageDecoder decoder;
+    ConsoleProgress progress(images.size());
+
+    bool more = true;
+    size_t active = 0;
+    for (size_t current = 0; more || active > 0; current = (current + 1) % _nireq) {
+        // the requests are completed in the order they are started, so every request has a batch in flight
+        // while the results of the oldest one are processed
+        if (started[current]) {
+            requests[current].Wait(IInferRequest::WaitMode::RESULT_READY);
+            onResult(requests[current], labels[current]);
+            progress.addProgress(static_cast<int>(labels[current].size()));
+            started[current] = false;
+            active--;
+        }
+
+        if (!more) continue;
+
+        labels[current].clear();
+        auto inputBlob = requests[current].GetBlob(inputName);
+        ImagePrefetcher::Image image;
+        while (labels[current].size() < static_cast<size_t>(_batch) && (more = prefetcher.next(image))) {
+            if (!image.valid) {
+                slog::warn << "Can't read file " << image.name << slog::endl;
+                continue;
+            }
+            decoder.insertIntoBlob(image.data, static_cast<int>(labels[current].size()), *inputBlob,
+                                   _preprocessingOptions);
+            labels[current].push_back(images[image.index].first);
+        }
+
+        if (!labels[current].empty()) {
+            requests[current].StartAsync();
+            started[current] = true;
+            active++;
+        }
+    }
+    progress.finish();
+}
+
+std::map<std::string, NetworkNodeStatsPtr> Int8Calibrator::collectStatistics(const ImagesList& images, float percentile) {
+    CNNNetwork network = readNetwork();
+
+    // every layer is made an output of the network, so the requests return all the activations
+    OutputsDataMap outputs = network.getOutputsInfo();
+    std::map<std::string, std::string> outputsOfLayers;
+    for (const auto& layer : network) {
+        if (layer->type == "Input" || layer->outData.empty())
+            continue;
+        // the normalizer looks up the statistics by the name of the layer, so only the first output is used
+        outputsOfLayers[layer->outData[0]->name] = layer->name;
+        if (outputs.find(layer->outData[0]->name) == outputs.end()) {
+            network.addOutput(layer->name, 0);
+        }
+    }
+    InputsDataMap inputs = network.getInputsInfo();
+    outputsOfLayers[inputs.begin()->first] = inputs.begin()->second->getInputData()->getCreatorLayer().lock()->name;
+
+    for (auto& output : network.getOutputsInfo()) {
+        output.second->setPrecision(Precision::FP32);
+    }
+
+    std::map<std::string, LayerStatistics> layersStats;
+
+    slog::info << "Collecting statistics" << slog::endl;
+    processImages(network, images, [&](InferRequest& request, const std::vector<int>& labels) {
+        for (const auto& output : outputsOfLayers) {
+            Blob::Ptr blob = request.GetBlob(output.first);
+            const SizeVector& dims = blob->getTensorDesc().getDims();
+            if (dims.size() < 2) continue;
+
+            size_t planeSize = 1;
+            for (size_t i = 2; i < dims.size(); i++) {
+                planeSize *= dims[i];
+            }
+            layersStats[output.second].addData(blob->cbuffer().as<const float*>(), labels.size(), dims[1], planeSize);
+        }
+    });
+
+    std::map<std::string, NetworkNodeStatsPtr> stats;
+    for (const auto& layerStats : layersStats) {
+        stats[layerStats.first] = layerStats.second.toNodeStats(percentile);
+    }
+    return stats;
+}
+
+float Int8Calibrator::getAccuracy(const ImagesList& images, const std::map<std::string, NetworkNodeStatsPtr>& stats,
+                                  const std::set<std::string>& fp32Layers) {
+    CNNNetwork network = readNetwork(stats, fp32Layers);
+    std::string outputName = network.getOutputsInfo().begin()->first;
+
+    size_t total = 0;
+    size_t top1 = 0;
+    processImages(network, images, [&](InferRequest& request, const std::vector<int>& labels) {
+        Blob::Ptr output = request.GetBlob(outputName);
+        std::vector<unsigned> results;
+        TopResults(1, *output, results);
+        for (size_t i = 0; i < labels.size(); i++) {
+            int expected = labels[i] + (_zeroBackground ? 1 : 0);
+            if (results[i] == static_cast<unsigned>(expected)) top1++;
+            total++;
+        }
+    });
+    return total > 0 ? 100.0f * top1 / total : 0.0f;
+}
+
+std::set<std::string> Int8Calibrator::searchFP32Layers(const ImagesList& images,
+                                                       const std::map<std::string, NetworkNodeStatsPtr>& stats,
+                                                       float maxDrop) {
+    float fp32Accuracy = getAccuracy(images, {}, {});
+    slog::info << "FP32 accuracy: " << fp32Accuracy << "%" << slog::endl;
+
+    std::set<std::string> fp32Layers;
+    float accuracy = getAccuracy(images, stats, fp32Layers);
+    slog::info << "INT8 accuracy: " << accuracy << "%" << slog::endl;
+    if (fp32Accuracy - accuracy <= maxDrop) return fp32Layers;
+
+    // the sensitivity of a convolution is the accuracy of the network with all the other convolutions in int8
+    std::vector<std::pair<float, std::string>> sensitivity;
+    for (const auto& layer : readNetwork()) {
+        if (layer->type != "Convolution" || stats.find(layer->name) == stats.end())
+            continue;
+        float layerAccuracy = getAccuracy(images, stats, {layer->name});
+        slog::info << "Accuracy with " << layer->name << " in FP32: " << layerAccuracy << "%" << slog::endl;
+        sensitivity.emplace_back(layerAccuracy, layer->name);
+    }
+    std::sort(sensitivity.begin(), sensitivity.end(), std::greater<std::pair<float, std::string>>());
+
+    for (const auto& layer : sensitivity) {
+        fp32Layers.insert(layer.second);
+        accuracy = getAccuracy(images, stats, fp32Layers);
+        slog::info << fp32Layers.size() << " layers in FP32, accuracy: " << accuracy << "%" << slog::endl;
+        if (fp32Accuracy - accuracy <= maxDrop) break;
+    }
+    if (fp32Accuracy - accuracy > maxDrop) {
+        slog::warn << "The accuracy target is not reached even with all the convolutions in FP32" << slog::endl;
+    }
+    return fp32Layers;
+}
+
+void Int8Calibrator::saveNetwork(const std::string& xmlPath, const std::string& binPath,
+                                 const std::map<std::string, NetworkNodeStatsPtr>& stats,
+                                 const std::set<std::string>& fp32Layers) {
+    CNNNetwork network = readNetwork(stats, fp32Layers);
+    std::ofstream xml(xmlPath);
+    std::ofstream bin(binPath, std::ofstream::binary);
+    if (!xml || !bin)
+        THROW_IE_EXCEPTION << "Cannot open " << xmlPath << " or " << binPath << " for writing";
+    saveNetworkToIR(network, xml, bin);
+}
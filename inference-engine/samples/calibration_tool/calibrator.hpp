@@ -0,0 +1,132 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <ie_icnn_network_stats.hpp>
+
+#include "PreprocessingOptions.hpp"
+
+/**
+ * @class LayerStatistics
+ * @brief Per channel minimum and maximum of the output of a layer together with the histogram of
+ *        the absolute values of the output
+ */
+class LayerStatistics {
+    static const size_t HISTOGRAM_BINS = 2048;
+
+    std::vector<float> _min;
+    std::vector<float> _max;
+    std::vector<size_t> _histogram;
+    float _histogramRange = 0.0f;
+    size_t _count = 0;
+
+    void extendHistogram(float value);
+
+public:
+    /**
+     * @brief Accumulates the statistics of the planar data
+     * @param data - the data of @p batch images, each of @p channels planes of @p planeSize values
+     */
+    void addData(const float* data, size_t batch, size_t channels, size_t planeSize);
+
+    /**
+     * @brief Returns the absolute value not exceeded by the given part of the collected values
+     * @param percentile - the part of the values in percents
+     */
+    float getThreshold(float percentile) const;
+
+    /**
+     * @brief Converts the statistics to the form used by the int8 normalizer, the outliers above
+     *        the @p percentile threshold are clipped
+     */
+    InferenceEngine::NetworkNodeStatsPtr toNodeStats(float percentile) const;
+};
+
+/**
+ * @class Int8Calibrator
+ * @brief Collects the statistics of the activations of a network over a calibration set and searches
+ *        for the convolutions which have to stay in fp32 to hold the accuracy of the int8 network
+ */
+class Int8Calibrator {
+public:
+    typedef std::vector<std::pair<int, std::string>> ImagesList;
+
+    /**
+     * @param nireq - number of infer requests running at once
+     * @param decodeThreads - number of threads decoding the images, 0 takes all the cores
+     */
+    Int8Calibrator(const std::string& modelPath, InferenceEngine::InferencePlugin plugin, int batch, size_t nireq,
+                   size_t decodeThreads, PreprocessingOptions preprocessingOptions, bool zeroBackground);
+
+    /**
+     * @brief Infers the images with all the layers of the network marked as outputs and gathers their statistics
+     * @return the statistics of the layers in the form used by the int8 normalizer
+     */
+    std::map<std::string, InferenceEngine::NetworkNodeStatsPtr> collectStatistics(const ImagesList& images, float percentile);
+
+    /**
+     * @brief Measures the top-1 accuracy of the network
+     * @param stats - statistics to convert the network to int8, the network is inferred in fp32 if it is empty
+     * @param fp32Layers - convolutions kept in fp32
+     */
+    float getAccuracy(const ImagesList& images, const std::map<std::string, InferenceEngine::NetworkNodeStatsPtr>& stats,
+                      const std::set<std::string>& fp32Layers);
+
+    /**
+     * @brief Returns the convolutions which have to stay in fp32 to keep the accuracy drop within @p maxDrop.
+     *        The convolutions are returned to fp32 one by one, the most sensitive to int8 go first.
+     */
+    std::set<std::string> searchFP32Layers(const ImagesList& images,
+                                           const std::map<std::string, InferenceEngine::NetworkNodeStatsPtr>& stats,
+                                           float maxDrop);
+
+    /**
+     * @brief Converts the network to int8 and saves it to the IR
+     */
+    void saveNetwork(const std::string& xmlPath, const std::string& binPath,
+                     const std::map<std::string, InferenceEngine::NetworkNodeStatsPtr>& stats,
+                     const std::set<std::string>& fp32Layers);
+
+private:
+    typedef std::function<void(InferenceEngine::InferRequest& request, const std::vector<int>& labels)> ResultCallback;
+
+    InferenceEngine::CNNNetwork readNetwork();
+    InferenceEngine::CNNNetwork readNetwork(const std::map<std::string, InferenceEngine::NetworkNodeStatsPtr>& stats,
+                                            const std::set<std::string>& fp32Layers);
+
+    /**
+     * @brief Infers the images with several requests at once, the result of every request is passed to the callback
+     */
+    void processImages(InferenceEngine::CNNNetwork& network, const ImagesList& images, const ResultCallback& onResult);
+
+    std::string _modelPath;
+    InferenceEngine::InferencePlugin _plugin;
+    int _batch;
+    size_t _nireq;
+    size_t _decodeThreads;
+    PreprocessingOptions _preprocessingOptions;
+    bool _zeroBackground;
+};
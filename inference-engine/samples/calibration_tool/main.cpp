@@ -0,0 +1,260 @@
+/*
+ // Copyright (c) 2018 Intel Corporation
+ //
+ // Licensed under the Apache License, Version 2.0 (the "License");
+ // you may not use this file except in compliance with the License.
+ // You may obtain a copy of the License at
+ //
+ //      http://www.apache.org/licenses/LICENSE-2.0
+ //
+ // Unless required by applicable law or agreed to in writing, software
+ // distributed under the License is distributed on an "AS IS" BASIS,
+ // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ // See the License for the specific language governing permissions and
+ // limitations under the License.
+ */
+
+/**
+ * @brief The entry point for Inference Engine calibration tool
+ * @file calibration_tool/main.cpp
+ */
+#include <gflags/gflags.h>
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <ext_list.hpp>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include <cnn_network_stats_impl.hpp>
+
+#include "user_exception.hpp"
+#include "classification_set_generator.hpp"
+#include "calibrator.hpp"
+
+using namespace std;
+using namespace InferenceEngine;
+
+using InferenceEngine::details::InferenceEngineException;
+
+#define DEFAULT_PATH_P "./lib"
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message";
+/// @brief message for images argument
+static const char image_message[] = "Required. Folder with calibration images, folders grouped by labels or a .txt file list";
+/// @brief message for plugin_path argument
+static const char plugin_path_message[] = "Path to a plugin folder";
+/// @brief message for model argument
+static const char model_message[] = "Required. Path to an .xml file with a trained model";
+/// @brief message for assigning cnn calculation to device
+static const char target_device_message[] = "Specify the target device to infer on; CPU by default";
+/// @brief message for batch argument
+static const char batch_message[] = "Batch size value. If not specified, the batch size value is determined from IR";
+/// @brief message for the number of infer requests
+static const char infer_requests_message[] = "Number of infer requests running at once (4 by default)";
+/// @brief message for the decoding threads argument
+static const char pp_threads_message[] = "Number of threads decoding and preprocessing the images. If not specified, all the cores are used";
+/// @brief message for the subset argument
+static const char subset_message[] = "Number of images from the set used for the calibration, 0 means all of them";
+/// @brief message for the type of the network
+static const char type_message[] = "Type of the network being calibrated (\"C\" by default)";
+/// @brief message for the accuracy threshold
+static const char threshold_message[] = "Maximal allowed drop of the top-1 accuracy in percents (1 by default)";
+/// @brief message for the percentile of the statistics
+static const char percentile_message[] = "Percentile of the absolute values of an activation kept by the int8 range, "
+                                         "the larger values are clipped (100 by default, i.e. no clipping)";
+/// @brief message for the output argument
+static const char output_message[] = "Path to the calibrated model without extension, <model>_i8 by default";
+/// @brief message for pp-type
+static const char preprocessing_type[] = "Preprocessing type. One of \"None\", \"Resize\", \"ResizeCrop\"";
+/// @brief message for pp-crop-size
+static const char preprocessing_size[] = "Preprocessing size (used with ppType=\"ResizeCrop\")";
+
+static const char zero_background_message[] = "\"Zero is a background\" flag. Some networks are trained with a modified dataset where the class IDs "
+                                              "are enumerated from 1, but 0 is an undefined \"background\" class (which is never detected)";
+
+/// @brief message for user library argument
+static const char custom_cpu_library_message[] = "Required for MKLDNN (CPU)-targeted custom layers."
+                                                 "Absolute path to a shared library with the kernel implementations";
+
+/// @brief Network type options and their descriptions
+static const char* types_descriptions[][2] = {
+    { "C", "classification, the convolutions are kept in fp32 until the accuracy target is reached" },
+    { "S", "statistics only, all the convolutions are converted to int8" },
+    { nullptr, nullptr }
+};
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(i, "", image_message);
+DEFINE_string(m, "", model_message);
+DEFINE_string(pp, DEFAULT_PATH_P, plugin_path_message);
+DEFINE_string(d, "CPU", target_device_message);
+DEFINE_int32(b, 0, batch_message);
+DEFINE_int32(nireq, 4, infer_requests_message);
+DEFINE_int32(ppThreads, 0, pp_threads_message);
+DEFINE_int32(subset, 0, subset_message);
+DEFINE_string(t, "C", type_message);
+DEFINE_double(threshold, 1.0, threshold_message);
+DEFINE_double(percentile, 100.0, percentile_message);
+DEFINE_string(o, "", output_message);
+DEFINE_string(ppType, "", preprocessing_type);
+DEFINE_int32(ppSize, 0, preprocessing_size);
+DEFINE_bool(Czb, false, zero_background_message);
+DEFINE_string(l, "", custom_cpu_library_message);
+
+/**
+ * @brief This function show a help message
+ */
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "Usage: calibration_tool [OPTION]" << std::endl << std::endl;
+    std::cout << "Available options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                        " << help_message << std::endl;
+    std::cout << "    -t <type>                 " << type_message << std::endl;
+    for (int i = 0; types_descriptions[i][0] != nullptr; i++) {
+        std::cout << "      -t \"" << types_descriptions[i][0] << "\" for " << types_descriptions[i][1] << std::endl;
+    }
+    std::cout << "    -i <path>                 " << image_message << std::endl;
+    std::cout << "    -m <path>                 " << model_message << std::endl;
+    std::cout << "    -o <path>                 " << output_message << std::endl;
+    std::cout << "    -l <absolute_path>        " << custom_cpu_library_message << std::endl;
+    std::cout << "    -d <device>               " << target_device_message << std::endl;
+    std::cout << "    -b N                      " << batch_message << std::endl;
+    std::cout << "    -nireq N                  " << infer_requests_message << std::endl;
+    std::cout << "    -subset N                 " << subset_message << std::endl;
+    std::cout << "    -threshold <value>        " << threshold_message << std::endl;
+    std::cout << "    -percentile <value>       " << percentile_message << std::endl;
+    std::cout << "    -ppType <type>            " << preprocessing_type << std::endl;
+    std::cout << "    -ppSize N                 " << preprocessing_size << std::endl;
+    std::cout << "    -ppThreads N              " << pp_threads_message << std::endl;
+    std::cout << "    -Czb true                 " << zero_background_message << std::endl;
+}
+
+std::string strtolower(const std::string& s) {
+    std::string res = s;
+    std::transform(res.begin(), res.end(), res.begin(), ::tolower);
+    return res;
+}
+
+/**
+ * @brief The main function of the calibration tool
+ * @param argc - The number of arguments
+ * @param argv - Arguments
+ * @return 0 if all good
+ */
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        // ---------------------------Parsing and validation of input args--------------------------------------
+        slog::info << "Parsing input parameters" << slog::endl;
+
+        bool noOptions = argc == 1;
+
+        gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+        if (FLAGS_h || noOptions) {
+            showUsage();
+            return 1;
+        }
+
+        UserExceptions ee;
+
+        if (FLAGS_t != "C" && FLAGS_t != "S") ee << UserException(5, "Unknown network type specified (invalid -t option)");
+        if (FLAGS_m.empty()) ee << UserException(3, "Model file not specified (missing -m option)");
+        if (FLAGS_i.empty()) ee << UserException(4, "Images list not specified (missing -i option)");
+        if (FLAGS_d.empty()) ee << UserException(5, "Target device not specified (missing -d option)");
+        if (FLAGS_b < 0) ee << UserException(6, "Batch should be positive (invalid -b option value)");
+        if (FLAGS_nireq <= 0) ee << UserException(7, "Number of infer requests should be positive (invalid -nireq option value)");
+        if (FLAGS_ppThreads < 0) ee << UserException(10, "Number of decoding threads should not be negative (invalid -ppThreads option value)");
+        if (FLAGS_subset < 0) ee << UserException(8, "Subset size should be positive (invalid -subset option value)");
+        if (FLAGS_percentile <= 0 || FLAGS_percentile > 100)
+            ee << UserException(9, "Percentile should be in (0, 100] (invalid -percentile option value)");
+
+        if (!ee.empty()) throw ee;
+        // -----------------------------------------------------------------------------------------------------
+
+        // ---------------------Load plugin for inference engine------------------------------------------------
+        slog::info << "Loading plugin" << slog::endl;
+        InferencePlugin plugin = PluginDispatcher({ FLAGS_pp, "../../../lib/intel64", "" }).getPluginByDevice(FLAGS_d);
+
+        if (FLAGS_d.find("CPU") != std::string::npos) {
+            plugin.AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+        }
+        if (!FLAGS_l.empty()) {
+            IExtensionPtr extension_ptr = make_so_pointer<IExtension>(FLAGS_l);
+            plugin.AddExtension(extension_ptr);
+            slog::info << "CPU Extension loaded: " << FLAGS_l << slog::endl;
+        }
+
+        printPluginVersion(plugin, std::cout);
+
+        PreprocessingOptions preprocessingOptions;
+        if (strtolower(FLAGS_ppType) == "none") {
+            preprocessingOptions = PreprocessingOptions(false, ResizeCropPolicy::DoNothing);
+        } else if (strtolower(FLAGS_ppType) == "resizecrop") {
+            if (FLAGS_ppSize <= 0) {
+                THROW_USER_EXCEPTION(2) << "Size should be specified for preprocessing type " << FLAGS_ppType;
+            }
+            preprocessingOptions = PreprocessingOptions(false, ResizeCropPolicy::ResizeThenCrop, FLAGS_ppSize, FLAGS_ppSize);
+        } else if (strtolower(FLAGS_ppType) == "resize" || FLAGS_ppType.empty()) {
+            preprocessingOptions = PreprocessingOptions(false, ResizeCropPolicy::Resize);
+        } else {
+            THROW_USER_EXCEPTION(2) << "Unknown preprocessing type: " << FLAGS_ppType;
+        }
+
+        // ----------------------------Prepare the calibration set-----------------------------------------------
+        slog::info << "Collecting images" << slog::endl;
+        ClassificationSetGenerator generator;
+        auto validationMap = generator.getValidationMap(FLAGS_i);
+        Int8Calibrator::ImagesList images(validationMap.begin(), validationMap.end());
+        // the images are grouped by the labels, so the subset is taken from a shuffled list to cover all of them
+        std::shuffle(images.begin(), images.end(), std::mt19937(0));
+        if (FLAGS_subset > 0 && static_cast<size_t>(FLAGS_subset) < images.size()) {
+            images.resize(FLAGS_subset);
+        }
+        if (images.empty()) {
+            THROW_USER_EXCEPTION(4) << "No images found in " << FLAGS_i;
+        }
+
+        // ----------------------------Calibrate the network-----------------------------------------------------
+        Int8Calibrator calibrator(FLAGS_m, plugin, FLAGS_b, FLAGS_nireq, FLAGS_ppThreads, preprocessingOptions, FLAGS_Czb);
+
+        auto stats = calibrator.collectStatistics(images, static_cast<float>(FLAGS_percentile));
+
+        std::set<std::string> fp32Layers;
+        if (FLAGS_t == "C") {
+            fp32Layers = calibrator.searchFP32Layers(images, stats, static_cast<float>(FLAGS_threshold));
+        }
+        for (const auto& layer : fp32Layers) {
+            slog::info << "Layer " << layer << " is kept in FP32" << slog::endl;
+        }
+
+        std::string outputName = FLAGS_o.empty() ? fileNameNoExt(FLAGS_m) + "_i8" : FLAGS_o;
+        calibrator.saveNetwork(outputName + ".xml", outputName + ".bin", stats, fp32Layers);
+        details::CNNNetworkStatsImpl(stats).SaveToFile(outputName + "_stats.xml", outputName + "_stats.bin");
+
+        slog::info << "Calibrated model: " << outputName << ".xml" << slog::endl;
+        slog::info << "Statistics: " << outputName << "_stats.xml" << slog::endl;
+    } catch (const InferenceEngineException& ex) {
+        slog::err << "Inference problem: \n" << ex.what() << slog::endl;
+        return 1;
+    } catch (const UserException& ex) {
+        slog::err << "Input problem: \n" << ex.what() << slog::endl;
+        showUsage();
+        return ex.exitCode();
+    } catch (const UserExceptions& ex) {
+        slog::err << "Input problems: \n" << ex.what() << slog::endl;
+        showUsage();
+        return ex.list().begin()->exitCode();
+    }
+    return 0;
+}
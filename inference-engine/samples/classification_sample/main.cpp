@@ -19,6 +19,7 @@
 #include <chrono>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include <inference_engine.hpp>
 #include <ext_list.hpp>
@@ -143,25 +144,20 @@ int main(int argc, char *argv[]) {
         inputInfoItem.second->setPrecision(Precision::U8);
         inputInfoItem.second->setLayout(Layout::NCHW);
 
-        std::vector<std::shared_ptr<unsigned char>> imagesData;
+        /** The images are decoded now and written into the input blob once it is allocated **/
+        std::vector<FormatReader::ReaderPtr> images;
         for (auto & i : imageNames) {
             FormatReader::ReaderPtr reader(i.c_str());
             if (reader.get() == nullptr) {
                 slog::warn << "Image " + i + " cannot be read!" << slog::endl;
                 continue;
             }
-            /** Store image data **/
-            std::shared_ptr<unsigned char> data(
-                    reader->getData(inputInfoItem.second->getTensorDesc().getDims()[3],
-                                    inputInfoItem.second->getTensorDesc().getDims()[2]));
-            if (data.get() != nullptr) {
-                imagesData.push_back(data);
-            }
+            images.push_back(std::move(reader));
         }
-        if (imagesData.empty()) throw std::logic_error("Valid input images were not found!");
+        if (images.empty()) throw std::logic_error("Valid input images were not found!");
 
         /** Setting batch size using image count **/
-        network.setBatchSize(imagesData.size());
+        network.setBatchSize(images.size());
         size_t batchSize = network.getBatchSize();
         slog::info << "Batch size is " << std::to_string(batchSize) << slog::endl;
 
@@ -225,15 +221,12 @@ int main(int argc, char *argv[]) {
 
             auto data = input->buffer().as<PrecisionTrait<Precision::U8>::value_type*>();
 
-            /** Iterate over all input images **/
-            for (size_t image_id = 0; image_id < imagesData.size(); ++image_id) {
-                /** Iterate over all pixel in image (b,g,r) **/
-                for (size_t pid = 0; pid < image_size; pid++) {
-                    /** Iterate over all channels **/
-                    for (size_t ch = 0; ch < num_channels; ++ch) {
-                        /**          [images stride + channels stride + pixel id ] all in bytes            **/
-                        data[image_id * image_size * num_channels + ch * image_size + pid ] = imagesData.at(image_id).get()[pid*num_channels + ch];
-                    }
+            /** Iterate over all input images, every one is resized into its batch item in one pass **/
+            for (size_t image_id = 0; image_id < images.size(); ++image_id) {
+                if (!images[image_id]->readInto(data + image_id * image_size * num_channels,
+                                                input->getTensorDesc().getDims()[3],
+                                                input->getTensorDesc().getDims()[2], num_channels)) {
+                    throw std::logic_error("Image " + std::to_string(image_id) + " cannot be written to the input");
                 }
             }
         }
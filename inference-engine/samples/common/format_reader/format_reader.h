@@ -61,7 +61,78 @@ public:
      */
     virtual size_t size() const = 0;
 
+    /**
+     * \brief Writes the image resized to width x height into the planar (CHW) buffer of the caller, e.g. its batch
+     * item in the input blob. The resize and the conversion from the interleaved pixels are done in one pass, nothing
+     * is allocated per image.
+     * @param dst - the first element of the first plane
+     * @param width - width of the planes
+     * @param height - height of the planes
+     * @param channels - number of the planes, a one-channel image is replicated into all of them
+     * @param planeStride - distance of the planes in elements, 0 for the dense planes of width * height
+     * @return false if the image cannot be written with this number of the channels
+     * @Without OpenCV the image is resized by the nearest pixels
+     */
+    bool readInto(unsigned char *dst, size_t width, size_t height, size_t channels, size_t planeStride = 0) {
+        return writePlanar(dst, width, height, channels, planeStride);
+    }
+
+    /**
+     * \brief Writes the image into the planar (CHW) buffer of the caller like readInto for the U8 buffers, the FP32
+     * input blobs are filled without the intermediate U8 copy
+     */
+    bool readInto(float *dst, size_t width, size_t height, size_t channels, size_t planeStride = 0) {
+        return writePlanar(dst, width, height, channels, planeStride);
+    }
+
     virtual void Release() noexcept = 0;
+
+protected:
+    /**
+     * \brief Get the interleaved (HWC) pixels readInto samples. The readers able to resize return the image resized
+     * to width x height in a buffer they reuse between the calls, the other ones return the decoded image.
+     * @param pixelsWidth - width of the returned pixels
+     * @param pixelsHeight - height of the returned pixels
+     * @return the pixels or nullptr if the image is not read
+     */
+    virtual const unsigned char *pixels(size_t width, size_t height, size_t &pixelsWidth, size_t &pixelsHeight) {
+        pixelsWidth = _width;
+        pixelsHeight = _height;
+        return _data.get();
+    }
+
+private:
+    /// \brief offsets of the source pixels of the destination columns, kept for the next image
+    std::vector<size_t> _columns;
+
+    template <typename T>
+    bool writePlanar(T *dst, size_t width, size_t height, size_t channels, size_t planeStride) {
+        if (dst == nullptr || width == 0 || height == 0 || channels == 0 || _width * _height == 0) return false;
+        size_t srcChannels = size() / (_width * _height);
+        if (srcChannels != channels && srcChannels != 1) {
+            std::cout << "[ WARNING ] Image has " << srcChannels << " channels, but " << channels << " are expected\n";
+            return false;
+        }
+        size_t srcWidth = 0, srcHeight = 0;
+        const unsigned char *src = pixels(width, height, srcWidth, srcHeight);
+        if (src == nullptr || srcWidth == 0 || srcHeight == 0) return false;
+        if (planeStride == 0) planeStride = width * height;
+
+        // the pixel nearest to the center of every destination pixel, the same size maps every pixel to itself
+        _columns.resize(width);
+        for (size_t x = 0; x < width; x++)
+            _columns[x] = (2 * x + 1) * srcWidth / (2 * width) * srcChannels;
+        for (size_t y = 0; y < height; y++) {
+            const unsigned char *srcRow = src + (2 * y + 1) * srcHeight / (2 * height) * srcWidth * srcChannels;
+            for (size_t c = 0; c < channels; c++) {
+                const unsigned char *srcPixels = srcRow + (srcChannels == 1 ? 0 : c);
+                T *dstRow = dst + c * planeStride + y * width;
+                for (size_t x = 0; x < width; x++)
+                    dstRow[x] = static_cast<T>(srcPixels[_columns[x]]);
+            }
+        }
+        return true;
+    }
 };
 }  // namespace FormatReader
 
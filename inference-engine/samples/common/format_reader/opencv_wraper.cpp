@@ -46,4 +46,21 @@ std::shared_ptr<unsigned char> OCVReader::getData(int width = 0, int height = 0)
     }
     return _data;
 }
+
+const unsigned char *OCVReader::pixels(size_t width, size_t height, size_t &pixelsWidth, size_t &pixelsHeight) {
+    if (img.empty()) {
+        return nullptr;
+    }
+    const cv::Mat *src = &img;
+    if (width != static_cast<size_t>(img.size().width) || height != static_cast<size_t>(img.size().height)) {
+        cv::resize(img, _resized, cv::Size(static_cast<int>(width), static_cast<int>(height)));
+        src = &_resized;
+    }
+    if (!src->isContinuous()) {
+        return nullptr;
+    }
+    pixelsWidth = src->size().width;
+    pixelsHeight = src->size().height;
+    return src->data;
+}
 #endif
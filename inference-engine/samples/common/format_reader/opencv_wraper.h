@@ -26,6 +26,8 @@ namespace FormatReader {
 class OCVReader : public Reader {
 private:
     cv::Mat img;
+    /// \brief the image resized for readInto, its memory is reused while the size does not change
+    cv::Mat _resized;
     size_t _size;
     static Register<OCVReader> reg;
 
@@ -52,6 +54,9 @@ public:
     }
 
     std::shared_ptr<unsigned char> getData(int width, int height) override;
+
+protected:
+    const unsigned char *pixels(size_t width, size_t height, size_t &pixelsWidth, size_t &pixelsHeight) override;
 };
 }  // namespace FormatReader
 #endif
\ No newline at end of file
@@ -37,6 +37,7 @@
 #include <cpp/ie_infer_request.hpp>
 #include <ie_device.hpp>
 #include <ie_blob.h>
+#include <ie_layers.h>
 
 #ifndef UNUSED
   #ifdef WIN32
@@ -668,6 +669,154 @@ static UNUSED void printPerformanceCounts(InferenceEngine::InferRequest request,
     printPerformanceCounts(perfomanceMap, stream);
 }
 
+/**
+ * @brief The static cost of one layer: the arithmetic operations (a multiply-add counts as two) and the bytes of the
+ * inputs, the outputs and the weights, which are read or written once at least
+ */
+struct LayerCost {
+    double flops = 0.0;
+    double bytes = 0.0;
+};
+
+/**
+ * @brief Computes the static cost of the layer from its parameters and the shapes of its data
+ */
+static UNUSED LayerCost getLayerCost(const InferenceEngine::CNNLayerPtr &layer) {
+    using namespace InferenceEngine;
+    auto elements = [](const DataPtr &data) -> double {
+        double count = 1.0;
+        for (size_t dim : data->getTensorDesc().getDims())
+            count *= dim;
+        return count;
+    };
+
+    LayerCost cost;
+    double inputs = 0.0;
+    for (auto &input : layer->insData) {
+        DataPtr data = input.lock();
+        if (data) {
+            inputs = elements(data);
+            cost.bytes += inputs * data->getPrecision().size();
+        }
+    }
+    double outputs = 0.0;
+    for (auto &output : layer->outData) {
+        outputs += elements(output);
+        cost.bytes += elements(output) * output->getPrecision().size();
+    }
+    for (auto &blob : layer->blobs) {
+        if (blob.second)
+            cost.bytes += blob.second->byteSize();
+    }
+    if (layer->insData.empty() || layer->outData.empty())
+        return cost;
+    SizeVector inDims = layer->insData[0].lock()->getTensorDesc().getDims();
+
+    if (auto conv = dynamic_cast<ConvolutionLayer *>(layer.get())) {
+        double inChannels = inDims.size() > 1 ? inDims[1] : 1.0;
+        cost.flops = 2.0 * outputs * inChannels / std::max(conv->_group, 1u) * conv->_kernel_x * conv->_kernel_y;
+    } else if (auto deconv = dynamic_cast<DeconvolutionLayer *>(layer.get())) {
+        cost.flops = 2.0 * inputs * deconv->_out_depth / std::max(deconv->_group, 1u) *
+                     deconv->_kernel_x * deconv->_kernel_y;
+    } else if (auto fc = dynamic_cast<FullyConnectedLayer *>(layer.get())) {
+        cost.flops = 2.0 * inputs * fc->_out_num;
+    } else if (auto pool = dynamic_cast<PoolingLayer *>(layer.get())) {
+        cost.flops = outputs * pool->_kernel_x * pool->_kernel_y;
+    } else if (auto norm = dynamic_cast<NormLayer *>(layer.get())) {
+        cost.flops = outputs * (2.0 * norm->_size + 3.0);
+    } else if (dynamic_cast<EltwiseLayer *>(layer.get())) {
+        cost.flops = outputs * (layer->insData.size() - 1);
+    } else if (dynamic_cast<ScaleShiftLayer *>(layer.get()) || dynamic_cast<BatchNormalizationLayer *>(layer.get()) ||
+               dynamic_cast<PowerLayer *>(layer.get())) {
+        cost.flops = 2.0 * outputs;
+    } else if (dynamic_cast<SoftMaxLayer *>(layer.get())) {
+        cost.flops = 3.0 * outputs;
+    } else if (dynamic_cast<ReLULayer *>(layer.get()) || dynamic_cast<ClampLayer *>(layer.get()) ||
+               dynamic_cast<PReLULayer *>(layer.get())) {
+        cost.flops = outputs;
+    }
+    // the layers moving the data (concat, split, reshape, permute, crop) cost the bytes only
+    return cost;
+}
+
+/**
+ * @brief Prints the performance counts next to the static cost of the layers: the achieved GFLOPS and bandwidth and
+ * the arithmetic intensity (FLOPs per byte). With the peaks of the machine the layers are classified by the roofline
+ * model: the layers with the intensity below peakGflops / peakGBs are memory-bound. The fused layers are reported as
+ * not run, their cost is a part of the time of the layer they are fused to.
+ * @param performanceMap - the performance counts of the request
+ * @param network - the network the counts are taken for
+ * @param peakGflops - the peak compute of the machine, 0 if unknown
+ * @param peakGBs - the peak memory bandwidth of the machine in GB/s, 0 if unknown
+ */
+static UNUSED void printRoofline(const std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& performanceMap,
+                                 const InferenceEngine::CNNNetwork &network, std::ostream &stream,
+                                 double peakGflops = 0.0, double peakGBs = 0.0) {
+    const int maxLayerName = 30;
+    bool classify = peakGflops > 0.0 && peakGBs > 0.0;
+    stream << std::endl << "roofline:" << std::endl << std::endl;
+    stream << std::setw(maxLayerName) << std::left << "layer" << std::setw(16) << "type" << std::right
+           << std::setw(10) << "time, us" << std::setw(10) << "MFLOP" << std::setw(10) << "MB"
+           << std::setw(10) << "FLOP/B" << std::setw(10) << "GFLOPS" << std::setw(10) << "GB/s";
+    if (classify)
+        stream << std::setw(10) << "bound" << std::setw(10) << "of roof";
+    stream << std::endl;
+
+    auto flags = stream.flags();
+    auto precision = stream.precision();
+    stream << std::fixed << std::setprecision(2);
+    double totalFlops = 0.0, totalBytes = 0.0;
+    long long totalTime = 0;
+    for (const auto & it : performanceMap) {
+        InferenceEngine::CNNLayerPtr layer;
+        try {
+            layer = network.getLayerByName(it.first.c_str());
+        } catch (const InferenceEngine::details::InferenceEngineException &) {
+            // the layers added by the plugin (e.g. reorders) are not in the network
+        }
+        LayerCost cost = layer ? getLayerCost(layer) : LayerCost();
+        bool executed = it.second.status == InferenceEngine::InferenceEngineProfileInfo::EXECUTED &&
+                        it.second.realTime_uSec > 0;
+        totalFlops += cost.flops;
+        totalBytes += cost.bytes;
+        if (executed)
+            totalTime += it.second.realTime_uSec;
+
+        std::string toPrint(it.first);
+        if (it.first.length() >= maxLayerName) {
+            toPrint  = it.first.substr(0, maxLayerName - 4);
+            toPrint += "...";
+        }
+        stream << std::setw(maxLayerName) << std::left << toPrint
+               << std::setw(16) << std::string(it.second.layer_type).substr(0, 15) << std::right
+               << std::setw(10) << (executed ? it.second.realTime_uSec : 0)
+               << std::setw(10) << cost.flops / 1e6 << std::setw(10) << cost.bytes / 1e6
+               << std::setw(10) << (cost.bytes > 0.0 ? cost.flops / cost.bytes : 0.0);
+        if (!executed) {
+            stream << std::setw(10) << "-" << std::setw(10) << "-" << std::endl;
+            continue;
+        }
+        double gflops = cost.flops / it.second.realTime_uSec / 1e3;
+        double gbs = cost.bytes / it.second.realTime_uSec / 1e3;
+        stream << std::setw(10) << gflops << std::setw(10) << gbs;
+        if (classify && cost.bytes > 0.0) {
+            double intensity = cost.flops / cost.bytes;
+            bool memoryBound = intensity < peakGflops / peakGBs;
+            double achieved = memoryBound ? gbs / peakGBs : gflops / peakGflops;
+            stream << std::setw(10) << (memoryBound ? "memory" : "compute")
+                   << std::setw(9) << 100.0 * achieved << "%";
+        }
+        stream << std::endl;
+    }
+    stream << std::endl << "Total: " << totalFlops / 1e9 << " GFLOP, " << totalBytes / 1e6 << " MB";
+    if (totalTime > 0) {
+        stream << ", " << totalFlops / totalTime / 1e3 << " GFLOPS, " << totalBytes / totalTime / 1e3 << " GB/s";
+    }
+    stream << std::endl;
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
 /**
  * @deprecated
  */
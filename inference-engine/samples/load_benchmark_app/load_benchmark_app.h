@@ -0,0 +1,111 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message.";
+
+/// @brief message for model argument
+static const char model_message[] = "Required. Path to an .xml file with a trained model.";
+
+/// @brief message for plugin_path argument
+static const char plugin_path_message[] = "Path to a plugin folder.";
+
+/// @brief message for assigning cnn calculation to device
+static const char target_device_message[] = "Specify the target device to load the network to; CPU, GPU, FPGA or " \
+                                            "MYRIAD is acceptable (CPU by default)";
+
+/// @brief message for iterations count
+static const char iterations_count_message[] = "Number of times the network is read and loaded (default 10)";
+
+/// @brief message for the batch size
+static const char batch_size_message[] = "Batch size of the network (the batch of the model if not set)";
+
+/// @brief message for the plugin config
+static const char config_message[] = "Comma separated KEY=VALUE pairs of the plugin config, " \
+                                     "e.g. CPU_THROUGHPUT_STREAMS=4,CLDNN_KERNEL_CACHE_DIR=/tmp/kernels";
+
+/// @brief message for the json report
+static const char report_message[] = "Path to the file the report is written to in JSON format";
+
+/// @brief message for clDNN custom kernels desc
+static const char custom_cldnn_message[] = "Required for clDNN (GPU)-targeted custom kernels."\
+                                            "Absolute path to the xml file with the kernels desc.";
+
+/// @brief message for user library argument
+static const char custom_cpu_library_message[] = "Required for MKLDNN (CPU)-targeted custom layers." \
+                                                 "Absolute path to a shared library with the kernels impl.";
+
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Define parameter for set model file <br>
+/// It is a required parameter
+DEFINE_string(m, "", model_message);
+
+/// @brief Define parameter for set path to plugins <br>
+DEFINE_string(pp, "", plugin_path_message);
+
+/// @brief device the target device to load the network to <br>
+DEFINE_string(d, "CPU", target_device_message);
+
+/// @brief Iterations count
+DEFINE_int32(niter, 10, iterations_count_message);
+
+/// @brief Batch size of the network (0 for the batch of the model)
+DEFINE_int32(b, 0, batch_size_message);
+
+/// @brief The plugin config
+DEFINE_string(config, "", config_message);
+
+/// @brief Path to the JSON report
+DEFINE_string(report, "", report_message);
+
+/// @brief Define parameter for clDNN custom kernels path <br>
+/// Default is ./lib
+DEFINE_string(c, "", custom_cldnn_message);
+
+/// @brief Absolute path to CPU library with user layers <br>
+/// It is a optional parameter
+DEFINE_string(l, "", custom_cpu_library_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "load_benchmark_app [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                      " << help_message << std::endl;
+    std::cout << "    -m \"<path>\"             " << model_message << std::endl;
+    std::cout << "      -l \"<absolute_path>\"    " << custom_cpu_library_message << std::endl;
+    std::cout << "          Or" << std::endl;
+    std::cout << "      -c \"<absolute_path>\"    " << custom_cldnn_message << std::endl;
+    std::cout << "    -pp \"<path>\"            " << plugin_path_message << std::endl;
+    std::cout << "    -d \"<device>\"           " << target_device_message << std::endl;
+    std::cout << "    -niter \"<integer>\"      " << iterations_count_message << std::endl;
+    std::cout << "    -b \"<integer>\"          " << batch_size_message << std::endl;
+    std::cout << "    -config \"<pairs>\"       " << config_message << std::endl;
+    std::cout << "    -report \"<path>\"        " << report_message << std::endl;
+}
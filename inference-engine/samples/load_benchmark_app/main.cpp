@@ -0,0 +1,283 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+/**
+* @brief The entry point of the load benchmark application
+* @file load_benchmark_app/main.cpp
+* @example load_benchmark_app/main.cpp
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <ie_load_profile.hpp>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include <ext_list.hpp>
+
+#include "load_benchmark_app.h"
+
+using namespace InferenceEngine;
+
+typedef std::chrono::high_resolution_clock Time;
+typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validation of input args--------------------------------------
+    slog::info << "Parsing input parameters" << slog::endl;
+
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::logic_error("Parameter -m is not set");
+    }
+
+    if (FLAGS_niter < 1) {
+        throw std::logic_error("Parameter -niter must be more than 0 ! (default 10)");
+    }
+
+    if (FLAGS_b < 0) {
+        throw std::logic_error("Parameter -b must not be negative");
+    }
+
+    return true;
+}
+
+/**
+* @brief Parses the comma separated KEY=VALUE pairs of the -config flag
+*/
+std::map<std::string, std::string> parseConfig(const std::string &pairs) {
+    std::map<std::string, std::string> config;
+    std::istringstream stream(pairs);
+    std::string pair;
+    while (std::getline(stream, pair, ',')) {
+        if (pair.empty())
+            continue;
+        size_t separator = pair.find('=');
+        if (separator == std::string::npos || separator == 0) {
+            throw std::logic_error("Wrong config pair " + pair + ", KEY=VALUE is expected");
+        }
+        config[pair.substr(0, separator)] = pair.substr(separator + 1);
+    }
+    return config;
+}
+
+/**
+* @brief Quotes the string for the JSON report
+*/
+std::string jsonString(const std::string &value) {
+    std::ostringstream quoted;
+    quoted << '"';
+    for (char c : value) {
+        switch (c) {
+        case '"':  quoted << "\\\""; break;
+        case '\\': quoted << "\\\\"; break;
+        case '\n': quoted << "\\n"; break;
+        case '\t': quoted << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                quoted << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                       << std::dec << std::setfill(' ');
+            else
+                quoted << c;
+        }
+    }
+    quoted << '"';
+    return quoted.str();
+}
+
+/**
+* @brief The times of one phase over the iterations. The first (cold) iteration fills the caches of the plugin,
+* so it is reported apart from the warm ones.
+*/
+struct PhaseStats {
+    std::string name;
+    std::vector<double> times;
+
+    double first() const {
+        return times.front();
+    }
+
+    double warmAverage() const {
+        if (times.size() < 2)
+            return times.front();
+        double sum = 0.0;
+        for (size_t i = 1; i < times.size(); i++)
+            sum += times[i];
+        return sum / (times.size() - 1);
+    }
+
+    double warmMin() const {
+        if (times.size() < 2)
+            return times.front();
+        return *std::min_element(times.begin() + 1, times.end());
+    }
+
+    double warmMax() const {
+        if (times.size() < 2)
+            return times.front();
+        return *std::max_element(times.begin() + 1, times.end());
+    }
+};
+
+/**
+* @brief Adds the time of the phase in the iteration, the phases, which did not run in the earlier iterations,
+* get zero times for them
+*/
+void addPhaseTime(std::vector<PhaseStats> &stats, const std::string &name, size_t iteration, double time) {
+    auto found = std::find_if(stats.begin(), stats.end(), [&](const PhaseStats &item) {
+        return item.name == name;
+    });
+    if (found == stats.end()) {
+        stats.push_back({name, {}});
+        found = stats.end() - 1;
+    }
+    found->times.resize(iteration + 1, 0.0);
+    found->times[iteration] += time;
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        // ------------------------------ Parsing and validation of input args ---------------------------------
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+        std::map<std::string, std::string> config = parseConfig(FLAGS_config);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 1. Load Plugin for inference engine -------------------------------------
+        slog::info << "Loading plugin" << slog::endl;
+        InferencePlugin plugin = PluginDispatcher({ FLAGS_pp, "../../../lib/intel64" , "" }).getPluginByDevice(FLAGS_d);
+
+        /** Loading default extensions **/
+        if (FLAGS_d.find("CPU") != std::string::npos) {
+            plugin.AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+        }
+
+        if (!FLAGS_l.empty()) {
+            // CPU(MKLDNN) extensions are loaded as a shared library and passed as a pointer to base extension
+            IExtensionPtr extension_ptr = make_so_pointer<IExtension>(FLAGS_l);
+            plugin.AddExtension(extension_ptr);
+            slog::info << "CPU Extension loaded: " << FLAGS_l << slog::endl;
+        }
+        if (!FLAGS_c.empty()) {
+            // clDNN Extensions are loaded from an .xml description and OpenCL kernel files
+            plugin.SetConfig({{PluginConfigParams::KEY_CONFIG_FILE, FLAGS_c}});
+            slog::info << "GPU Extension loaded: " << FLAGS_c << slog::endl;
+        }
+
+        /** Printing plugin version **/
+        printPluginVersion(plugin, std::cout);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 2. Read and load the network --------------------------------------------
+        slog::info << "Reading and loading the network " << FLAGS_niter << " times" << slog::endl;
+
+        std::vector<PhaseStats> stats;
+        for (int iteration = 0; iteration < FLAGS_niter; iteration++) {
+            LoadProfile::instance().reset();
+
+            auto readStart = Time::now();
+            CNNNetReader networkReader;
+            networkReader.ReadNetwork(FLAGS_m);
+            networkReader.ReadWeights(fileNameNoExt(FLAGS_m) + ".bin");
+            CNNNetwork network = networkReader.getNetwork();
+            if (FLAGS_b != 0) {
+                network.setBatchSize(FLAGS_b);
+            }
+            double readTime = std::chrono::duration_cast<ms>(Time::now() - readStart).count();
+
+            auto loadStart = Time::now();
+            {
+                ExecutableNetwork executableNetwork = plugin.LoadNetwork(network, config);
+            }
+            double loadTime = std::chrono::duration_cast<ms>(Time::now() - loadStart).count();
+
+            addPhaseTime(stats, "read total", iteration, readTime);
+            addPhaseTime(stats, "load total", iteration, loadTime);
+            for (auto &phase : LoadProfile::instance().phases()) {
+                addPhaseTime(stats, phase.name, iteration, phase.totalMs);
+            }
+        }
+        for (auto &phase : stats) {
+            phase.times.resize(FLAGS_niter, 0.0);
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 3. Report the phases ----------------------------------------------------
+        std::cout << std::endl << std::left << std::setw(24) << "phase"
+                  << std::right << std::setw(12) << "first, ms" << std::setw(12) << "avg, ms"
+                  << std::setw(12) << "min, ms" << std::setw(12) << "max, ms" << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+        for (auto &phase : stats) {
+            std::cout << std::left << std::setw(24) << phase.name << std::right
+                      << std::setw(12) << phase.first() << std::setw(12) << phase.warmAverage()
+                      << std::setw(12) << phase.warmMin() << std::setw(12) << phase.warmMax() << std::endl;
+        }
+        std::cout << std::endl << "The first iteration fills the caches, avg, min and max are taken over the rest"
+                  << std::endl;
+
+        if (!FLAGS_report.empty()) {
+            std::ofstream report(FLAGS_report);
+            if (!report.is_open()) {
+                throw std::logic_error("Cannot open the report file " + FLAGS_report);
+            }
+            report << "{" << std::endl;
+            report << "  \"model\": " << jsonString(FLAGS_m) << "," << std::endl;
+            report << "  \"device\": " << jsonString(FLAGS_d) << "," << std::endl;
+            report << "  \"iterations\": " << FLAGS_niter << "," << std::endl;
+            report << "  \"phases\": [";
+            for (size_t i = 0; i < stats.size(); i++) {
+                report << (i == 0 ? "" : ",") << std::endl;
+                report << "    {\"name\": " << jsonString(stats[i].name)
+                       << ", \"first_ms\": " << stats[i].first()
+                       << ", \"avg_ms\": " << stats[i].warmAverage()
+                       << ", \"min_ms\": " << stats[i].warmMin()
+                       << ", \"max_ms\": " << stats[i].warmMax() << "}";
+            }
+            report << std::endl << "  ]" << std::endl;
+            report << "}" << std::endl;
+            slog::info << "The report is written to " << FLAGS_report << slog::endl;
+        }
+    }
+    catch (const std::exception& error) {
+        slog::err << error.what() << slog::endl;
+        return 1;
+    }
+    catch (...) {
+        slog::err << "Unknown/internal exception happened." << slog::endl;
+        return 1;
+    }
+
+    slog::info << "Execution successful" << slog::endl;
+    return 0;
+}
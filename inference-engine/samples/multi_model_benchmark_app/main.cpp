@@ -0,0 +1,554 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+/**
+* @brief The entry point of the multi model benchmark application
+* @file multi_model_benchmark_app/main.cpp
+* @example multi_model_benchmark_app/main.cpp
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include <ext_list.hpp>
+
+#include "multi_model_benchmark_app.h"
+
+using namespace InferenceEngine;
+
+typedef std::chrono::high_resolution_clock Time;
+typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validation of input args--------------------------------------
+    slog::info << "Parsing input parameters" << slog::endl;
+
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_manifest.empty()) {
+        throw std::logic_error("Parameter -manifest is not set");
+    }
+
+    if (FLAGS_t < 1) {
+        throw std::logic_error("Parameter -t must be more than 0 ! (default 20)");
+    }
+
+    return true;
+}
+
+/**
+* @brief One model of the manifest
+*/
+struct ModelSpec {
+    std::string name;
+    std::string path;
+    std::string device = "CPU";
+    /** @brief requests per second, 0 keeps all the requests of the model busy */
+    double rate = 0.0;
+    size_t nireq = 2;
+    std::string nstreams;
+    size_t batch = 0;
+    /** @brief the keys of the plugin config passed as they are */
+    std::map<std::string, std::string> config;
+};
+
+/**
+* @brief Reads the manifest: one model per line, the empty lines and the lines starting with # are skipped
+*/
+std::vector<ModelSpec> readManifest(const std::string &path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Cannot open the manifest " + path);
+    }
+    std::vector<ModelSpec> models;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream tokens(line);
+        ModelSpec spec;
+        if (!(tokens >> spec.path) || spec.path[0] == '#')
+            continue;
+        spec.name = fileNameNoExt(spec.path);
+        spec.name = spec.name.substr(spec.name.find_last_of("/\\") + 1);
+
+        std::string option;
+        while (tokens >> option) {
+            size_t separator = option.find('=');
+            if (separator == std::string::npos || separator == 0) {
+                throw std::logic_error("Wrong option " + option + " of the model " + spec.path +
+                                       ", key=value is expected");
+            }
+            std::string key = option.substr(0, separator);
+            std::string value = option.substr(separator + 1);
+            if (key == "name") {
+                spec.name = value;
+            } else if (key == "device") {
+                spec.device = value;
+            } else if (key == "rate") {
+                spec.rate = std::stod(value);
+            } else if (key == "nireq") {
+                spec.nireq = std::stoul(value);
+            } else if (key == "nstreams") {
+                spec.nstreams = value;
+            } else if (key == "batch") {
+                spec.batch = std::stoul(value);
+            } else {
+                spec.config[key] = value;
+            }
+        }
+        if (spec.rate < 0.0 || spec.nireq < 1) {
+            throw std::logic_error("The model " + spec.path + " must have non-negative rate and positive nireq");
+        }
+        models.push_back(spec);
+    }
+    if (models.empty()) {
+        throw std::logic_error("The manifest " + path + " has no models");
+    }
+    return models;
+}
+
+/**
+* @brief Fills the blob with the uniformly distributed random values, the same seed is used for every run
+*/
+template <typename T, typename Distribution>
+void fillRandom(Blob::Ptr &blob, Distribution distribution) {
+    static std::mt19937 generator(0);
+    T *data = blob->buffer().as<T *>();
+    for (size_t i = 0; i < blob->size(); i++) {
+        data[i] = static_cast<T>(distribution(generator));
+    }
+}
+
+/**
+* @brief Creates the synthetic input of the precision and the layout set in the input info
+*/
+Blob::Ptr createInput(const InputInfo::Ptr &info) {
+    const TensorDesc &desc = info->getTensorDesc();
+    Blob::Ptr blob;
+    switch (desc.getPrecision()) {
+    case Precision::FP32:
+        blob = make_shared_blob<float>(desc);
+        blob->allocate();
+        fillRandom<float>(blob, std::uniform_real_distribution<float>(0.f, 255.f));
+        break;
+    case Precision::U8:
+        blob = make_shared_blob<uint8_t>(desc);
+        blob->allocate();
+        fillRandom<uint8_t>(blob, std::uniform_int_distribution<int>(0, 255));
+        break;
+    default:
+        throw std::logic_error("Unsupported input precision " + std::string(desc.getPrecision().name()));
+    }
+    return blob;
+}
+
+/**
+* @brief Returns the value of the sorted latencies below which the given percent of them lies (the nearest rank)
+*/
+double percentile(const std::vector<double> &sorted, double percent) {
+    if (sorted.empty())
+        return 0.0;
+    size_t rank = static_cast<size_t>(std::ceil(percent / 100.0 * sorted.size()));
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+/**
+* @brief Quotes the string for the JSON report
+*/
+std::string jsonString(const std::string &value) {
+    std::ostringstream quoted;
+    quoted << '"';
+    for (char c : value) {
+        switch (c) {
+        case '"':  quoted << "\\\""; break;
+        case '\\': quoted << "\\\\"; break;
+        case '\n': quoted << "\\n"; break;
+        case '\t': quoted << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                quoted << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                       << std::dec << std::setfill(' ');
+            else
+                quoted << c;
+        }
+    }
+    quoted << '"';
+    return quoted.str();
+}
+
+/**
+* @brief The results of one run of a model
+*/
+struct RunStats {
+    /** @brief sorted latencies in ms, measured from the scheduled start, so the queueing is included */
+    std::vector<double> latencies;
+    double durationMs = 0.0;
+    /** @brief frames per second */
+    double throughput = 0.0;
+
+    double average() const {
+        double sum = 0.0;
+        for (double latency : latencies)
+            sum += latency;
+        return latencies.empty() ? 0.0 : sum / latencies.size();
+    }
+};
+
+/**
+* @class InferRequestsQueue
+* @brief Keeps the infer requests of one model. The completed requests record their latency from the scheduled
+* start and return to the queue of the idle ones.
+*/
+class InferRequestsQueue {
+public:
+    InferRequestsQueue(ExecutableNetwork &network, size_t count, const BlobMap &inputs) {
+        startTimes.resize(count);
+        for (size_t id = 0; id < count; id++) {
+            requests.push_back(network.CreateInferRequestPtr());
+            requests[id]->SetInput(inputs);
+            requests[id]->SetCompletionCallback([this, id]() { finished(id); });
+            idle.push(id);
+        }
+    }
+
+    /**
+    * @brief Waits for an idle request, the failures of the completed request are thrown here
+    */
+    size_t getIdle() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condVar.wait(lock, [this]() { return !idle.empty(); });
+        size_t id = idle.front();
+        idle.pop();
+        lock.unlock();
+        // the request is not busy after its callback returns, Wait also reports its status
+        StatusCode status = requests[id]->Wait(IInferRequest::WaitMode::RESULT_READY);
+        if (status != OK && status != INFER_NOT_STARTED)
+            throw std::logic_error("Inference failed with the status " + std::to_string(status));
+        return id;
+    }
+
+    void start(size_t id, const Time::time_point &scheduled) {
+        startTimes[id] = scheduled;
+        requests[id]->StartAsync();
+    }
+
+    void waitAll() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condVar.wait(lock, [this]() { return idle.size() == requests.size(); });
+    }
+
+    std::vector<double> latencies;
+
+private:
+    void finished(size_t id) {
+        double latency = std::chrono::duration_cast<ms>(Time::now() - startTimes[id]).count();
+        std::lock_guard<std::mutex> lock(mutex);
+        latencies.push_back(latency);
+        idle.push(id);
+        condVar.notify_one();
+    }
+
+    std::vector<InferRequest::Ptr> requests;
+    std::vector<Time::time_point> startTimes;
+    std::queue<size_t> idle;
+    std::mutex mutex;
+    std::condition_variable condVar;
+};
+
+/**
+* @class ModelRunner
+* @brief Loads one model of the manifest and drives it: with the rate set the requests are started on the fixed
+* schedule (open loop), so a slow model queues up and its latency grows, without the rate all the requests of the
+* model are kept busy (closed loop).
+*/
+class ModelRunner {
+public:
+    ModelRunner(const ModelSpec &spec, InferencePlugin &plugin) : spec(spec) {
+        CNNNetReader networkReader;
+        networkReader.ReadNetwork(spec.path);
+        networkReader.ReadWeights(fileNameNoExt(spec.path) + ".bin");
+        CNNNetwork network = networkReader.getNetwork();
+        if (spec.batch != 0) {
+            network.setBatchSize(spec.batch);
+        }
+        batchSize = network.getBatchSize();
+
+        InputsDataMap inputInfo(network.getInputsInfo());
+        for (auto &item : inputInfo) {
+            if (item.second->getPrecision() != Precision::U8) {
+                item.second->setPrecision(Precision::FP32);
+            }
+        }
+
+        std::map<std::string, std::string> config = spec.config;
+        if (!spec.nstreams.empty()) {
+            if (spec.device.find("CPU") != std::string::npos) {
+                config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] =
+                        spec.nstreams == "NUMA" ? PluginConfigParams::CPU_THROUGHPUT_NUMA :
+                        spec.nstreams == "AUTO" ? PluginConfigParams::CPU_THROUGHPUT_AUTO : spec.nstreams;
+            } else if (spec.device.find("GPU") != std::string::npos) {
+                config[PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS] = spec.nstreams;
+            } else {
+                slog::warn << "nstreams of the model " << spec.name << " is ignored for the device "
+                           << spec.device << slog::endl;
+            }
+        }
+        executableNetwork = plugin.LoadNetwork(network, config);
+
+        for (auto &item : inputInfo) {
+            inputs[item.first] = createInput(item.second);
+        }
+        queue.reset(new InferRequestsQueue(executableNetwork, spec.nireq, inputs));
+
+        /** The first inference allocates and initializes the memory, so it is done before the runs **/
+        queue->start(queue->getIdle(), Time::now());
+        queue->waitAll();
+        queue->latencies.clear();
+    }
+
+    /**
+    * @brief Drives the model from the start till the end time and returns the results
+    */
+    RunStats run(const Time::time_point &start, const Time::time_point &end) {
+        std::this_thread::sleep_until(start);
+        for (size_t iteration = 0;; iteration++) {
+            Time::time_point scheduled = Time::now();
+            if (spec.rate > 0.0) {
+                scheduled = start + std::chrono::duration_cast<Time::duration>(
+                        std::chrono::duration<double>(iteration / spec.rate));
+                std::this_thread::sleep_until(scheduled);
+            }
+            if (scheduled >= end)
+                break;
+            queue->start(queue->getIdle(), scheduled);
+        }
+        queue->waitAll();
+
+        RunStats stats;
+        stats.durationMs = std::chrono::duration_cast<ms>(Time::now() - start).count();
+        std::swap(stats.latencies, queue->latencies);
+        std::sort(stats.latencies.begin(), stats.latencies.end());
+        stats.throughput = stats.durationMs > 0.0 ? 1000.0 * stats.latencies.size() * batchSize / stats.durationMs
+                                                  : 0.0;
+        return stats;
+    }
+
+    const ModelSpec spec;
+
+private:
+    size_t batchSize = 1;
+    ExecutableNetwork executableNetwork;
+    BlobMap inputs;
+    std::unique_ptr<InferRequestsQueue> queue;
+};
+
+/**
+* @brief Runs the models at the same time, the runs start together after all the driving threads are created
+*/
+std::vector<RunStats> runConcurrently(std::vector<std::unique_ptr<ModelRunner>> &runners, int seconds) {
+    std::vector<RunStats> stats(runners.size());
+    std::vector<std::exception_ptr> errors(runners.size());
+    auto start = Time::now() + std::chrono::milliseconds(100);
+    auto end = start + std::chrono::seconds(seconds);
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < runners.size(); i++) {
+        threads.emplace_back([&, i]() {
+            try {
+                stats[i] = runners[i]->run(start, end);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (auto &error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+    return stats;
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        // ------------------------------ Parsing and validation of input args ---------------------------------
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+        std::vector<ModelSpec> models = readManifest(FLAGS_manifest);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 1. Load Plugins for inference engine ------------------------------------
+        std::map<std::string, InferencePlugin> plugins;
+        for (auto &spec : models) {
+            if (plugins.find(spec.device) != plugins.end())
+                continue;
+            slog::info << "Loading plugin for " << spec.device << slog::endl;
+            InferencePlugin plugin = PluginDispatcher({ FLAGS_pp, "../../../lib/intel64" , "" })
+                    .getPluginByDevice(spec.device);
+
+            /** Loading default extensions **/
+            if (spec.device.find("CPU") != std::string::npos) {
+                plugin.AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+                if (!FLAGS_l.empty()) {
+                    // CPU(MKLDNN) extensions are loaded as a shared library and passed as a pointer to base extension
+                    IExtensionPtr extension_ptr = make_so_pointer<IExtension>(FLAGS_l);
+                    plugin.AddExtension(extension_ptr);
+                    slog::info << "CPU Extension loaded: " << FLAGS_l << slog::endl;
+                }
+            }
+            if (spec.device.find("GPU") != std::string::npos && !FLAGS_c.empty()) {
+                // clDNN Extensions are loaded from an .xml description and OpenCL kernel files
+                plugin.SetConfig({{PluginConfigParams::KEY_CONFIG_FILE, FLAGS_c}});
+                slog::info << "GPU Extension loaded: " << FLAGS_c << slog::endl;
+            }
+
+            /** Printing plugin version **/
+            printPluginVersion(plugin, std::cout);
+            plugins.insert({spec.device, plugin});
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 2. Load the models ------------------------------------------------------
+        std::vector<std::unique_ptr<ModelRunner>> runners;
+        for (auto &spec : models) {
+            slog::info << "Loading " << spec.name << " to " << spec.device << slog::endl;
+            runners.emplace_back(new ModelRunner(spec, plugins.at(spec.device)));
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 3. Run the models -------------------------------------------------------
+        std::vector<RunStats> solo;
+        if (FLAGS_solo) {
+            for (auto &runner : runners) {
+                slog::info << "Running " << runner->spec.name << " alone for " << FLAGS_t << " seconds"
+                           << slog::endl;
+                auto start = Time::now();
+                solo.push_back(runner->run(start, start + std::chrono::seconds(FLAGS_t)));
+            }
+        }
+
+        slog::info << "Running " << runners.size() << " models concurrently for " << FLAGS_t << " seconds"
+                   << slog::endl;
+        std::vector<RunStats> concurrent = runConcurrently(runners, FLAGS_t);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 4. Report the results ---------------------------------------------------
+        std::cout << std::endl << std::left << std::setw(20) << "model" << std::setw(8) << "device"
+                  << std::right << std::setw(10) << "rate" << std::setw(10) << "FPS"
+                  << std::setw(10) << "avg, ms" << std::setw(10) << "p50, ms" << std::setw(10) << "p90, ms"
+                  << std::setw(10) << "p99, ms";
+        if (FLAGS_solo) {
+            std::cout << std::setw(12) << "p99 slowdn" << std::setw(12) << "FPS ratio";
+        }
+        std::cout << std::endl << std::fixed << std::setprecision(2);
+        for (size_t i = 0; i < runners.size(); i++) {
+            const ModelSpec &spec = runners[i]->spec;
+            const RunStats &stats = concurrent[i];
+            std::cout << std::left << std::setw(20) << spec.name << std::setw(8) << spec.device << std::right
+                      << std::setw(10) << spec.rate << std::setw(10) << stats.throughput
+                      << std::setw(10) << stats.average() << std::setw(10) << percentile(stats.latencies, 50)
+                      << std::setw(10) << percentile(stats.latencies, 90)
+                      << std::setw(10) << percentile(stats.latencies, 99);
+            if (FLAGS_solo) {
+                double soloP99 = percentile(solo[i].latencies, 99);
+                std::cout << std::setw(12) << (soloP99 > 0.0 ? percentile(stats.latencies, 99) / soloP99 : 0.0)
+                          << std::setw(12) << (solo[i].throughput > 0.0 ? stats.throughput / solo[i].throughput
+                                                                        : 0.0);
+            }
+            std::cout << std::endl;
+        }
+        std::cout << std::endl << "The latency is measured from the scheduled start of the request, "
+                  << "so it includes the time the request waited for an idle one" << std::endl;
+
+        if (!FLAGS_report.empty()) {
+            std::ofstream report(FLAGS_report);
+            if (!report.is_open()) {
+                throw std::logic_error("Cannot open the report file " + FLAGS_report);
+            }
+            auto writeStats = [&](const RunStats &stats) {
+                report << "{\"iterations\": " << stats.latencies.size()
+                       << ", \"duration_ms\": " << stats.durationMs
+                       << ", \"throughput_fps\": " << stats.throughput
+                       << ", \"latency_ms\": {\"avg\": " << stats.average()
+                       << ", \"p50\": " << percentile(stats.latencies, 50)
+                       << ", \"p90\": " << percentile(stats.latencies, 90)
+                       << ", \"p99\": " << percentile(stats.latencies, 99) << "}}";
+            };
+            report << "{" << std::endl;
+            report << "  \"manifest\": " << jsonString(FLAGS_manifest) << "," << std::endl;
+            report << "  \"duration_s\": " << FLAGS_t << "," << std::endl;
+            report << "  \"models\": [";
+            for (size_t i = 0; i < runners.size(); i++) {
+                const ModelSpec &spec = runners[i]->spec;
+                report << (i == 0 ? "" : ",") << std::endl;
+                report << "    {\"name\": " << jsonString(spec.name)
+                       << ", \"model\": " << jsonString(spec.path)
+                       << ", \"device\": " << jsonString(spec.device)
+                       << ", \"rate\": " << spec.rate
+                       << ", \"nireq\": " << spec.nireq
+                       << ", \"nstreams\": " << jsonString(spec.nstreams)
+                       << "," << std::endl << "     \"concurrent\": ";
+                writeStats(concurrent[i]);
+                if (FLAGS_solo) {
+                    report << "," << std::endl << "     \"solo\": ";
+                    writeStats(solo[i]);
+                }
+                report << "}";
+            }
+            report << std::endl << "  ]" << std::endl;
+            report << "}" << std::endl;
+            slog::info << "The report is written to " << FLAGS_report << slog::endl;
+        }
+    }
+    catch (const std::exception& error) {
+        slog::err << error.what() << slog::endl;
+        return 1;
+    }
+    catch (...) {
+        slog::err << "Unknown/internal exception happened." << slog::endl;
+        return 1;
+    }
+
+    slog::info << "Execution successful" << slog::endl;
+    return 0;
+}
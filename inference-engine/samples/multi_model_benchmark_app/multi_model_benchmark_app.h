@@ -0,0 +1,100 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message.";
+
+/// @brief message for manifest argument
+static const char manifest_message[] = "Required. Path to the manifest of the models. Every line describes one model: " \
+                                       "the path to its .xml file followed by the key=value options name, device, " \
+                                       "rate (requests per second, 0 drives the model as fast as possible), nireq, " \
+                                       "nstreams, batch and the plugin config keys, e.g. " \
+                                       "\"face.xml device=CPU rate=30 nireq=1 CPU_BIND_THREAD=NO\"";
+
+/// @brief message for plugin_path argument
+static const char plugin_path_message[] = "Path to a plugin folder.";
+
+/// @brief message for the execution time
+static const char execution_time_message[] = "Duration of the concurrent run in seconds (default 20)";
+
+/// @brief message for the solo runs
+static const char solo_message[] = "Run every model alone for the same duration before the concurrent run to " \
+                                   "measure the interference between the models";
+
+/// @brief message for the json report
+static const char report_message[] = "Path to the file the report is written to in JSON format";
+
+/// @brief message for clDNN custom kernels desc
+static const char custom_cldnn_message[] = "Required for clDNN (GPU)-targeted custom kernels."\
+                                            "Absolute path to the xml file with the kernels desc.";
+
+/// @brief message for user library argument
+static const char custom_cpu_library_message[] = "Required for MKLDNN (CPU)-targeted custom layers." \
+                                                 "Absolute path to a shared library with the kernels impl.";
+
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Define parameter for set the manifest file <br>
+/// It is a required parameter
+DEFINE_string(manifest, "", manifest_message);
+
+/// @brief Define parameter for set path to plugins <br>
+DEFINE_string(pp, "", plugin_path_message);
+
+/// @brief Execution time in seconds
+DEFINE_int32(t, 20, execution_time_message);
+
+/// @brief Run the models alone before the concurrent run
+DEFINE_bool(solo, false, solo_message);
+
+/// @brief Path to the JSON report
+DEFINE_string(report, "", report_message);
+
+/// @brief Define parameter for clDNN custom kernels path <br>
+/// Default is ./lib
+DEFINE_string(c, "", custom_cldnn_message);
+
+/// @brief Absolute path to CPU library with user layers <br>
+/// It is a optional parameter
+DEFINE_string(l, "", custom_cpu_library_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "multi_model_benchmark_app [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                      " << help_message << std::endl;
+    std::cout << "    -manifest \"<path>\"      " << manifest_message << std::endl;
+    std::cout << "      -l \"<absolute_path>\"    " << custom_cpu_library_message << std::endl;
+    std::cout << "          Or" << std::endl;
+    std::cout << "      -c \"<absolute_path>\"    " << custom_cldnn_message << std::endl;
+    std::cout << "    -pp \"<path>\"            " << plugin_path_message << std::endl;
+    std::cout << "    -t \"<integer>\"          " << execution_time_message << std::endl;
+    std::cout << "    -solo                   " << solo_message << std::endl;
+    std::cout << "    -report \"<path>\"        " << report_message << std::endl;
+}
@@ -51,64 +51,72 @@ std::shared_ptr<Processor::InferenceMetrics> ClassificationProcessor::Process()
      // }
 
      auto validationMap = generator.getValidationMap(imagesPath);
-     ImageDecoder decoder;
+     std::vector<int> labels;
+     std::vector<std::string> names;
+     for (const auto& item : validationMap) {
+         labels.push_back(item.first);
+         names.push_back(item.second);
+     }
 
      // ----------------------------Do inference-------------------------------------------------------------
      slog::info << "Starting inference" << slog::endl;
 
-     std::vector<int> expected(batch);
-     std::vector<std::string> files(batch);
-     int captured = 0;
+     // the images in the input blob of every request
+     std::vector<std::vector<size_t>> indices(inferRequests.size(), std::vector<size_t>(batch));
+
+     // the requests complete in any order, so the results are scored in the order of the images afterwards
+     struct ImageResult {
+         std::vector<unsigned> classes;
+         std::vector<float> probabilities;
+     };
+     std::map<size_t, ImageResult> imageResults;
 
      ConsoleProgress progress(validationMap.size());
 
      ClassificationInferenceMetrics im;
 
-     std::string firstInputName = this->inputInfo.begin()->first;
      std::string firstOutputName = this->outInfo.begin()->first;
-     auto firstInputBlob = inferRequest.GetBlob(firstInputName);
-     auto firstOutputBlob = inferRequest.GetBlob(firstOutputName);
-
-     auto iter = validationMap.begin();
-     while (iter != validationMap.end()) {
-         int b = 0;
-         int filesWatched = 0;
-         for (; b < batch && iter != validationMap.end(); b++, iter++, filesWatched++) {
-             expected[b] = iter->first;
-             try {
-                 decoder.insertIntoBlob(iter->second, b, *firstInputBlob, preprocessingOptions);
-                 files[b] = iter->second;
-             } catch (const InferenceEngineException& iex) {
-                 slog::warn << "Can't read file " << iter->second << slog::endl;
-                 // Could be some non-image file in directory
-                 b--;
-                 continue;
-             }
-         }
 
-         Infer(progress, filesWatched, im);
+     auto onImage = [&](size_t request, int b, const ImagePrefetcher::Image& image) {
+         indices[request][b] = image.index;
+     };
+
+     auto onResult = [&](InferRequest& request, size_t requestIndex, int count) {
+         auto firstOutputBlob = request.GetBlob(firstOutputName);
 
          std::vector<unsigned> results;
          auto firstOutputData = firstOutputBlob->buffer().as<PrecisionTrait<Precision::FP32>::value_type*>();
          InferenceEngine::TopResults(TOP_COUNT, *firstOutputBlob, results);
 
-         for (int i = 0; i < b; i++) {
-             int expc = expected[i];
-             if (zeroBackground) expc++;
-
-             bool top1Scored = (results[0 + TOP_COUNT * i] == expc);
-             dumper << "\"" + files[i] + "\"" << top1Scored;
-             if (top1Scored) im.top1Result++;
+         for (int i = 0; i < count; i++) {
+             ImageResult& result = imageResults[indices[requestIndex][i]];
              for (int j = 0; j < TOP_COUNT; j++) {
                  unsigned classId = results[j + TOP_COUNT * i];
-                 if (classId == expc) {
-                     im.topCountResult++;
-                 }
-                 dumper << classId << firstOutputData[classId + i * (firstOutputBlob->size() / batch)];
+                 result.classes.push_back(classId);
+                 result.probabilities.push_back(firstOutputData[classId + i * (firstOutputBlob->size() / batch)]);
+             }
+         }
+     };
+
+     Infer(names, progress, im, onImage, onResult);
+
+     for (const auto& item : imageResults) {
+         const ImageResult& result = item.second;
+         int expc = labels[item.first];
+         if (zeroBackground) expc++;
+
+         bool top1Scored = (result.classes[0] == expc);
+         dumper << "\"" + names[item.first] + "\"" << top1Scored;
+         if (top1Scored) im.top1Result++;
+         for (int j = 0; j < TOP_COUNT; j++) {
+             unsigned classId = result.classes[j];
+             if (classId == expc) {
+                 im.topCountResult++;
              }
-             dumper.endLine();
-             im.total++;
+             dumper << classId << result.probabilities[j];
          }
+         dumper.endLine();
+         im.total++;
      }
      progress.finish();
 
@@ -84,9 +84,6 @@ shared_ptr<Processor::InferenceMetrics> ObjectDetectionProcessor::Process() {
         desiredForFiles.insert(std::pair<std::string, ImageDescription>(ann.folder + "/" + (!subdir.empty() ? subdir + "/" : "") + ann.filename, id));
     }
 
-
-    ImageDecoder decoder;
-
     const int maxProposalCount = outputDims[1];
     const int objectSize = outputDims[0];
 
@@ -101,68 +98,63 @@ shared_ptr<Processor::InferenceMetrics> ObjectDetectionProcessor::Process() {
     // ----------------------------Do inference-------------------------------------------------------------
     slog::info << "Starting inference" << slog::endl;
 
-    std::vector<VOCAnnotation> expected(batch);
-
     ConsoleProgress progress(annCollector.annotations().size());
 
     ObjectDetectionInferenceMetrics im(threshold);
 
-    vector<VOCAnnotation>::const_iterator iter = annCollector.annotations().begin();
+    std::vector<std::string> filenames;
+    std::vector<std::string> paths;
+    for (const auto& annotation : annCollector.annotations()) {
+        string filename = annotation.folder + "/" + (!subdir.empty() ? subdir + "/" : "") + annotation.filename;
+        filenames.push_back(filename);
+        paths.push_back(std::string(imagesPath) + "/" + filename);
+    }
 
-    std::map<std::string, ImageDescription> scaledDesiredForFiles;
+    // the images in the input blob of every request
+    std::vector<std::vector<std::string>> files(inferRequests.size(), std::vector<std::string>(batch));
+    std::vector<std::vector<size_t>> indices(inferRequests.size(), std::vector<size_t>(batch));
 
-    std::string firstInputName = this->inputInfo.begin()->first;
-    auto firstInputBlob = inferRequest.GetBlob(firstInputName);
+    // the requests complete in any order, so the detections are scored in the order of the images afterwards
+    std::map<size_t, std::list<DetectedObject>> detectedForImages;
 
-    while (iter != annCollector.annotations().end()) {
-        std::vector<std::string> files;
-        int b = 0;
+    auto onImage = [&](size_t request, int b, const ImagePrefetcher::Image& image) {
+        files[request][b] = filenames[image.index];
+        indices[request][b] = image.index;
+    };
 
-        int filesWatched = 0;
-        for (; b < batch && iter != annCollector.annotations().end(); b++, iter++, filesWatched++) {
-            expected[b] = *iter;
-            string filename = iter->folder + "/" + (!subdir.empty() ? subdir + "/" : "") + iter->filename;
-            try {
-                Size orig_size = decoder.insertIntoBlob(std::string(imagesPath) + "/" + filename, b, *firstInputBlob, preprocessingOptions);
-                float scale_x, scale_y;
+    auto onResult = [&](InferRequest& request, size_t requestIndex, int count) {
+        // Processing the inference result
+        std::map<std::string, std::list<DetectedObject>> detectedObjects = processResult(request, files[requestIndex]);
 
-                scale_x = 1.0 / iter->size.width;  // orig_size.width;
-                scale_y = 1.0 / iter->size.height;  // orig_size.height;
+        for (int b = 0; b < count; b++) {
+            detectedForImages[indices[requestIndex][b]] = detectedObjects[files[requestIndex][b]];
+        }
+    };
 
-                if (scaleProposalToInputSize) {
-                    scale_x *= firstInputBlob->dims()[0];
-                    scale_y *= firstInputBlob->dims()[1];
-                }
+    // Only the full batches are inferred
+    Infer(paths, progress, im, onImage, onResult, true);
 
-                // Scaling the desired result (taken from the annotation) to the network size
-                scaledDesiredForFiles.insert(std::pair<std::string, ImageDescription>(filename, desiredForFiles.at(filename).scale(scale_x, scale_y)));
+    for (const auto& item : detectedForImages) {
+        const VOCAnnotation& annotation = annCollector.annotations()[item.first];
+        const string& filename = filenames[item.first];
 
-                files.push_back(filename);
-            } catch (const InferenceEngineException& iex) {
-                slog::warn << "Can't read file " << this->imagesPath + "/" + filename << slog::endl;
-                // Could be some non-image file in directory
-                b--;
-                continue;
-            }
-        }
+        float scale_x, scale_y;
 
-        if (files.size() == batch) {
-            InferenceEngine::StatusCode sts;
-            InferenceEngine::ResponseDesc dsc;
+        scale_x = 1.0 / annotation.size.width;  // orig_size.width;
+        scale_y = 1.0 / annotation.size.height;  // orig_size.height;
 
-            // Infer model
-            Infer(progress, filesWatched, im);
+        if (scaleProposalToInputSize) {
+            scale_x *= inputDims[0];
+            scale_y *= inputDims[1];
+        }
 
-            // Processing the inference result
-            std::map<std::string, std::list<DetectedObject>> detectedObjects = processResult(files);
+        // Scaling the desired result (taken from the annotation) to the network size
+        ImageDescription desired = desiredForFiles.at(filename).scale(scale_x, scale_y);
 
-            // Calculating similarity
-            //
-            for (int b = 0; b < files.size(); b++) {
-                ImageDescription result(detectedObjects[files[b]]);
-                im.apc.consumeImage(result, scaledDesiredForFiles.at(files[b]));
-            }
-        }
+        // Calculating similarity
+        //
+        ImageDescription result(item.second);
+        im.apc.consumeImage(result, desired);
     }
     progress.finish();
 
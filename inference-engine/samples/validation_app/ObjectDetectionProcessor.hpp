@@ -47,7 +47,7 @@ protected:
 
     bool scaleProposalToInputSize;
 
-    virtual std::map<std::string, std::list<DetectedObject>> processResult(std::vector<std::string> files) = 0;
+    virtual std::map<std::string, std::list<DetectedObject>> processResult(InferenceEngine::InferRequest& inferRequest, std::vector<std::string> files) = 0;
 
 public:
     ObjectDetectionProcessor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, const std::string& subdir, int flags_b,
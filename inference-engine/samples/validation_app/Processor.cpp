@@ -16,6 +16,12 @@
 
 #include <string>
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
 
 #include <samples/common.hpp>
 
@@ -93,26 +99,110 @@ Processor::Processor(const std::string& flags_m, const std::string& flags_d, con
 
     // Load model to plugin and create an inference request
 
-    ExecutableNetwork executable_network = plugin.LoadNetwork(networkReader.getNetwork(), {});
-    inferRequest = executable_network.CreateInferRequest();
+    executableNetwork = plugin.LoadNetwork(networkReader.getNetwork(), {});
+    inferRequests.push_back(executableNetwork.CreateInferRequestPtr());
 }
 
-double Processor::Infer(ConsoleProgress& progress, int filesWatched, InferenceMetrics& im) {
-    ResponseDesc dsc;
-
-    // InferencePlugin plugin(enginePtr);
-
-    // Infer model
-    double time = getDurationOf([&]() {
-        inferRequest.Infer();
-    });
-
-    im.maxDuration = std::min(im.maxDuration, time);
-    im.minDuration = std::max(im.minDuration, time);
-    im.totalTime += time;
-    im.nRuns++;
+void Processor::SetPipeline(size_t nireq, size_t threads) {
+    while (inferRequests.size() < nireq) {
+        inferRequests.push_back(executableNetwork.CreateInferRequestPtr());
+    }
+    decodeThreads = threads == 0 ? std::max<size_t>(std::thread::hardware_concurrency(), 1) : threads;
+}
 
-    progress.addProgress(filesWatched);
+void Processor::Infer(const std::vector<std::string>& files, ConsoleProgress& progress, InferenceMetrics& im,
+                      const ImageCallback& onImage, const ResultCallback& onResult, bool fullBatchesOnly) {
+    typedef std::chrono::high_resolution_clock Time;
+    auto duration = [](Time::time_point t0, Time::time_point t1) {
+        return std::chrono::duration_cast<std::chrono::duration<double, std::ratio<1, 1000>>>(t1 - t0).count();
+    };
+
+    const size_t nireq = inferRequests.size();
+    // every request has a batch decoded ahead, so the decoding keeps up with all of them
+    ImagePrefetcher images(files, inputDims, preprocessingOptions, decodeThreads, nireq * batch * 2);
+
+    std::string firstInputName = this->inputInfo.begin()->first;
+    std::vector<int> filled(nireq, 0);
+    std::vector<int> watched(nireq, 0);
+    std::vector<Time::time_point> startTime(nireq);
+    std::vector<Time::time_point> finishTime(nireq);
+
+    // the requests complete in any order with several streams, the next batch goes to the first idle one
+    std::mutex mutex;
+    std::condition_variable condVar;
+    std::queue<size_t> completed;
+    std::queue<size_t> idle;
+    for (size_t id = 0; id < nireq; id++) {
+        inferRequests[id]->SetCompletionCallback([&, id]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            finishTime[id] = Time::now();
+            completed.push(id);
+            condVar.notify_one();
+        });
+        idle.push(id);
+    }
 
-    return time;
+    auto runStart = Time::now();
+    bool more = true;
+    size_t active = 0;
+    while (more || active > 0) {
+        if (!more || idle.empty()) {
+            size_t id;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condVar.wait(lock, [&] { return !completed.empty(); });
+                id = completed.front();
+                completed.pop();
+            }
+            InferRequest& request = *inferRequests[id];
+            // the request is not busy after its callback returns, Wait also reports its status
+            StatusCode status = request.Wait(IInferRequest::WaitMode::RESULT_READY);
+            if (status != OK) {
+                THROW_IE_EXCEPTION << "Inference failed with the status " << status;
+            }
+
+            double time = duration(startTime[id], finishTime[id]);
+            im.minDuration = std::min(im.minDuration, time);
+            im.maxDuration = std::max(im.maxDuration, time);
+            im.totalTime += time;
+            im.nRuns++;
+            im.nImages += filled[id];
+
+            progress.addProgress(watched[id]);
+            onResult(request, id, filled[id]);
+            active--;
+            idle.push(id);
+            continue;
+        }
+
+        size_t id = idle.front();
+        idle.pop();
+        InferRequest& request = *inferRequests[id];
+
+        filled[id] = 0;
+        watched[id] = 0;
+        auto inputBlob = request.GetBlob(firstInputName);
+        ImagePrefetcher::Image image;
+        while (filled[id] < batch && (more = images.next(image))) {
+            watched[id]++;
+            if (!image.valid) {
+                // Could be some non-image file in directory
+                slog::warn << "Can't read file " << image.name << slog::endl;
+                continue;
+            }
+            ImageDecoder().insertIntoBlob(image.data, filled[id], *inputBlob, preprocessingOptions);
+            onImage(id, filled[id], image);
+            filled[id]++;
+        }
+
+        if (filled[id] > 0 && (!fullBatchesOnly || filled[id] == batch)) {
+            startTime[id] = Time::now();
+            request.StartAsync();
+            active++;
+        } else {
+            progress.addProgress(watched[id]);
+            idle.push(id);
+        }
+    }
+    im.wallTime += duration(runStart, Time::now());
 }
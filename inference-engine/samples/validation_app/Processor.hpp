@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <samples/common.hpp>
 
@@ -27,6 +29,7 @@
 
 #include "csv_dumper.hpp"
 #include "image_decoder.hpp"
+#include "image_prefetcher.hpp"
 #include "console_progress.hpp"
 
 using namespace std;
@@ -40,6 +43,9 @@ public:
         double minDuration = std::numeric_limits<double>::max();
         double maxDuration = 0;
         double totalTime = 0;
+        // the time of the whole run and its images, the requests overlap, so their times don't add up to it
+        double wallTime = 0;
+        int nImages = 0;
 
         virtual ~InferenceMetrics() { }  // Type has to be polymorphic
     };
@@ -49,7 +55,9 @@ protected:
     std::string targetDevice;
     std::string imagesPath;
     int batch;
-    InferenceEngine::InferRequest inferRequest;
+    InferenceEngine::ExecutableNetwork executableNetwork;
+    std::vector<InferenceEngine::InferRequest::Ptr> inferRequests;
+    size_t decodeThreads = 0;
     InferenceEngine::InputsDataMap inputInfo;
     InferenceEngine::OutputsDataMap outInfo;
     InferenceEngine::CNNNetReader networkReader;
@@ -63,12 +71,32 @@ protected:
 
     std::string approach;
 
-    double Infer(ConsoleProgress& progress, int filesWatched, InferenceMetrics& im);
+    typedef std::function<void(size_t request, int batchPos, const ImagePrefetcher::Image& image)> ImageCallback;
+    typedef std::function<void(InferenceEngine::InferRequest& request, size_t requestIndex, int count)> ResultCallback;
+
+    /**
+     * @brief Runs the images through the infer requests: the images are decoded ahead on a pool of threads
+     *        and an idle request is filled with the next batch while the others infer
+     * @param files - list of images filenames
+     * @param onImage - called for every image inserted into the input blob of a request
+     * @param onResult - called for the results of every batch in the order the requests complete, which differs
+     *        from the order of the files with several requests, so the results are keyed by ImagePrefetcher::Image::index
+     * @param fullBatchesOnly - the batches smaller than the batch size are not inferred
+     */
+    void Infer(const std::vector<std::string>& files, ConsoleProgress& progress, InferenceMetrics& im,
+               const ImageCallback& onImage, const ResultCallback& onResult, bool fullBatchesOnly = false);
 
 public:
     Processor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, int flags_b,
             InferenceEngine::InferencePlugin plugin, CsvDumper& dumper, const std::string& approach, PreprocessingOptions preprocessingOptions);
 
+    /**
+     * @brief Sets the number of the infer requests running at once and of the threads decoding the images
+     * @param nireq - number of infer requests, the first one is created with the processor
+     * @param threads - number of decoding threads, 0 takes all the cores
+     */
+    void SetPipeline(size_t nireq, size_t threads);
+
     virtual shared_ptr<InferenceMetrics> Process() = 0;
     virtual void Report(const InferenceMetrics& im) {
         double averageTime = im.totalTime / im.nRuns;
@@ -85,6 +113,10 @@ public:
         if (im.nRuns > 0) {
             slog::info << "Average infer time (ms): " << averageTime << " (" << OUTPUT_FLOATING(1000.0 / (averageTime / batch))
                     << " images per second with batch size = " << batch << ")" << slog::endl;
+            if (im.wallTime > 0) {
+                slog::info << "Throughput: " << OUTPUT_FLOATING(1000.0 * im.nImages / im.wallTime) << " images per second with "
+                        << inferRequests.size() << " infer request(s) and " << decodeThreads << " decoding thread(s)" << slog::endl;
+            }
         } else {
             slog::warn << "No images processed" << slog::endl;
         }
@@ -111,7 +111,7 @@ private:
     }
 
 protected:
-    std::map<std::string, std::list<DetectedObject>> processResult(std::vector<std::string> files) {
+    std::map<std::string, std::list<DetectedObject>> processResult(InferenceEngine::InferRequest& inferRequest, std::vector<std::string> files) {
         std::map<std::string, std::list<DetectedObject>> detectedObjects;
 
         std::string firstOutputName = this->outInfo.begin()->first;
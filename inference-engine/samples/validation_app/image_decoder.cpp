@@ -39,12 +39,37 @@ int getLoadModeForChannels(int channels, int base) {
 }
 
 template <class T>
-cv::Size addToBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions) {
+void fillBlob(const Mat& image, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions) {
     SizeVector blobSize = blob.dims();
     int width = static_cast<int>(blobSize[0]);
     int height = static_cast<int>(blobSize[1]);
     int channels = static_cast<int>(blobSize[2]);
     T* blob_data = static_cast<T*>(blob.buffer());
+
+    float scaleFactor = preprocessingOptions.scaleValuesTo01 ? 255.0 : 1.0;
+
+    for (int c = 0; c < channels; c++) {
+        for (int h = 0; h < height; h++) {
+            for (int w = 0; w < width; w++) {
+                blob_data[batch_pos * channels * width * height + c * width * height + h * width + w] =
+                    static_cast<T>(image.at<cv::Vec3b>(h, w)[c] / scaleFactor);
+            }
+        }
+    }
+}
+
+template <class T>
+cv::Size addToBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions) {
+    SizeVector blobSize = blob.dims();
+    Size res;
+    Mat image = ImageDecoder::decode(name, static_cast<int>(blobSize[0]), static_cast<int>(blobSize[1]),
+                                     static_cast<int>(blobSize[2]), preprocessingOptions, res);
+    fillBlob<T>(image, batch_pos, blob, preprocessingOptions);
+    return res;
+}
+
+Mat ImageDecoder::decode(std::string name, int width, int height, int channels, PreprocessingOptions preprocessingOptions,
+                         Size& originalSize) {
     Mat orig_image, result_image;
     int loadMode = getLoadModeForChannels(channels, 0);
 
@@ -61,7 +86,7 @@ cv::Size addToBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOpt
     }
 
     // Preprocessing the image
-    Size res = orig_image.size();
+    originalSize = orig_image.size();
 
     if (preprocessingOptions.resizeCropPolicy == ResizeCropPolicy::Resize) {
         cv::resize(orig_image, result_image, Size(width, height));
@@ -82,18 +107,7 @@ cv::Size addToBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOpt
         THROW_IE_EXCEPTION << "Unsupported ResizeCropPolicy value";
     }
 
-    float scaleFactor = preprocessingOptions.scaleValuesTo01 ? 255.0 : 1.0;
-
-    for (int c = 0; c < channels; c++) {
-        for (int h = 0; h < height; h++) {
-            for (int w = 0; w < width; w++) {
-                blob_data[batch_pos * channels * width * height + c * width * height + h * width + w] =
-                    static_cast<T>(result_image.at<cv::Vec3b>(h, w)[c] / scaleFactor);
-            }
-        }
-    }
-
-    return res;
+    return result_image;
 }
 
 std::map<std::string, cv::Size> convertToBlob(std::vector<std::string> names, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions) {
@@ -139,3 +153,23 @@ std::map<std::string, cv::Size> ImageDecoder::loadToBlob(std::vector<std::string
 Size ImageDecoder::insertIntoBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions) {
     return convertToBlob({ name }, batch_pos, blob, preprocessingOptions).at(name);
 }
+
+void ImageDecoder::insertIntoBlob(const Mat& image, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions) {
+    if (blob.buffer() == nullptr) {
+        THROW_IE_EXCEPTION << "Blob was not allocated";
+    }
+
+    switch (blob.precision()) {
+    case Precision::FP32:
+        fillBlob<float>(image, batch_pos, blob, preprocessingOptions);
+        break;
+    case Precision::FP16:
+    case Precision::Q78:
+    case Precision::I16:
+    case Precision::U16:
+        fillBlob<short>(image, batch_pos, blob, preprocessingOptions);
+        break;
+    default:
+        fillBlob<uint8_t>(image, batch_pos, blob, preprocessingOptions);
+    }
+}
@@ -56,4 +56,23 @@ public:
      * @return original image size
      */
     Size insertIntoBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions);
+
+    /**
+     * @brief Insert decoded image data to blob at specified batch position.
+     *        Does no checks if blob has sufficient space
+     * @param image - image returned by decode() for the sizes of the blob
+     * @param batch_pos - batch position image should be loaded to
+     * @param blob - blob object to load image data to
+     */
+    void insertIntoBlob(const Mat& image, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions);
+
+    /**
+     * @brief Load and preprocess single image without a blob, it may be called from several threads at once
+     * @param name - image file name
+     * @param width, height, channels - sizes of the blob image should be inserted to
+     * @param originalSize - original image size
+     * @return preprocessed image
+     */
+    static Mat decode(std::string name, int width, int height, int channels, PreprocessingOptions preprocessingOptions,
+                      Size& originalSize);
 };
@@ -0,0 +1,99 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "image_prefetcher.hpp"
+#include "image_decoder.hpp"
+
+ImagePrefetcher::ImagePrefetcher(const std::vector<std::string>& names, const InferenceEngine::SizeVector& blobDims,
+                                 PreprocessingOptions preprocessingOptions, size_t threads, size_t prefetch)
+    : names(names), width(static_cast<int>(blobDims[0])), height(static_cast<int>(blobDims[1])),
+      channels(static_cast<int>(blobDims[2])), preprocessingOptions(preprocessingOptions),
+      prefetch(std::max<size_t>(prefetch, 1)) {
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::min(threads, std::max<size_t>(names.size(), 1));
+    for (size_t i = 0; i < threads; i++) {
+        this->threads.emplace_back(&ImagePrefetcher::decodeLoop, this);
+    }
+}
+
+ImagePrefetcher::~ImagePrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopped = true;
+    }
+    taken.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+bool ImagePrefetcher::next(Image& image) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (nextToTake >= names.size()) {
+        return false;
+    }
+    decoded.wait(lock, [&] { return ready.find(nextToTake) != ready.end(); });
+
+    auto it = ready.find(nextToTake);
+    image = std::move(it->second);
+    ready.erase(it);
+    nextToTake++;
+    lock.unlock();
+
+    taken.notify_all();
+    return true;
+}
+
+void ImagePrefetcher::decodeLoop() {
+    for (;;) {
+        Image image;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            taken.wait(lock, [&] {
+                return stopped || nextToDecode >= names.size() || nextToDecode < nextToTake + prefetch;
+            });
+            if (stopped || nextToDecode >= names.size()) {
+                return;
+            }
+            image.index = nextToDecode++;
+        }
+
+        image.name = names[image.index];
+        try {
+            image.data = ImageDecoder::decode(image.name, width, height, channels, preprocessingOptions,
+                                              image.originalSize);
+            image.valid = true;
+        } catch (const std::exception&) {
+            // Could be some non-image file in directory, the consumer reports it
+            image.valid = false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            size_t index = image.index;
+            ready[index] = std::move(image);
+        }
+        decoded.notify_all();
+    }
+}
@@ -0,0 +1,88 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+
+#include "ie_blob.h"
+
+#include "PreprocessingOptions.hpp"
+
+/**
+ * @class ImagePrefetcher
+ * @brief Decodes and preprocesses the images of a list on a pool of threads ahead of the inference.
+ *        The images are taken in the order of the list, at most `prefetch` images are decoded and not taken yet,
+ *        so the memory stays bounded on large datasets.
+ */
+class ImagePrefetcher {
+public:
+    struct Image {
+        /** @brief position of the image in the list */
+        size_t index = 0;
+        std::string name;
+        /** @brief preprocessed image, empty if the file can't be read */
+        cv::Mat data;
+        cv::Size originalSize;
+        bool valid = false;
+    };
+
+    /**
+     * @brief Starts the decoding threads
+     * @param names - list of images filenames
+     * @param blobDims - dims of the input blob (width, height, channels, batch) the images are decoded for
+     * @param threads - number of decoding threads, 0 takes all the cores
+     * @param prefetch - max number of decoded images waiting to be taken
+     */
+    ImagePrefetcher(const std::vector<std::string>& names, const InferenceEngine::SizeVector& blobDims,
+                    PreprocessingOptions preprocessingOptions, size_t threads, size_t prefetch);
+
+    /**
+     * @brief Stops the decoding threads, the images not taken yet are dropped
+     */
+    ~ImagePrefetcher();
+
+    /**
+     * @brief Takes the next image of the list, waiting for it to be decoded
+     * @return false if all the images are taken
+     */
+    bool next(Image& image);
+
+private:
+    void decodeLoop();
+
+    std::vector<std::string> names;
+    int width, height, channels;
+    PreprocessingOptions preprocessingOptions;
+    size_t prefetch;
+
+    std::mutex mutex;
+    std::condition_variable decoded;
+    std::condition_variable taken;
+    size_t nextToDecode = 0;
+    size_t nextToTake = 0;
+    bool stopped = false;
+    std::map<size_t, Image> ready;
+
+    std::vector<std::thread> threads;
+};
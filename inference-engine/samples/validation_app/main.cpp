@@ -69,6 +69,13 @@ static const char label_message[] = "Path to the file containing labels for the
 /// @brief message for batch argumenttype
 static const char batch_message[] = "Batch size value. If not specified, the batch size value is determined from IR";
 /// @brief message for dump argument
+static const char nireq_message[] = "Number of infer requests running at once, the next batches are prepared while the previous ones infer";
+
+static const char nstreams_message[] = "Number of streams of the CPU or GPU plugin (plugin default if not set), the requests "
+                                       "(-nireq) are spread over them. For CPU, NUMA and AUTO are accepted as well";
+
+static const char pp_threads_message[] = "Number of threads decoding and preprocessing the images. If not specified, all the cores are used";
+
 static const char dump_message[] = "Dump filenames and inference results to a csv file";
 /// @brief message for network type
 static const char type_message[] = "Type of the network being scored (\"C\" by default)";
@@ -128,6 +135,13 @@ DEFINE_string(d, "CPU", target_device_message);
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_int32(b, 0, batch_message);
+/// @brief Define parameter for the number of infer requests <br>
+DEFINE_int32(nireq, 1, nireq_message);
+/// @brief Define parameter for the number of plugin streams <br>
+DEFINE_string(nstreams, "", nstreams_message);
+/// @brief Define parameter for the number of decoding threads <br>
+/// Default is 0 (that means all the cores)
+DEFINE_int32(ppThreads, 0, pp_threads_message);
 /// @brief Define flag to dump results to a file <br>
 DEFINE_bool(dump, false, dump_message);
 /// @brief Define a network type parameter
@@ -183,6 +197,9 @@ static void showUsage() {
     std::cout << "    -ppSize N                 " << preprocessing_size << std::endl;
     std::cout << "    -ppWidth W                " << preprocessing_width << std::endl;
     std::cout << "    -ppHeight H               " << preprocessing_height << std::endl;
+    std::cout << "    -nireq N                  " << nireq_message << std::endl;
+    std::cout << "    -nstreams N               " << nstreams_message << std::endl;
+    std::cout << "    -ppThreads N              " << pp_threads_message << std::endl;
     std::cout << "    --dump                    " << dump_message << std::endl;
 
     std::cout << std::endl;
@@ -247,6 +264,8 @@ int main(int argc, char *argv[]) {
         if (FLAGS_i.empty()) ee << UserException(4, "Images list not specified (missing -i option)");
         if (FLAGS_d.empty()) ee << UserException(5, "Target device not specified (missing -d option)");
         if (FLAGS_b < 0) ee << UserException(6, "Batch should be positive (invalid -b option value)");
+        if (FLAGS_nireq < 1) ee << UserException(7, "Number of infer requests should be positive (invalid -nireq option value)");
+        if (FLAGS_ppThreads < 0) ee << UserException(8, "Number of decoding threads should not be negative (invalid -ppThreads option value)");
 
         if (netType == ObjDetection) {
             // Checking required OD-specific options
@@ -284,6 +303,18 @@ int main(int argc, char *argv[]) {
             plugin.SetConfig({{PluginConfigParams::KEY_CONFIG_FILE, FLAGS_c}});
             slog::info << "GPU Extension loaded: " << FLAGS_c << slog::endl;
         }
+        if (!FLAGS_nstreams.empty()) {
+            // the streams run the requests in parallel, so the accuracy is measured at the throughput of deployment
+            if (FLAGS_d.find("CPU") != std::string::npos) {
+                plugin.SetConfig({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS,
+                                   FLAGS_nstreams == "NUMA" ? PluginConfigParams::CPU_THROUGHPUT_NUMA :
+                                   FLAGS_nstreams == "AUTO" ? PluginConfigParams::CPU_THROUGHPUT_AUTO : FLAGS_nstreams}});
+            } else if (FLAGS_d.find("GPU") != std::string::npos) {
+                plugin.SetConfig({{PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS, FLAGS_nstreams}});
+            } else {
+                slog::warn << "-nstreams is ignored for the device " << FLAGS_d << slog::endl;
+            }
+        }
 
         printPluginVersion(plugin, std::cout);
 
@@ -330,6 +361,7 @@ int main(int argc, char *argv[]) {
             THROW_USER_EXCEPTION(2) <<  "Processor pointer is invalid" << FLAGS_ppType;
         }
         slog::info << (FLAGS_d.empty() ? "Plugin: " + FLAGS_p : "Device: " + FLAGS_d) << slog::endl;
+        processor->SetPipeline(FLAGS_nireq, FLAGS_ppThreads);
         shared_ptr<Processor::InferenceMetrics> pIM = processor->Process();
         processor->Report(*pIM.get());
 
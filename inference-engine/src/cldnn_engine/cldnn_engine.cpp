@@ -16,6 +16,7 @@
 #include <cpp/ie_cnn_network.h>
 #include <description_buffer.hpp>
 #include <memory>
+#include <mutex>
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 #include "ie_plugin.hpp"
 #include "ie_plugin_config.hpp"
@@ -41,6 +42,9 @@ namespace CLDNNPlugin {
 
 struct clDNNEngine::impl {
     CLDNNGraph::Config m_config;
+    // the engine of the networks loaded with KEY_CLDNN_SHARED_MEM_POOL, its pool lives as long as the plugin
+    CLDNNSharedEngine::Ptr m_sharedEngine;
+    std::mutex m_sharedEngineMutex;
 };
 
 clDNNEngine::clDNNEngine() {
@@ -109,6 +113,14 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(InferenceEngine::
         max_batch = network.getBatchSize();
     }
 
+    if (conf.sharedMemoryPool) {
+        std::lock_guard<std::mutex> lock(_impl->m_sharedEngineMutex);
+        if (!_impl->m_sharedEngine) {
+            _impl->m_sharedEngine = std::make_shared<CLDNNSharedEngine>();
+        }
+        return std::make_shared<CLDNNGraph>(network, conf, max_batch, _impl->m_sharedEngine);
+    }
+
     return std::make_shared<CLDNNGraph>(network, conf, max_batch);
 }
 
@@ -0,0 +1,70 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// GridSample: the image [N, C, H, W] (input 0) is sampled bilinearly at the points of the grid [N, OH, OW, 2]
+// (input 1) into the output [N, C, OH, OW]. The points are the (x, y) pairs normalized to [-1, 1], see the layer
+// of the CPU extension. A work item computes the channels of an output pixel, so the taps are computed once.
+__kernel void grid_sample(const __global INPUT0_TYPE* data,
+                          const __global INPUT1_TYPE* grid,
+                          __global OUTPUT0_TYPE* output)
+{
+    const uint x = get_global_id(0);
+    const uint y = get_global_id(1);
+    const uint b = get_global_id(2);
+
+    // the grid is [N, OH, OW, 2] in BFYX
+    const uint grid_offset = INPUT1_OFFSET + b * INPUT1_PITCHES[0] + y * INPUT1_PITCHES[1] + x * INPUT1_PITCHES[2];
+    const float gx = grid[grid_offset];
+    const float gy = grid[grid_offset + INPUT1_PITCHES[3]];
+
+#if ALIGN_CORNERS
+    const float px = (gx + 1) * 0.5f * (INPUT0_SIZE_X - 1);
+    const float py = (gy + 1) * 0.5f * (INPUT0_SIZE_Y - 1);
+#else
+    const float px = ((gx + 1) * INPUT0_SIZE_X - 1) * 0.5f;
+    const float py = ((gy + 1) * INPUT0_SIZE_Y - 1) * 0.5f;
+#endif
+
+    const uint out_offset = OUTPUT0_OFFSET + b * OUTPUT0_PITCHES[0] + y * OUTPUT0_PITCHES[2] + x * OUTPUT0_PITCHES[3];
+
+    // the points far outside (and the NaNs) sample the zero padding only
+    if (!(px > -1 && px < INPUT0_SIZE_X && py > -1 && py < INPUT0_SIZE_Y))
+    {
+        for (uint f = 0; f < OUTPUT0_FEATURE_NUM; f++)
+            output[out_offset + f * OUTPUT0_PITCHES[1]] = 0;
+        return;
+    }
+
+    const float fx = floor(px);
+    const float fy = floor(py);
+    const int n = (int)fx;
+    const int m = (int)fy;
+    const float dx = px - fx;
+    const float dy = py - fy;
+
+    const bool left = n >= 0;
+    const bool right = n + 1 < INPUT0_SIZE_X;
+    const bool top = m >= 0;
+    const bool bottom = m + 1 < INPUT0_SIZE_Y;
+
+    const float w00 = top && left ? (1 - dy) * (1 - dx) : 0;
+    const float w01 = top && right ? (1 - dy) * dx : 0;
+    const float w10 = bottom && left ? dy * (1 - dx) : 0;
+    const float w11 = bottom && right ? dy * dx : 0;
+
+    // the taps outside the image read the first pixel with the zero weight
+    const uint row0 = top ? m * INPUT0_PITCHES[2] : 0;
+    const uint row1 = bottom ? (m + 1) * INPUT0_PITCHES[2] : 0;
+    const uint col0 = left ? n * INPUT0_PITCHES[3] : 0;
+    const uint col1 = right ? (n + 1) * INPUT0_PITCHES[3] : 0;
+
+    for (uint f = 0; f < OUTPUT0_FEATURE_NUM; f++)
+    {
+        const __global INPUT0_TYPE* plane = data + INPUT0_OFFSET + b * INPUT0_PITCHES[0] + f * INPUT0_PITCHES[1];
+        const float value = w00 * plane[row0 + col0] + w01 * plane[row0 + col1] +
+                            w10 * plane[row1 + col0] + w11 * plane[row1 + col1];
+        output[out_offset + f * OUTPUT0_PITCHES[1]] = (OUTPUT0_TYPE)value;
+    }
+}
@@ -40,6 +40,7 @@
 #include <CPP/max_unpooling.hpp>
 #include <CPP/arg_max_min.hpp>
 #include <CPP/mvn.hpp>
+#include <CPP/gemm.hpp>
 #include <chrono>
 #include <cmath>
 #include <algorithm>
@@ -51,6 +52,10 @@
 #include "cldnn_infer_request.h"
 #include <cpp_interfaces/ie_executor_manager.hpp>
 #include <caseless.hpp>
+#include <ie_trace.hpp>
+#include <ie_load_profile.hpp>
+#include <ie_util_internal.hpp>
+#include <precision_utils.h>
 #include <fstream>
 #include <utility>
 #include <sys/types.h>
@@ -83,6 +88,14 @@ const cldnn::primitive_id CLDNNGraph::m_scalesTag("_cldnn_scales");
 const cldnn::primitive_id CLDNNGraph::m_workaroundTag("_cldnn_workaround");
 const cldnn::primitive_id CLDNNGraph::m_preCustomLayerTag("_cldnn_custom_preprocess");
 const cldnn::primitive_id CLDNNGraph::m_postCustomLayerTag("_cldnn_custom_postprocess");
+const cldnn::primitive_id CLDNNGraph::m_quantizeTag("_cldnn_quantize");
+const cldnn::primitive_id CLDNNGraph::m_dequantizeTag("_cldnn_dequantize");
+const cldnn::primitive_id CLDNNGraph::m_weightsQFTag("_cldnn_w_qf");
+const cldnn::primitive_id CLDNNGraph::m_calibrationTag("_cldnn_calibration");
+
+// CNNNetworkInt8Normalizer quantizes the inputs of the int8 convolutions to [0, 255], while the int8 kernels
+// take signed inputs, so the quantized inputs are narrowed to [0, 127] and widened back by the convolutions
+static const float int8InputNarrowing = 127.0f / 255.0f;
 
 static void ValidateLayer(const InferenceEngine::CNNLayerPtr& layer, unsigned inputs) {  // todo: add more checks
     if (inputs && layer->insData.size() != inputs) {
@@ -93,6 +106,15 @@ static void ValidateLayer(const InferenceEngine::CNNLayerPtr& layer, unsigned in
     }
 }
 
+// the clDNN tensors have two spatial dimensions, so the 3D convolutions and poolings of the 5D inputs cannot run
+static void ValidateSpatialRank(const InferenceEngine::CNNLayerPtr& layer) {
+    auto input = layer->insData[0].lock();
+    if (input && input->getTensorDesc().getDims().size() == 5) {
+        THROW_CLDNN_EXCEPTION("3D " << layer->type << " of the 5D input is not supported by the GPU plugin, layer: "
+                              << layer->name);
+    }
+}
+
 static void ValidateEltwiseLayer(const InferenceEngine::CNNLayerPtr& layer) {
     if (layer->insData.size() < 2) {
         THROW_CLDNN_EXCEPTION("Invalid number of inputs for layer: " << layer->name << ". Eltwise layer should take at least 2 inputs");
@@ -107,6 +129,7 @@ static void ValidateEltwiseLayer(const InferenceEngine::CNNLayerPtr& layer) {
 #endif
 
 void CLDNNGraph::Config::LoadFromMap(const std::map<std::string, std::string>& configMap) {
+    bool traceChanged = false;
     for (auto& kvp : configMap) {
         std::string key = kvp.first;
         std::string val = kvp.second;
@@ -194,7 +217,11 @@ void CLDNNGraph::Config::LoadFromMap(const std::map<std::string, std::string>& c
                 CLDNNCustomLayer::LoadFromFile(file, customLayers);
             }
         } else if (key.compare(PluginConfigParams::KEY_TUNING_MODE) == 0) {
-            if (val.compare(PluginConfigParams::TUNING_DISABLED) == 0) {
+            backgroundTuning = false;
+            if (val.compare(CLDNNConfigParams::CLDNN_TUNING_BACKGROUND) == 0) {
+                tuningConfig.mode = cldnn::tuning_mode::tuning_disabled;
+                backgroundTuning = true;
+            } else if (val.compare(PluginConfigParams::TUNING_DISABLED) == 0) {
                 tuningConfig.mode = cldnn::tuning_mode::tuning_disabled;
             } else if (val.compare(PluginConfigParams::TUNING_CREATE) == 0) {
                 tuningConfig.mode = cldnn::tuning_mode::tuning_tune_and_cache;
@@ -213,6 +240,46 @@ void CLDNNGraph::Config::LoadFromMap(const std::map<std::string, std::string>& c
             } else {
                 THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported memory pool flag value: " << val;
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_PREEMPTION_SLICE) == 0) {
+            std::stringstream ss(val);
+            int iVal(0);
+            ss >> iVal;
+            if (ss.fail() || iVal < 0) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported preemption slice value: " << val;
+            }
+            preemptionSlice = iVal;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_PROFILING_SAMPLE) == 0) {
+            std::stringstream ss(val);
+            int iVal(0);
+            ss >> iVal;
+            if (ss.fail() || iVal < 0) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported profiling sample value: " << val;
+            }
+            profilingSample = iVal;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_SHARED_MEM_POOL) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                sharedMemoryPool = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                sharedMemoryPool = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported shared memory pool flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_OUT_OF_ORDER_QUEUE) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                outOfOrderQueue = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                outOfOrderQueue = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported out-of-order queue flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_FP16_INFERENCE) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                fp16Inference = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                fp16Inference = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported fp16 inference flag value: " << val;
+            }
         } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_GRAPH_DUMPS_DIR) == 0) {
             if (!val.empty()) {
                 graph_dumps_dir = val;
@@ -223,6 +290,40 @@ void CLDNNGraph::Config::LoadFromMap(const std::map<std::string, std::string>& c
                 sources_dumps_dir = val;
                 mkdir(sources_dumps_dir.c_str(), 0755);
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_KERNEL_CACHE_DIR) == 0) {
+            if (!val.empty()) {
+                kernels_cache_dir = val;
+                mkdir(kernels_cache_dir.c_str(), 0755);
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_CONTEXT) == 0 ||
+                   key.compare(CLDNNConfigParams::KEY_CLDNN_QUEUE) == 0) {
+            uintptr_t handle = 0;
+            try {
+                handle = static_cast<uintptr_t>(std::stoull(val, nullptr, 0));
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported OpenCL handle value: " << val;
+            }
+            if (key.compare(CLDNNConfigParams::KEY_CLDNN_CONTEXT) == 0) {
+                sharedContext = reinterpret_cast<void *>(handle);
+            } else {
+                sharedQueue = reinterpret_cast<void *>(handle);
+            }
+        } else if (key.compare(PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS) == 0) {
+            std::stringstream ss(val);
+            int iVal(0);
+            ss >> iVal;
+            if (ss.fail() || iVal < 1) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported number of throughput streams: " << val;
+            }
+            throughputStreams = iVal;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_COMPILATION_THREADS) == 0) {
+            std::stringstream ss(val);
+            int iVal(0);
+            ss >> iVal;
+            if (ss.fail() || iVal < 1) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported number of compilation threads: " << val;
+            }
+            compilationThreads = iVal;
         } else if (key.compare(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0) {
                 exclusiveAsyncRequests = true;
@@ -231,10 +332,53 @@ void CLDNNGraph::Config::LoadFromMap(const std::map<std::string, std::string>& c
             } else {
                 THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
             }
+        } else if (key.compare(PluginConfigParams::KEY_TRACE_FILE) == 0) {
+            traceFile = val;
+            traceChanged = true;
+        } else if (key.compare(PluginConfigParams::KEY_TRACE_WINDOW) == 0) {
+            int iVal;
+            try {
+                iVal = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            if (iVal < 0) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            traceWindow = iVal;
+            traceChanged = true;
+        } else if (key.compare(PluginConfigParams::KEY_REQUEST_PRIORITY) == 0) {
+            try {
+                requestPriority = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+        } else if (key.compare(PluginConfigParams::KEY_CALLBACK_THREADS) == 0) {
+            int iVal;
+            try {
+                iVal = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            if (iVal < 0) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            callbackThreads = iVal;
+        } else if (key.compare(PluginConfigParams::KEY_RELEASE_WEIGHTS) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                releaseWeights = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                releaseWeights = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property key by plugin: " << key;
         }
     }
+    if (traceChanged) {
+        TraceSink::instance().start(traceFile, traceWindow);
+    }
 }
 
 void CLDNNGraph::changeInputBatch(size_t batch) {
@@ -262,7 +406,7 @@ bool CLDNNGraph::CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const
             ROIPooling == type ||
             PriorBox == type ||
             DetectionOutput == type ||
-            Reshape == type ||
+            ReshapeLayer == type ||
             Permute == type ||
             Flatten == type ||
             Proposal == type ||
@@ -280,22 +424,52 @@ bool CLDNNGraph::CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const
     return check_result;
 }
 
-CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& config, int max_batch) : m_config(config),
+CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& config, int max_batch,
+                       const CLDNNSharedEngine::Ptr &sharedEngine) : m_config(config),
     m_defaultFormat(cldnn::format::bfyx),
     m_networkPrecision(cldnn::data_types::f32),
-    m_curBatch(-1) {
-    m_env.engine = std::make_shared<cldnn::engine>(cldnn::engine_configuration(
-        (config.useProfiling || (config.tuningConfig.mode != cldnn::tuning_mode::tuning_disabled)),
-        false,
-        config.dumpCustomKernels,
-        std::string(),
-        std::string(),
-        true,
-        std::string(),
-        config.sources_dumps_dir,
-        config.queuePriority,
-        config.queueThrottle,
-        config.memory_pool_on));
+    m_curBatch(-1),
+    m_nextStream(0) {
+    // exclusive mode muxes all the requests into the single queue, the dynamic batch switches the networks
+    // of all the batches and the shared memory pool runs one network at a time, so there is no room for streams
+    const int streams = (config.exclusiveAsyncRequests || max_batch > 1 || sharedEngine) ? 1 : config.throughputStreams;
+
+    if (sharedEngine && sharedEngine->engine) {
+        m_env.engine = sharedEngine->engine;
+        m_env.executeMutex = sharedEngine->executeMutex;
+        m_weightsStore = sharedEngine->weights;
+    } else {
+        m_env.engine = std::make_shared<cldnn::engine>(cldnn::engine_configuration(
+            // the tuning times the kernels by the profiling events of the queue
+            (config.useProfiling || config.profilingSample > 0 || config.backgroundTuning ||
+             (config.tuningConfig.mode != cldnn::tuning_mode::tuning_disabled)),
+            false,
+            config.dumpCustomKernels,
+            std::string(),
+            std::string(),
+            config.outOfOrderQueue,
+            std::string(),
+            config.sources_dumps_dir,
+            config.queuePriority,
+            config.queueThrottle,
+            // the memory pool shares the intermediate buffers between the networks, so it is not used by the streams
+            (config.memory_pool_on || sharedEngine) && streams == 1,
+            config.kernels_cache_dir,
+            static_cast<uint32_t>(config.compilationThreads),
+            config.sharedContext,
+            config.sharedQueue));
+        m_env.executeMutex = std::make_shared<std::mutex>();
+        m_weightsStore = std::make_shared<CLDNNWeightsStore>();
+        if (sharedEngine) {
+            sharedEngine->engine = m_env.engine;
+            sharedEngine->executeMutex = m_env.executeMutex;
+            sharedEngine->weights = m_weightsStore;
+        }
+    }
+    m_env.exclusiveExecution = sharedEngine != nullptr;
+    m_env.devicePriority = CLDNNDeviceScheduler::priorityOf(config.queuePriority);
+    _requestPriority = config.requestPriority;
+    setCallbackThreads(config.callbackThreads);
 #if 0
         m_env.debugOptions.PrintOptions();
 #endif
@@ -330,10 +504,23 @@ CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& conf
     // Handle workarounds
     char networkName[128] = { 0 };
     network.getName(networkName, 127);
+    m_networkName = networkName;
     m_env.debugOptions.EnableWA(networkName);
     m_env.debugOptions.AddTimedEvent("Loading Begin");
 
     if (max_batch > 1) {
+        // the kernels taking the batch index from their global work size run any smaller batch on the buffers of
+        // the max batch, the networks of the powers of two are built only when some kernel bakes the batch in
+        m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
+        changeInputBatch(max_batch);
+        Load(network);
+        CompileNetwork();
+        m_topology.reset();
+        m_env.engine->release_pending_memory();
+        m_env.runtimeBatch = m_env.network->supports_runtime_batch();
+    }
+
+    if (max_batch > 1 && !m_env.runtimeBatch) {
         for (int b = m_env.m_bv_sz - 1; b >= 0; b--) {
             m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
             m_env.network.reset();
@@ -350,12 +537,30 @@ CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& conf
             m_topology.reset();
             m_env.engine->release_pending_memory();
         }
-    } else {
+    } else if (max_batch <= 1) {
         m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
         Load(network);
         CompileNetwork();
         m_topology.reset();
         m_env.engine->release_pending_memory();
+
+        if (streams > 1) {
+            CreateStreams(streams);
+        }
+    }
+
+    // the weights are uploaded to the cldnn::data primitives
+    if (config.releaseWeights) {
+        releaseWeights(network);
+    } else if (max_batch <= 1) {
+        m_reshapableNetwork = cloneNet(network);
+        InputsDataMap inputs;
+        m_reshapableNetwork->getInputsInfo(inputs);
+        ICNNNetwork::InputShapes shapes;
+        for (auto& input : inputs) {
+            shapes[input.first] = input.second->getTensorDesc().getDims();
+        }
+        m_currentShapes = ShapesKey(shapes);
     }
 
     m_env.debugOptions.AddTimedEvent("Loading", "Loading Begin");
@@ -408,7 +613,7 @@ InferenceEngine::CNNLayerPtr CLDNNGraph::GetNextSingleLayer(const InferenceEngin
 
 void CLDNNGraph::InitFormat(InferenceEngine::ICNNNetwork &network) {
     m_defaultFormat    = FormatFromLayout(InferenceEngine::Layout::NCHW);
-    m_networkPrecision = DataTypeFromPrecision(network.getPrecision());
+    m_networkPrecision = InternalDataType(network.getPrecision());
 }
 
 void CLDNNGraph::CompileNetwork() {
@@ -418,19 +623,155 @@ void CLDNNGraph::CompileNetwork() {
         options.set_option(cldnn::build_option::graph_dumps_dir(m_config.graph_dumps_dir));
     }
     options.set_option(cldnn::build_option::optimize_data(true));
-    options.set_option(cldnn::build_option::tuning_config(m_config.tuningConfig));
+
+    // the background tuning loads the network with the kernels tuned earlier, the heuristics select the rest
+    cldnn::tuning_config_options tuningConfig = m_config.tuningConfig;
+    std::string backgroundTuningFile;
+    if (m_config.backgroundTuning) {
+        backgroundTuningFile = tuningConfig.cache_file_path.empty() ?
+                               CLDNNBackgroundTuner::defaultTuningFile(m_config.kernels_cache_dir) :
+                               tuningConfig.cache_file_path;
+        if (!backgroundTuningFile.empty() && std::ifstream(backgroundTuningFile).good()) {
+            tuningConfig.mode = cldnn::tuning_mode::tuning_use_cache;
+            tuningConfig.cache_file_path = backgroundTuningFile;
+        }
+    }
+    options.set_option(cldnn::build_option::tuning_config(tuningConfig));
 
     m_env.network.reset();
-    m_env.network = std::make_shared<cldnn::network>(cldnn::network(*(m_env.engine), *m_topology, options));
+    WaitForUploads();
+    {
+        // the program optimizes the graph, selects the kernels and compiles them (or takes them from the cache)
+        LoadPhaseScope phase("kernel compile");
+        m_env.network = std::make_shared<cldnn::network>(cldnn::network(*(m_env.engine), *m_topology, options));
+    }
+    SetPreemption(*m_env.network);
     m_env.debugOptions.AddTimedEvent("Network Build", "Network Build Begin");
 
+    if (!backgroundTuningFile.empty()) {
+        // the networks of the same name and inputs are tuned once per process
+        std::string tuningKey = m_networkName;
+        for (auto& input : m_env.inputLayouts) {
+            tuningKey += "\n" + input.first + input.second.size.to_string();
+        }
+        auto job = CLDNNBackgroundTuner::getInstance().enqueue(tuningKey, m_env.engine, m_topology,
+                                                               backgroundTuningFile);
+        if (job) {
+            m_tuningJobs.push_back(job);
+        }
+    }
+
     // add input data from all constant blobs
     for (auto& cblob : m_env.constBlobs) {
         m_env.network->set_input_data(cblob.first, cblob.second);
     }
 }
 
+void CLDNNGraph::SetPreemption(cldnn::network &network) const {
+    // the networks sharing the engine wait for each other on the execution lock, so they must not wait in it
+    if (m_config.preemptionSlice > 0 && !m_env.exclusiveExecution) {
+        CLDNNDeviceScheduler::setPreemption(network, m_env.devicePriority,
+                                            static_cast<uint32_t>(m_config.preemptionSlice));
+    }
+}
+
+bool CLDNNGraph::ReleaseNetworks(InferenceEnv &env, std::vector<std::shared_ptr<cldnn::network>> &streamNetworks,
+                                 std::shared_ptr<cldnn::program> &program) {
+    if (!env.network || !env.batchNetworks.empty()) {
+        return false;
+    }
+    // the requests keep the networks they were created with, the graph holds the first stream network twice
+    auto graphReferences = [&](const std::shared_ptr<cldnn::network> &network) {
+        return (env.network == network ? 1 : 0) + std::count(streamNetworks.begin(), streamNetworks.end(), network);
+    };
+    if (env.network.use_count() != graphReferences(env.network)) {
+        return false;
+    }
+    for (auto& network : streamNetworks) {
+        if (network.use_count() != graphReferences(network)) {
+            return false;
+        }
+    }
+    program = std::make_shared<cldnn::program>(env.network->get_program());
+    env.network.reset();
+    for (auto& network : streamNetworks) {
+        network.reset();
+    }
+    return true;
+}
+
+void CLDNNGraph::RestoreNetworks(InferenceEnv &env, std::vector<std::shared_ptr<cldnn::network>> &streamNetworks,
+                                 std::shared_ptr<cldnn::program> &program) {
+    if (!program) {
+        return;
+    }
+    auto createNetwork = [&]() {
+        auto network = std::make_shared<cldnn::network>(*program);
+        SetPreemption(*network);
+        for (auto& cblob : env.constBlobs) {
+            network->set_input_data(cblob.first, cblob.second);
+        }
+        return network;
+    };
+    env.network = createNetwork();
+    for (size_t n = 0; n < streamNetworks.size(); n++) {
+        streamNetworks[n] = n == 0 ? env.network : createNetwork();
+    }
+    program.reset();
+}
+
+void CLDNNGraph::TrimImpl(bool releaseWeights) {
+    std::lock_guard<std::mutex> lock(m_reshapeMutex);
+    if (!m_trimmedProgram) {
+        ReleaseNetworks(m_env, m_streamNetworks, m_trimmedProgram);
+    }
+    for (auto it = m_shapeNetworks.begin(); it != m_shapeNetworks.end();) {
+        auto& shape = it->second;
+        if (!shape.trimmedProgram && !ReleaseNetworks(shape.env, shape.streamNetworks, shape.trimmedProgram)) {
+            ++it;
+        } else if (releaseWeights) {
+            // the shapes are compiled again by Reshape, the weights store uploads their weights again
+            it = m_shapeNetworks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    // the networks free the buffers of the memory pool they used alone, the engine frees the released memory
+    m_env.engine->release_pending_memory();
+}
+
+void CLDNNGraph::CreateStreams(int streams) {
+    // the networks of the program compiled once share the kernels and the memory of the weights
+    cldnn::program program = m_env.network->get_program();
+    m_streamNetworks.push_back(m_env.network);
+    for (int n = 1; n < streams; n++) {
+        auto streamNetwork = std::make_shared<cldnn::network>(program);
+        SetPreemption(*streamNetwork);
+        for (auto& cblob : m_env.constBlobs) {
+            streamNetwork->set_input_data(cblob.first, cblob.second);
+        }
+        m_streamNetworks.push_back(streamNetwork);
+    }
+    // the executors stay with the streams when the network is reshaped
+    for (int n = static_cast<int>(m_streamExecutors.size()); n < streams; n++) {
+        m_streamExecutors.push_back(std::make_shared<TaskExecutor>());
+    }
+}
+
+std::string CLDNNGraph::ShapesKey(const ICNNNetwork::InputShapes &shapes) {
+    std::stringstream key;
+    for (auto& shape : shapes) {
+        key << shape.first << ":";
+        for (auto dim : shape.second) {
+            key << dim << ",";
+        }
+        key << "\n";
+    }
+    return key.str();
+}
+
 void CLDNNGraph::Load(InferenceEngine::ICNNNetwork &network) {
+    LoadPhaseScope phase("topology build");
     InitFormat(network);
     auto _networkPrecision = network.getPrecision();
 
@@ -499,7 +840,7 @@ void CLDNNGraph::Load(InferenceEngine::ICNNNetwork &network) {
         }
 
         infLoopProtection = 0;  // found a layer with all inputs already existing
-        IE_ASSERT(_networkPrecision == currLayer->precision);
+        IE_ASSERT(_networkPrecision == currLayer->precision || IsInt8Convolution(currLayer));
         CreateSingleLayerPrimitive(currLayer);  // currLayer will be advanced if layer was skipped or merged
         m_env.prevPrimitiveIDs[currLayer->name] = GetPrevLayersPrimitives(currLayer);
 
@@ -546,7 +887,7 @@ CLDNNGraph::LayerType CLDNNGraph::LayerTypeFromStr(const std::string &str) {
         { "PriorBox" , PriorBox },
         { "DetectionOutput" , DetectionOutput },
         { "Normalize" , Normalize },
-        { "Reshape" , Reshape },
+        { "Reshape" , ReshapeLayer },
         { "Permute" , Permute },
         { "Flatten" , Flatten },
         { "BatchNormalization" , BatchNormalization },
@@ -564,6 +905,7 @@ CLDNNGraph::LayerType CLDNNGraph::LayerTypeFromStr(const std::string &str) {
         { "ArgMax" , ArgMax },
         { "MVN" , MVN },
         { "Unpooling" , Unpooling },
+        { "Gemm" , Gemm },
     };
     auto it = LayerNameToType.find(str);
     if (it != LayerNameToType.end())
@@ -619,12 +961,193 @@ cldnn::concatenation::concatenation_axis CLDNNGraph::ConcatAxisFromIEAxis(unsign
     return cldnn::concatenation::concatenation_axis::along_f;  // shouldn't get here
 }
 
+void CLDNNGraph::GetMemoryFootprint(InferenceEngine::MemoryFootprint &footprint) {
+    footprint = InferenceEngine::MemoryFootprint();
+    footprint.weights = m_weightsBytes;
+    footprint.peak = m_env.engine->get_max_used_device_memory_size();
+    size_t used = m_env.engine->get_temp_used_device_memory_size();
+    footprint.workspace = used > m_weightsBytes ? used - m_weightsBytes : 0;
+    footprint.io = GetIOBytes();
+    // the requests keep their inputs in the device memory and map the outputs of the networks
+    footprint.perRequest = footprint.io;
+}
+
+void CLDNNGraph::Reshape(const ICNNNetwork::InputShapes &inputShapes) {
+    if (!m_reshapableNetwork) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The network loaded with "
+                           << (m_config.releaseWeights ? "the released weights" : "the dynamic batch")
+                           << " cannot be reshaped";
+    }
+    std::lock_guard<std::mutex> lock(m_reshapeMutex);
+
+    // the inputs missing in inputShapes keep their current shapes
+    ICNNNetwork::InputShapes shapes;
+    for (auto& input : _networkInputs) {
+        shapes[input.first] = input.second->getTensorDesc().getDims();
+    }
+    for (auto& shape : inputShapes) {
+        auto input = shapes.find(shape.first);
+        if (input == shapes.end()) {
+            THROW_IE_EXCEPTION << NOT_FOUND_str << "The network has no input " << shape.first;
+        }
+        input->second = shape.second;
+    }
+    std::string key = ShapesKey(shapes);
+    if (key == m_currentShapes) {
+        return;
+    }
+
+    ShapeNetworks current = { m_env, m_streamNetworks, m_weights, _networkInputs, _networkOutputs, m_trimmedProgram };
+    auto compiled = m_shapeNetworks.find(key);
+    if (compiled != m_shapeNetworks.end()) {
+        m_env = compiled->second.env;
+        m_streamNetworks = compiled->second.streamNetworks;
+        m_weights = compiled->second.weights;
+        _networkInputs = compiled->second.inputs;
+        _networkOutputs = compiled->second.outputs;
+        m_trimmedProgram = compiled->second.trimmedProgram;
+    } else {
+        ResponseDesc resp;
+        if (m_reshapableNetwork->reshape(shapes, &resp) != OK) {
+            THROW_IE_EXCEPTION << resp.msg;
+        }
+
+        // the topology is built again, the weights store finds the weights uploaded for the current shapes
+        InferenceEnv env;
+        env.engine = m_env.engine;
+        env.executeMutex = m_env.executeMutex;
+        env.exclusiveExecution = m_env.exclusiveExecution;
+        env.devicePriority = m_env.devicePriority;
+        env.debugOptions = m_env.debugOptions;
+        env.m_max_batch = m_env.m_max_batch;
+        env.m_bv_sz = m_env.m_bv_sz;
+        m_env = env;
+        m_weights.clear();
+        m_trimmedProgram.reset();
+        try {
+            m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
+            Load(*m_reshapableNetwork);
+            CompileNetwork();
+            m_topology.reset();
+            m_env.engine->release_pending_memory();
+
+            if (!m_streamNetworks.empty()) {
+                int streams = static_cast<int>(m_streamNetworks.size());
+                m_streamNetworks.clear();
+                CreateStreams(streams);
+            }
+        } catch (...) {
+            m_topology.reset();
+            m_uploads.clear();
+            m_env = current.env;
+            m_streamNetworks = current.streamNetworks;
+            m_weights = current.weights;
+            m_trimmedProgram = current.trimmedProgram;
+            throw;
+        }
+
+        // the inputs and outputs of the requests keep the precision, layout and pre-processing set by the user
+        InputsDataMap inputs;
+        for (auto& input : _networkInputs) {
+            InputInfo::Ptr info(new InputInfo());
+            DataPtr data(new Data(*input.second->getInputData()));
+            data->setDims(m_reshapableNetwork->getInput(input.first)->getTensorDesc().getDims());
+            info->getPreProcess() = input.second->getPreProcess();
+            info->setInputData(data);
+            inputs[input.first] = info;
+        }
+        OutputsDataMap outputs, reshapedOutputs;
+        m_reshapableNetwork->getOutputsInfo(reshapedOutputs);
+        for (auto& output : _networkOutputs) {
+            DataPtr data(new Data(*output.second));
+            data->setDims(reshapedOutputs.at(output.first)->getTensorDesc().getDims());
+            outputs[output.first] = data;
+        }
+        _networkInputs = inputs;
+        _networkOutputs = outputs;
+    }
+    m_shapeNetworks[m_currentShapes] = current;
+    m_currentShapes = key;
+}
+
+void CLDNNGraph::GetMetrics(InferenceEngine::ExecutableNetworkMetrics &metrics) {
+    ExecutableNetworkThreadSafeDefault::GetMetrics(metrics);
+    metrics.streams = static_cast<unsigned int>(std::max<size_t>(m_streamNetworks.size(), 1));
+    metrics.optimalInferRequests = 2 * metrics.streams;
+}
+
+InferenceEngine::Blob::Ptr CLDNNGraph::ConvertBlobToFP16(const InferenceEngine::Blob::Ptr& blob) {
+    auto converted = std::make_shared<InferenceEngine::TBlob<uint16_t>>(Precision::FP16, blob->layout(), blob->dims());
+    converted->allocate();
+    PrecisionUtils::f32tof16Arrays(reinterpret_cast<short *>(converted->buffer().as<uint16_t *>()),
+                                   blob->cbuffer().as<const float *>(), blob->size());
+    return converted;
+}
+
 void CLDNNGraph::CreatePrimitiveFromBlob(cldnn::primitive_id primID,
-                                         const InferenceEngine::Blob::Ptr pBlob,
+                                         const InferenceEngine::Blob::Ptr pSourceBlob,
                                          cldnn::layout blobLayout,
                                          size_t blobByteOffset,
                                          WeightRearrangeType rearrange) {
-    auto mem = cldnn::memory::allocate(*(m_env.engine), blobLayout);
+    if (pSourceBlob == nullptr) {
+        THROW_CLDNN_EXCEPTION("Missing blob data: " << primID);
+    }
+    // the weights are found by their content, the same weights are uploaded once for all the networks of the engine
+    auto key = CLDNNWeightsStore::makeKey(pSourceBlob->cbuffer(), pSourceBlob->byteSize(), blobLayout,
+                                          std::to_string(blobByteOffset) + "_" + std::to_string(rearrange));
+    bool created = false;
+    auto mem = m_weightsStore->findOrCreate(key, [&]() {
+        auto memory = cldnn::memory::allocate(*(m_env.engine), blobLayout);
+        // the memory found by the other graphs of the shared engine is filled before it is stored
+        if (m_env.exclusiveExecution) {
+            LoadPhaseScope phase("weight upload");
+            UploadBlob(memory, primID, pSourceBlob, blobLayout, blobByteOffset, rearrange);
+            return memory;
+        }
+        if (!m_uploadExecutor) {
+            m_uploadExecutor = std::make_shared<WorkStealingTaskExecutor>(0, "CLDNNWeightsUpload");
+        }
+        m_uploads.push_back(std::make_shared<Task>([=]() {
+            UploadBlob(memory, primID, pSourceBlob, blobLayout, blobByteOffset, rearrange);
+        }));
+        m_uploadExecutor->startTask(m_uploads.back());
+        return memory;
+    }, created);
+    if (created) {
+        m_weightsBytes += blobLayout.bytes_count();
+    }
+    m_weights.push_back(mem);
+    m_topology->add(cldnn::data(primID, *mem));
+}
+
+void CLDNNGraph::WaitForUploads() {
+    if (m_uploads.empty()) {
+        return;
+    }
+    // the time the build waits for the weights, the uploads overlapped with the topology build are not counted
+    LoadPhaseScope phase("weight upload");
+    for (auto& upload : m_uploads) {
+        upload->wait(-1);
+    }
+    auto uploads = std::move(m_uploads);
+    m_uploads.clear();
+    m_uploadExecutor.reset();
+    for (auto& upload : uploads) {
+        upload->checkException();
+    }
+}
+
+void CLDNNGraph::UploadBlob(cldnn::memory mem,
+                            const cldnn::primitive_id &primID,
+                            const InferenceEngine::Blob::Ptr &pSourceBlob,
+                            const cldnn::layout &blobLayout,
+                            size_t blobByteOffset,
+                            WeightRearrangeType rearrange) {
+    // the FP32 weights of the network running with fp16 kernels are converted once here
+    auto pBlob = pSourceBlob;
+    if (pBlob != nullptr && pBlob->precision() == Precision::FP32 && blobLayout.data_type == cldnn::data_types::f16) {
+        pBlob = ConvertBlobToFP16(pBlob);
+    }
     auto tmpPointer = mem.pointer<char>();  // implicitly maps buffer - unmap in destructor
     auto buf = tmpPointer.data();
     auto bufSize = blobLayout.bytes_count();
@@ -682,7 +1205,6 @@ void CLDNNGraph::CreatePrimitiveFromBlob(cldnn::primitive_id primID,
             buf[i] = data[i + blobByteOffset];
         }
     }
-    m_topology->add(cldnn::data(primID, mem));
 }
 
 void CLDNNGraph::CreateWeightAndBiasPrimitives(const InferenceEngine::CNNLayerPtr& layer,
@@ -743,9 +1265,34 @@ void CLDNNGraph::CreateWeightAndBiasPrimitives(const InferenceEngine::CNNLayerPt
         break;
     }
 
+    // the int8 convolutions take the weights quantized by the normalizer, the biases quantized along with them
+    // are dequantized by the w-scale, since the kernels add them to the dequantized accumulators
+    cldnn::data_types weightsType = m_networkPrecision;
+    cldnn::data_types biasesType = m_networkPrecision;
+    if (IsInt8Convolution(layer)) {
+        weightsType = cldnn::data_types::i8;
+        biasesType = cldnn::data_types::f32;
+        if (pBiasBlob != nullptr && pBiasBlob->precision() == Precision::I8) {
+            auto wScale = layer->blobs.at("w-scale");
+            if (wScale->size() != pBiasBlob->size()) {
+                THROW_CLDNN_EXCEPTION("Invalid w-scale dimensions in layer " << layer->name);
+            }
+            auto biases = std::make_shared<InferenceEngine::TBlob<float>>(Precision::FP32, Layout::C,
+                                                                          SizeVector{ pBiasBlob->size() });
+            biases->allocate();
+            const int8_t *quantized = pBiasBlob->cbuffer().as<const int8_t *>();
+            const float *scales = wScale->cbuffer().as<const float *>();
+            float *data = biases->buffer().as<float *>();
+            for (size_t c = 0; c < pBiasBlob->size(); c++) {
+                data[c] = quantized[c] * scales[c];
+            }
+            pBiasBlob = biases;
+        }
+    }
+
     // create weights primitive
     cldnn::layout weightsLayout = cldnn::layout(
-        m_networkPrecision,
+        weightsType,
         m_defaultFormat,
         cldnn::tensor(weightDimsVec));
     size_t bytesPerGroup = weightsLayout.bytes_count();
@@ -764,7 +1311,7 @@ void CLDNNGraph::CreateWeightAndBiasPrimitives(const InferenceEngine::CNNLayerPt
     // create bias primitive
     if (pBiasBlob != nullptr) {
         cldnn::layout biasesLayout = cldnn::layout(
-            m_networkPrecision,
+            biasesType,
             m_defaultFormat,
             cldnn::spatial(TensorValue(outFeatures / groupSize)));
         size_t bytesPerGroup = biasesLayout.bytes_count();
@@ -920,7 +1467,7 @@ void CLDNNGraph::CreateSingleLayerPrimitive(InferenceEngine::CNNLayerPtr &layer)
             break;
         case Normalize: CreateNormalizePrimitive(layer);
             break;
-        case Reshape: CreateReshapePrimitive(layer);
+        case ReshapeLayer: CreateReshapePrimitive(layer);
             break;
         case Permute: CreatePermutePrimitive(layer);
             break;
@@ -946,6 +1493,8 @@ void CLDNNGraph::CreateSingleLayerPrimitive(InferenceEngine::CNNLayerPtr &layer)
             break;
         case MVN: CreateMVNPrimitive(layer);
             break;
+        case Gemm: CreateGemmPrimitive(layer);
+            break;
         case RegionYolo: CreateYOLO2RegionPrimitive(layer);
             break;
         case ReorgYolo: CreateYOLO2ReorgPrimitive(layer);
@@ -974,13 +1523,35 @@ void CLDNNGraph::CreateScaleShiftPrimitive(InferenceEngine::CNNLayerPtr &layer)
         break;
     }
 
+    // the ScaleShift inserted by the normalizer before an int8 convolution marks its output as U8,
+    // it quantizes the input of the convolution to the narrowed range of the int8 kernels
+    auto scalesBlob = scaleShiftLayer->_weights;
+    auto shiftsBlob = scaleShiftLayer->_biases;
+    bool quantizesInt8Input = layer->outData[0]->getPrecision() == Precision::U8;
+    auto narrow = [](const InferenceEngine::Blob::Ptr& blob) -> InferenceEngine::Blob::Ptr {
+        if (blob == nullptr || blob->precision() != Precision::FP32)
+            return blob;
+        auto narrowed = std::make_shared<InferenceEngine::TBlob<float>>(Precision::FP32, blob->layout(), blob->dims());
+        narrowed->allocate();
+        const float *src = blob->cbuffer().as<const float *>();
+        float *dst = narrowed->buffer().as<float *>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            dst[i] = src[i] * int8InputNarrowing;
+        }
+        return narrowed;
+    };
+    if (quantizesInt8Input) {
+        scalesBlob = narrow(scalesBlob);
+        shiftsBlob = narrow(shiftsBlob);
+    }
+
     cldnn::layout blobLayout(m_networkPrecision, m_defaultFormat, weightTensor);
-    CreatePrimitiveFromBlob(scalePrimID, scaleShiftLayer->_weights, blobLayout);
-    if (scaleShiftLayer->_biases != nullptr) {
-        if (scaleShiftLayer->_biases->dims() != dims) {
+    CreatePrimitiveFromBlob(scalePrimID, scalesBlob, blobLayout);
+    if (shiftsBlob != nullptr) {
+        if (shiftsBlob->dims() != dims) {
             THROW_CLDNN_EXCEPTION("Invalid bias blob dimensions in layer " << layer->name);
         }
-        CreatePrimitiveFromBlob(biasPrimID, scaleShiftLayer->_biases, blobLayout);
+        CreatePrimitiveFromBlob(biasPrimID, shiftsBlob, blobLayout);
     } else {
         biasPrimID = "";  // 0-bias
     }
@@ -1523,7 +2094,7 @@ void CLDNNGraph::CreateCustomLayerPrimitive(InferenceEngine::CNNLayerPtr & layer
                         reorderPrimName,
                         inputPrimitives[param.portIndex],
                         param.format,
-                        DataTypeFromPrecision(layer->precision));
+                        InternalDataType(layer->precision));
                     m_topology->add(preprocessPrim);
                     m_env.profilingIDs.insert(reorderPrimName);
                     InitProfileInfo(reorderPrimName, "Reorder", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
@@ -1553,7 +2124,9 @@ void CLDNNGraph::CreateCustomLayerPrimitive(InferenceEngine::CNNLayerPtr & layer
             THROW_CLDNN_EXCEPTION("Invalid custom layer param type: " << param.type << " in layer: " << genericLayer->name);
         }
     }
-    const std::string layerTitle("\n// Layer " + layer->name + " using Custom Layer " + customLayer->Name() + "\n");
+    // the source does not depend on the name of the layer, so the layers of the same custom kernel, parameters and
+    // shapes share one compiled program in the kernels cache of the engine and in KEY_CLDNN_KERNEL_CACHE_DIR
+    const std::string layerTitle("\n// Custom Layer " + customLayer->Name() + "\n");
     const std::string defineTitle("// Custom Layer User Defines\n");
 
     auto dims = genericLayer->outData[0]->dims;
@@ -1565,7 +2138,7 @@ void CLDNNGraph::CreateCustomLayerPrimitive(InferenceEngine::CNNLayerPtr & layer
     size_t W = (dims.size() > 3) ? dims[3] : 1;
     cldnn::tensor outputTensor = cldnn::tensor(cldnn::batch(N), cldnn::feature(C), cldnn::spatial(W, H));
 
-    cldnn::layout outputLayout = cldnn::layout(DataTypeFromPrecision(genericLayer->precision), outputFormat, outputTensor);
+    cldnn::layout outputLayout = cldnn::layout(InternalDataType(genericLayer->precision), outputFormat, outputTensor);
 
     // evaluate work sizes rules
     std::vector<size_t> gws, lws;
@@ -1906,14 +2479,14 @@ void CLDNNGraph::CreatePowerPrimitive(InferenceEngine::CNNLayerPtr &layer) {
         // create scale primitive
         auto scaleValuePrimName = powerLayer->name + m_scalesTag;
         AddSingleValuePrimitive(scaleValuePrimName,
-            DataTypeFromPrecision(powerLayer->precision),
+            InternalDataType(powerLayer->precision),
             powerLayer->scale);
 
         cldnn::primitive_id biasValuePrimName = "";
         if (powerLayer->offset != 0.0f) {
             biasValuePrimName = powerLayer->name + m_biasesTag;
             AddSingleValuePrimitive(biasValuePrimName,
-                DataTypeFromPrecision(powerLayer->precision),
+                InternalDataType(powerLayer->precision),
                 powerLayer->offset);
         }
         auto scalePrim = cldnn::scale(
@@ -2011,6 +2584,7 @@ void CLDNNGraph::CreateFullyConnectedPrimitive(InferenceEngine::CNNLayerPtr &lay
 
 void CLDNNGraph::CreatePoolingPrimitive(InferenceEngine::CNNLayerPtr &layer) {
     ValidateLayer(layer, 1);
+    ValidateSpatialRank(layer);
     auto inputPrimitives = GetPrevLayersPrimitives(layer);
     auto poolLayer = dynamic_cast<InferenceEngine::PoolingLayer *> (layer.get());
 
@@ -2408,6 +2982,55 @@ void CLDNNGraph::CreateMVNPrimitive(InferenceEngine::CNNLayerPtr &layer) {
     m_env.profilingIDs.insert(MvnLayer->name);
 }
 
+// the matrices of the gemm are the y and x of the clDNN tensor, the dimensions outside of them are its b and f
+static cldnn::tensor GemmTensorFromIEDims(const InferenceEngine::CNNLayerPtr& layer, const InferenceEngine::SizeVector& dims) {
+    size_t rank = dims.size();
+    if (rank < 2 || rank > 4) {
+        THROW_CLDNN_EXCEPTION("Gemm of the " << rank << "D tensors is not supported by the GPU plugin, layer: " << layer->name);
+    }
+    return cldnn::tensor(TensorValue(rank > 3 ? dims[rank - 4] : 1),
+                         TensorValue(rank > 2 ? dims[rank - 3] : 1),
+                         TensorValue(dims[rank - 1]),
+                         TensorValue(dims[rank - 2]));
+}
+
+void CLDNNGraph::CreateGemmPrimitive(InferenceEngine::CNNLayerPtr &layer) {
+    ValidateLayer(layer, 0);
+    if (layer->insData.size() != 2 && layer->insData.size() != 3) {
+        THROW_CLDNN_EXCEPTION("Invalid number of inputs for layer: " << layer->name);
+    }
+    auto inputPrimitives = GetPrevLayersPrimitives(layer);
+    auto gemmLayer = dynamic_cast<InferenceEngine::GemmLayer*> (layer.get());
+
+    // CldnnTensorFromIEDims puts the matrices of the 2D and 3D tensors to f and y, they are reshaped to y and x
+    for (size_t i = 0; i < inputPrimitives.size(); i++) {
+        auto inputDims = layer->insData[i].lock()->getTensorDesc().getDims();
+        if (inputDims.size() != 4) {
+            cldnn::primitive_id reshapeID = gemmLayer->name + "_input" + std::to_string(i) + m_workaroundTag;
+            m_topology->add(cldnn::reshape(reshapeID, inputPrimitives[i], GemmTensorFromIEDims(layer, inputDims)));
+            inputPrimitives[i] = reshapeID;
+        }
+    }
+
+    auto outputDims = gemmLayer->outData[0]->getTensorDesc().getDims();
+    cldnn::primitive_id gemmID = outputDims.size() != 4 ? gemmLayer->name + m_workaroundTag : gemmLayer->name;
+
+    auto gemmPrim = cldnn::gemm(
+        gemmID,
+        inputPrimitives,
+        gemmLayer->transpose_a,
+        gemmLayer->transpose_b,
+        gemmLayer->alpha,
+        gemmLayer->beta);
+    m_topology->add(gemmPrim);
+
+    if (gemmID != gemmLayer->name) {
+        m_topology->add(cldnn::reshape(gemmLayer->name, gemmID, CldnnTensorFromIEDims(gemmLayer->outData[0]->dims)));
+        m_env.profilingIDs.insert(gemmID);
+    }
+    m_env.primitiveIDs[gemmLayer->name] = gemmLayer->name;
+    m_env.profilingIDs.insert(gemmLayer->name);
+}
 
 void CLDNNGraph::AddConstantBlobInput(InferenceEngine::CNNLayerPtr &layer) {
     auto constBlob = layer->blobs.begin()->second;
@@ -2428,14 +3051,18 @@ void CLDNNGraph::AddConstantBlobInput(InferenceEngine::CNNLayerPtr &layer) {
     }
 
     cldnn::layout constLayout = cldnn::layout(
-        DataTypeFromPrecision(layer->blobs.begin()->second->precision()),
+        InternalDataType(constBlob->precision()),
         m_defaultFormat,
         constTensor);
+    if (constBlob->precision() == Precision::FP32 && constLayout.data_type == cldnn::data_types::f16) {
+        constBlob = ConvertBlobToFP16(constBlob);
+    }
 
     size_t bytes = constLayout.bytes_count();
     cldnn::primitive_id constPrimID = layer->name;
 
     auto mem = cldnn::memory::allocate(*(m_env.engine), constLayout);
+    m_weightsBytes += bytes;
     auto tmpPointer = mem.pointer<char>();  // implicitly maps buffer - unmap in destructor
     auto buf = tmpPointer.data();
 
@@ -2456,6 +3083,11 @@ void CLDNNGraph::AddConstantBlobInput(InferenceEngine::CNNLayerPtr &layer) {
 
 void CLDNNGraph::CreateConvolutionPrimitive(InferenceEngine::CNNLayerPtr &layer) {
     ValidateLayer(layer, 1);
+    ValidateSpatialRank(layer);
+    if (IsInt8Convolution(layer)) {
+        CreateInt8ConvolutionPrimitive(layer);
+        return;
+    }
     auto inputPrimitives = GetPrevLayersPrimitives(layer);
     auto convLayer = dynamic_cast<InferenceEngine::ConvolutionLayer *> (layer.get());
 
@@ -2486,6 +3118,93 @@ void CLDNNGraph::CreateConvolutionPrimitive(InferenceEngine::CNNLayerPtr &layer)
     m_env.profilingIDs.insert(convLayer->name);
 }
 
+bool CLDNNGraph::IsInt8Convolution(const InferenceEngine::CNNLayerPtr& layer) {
+    return LayerTypeFromStr(layer->type) == Convolution &&
+           layer->precision == Precision::I8 &&
+           layer->blobs.find("w-scale") != layer->blobs.end() &&
+           layer->blobs.find("o-scale") != layer->blobs.end();
+}
+
+/**
+ *  The int8 convolution of a calibrated IR runs with the MMAD kernels of clDNN:
+ *      input (narrowed by the ScaleShift) -> quantize reorder (i8) -> convolution (i8) -> dequantize reorder
+ *  The i8 weights come with the w-scale per output channel, the accumulators are dequantized by w-scale and by
+ *  the input quantization factor, which widens the narrowed input back. The results are calibrated per output
+ *  channel to the i8 range of the o-scale and dequantize to the values the normalizer produces, the ScaleShift
+ *  after the convolution (and the activation) brings them back to the range of the fp32 network.
+ */
+void CLDNNGraph::CreateInt8ConvolutionPrimitive(InferenceEngine::CNNLayerPtr &layer) {
+    auto inputPrimitives = GetPrevLayersPrimitives(layer);
+    auto convLayer = dynamic_cast<InferenceEngine::ConvolutionLayer *> (layer.get());
+
+    std::vector<cldnn::primitive_id> weightPrimID;
+    std::vector<cldnn::primitive_id> biasPrimID;
+    CreateWeightAndBiasPrimitives(layer, weightPrimID, biasPrimID);
+
+    auto wScale = layer->blobs.at("w-scale");
+    auto oScale = layer->blobs.at("o-scale");
+    size_t outFeatures = convLayer->_out_depth;
+    if (wScale->size() != outFeatures || oScale->size() != outFeatures) {
+        THROW_CLDNN_EXCEPTION("Invalid w-scale or o-scale dimensions in layer " << layer->name);
+    }
+
+    auto calibration = std::make_shared<InferenceEngine::TBlob<float>>(Precision::FP32, Layout::C,
+                                                                       SizeVector{ outFeatures });
+    calibration->allocate();
+    const float *oScaleData = oScale->cbuffer().as<const float *>();
+    float *calibrationData = calibration->buffer().as<float *>();
+    for (size_t c = 0; c < outFeatures; c++) {
+        calibrationData[c] = oScaleData[c] != 0.0f ? 1.0f / oScaleData[c] : 0.0f;
+    }
+
+    // the factors per output channel, split by groups as the weights
+    std::vector<cldnn::primitive_id> weightsQFPrimID;
+    std::vector<cldnn::primitive_id> calibrationPrimID;
+    unsigned groupSize = convLayer->_group;
+    cldnn::layout factorsLayout(cldnn::data_types::f32, m_defaultFormat,
+                                cldnn::spatial(TensorValue(outFeatures / groupSize)));
+    for (unsigned g = 0; g < groupSize; g++) {
+        cldnn::primitive_id weightsQFID = layer->name + m_weightsQFTag + std::to_string(g);
+        cldnn::primitive_id calibrationID = layer->name + m_calibrationTag + std::to_string(g);
+        CreatePrimitiveFromBlob(weightsQFID, wScale, factorsLayout, g * factorsLayout.bytes_count());
+        CreatePrimitiveFromBlob(calibrationID, calibration, factorsLayout, g * factorsLayout.bytes_count());
+        weightsQFPrimID.push_back(weightsQFID);
+        calibrationPrimID.push_back(calibrationID);
+    }
+
+    cldnn::primitive_id quantizePrimID = layer->name + m_quantizeTag;
+    m_topology->add(cldnn::reorder(quantizePrimID, inputPrimitives[0], m_defaultFormat, cldnn::data_types::i8));
+    m_env.profilingIDs.insert(quantizePrimID);
+    InitProfileInfo(quantizePrimID, "Reorder", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
+
+    cldnn::tensor stride = cldnn::tensor(cldnn::batch(1), cldnn::feature(1),
+                                         cldnn::spatial(convLayer->_stride_x, convLayer->_stride_y));
+    cldnn::tensor padding = cldnn::tensor(cldnn::batch(0), cldnn::feature(0),
+                                          cldnn::spatial(-convLayer->_padding_x, -convLayer->_padding_y));
+    cldnn::tensor dilation = cldnn::tensor(cldnn::batch(1), cldnn::feature(1),
+                                           cldnn::spatial(convLayer->_dilation_x, convLayer->_dilation_y));
+
+    auto convPrim = cldnn::convolution(convLayer->name,
+                                       quantizePrimID,
+                                       weightPrimID,
+                                       biasPrimID,
+                                       weightsQFPrimID,
+                                       calibrationPrimID,
+                                       1.0f / int8InputNarrowing,
+                                       stride,
+                                       padding,
+                                       dilation);
+    m_topology->add(convPrim);
+    m_env.profilingIDs.insert(convLayer->name);
+
+    cldnn::primitive_id dequantizePrimID = layer->name + m_dequantizeTag;
+    m_topology->add(cldnn::reorder(dequantizePrimID, convLayer->name, m_defaultFormat, m_networkPrecision));
+    m_env.profilingIDs.insert(dequantizePrimID);
+    InitProfileInfo(dequantizePrimID, "Reorder", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
+
+    m_env.primitiveIDs[convLayer->name] = dequantizePrimID;
+}
+
 bool CLDNNGraph::IsValidSplitConvMerge(const InferenceEngine::SplitLayer *splitLayer) const {
     if (splitLayer->outData.size() != 2) return false;  // split into 2
     auto convLayer1 =
@@ -2710,6 +3429,7 @@ void CLDNNGraph::AddOutputPrimitive(std::string outputName, const InferenceEngin
 void CLDNNGraph::AddSingleValuePrimitive(cldnn::primitive_id valPrimID, cldnn::data_types dataType, float value) {
     cldnn::layout primLayout(dataType, m_defaultFormat, { 1, 1, 1, 1 });
     auto primMem = cldnn::memory::allocate(*(m_env.engine), primLayout);
+    m_weightsBytes += primLayout.bytes_count();
     switch (dataType) {
     case cldnn::data_types::f32:
     {
@@ -2734,6 +3454,14 @@ void CLDNNGraph::AddSingleValuePrimitive(cldnn::primitive_id valPrimID, cldnn::d
     m_topology->add(cldnn::data(valPrimID, primMem));
 }
 
+cldnn::data_types CLDNNGraph::InternalDataType(InferenceEngine::Precision p) const {
+    auto dataType = DataTypeFromPrecision(p);
+    if (m_config.fp16Inference && dataType == cldnn::data_types::f32) {
+        return cldnn::data_types::f16;
+    }
+    return dataType;
+}
+
 cldnn::data_types CLDNNGraph::DataTypeFromPrecision(InferenceEngine::Precision p) {
     switch (p) {
     case Precision::I16:
@@ -2824,7 +3552,7 @@ void CLDNNGraph::CreateGenericLayerBlobPrimitives(const InferenceEngine::Generic
             layer->name + "_" + blob.first + m_weightsTag,
             blob.second,
             cldnn::layout(
-                DataTypeFromPrecision(blob.second->precision()),
+                InternalDataType(blob.second->precision()),
                 m_defaultFormat, cldnn::spatial(TensorValue(blob.second->dims()[0]))));
     }
 }
@@ -2857,7 +3585,32 @@ CLDNNGraph::CreateInferRequestImpl(InputsDataMap networkInputs, OutputsDataMap n
     if (m_env.network == nullptr) {
         THROW_IE_EXCEPTION << NETWORK_NOT_LOADED_str;
     }
-    return std::make_shared<CLDNNInferRequest>(m_env, m_config.useProfiling, networkInputs, networkOutputs);
+    return std::make_shared<CLDNNInferRequest>(m_env, m_config.useProfiling, networkInputs, networkOutputs,
+                                               m_config.profilingSample);
+}
+
+void CLDNNGraph::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
+    std::lock_guard<std::mutex> lock(m_reshapeMutex);
+    RestoreNetworks(m_env, m_streamNetworks, m_trimmedProgram);
+    if (m_streamNetworks.empty()) {
+        ExecutableNetworkThreadSafeDefault::CreateInferRequest(asyncRequest);
+        return;
+    }
+
+    // the requests are spread over the streams round-robin, the requests of a stream are executed by its executor
+    size_t stream = m_nextStream++ % m_streamNetworks.size();
+    InferenceEnv env = m_env;
+    env.network = m_streamNetworks[stream];
+    auto syncRequestImpl = std::make_shared<CLDNNInferRequest>(env, m_config.useProfiling, _networkInputs, _networkOutputs,
+                                                               m_config.profilingSample);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<AsyncInferRequestThreadSafeDefault>(
+            syncRequestImpl, m_streamExecutors[stream], _taskSynchronizer, _callbackExecutor);
+    asyncTreadSafeImpl->SetPriority(_requestPriority);
+    asyncRequest.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncTreadSafeImpl),
+                       [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+    registerRequest(asyncRequest, asyncTreadSafeImpl);
 }
 
 void CLDNNGraph::InitProfileInfo(const std::string& layerName,
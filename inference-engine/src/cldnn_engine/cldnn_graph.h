@@ -9,6 +9,8 @@
 #include <map>
 #include <set>
 #include <memory>
+#include <mutex>
+#include <atomic>
 #include <string>
 #include "ie_blob.h"
 #include "ie_plugin.hpp"
@@ -25,8 +27,13 @@
 #include <CPP/detection_output.hpp>
 #include <CPP/softmax.hpp>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/ie_work_stealing_task_executor.hpp>
 #include <CPP/upsampling.hpp>
 #include "cldnn_custom_layer.h"
+#include "cldnn_tuner.h"
+#include "cldnn_scheduler.h"
+#include "cldnn_weights_store.h"
+#include "cnn_network_impl.hpp"
 
 namespace CLDNNPlugin {
 
@@ -45,8 +52,27 @@ struct InferenceEnv {
     std::map<cldnn::primitive_id, cldnn::memory> constBlobs;
 
     std::vector<std::shared_ptr<cldnn::network>> batchNetworks;
+    // the networks of the streams share the queue of the engine, so their kernels are enqueued one network at a time
+    std::shared_ptr<std::mutex> executeMutex;
+    // the networks sharing the memory pool of the engine (see KEY_CLDNN_SHARED_MEM_POOL) reuse the intermediate
+    // buffers of each other, so the lock is held until the outputs of the network are ready
+    bool exclusiveExecution = false;
+    // the priority of the inferences in CLDNNDeviceScheduler
+    int devicePriority = 0;
     int m_max_batch;
     int m_bv_sz;
+    // the network of the max batch runs the smaller batches scaling its work sizes, batchNetworks is empty then
+    bool runtimeBatch = false;
+};
+
+/**
+ * @brief The engine of the networks loaded with KEY_CLDNN_SHARED_MEM_POOL, created by the first of them
+ */
+struct CLDNNSharedEngine {
+    typedef std::shared_ptr<CLDNNSharedEngine> Ptr;
+    std::shared_ptr<const cldnn::engine> engine;
+    std::shared_ptr<std::mutex> executeMutex;
+    CLDNNWeightsStore::Ptr weights;
 };
 
 class CLDNNGraph : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
@@ -55,9 +81,23 @@ public:
     struct Config {
         Config() : useProfiling(false), dumpCustomKernels(false), exclusiveAsyncRequests(false),
             memory_pool_on(false),
+            sharedMemoryPool(false),
+            outOfOrderQueue(true),
+            fp16Inference(false),
+            backgroundTuning(true),
+            throughputStreams(1),
+            compilationThreads(0),
+            traceWindow(0),
+            requestPriority(0),
+            preemptionSlice(0),
+            profilingSample(0),
+            callbackThreads(1),
+            releaseWeights(false),
             enableDynamicBatch(false),
             queuePriority(cldnn::priority_mode_types::disabled),
-            queueThrottle(cldnn::throttle_mode_types::disabled) {}
+            queueThrottle(cldnn::throttle_mode_types::disabled),
+            sharedContext(nullptr),
+            sharedQueue(nullptr) {}
 
         void LoadFromMap(const std::map<std::string, std::string>& configMap);
 
@@ -66,18 +106,56 @@ public:
         bool dumpCustomKernels;
         bool exclusiveAsyncRequests;
         bool memory_pool_on;
+        bool sharedMemoryPool;
+        bool outOfOrderQueue;
+        bool fp16Inference;  // the FP32 network runs with fp16 kernels and weights
+        bool backgroundTuning;  // the kernels missing in the tuning cache are tuned after the loading
+        int throughputStreams;
+        int compilationThreads;  // 0 means the number of the host cores
+        int traceWindow;  // milliseconds, 0 records until the trace is stopped
+        int requestPriority;  // the priority of the async requests in the shared executor
+        int preemptionSlice;  // the primitives executed between the waits for the networks of a higher queue priority
+        int profilingSample;  // 1 of profilingSample inferences is profiled, 0 profiles all of them with useProfiling
+        int callbackThreads;  // 0 runs the completion callbacks inline on the inference threads
+        bool releaseWeights;  // the weights of the network are dropped once they are uploaded
         cldnn::priority_mode_types queuePriority;
         cldnn::throttle_mode_types queueThrottle;
+        void *sharedContext;  // cl_context of the application, nullptr creates a new one
+        void *sharedQueue;  // cl_command_queue of sharedContext, nullptr creates a new one
         CLDNNCustomLayerMap customLayers;
         cldnn::tuning_config_options tuningConfig;
         std::string graph_dumps_dir;
         std::string sources_dumps_dir;
+        std::string kernels_cache_dir;
+        std::string traceFile;
     };
-    explicit CLDNNGraph(InferenceEngine::ICNNNetwork &network, const Config& config = {}, int max_batch = -1);
+    explicit CLDNNGraph(InferenceEngine::ICNNNetwork &network, const Config& config = {}, int max_batch = -1,
+                        const CLDNNSharedEngine::Ptr &sharedEngine = nullptr);
 
     InferenceEngine::InferRequestInternal::Ptr
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs) override;
 
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
+
+    /**
+     * @brief Returns the memory of the network, the usage of the device memory is reported by the engine:
+     * the workspace and the peak include the inputs of the requests and, with KEY_CLDNN_SHARED_MEM_POOL,
+     * the memory of the other networks sharing the engine
+     */
+    void GetMemoryFootprint(InferenceEngine::MemoryFootprint &footprint) override;
+
+    /**
+     * @brief Reports two requests per stream: one runs on the device while the next one is enqueued
+     */
+    void GetMetrics(InferenceEngine::ExecutableNetworkMetrics &metrics) override;
+
+    /**
+     * @brief Switches to the networks compiled for the new shapes of the inputs: the copy of the loaded network is
+     * reshaped and compiled again on the same engine, the weights already on the device are reused. The networks
+     * of every set of the shapes are kept, so switching back to the shapes used before compiles nothing
+     */
+    void Reshape(const InferenceEngine::ICNNNetwork::InputShapes &inputShapes) override;
+
     static bool IsLayerSupported(const std::string &type) {
         return LayerTypeFromStr(type) != NO_TYPE;
     }
@@ -88,6 +166,46 @@ protected:
     InferenceEnv m_env;
     Config m_config;
 
+    // one network and executor per stream (see KEY_GPU_THROUGHPUT_STREAMS), empty for a single stream
+    std::vector<std::shared_ptr<cldnn::network>> m_streamNetworks;
+    std::vector<InferenceEngine::ITaskExecutor::Ptr> m_streamExecutors;
+    std::atomic<unsigned int> m_nextStream;
+
+    // memory of the weights and biases filled once and shared by the networks of all the batch sizes
+    // (dynamic batch) and by the other graphs of the shared engine
+    CLDNNWeightsStore::Ptr m_weightsStore;
+    std::vector<CLDNNWeightsStore::MemoryPtr> m_weights;
+    // the weights are converted and copied to the device memory by the pool while the topology is built,
+    // the program is built once all of them are uploaded
+    std::shared_ptr<InferenceEngine::WorkStealingTaskExecutor> m_uploadExecutor;
+    std::vector<InferenceEngine::Task::Ptr> m_uploads;
+    // the size of the weights, biases and constants allocated on the device by the graph, the weights shared
+    // with the graphs loaded before are counted by them
+    size_t m_weightsBytes = 0;
+    // the background tuning of the compiled networks (see CLDNNBackgroundTuner), dropped with the graph if it did not
+    // start yet
+    std::string m_networkName;
+    std::vector<std::shared_ptr<CLDNNBackgroundTuner::Job>> m_tuningJobs;
+
+    // the networks compiled for a set of the shapes of the inputs, see Reshape
+    struct ShapeNetworks {
+        InferenceEnv env;
+        std::vector<std::shared_ptr<cldnn::network>> streamNetworks;
+        std::vector<CLDNNWeightsStore::MemoryPtr> weights;
+        InferenceEngine::InputsDataMap inputs;
+        InferenceEngine::OutputsDataMap outputs;
+        std::shared_ptr<cldnn::program> trimmedProgram;
+    };
+    // the copy of the loaded network sharing its weights, empty if the network cannot be reshaped (the dynamic
+    // batch or the released weights)
+    InferenceEngine::details::CNNNetworkImplPtr m_reshapableNetwork;
+    std::map<std::string, ShapeNetworks> m_shapeNetworks;
+    std::string m_currentShapes;
+    // the requests are created with the networks of the current shapes
+    std::mutex m_reshapeMutex;
+    // the program of the networks of the current shapes released by Trim, they are created again for the next request
+    std::shared_ptr<cldnn::program> m_trimmedProgram;
+
     InferenceEngine::InputsDataMap*  p_currentInputs;
     InferenceEngine::OutputsDataMap* p_currentOutputs;
     int m_curBatch;
@@ -100,6 +218,10 @@ protected:
     static const cldnn::primitive_id m_workaroundTag;
     static const cldnn::primitive_id m_preCustomLayerTag;
     static const cldnn::primitive_id m_postCustomLayerTag;
+    static const cldnn::primitive_id m_quantizeTag;
+    static const cldnn::primitive_id m_dequantizeTag;
+    static const cldnn::primitive_id m_weightsQFTag;
+    static const cldnn::primitive_id m_calibrationTag;
 
     // internal types
     enum LayerType {
@@ -125,7 +247,7 @@ protected:
         PriorBox,
         DetectionOutput,
         Normalize,
-        Reshape,
+        ReshapeLayer,  // Reshape is the method of the executable network
         Permute,
         Flatten,
         BatchNormalization,
@@ -143,6 +265,7 @@ protected:
         ArgMax,
         MVN,
         Unpooling,
+        Gemm,
         NO_TYPE
     };
 
@@ -157,21 +280,49 @@ protected:
     void InitFormat(InferenceEngine::ICNNNetwork &network);
 
     static cldnn::data_types DataTypeFromPrecision(InferenceEngine::Precision p);
+    cldnn::data_types InternalDataType(InferenceEngine::Precision p) const;
     static cldnn::format     FormatFromLayout(InferenceEngine::Layout l);
     static cldnn::upsampling_sample_type UpsamplingTypeFromString(const std::string& str);
 
     void Load(InferenceEngine::ICNNNetwork &network);
+    void CreateStreams(int streams);
+    static std::string ShapesKey(const InferenceEngine::ICNNNetwork::InputShapes &shapes);
+    void SetPreemption(cldnn::network &network) const;
+
+    /**
+     * @brief Releases the networks no request was created with (the dynamic batch ones are kept), the program they
+     * were created from is kept to create them again
+     * @return true if the networks are released
+     */
+    bool ReleaseNetworks(InferenceEnv &env, std::vector<std::shared_ptr<cldnn::network>> &streamNetworks,
+                         std::shared_ptr<cldnn::program> &program);
+    void RestoreNetworks(InferenceEnv &env, std::vector<std::shared_ptr<cldnn::network>> &streamNetworks,
+                         std::shared_ptr<cldnn::program> &program);
+
+    /**
+     * @brief Releases the networks of all the shapes the requests do not use and the memory pending in the engine,
+     * with releaseWeights the networks of the other shapes are dropped together with their weights
+     */
+    void TrimImpl(bool releaseWeights) override;
     static LayerType LayerTypeFromStr(const std::string& str);
     static cldnn::pooling_mode PoolingModeFromIEPooling(InferenceEngine::PoolingLayer::PoolType pt, bool excludePadding = false);
     static cldnn::eltwise_mode EltwiseModeFromIEEltwise(InferenceEngine::EltwiseLayer::eOperation op);
     static cldnn::concatenation::concatenation_axis ConcatAxisFromIEAxis(unsigned axis);
     static cldnn::prior_box_code_type PriorBoxCodeFromString(const std::string& str);
     static cldnn::softmax::dimension_t SoftmaxDimensionFromIEAxis(const InferenceEngine::SoftMaxLayer* softmaxLayer, bool isPrevFC = false);
+    static InferenceEngine::Blob::Ptr ConvertBlobToFP16(const InferenceEngine::Blob::Ptr& blob);
     void CreatePrimitiveFromBlob(cldnn::primitive_id primID,
                                  const InferenceEngine::Blob::Ptr pBlob,
                                  cldnn::layout blobLayout,
                                  size_t blobByteOffset = 0,
                                  WeightRearrangeType rearrange = NO_REARRANGE);
+    static void UploadBlob(cldnn::memory mem,
+                           const cldnn::primitive_id &primID,
+                           const InferenceEngine::Blob::Ptr &pSourceBlob,
+                           const cldnn::layout &blobLayout,
+                           size_t blobByteOffset,
+                           WeightRearrangeType rearrange);
+    void WaitForUploads();
     void CreateWeightAndBiasPrimitives(const InferenceEngine::CNNLayerPtr& layer,
                                        std::vector<cldnn::primitive_id>& weightsPrimID,
                                        std::vector<cldnn::primitive_id>& biasesPrimID);
@@ -184,6 +335,7 @@ protected:
                             InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::UNSPECIFIED);
     void CreateSingleLayerPrimitive(InferenceEngine::CNNLayerPtr& layer);
     bool IsValidSplitConvMerge(const InferenceEngine::SplitLayer* splitLayer) const;
+    static bool IsInt8Convolution(const InferenceEngine::CNNLayerPtr& layer);
     bool CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const;
     static std::vector<InferenceEngine::CNNLayerPtr> GetNextLayers(const InferenceEngine::DataPtr data);
     static std::vector<InferenceEngine::CNNLayerPtr> GetNextLayers(const InferenceEngine::CNNLayerPtr layer);
@@ -231,6 +383,7 @@ protected:
     void CreateLRNPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreateActivationPrimitive(InferenceEngine::CNNLayerPtr &layer, const LayerType type);
     void CreateConvolutionPrimitive(InferenceEngine::CNNLayerPtr &layer);
+    void CreateInt8ConvolutionPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreateScaleShiftPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreateProposalPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreatePSROIPoolingPrimitive(InferenceEngine::CNNLayerPtr &layer);
@@ -242,6 +395,7 @@ protected:
     void CreateArgMaxPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreateMaxUnpoolingPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreateMVNPrimitive(InferenceEngine::CNNLayerPtr &layer);
+    void CreateGemmPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void AddConstantBlobInput(InferenceEngine::CNNLayerPtr &layer);
     void CreateCustomLayerPrimitive(InferenceEngine::CNNLayerPtr &layer, CLDNNCustomLayerPtr customLayer);
 };
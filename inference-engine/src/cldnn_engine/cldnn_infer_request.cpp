@@ -7,8 +7,12 @@
 #include <string>
 #include <map>
 #include <functional>
+#include <chrono>
+#include <utility>
+#include <vector>
 #include <CPP/detection_output.hpp>  // todo: find a way to remove this
 #include <description_buffer.hpp>
+#include <ie_trace.hpp>
 #include "cldnn_infer_request.h"
 
 using namespace InferenceEngine;
@@ -181,7 +185,9 @@ void CLDNNInferRequest::AllocateInputs() {
         Precision ip = ni->getInputPrecision();
         Layout l = TensorDesc::getLayoutByDims(sz);
 
-        cldnn::memory inputMem = cldnn::memory::allocate(*(m_env.engine), layout);
+        // the discrete device copies the input from the pinned host memory without waiting for the copy, the
+        // integrated one reads the memory of the engine in place
+        cldnn::memory inputMem = cldnn::memory::allocate_host(*(m_env.engine), layout);
         cldnn::pointer<uint8_t> mem_ptr = inputMem.pointer<uint8_t>();
 
         inputsMemory.insert({ name, inputMem });
@@ -259,6 +265,12 @@ void CLDNNInferRequest::AllocateOutputs() {
         }
 
         cldnn::memory output_mem = m_env.network->get_output_memory(outputID);
+        if (!m_env.engine->get_info().host_unified_memory) {
+            // the outputs of the discrete device are read to the pinned host memory of the request, the memory
+            // of the device is not accessible to the host
+            output_mem = cldnn::memory::allocate_host(*(m_env.engine), output_mem.get_layout());
+            outputsStaging.insert({ no.first, output_mem });
+        }
         cldnn::pointer<uint8_t> output_mem_ptr = output_mem.pointer<uint8_t>();
         if (output_mem_ptr.data() == nullptr) {
             THROW_IE_EXCEPTION << "Empty output memory for primitive " << outputID;
@@ -372,11 +384,13 @@ void CLDNNInferRequest::SetBatch(int new_batch) {
 }
 
 CLDNNInferRequest::CLDNNInferRequest(InferenceEnv env, bool useProfiling,
-                                     InputsDataMap networkInputs, OutputsDataMap networkOutputs)
+                                     InputsDataMap networkInputs, OutputsDataMap networkOutputs,
+                                     int profilingSample)
         : InferRequestInternal(networkInputs, networkOutputs),
           m_curBatch(-1),
           m_env(env),
-          m_useProfiling(useProfiling) {
+          m_useProfiling(useProfiling),
+          m_profilingSample(useProfiling ? 0 : profilingSample) {
     if (m_env.m_max_batch > 1) {
         AllocateInputsDyn();
         AllocateOutputsDyn();
@@ -386,7 +400,7 @@ CLDNNInferRequest::CLDNNInferRequest(InferenceEnv env, bool useProfiling,
     }
 
     // Fill implementations map
-    if (m_useProfiling) {
+    if (m_useProfiling || m_profilingSample > 0) {
         auto extractImplementationFromInfo = [](const std::string& info) -> std::string {
             std::string def_implementation = "undef";
             std::string impl_section = "implementation :";
@@ -428,7 +442,20 @@ CLDNNInferRequest::CLDNNInferRequest(InferenceEnv env, bool useProfiling,
 }
 
 void CLDNNInferRequest::execAndParse() {
-    auto networkOutputs = m_env.network->execute();
+    std::map<cldnn::primitive_id, cldnn::network_output> networkOutputs;
+    // the inference is running until the outputs are read, the networks of a lower priority wait for it
+    CLDNNDeviceScheduler::Inference deviceInference(m_env.devicePriority);
+    std::unique_lock<std::mutex> lock(*m_env.executeMutex);
+    auto enqueueBegin = std::chrono::steady_clock::now();
+    networkOutputs = m_env.network->execute();
+    if (m_profilingSample > 0) {
+        auto enqueue = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - enqueueBegin).count();
+        m_enqueueTimes.add(enqueue, enqueue);
+    }
+    if (!m_env.exclusiveExecution) {
+        lock.unlock();
+    }
 
     // Collect outputs as requested by the model
     for (auto& no : _networkOutputs) {
@@ -436,6 +463,13 @@ void CLDNNInferRequest::execAndParse() {
         auto outputMemory = networkOutputs.at(outputID).get_memory();
         Blob::Ptr bptr = _outputs[no.first];
 
+        auto staging = outputsStaging.find(no.first);
+        if (staging != outputsStaging.end() && !outputMemory.get_layout().data_padding) {
+            // the DMA transfer to the pinned memory, the padded output is copied element by element below
+            outputMemory.copy_to(staging->second);
+            outputMemory = staging->second;
+        }
+
         auto out_ptr = outputMemory.pointer<uint8_t>();
         auto blob_ptr = bptr->buffer().as<uint8_t*>();
 
@@ -448,56 +482,109 @@ void CLDNNInferRequest::execAndParse() {
 
     // finally collect profiling info
     if (m_useProfiling) {
-        std::map<cldnn::primitive_id, cldnn::event> executedPrimitives = m_env.network->get_executed_primitives();
-        auto allPrimitives = m_env.network->get_all_primitives();
-
-        // Get profiling info for all layers
+        collectProfiling();
+    } else if (m_profilingSample > 0 && m_inferences++ % m_profilingSample == 0) {
+        collectProfiling();
         for (auto &profiledID : m_env.profilingIDs) {
-            std::string impl = implementationsMap.at(profiledID);
-            impl.copy(m_env.perfMap[profiledID].exec_type, impl.length());
-
-            // Change status if layer wasn't executed by cldnn engine
-            if (executedPrimitives.find(profiledID) == executedPrimitives.end()) {
-                if (allPrimitives.find(profiledID) != allPrimitives.end() &&
-                    allPrimitives.at(profiledID) == "_optimized_") {
-                    // Layer was marked as optimized by cldnn
-                    m_env.perfMap[profiledID].status = InferenceEngineProfileInfo::OPTIMIZED_OUT;
-                } else {
-                    // Layer wasn't run for some reason
-                    m_env.perfMap[profiledID].status = InferenceEngineProfileInfo::NOT_RUN;
-                }
-                m_env.perfMap[profiledID].cpu_uSec = m_env.perfMap[profiledID].realTime_uSec = 0;
-                continue;
+            auto &info = m_env.perfMap[profiledID];
+            if (info.status == InferenceEngineProfileInfo::EXECUTED) {
+                m_sampledTimes[profiledID].add(info.cpu_uSec, info.realTime_uSec);
             }
+        }
+    }
+}
 
-            auto event = executedPrimitives.at(profiledID);
-            executedPrimitives.erase(profiledID);
-
-            cldnn::instrumentation::profiling_info cldnnInfo{profiledID, event.get_profiling_info()};
-
-            // Collect timings
-            for (auto &interval : cldnnInfo.intervals) {
-                using duration_t = std::chrono::duration<long long, std::chrono::microseconds::period>;
-                auto count = std::chrono::duration_cast<duration_t>(interval.value->value()).count();
-
-                if (interval.name == "submission") {
-                    m_env.perfMap[profiledID].cpu_uSec = count;
-                } else if (interval.name == "executing") {
-                    m_env.perfMap[profiledID].realTime_uSec = count;
-                } else if (interval.name == "duration") {  // "duration" is used for CPU layers
-                    m_env.perfMap[profiledID].cpu_uSec = count;
-                    static const std::string cpuExecType("CPU");
-                    memset(m_env.perfMap[profiledID].exec_type, 0, sizeof(m_env.perfMap[profiledID].exec_type));
-                    cpuExecType.copy(m_env.perfMap[profiledID].exec_type,
-                        cpuExecType.length());  // Override execType as CPU
-                }
+void CLDNNInferRequest::collectProfiling() {
+    std::map<cldnn::primitive_id, cldnn::event> executedPrimitives = m_env.network->get_executed_primitives();
+    auto allPrimitives = m_env.network->get_all_primitives();
+
+    // Get profiling info for all layers
+    if (TraceSink::instance().enabled()) {
+        tracePrimitives(executedPrimitives);
+    }
+
+    for (auto &profiledID : m_env.profilingIDs) {
+        std::string impl = implementationsMap.at(profiledID);
+        impl.copy(m_env.perfMap[profiledID].exec_type, impl.length());
+
+        // Change status if layer wasn't executed by cldnn engine
+        if (executedPrimitives.find(profiledID) == executedPrimitives.end()) {
+            if (allPrimitives.find(profiledID) != allPrimitives.end() &&
+                allPrimitives.at(profiledID) == "_optimized_") {
+                // Layer was marked as optimized by cldnn
+                m_env.perfMap[profiledID].status = InferenceEngineProfileInfo::OPTIMIZED_OUT;
+            } else {
+                // Layer wasn't run for some reason
+                m_env.perfMap[profiledID].status = InferenceEngineProfileInfo::NOT_RUN;
+            }
+            m_env.perfMap[profiledID].cpu_uSec = m_env.perfMap[profiledID].realTime_uSec = 0;
+            continue;
+        }
+
+        auto event = executedPrimitives.at(profiledID);
+        executedPrimitives.erase(profiledID);
+
+        cldnn::instrumentation::profiling_info cldnnInfo{profiledID, event.get_profiling_info()};
+
+        // Collect timings
+        for (auto &interval : cldnnInfo.intervals) {
+            using duration_t = std::chrono::duration<long long, std::chrono::microseconds::period>;
+            auto count = std::chrono::duration_cast<duration_t>(interval.value->value()).count();
+
+            if (interval.name == "submission") {
+                m_env.perfMap[profiledID].cpu_uSec = count;
+            } else if (interval.name == "executing") {
+                m_env.perfMap[profiledID].realTime_uSec = count;
+            } else if (interval.name == "duration") {  // "duration" is used for CPU layers
+                m_env.perfMap[profiledID].cpu_uSec = count;
+                static const std::string cpuExecType("CPU");
+                memset(m_env.perfMap[profiledID].exec_type, 0, sizeof(m_env.perfMap[profiledID].exec_type));
+                cpuExecType.copy(m_env.perfMap[profiledID].exec_type,
+                    cpuExecType.length());  // Override execType as CPU
             }
         }
     }
 }
 
+void CLDNNInferRequest::tracePrimitives(const std::map<cldnn::primitive_id, cldnn::event>& executedPrimitives) {
+    // the events have the durations only, so the primitives are laid back-to-back in the execution order
+    // ending at the time the outputs were collected
+    std::vector<std::pair<cldnn::primitive_id, uint64_t>> timeline;
+    uint64_t total = 0;
+    for (auto &id : m_env.network->get_executed_primitive_ids()) {
+        auto found = executedPrimitives.find(id);
+        if (found == executedPrimitives.end())
+            continue;
+        auto event = found->second;
+        for (auto &interval : event.get_profiling_info()) {
+            if (interval.name == "executing" || interval.name == "duration") {
+                uint64_t us = std::chrono::duration_cast<std::chrono::microseconds>(interval.value->value()).count();
+                timeline.emplace_back(id, us);
+                total += us;
+                break;
+            }
+        }
+    }
+
+    uint64_t time = TraceSink::now() - total;
+    for (auto &primitive : timeline) {
+        TraceSink::instance().complete(primitive.first, "primitive", "GPU", time, time + primitive.second);
+        time += primitive.second;
+    }
+}
+
 void CLDNNInferRequest::execAndParseDyn() {
+    if (m_env.runtimeBatch) {
+        execAndParseRuntimeBatch();
+        return;
+    }
+
     std::vector<std::map<cldnn::primitive_id, cldnn::network_output>> networkOutputs(m_env.m_bv_sz);
+    CLDNNDeviceScheduler::Inference deviceInference(m_env.devicePriority);
+    std::unique_lock<std::mutex> lock(*m_env.executeMutex, std::defer_lock);
+    if (m_env.exclusiveExecution) {
+        lock.lock();
+    }
 
     // set up exection and put all graphs into driver queue
     for (unsigned nb = 0; nb < m_env.m_bv_sz; nb++) {
@@ -529,13 +616,46 @@ void CLDNNInferRequest::execAndParseDyn() {
     }
 }
 
+void CLDNNInferRequest::execAndParseRuntimeBatch() {
+    const int batch = m_curBatch > 0 ? m_curBatch : m_env.m_max_batch;
+    std::map<cldnn::primitive_id, cldnn::network_output> networkOutputs;
+    CLDNNDeviceScheduler::Inference deviceInference(m_env.devicePriority);
+    // the batch is a state of the network shared by the requests, it is set under the lock of the execution
+    std::unique_lock<std::mutex> lock(*m_env.executeMutex);
+    m_env.network->set_batch(static_cast<uint32_t>(batch));
+    networkOutputs = m_env.network->execute();
+    if (!m_env.exclusiveExecution) {
+        lock.unlock();
+    }
+
+    for (auto& no : _networkOutputs) {
+        std::string outputID = no.first;
+        while ((m_env.primitiveIDs.find(outputID) != m_env.primitiveIDs.end()) &&
+            (m_env.primitiveIDs.at(outputID) != outputID)) {
+            outputID = m_env.primitiveIDs.at(outputID);
+        }
+
+        auto outputMemory = networkOutputs.at(outputID).get_memory();
+        Blob::Ptr bptr = _outputs[no.first];
+
+        // the outputs of the first batches lead the buffers of the max batch
+        buf_info bi = { 0, bptr->size() / m_env.m_max_batch * batch };
+        copyOutputData(outputMemory, bptr, &bi);
+    }
+}
+
 void CLDNNInferRequest::InferImpl() {
     IE_PROFILING_AUTO_SCOPE(CLDNN_INFER)
-
-    // execute input pre-processing.
-    execDataPreprocessing();
+    CLDNNBackgroundTuner::notifyInference();
 
     for (auto &item : _inputs) {
+        // execute input pre-processing, it is done by the GPU when possible
+        if (_preProcData.find(item.first) != _preProcData.end()) {
+            if (PreProcessOnGPU(item.first))
+                continue;
+            _preProcData[item.first].execute(item.second, _networkInputs[item.first]->getPreProcess());
+        }
+
         if (m_env.m_max_batch > 1) {
             PrepareInputDyn(item.first, *item.second);
         } else {
@@ -553,18 +673,50 @@ void CLDNNInferRequest::InferImpl() {
 
 void CLDNNInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
-    if (!m_useProfiling) {
-        THROW_IE_EXCEPTION << "Performance counters were not enabled";
-    } else {
+    if (m_useProfiling) {
+        perfMap = m_env.perfMap;
+    } else if (m_profilingSample > 0) {
         perfMap = m_env.perfMap;
+        for (auto &sampled : m_sampledTimes) {
+            sampled.second.average(perfMap[sampled.first]);
+        }
+        static const std::string enqueueType("Enqueue");
+        static const std::string hostExecType("host");
+        auto &enqueue = perfMap["enqueue"];
+        enqueue.status = InferenceEngineProfileInfo::EXECUTED;
+        enqueueType.copy(enqueue.layer_type, enqueueType.length());
+        hostExecType.copy(enqueue.exec_type, hostExecType.length());
+        m_enqueueTimes.average(enqueue);
+    } else {
+        THROW_IE_EXCEPTION << "Performance counters were not enabled";
     }
 }
 
+void CLDNNInferRequest::SampledTimes::add(long long cpuTime, long long realTimeValue) {
+    cpu[count % sampledInferences] = cpuTime;
+    realTime[count % sampledInferences] = realTimeValue;
+    count++;
+}
+
+void CLDNNInferRequest::SampledTimes::average(InferenceEngineProfileInfo &info) const {
+    size_t n = count < sampledInferences ? count : sampledInferences;
+    long long cpuSum = 0, realTimeSum = 0;
+    for (size_t i = 0; i < n; i++) {
+        cpuSum += cpu[i];
+        realTimeSum += realTime[i];
+    }
+    info.cpu_uSec = n ? cpuSum / static_cast<long long>(n) : 0;
+    info.realTime_uSec = n ? realTimeSum / static_cast<long long>(n) : 0;
+}
+
 void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
     // Get input layout
     if (m_env.inputLayouts.find(inputName) == m_env.inputLayouts.end()) {
         THROW_IE_EXCEPTION << "Input name mismatch.";
     }
+    if (PrepareSharedInput(inputName, inputBlob)) {
+        return;
+    }
     auto inputLayout = m_env.inputLayouts.at(inputName);
     auto is_same_buffer = [](const Blob& blob, const cldnn::memory& memory) -> bool {
         const std::string str_not_allocated("Input data was not allocated.");
@@ -597,12 +749,64 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
                 THROW_IE_EXCEPTION << "Unsupported input precision " << inputBlob.precision();
         }
     } else {
-        // Otherwise, we have to attach to user memory and then copy the data.
+        // Otherwise, we have to attach to user memory. The integrated GPU reads the page aligned user memory in place,
+        // the other one is copied.
         copyInputData(m_env.network, inputName, inputLayout, inputBlob);
     }
 }
 
+bool CLDNNInferRequest::PrepareSharedInput(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
+    auto clBlob = dynamic_cast<const ICLDNNBufferBlob *>(&inputBlob);
+    if (clBlob == nullptr || inputBlob.precision() == Precision::I16) {
+        return false;
+    }
+    const cldnn::layout &inputLayout = m_env.inputLayouts.at(inputName);
+    if (inputBlob.byteSize() != inputLayout.bytes_count()) {
+        THROW_IE_EXCEPTION << "The OpenCL buffer of the input " << inputName << " does not match the input layout";
+    }
+
+    void *buffer = clBlob->clBuffer();
+    auto shared = sharedInputs.find(inputName);
+    if (shared == sharedInputs.end() || shared->second.first != buffer) {
+        // the engine checks the buffer belongs to its context, the network reads it in place
+        auto memory = cldnn::memory::share_buffer(*m_env.engine, inputLayout, buffer);
+        sharedInputs.erase(inputName);
+        shared = sharedInputs.insert({ inputName, { buffer, memory } }).first;
+    }
+    m_env.network->set_input_data(inputName, shared->second.second);
+    return true;
+}
+
+bool CLDNNInferRequest::PreProcessOnGPU(const std::string &inputName) {
+    const PreProcessData &preProcData = _preProcData[inputName];
+    const PreProcessInfo &info = _networkInputs[inputName]->getPreProcess();
+    Blob::Ptr image = preProcData.getRoiBlob();
+    if (m_env.m_max_batch > 1 || !image || preProcData.hasRois() ||
+        _networkInputs[inputName]->getInputPrecision() == Precision::I16) {
+        return false;
+    }
+    const cldnn::layout &inputLayout = m_env.inputLayouts.at(inputName);
+    if (!CLDNNPreProcess::IsSupported(image, inputLayout, info)) {
+        return false;
+    }
+
+    auto preProcess = gpuPreProcess.find(inputName);
+    if (preProcess == gpuPreProcess.end()) {
+        preProcess = gpuPreProcess.insert({ inputName,
+            std::make_shared<CLDNNPreProcess>(m_env.engine, inputLayout, info) }).first;
+    }
+    // the converted image is allocated by the engine, so the network uses it without a copy
+    m_env.network->set_input_data(inputName, preProcess->second->Execute(image, *m_env.executeMutex));
+    return true;
+}
+
 void CLDNNInferRequest::PrepareInputDyn(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
+    // the network of the max batch reads only the first batches of the blob
+    if (m_env.runtimeBatch) {
+        copyInputData(m_env.network, inputName, m_env.inputLayouts.at(inputName), inputBlob);
+        return;
+    }
+
     // now try to get execution results
     for (unsigned nb = 0; nb < m_env.m_bv_sz; nb++) {
         unsigned int mask = 1 << nb;
@@ -12,7 +12,9 @@
 #include <ie_plugin.hpp>
 #include <inference_engine.hpp>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <cldnn/cldnn_shared_context.hpp>
 #include "cldnn_graph.h"
+#include "cldnn_preprocess.h"
 
 namespace CLDNNPlugin {
 
@@ -28,8 +30,13 @@ public:
     void
     GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
+    /**
+     * @param profilingSample - with useProfiling false, the performance counters are collected for 1 of
+     * profilingSample inferences (KEY_CLDNN_PROFILING_SAMPLE), 0 disables the sampling
+     */
     CLDNNInferRequest(InferenceEnv env, bool useProfiling,
-                      InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs);
+                      InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs,
+                      int profilingSample = 0);
 
     CLDNNInferRequest(const CLDNNInferRequest &) = delete;
 
@@ -39,11 +46,32 @@ public:
 
 protected:
     std::map<std::string, cldnn::memory> inputsMemory;
+    // the pinned host memory of the outputs of the discrete device, the output blobs point to it
+    std::map<std::string, cldnn::memory> outputsStaging;
     std::map<std::string, cldnn::primitive_id> outputsMap;
     std::map<cldnn::primitive_id, std::string> implementationsMap;
+    std::map<std::string, CLDNNPreProcess::Ptr> gpuPreProcess;
+    // the memory over the OpenCL buffer of the last ICLDNNBufferBlob set to the input, kept so the network is replayed
+    std::map<std::string, std::pair<void *, cldnn::memory>> sharedInputs;
     bool m_useProfiling;
     InferenceEnv m_env;
 
+    // the sampled profiling: the timings of the last sampledInferences sampled inferences are kept in the rings
+    // and averaged by GetPerformanceCounts
+    static const size_t sampledInferences = 16;
+    struct SampledTimes {
+        long long cpu[sampledInferences];
+        long long realTime[sampledInferences];
+        size_t count = 0;
+
+        void add(long long cpuTime, long long realTimeValue);
+        void average(InferenceEngine::InferenceEngineProfileInfo &info) const;
+    };
+    int m_profilingSample;
+    size_t m_inferences = 0;
+    std::map<std::string, SampledTimes> m_sampledTimes;
+    SampledTimes m_enqueueTimes;
+
     // dynamic batch stuff
     int m_curBatch;
     std::map<std::string, std::vector<buf_info>> batchInputs;
@@ -63,10 +91,15 @@ protected:
     void AllocateInputsDyn();
     void AllocateOutputsDyn();
     void execAndParse();
+    void collectProfiling();
     void execAndParseDyn();
+    void execAndParseRuntimeBatch();
+    void tracePrimitives(const std::map<cldnn::primitive_id, cldnn::event>& executedPrimitives);
 
     void PrepareInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    bool PrepareSharedInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
     void PrepareInputDyn(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    bool PreProcessOnGPU(const std::string &inputName);
 
 private:
     static const std::string fp32_suffix;
@@ -0,0 +1,273 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <CPP/input_layout.hpp>
+#include <CPP/custom_gpu_primitive.hpp>
+#include <CPP/topology.hpp>
+#include <details/ie_exception.hpp>
+#include "cldnn_preprocess.h"
+
+using namespace InferenceEngine;
+
+namespace CLDNNPlugin {
+
+const cldnn::primitive_id CLDNNPreProcess::m_imageID = "preprocess_image";
+const cldnn::primitive_id CLDNNPreProcess::m_kernelID = "preprocess";
+
+namespace {
+
+// The same conversion as the one of the host (see details::ColorConvertResize): the pixel centers are aligned,
+// the coordinates outside of the image are clamped to the border, NV12 is BT.601 limited range. The area resize
+// averages the source pixels covered by the output one, it is the bilinear one when the image is upscaled.
+const char preprocessKernel[] = R"__krnl(
+inline float sample_plane(const __global SRC_TYPE* plane, int w, int h, int pixel_step, int ox, int oy)
+{
+    const float sx = (float)w / DST_W;
+    const float sy = (float)h / DST_H;
+#ifdef RESIZE_AREA
+    if (sx >= 1.f && sy >= 1.f)
+    {
+        const float x0 = ox * sx, x1 = x0 + sx;
+        const float y0 = oy * sy, y1 = y0 + sy;
+        float sum = 0.f;
+        for (int y = (int)y0; y < min((int)ceil(y1), h); y++)
+        {
+            const float wy = fmin(y1, y + 1.f) - fmax(y0, (float)y);
+            for (int x = (int)x0; x < min((int)ceil(x1), w); x++)
+            {
+                const float wx = fmin(x1, x + 1.f) - fmax(x0, (float)x);
+                sum += wx * wy * (float)plane[(y * w + x) * pixel_step];
+            }
+        }
+        return sum / (sx * sy);
+    }
+#endif
+    const float fx = fmax((ox + 0.5f) * sx - 0.5f, 0.f);
+    const float fy = fmax((oy + 0.5f) * sy - 0.5f, 0.f);
+    const int x0 = min((int)fx, w - 1);
+    const int y0 = min((int)fy, h - 1);
+    const int x1 = min(x0 + 1, w - 1);
+    const int y1 = min(y0 + 1, h - 1);
+    const float wx = fmin(1.f, fx - x0);
+    const float wy = fmin(1.f, fy - y0);
+    const float top = mix((float)plane[(y0 * w + x0) * pixel_step], (float)plane[(y0 * w + x1) * pixel_step], wx);
+    const float bottom = mix((float)plane[(y1 * w + x0) * pixel_step], (float)plane[(y1 * w + x1) * pixel_step], wx);
+    return mix(top, bottom, wy);
+}
+
+inline void store(__global OUT_TYPE* image, int x, int y, int c, float v)
+{
+#ifdef DST_PLANAR
+    image[(c * DST_H + y) * DST_W + x] = TO_OUT(v);
+#else
+    image[(y * DST_W + x) * CHANNELS + c] = TO_OUT(v);
+#endif
+}
+
+__kernel void preprocess(const __global SRC_TYPE* src, __global OUT_TYPE* dst)
+{
+    const int x = get_global_id(0);
+    const int y = get_global_id(1);
+    const int n = get_global_id(2);
+    const __global SRC_TYPE* image = src + n * SRC_IMAGE_SIZE;
+    __global OUT_TYPE* output = dst + n * CHANNELS * DST_H * DST_W;
+
+#if defined(NV12)
+    const __global SRC_TYPE* uv = image + SRC_W * SRC_H;
+    const float luma = sample_plane(image, SRC_W, SRC_H, 1, x, y);
+    const float c = 1.164f * (luma - 16.f);
+    const float d = sample_plane(uv, SRC_W / 2, SRC_H / 2, 2, x, y) - 128.f;
+    const float e = sample_plane(uv + 1, SRC_W / 2, SRC_H / 2, 2, x, y) - 128.f;
+    store(output, x, y, 0, c + 2.018f * d);
+    store(output, x, y, 1, c - 0.391f * d - 0.813f * e);
+    store(output, x, y, 2, c + 1.596f * e);
+#else
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+#ifdef SWAP_RB
+        const int src_ch = CHANNELS - 1 - ch;
+#else
+        const int src_ch = ch;
+#endif
+        store(output, x, y, ch,
+              sample_plane(image + src_ch * SRC_CHANNEL_STEP, SRC_W, SRC_H, SRC_PIXEL_STEP, x, y));
+    }
+#endif
+}
+)__krnl";
+
+const char* TypeName(cldnn::data_types type) {
+    switch (type) {
+    case cldnn::data_types::u8: return "uchar";
+    case cldnn::data_types::f16: return "half";
+    case cldnn::data_types::f32: return "float";
+    default: THROW_IE_EXCEPTION << "Unsupported data type of the GPU pre-processing";
+    }
+}
+
+bool IsDense(const TensorDesc &desc) {
+    const auto &blocking = desc.getBlockingDesc();
+    const auto &dims = desc.getDims();
+    return blocking.getOffsetPadding() == 0 && !blocking.getStrides().empty() &&
+           blocking.getStrides()[0] == dims[1] * dims[2] * dims[3];
+}
+
+}  // namespace
+
+CLDNNPreProcess::CLDNNPreProcess(std::shared_ptr<const cldnn::engine> engine, const cldnn::layout &inputLayout,
+                                 const PreProcessInfo &info)
+    : m_engine(engine),
+      m_inputLayout(inputLayout),
+      m_imageLayout(inputLayout),
+      m_colorFormat(info.getColorFormat()),
+      m_resizeAlgorithm(info.getResizeAlgorithm()) {
+}
+
+bool CLDNNPreProcess::IsSupported(const Blob::Ptr &image, const cldnn::layout &inputLayout,
+                                  const PreProcessInfo &info) {
+    const auto &desc = image->getTensorDesc();
+    const auto &dims = desc.getDims();
+    if (dims.size() != 4 || (desc.getLayout() != NCHW && desc.getLayout() != NHWC) || !IsDense(desc))
+        return false;
+    if (inputLayout.format != cldnn::format::bfyx && inputLayout.format != cldnn::format::byxf)
+        return false;
+    if (static_cast<int>(dims[0]) != inputLayout.size.batch[0])
+        return false;
+
+    const int channels = inputLayout.size.feature[0];
+    size_t height = dims[2];
+    switch (info.getColorFormat()) {
+    case RAW:
+        if (desc.getPrecision() != Precision::U8 && desc.getPrecision() != Precision::FP16 &&
+            desc.getPrecision() != Precision::FP32)
+            return false;
+        if (static_cast<int>(dims[1]) != channels)
+            return false;
+        break;
+    case RGB:
+    case BGR:
+        if (desc.getPrecision() != Precision::U8 || dims[1] != 3 || channels != 3)
+            return false;
+        break;
+    case RGBX:
+    case BGRX:
+        if (desc.getPrecision() != Precision::U8 || dims[1] != 4 || desc.getLayout() != NHWC || channels != 3)
+            return false;
+        break;
+    case NV12:
+        if (desc.getPrecision() != Precision::U8 || dims[1] != 1 || dims[2] % 3 != 0 || dims[3] % 2 != 0 ||
+                channels != 3)
+            return false;
+        height = dims[2] * 2 / 3;
+        break;
+    default:
+        return false;
+    }
+
+    // the host reports the image of the wrong size
+    return info.getResizeAlgorithm() != NO_RESIZE ||
+           (static_cast<int>(height) == inputLayout.size.spatial[1] &&
+            static_cast<int>(dims[3]) == inputLayout.size.spatial[0]);
+}
+
+std::string CLDNNPreProcess::GetDefines(const TensorDesc &imageDesc) const {
+    const auto &dims = imageDesc.getDims();
+    const bool planar = imageDesc.getLayout() == NCHW;
+    const size_t channels = dims[1];
+    const size_t width = dims[3];
+    const size_t height = m_colorFormat == NV12 ? dims[2] * 2 / 3 : dims[2];
+
+    std::ostringstream defines;
+    if (m_inputLayout.data_type == cldnn::data_types::f16 || m_imageLayout.data_type == cldnn::data_types::f16)
+        defines << "#pragma OPENCL EXTENSION cl_khr_fp16 : enable\n";
+    defines << "#define SRC_TYPE " << TypeName(m_imageLayout.data_type) << "\n";
+    defines << "#define OUT_TYPE " << TypeName(m_inputLayout.data_type) << "\n";
+    switch (m_inputLayout.data_type) {
+    case cldnn::data_types::u8: defines << "#define TO_OUT(v) convert_uchar_sat((v) + 0.5f)\n"; break;
+    case cldnn::data_types::f16: defines << "#define TO_OUT(v) convert_half(v)\n"; break;
+    default: defines << "#define TO_OUT(v) (v)\n"; break;
+    }
+    defines << "#define SRC_W " << width << "\n";
+    defines << "#define SRC_H " << height << "\n";
+    defines << "#define SRC_IMAGE_SIZE " << dims[1] * dims[2] * dims[3] << "\n";
+    defines << "#define SRC_PIXEL_STEP " << (planar ? 1 : channels) << "\n";
+    defines << "#define SRC_CHANNEL_STEP " << (planar ? height * width : 1) << "\n";
+    defines << "#define DST_W " << m_inputLayout.size.spatial[0] << "\n";
+    defines << "#define DST_H " << m_inputLayout.size.spatial[1] << "\n";
+    defines << "#define CHANNELS " << m_inputLayout.size.feature[0] << "\n";
+    if (m_inputLayout.format == cldnn::format::bfyx)
+        defines << "#define DST_PLANAR\n";
+    if (m_colorFormat == NV12)
+        defines << "#define NV12\n";
+    if (m_colorFormat == RGB || m_colorFormat == RGBX)
+        defines << "#define SWAP_RB\n";
+    if (m_resizeAlgorithm == RESIZE_AREA)
+        defines << "#define RESIZE_AREA\n";
+    return defines.str();
+}
+
+void CLDNNPreProcess::Build(const TensorDesc &imageDesc) {
+    const auto &dims = imageDesc.getDims();
+    cldnn::data_types imageType;
+    switch (imageDesc.getPrecision()) {
+    case Precision::U8: imageType = cldnn::data_types::u8; break;
+    case Precision::FP16: imageType = cldnn::data_types::f16; break;
+    case Precision::FP32: imageType = cldnn::data_types::f32; break;
+    default: THROW_IE_EXCEPTION << "Unsupported image precision " << imageDesc.getPrecision() << " of the GPU pre-processing";
+    }
+    // the kernel addresses the images of the batch as the plain buffers
+    m_imageLayout = cldnn::layout(imageType, cldnn::format::bfyx,
+                                  cldnn::tensor(static_cast<cldnn::tensor::value_type>(dims[0]), 1,
+                                                static_cast<cldnn::tensor::value_type>(dims[1] * dims[2] * dims[3]), 1));
+
+    cldnn::topology topology;
+    topology.add(cldnn::input_layout(m_imageID, m_imageLayout));
+    topology.add(cldnn::custom_gpu_primitive(
+        m_kernelID,
+        { m_imageID },
+        { GetDefines(imageDesc), preprocessKernel },
+        "preprocess",
+        { { cldnn_arg_type::arg_input, 0 }, { cldnn_arg_type::arg_output, 0 } },
+        "",
+        m_inputLayout,
+        { static_cast<size_t>(m_inputLayout.size.spatial[0]), static_cast<size_t>(m_inputLayout.size.spatial[1]),
+          static_cast<size_t>(m_inputLayout.size.batch[0]) }));
+
+    m_network = std::make_shared<cldnn::network>(*m_engine, topology);
+    m_imageDesc = imageDesc;
+}
+
+cldnn::memory CLDNNPreProcess::Execute(const Blob::Ptr &image, std::mutex &executeMutex) {
+    const auto &desc = image->getTensorDesc();
+    if (!m_network || desc.getDims() != m_imageDesc.getDims() || desc.getLayout() != m_imageDesc.getLayout() ||
+            desc.getPrecision() != m_imageDesc.getPrecision()) {
+        Build(desc);
+    }
+
+    cldnn::memory imageMemory = [&]() {
+        switch (desc.getPrecision()) {
+        case Precision::FP32:
+            return cldnn::memory::attach(m_imageLayout, image->buffer().as<float*>(), image->size());
+        case Precision::FP16:
+            return cldnn::memory::attach(m_imageLayout, image->buffer().as<uint16_t*>(), image->size());
+        default:
+            return cldnn::memory::attach(m_imageLayout, image->buffer().as<uint8_t*>(), image->size());
+        }
+    }();
+
+    std::map<cldnn::primitive_id, cldnn::network_output> outputs;
+    {
+        std::lock_guard<std::mutex> lock(executeMutex);
+        m_network->set_input_data(m_imageID, imageMemory);
+        outputs = m_network->execute();
+    }
+    // the network is executed after the conversion is done, the image can be released by the user then
+    return outputs.at(m_kernelID).get_memory();
+}
+
+};  // namespace CLDNNPlugin
@@ -0,0 +1,60 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include "ie_blob.h"
+#include "ie_preprocess.hpp"
+#include <CPP/engine.hpp>
+#include <CPP/memory.hpp>
+#include <CPP/network.hpp>
+
+namespace CLDNNPlugin {
+
+/**
+ * @brief Pre-processing of an input (color conversion and resize, see PreProcessInfo) executed on the GPU.
+ * The image is uploaded as is and converted to the network input by a single OpenCL kernel of a small clDNN
+ * network, which is rebuilt when the image size changes. The output memory of the kernel is set as the input of
+ * the main network, so the host neither pre-processes nor copies the image.
+ */
+class CLDNNPreProcess {
+public:
+    typedef std::shared_ptr<CLDNNPreProcess> Ptr;
+
+    CLDNNPreProcess(std::shared_ptr<const cldnn::engine> engine, const cldnn::layout &inputLayout,
+                    const InferenceEngine::PreProcessInfo &info);
+
+    /**
+     * @brief Checks that the image is converted to the input of the given layout by the kernel, the other images
+     * are pre-processed on the host
+     */
+    static bool IsSupported(const InferenceEngine::Blob::Ptr &image, const cldnn::layout &inputLayout,
+                            const InferenceEngine::PreProcessInfo &info);
+
+    /**
+     * @brief Converts the image, the returned memory holds the result when the call returns
+     */
+    cldnn::memory Execute(const InferenceEngine::Blob::Ptr &image, std::mutex &executeMutex);
+
+private:
+    void Build(const InferenceEngine::TensorDesc &imageDesc);
+    std::string GetDefines(const InferenceEngine::TensorDesc &imageDesc) const;
+
+    std::shared_ptr<const cldnn::engine> m_engine;
+    cldnn::layout m_inputLayout;
+    cldnn::layout m_imageLayout;
+    InferenceEngine::ColorFormat m_colorFormat;
+    InferenceEngine::ResizeAlgorithm m_resizeAlgorithm;
+    InferenceEngine::TensorDesc m_imageDesc;
+    std::shared_ptr<cldnn::network> m_network;
+
+    static const cldnn::primitive_id m_imageID;
+    static const cldnn::primitive_id m_kernelID;
+};
+
+};  // namespace CLDNNPlugin
@@ -0,0 +1,62 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include "cldnn_scheduler.h"
+
+namespace CLDNNPlugin {
+
+namespace {
+
+// the priority is passed by value in the parameter of the handler
+void yieldHandler(void *param) {
+    CLDNNDeviceScheduler::getInstance().yield(static_cast<int>(reinterpret_cast<intptr_t>(param)));
+}
+
+}  // namespace
+
+CLDNNDeviceScheduler& CLDNNDeviceScheduler::getInstance() {
+    static CLDNNDeviceScheduler scheduler;
+    return scheduler;
+}
+
+int CLDNNDeviceScheduler::priorityOf(cldnn::priority_mode_types queuePriority) {
+    switch (queuePriority) {
+    case cldnn::priority_mode_types::low:
+        return 1;
+    case cldnn::priority_mode_types::high:
+        return 3;
+    default:
+        return 2;
+    }
+}
+
+void CLDNNDeviceScheduler::setPreemption(cldnn::network &network, int priority, uint32_t slice) {
+    network.set_yield_handler(&yieldHandler, reinterpret_cast<void *>(static_cast<intptr_t>(priority)), slice);
+}
+
+void CLDNNDeviceScheduler::begin(int priority) {
+    std::lock_guard<std::mutex> lock(mutex);
+    running[priority]++;
+}
+
+void CLDNNDeviceScheduler::end(int priority) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--running[priority] == 0) {
+            running.erase(priority);
+        }
+    }
+    done.notify_all();
+}
+
+void CLDNNDeviceScheduler::yield(int priority) {
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&] {
+        return running.empty() || running.rbegin()->first <= priority;
+    });
+}
+
+};  // namespace CLDNNPlugin
@@ -0,0 +1,71 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <CPP/engine.hpp>
+#include <CPP/network.hpp>
+
+namespace CLDNNPlugin {
+
+/**
+ * @brief Lets the inferences of the networks of a higher queue priority (CLDNNConfigParams::KEY_CLDNN_PLUGIN_PRIORITY)
+ * run between the slices of the networks of a lower one (CLDNNConfigParams::KEY_CLDNN_PREEMPTION_SLICE).
+ * The networks of the different engines have their own queues, so the kernels of the higher priority network are
+ * submitted at once, while the lower priority network waits at the end of its slice until they complete.
+ */
+class CLDNNDeviceScheduler {
+public:
+    /**
+     * @brief The inference of a network on the device, from the execution to the outputs being read
+     */
+    class Inference {
+    public:
+        explicit Inference(int priority) : _priority(priority) {
+            getInstance().begin(_priority);
+        }
+        ~Inference() {
+            getInstance().end(_priority);
+        }
+
+        Inference(const Inference &) = delete;
+        Inference &operator=(const Inference &) = delete;
+
+    private:
+        int _priority;
+    };
+
+    static CLDNNDeviceScheduler& getInstance();
+
+    /**
+     * @brief The scheduling priority of the network of the queue priority, the default queue is the medium one
+     */
+    static int priorityOf(cldnn::priority_mode_types queuePriority);
+
+    /**
+     * @brief Makes the network wait for the inferences of a higher priority after every slice of the primitives
+     */
+    static void setPreemption(cldnn::network &network, int priority, uint32_t slice);
+
+    void begin(int priority);
+    void end(int priority);
+
+    /**
+     * @brief Waits while there are inferences of a higher priority than the given one
+     */
+    void yield(int priority);
+
+private:
+    CLDNNDeviceScheduler() = default;
+
+    std::mutex mutex;
+    std::condition_variable done;
+    std::map<int, int> running;  // the number of the running inferences of the priority
+};
+
+};  // namespace CLDNNPlugin
@@ -0,0 +1,158 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <CPP/network.hpp>
+#include <CPP/program.hpp>
+#include "cldnn_tuner.h"
+
+#if defined(_WIN32)
+#include <direct.h>
+#define mkdir(dir, mode) _mkdir(dir)
+#endif
+
+namespace CLDNNPlugin {
+
+namespace {
+
+// the tuning starts when no inference ran on the device for this time
+const int64_t idlePeriodMs = 200;
+
+int64_t nowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool isDirectory(const std::string &path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && (info.st_mode & S_IFDIR) != 0;
+}
+
+}  // namespace
+
+std::atomic<int64_t> CLDNNBackgroundTuner::lastInference(0);
+
+CLDNNBackgroundTuner& CLDNNBackgroundTuner::getInstance() {
+    static CLDNNBackgroundTuner tuner;
+    return tuner;
+}
+
+CLDNNBackgroundTuner::~CLDNNBackgroundTuner() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+        jobs.clear();
+    }
+    wakeUp.notify_all();
+    // the build of the running tuning cannot be interrupted, the process exits when it completes
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+std::shared_ptr<CLDNNBackgroundTuner::Job> CLDNNBackgroundTuner::enqueue(
+        const std::string &key, const std::shared_ptr<const cldnn::engine> &engine,
+        const std::shared_ptr<cldnn::topology> &topology, const std::string &tuningFile) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!tunedKeys.insert(tuningFile + "\n" + key).second) {
+        return nullptr;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->key = tuningFile + "\n" + key;
+    job->engine = engine;
+    job->topology = topology;
+    job->tuningFile = tuningFile;
+    jobs.push_back({ job->key, job });
+    if (!worker.joinable()) {
+        worker = std::thread(&CLDNNBackgroundTuner::run, this);
+    }
+    wakeUp.notify_one();
+    return job;
+}
+
+void CLDNNBackgroundTuner::notifyInference() {
+    lastInference = nowMs();
+}
+
+std::string CLDNNBackgroundTuner::defaultTuningFile(const std::string &kernelsCacheDir) {
+    std::string dir = kernelsCacheDir;
+    if (dir.empty()) {
+#if defined(_WIN32)
+        const char *localAppData = std::getenv("LOCALAPPDATA");
+        if (localAppData == nullptr || *localAppData == 0) {
+            return "";
+        }
+        dir = std::string(localAppData) + "\\clDNN";
+#else
+        const char *xdgCache = std::getenv("XDG_CACHE_HOME");
+        const char *home = std::getenv("HOME");
+        std::string cacheHome;
+        if (xdgCache != nullptr && *xdgCache != 0) {
+            cacheHome = xdgCache;
+        } else if (home != nullptr && *home != 0) {
+            cacheHome = std::string(home) + "/.cache";
+            mkdir(cacheHome.c_str(), 0755);
+        } else {
+            return "";
+        }
+        dir = cacheHome + "/clDNN";
+#endif
+        mkdir(dir.c_str(), 0755);
+    }
+    if (!isDirectory(dir)) {
+        return "";
+    }
+    return dir + "/tuning_cache.txt";
+}
+
+void CLDNNBackgroundTuner::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stop) {
+        if (jobs.empty()) {
+            wakeUp.wait(lock);
+            continue;
+        }
+
+        int64_t idle = nowMs() - lastInference;
+        if (idle < idlePeriodMs) {
+            wakeUp.wait_for(lock, std::chrono::milliseconds(idlePeriodMs - idle));
+            continue;
+        }
+
+        auto queued = jobs.front();
+        jobs.pop_front();
+        auto job = queued.second.lock();
+        if (!job) {
+            // the network was released before the tuning, it is tuned when loaded again
+            tunedKeys.erase(queued.first);
+            continue;
+        }
+
+        lock.unlock();
+        try {
+            // the options of the build affecting the kernel parameters match the ones of the network loading,
+            // so the winners are stored by the hashes the next loadings look up
+            cldnn::tuning_config_options tuningConfig;
+            tuningConfig.mode = cldnn::tuning_mode::tuning_tune_and_cache;
+            tuningConfig.cache_file_path = job->tuningFile;
+            cldnn::build_options options;
+            options.set_option(cldnn::build_option::optimize_data(true));
+            options.set_option(cldnn::build_option::tuning_config(tuningConfig));
+            cldnn::network network(*job->engine, *job->topology, options);
+        } catch (...) {
+            // the network keeps running the heuristic kernels
+        }
+        job.reset();
+        lock.lock();
+    }
+}
+
+};  // namespace CLDNNPlugin
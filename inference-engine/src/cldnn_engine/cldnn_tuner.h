@@ -0,0 +1,79 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <CPP/engine.hpp>
+#include <CPP/topology.hpp>
+
+namespace CLDNNPlugin {
+
+/**
+ * @brief Tunes the kernels of the loaded networks in the background (CLDNNConfigParams::CLDNN_TUNING_BACKGROUND).
+ * The network is loaded with the kernels found in the tuning cache and the heuristics for the rest, then a single
+ * process-wide thread builds the topology of the network once more in the tune-and-cache mode, when the device has
+ * been idle for a while. The build times the candidate kernels of the layers missing in the cache and appends the
+ * winners to it, so the next loads of the network (and of the networks sharing its layers) take the tuned kernels.
+ * The build shares the engine of the network, the weights and the compiled programs, so it costs the device memory
+ * of one more network while it runs.
+ */
+class CLDNNBackgroundTuner {
+public:
+    /**
+     * @brief The tuning of a network, it is dropped if it did not start when the network releases the job
+     */
+    struct Job {
+        std::string key;
+        std::shared_ptr<const cldnn::engine> engine;
+        std::shared_ptr<cldnn::topology> topology;
+        std::string tuningFile;
+    };
+
+    static CLDNNBackgroundTuner& getInstance();
+
+    /**
+     * @brief Queues the tuning of the topology, the topologies of the same key are tuned once per process,
+     * returns nullptr for them
+     */
+    std::shared_ptr<Job> enqueue(const std::string &key, const std::shared_ptr<const cldnn::engine> &engine,
+                                 const std::shared_ptr<cldnn::topology> &topology, const std::string &tuningFile);
+
+    /**
+     * @brief Records the inference on the device, the tuning waits until the device is idle
+     */
+    static void notifyInference();
+
+    /**
+     * @brief The tuning file in the kernels cache directory if set, otherwise in the cache directory of the user,
+     * empty if there is no directory to keep it
+     */
+    static std::string defaultTuningFile(const std::string &kernelsCacheDir);
+
+    ~CLDNNBackgroundTuner();
+
+private:
+    CLDNNBackgroundTuner() = default;
+    void run();
+
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::deque<std::pair<std::string, std::weak_ptr<Job>>> jobs;
+    std::set<std::string> tunedKeys;
+    std::thread worker;
+    bool stop = false;
+
+    static std::atomic<int64_t> lastInference;  // steady clock milliseconds
+};
+
+};  // namespace CLDNNPlugin
@@ -0,0 +1,69 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cldnn_weights_store.h"
+#include <cstring>
+#include <sstream>
+
+namespace CLDNNPlugin {
+
+CLDNNWeightsStore::MemoryPtr CLDNNWeightsStore::findOrCreate(const std::string &key,
+                                                             const std::function<cldnn::memory()> &create,
+                                                             bool &created) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    created = false;
+    auto found = _memories.find(key);
+    if (found != _memories.end()) {
+        auto memory = found->second.lock();
+        if (memory) {
+            return memory;
+        }
+    }
+
+    // the memories of the unloaded networks are gone, so their keys are dropped
+    for (auto it = _memories.begin(); it != _memories.end();) {
+        if (it->second.expired()) {
+            it = _memories.erase(it);
+        } else {
+            it++;
+        }
+    }
+
+    auto memory = std::make_shared<cldnn::memory>(create());
+    _memories[key] = memory;
+    created = true;
+    return memory;
+}
+
+std::string CLDNNWeightsStore::makeKey(const void *data, size_t size, const cldnn::layout &layout,
+                                       const std::string &tag) {
+    std::stringstream key;
+    key << std::hex << hash(data, size) << std::dec << "_" << size << "_"
+        << static_cast<int>(layout.data_type) << "_" << static_cast<int>(layout.format.value) << "_";
+    for (auto dim : layout.size.sizes()) {
+        key << dim << ",";
+    }
+    key << "_" << tag;
+    return key.str();
+}
+
+uint64_t CLDNNWeightsStore::hash(const void *data, size_t size) {
+    // FNV-1a over the 8 byte words, the tail is hashed byte by byte
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t result = 0xcbf29ce484222325ULL;
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    size_t words = size / sizeof(uint64_t);
+    for (size_t i = 0; i < words; i++) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+        result = (result ^ word) * prime;
+    }
+    for (size_t i = words * sizeof(uint64_t); i < size; i++) {
+        result = (result ^ bytes[i]) * prime;
+    }
+    return result;
+}
+
+}  // namespace CLDNNPlugin
@@ -0,0 +1,54 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <CPP/memory.hpp>
+#include <CPP/layout.hpp>
+
+namespace CLDNNPlugin {
+
+/**
+ * @brief The weights uploaded to the memory of an engine, found by the hash of the original weights and the layout
+ * of the device memory. The networks of the dynamic batch and the networks sharing the engine
+ * (KEY_CLDNN_SHARED_MEM_POOL) keep one copy of the same weights, e.g. of the same model loaded twice.
+ * The memory exists as long as any network uses it, the memory of an engine is not valid on the other engines.
+ */
+class CLDNNWeightsStore {
+public:
+    typedef std::shared_ptr<CLDNNWeightsStore> Ptr;
+    typedef std::shared_ptr<cldnn::memory> MemoryPtr;
+
+    /**
+     * @brief Returns the memory stored with the key or creates and stores it
+     * @param key - the key made by makeKey
+     * @param create - allocates and fills the memory if it is not stored
+     * @param created - set to true if the memory was created by the call
+     */
+    MemoryPtr findOrCreate(const std::string &key, const std::function<cldnn::memory()> &create, bool &created);
+
+    /**
+     * @brief Makes the key of the weights uploaded to the memory of the given layout
+     * @param data - the original weights
+     * @param size - the size of the original weights in bytes
+     * @param tag - distinguishes the memory of the same weights and layout filled differently (e.g. rearranged)
+     */
+    static std::string makeKey(const void *data, size_t size, const cldnn::layout &layout, const std::string &tag);
+
+private:
+    static uint64_t hash(const void *data, size_t size);
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::weak_ptr<cldnn::memory>> _memories;
+};
+
+}  // namespace CLDNNPlugin
@@ -0,0 +1,324 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "defs.h"
+#include <ie_parallel_for.hpp>
+#include <immintrin.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * The operations on the boxes shared by the detection layers (Proposal, SimplerNMS and the next ones): the decoding
+ * of the regression deltas, the clipping, the selection of the top scores and the non-maximum suppression.
+ * The boxes are (x0, y0, x1, y1), the widths and the heights are x1 - x0 + coordinates_offset and y1 - y0 +
+ * coordinates_offset (1 for the pixel coordinates of Caffe, 0 for the continuous ones). The suppressions take the
+ * boxes in the planar layout: all x0, then all y0, x1 and y1, so a box is compared with 16 (8) others at once.
+ */
+class BoxOps {
+public:
+    struct Box {
+        float x0;
+        float y0;
+        float x1;
+        float y1;
+    };
+
+    /**
+     * The anchor moved and scaled by the deltas: the center by (dx, dy) times the size, the size by exp(d_log_w, d_log_h)
+     */
+    static inline Box decode(const Box &anchor, float dx, float dy, float d_log_w, float d_log_h,
+                             float coordinates_offset) {
+        // width & height and the center of the anchor
+        const float ww = anchor.x1 - anchor.x0 + coordinates_offset;
+        const float hh = anchor.y1 - anchor.y0 + coordinates_offset;
+        const float ctr_x = anchor.x0 + 0.5f * ww;
+        const float ctr_y = anchor.y0 + 0.5f * hh;
+
+        const float pred_ctr_x = dx * ww + ctr_x;
+        const float pred_ctr_y = dy * hh + ctr_y;
+        const float pred_w = std::exp(d_log_w) * ww;
+        const float pred_h = std::exp(d_log_h) * hh;
+
+        return {pred_ctr_x - 0.5f * pred_w, pred_ctr_y - 0.5f * pred_h,
+                pred_ctr_x + 0.5f * pred_w, pred_ctr_y + 0.5f * pred_h};
+    }
+
+    /**
+     * The box with the corners clamped to [0, max_x] x [0, max_y]
+     */
+    static inline Box clip(const Box &box, float max_x, float max_y) {
+        return {std::max<float>(0.0f, std::min<float>(box.x0, max_x)),
+                std::max<float>(0.0f, std::min<float>(box.y0, max_y)),
+                std::max<float>(0.0f, std::min<float>(box.x1, max_x)),
+                std::max<float>(0.0f, std::min<float>(box.y1, max_y))};
+    }
+
+    static inline float iou(const Box &a, const Box &b, float coordinates_offset) {
+        if (!(a.x0 <= b.x1 && a.y0 <= b.y1 && b.x0 <= a.x1 && b.y0 <= a.y1))
+            return 0.0f;
+
+        // intersection area
+        const float width  = std::max<float>(0.0f, std::min(a.x1, b.x1) - std::max(a.x0, b.x0) + coordinates_offset);
+        const float height = std::max<float>(0.0f, std::min(a.y1, b.y1) - std::max(a.y0, b.y0) + coordinates_offset);
+        const float area   = width * height;
+
+        const float A_area = (a.x1 - a.x0 + coordinates_offset) * (a.y1 - a.y0 + coordinates_offset);
+        const float B_area = (b.x1 - b.x0 + coordinates_offset) * (b.y1 - b.y0 + coordinates_offset);
+
+        return area / (A_area + B_area - area);
+    }
+
+    /**
+     * Finds the indices of the topn items with the highest scores (scores[i * stride]) and sorts them by the score,
+     * the equal scores by the index. The key of the topn-th score is found by the radix select over the 11-bit digits
+     * with the parallel histograms, the items above it are gathered in parallel, so only the selected ones are sorted.
+     * @param keys - the scratch of count keys
+     */
+    static void select_topn(const float *scores, int stride, int count, int topn,
+                            std::vector<uint32_t> &keys, int *order) {
+        if (topn <= 0)
+            return;
+
+        const int digit_bits = 11;
+        const int num_bins = 1 << digit_bits;
+
+        keys.resize(count);
+        parallel_for(count, [&](int i) {
+            keys[i] = score_key(scores[static_cast<size_t>(i) * stride]);
+        });
+
+        uint32_t prefix = 0;
+        uint32_t prefix_mask = 0;
+        int remaining = topn;
+        std::vector<int> hist(num_bins);
+        for (int shift = 32 - digit_bits; ; shift = std::max(shift - digit_bits, 0)) {
+            std::fill(hist.begin(), hist.end(), 0);
+            std::mutex hist_mutex;
+            parallel_nt(0, [&](int ithr, int nthr) {
+                std::vector<int> local_hist(num_bins, 0);
+                for_1d(ithr, nthr, count, [&](int i) {
+                    if ((keys[i] & prefix_mask) == prefix)
+                        local_hist[(keys[i] >> shift) & (num_bins - 1)]++;
+                });
+                std::lock_guard<std::mutex> lock(hist_mutex);
+                for (int bin = 0; bin < num_bins; bin++)
+                    hist[bin] += local_hist[bin];
+            });
+
+            int bin = num_bins - 1;
+            for (; bin > 0 && hist[bin] < remaining; bin--)
+                remaining -= hist[bin];
+
+            prefix |= static_cast<uint32_t>(bin) << shift;
+            prefix_mask |= static_cast<uint32_t>(num_bins - 1) << shift;
+            if (shift == 0)
+                break;
+        }
+
+        // the items above the threshold are all taken, the equal ones are taken in the order of the indices
+        const uint32_t threshold = prefix;
+        const int num_chunks = std::min(64, std::max(1, count));
+        const int chunk_size = (count + num_chunks - 1) / num_chunks;
+        std::vector<int> greater(num_chunks + 1, 0);
+        std::vector<int> equal(num_chunks + 1, 0);
+
+        parallel_for(num_chunks, [&](int chunk) {
+            int end = std::min(count, (chunk + 1) * chunk_size);
+            for (int i = chunk * chunk_size; i < end; i++) {
+                greater[chunk + 1] += keys[i] > threshold;
+                equal[chunk + 1] += keys[i] == threshold;
+            }
+        });
+        for (int chunk = 0; chunk < num_chunks; chunk++) {
+            greater[chunk + 1] += greater[chunk];
+            equal[chunk + 1] += equal[chunk];
+        }
+
+        parallel_for(num_chunks, [&](int chunk) {
+            int end = std::min(count, (chunk + 1) * chunk_size);
+            int out = greater[chunk] + std::min(equal[chunk], remaining);
+            int taken_equal = equal[chunk];
+            for (int i = chunk * chunk_size; i < end; i++) {
+                if (keys[i] > threshold) {
+                    order[out++] = i;
+                } else if (keys[i] == threshold && taken_equal < remaining) {
+                    order[out++] = i;
+                    taken_equal++;
+                }
+            }
+        });
+
+        std::sort(order, order + topn, [scores, stride](int a, int b) {
+            const float score_a = scores[static_cast<size_t>(a) * stride];
+            const float score_b = scores[static_cast<size_t>(b) * stride];
+            return score_a > score_b || (score_a == score_b && a < b);
+        });
+    }
+
+    /**
+     * The greedy non-maximum suppression of the boxes sorted by the score: a box is kept unless its IoU with a kept
+     * box is above nms_thresh. The kept indices (plus base_index) are written to index_out, at most max_num_out.
+     * @param boxes - the planar boxes
+     * @param is_dead - the scratch of num_boxes flags
+     * @return the number of the kept boxes
+     */
+    static int nms(const float *boxes, int num_boxes, int *is_dead, int *index_out, int base_index,
+                   float nms_thresh, int max_num_out, float coordinates_offset) {
+        int count = 0;
+
+        const float* x0 = boxes + 0 * num_boxes;
+        const float* y0 = boxes + 1 * num_boxes;
+        const float* x1 = boxes + 2 * num_boxes;
+        const float* y1 = boxes + 3 * num_boxes;
+
+        memset(is_dead, 0, num_boxes * sizeof(int));
+
+#if defined(HAVE_AVX512F)
+        __m512  vc_fone = _mm512_set1_ps(coordinates_offset);
+        __m512i vc_ione = _mm512_set1_epi32(1);
+        __m512  vc_zero = _mm512_set1_ps(0.0f);
+
+        __m512 vc_nms_thresh = _mm512_set1_ps(nms_thresh);
+#elif defined(HAVE_AVX2)
+        __m256  vc_fone = _mm256_set1_ps(coordinates_offset);
+        __m256i vc_ione = _mm256_set1_epi32(1);
+        __m256  vc_zero = _mm256_set1_ps(0.0f);
+
+        __m256 vc_nms_thresh = _mm256_set1_ps(nms_thresh);
+#endif
+
+        for (int box = 0; box < num_boxes; ++box) {
+            if (is_dead[box])
+                continue;
+
+            index_out[count++] = base_index + box;
+            if (count == max_num_out)
+                break;
+
+            int tail = box + 1;
+
+#if defined(HAVE_AVX512F)
+            __m512 vx0i = _mm512_set1_ps(x0[box]);
+            __m512 vy0i = _mm512_set1_ps(y0[box]);
+            __m512 vx1i = _mm512_set1_ps(x1[box]);
+            __m512 vy1i = _mm512_set1_ps(y1[box]);
+
+            __m512 vA_width  = _mm512_sub_ps(vx1i, vx0i);
+            __m512 vA_height = _mm512_sub_ps(vy1i, vy0i);
+            __m512 vA_area   = _mm512_mul_ps(_mm512_add_ps(vA_width, vc_fone), _mm512_add_ps(vA_height, vc_fone));
+
+            for (; tail <= num_boxes - 16; tail += 16) {
+                __m512 vx0j = _mm512_loadu_ps(x0 + tail);
+                __m512 vy0j = _mm512_loadu_ps(y0 + tail);
+                __m512 vx1j = _mm512_loadu_ps(x1 + tail);
+                __m512 vy1j = _mm512_loadu_ps(y1 + tail);
+
+                __m512 vx0 = _mm512_max_ps(vx0i, vx0j);
+                __m512 vy0 = _mm512_max_ps(vy0i, vy0j);
+                __m512 vx1 = _mm512_min_ps(vx1i, vx1j);
+                __m512 vy1 = _mm512_min_ps(vy1i, vy1j);
+
+                __m512 vwidth  = _mm512_add_ps(_mm512_sub_ps(vx1, vx0), vc_fone);
+                __m512 vheight = _mm512_add_ps(_mm512_sub_ps(vy1, vy0), vc_fone);
+                __m512 varea = _mm512_mul_ps(_mm512_max_ps(vc_zero, vwidth), _mm512_max_ps(vc_zero, vheight));
+
+                __m512 vB_width  = _mm512_sub_ps(vx1j, vx0j);
+                __m512 vB_height = _mm512_sub_ps(vy1j, vy0j);
+                __m512 vB_area   = _mm512_mul_ps(_mm512_add_ps(vB_width, vc_fone), _mm512_add_ps(vB_height, vc_fone));
+
+                __m512 vdivisor = _mm512_sub_ps(_mm512_add_ps(vA_area, vB_area), varea);
+                __m512 vintersection_area = _mm512_div_ps(varea, vdivisor);
+
+                __mmask16 vcmp = _mm512_cmp_ps_mask(vx0i, vx1j, _CMP_LE_OS);
+                vcmp = _mm512_mask_cmp_ps_mask(vcmp, vy0i, vy1j, _CMP_LE_OS);
+                vcmp = _mm512_mask_cmp_ps_mask(vcmp, vx0j, vx1i, _CMP_LE_OS);
+                vcmp = _mm512_mask_cmp_ps_mask(vcmp, vy0j, vy1i, _CMP_LE_OS);
+                vcmp = _mm512_mask_cmp_ps_mask(vcmp, vc_nms_thresh, vintersection_area, _CMP_LT_OS);
+
+                _mm512_mask_storeu_epi32(is_dead + tail, vcmp, vc_ione);
+            }
+#elif defined(HAVE_AVX2)
+            __m256 vx0i = _mm256_set1_ps(x0[box]);
+            __m256 vy0i = _mm256_set1_ps(y0[box]);
+            __m256 vx1i = _mm256_set1_ps(x1[box]);
+            __m256 vy1i = _mm256_set1_ps(y1[box]);
+
+            __m256 vA_width  = _mm256_sub_ps(vx1i, vx0i);
+            __m256 vA_height = _mm256_sub_ps(vy1i, vy0i);
+            __m256 vA_area   = _mm256_mul_ps(_mm256_add_ps(vA_width, vc_fone), _mm256_add_ps(vA_height, vc_fone));
+
+            for (; tail <= num_boxes - 8; tail += 8) {
+                __m256i *pdst = reinterpret_cast<__m256i*>(is_dead + tail);
+                __m256i  vdst = _mm256_loadu_si256(pdst);
+
+                __m256 vx0j = _mm256_loadu_ps(x0 + tail);
+                __m256 vy0j = _mm256_loadu_ps(y0 + tail);
+                __m256 vx1j = _mm256_loadu_ps(x1 + tail);
+                __m256 vy1j = _mm256_loadu_ps(y1 + tail);
+
+                __m256 vx0 = _mm256_max_ps(vx0i, vx0j);
+                __m256 vy0 = _mm256_max_ps(vy0i, vy0j);
+                __m256 vx1 = _mm256_min_ps(vx1i, vx1j);
+                __m256 vy1 = _mm256_min_ps(vy1i, vy1j);
+
+                __m256 vwidth  = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_fone);
+                __m256 vheight = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_fone);
+                __m256 varea = _mm256_mul_ps(_mm256_max_ps(vc_zero, vwidth), _mm256_max_ps(vc_zero, vheight));
+
+                __m256 vB_width  = _mm256_sub_ps(vx1j, vx0j);
+                __m256 vB_height = _mm256_sub_ps(vy1j, vy0j);
+                __m256 vB_area   = _mm256_mul_ps(_mm256_add_ps(vB_width, vc_fone), _mm256_add_ps(vB_height, vc_fone));
+
+                __m256 vdivisor = _mm256_sub_ps(_mm256_add_ps(vA_area, vB_area), varea);
+                __m256 vintersection_area = _mm256_div_ps(varea, vdivisor);
+
+                __m256 vcmp_0 = _mm256_cmp_ps(vx0i, vx1j, _CMP_LE_OS);
+                __m256 vcmp_1 = _mm256_cmp_ps(vy0i, vy1j, _CMP_LE_OS);
+                __m256 vcmp_2 = _mm256_cmp_ps(vx0j, vx1i, _CMP_LE_OS);
+                __m256 vcmp_3 = _mm256_cmp_ps(vy0j, vy1i, _CMP_LE_OS);
+                __m256 vcmp_4 = _mm256_cmp_ps(vc_nms_thresh, vintersection_area, _CMP_LT_OS);
+
+                vcmp_0 = _mm256_and_ps(vcmp_0, vcmp_1);
+                vcmp_2 = _mm256_and_ps(vcmp_2, vcmp_3);
+                vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_0);
+                vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_2);
+
+                _mm256_storeu_si256(pdst, _mm256_blendv_epi8(vdst, vc_ione, _mm256_castps_si256(vcmp_4)));
+            }
+#endif
+
+            const Box box_i = {x0[box], y0[box], x1[box], y1[box]};
+            for (; tail < num_boxes; ++tail) {
+                const Box box_j = {x0[tail], y0[tail], x1[tail], y1[tail]};
+                if (nms_thresh < iou(box_i, box_j, coordinates_offset))
+                    is_dead[tail] = 1;
+            }
+        }
+
+        return count;
+    }
+
+private:
+    // Maps the float to the unsigned key having the same order
+    static inline uint32_t score_key(float score) {
+        uint32_t bits;
+        std::memcpy(&bits, &score, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+};
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
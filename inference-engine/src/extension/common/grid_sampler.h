@@ -0,0 +1,103 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "defs.h"
+#include <immintrin.h>
+#include <cmath>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * The bilinear sampling of the planes of an image at a set of points (the grid of SpatialTransformer and GridSample).
+ * The four taps of every point are computed once by prepare and are shared by all the channels, the channels only
+ * gather the taps (with the AVX2 gathers when available) and sum them with the weights. The taps outside the image
+ * have zero weights, so the border of the image fades to zero.
+ */
+class GridSampler {
+public:
+    /**
+     * Sets the points y[i], x[i] in the pixels of the height x width image, the pixel (m, n) is at y = m, x = n
+     */
+    void prepare(const float *y, const float *x, int count, int height, int width) {
+        points = count;
+        offsets.assign(4 * static_cast<size_t>(count), 0);
+        weights.assign(4 * static_cast<size_t>(count), 0.0f);
+
+        for (int i = 0; i < count; i++) {
+            // the points far outside (and the NaNs) have no taps, the rest are safe to convert to int
+            if (!(y[i] > -1.0f && y[i] < static_cast<float>(height) && x[i] > -1.0f && x[i] < static_cast<float>(width)))
+                continue;
+            const float fy = std::floor(y[i]);
+            const float fx = std::floor(x[i]);
+            const int m = static_cast<int>(fy);
+            const int n = static_cast<int>(fx);
+            const float dy = y[i] - fy;
+            const float dx = x[i] - fx;
+
+            const int rows[4] = {m, m, m + 1, m + 1};
+            const int cols[4] = {n, n + 1, n, n + 1};
+            const float tapWeights[4] = {(1 - dy) * (1 - dx), (1 - dy) * dx, dy * (1 - dx), dy * dx};
+            for (int k = 0; k < 4; k++) {
+                if (rows[k] < 0 || rows[k] >= height || cols[k] < 0 || cols[k] >= width)
+                    continue;
+                offsets[k * static_cast<size_t>(count) + i] = rows[k] * width + cols[k];
+                weights[k * static_cast<size_t>(count) + i] = tapWeights[k];
+            }
+        }
+    }
+
+    /**
+     * dst[i] = the plane src sampled at the point i, for the points [begin, end)
+     */
+    void sample(const float *src, float *dst, int begin, int end) const {
+        const int *o0 = offsets.data(), *o1 = o0 + points, *o2 = o1 + points, *o3 = o2 + points;
+        const float *w0 = weights.data(), *w1 = w0 + points, *w2 = w1 + points, *w3 = w2 + points;
+
+        int i = begin;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        for (; i <= end - 8; i += 8) {
+            __m256 acc = _mm256_mul_ps(_mm256_loadu_ps(w0 + i), gather(src, o0 + i));
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(w1 + i), gather(src, o1 + i)));
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(w2 + i), gather(src, o2 + i)));
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(w3 + i), gather(src, o3 + i)));
+            _mm256_storeu_ps(dst + i, acc);
+        }
+#endif
+        for (; i <= end - 4; i += 4) {
+            __m128 acc = _mm_mul_ps(_mm_loadu_ps(w0 + i), _mm_setr_ps(src[o0[i]], src[o0[i + 1]], src[o0[i + 2]],
+                                                                       src[o0[i + 3]]));
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(w1 + i), _mm_setr_ps(src[o1[i]], src[o1[i + 1]],
+                                                                               src[o1[i + 2]], src[o1[i + 3]])));
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(w2 + i), _mm_setr_ps(src[o2[i]], src[o2[i + 1]],
+                                                                               src[o2[i + 2]], src[o2[i + 3]])));
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(w3 + i), _mm_setr_ps(src[o3[i]], src[o3[i + 1]],
+                                                                               src[o3[i + 2]], src[o3[i + 3]])));
+            _mm_storeu_ps(dst + i, acc);
+        }
+        for (; i < end; i++)
+            dst[i] = w0[i] * src[o0[i]] + w1[i] * src[o1[i]] + w2[i] * src[o2[i]] + w3[i] * src[o3[i]];
+    }
+
+private:
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline __m256 gather(const float *src, const int *offset) {
+        return _mm256_i32gather_ps(src, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(offset)), 4);
+    }
+#endif
+
+    int points = 0;
+    // the tap k of the point i is at k * points + i
+    std::vector<int> offsets;
+    std::vector<float> weights;
+};
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,106 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_layers.h>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * The outputs of PriorBox and PriorBoxClustered depend only on the parameters of the layer and the shapes of its
+ * inputs. They are generated once per key and shared read-only by the graphs and the requests of the process
+ * (the streams, the dynamic batch and the reshaped graphs, the other loads of the network), the layers only copy
+ * them to their outputs. An entry lives while a layer refers to it.
+ */
+class PriorsCache {
+public:
+    typedef std::shared_ptr<const std::vector<float>> Ptr;
+
+    /**
+     * Returns the priors of the key, the missing ones are generated by fill into the vector of the given size
+     */
+    static Ptr get(const std::string &key, size_t size, const std::function<void(float *)> &fill) {
+        static std::mutex mutex;
+        static std::map<std::string, std::weak_ptr<const std::vector<float>>> entries;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            Ptr priors = it->second.lock();
+            if (priors && priors->size() == size)
+                return priors;
+        }
+
+        // the priors of the released networks are dropped
+        for (auto entry = entries.begin(); entry != entries.end();) {
+            if (entry->second.expired())
+                entry = entries.erase(entry);
+            else
+                ++entry;
+        }
+
+        std::shared_ptr<std::vector<float>> priors = std::make_shared<std::vector<float>>(size, 0.0f);
+        fill(priors->data());
+        entries[key] = priors;
+        return priors;
+    }
+
+    /**
+     * The key of the parameters of the layer, the shapes are appended to it by the layer
+     */
+    static std::string layerKey(const CNNLayer *layer) {
+        std::string key = layer->type;
+        for (const auto &param : layer->params)
+            key += '\n' + param.first + '=' + param.second;
+        return key;
+    }
+};
+
+/**
+ * The priors of a layer for the last shapes it was executed with
+ */
+class LayerPriors {
+public:
+    explicit LayerPriors(const CNNLayer *layer) : key(PriorsCache::layerKey(layer)) {}
+
+    /**
+     * Copies the priors of the shapes to dst, they are generated by fill only if no graph has them yet
+     */
+    void copy(const std::vector<size_t> &shapes, float *dst, size_t size, const std::function<void(float *)> &fill) {
+        PriorsCache::Ptr current;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!priors || shapes != lastShapes || priors->size() != size) {
+                std::string shapesKey = key;
+                for (size_t dim : shapes)
+                    shapesKey += ' ' + std::to_string(dim);
+                priors = PriorsCache::get(shapesKey, size, fill);
+                lastShapes = shapes;
+            }
+            current = priors;
+        }
+        std::memcpy(dst, current->data(), size * sizeof(float));
+    }
+
+private:
+    std::string key;
+    std::mutex mutex;
+    std::vector<size_t> lastShapes;
+    PriorsCache::Ptr priors;
+};
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
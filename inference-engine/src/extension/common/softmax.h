@@ -16,13 +16,12 @@
 #endif
 
 #include <cmath>
-#include <omp.h>
+#include <ie_parallel_for.hpp>
 #include "defs.h"
 
 static inline
 void softmax_many_batches(const float *src_data, float *dst_data, int B, int C, int H, int W) {
-    #pragma omp parallel for schedule(static)
-    for (int i = 0; i < B * H * W; i++) {
+    InferenceEngine::parallel_for(B * H * W, [&](int i) {
         const float *psrc = src_data + (i / (H * W)) * C * H * W - (i / (H * W)) * H * W;
         float *pdst = dst_data + (i / (H * W)) * C * H * W - (i / (H * W)) * H * W;
 
@@ -41,15 +40,15 @@ void softmax_many_batches(const float *src_data, float *dst_data, int B, int C,
         for (int c = 0; c < C; c++) {
             pdst[c * H * W + i] = pdst[c * H * W + i] / expSum;
         }
-    }
+    });
 }
 
 static inline
 void softmax_generic(const float *src_data, float *dst_data, int B, int C, int H, int W) {
     for (int b = 0; b < B; b++) {
 #if defined(HAVE_AVX2)
-        #pragma omp parallel for schedule(static)
-        for (int i = 0; i <= H*W - 8; i += 8) {
+        InferenceEngine::parallel_for(H*W / 8, [&](int v) {
+            const int i = v * 8;
             __m256 vmax = _mm256_loadu_ps(src_data + b*C*H*W + i);
             for (int c = 0; c < C; c++) {
                 __m256 vval = _mm256_loadu_ps(src_data + b*C*H*W + c*H*W + i);
@@ -73,10 +72,10 @@ void softmax_generic(const float *src_data, float *dst_data, int B, int C, int H
                 __m256 vval = _mm256_loadu_ps(dst_data + b*C*H*W + c*H*W + i);
                 _mm256_storeu_ps(dst_data + b*C*H*W + c*H*W + i, _mm256_div_ps(vval, vexpSum));
             }
-        }
+        });
 #elif defined(HAVE_SSE)
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i <= H*W - 4; i += 4) {
+        InferenceEngine::parallel_for(H*W / 4, [&](int v) {
+            const int i = v * 4;
             __m128 vmax = _mm_loadu_ps(src_data + b*C*H*W + i);
             for (int c = 0; c < C; c++) {
                 __m128 vval = _mm_loadu_ps(src_data + b*C*H*W + c*H*W + i);
@@ -100,7 +99,7 @@ void softmax_generic(const float *src_data, float *dst_data, int B, int C, int H
                 __m128 vval = _mm_loadu_ps(dst_data + b*C*H*W + c*H*W + i);
                 _mm_storeu_ps(dst_data + b*C*H*W + c*H*W + i, _mm_div_ps(vval, vexpSum));
             }
-        }
+        });
 #endif
 
 #if defined(HAVE_AVX2)
@@ -12,11 +12,17 @@
 #include <cmath>
 #include <utility>
 #include <functional>
+#include <limits>
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+// The pixels of the planar argmax a thread keeps the running max of, they stay in L1 while the channels are swept
+const int pixels_block = 256;
+// The rows of at least so many elements are selected through a heap of the top_k_ elements instead of a sort
+const int heap_min_dim = 1000;
+
 class ArgMaxImpl: public ExtLayerBase {
 public:
     explicit ArgMaxImpl(const CNNLayer* layer) {
@@ -31,6 +37,17 @@ public:
             axis_index_ = has_axis_ ?
                                 std::stoi(layer->params.at("axis")) :0;
 
+            // The channel argmax of the 4D maps also reads the blocked output of the convolutions without a reorder
+            SizeVector in_dims = layer->insData[0].lock()->getTensorDesc().getDims();
+            int axis = axis_index_ < 0 ? axis_index_ + static_cast<int>(in_dims.size()) : axis_index_;
+            if (has_axis_ && axis == 1 && top_k_ == 1 && in_dims.size() == 4) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(ConfLayout::PLN)});
+            }
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
@@ -52,36 +69,18 @@ public:
             axis_dist = 1;
         }
 
-        float* src_data = inputs[0]->buffer();
+        const float* src_data = inputs[0]->buffer();
         float* dst_data = outputs[0]->buffer();
 
         int num = count(in_dims) / dim;
-        std::vector<std::pair<float, int> > src_vector(dim);
-
-        for (int i = 0; i < num; ++i) {
-            for (int j = 0; j < dim; ++j) {
-                src_vector[j] = std::make_pair(
-                        src_data[(i / axis_dist * dim + j) * axis_dist + i % axis_dist], j);
-            }
 
-            std::partial_sort(src_vector.begin(), src_vector.begin() + top_k_,
-                              src_vector.end(), std::greater<std::pair<float, int> >());
-
-            for (int j = 0; j < top_k_; ++j) {
-                if (out_max_val_) {
-                    if (has_axis_) {
-                        // Produces max_val per axis
-                        dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].first;
-                    } else {
-                        // Produces max_ind and max_val
-                        dst_data[2 * i * top_k_ + j] = src_vector[j].second;
-                        dst_data[2 * i * top_k_ + top_k_ + j] = src_vector[j].first;
-                    }
-                } else {
-                    // Produces max_ind per axis
-                    dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].second;
-                }
-            }
+        if (inputs[0]->getTensorDesc().getLayout() == Layout::BLOCKED) {
+            int blk = static_cast<int>(inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims().back());
+            argmax_blocked(src_data, dst_data, static_cast<int>(in_dims[0]), dim, axis_dist, blk);
+        } else if (top_k_ == 1 && axis_dist > 1) {
+            argmax_planar(src_data, dst_data, num / axis_dist, dim, axis_dist);
+        } else {
+            topk_rows(src_data, dst_data, num, dim, axis_dist);
         }
 
         return OK;
@@ -93,6 +92,220 @@ private:
     bool has_axis_;
     int axis_index_;
 
+    // All the paths pick the larger index among the equal values, like the sort of the (value, index) pairs
+    inline void store(float* dst, int i, int axis_dist, int j, float value, int index) {
+        if (out_max_val_) {
+            if (has_axis_) {
+                // Produces max_val per axis
+                dst[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = value;
+            } else {
+                // Produces max_ind and max_val
+                dst[2 * i * top_k_ + j] = static_cast<float>(index);
+                dst[2 * i * top_k_ + top_k_ + j] = value;
+            }
+        } else {
+            // Produces max_ind per axis
+            dst[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = static_cast<float>(index);
+        }
+    }
+
+    // The argmax over the channels of the planar maps: the channels are swept over the contiguous pixels of a block,
+    // so the running max of the pixels is kept in the vector registers and the loads are never strided
+    void argmax_planar(const float* src, float* dst, int outer, int dim, int axis_dist) {
+        int blocks = (axis_dist + pixels_block - 1) / pixels_block;
+        parallel_nd(outer, blocks, [&](int n, int b) {
+            int p0 = b * pixels_block;
+            int len = std::min(pixels_block, axis_dist - p0);
+            const float* psrc = src + static_cast<size_t>(n) * dim * axis_dist + p0;
+            float* pdst = dst + static_cast<size_t>(n) * axis_dist + p0;
+
+            float max_val[pixels_block];
+            float max_ind[pixels_block];
+            for (int p = 0; p < len; p++) {
+                max_val[p] = psrc[p];
+                max_ind[p] = 0.f;
+            }
+
+            for (int c = 1; c < dim; c++) {
+                const float* psrc_c = psrc + static_cast<size_t>(c) * axis_dist;
+                int p = 0;
+#if defined(HAVE_AVX512F)
+                __m512 vc = _mm512_set1_ps(static_cast<float>(c));
+                for (; p <= len - 16; p += 16) {
+                    __m512 vsrc = _mm512_loadu_ps(psrc_c + p);
+                    __mmask16 ge = _mm512_cmp_ps_mask(vsrc, _mm512_loadu_ps(max_val + p), _CMP_GE_OS);
+                    _mm512_storeu_ps(max_val + p, _mm512_mask_blend_ps(ge, _mm512_loadu_ps(max_val + p), vsrc));
+                    _mm512_storeu_ps(max_ind + p, _mm512_mask_blend_ps(ge, _mm512_loadu_ps(max_ind + p), vc));
+                }
+#elif defined(HAVE_AVX2)
+                __m256 vc = _mm256_set1_ps(static_cast<float>(c));
+                for (; p <= len - 8; p += 8) {
+                    __m256 vsrc = _mm256_loadu_ps(psrc_c + p);
+                    __m256 vmax = _mm256_loadu_ps(max_val + p);
+                    __m256 ge = _mm256_cmp_ps(vsrc, vmax, _CMP_GE_OS);
+                    _mm256_storeu_ps(max_val + p, _mm256_blendv_ps(vmax, vsrc, ge));
+                    _mm256_storeu_ps(max_ind + p, _mm256_blendv_ps(_mm256_loadu_ps(max_ind + p), vc, ge));
+                }
+#elif defined(HAVE_SSE)
+                __m128 vc = _mm_set1_ps(static_cast<float>(c));
+                for (; p <= len - 4; p += 4) {
+                    __m128 vsrc = _mm_loadu_ps(psrc_c + p);
+                    __m128 vmax = _mm_loadu_ps(max_val + p);
+                    __m128 ge = _mm_cmpge_ps(vsrc, vmax);
+                    _mm_storeu_ps(max_val + p, _mm_blendv_ps(vmax, vsrc, ge));
+                    _mm_storeu_ps(max_ind + p, _mm_blendv_ps(_mm_loadu_ps(max_ind + p), vc, ge));
+                }
+#endif
+                for (; p < len; p++) {
+                    if (psrc_c[p] >= max_val[p]) {
+                        max_val[p] = psrc_c[p];
+                        max_ind[p] = static_cast<float>(c);
+                    }
+                }
+            }
+
+            const float* res = out_max_val_ ? max_val : max_ind;
+            for (int p = 0; p < len; p++)
+                pdst[p] = res[p];
+        });
+    }
+
+    // The argmax over the channels of the nChw8c/nChw16c maps: the lanes of the full channel blocks are compared
+    // at once, then the lanes and the channels of the padded tail block are reduced per pixel
+    void argmax_blocked(const float* src, float* dst, int N, int dim, int axis_dist, int blk) {
+        int full_blocks = dim / blk;
+        int blocks = (dim + blk - 1) / blk;
+        parallel_nd(N, axis_dist, [&](int n, int p) {
+            const float* psrc = src + (static_cast<size_t>(n) * blocks * axis_dist + p) * blk;
+            size_t block_stride = static_cast<size_t>(axis_dist) * blk;
+
+            float max_val = -std::numeric_limits<float>::infinity();
+            int max_ind = -1;
+
+            if (full_blocks > 0) {
+                float lane_val[16];
+                int lane_blk[16];
+                for (int l = 0; l < blk; l++) {
+                    lane_val[l] = psrc[l];
+                    lane_blk[l] = 0;
+                }
+                int cb = 1;
+#if defined(HAVE_AVX512F)
+                if (blk == 16) {
+                    __m512 vmax = _mm512_loadu_ps(lane_val);
+                    __m512 vblk = _mm512_setzero_ps();
+                    for (; cb < full_blocks; cb++) {
+                        __m512 vsrc = _mm512_loadu_ps(psrc + cb * block_stride);
+                        __mmask16 ge = _mm512_cmp_ps_mask(vsrc, vmax, _CMP_GE_OS);
+                        vmax = _mm512_mask_blend_ps(ge, vmax, vsrc);
+                        vblk = _mm512_mask_blend_ps(ge, vblk, _mm512_set1_ps(static_cast<float>(cb)));
+                    }
+                    float fblk[16];
+                    _mm512_storeu_ps(lane_val, vmax);
+                    _mm512_storeu_ps(fblk, vblk);
+                    for (int l = 0; l < 16; l++) lane_blk[l] = static_cast<int>(fblk[l]);
+                }
+#elif defined(HAVE_AVX2)
+                if (blk == 8) {
+                    __m256 vmax = _mm256_loadu_ps(lane_val);
+                    __m256 vblk = _mm256_setzero_ps();
+                    for (; cb < full_blocks; cb++) {
+                        __m256 vsrc = _mm256_loadu_ps(psrc + cb * block_stride);
+                        __m256 ge = _mm256_cmp_ps(vsrc, vmax, _CMP_GE_OS);
+                        vmax = _mm256_blendv_ps(vmax, vsrc, ge);
+                        vblk = _mm256_blendv_ps(vblk, _mm256_set1_ps(static_cast<float>(cb)), ge);
+                    }
+                    float fblk[8];
+                    _mm256_storeu_ps(lane_val, vmax);
+                    _mm256_storeu_ps(fblk, vblk);
+                    for (int l = 0; l < 8; l++) lane_blk[l] = static_cast<int>(fblk[l]);
+                }
+#endif
+                for (; cb < full_blocks; cb++) {
+                    const float* psrc_cb = psrc + cb * block_stride;
+                    for (int l = 0; l < blk; l++) {
+                        if (psrc_cb[l] >= lane_val[l]) {
+                            lane_val[l] = psrc_cb[l];
+                            lane_blk[l] = cb;
+                        }
+                    }
+                }
+
+                for (int l = 0; l < blk; l++) {
+                    int c = lane_blk[l] * blk + l;
+                    if (lane_val[l] > max_val || (lane_val[l] == max_val && c > max_ind)) {
+                        max_val = lane_val[l];
+                        max_ind = c;
+                    }
+                }
+            }
+
+            // the padded lanes of the tail block are not the channels
+            const float* psrc_tail = psrc + full_blocks * block_stride;
+            for (int c = full_blocks * blk; c < dim; c++) {
+                if (psrc_tail[c % blk] >= max_val || max_ind < 0) {
+                    max_val = psrc_tail[c % blk];
+                    max_ind = c;
+                }
+            }
+
+            dst[static_cast<size_t>(n) * axis_dist + p] = out_max_val_ ? max_val : static_cast<float>(max_ind);
+        });
+    }
+
+    // The top_k_ elements of the rows, the rows are split between the threads
+    void topk_rows(const float* src, float* dst, int num, int dim, int axis_dist) {
+        parallel_nt(0, [&](int ithr, int nthr) {
+            std::vector<std::pair<float, int> > src_vector;
+
+            for_1d(ithr, nthr, num, [&](int i) {
+                const float* psrc = src + static_cast<size_t>(i / axis_dist) * dim * axis_dist + i % axis_dist;
+
+                if (top_k_ == 1) {
+                    float max_val = psrc[0];
+                    int max_ind = 0;
+                    for (int j = 1; j < dim; j++) {
+                        if (psrc[static_cast<size_t>(j) * axis_dist] >= max_val) {
+                            max_val = psrc[static_cast<size_t>(j) * axis_dist];
+                            max_ind = j;
+                        }
+                    }
+                    store(dst, i, axis_dist, 0, max_val, max_ind);
+                    return;
+                }
+
+                if (dim >= heap_min_dim) {
+                    // the min-heap of the top_k_ pairs so far, most of the elements are rejected by its top
+                    src_vector.clear();
+                    for (int j = 0; j < top_k_; j++)
+                        src_vector.emplace_back(psrc[static_cast<size_t>(j) * axis_dist], j);
+                    std::make_heap(src_vector.begin(), src_vector.end(), std::greater<std::pair<float, int> >());
+                    for (int j = top_k_; j < dim; j++) {
+                        std::pair<float, int> elem(psrc[static_cast<size_t>(j) * axis_dist], j);
+                        if (elem > src_vector.front()) {
+                            std::pop_heap(src_vector.begin(), src_vector.end(),
+                                          std::greater<std::pair<float, int> >());
+                            src_vector.back() = elem;
+                            std::push_heap(src_vector.begin(), src_vector.end(),
+                                           std::greater<std::pair<float, int> >());
+                        }
+                    }
+                    std::sort_heap(src_vector.begin(), src_vector.end(), std::greater<std::pair<float, int> >());
+                } else {
+                    src_vector.resize(dim);
+                    for (int j = 0; j < dim; ++j)
+                        src_vector[j] = std::make_pair(psrc[static_cast<size_t>(j) * axis_dist], j);
+
+                    std::partial_sort(src_vector.begin(), src_vector.begin() + top_k_,
+                                      src_vector.end(), std::greater<std::pair<float, int> >());
+                }
+
+                for (int j = 0; j < top_k_; ++j)
+                    store(dst, i, axis_dist, j, src_vector[j].first, src_vector[j].second);
+            });
+        });
+    }
+
     inline int count(SizeVector dims, size_t start_ind, size_t end_ind) {
         size_t count = 1;
         for (size_t i = start_ind; i < end_ind; i++)
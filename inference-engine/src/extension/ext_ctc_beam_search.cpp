@@ -0,0 +1,191 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ext_list.hpp"
+#include "ext_base.hpp"
+
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * CTC prefix beam search decoder, the more accurate alternative of CTCGreedyDecoder with the same inputs and output:
+ * the probabilities [T, N, C] with the blank class C-1, the optional sequence indicators [T, N] (the sequence n ends
+ * before the first t > 0 of the 0 indicator) and the classes of the best prefix per sequence [N, T, 1, 1], padded
+ * with -1. The beam_width best prefixes are kept per time step, each extended with the beam_width most probable
+ * classes of the step. The repeated classes without the blank between them are merged when merge_repeated is 1.
+ */
+class CTCBeamSearchDecoderImpl: public ExtLayerBase {
+public:
+    explicit CTCBeamSearchDecoderImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.empty() || layer->insData.size() > 2 || layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
+
+            beam_width = layer->GetParamAsInt("beam_width", 10);
+            merge_repeated = static_cast<bool>(layer->GetParamAsInt("merge_repeated", 1));
+            if (beam_width <= 0)
+                THROW_IE_EXCEPTION << "Incorrect CTCBeamSearchDecoder beam_width!";
+
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() != 3)
+                THROW_IE_EXCEPTION << "CTCBeamSearchDecoder supports only 3D probabilities!";
+
+            std::vector<DataConfigurator> inps(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
+            addConfig(layer, inps, {DataConfigurator(ConfLayout::PLN)});
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc *resp) noexcept override {
+        const float* probabilities = inputs[0]->buffer();
+        const float* sequence_indicators = inputs.size() > 1 ? inputs[1]->buffer().as<const float*>() : nullptr;
+        float* output_sequences = outputs[0]->buffer();
+
+        int T = static_cast<int>(inputs[0]->getTensorDesc().getDims()[0]);
+        int N = static_cast<int>(inputs[0]->getTensorDesc().getDims()[1]);
+        int C = static_cast<int>(inputs[0]->getTensorDesc().getDims()[2]);
+
+        // The sequences are decoded independently, e.g. the text crops of an image
+        parallel_for(N, [&](int n) {
+            int len = 1;
+            while (len < T && (!sequence_indicators || sequence_indicators[len*N + n] != 0))
+                len++;
+
+            std::vector<int> best = decode(probabilities + n*C, N*C, len, C);
+
+            float* dst = output_sequences + static_cast<size_t>(n)*T;
+            for (int t = 0; t < T; t++)
+                dst[t] = t < static_cast<int>(best.size()) ? static_cast<float>(best[t]) : -1.f;
+        });
+        return OK;
+    }
+
+private:
+    int beam_width;
+    bool merge_repeated;
+
+    // The log probabilities of the prefix ending with the blank and with the last class of the prefix
+    struct Score {
+        float blank = -std::numeric_limits<float>::infinity();
+        float label = -std::numeric_limits<float>::infinity();
+    };
+
+    static float log_sum(float a, float b) {
+        if (a == -std::numeric_limits<float>::infinity()) return b;
+        if (b == -std::numeric_limits<float>::infinity()) return a;
+        return std::max(a, b) + std::log1p(std::exp(-std::fabs(a - b)));
+    }
+
+    static float total(const Score& score) {
+        return log_sum(score.blank, score.label);
+    }
+
+    std::vector<int> decode(const float* probs, int step, int len, int C) const {
+        int blank = C - 1;
+        int classes = std::min(beam_width, C - 1);
+
+        std::map<std::vector<int>, Score> beams;
+        beams[std::vector<int>()].blank = 0.f;
+
+        std::vector<int> order(C - 1);
+        std::vector<std::pair<const std::vector<int>*, float> > ranked;
+
+        for (int t = 0; t < len; t++) {
+            const float* p = probs + static_cast<size_t>(t)*step;
+            float log_blank = std::log(p[blank]);
+
+            // the steps are extended only with their most probable classes
+            for (int c = 0; c < C - 1; c++) order[c] = c;
+            std::partial_sort(order.begin(), order.begin() + classes, order.end(),
+                              [p](int a, int b) { return p[a] > p[b]; });
+
+            std::map<std::vector<int>, Score> next;
+            for (const auto& beam : beams) {
+                const std::vector<int>& prefix = beam.first;
+                const Score& score = beam.second;
+
+                Score& same = next[prefix];
+                same.blank = log_sum(same.blank, total(score) + log_blank);
+                if (!prefix.empty() && merge_repeated) {
+                    // the repeated last class collapses into the same prefix
+                    same.label = log_sum(same.label, score.label + std::log(p[prefix.back()]));
+                }
+
+                for (int k = 0; k < classes; k++) {
+                    int c = order[k];
+                    float log_c = std::log(p[c]);
+                    std::vector<int> extended(prefix);
+                    extended.push_back(c);
+
+                    Score& ext = next[extended];
+                    if (!prefix.empty() && merge_repeated && prefix.back() == c) {
+                        // the repeated class is a new label only after a blank
+                        ext.label = log_sum(ext.label, score.blank + log_c);
+                    } else {
+                        ext.label = log_sum(ext.label, total(score) + log_c);
+                    }
+                }
+            }
+
+            ranked.clear();
+            for (const auto& beam : next)
+                ranked.emplace_back(&beam.first, total(beam.second));
+            size_t kept = std::min(ranked.size(), static_cast<size_t>(beam_width));
+            std::partial_sort(ranked.begin(), ranked.begin() + kept, ranked.end(),
+                              [](const std::pair<const std::vector<int>*, float>& a,
+                                 const std::pair<const std::vector<int>*, float>& b) { return a.second > b.second; });
+
+            beams.clear();
+            for (size_t i = 0; i < kept; i++)
+                beams[*ranked[i].first] = next[*ranked[i].first];
+        }
+
+        const std::vector<int>* best = nullptr;
+        float best_score = -std::numeric_limits<float>::infinity();
+        for (const auto& beam : beams) {
+            if (best == nullptr || total(beam.second) > best_score) {
+                best = &beam.first;
+                best_score = total(beam.second);
+            }
+        }
+        return *best;
+    }
+};
+
+class CTCBeamSearchDecoderShapeInfer : public IShapeInferImpl {
+public:
+    StatusCode inferShapes(const std::vector<SizeVector>& inShapes,
+                           const std::map<std::string, std::string>& params,
+                           const std::map<std::string, Blob::Ptr>& blobs,
+                           std::vector<SizeVector>& outShapes,
+                           ResponseDesc* resp) noexcept override {
+        if (inShapes.empty() || inShapes[0].size() != 3) {
+            if (resp) {
+                std::string errorMsg = "Incorrect input shapes of CTCBeamSearchDecoder!";
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
+        }
+        outShapes.push_back({inShapes[0][1], inShapes[0][0], 1, 1});
+        return InferenceEngine::OK;
+    }
+};
+
+REG_FACTORY_FOR(ImplFactory<CTCBeamSearchDecoderImpl>, CTCBeamSearchDecoder);
+REG_SHAPE_INFER_FOR_TYPE(CTCBeamSearchDecoderShapeInfer, CTCBeamSearchDecoder);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -40,36 +40,25 @@ public:
             return GENERAL_ERROR;
         }
         const float* probabilities = inputs[0]->buffer();
-        const float* sequence_indicators = inputs[1]->buffer();
+        const float* sequence_indicators = inputs.size() > 1 ? inputs[1]->buffer().as<const float*>() : nullptr;
         float* output_sequences = outputs[0]->buffer();
 
         size_t T_ = inputs[0]->getTensorDesc().getDims()[0];
         size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
         size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
 
-        // Fill output_sequences with -1
-        for (size_t ii = 0; ii < T_*N_; ii++) {
-            output_sequences[ii] = -1;
-        }
+        // The sequences are decoded independently, e.g. the text crops of an image
+        parallel_for(N_, [&](size_t n) {
+            // Fill output_sequences with -1
+            for (size_t t = 0; t < T_; t++) {
+                output_sequences[n*T_ + t] = -1;
+            }
 
-        for (int n = 0; n < N_; ++n) {
             int prev_class_idx = -1;
             size_t output_index = n*T_;
 
-            for (int t = 0; /* check at end */; ++t) {
-                // get maximum probability and its index
-                int max_class_idx = 0;
-
-                const float* probs = probabilities + t*C_*N_ + n*C_;
-                float max_prob = probs[0];
-                ++probs;
-
-                for (int c = 1; c < C_; ++c, ++probs) {
-                    if (*probs > max_prob) {
-                        max_class_idx = c;
-                        max_prob = *probs;
-                    }
-                }
+            for (size_t t = 0; /* check at end */; ++t) {
+                int max_class_idx = max_index(probabilities + t*C_*N_ + n*C_, static_cast<int>(C_));
 
                 if (max_class_idx < C_-1 && max_class_idx != prev_class_idx) {
                     output_sequences[output_index] =  max_class_idx;
@@ -78,13 +67,57 @@ public:
 
                 prev_class_idx = max_class_idx;
 
-                if (t + 1 == T_ || sequence_indicators[(t + 1)*N_ + n] == 0) {
+                if (t + 1 == T_ || (sequence_indicators && sequence_indicators[(t + 1)*N_ + n] == 0)) {
                     break;
                 }
             }
-        }
+        });
         return OK;
     }
+
+private:
+    // Returns the index of the first maximum probability: the maximum is found with the vector registers,
+    // then the first class it is reached at
+    static int max_index(const float* probs, int C) {
+        float max_prob = probs[0];
+        int c = 1;
+#if defined(HAVE_AVX512F)
+        if (C >= 16) {
+            __m512 vmax = _mm512_loadu_ps(probs);
+            for (c = 16; c <= C - 16; c += 16)
+                vmax = _mm512_max_ps(vmax, _mm512_loadu_ps(probs + c));
+            max_prob = _mm512_reduce_max_ps(vmax);
+        }
+#elif defined(HAVE_AVX2)
+        if (C >= 8) {
+            __m256 vmax = _mm256_loadu_ps(probs);
+            for (c = 8; c <= C - 8; c += 8)
+                vmax = _mm256_max_ps(vmax, _mm256_loadu_ps(probs + c));
+            __m128 vmax4 = _mm_max_ps(_mm256_castps256_ps128(vmax), _mm256_extractf128_ps(vmax, 1));
+            vmax4 = _mm_max_ps(vmax4, _mm_movehl_ps(vmax4, vmax4));
+            vmax4 = _mm_max_ss(vmax4, _mm_movehdup_ps(vmax4));
+            max_prob = _mm_cvtss_f32(vmax4);
+        }
+#elif defined(HAVE_SSE)
+        if (C >= 4) {
+            __m128 vmax = _mm_loadu_ps(probs);
+            for (c = 4; c <= C - 4; c += 4)
+                vmax = _mm_max_ps(vmax, _mm_loadu_ps(probs + c));
+            vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+            vmax = _mm_max_ss(vmax, _mm_movehdup_ps(vmax));
+            max_prob = _mm_cvtss_f32(vmax);
+        }
+#endif
+        for (; c < C; c++) {
+            if (probs[c] > max_prob)
+                max_prob = probs[c];
+        }
+
+        int max_class_idx = 0;
+        while (max_class_idx < C - 1 && probs[max_class_idx] != max_prob)
+            max_class_idx++;
+        return max_class_idx;
+    }
 };
 
 REG_FACTORY_FOR(ImplFactory<CTCGreedyDecoderImpl>, CTCGreedyDecoder);
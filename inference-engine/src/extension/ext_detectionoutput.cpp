@@ -12,6 +12,7 @@
 #include <string>
 #include <utility>
 #include <algorithm>
+#include <immintrin.h>
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -105,6 +106,16 @@ public:
             _num_priors_actual = InferenceEngine::make_shared_blob<int>({Precision::UNSPECIFIED, num_priors_actual_size, C});
             _num_priors_actual->allocate();
 
+            _candidates_count = InferenceEngine::make_shared_blob<int>({Precision::UNSPECIFIED, detections_size, C});
+            _candidates_count->allocate();
+
+            InferenceEngine::SizeVector decode_mask_size{static_cast<size_t>(_num),
+                                                         static_cast<size_t>(_num_loc_classes),
+                                                         static_cast<size_t>(_num_priors)};
+            _decode_mask = InferenceEngine::make_shared_blob<int>(
+                    {Precision::UNSPECIFIED, decode_mask_size, {decode_mask_size, {0, 1, 2}}});
+            _decode_mask->allocate();
+
             addConfig(layer, {DataConfigurator(ConfLayout::PLN),
                        DataConfigurator(ConfLayout::PLN),
                        DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
@@ -130,16 +141,58 @@ public:
         int *buffer_data           = _buffer->buffer();
         int *indices_data          = _indices->buffer();
         int *num_priors_actual     = _num_priors_actual->buffer();
+        int *candidates_data       = _candidates_count->buffer();
+        int *decode_mask_data      = _decode_mask->buffer();
 
         const float *prior_variances = prior_data + _num_priors*_prior_size;
         const float *ppriors = prior_data;
 
+        for (int n = 0; n < N; ++n) {
+            num_priors_actual[n] = countPriors(ppriors);
+        }
+
+        parallel_nd(N, _num_classes, [&](int n, int c) {
+            const float *pconf = conf_data + n*_num_priors*_num_classes + c;
+            float *preordered = reordered_conf_data + n*_num_priors*_num_classes + c*_num_priors;
+            for (int p = 0; p < _num_priors; ++p) {
+                preordered[p] = pconf[p*_num_classes];
+            }
+        });
+
+        // the candidates (the priors of the confidence above the threshold) are found before the decoding,
+        // usually a few of them pass, so only their boxes are decoded
+        parallel_for(N*_num_classes, [&](int nc) {
+            const int n = nc / _num_classes;
+            const int c = nc % _num_classes;
+            if (c == _background_label_id) {
+                candidates_data[nc] = 0;
+                return;
+            }
+
+            const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+            int *pindices = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+            candidates_data[nc] = filterCandidates(pconf, pindices, num_priors_actual[n]);
+        });
+
+        memset(decode_mask_data, 0, N*_num_loc_classes*_num_priors*sizeof(int));
+
+        parallel_for(N, [&](int n) {
+            for (int c = 0; c < _num_classes; ++c) {
+                const int *pindices = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                int *pmask = decode_mask_data + n*_num_loc_classes*_num_priors + (_share_location ? 0 : c*_num_priors);
+                for (int i = 0; i < candidates_data[n*_num_classes + c]; ++i) {
+                    pmask[pindices[i]] = 1;
+                }
+            }
+        });
+
         for (int n = 0; n < N; ++n) {
             if (_share_location) {
                 const float *ploc = loc_data + n*4*_num_priors;
                 float *pboxes = decoded_bboxes_data + n*4*_num_priors;
                 float *psizes = bbox_sizes_data + n*_num_priors;
-                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
+                const int *pmask = decode_mask_data + n*_num_priors;
+                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, pmask, num_priors_actual[n]);
             } else {
                 for (int c = 0; c < _num_loc_classes; ++c) {
                     if (c == _background_label_id) {
@@ -149,55 +202,52 @@ public:
                     const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
                     float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
                     float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
-                }
-            }
-        }
-
-        for (int n = 0; n < N; ++n) {
-            for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
+                    const int *pmask = decode_mask_data + n*_num_loc_classes*_num_priors + c*_num_priors;
+                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, pmask, num_priors_actual[n]);
                 }
             }
         }
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-#pragma omp parallel for schedule(static)
-            for (int c = 0; c < _num_classes; ++c) {
-                if (c == _background_label_id) {
-                    // Ignore background class.
-                    continue;
-                }
+        // the classes of all the images are suppressed at once, the number of their candidates varies a lot,
+        // so the pairs are scheduled dynamically
+        parallel_for_dynamic(N*_num_classes, [&](int nc) {
+            const int n = nc / _num_classes;
+            const int c = nc % _num_classes;
+            if (c == _background_label_id) {
+                // Ignore background class.
+                return;
+            }
 
-                int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                int *pbuffer     = buffer_data + c*_num_priors;
-                int *pdetections = detections_data + n*_num_classes + c;
-
-                const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                const float *pboxes;
-                const float *psizes;
-                if (_share_location) {
-                    pboxes = decoded_bboxes_data + n*4*_num_priors;
-                    psizes = bbox_sizes_data + n*_num_priors;
-                } else {
-                    pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                    psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                }
+            int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+            int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+            int *pdetections = detections_data + n*_num_classes + c;
 
-                nms(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+            const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+            const float *pboxes;
+            const float *psizes;
+            if (_share_location) {
+                pboxes = decoded_bboxes_data + n*4*_num_priors;
+                psizes = bbox_sizes_data + n*_num_priors;
+            } else {
+                pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
             }
 
+            nms(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, candidates_data[nc]);
+        });
+
+        parallel_for(N, [&](int n) {
+            int detections_total = 0;
             for (int c = 0; c < _num_classes; ++c) {
                 detections_total += detections_data[n*_num_classes + c];
             }
 
             if (_keep_top_k > -1 && detections_total > _keep_top_k) {
+                // the min-heap of the best keep_top_k detections, its top is the worst of them
                 std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                conf_index_class_map.reserve(_keep_top_k);
 
                 for (int c = 0; c < _num_classes; ++c) {
                     int detections = detections_data[n*_num_classes + c];
@@ -206,18 +256,27 @@ public:
 
                     for (int i = 0; i < detections; ++i) {
                         int idx = pindices[i];
-                        conf_index_class_map.push_back(std::make_pair(pconf[idx], std::make_pair(c, idx)));
+                        if (static_cast<int>(conf_index_class_map.size()) < _keep_top_k) {
+                            conf_index_class_map.push_back(std::make_pair(pconf[idx], std::make_pair(c, idx)));
+                            std::push_heap(conf_index_class_map.begin(), conf_index_class_map.end(),
+                                           SortScorePairDescend<std::pair<int, int>>);
+                        } else if (_keep_top_k > 0 && pconf[idx] > conf_index_class_map.front().first) {
+                            std::pop_heap(conf_index_class_map.begin(), conf_index_class_map.end(),
+                                          SortScorePairDescend<std::pair<int, int>>);
+                            conf_index_class_map.back() = std::make_pair(pconf[idx], std::make_pair(c, idx));
+                            std::push_heap(conf_index_class_map.begin(), conf_index_class_map.end(),
+                                           SortScorePairDescend<std::pair<int, int>>);
+                        }
                     }
                 }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
-                conf_index_class_map.resize(_keep_top_k);
+                std::sort_heap(conf_index_class_map.begin(), conf_index_class_map.end(),
+                               SortScorePairDescend<std::pair<int, int>>);
 
                 // Store the new indices.
                 memset(detections_data + n*_num_classes, 0, _num_classes * sizeof(int));
 
-                for (int j = 0; j < conf_index_class_map.size(); ++j) {
+                for (size_t j = 0; j < conf_index_class_map.size(); ++j) {
                     int label = conf_index_class_map[j].second.first;
                     int idx = conf_index_class_map[j].second.second;
                     int *pindices = indices_data + n * _num_classes * _num_priors + label * _num_priors;
@@ -225,7 +284,7 @@ public:
                     detections_data[n*_num_classes + label]++;
                 }
             }
-        }
+        });
 
         const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
         if (DETECTION_SIZE != 7) {
@@ -316,11 +375,15 @@ private:
         CENTER_SIZE = 2,
     };
 
+    int countPriors(const float *prior_data);
+
+    int filterCandidates(const float *conf_data, int *indices, int num_priors_actual);
+
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
-                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n);
+                      float *decoded_bboxes, float *decoded_bbox_sizes, const int *decode_mask, int num_priors_actual);
 
     void nms(const float *conf_data, const float *bboxes, const float *sizes,
-             int *buffer, int *indices, int &detections, int num_priors_actual);
+             int *buffer, int *indices, int &detections, int count);
 
     InferenceEngine::Blob::Ptr _decoded_bboxes;
     InferenceEngine::Blob::Ptr _buffer;
@@ -329,6 +392,8 @@ private:
     InferenceEngine::Blob::Ptr _reordered_conf;
     InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
+    InferenceEngine::Blob::Ptr _candidates_count;
+    InferenceEngine::Blob::Ptr _decode_mask;
 };
 
 struct ConfidenceComparator {
@@ -380,27 +445,56 @@ static inline float JaccardOverlap(const float *decoded_bbox,
     return intersect_size / (bbox1_size + bbox2_size - intersect_size);
 }
 
-void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
-                                   const float *loc_data,
-                                   const float *variance_data,
-                                   float *decoded_bboxes,
-                                   float *decoded_bbox_sizes,
-                                   int* num_priors_actual,
-                                   int n) {
-    num_priors_actual[n] = _num_priors;
+int DetectionOutputImpl::countPriors(const float *prior_data) {
     if (!_normalized) {
-        int num = 0;
-        for (; num < _num_priors; ++num) {
+        for (int num = 0; num < _num_priors; ++num) {
             float batch_id = prior_data[num * _prior_size + 0];
             if (batch_id == -1.f) {
-                num_priors_actual[n] = num;
-                break;
+                return num;
             }
         }
     }
+    return _num_priors;
+}
+
+int DetectionOutputImpl::filterCandidates(const float *conf_data, int *indices, int num_priors_actual) {
+    int count = 0;
+    int i = 0;
+#if defined(HAVE_AVX2)
+    // the confidences are compared by 8, the most of them are below the threshold and skipped at once
+    const __m256 vc_conf_thresh = _mm256_set1_ps(_confidence_threshold);
+    for (; i <= num_priors_actual - 8; i += 8) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(conf_data + i), vc_conf_thresh, _CMP_GT_OS));
+        for (int j = 0; mask != 0; ++j, mask >>= 1) {
+            if (mask & 1) {
+                indices[count] = i + j;
+                count++;
+            }
+        }
+    }
+#endif
+    for (; i < num_priors_actual; ++i) {
+        if (conf_data[i] > _confidence_threshold) {
+            indices[count] = i;
+            count++;
+        }
+    }
+    return count;
+}
+
+void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
+                                   const float *loc_data,
+                                   const float *variance_data,
+                                   float *decoded_bboxes,
+                                   float *decoded_bbox_sizes,
+                                   const int *decode_mask,
+                                   int num_priors_actual) {
+    parallel_for(num_priors_actual, [&](int p) {
+        if (!decode_mask[p]) {
+            // no class is detected by the prior
+            return;
+        }
 
-    #pragma omp parallel for schedule(static)
-    for (int p = 0; p < num_priors_actual[n]; ++p) {
         float new_xmin = 0.0f;
         float new_ymin = 0.0f;
         float new_xmax = 0.0f;
@@ -478,7 +572,7 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
         decoded_bboxes[p*4 + 3] = new_ymax;
 
         decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
-    }
+    });
 }
 
 void DetectionOutputImpl::nms(const float* conf_data,
@@ -487,34 +581,74 @@ void DetectionOutputImpl::nms(const float* conf_data,
                           int* buffer,
                           int* indices,
                           int& detections,
-                          int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
-        if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
-    }
-
+                          int count) {
+    // the candidates are already in the indices (see filterCandidates)
     int num_output_scores = (_top_k == -1 ? count : std::min<int>(_top_k, count));
 
     std::partial_sort_copy(indices, indices + count,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+#if defined(HAVE_AVX2)
+    // the kept boxes are stored by the coordinates, so the candidate is compared with 8 of them at once
+    std::vector<float> kept(5 * num_output_scores);
+    float *kept_xmin = kept.data();
+    float *kept_ymin = kept_xmin + num_output_scores;
+    float *kept_xmax = kept_ymin + num_output_scores;
+    float *kept_ymax = kept_xmax + num_output_scores;
+    float *kept_size = kept_ymax + num_output_scores;
+
+    const __m256 vc_zero = _mm256_setzero_ps();
+    const __m256 vc_nms_thresh = _mm256_set1_ps(_nms_threshold);
+#endif
+
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
 
         bool keep = true;
-        for (int k = 0; k < detections; ++k) {
+        int k = 0;
+#if defined(HAVE_AVX2)
+        const __m256 vxmin = _mm256_set1_ps(bboxes[idx*4 + 0]);
+        const __m256 vymin = _mm256_set1_ps(bboxes[idx*4 + 1]);
+        const __m256 vxmax = _mm256_set1_ps(bboxes[idx*4 + 2]);
+        const __m256 vymax = _mm256_set1_ps(bboxes[idx*4 + 3]);
+        const __m256 vsize = _mm256_set1_ps(sizes[idx]);
+
+        for (; k <= detections - 8; k += 8) {
+            __m256 vwidth  = _mm256_sub_ps(_mm256_min_ps(vxmax, _mm256_loadu_ps(kept_xmax + k)),
+                                           _mm256_max_ps(vxmin, _mm256_loadu_ps(kept_xmin + k)));
+            __m256 vheight = _mm256_sub_ps(_mm256_min_ps(vymax, _mm256_loadu_ps(kept_ymax + k)),
+                                           _mm256_max_ps(vymin, _mm256_loadu_ps(kept_ymin + k)));
+            __m256 vintersect = _mm256_mul_ps(vwidth, vheight);
+            __m256 vunion = _mm256_sub_ps(_mm256_add_ps(vsize, _mm256_loadu_ps(kept_size + k)), vintersect);
+
+            // the overlap of the disjoint boxes is 0 as in JaccardOverlap
+            __m256 vintersected = _mm256_and_ps(_mm256_cmp_ps(vwidth, vc_zero, _CMP_GT_OS),
+                                                _mm256_cmp_ps(vheight, vc_zero, _CMP_GT_OS));
+            __m256 voverlap = _mm256_and_ps(_mm256_div_ps(vintersect, vunion), vintersected);
+
+            if (_mm256_movemask_ps(_mm256_cmp_ps(voverlap, vc_nms_thresh, _CMP_GT_OS))) {
+                keep = false;
+                break;
+            }
+        }
+#endif
+
+        for (; keep && k < detections; ++k) {
             const int kept_idx = indices[k];
             float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
             if (overlap > _nms_threshold) {
                 keep = false;
-                break;
             }
         }
         if (keep) {
+#if defined(HAVE_AVX2)
+            kept_xmin[detections] = bboxes[idx*4 + 0];
+            kept_ymin[detections] = bboxes[idx*4 + 1];
+            kept_xmax[detections] = bboxes[idx*4 + 2];
+            kept_ymax[detections] = bboxes[idx*4 + 3];
+            kept_size[detections] = sizes[idx];
+#endif
             indices[detections] = idx;
             detections++;
         }
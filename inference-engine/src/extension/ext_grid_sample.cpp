@@ -0,0 +1,130 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ext_list.hpp"
+#include "ext_base.hpp"
+
+#include "grid_sampler.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * GridSample: the image [N, C, H, W] is sampled bilinearly at the points of the grid [N, OH, OW, 2] into the output
+ * [N, C, OH, OW]. The points are the (x, y) pairs normalized to [-1, 1], -1 and 1 are the centers of the corner
+ * pixels if align_corners is 1 and the outer edges of the corner pixels otherwise (the default). The points outside
+ * the image sample the zero padding.
+ */
+class GridSampleImpl: public ExtLayerBase {
+public:
+    explicit GridSampleImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.size() != 2 || layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
+
+            align_corners = static_cast<bool>(layer->GetParamAsInt("align_corners", 0));
+
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() != 4)
+                THROW_IE_EXCEPTION << "GridSample supports only 4D images!";
+            const SizeVector &grid_dims = layer->insData[1].lock()->getTensorDesc().getDims();
+            if (grid_dims.size() != 4 || grid_dims[3] != 2)
+                THROW_IE_EXCEPTION << "The grid of GridSample must be [N, OH, OW, 2]!";
+
+            addConfig(layer, {DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN)},
+                      {DataConfigurator(ConfLayout::PLN)});
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc *resp) noexcept override {
+        const SizeVector &dims = inputs[0]->getTensorDesc().getDims();
+        const SizeVector &grid_dims = inputs[1]->getTensorDesc().getDims();
+        const size_t N = dims[0];
+        const size_t C = dims[1];
+        const int H = static_cast<int>(dims[2]);
+        const int W = static_cast<int>(dims[3]);
+        const int OH = static_cast<int>(grid_dims[1]);
+        const int OW = static_cast<int>(grid_dims[2]);
+        const size_t points = static_cast<size_t>(OH) * OW;
+
+        const auto *src_data = inputs[0]->cbuffer().as<const float *>();
+        const auto *grid = inputs[1]->cbuffer().as<const float *>();
+        auto *dst_data = outputs[0]->buffer().as<float *>();
+
+        // the points of a sample are shared by its channels, a large batch is split by the samples, a small one
+        // by the channels and the rows
+        std::vector<GridSampler> samplers(parallel_get_max_threads());
+        if (N >= samplers.size()) {
+            parallel_for(N, [&](size_t n) {
+                GridSampler &sampler = samplers[parallel_get_thread_num()];
+                prepare(sampler, grid + 2 * points * n, static_cast<int>(points), H, W);
+                for (size_t c = 0; c < C; c++) {
+                    sampler.sample(src_data + (n * C + c) * H * W, dst_data + (n * C + c) * points,
+                                   0, static_cast<int>(points));
+                }
+            });
+        } else {
+            for (size_t n = 0; n < N; n++) {
+                GridSampler &sampler = samplers[0];
+                prepare(sampler, grid + 2 * points * n, static_cast<int>(points), H, W);
+                parallel_nd(C, static_cast<size_t>(OH), [&](size_t c, size_t s) {
+                    sampler.sample(src_data + (n * C + c) * H * W, dst_data + (n * C + c) * points,
+                                   static_cast<int>(s) * OW, static_cast<int>(s + 1) * OW);
+                });
+            }
+        }
+        return OK;
+    }
+
+private:
+    bool align_corners = false;
+
+    void prepare(GridSampler &sampler, const float *grid, int points, int H, int W) const {
+        std::vector<float> rows(points);
+        std::vector<float> cols(points);
+        for (int i = 0; i < points; i++) {
+            cols[i] = unnormalize(grid[2 * i], W);
+            rows[i] = unnormalize(grid[2 * i + 1], H);
+        }
+        sampler.prepare(rows.data(), cols.data(), points, H, W);
+    }
+
+    float unnormalize(float coordinate, int size) const {
+        return align_corners ? (coordinate + 1) / 2 * (size - 1) : ((coordinate + 1) * size - 1) / 2;
+    }
+};
+
+class GridSampleShapeInfer : public IShapeInferImpl {
+public:
+    StatusCode inferShapes(const std::vector<SizeVector>& inShapes,
+                           const std::map<std::string, std::string>& params,
+                           const std::map<std::string, Blob::Ptr>& blobs,
+                           std::vector<SizeVector>& outShapes,
+                           ResponseDesc* resp) noexcept override {
+        if (inShapes.size() != 2 || inShapes[0].size() != 4 || inShapes[1].size() != 4 || inShapes[1][3] != 2) {
+            if (resp) {
+                std::string errorMsg = "Incorrect input shapes of GridSample!";
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
+        }
+        outShapes.push_back({inShapes[0][0], inShapes[0][1], inShapes[1][1], inShapes[1][2]});
+        return InferenceEngine::OK;
+    }
+};
+
+REG_FACTORY_FOR(ImplFactory<GridSampleImpl>, GridSample);
+REG_SHAPE_INFER_FOR_TYPE(GridSampleShapeInfer, GridSample);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
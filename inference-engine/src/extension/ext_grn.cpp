@@ -9,6 +9,8 @@
 #include <cmath>
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <immintrin.h>
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -23,6 +25,14 @@ public:
 
             bias = layer->GetParamAsFloat("bias");
 
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() == 4) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, {{blk_layout, false, 0}}, {{blk_layout, false, 0}});
+            }
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
@@ -41,32 +51,90 @@ public:
         int H = static_cast<int>((dims.size() > 2) ? dims[2] : 1);
         int W = static_cast<int>((dims.size() > 3) ? dims[3] : 1);
 
-#if _MSC_VER && !__INTEL_COMPILER
-        #pragma omp parallel for schedule(static)
-#else
-        #pragma omp parallel for collapse(3) schedule(static)
-#endif
-        for (int b = 0; b < N; b++) {
-            for (int h = 0; h < H; h++) {
-                for (int w = 0; w < W; w++) {
-                    double variance = 0;
-                    for (int c = 0; c < C; c++) {
-                        variance += std::pow(src_data[b*C*H*W + c*H*W + h*W + w], 2);
-                    }
-                    variance = std::pow(variance + bias, 0.5f);
-                    for (int c = 0; c < C; c++) {
-                        dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] / variance;
-                    }
-                }
-            }
+        if (inputs[0]->layout() == BLOCKED) {
+            grn_blk(src_data, dst_data, N, C, H, W);
+            return OK;
         }
+
+        parallel_nd(N, H, W, [&](int b, int h, int w) {
+            double variance = 0;
+            for (int c = 0; c < C; c++) {
+                variance += std::pow(src_data[b*C*H*W + c*H*W + h*W + w], 2);
+            }
+            variance = std::pow(variance + bias, 0.5f);
+            for (int c = 0; c < C; c++) {
+                dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] / variance;
+            }
+        });
         return OK;
     }
 
 private:
+    void grn_blk(const float* src_data, float* dst_data, int N, int C, int H, int W);
+
     float bias = 1.0f;
 };
 
+void GRNImpl::grn_blk(const float* src_data, float* dst_data, int N, int C, int H, int W) {
+#if defined(HAVE_AVX512F)
+    const int blk_size = 16;
+    typedef __m512 vec_type;
+#elif defined(HAVE_AVX2)
+    const int blk_size = 8;
+    typedef __m256 vec_type;
+#else
+    const int blk_size = 8;
+#endif
+
+    const int CB = (C + blk_size - 1) / blk_size;
+    const int HW = H*W;
+
+    // excludes the padded channels of the last block from the sum
+    std::vector<float> mask(CB*blk_size, 0.f);
+    std::fill(mask.begin(), mask.begin() + C, 1.f);
+
+    parallel_nd(N, HW, [&](int b, int hw) {
+        const float* psrc = src_data + b*CB*HW*blk_size + hw*blk_size;
+        float* pdst = dst_data + b*CB*HW*blk_size + hw*blk_size;
+
+        float lanes[blk_size] = {};
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        vec_type vsum = _mm_uni_setzero_ps();
+        for (int cb = 0; cb < CB; cb++) {
+            vec_type vsrc = _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc + cb*HW*blk_size),
+                                           _mm_uni_loadu_ps(&mask[cb*blk_size]));
+            vsum = _mm_uni_add_ps(vsum, _mm_uni_mul_ps(vsrc, vsrc));
+        }
+        _mm_uni_storeu_ps(lanes, vsum);
+#else
+        for (int cb = 0; cb < CB; cb++) {
+            for (int c = 0; c < blk_size; c++) {
+                float value = psrc[cb*HW*blk_size + c] * mask[cb*blk_size + c];
+                lanes[c] += value * value;
+            }
+        }
+#endif
+        float variance = bias;
+        for (int c = 0; c < blk_size; c++) {
+            variance += lanes[c];
+        }
+        float scale = 1.f / std::sqrt(variance);
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        vec_type vscale = _mm_uni_set1_ps(scale);
+        for (int cb = 0; cb < CB; cb++) {
+            _mm_uni_storeu_ps(pdst + cb*HW*blk_size, _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc + cb*HW*blk_size), vscale));
+        }
+#else
+        for (int cb = 0; cb < CB; cb++) {
+            for (int c = 0; c < blk_size; c++) {
+                pdst[cb*HW*blk_size + c] = psrc[cb*HW*blk_size + c] * scale;
+            }
+        }
+#endif
+    });
+}
+
 REG_FACTORY_FOR(ImplFactory<GRNImpl>, GRN);
 
 }  // namespace Cpu
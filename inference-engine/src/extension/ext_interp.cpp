@@ -63,6 +63,38 @@ public:
 private:
     int pad_beg;
     int pad_end;
+
+    // the source rows and columns of every output point and their weights, they are reused until the shapes change
+    int tables_ih = 0, tables_iw = 0, tables_oh = 0, tables_ow = 0;
+    std::vector<int> table_h0, table_h1, table_w0, table_w1;
+    std::vector<float> table_h_lambda, table_w_lambda;
+
+    static void prepareTable(std::vector<int> &idx0, std::vector<int> &idx1, std::vector<float> &lambda,
+                             int in, int out) {
+        const float r = (out > 1) ? static_cast<float>(in - 1) / (out - 1) : 0.0f;
+        idx0.resize(out);
+        idx1.resize(out);
+        lambda.resize(out);
+        for (int o = 0; o < out; o++) {
+            float f = r * o;
+            idx0[o] = static_cast<int>(f);
+            idx1[o] = (idx0[o] < in - 1) ? idx0[o] + 1 : idx0[o];
+            lambda[o] = f - idx0[o];
+        }
+    }
+
+    void prepareTables(int IH_pad, int IW_pad, int OH_pad, int OW_pad) {
+        if (tables_ih == IH_pad && tables_iw == IW_pad && tables_oh == OH_pad && tables_ow == OW_pad)
+            return;
+        tables_ih = IH_pad;
+        tables_iw = IW_pad;
+        tables_oh = OH_pad;
+        tables_ow = OW_pad;
+
+        prepareTable(table_h0, table_h1, table_h_lambda, IH_pad, OH_pad);
+        prepareTable(table_w0, table_w1, table_w_lambda, IW_pad, OW_pad);
+    }
+
     void interpolate(const int N, const int C,
                      const float *src, const int x1, const int y1,
                      const int IH_pad, const int IW_pad, const int IH, const int IW,
@@ -75,8 +107,7 @@ private:
             return;
         }
 
-        const float rh = (OH_pad > 1) ? static_cast<float>(IH_pad - 1) / (OH_pad - 1) : 0.0f;
-        const float rw = (OW_pad > 1) ? static_cast<float>(IW_pad - 1) / (OW_pad - 1) : 0.0f;
+        prepareTables(IH_pad, IW_pad, OH_pad, OW_pad);
 
 #if defined(HAVE_AVX512F)
         const int block_size = 16;
@@ -89,106 +120,95 @@ private:
 
         int CH = (C + block_size - 1) / block_size;
 
-#if _MSC_VER && !__INTEL_COMPILER
-        #pragma omp parallel for schedule(static)
-#else
-        #pragma omp parallel for collapse(3) schedule(static)
-#endif
-        for (int n = 0; n < N; n++) {
-            for (int cb = 0; cb < CH; ++cb) {
-                for (int h = 0; h < OH_pad; ++h) {
-                    const float *psrc = src + n * CB * IH * IW;
-
-                    float fh = rh * h;
-                    int ih0 = static_cast<int>(fh);
-                    int ih1 = (ih0 < IH_pad - 1) ? ih0 + 1 : ih0;
-
-                    float h_lambda0 = fh - ih0;
-                    float h_lambda1 = 1.0f - h_lambda0;
-
-                    for (int w = 0; w < OW_pad; ++w) {
-                        float fw = rw * w;
-                        int iw0 = static_cast<int>(fw);
-                        int iw1 = (iw0 < IW_pad - 1) ? iw0 + 1 : iw0;
-
-                        float w_lambda0 = fw - iw0;
-                        float w_lambda1 = 1.0f - w_lambda0;
-
-                        const float *psrc00 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih0) * IW * block_size + (x1 + iw0) * block_size;
-                        const float *psrc01 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih0) * IW * block_size + (x1 + iw1) * block_size;
-                        const float *psrc10 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih1) * IW * block_size + (x1 + iw0) * block_size;
-                        const float *psrc11 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih1) * IW * block_size + (x1 + iw1) * block_size;
-
-                        float *pdst = dst + n * CB * OH * OW + cb * block_size * OW * OH + (y2 + h) * OW * block_size +
-                                      (x2 + w) * block_size;
+        parallel_nd(N, CH, OH_pad, [&](int n, int cb, int h) {
+            const float *psrc = src + n * CB * IH * IW;
+
+            int ih0 = table_h0[h];
+            int ih1 = table_h1[h];
+
+            float h_lambda0 = table_h_lambda[h];
+            float h_lambda1 = 1.0f - h_lambda0;
+
+            for (int w = 0; w < OW_pad; ++w) {
+                int iw0 = table_w0[w];
+                int iw1 = table_w1[w];
+
+                float w_lambda0 = table_w_lambda[w];
+                float w_lambda1 = 1.0f - w_lambda0;
+
+                const float *psrc00 =
+                        psrc + cb * block_size * IW * IH + (y1 + ih0) * IW * block_size + (x1 + iw0) * block_size;
+                const float *psrc01 =
+                        psrc + cb * block_size * IW * IH + (y1 + ih0) * IW * block_size + (x1 + iw1) * block_size;
+                const float *psrc10 =
+                        psrc + cb * block_size * IW * IH + (y1 + ih1) * IW * block_size + (x1 + iw0) * block_size;
+                const float *psrc11 =
+                        psrc + cb * block_size * IW * IH + (y1 + ih1) * IW * block_size + (x1 + iw1) * block_size;
+
+                float *pdst = dst + n * CB * OH * OW + cb * block_size * OW * OH + (y2 + h) * OW * block_size +
+                              (x2 + w) * block_size;
 
 #if defined(HAVE_AVX512F)
-                        __m512 vwl0 = _mm512_set1_ps(w_lambda0);
-                        __m512 vwl1 = _mm512_set1_ps(w_lambda1);
-                        __m512 vhl0 = _mm512_set1_ps(h_lambda0);
-                        __m512 vhl1 = _mm512_set1_ps(h_lambda1);
-                        __m512 vsrc00 = _mm512_loadu_ps(psrc00);
-                        __m512 vsrc01 = _mm512_loadu_ps(psrc01);
-                        __m512 vsrc10 = _mm512_loadu_ps(psrc10);
-                        __m512 vsrc11 = _mm512_loadu_ps(psrc11);
-
-                        __m512 vdst0 = _mm512_fmadd_ps(vwl1, vsrc00, _mm512_mul_ps(vwl0, vsrc01));
-                        __m512 vdst1 = _mm512_fmadd_ps(vwl1, vsrc10, _mm512_mul_ps(vwl0, vsrc11));
-                        __m512 vdst  = _mm512_fmadd_ps(vhl1, vdst0, _mm512_mul_ps(vhl0, vdst1));
-
-                        _mm512_storeu_ps(pdst, vdst);
+                __m512 vwl0 = _mm512_set1_ps(w_lambda0);
+                __m512 vwl1 = _mm512_set1_ps(w_lambda1);
+                __m512 vhl0 = _mm512_set1_ps(h_lambda0);
+                __m512 vhl1 = _mm512_set1_ps(h_lambda1);
+                __m512 vsrc00 = _mm512_loadu_ps(psrc00);
+                __m512 vsrc01 = _mm512_loadu_ps(psrc01);
+                __m512 vsrc10 = _mm512_loadu_ps(psrc10);
+                __m512 vsrc11 = _mm512_loadu_ps(psrc11);
+
+                __m512 vdst0 = _mm512_fmadd_ps(vwl1, vsrc00, _mm512_mul_ps(vwl0, vsrc01));
+                __m512 vdst1 = _mm512_fmadd_ps(vwl1, vsrc10, _mm512_mul_ps(vwl0, vsrc11));
+                __m512 vdst  = _mm512_fmadd_ps(vhl1, vdst0, _mm512_mul_ps(vhl0, vdst1));
+
+                _mm512_storeu_ps(pdst, vdst);
 #elif defined(HAVE_AVX2)
-                        __m256 vwl0 = _mm256_set1_ps(w_lambda0);
-                        __m256 vwl1 = _mm256_set1_ps(w_lambda1);
-                        __m256 vhl0 = _mm256_set1_ps(h_lambda0);
-                        __m256 vhl1 = _mm256_set1_ps(h_lambda1);
-                        __m256 vsrc00 = _mm256_loadu_ps(psrc00);
-                        __m256 vsrc01 = _mm256_loadu_ps(psrc01);
-                        __m256 vsrc10 = _mm256_loadu_ps(psrc10);
-                        __m256 vsrc11 = _mm256_loadu_ps(psrc11);
-
-                       __m256 vdst0 = _mm256_fmadd_ps(vwl1, vsrc00, _mm256_mul_ps(vwl0, vsrc01));
-                       __m256 vdst1 = _mm256_fmadd_ps(vwl1, vsrc10, _mm256_mul_ps(vwl0, vsrc11));
-                       __m256 vdst  = _mm256_fmadd_ps(vhl1, vdst0, _mm256_mul_ps(vhl0, vdst1));
-
-                       _mm256_storeu_ps(pdst, vdst);
+                __m256 vwl0 = _mm256_set1_ps(w_lambda0);
+                __m256 vwl1 = _mm256_set1_ps(w_lambda1);
+                __m256 vhl0 = _mm256_set1_ps(h_lambda0);
+                __m256 vhl1 = _mm256_set1_ps(h_lambda1);
+                __m256 vsrc00 = _mm256_loadu_ps(psrc00);
+                __m256 vsrc01 = _mm256_loadu_ps(psrc01);
+                __m256 vsrc10 = _mm256_loadu_ps(psrc10);
+                __m256 vsrc11 = _mm256_loadu_ps(psrc11);
+
+               __m256 vdst0 = _mm256_fmadd_ps(vwl1, vsrc00, _mm256_mul_ps(vwl0, vsrc01));
+               __m256 vdst1 = _mm256_fmadd_ps(vwl1, vsrc10, _mm256_mul_ps(vwl0, vsrc11));
+               __m256 vdst  = _mm256_fmadd_ps(vhl1, vdst0, _mm256_mul_ps(vhl0, vdst1));
+
+               _mm256_storeu_ps(pdst, vdst);
 #elif defined(HAVE_SSE)
-                        __m128 vwl0 = _mm_set1_ps(w_lambda0);
-                        __m128 vwl1 = _mm_set1_ps(w_lambda1);
-                        __m128 vhl0 = _mm_set1_ps(h_lambda0);
-                        __m128 vhl1 = _mm_set1_ps(h_lambda1);
-                        for (int i = 0; i < block_size/4; i++) {
-                            __m128 vsrc00 = _mm_loadu_ps(psrc00 + i*block_size/2);
-                            __m128 vsrc01 = _mm_loadu_ps(psrc01 + i*block_size/2);
-                            __m128 vsrc10 = _mm_loadu_ps(psrc10 + i*block_size/2);
-                            __m128 vsrc11 = _mm_loadu_ps(psrc11 + i*block_size/2);
-
-                           __m128 vdst00 = _mm_mul_ps(vwl1, vsrc00);
-                           __m128 vdst01 = _mm_mul_ps(vwl0, vsrc01);
-                           __m128 vdst10 = _mm_mul_ps(vwl1, vsrc10);
-                           __m128 vdst11 = _mm_mul_ps(vwl0, vsrc11);
-
-                           __m128 vdst0 = _mm_add_ps(vdst00, vdst01);
-                           __m128 vdst1 = _mm_add_ps(vdst10, vdst11);
-
-                            __m128 vdst = _mm_add_ps(_mm_mul_ps(vhl1, vdst0), _mm_mul_ps(vhl0, vdst1));
-
-                           _mm_storeu_ps(pdst + i*block_size/2, vdst);
-                        }
+                __m128 vwl0 = _mm_set1_ps(w_lambda0);
+                __m128 vwl1 = _mm_set1_ps(w_lambda1);
+                __m128 vhl0 = _mm_set1_ps(h_lambda0);
+                __m128 vhl1 = _mm_set1_ps(h_lambda1);
+                for (int i = 0; i < block_size/4; i++) {
+                    __m128 vsrc00 = _mm_loadu_ps(psrc00 + i*block_size/2);
+                    __m128 vsrc01 = _mm_loadu_ps(psrc01 + i*block_size/2);
+                    __m128 vsrc10 = _mm_loadu_ps(psrc10 + i*block_size/2);
+                    __m128 vsrc11 = _mm_loadu_ps(psrc11 + i*block_size/2);
+
+                   __m128 vdst00 = _mm_mul_ps(vwl1, vsrc00);
+                   __m128 vdst01 = _mm_mul_ps(vwl0, vsrc01);
+                   __m128 vdst10 = _mm_mul_ps(vwl1, vsrc10);
+                   __m128 vdst11 = _mm_mul_ps(vwl0, vsrc11);
+
+                   __m128 vdst0 = _mm_add_ps(vdst00, vdst01);
+                   __m128 vdst1 = _mm_add_ps(vdst10, vdst11);
+
+                    __m128 vdst = _mm_add_ps(_mm_mul_ps(vhl1, vdst0), _mm_mul_ps(vhl0, vdst1));
+
+                   _mm_storeu_ps(pdst + i*block_size/2, vdst);
+                }
 #else
-                        for (int c = 0; c < block_size; ++c) {
-                            pdst[c] = h_lambda1 * (w_lambda1 * psrc00[c] + w_lambda0 * psrc01[c]) +
-                                      h_lambda0 * (w_lambda1 * psrc10[c] + w_lambda0 * psrc11[c]);
-                        }
-#endif
-                    }
+                for (int c = 0; c < block_size; ++c) {
+                    pdst[c] = h_lambda1 * (w_lambda1 * psrc00[c] + w_lambda0 * psrc01[c]) +
+                              h_lambda0 * (w_lambda1 * psrc10[c] + w_lambda0 * psrc11[c]);
                 }
+#endif
             }
-        }
+        });
     }
 };
 
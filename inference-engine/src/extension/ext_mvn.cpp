@@ -67,6 +67,18 @@ public:
     }
 
 private:
+    // Count, mean and sum of the squared deviations of the values of one channel
+    struct Moments {
+        double count = 0;
+        double mean = 0;
+        double m2 = 0;
+    };
+
+    static void mergeMoments(Moments& a, double count, double mean, double m2);
+    void channelMoments(const float* src_data, int H, int W, int stride, Moments& moments);
+    void mergeChannels(std::vector<Moments>& stats, int C);
+    float normScale(const Moments& moments);
+
     void mvn_pln(const float* src_data, float* dst_data, int N, int C, int H, int W);
     void mvn_blk(const float* src_data, float* dst_data, int N, int C, int H, int W);
 
@@ -75,100 +87,83 @@ private:
     float eps = 1e-9f;
 };
 
-void MVNImpl::mvn_pln(const float* src_data, float* dst_data, int N, int C, int H, int W) {
-    for (int b = 0; b < N; b++) {
-        // Calculate mean value
-        if (across_channels) {
-            double mean = 0;
-            #pragma omp parallel for reduction(+ : mean) schedule(static)
-            for (int c = 0; c < C; c++) {
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        mean += src_data[b*C*H*W + c*H*W + h*W + w];
-                    }
-                }
-            }
-            mean /= C*H*W;
-            #pragma omp parallel for schedule(static)
-            for (int c = 0; c < C; c++) {
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] - mean;
-                    }
-                }
-            }
-        } else {
-            #pragma omp parallel for schedule(static)
-            for (int c = 0; c < C; c++) {
-                double mean = 0;
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        mean += src_data[b*C*H*W + c*H*W + h*W + w];
-                    }
-                }
-                mean /= H*W;
+// Merges the moments of two disjoint sets of the values (Chan et al.)
+void MVNImpl::mergeMoments(Moments& a, double count, double mean, double m2) {
+    double total = a.count + count;
+    double delta = mean - a.mean;
+    a.mean += delta * count / total;
+    a.m2 += m2 + delta * delta * a.count * count / total;
+    a.count = total;
+}
 
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] - mean;
-                    }
-                }
+// The statistics are gathered row by row in one pass over the memory: the row mean and the deviations
+// from it are computed while the row is in the cache, and the rows are merged into the channel moments.
+void MVNImpl::channelMoments(const float* src_data, int H, int W, int stride, Moments& moments) {
+    moments = Moments();
+    for (int h = 0; h < H; h++) {
+        const float* row = src_data + h*W*stride;
+        double sum = 0;
+        for (int w = 0; w < W; w++) {
+            sum += row[w*stride];
+        }
+        double mean = sum / W;
+
+        double m2 = 0;
+        if (normalize_variance) {
+            for (int w = 0; w < W; w++) {
+                double value = row[w*stride] - mean;
+                m2 += value * value;
             }
         }
+        mergeMoments(moments, W, mean, m2);
     }
+}
 
-    if (normalize_variance) {
-        for (int b = 0; b < N; b++) {
-            // Calculate variances value
-            if (across_channels) {
-                double variance = 0;
-                #pragma omp parallel for reduction(+ : variance) schedule(static)
-                for (int c = 0; c < C; c++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            variance += std::pow(dst_data[b*C*H*W + c*H*W + h*W + w], 2);
-                        }
-                    }
-                }
-                variance /= C*H*W;
-                variance = std::pow(variance, 0.5f);
-                variance += eps;
-                #pragma omp parallel for schedule(static)
-                for (int c = 0; c < C; c++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            dst_data[b*C*H*W + c*H*W + h*W + w] /= variance;
-                        }
-                    }
-                }
-            } else {
-                #pragma omp parallel for schedule(static)
-                for (int c = 0; c < C; c++) {
-                    double variance = 0;
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            variance += std::pow(dst_data[b*C*H*W + c*H*W + h*W + w], 2);
-                        }
-                    }
-                    variance /= H*W;
-                    variance = std::pow(variance, 0.5f);
-                    variance += eps;
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            dst_data[b*C*H*W + c*H*W + h*W + w] /= variance;
-                        }
-                    }
-                }
+void MVNImpl::mergeChannels(std::vector<Moments>& stats, int C) {
+    Moments total = stats[0];
+    for (int c = 1; c < C; c++) {
+        mergeMoments(total, stats[c].count, stats[c].mean, stats[c].m2);
+    }
+    for (int c = 0; c < C; c++) {
+        stats[c] = total;
+    }
+}
+
+float MVNImpl::normScale(const Moments& moments) {
+    if (!normalize_variance)
+        return 1.f;
+    return static_cast<float>(1. / (std::sqrt(moments.m2 / moments.count) + eps));
+}
+
+void MVNImpl::mvn_pln(const float* src_data, float* dst_data, int N, int C, int H, int W) {
+    std::vector<Moments> stats(C);
+
+    for (int b = 0; b < N; b++) {
+        const float* src_b = src_data + b*C*H*W;
+        float* dst_b = dst_data + b*C*H*W;
+
+        parallel_for(C, [&](int c) {
+            channelMoments(src_b + c*H*W, H, W, 1, stats[c]);
+        });
+
+        if (across_channels)
+            mergeChannels(stats, C);
+
+        parallel_for(C, [&](int c) {
+            float mean = static_cast<float>(stats[c].mean);
+            float scale = normScale(stats[c]);
+            for (int i = 0; i < H*W; i++) {
+                dst_b[c*H*W + i] = (src_b[c*H*W + i] - mean) * scale;
             }
-        }
+        });
     }
 }
 
 void MVNImpl::mvn_blk(const float* src_data, float* dst_data, int N, int C, int H, int W) {
 #if defined(HAVE_AVX512F)
-    size_t blk_size = 16;
+    const int blk_size = 16;
 #else
-    size_t blk_size = 8;
+    const int blk_size = 8;
 #endif
 
 #if defined(HAVE_AVX512F)
@@ -177,222 +172,93 @@ void MVNImpl::mvn_blk(const float* src_data, float* dst_data, int N, int C, int
     typedef __m256 vec_type;
 #endif
 
-    int CB = div_up(C, static_cast<int>(blk_size));
+    int CB = div_up(C, blk_size);
 
-    if (normalize_variance) {
-        for (int b = 0; b < N; b++) {
-            if (across_channels) {
-                float mean = 0;
-#if _MSC_VER && !__INTEL_COMPILER
-                #pragma omp parallel for reduction(+ : mean) schedule(static)
-#else
-                #pragma omp parallel for collapse(2) reduction(+ : mean) schedule(static)
-#endif
-                for (int cb = 0; cb < CB; cb++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                                size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                                mean += src_data[src_offset];
-                            }
-                        }
-                    }
-                }
+    std::vector<Moments> stats(C);
+    // the mean and the scale of the channels, the padded ones are copied as is
+    std::vector<float> means(CB * blk_size);
+    std::vector<float> scales(CB * blk_size);
 
-                mean /= C * H * W;
+    for (int b = 0; b < N; b++) {
+        const float* src_b = src_data + b*CB*H*W*blk_size;
+        float* dst_b = dst_data + b*CB*H*W*blk_size;
 
-                float variance = 0;
-#if _MSC_VER && !__INTEL_COMPILER
-                #pragma omp parallel for reduction(+ : variance) schedule(static)
-#else
-                #pragma omp parallel for collapse(2) reduction(+ : variance) schedule(static)
-#endif
-                for (int cb = 0; cb < CB; cb++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                                size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                                variance += std::pow(src_data[src_offset] - mean, 2);
-                            }
-                        }
-                    }
+        parallel_for(CB, [&](int cb) {
+            const float* src_cb = src_b + cb*H*W*blk_size;
+            int channels = std::min(blk_size, C - cb*blk_size);
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            // the moments of the channels of the block are gathered lane by lane
+            vec_type vmean = _mm_uni_setzero_ps();
+            vec_type vm2 = _mm_uni_setzero_ps();
+            vec_type vrow_scale = _mm_uni_set1_ps(1.f / W);
+            float count = 0;
+            for (int h = 0; h < H; h++) {
+                const float* row = src_cb + h*W*blk_size;
+                vec_type vsum = _mm_uni_setzero_ps();
+                for (int w = 0; w < W; w++) {
+                    vsum = _mm_uni_add_ps(vsum, _mm_uni_loadu_ps(row + w*blk_size));
                 }
+                vec_type vrow_mean = _mm_uni_mul_ps(vsum, vrow_scale);
 
-                variance /= C*H*W;
-                variance = std::pow(variance, 0.5f);
-                variance += eps;
-
-#if _MSC_VER && !__INTEL_COMPILER
-                #pragma omp parallel for schedule(static)
-#else
-                #pragma omp parallel for collapse(2) schedule(static)
-#endif
-                for (int cb = 0; cb < CB; cb++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                                size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                                dst_data[src_offset] = (src_data[src_offset] - mean) / variance;
-                            }
-                        }
+                vec_type vrow_m2 = _mm_uni_setzero_ps();
+                if (normalize_variance) {
+                    for (int w = 0; w < W; w++) {
+                        vec_type vsrc = _mm_uni_sub_ps(_mm_uni_loadu_ps(row + w*blk_size), vrow_mean);
+                        vrow_m2 = _mm_uni_add_ps(vrow_m2, _mm_uni_mul_ps(vsrc, vsrc));
                     }
                 }
-            } else {
-                #pragma omp parallel for schedule(static)
-                for (int cb = 0; cb < CB; cb++) {
-                    size_t src_off = b*CB*H*W*blk_size + cb*H*W*blk_size;
-#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                    vec_type vmean = _mm_uni_setzero_ps();
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vmean = _mm_uni_add_ps(vmean, vsrc);
-                        }
-                    }
-
-                    vec_type vsize = _mm_uni_set1_ps(static_cast<float>(H * W));
-                    vmean = _mm_uni_div_ps(vmean, vsize);
-
-                    vec_type vvariance = _mm_uni_setzero_ps();
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vsrc = _mm_uni_sub_ps(vsrc, vmean);
-                            vvariance = _mm_uni_add_ps(vvariance, _mm_uni_mul_ps(vsrc, vsrc));
-                        }
-                    }
 
-                    vvariance = _mm_uni_div_ps(vvariance, vsize);
-                    vvariance = _mm_uni_sqrt_ps(vvariance);
-
-                    vec_type veps = _mm_uni_set1_ps(eps);
-                    vvariance = _mm_uni_add_ps(vvariance, veps);
+                float total = count + W;
+                vec_type vdelta = _mm_uni_sub_ps(vrow_mean, vmean);
+                vmean = _mm_uni_add_ps(vmean, _mm_uni_mul_ps(vdelta, _mm_uni_set1_ps(W / total)));
+                vm2 = _mm_uni_add_ps(vm2, vrow_m2);
+                vm2 = _mm_uni_add_ps(vm2, _mm_uni_mul_ps(_mm_uni_mul_ps(vdelta, vdelta),
+                                                         _mm_uni_set1_ps(count * W / total)));
+                count = total;
+            }
 
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vsrc = _mm_uni_sub_ps(vsrc, vmean);
-                            _mm_uni_storeu_ps(dst_data + src_off + h*W*blk_size + w*blk_size, _mm_uni_div_ps(vsrc, vvariance));
-                        }
-                    }
-#else
-                    for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                        float mean = 0;
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                mean += src_data[src_off + h*W*blk_size + w*blk_size + c];
-                            }
-                        }
-
-                        mean /= H * W;
-
-                        float variance = 0;
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                float value = src_data[src_off + h*W*blk_size + w*blk_size + c] - mean;
-                                variance += std::pow(value, 2);
-                            }
-                        }
-
-                        variance /= H * W;
-                        variance = std::pow(variance, 0.5f);
-                        variance += eps;
-
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                dst_data[src_off + h*W*blk_size + w*blk_size + c] = (src_data[src_off + h*W*blk_size + w*blk_size + c] - mean) / variance;
-                            }
-                        }
-                    }
-#endif
-                }
+            float lane_mean[blk_size];
+            float lane_m2[blk_size];
+            _mm_uni_storeu_ps(lane_mean, vmean);
+            _mm_uni_storeu_ps(lane_m2, vm2);
+            for (int c = 0; c < channels; c++) {
+                stats[cb*blk_size + c].count = count;
+                stats[cb*blk_size + c].mean = lane_mean[c];
+                stats[cb*blk_size + c].m2 = lane_m2[c];
             }
-        }
-    } else {
-        for (int b = 0; b < N; b++) {
-            if (across_channels) {
-                float mean = 0;
-#if _MSC_VER && !__INTEL_COMPILER
-                #pragma omp parallel for reduction(+ : mean) schedule(static)
 #else
-                #pragma omp parallel for collapse(2) reduction(+ : mean) schedule(static)
+            for (int c = 0; c < channels; c++) {
+                channelMoments(src_cb + c, H, W, blk_size, stats[cb*blk_size + c]);
+            }
 #endif
-                for (int cb = 0; cb < CB; cb++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                                size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                                mean += src_data[src_offset];
-                            }
-                        }
-                    }
-                }
+        });
 
-                mean /= C * H * W;
+        if (across_channels)
+            mergeChannels(stats, C);
 
-#if _MSC_VER && !__INTEL_COMPILER
-                #pragma omp parallel for schedule(static)
-#else
-                #pragma omp parallel for collapse(2) schedule(static)
-#endif
-                for (int cb = 0; cb < CB; cb++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                                size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                                dst_data[src_offset] = src_data[src_offset] - mean;
-                            }
-                        }
-                    }
-                }
-            } else {
-                #pragma omp parallel for schedule(static)
-                for (int cb = 0; cb < CB; cb++) {
-                    size_t src_off = b*CB*H*W*blk_size + cb*H*W*blk_size;
-#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                    vec_type vmean = _mm_uni_setzero_ps();
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vmean = _mm_uni_add_ps(vmean, vsrc);
-                        }
-                    }
-
-                    vec_type vsize = _mm_uni_set1_ps(static_cast<float>(H * W));
-                    vmean = _mm_uni_div_ps(vmean, vsize);
+        for (int c = 0; c < CB*blk_size; c++) {
+            means[c] = c < C ? static_cast<float>(stats[c].mean) : 0.f;
+            scales[c] = c < C ? normScale(stats[c]) : 1.f;
+        }
 
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            _mm_uni_storeu_ps(dst_data + src_off + h*W*blk_size + w*blk_size, _mm_uni_sub_ps(vsrc, vmean));
-                        }
-                    }
+        parallel_nd(CB, H, [&](int cb, int h) {
+            size_t off = cb*H*W*blk_size + h*W*blk_size;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            vec_type vmean = _mm_uni_loadu_ps(&means[cb*blk_size]);
+            vec_type vscale = _mm_uni_loadu_ps(&scales[cb*blk_size]);
+            for (int w = 0; w < W; w++) {
+                vec_type vsrc = _mm_uni_loadu_ps(src_b + off + w*blk_size);
+                _mm_uni_storeu_ps(dst_b + off + w*blk_size, _mm_uni_mul_ps(_mm_uni_sub_ps(vsrc, vmean), vscale));
+            }
 #else
-                    for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                        float mean = 0;
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                mean += src_data[src_off + h*W*blk_size + w*blk_size + c];
-                            }
-                        }
-
-                        mean /= H * W;
-
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                dst_data[src_off + h*W*blk_size + w*blk_size + c] = src_data[src_off + h*W*blk_size + w*blk_size + c] - mean;
-                            }
-                        }
-                    }
-#endif
+            for (int w = 0; w < W; w++) {
+                for (int c = 0; c < blk_size; c++) {
+                    dst_b[off + w*blk_size + c] = (src_b[off + w*blk_size + c] - means[cb*blk_size + c]) *
+                                                  scales[cb*blk_size + c];
                 }
             }
-        }
+#endif
+        });
     }
 }
 
@@ -31,6 +31,14 @@ public:
             channel_shared = static_cast<bool>(layer->GetParamAsInt("channel_shared"));
             eps = layer->GetParamAsFloat("eps");
 
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() == 4) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, {{blk_layout, false, 0}}, {{blk_layout, false, 0}}, true);
+            }
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}}, true);
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
@@ -79,8 +87,10 @@ public:
         const int H = static_cast<int>(dims.size() > 2 ? dims[2] : 1);
         const int W = static_cast<int>(dims.size() > 3 ? dims[3] : 1);
 
-        const int HW = H*W;
-        const int CHW = C*HW;
+        if (inputs[0]->layout() == BLOCKED) {
+            normalize_blk(src, dst, scl, N, C, H, W);
+            return OK;
+        }
 
         for (int n = 0; n < N; n++) {
             const float* psrc = src + n*C*H*W;
@@ -212,6 +222,8 @@ public:
     }
 
 private:
+    void normalize_blk(const float* src, float* dst, const float* scl, int N, int C, int H, int W);
+
     TBlob<float>::Ptr weights;
 
     bool across_spatial = true;
@@ -219,6 +231,118 @@ private:
     float eps = 1e-10;
 };
 
+void NormalizeImpl::normalize_blk(const float* src, float* dst, const float* scl, int N, int C, int H, int W) {
+#if defined(HAVE_AVX512F)
+    const int blk_size = 16;
+    typedef __m512 vec_type;
+#elif defined(HAVE_AVX2)
+    const int blk_size = 8;
+    typedef __m256 vec_type;
+#else
+    const int blk_size = 8;
+#endif
+
+    const int CB = (C + blk_size - 1) / blk_size;
+    const int HW = H*W;
+
+    // the scales of the channels and the mask excluding the padded channels from the norm
+    std::vector<float> scales(CB*blk_size, 0.f);
+    std::vector<float> mask(CB*blk_size, 0.f);
+    for (int c = 0; c < C; c++) {
+        scales[c] = channel_shared ? scl[0] : scl[c];
+        mask[c] = 1.f;
+    }
+
+    if (across_spatial) {
+        for (int n = 0; n < N; n++) {
+            const float* psrc = src + n*CB*HW*blk_size;
+            float* pdst = dst + n*CB*HW*blk_size;
+
+            float norm = parallel_sum(CB, 0.0f, [&](int cb) {
+                const float* psrc_cb = psrc + cb*HW*blk_size;
+                float lanes[blk_size] = {};
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                vec_type vsum = _mm_uni_setzero_ps();
+                for (int hw = 0; hw < HW; hw++) {
+                    vec_type vsrc = _mm_uni_loadu_ps(psrc_cb + hw*blk_size);
+                    vsum = _mm_uni_add_ps(vsum, _mm_uni_mul_ps(vsrc, vsrc));
+                }
+                _mm_uni_storeu_ps(lanes, vsum);
+#else
+                for (int hw = 0; hw < HW; hw++) {
+                    for (int c = 0; c < blk_size; c++) {
+                        lanes[c] += psrc_cb[hw*blk_size + c] * psrc_cb[hw*blk_size + c];
+                    }
+                }
+#endif
+                float sum = 0;
+                for (int c = 0; c < blk_size; c++) {
+                    sum += lanes[c] * mask[cb*blk_size + c];
+                }
+                return sum;
+            });
+            norm = 1.0f / std::sqrt(norm + eps);
+
+            parallel_nd(CB, HW, [&](int cb, int hw) {
+                const float* psrc_blk = psrc + cb*HW*blk_size + hw*blk_size;
+                float* pdst_blk = pdst + cb*HW*blk_size + hw*blk_size;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                vec_type vscl = _mm_uni_mul_ps(_mm_uni_loadu_ps(&scales[cb*blk_size]), _mm_uni_set1_ps(norm));
+                _mm_uni_storeu_ps(pdst_blk, _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc_blk), vscl));
+#else
+                for (int c = 0; c < blk_size; c++) {
+                    pdst_blk[c] = psrc_blk[c] * norm * scales[cb*blk_size + c];
+                }
+#endif
+            });
+        }
+    } else {
+        // the norm of the pixel is accumulated over the channel blocks lane-wise and reduced once
+        parallel_nd(N, HW, [&](int n, int hw) {
+            const float* psrc = src + n*CB*HW*blk_size + hw*blk_size;
+            float* pdst = dst + n*CB*HW*blk_size + hw*blk_size;
+
+            float lanes[blk_size] = {};
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            vec_type vsum = _mm_uni_setzero_ps();
+            for (int cb = 0; cb < CB; cb++) {
+                vec_type vsrc = _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc + cb*HW*blk_size),
+                                               _mm_uni_loadu_ps(&mask[cb*blk_size]));
+                vsum = _mm_uni_add_ps(vsum, _mm_uni_mul_ps(vsrc, vsrc));
+            }
+            _mm_uni_storeu_ps(lanes, vsum);
+#else
+            for (int cb = 0; cb < CB; cb++) {
+                for (int c = 0; c < blk_size; c++) {
+                    float value = psrc[cb*HW*blk_size + c] * mask[cb*blk_size + c];
+                    lanes[c] += value * value;
+                }
+            }
+#endif
+            float norm = eps;
+            for (int c = 0; c < blk_size; c++) {
+                norm += lanes[c];
+            }
+            norm = 1.0f / std::sqrt(norm);
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            vec_type vnorm = _mm_uni_set1_ps(norm);
+            for (int cb = 0; cb < CB; cb++) {
+                vec_type vscl = _mm_uni_mul_ps(_mm_uni_loadu_ps(&scales[cb*blk_size]), vnorm);
+                _mm_uni_storeu_ps(pdst + cb*HW*blk_size,
+                                  _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc + cb*HW*blk_size), vscl));
+            }
+#else
+            for (int cb = 0; cb < CB; cb++) {
+                for (int c = 0; c < blk_size; c++) {
+                    pdst[cb*HW*blk_size + c] = psrc[cb*HW*blk_size + c] * norm * scales[cb*blk_size + c];
+                }
+            }
+#endif
+        });
+    }
+}
+
 class NormalizeShapeInfer : public IShapeInferImpl {
 public:
     StatusCode inferShapes(const std::vector<SizeVector>& inShapes,
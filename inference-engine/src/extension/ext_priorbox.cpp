@@ -5,6 +5,7 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "priors_cache.h"
 
 #include <vector>
 #include <string>
@@ -16,7 +17,7 @@ namespace Cpu {
 
 class PriorBoxImpl: public ExtLayerBase {
 public:
-    explicit PriorBoxImpl(const CNNLayer *layer) {
+    explicit PriorBoxImpl(const CNNLayer *layer) : _priors(layer) {
         try {
             if (layer->insData.size() != 2 || layer->outData.empty())
                 THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
@@ -109,6 +110,16 @@ public:
         const int OH = dstMemPtr->getTensorDesc().getDims()[2];
         const int OW = (dstMemPtr->getTensorDesc().getDims().size() == 3) ? 1 : dstMemPtr->getTensorDesc().getDims()[3];
 
+        _priors.copy({static_cast<size_t>(H), static_cast<size_t>(W), static_cast<size_t>(IH), static_cast<size_t>(IW),
+                      static_cast<size_t>(OH), static_cast<size_t>(OW)},
+                     dstMemPtr->buffer(), dstMemPtr->size(), [&](float *dst_data) {
+            generate(dst_data, H, W, IH, IW, OH, OW);
+        });
+        return OK;
+    }
+
+private:
+    void generate(float* dst_data, int H, int W, int IH, int IW, int OH, int OW) const {
         float step_x = 0.0f;
         float step_y = 0.0f;
 
@@ -120,8 +131,6 @@ public:
             step_y = _step;
         }
 
-        float* dst_data = dstMemPtr->buffer();
-
         int dim = H * W * _num_priors * 4;
         int idx = 0;
         float center_x = 0.0f;
@@ -205,10 +214,8 @@ public:
                 }
             }
         }
-        return OK;
     }
 
-private:
     float _offset = 0;
     float _step = 0;
     std::vector<float> _min_sizes;
@@ -221,6 +228,8 @@ private:
     std::vector<float> _variance;
 
     int _num_priors = 0;
+
+    LayerPriors _priors;
 };
 
 REG_FACTORY_FOR(ImplFactory<PriorBoxImpl>, PriorBox);
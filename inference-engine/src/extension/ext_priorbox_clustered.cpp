@@ -5,6 +5,7 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "priors_cache.h"
 #include <algorithm>
 #include <vector>
 
@@ -14,7 +15,7 @@ namespace Cpu {
 
 class PriorBoxClusteredImpl: public ExtLayerBase {
 public:
-    explicit PriorBoxClusteredImpl(const CNNLayer* layer) {
+    explicit PriorBoxClusteredImpl(const CNNLayer* layer) : priors_(layer) {
         try {
             if (layer->insData.size() != 2 || layer->outData.empty())
                 THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
@@ -29,6 +30,8 @@ public:
             step_h_ = layer->GetParamAsFloat("step_h", 0);
             step_w_ = layer->GetParamAsFloat("step_w", 0);
             offset_ = layer->GetParamAsFloat("offset");
+            if (variance_.empty())
+                variance_.push_back(0.1f);
 
             addConfig(layer, {{ConfLayout::PLN, true}, {ConfLayout::PLN, true}}, {{ConfLayout::PLN, true}});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
@@ -38,23 +41,27 @@ public:
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
                        ResponseDesc *resp) noexcept override {
-        int num_priors_ = widths_.size();
-
-        if (variance_.empty())
-            variance_.push_back(0.1);
-
-        // Execute
         const int layer_width = inputs[0]->getTensorDesc().getDims()[3];
         const int layer_height = inputs[0]->getTensorDesc().getDims()[2];
 
         int img_width = img_w_ == 0 ? inputs[1]->getTensorDesc().getDims()[3] : img_w_;
         int img_height = img_h_ == 0 ? inputs[1]->getTensorDesc().getDims()[2] : img_h_;
+        const size_t channel_size = outputs[0]->getTensorDesc().getDims()[2];
+
+        priors_.copy({static_cast<size_t>(layer_height), static_cast<size_t>(layer_width),
+                      static_cast<size_t>(img_height), static_cast<size_t>(img_width), channel_size},
+                     outputs[0]->buffer(), outputs[0]->size(), [&](float *top_data_0) {
+            generate(top_data_0, top_data_0 + channel_size, layer_height, layer_width, img_height, img_width);
+        });
+        return OK;
+    }
 
+private:
+    void generate(float *top_data_0, float *top_data_1, int layer_height, int layer_width,
+                  int img_height, int img_width) const {
+        int num_priors_ = widths_.size();
         float step_w = step_w_ == 0 ? step_ : step_w_;
         float step_h = step_h_ == 0 ? step_ : step_h_;
-
-        auto *top_data_0 = outputs[0]->buffer().as<float *>();
-        float *top_data_1 = top_data_0 + outputs[0]->getTensorDesc().getDims()[2];
         int var_size = variance_.size();
 
         for (int h = 0; h < layer_height; ++h) {
@@ -90,10 +97,8 @@ public:
                 }
             }
         }
-        return OK;
     }
 
-private:
     std::vector<float> widths_;
     std::vector<float> heights_;
     std::vector<float> variance_;
@@ -104,6 +109,8 @@ private:
     float step_h_;
     float step_w_;
     float offset_;
+
+    LayerPriors priors_;
 };
 
 REG_FACTORY_FOR(ImplFactory<PriorBoxClusteredImpl>, PriorBoxClustered);
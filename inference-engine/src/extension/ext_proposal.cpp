@@ -5,13 +5,14 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "box_ops.h"
 
 #include <cmath>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <utility>
 #include <algorithm>
-#include <immintrin.h>
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -80,216 +81,66 @@ void enumerate_proposals_cpu(const float* bottom4d, const float* d_anchor4d, con
     const float* p_anchors_wp = anchors + 2 * num_anchors;
     const float* p_anchors_hp = anchors + 3 * num_anchors;
 
-#if _MSC_VER && !__INTEL_COMPILER
-    #pragma omp parallel for schedule(static)
-#else
-    #pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int h = 0; h < bottom_H; ++h) {
-        for (int w = 0; w < bottom_W; ++w) {
-            const float x = (swap_xy ? h : w) * feat_stride;
-            const float y = (swap_xy ? w : h) * feat_stride;
-
-            const float* p_box   = d_anchor4d + h * bottom_W + w;
-            const float* p_score = bottom4d   + h * bottom_W + w;
-
-            float* p_proposal = proposals + (h * bottom_W + w) * num_anchors * 5;
-
-            for (int anchor = 0; anchor < num_anchors; ++anchor) {
-                const float dx = p_box[(anchor * 4 + 0) * bottom_area] / box_coordinate_scale;
-                const float dy = p_box[(anchor * 4 + 1) * bottom_area] / box_coordinate_scale;
-
-                const float d_log_w = p_box[(anchor * 4 + 2) * bottom_area] / box_size_scale;
-                const float d_log_h = p_box[(anchor * 4 + 3) * bottom_area] / box_size_scale;
-
-                const float score = p_score[anchor * bottom_area];
-
-                float x0 = x + p_anchors_wm[anchor];
-                float y0 = y + p_anchors_hm[anchor];
-                float x1 = x + p_anchors_wp[anchor];
-                float y1 = y + p_anchors_hp[anchor];
-
-                if (initial_clip) {
-                    // adjust new corner locations to be within the image region
-                    x0 = std::max<float>(0.0f, std::min<float>(x0, img_W));
-                    y0 = std::max<float>(0.0f, std::min<float>(y0, img_H));
-                    x1 = std::max<float>(0.0f, std::min<float>(x1, img_W));
-                    y1 = std::max<float>(0.0f, std::min<float>(y1, img_H));
-                }
-
-                // width & height of box
-                const float ww = x1 - x0 + coordinates_offset;
-                const float hh = y1 - y0 + coordinates_offset;
-                // center location of box
-                const float ctr_x = x0 + 0.5f * ww;
-                const float ctr_y = y0 + 0.5f * hh;
-
-                // new center location according to gradient (dx, dy)
-                const float pred_ctr_x = dx * ww + ctr_x;
-                const float pred_ctr_y = dy * hh + ctr_y;
-                // new width & height according to gradient d(log w), d(log h)
-                const float pred_w = std::exp(d_log_w) * ww;
-                const float pred_h = std::exp(d_log_h) * hh;
-
-                // update upper-left corner location
-                x0 = pred_ctr_x - 0.5f * pred_w;
-                y0 = pred_ctr_y - 0.5f * pred_h;
-                // update lower-right corner location
-                x1 = pred_ctr_x + 0.5f * pred_w;
-                y1 = pred_ctr_y + 0.5f * pred_h;
-
-                // adjust new corner locations to be within the image region,
-                x0 = std::max<float>(0.0f, std::min<float>(x0, img_W - coordinates_offset));
-                y0 = std::max<float>(0.0f, std::min<float>(y0, img_H - coordinates_offset));
-                x1 = std::max<float>(0.0f, std::min<float>(x1, img_W - coordinates_offset));
-                y1 = std::max<float>(0.0f, std::min<float>(y1, img_H - coordinates_offset));
-
-                // recompute new width & height
-                const float box_w = x1 - x0 + coordinates_offset;
-                const float box_h = y1 - y0 + coordinates_offset;
-
-                p_proposal[5*anchor + 0] = x0;
-                p_proposal[5*anchor + 1] = y0;
-                p_proposal[5*anchor + 2] = x1;
-                p_proposal[5*anchor + 3] = y1;
-                p_proposal[5*anchor + 4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
-            }
-        }
-    }
-}
+    parallel_nd(bottom_H, bottom_W, [&](int h, int w) {
+        const float x = (swap_xy ? h : w) * feat_stride;
+        const float y = (swap_xy ? w : h) * feat_stride;
 
-static void unpack_boxes(const float* p_proposals, float* unpacked_boxes, int pre_nms_topn) {
-    #pragma omp parallel for schedule(static)
-    for (int i = 0; i < pre_nms_topn; i++) {
-        unpacked_boxes[0*pre_nms_topn + i] = p_proposals[5*i + 0];
-        unpacked_boxes[1*pre_nms_topn + i] = p_proposals[5*i + 1];
-        unpacked_boxes[2*pre_nms_topn + i] = p_proposals[5*i + 2];
-        unpacked_boxes[3*pre_nms_topn + i] = p_proposals[5*i + 3];
-    }
-}
+        const float* p_box   = d_anchor4d + h * bottom_W + w;
+        const float* p_score = bottom4d   + h * bottom_W + w;
 
-static
-void nms_cpu(const int num_boxes, int is_dead[],
-             const float* boxes, int index_out[], int* const num_out,
-             const int base_index, const float nms_thresh, const int max_num_out,
-             float coordinates_offset) {
-    const int num_proposals = num_boxes;
-    int count = 0;
-
-    const float* x0 = boxes + 0 * num_proposals;
-    const float* y0 = boxes + 1 * num_proposals;
-    const float* x1 = boxes + 2 * num_proposals;
-    const float* y1 = boxes + 3 * num_proposals;
-
-    memset(is_dead, 0, num_boxes * sizeof(int));
-
-#if defined(HAVE_AVX2)
-    __m256  vc_fone = _mm256_set1_ps(coordinates_offset);
-    __m256i vc_ione = _mm256_set1_epi32(1);
-    __m256  vc_zero = _mm256_set1_ps(0.0f);
-
-    __m256 vc_nms_thresh = _mm256_set1_ps(nms_thresh);
-#endif
-
-    for (int box = 0; box < num_boxes; ++box) {
-        if (is_dead[box])
-            continue;
-
-        index_out[count++] = base_index + box;
-        if (count == max_num_out)
-            break;
-
-        int tail = box + 1;
-
-#if defined(HAVE_AVX2)
-        __m256 vx0i = _mm256_set1_ps(x0[box]);
-        __m256 vy0i = _mm256_set1_ps(y0[box]);
-        __m256 vx1i = _mm256_set1_ps(x1[box]);
-        __m256 vy1i = _mm256_set1_ps(y1[box]);
-
-        __m256 vA_width  = _mm256_sub_ps(vx1i, vx0i);
-        __m256 vA_height = _mm256_sub_ps(vy1i, vy0i);
-        __m256 vA_area   = _mm256_mul_ps(_mm256_add_ps(vA_width, vc_fone), _mm256_add_ps(vA_height, vc_fone));
-
-        for (; tail <= num_boxes - 8; tail += 8) {
-            __m256i *pdst = reinterpret_cast<__m256i*>(is_dead + tail);
-            __m256i  vdst = _mm256_loadu_si256(pdst);
-
-            __m256 vx0j = _mm256_loadu_ps(x0 + tail);
-            __m256 vy0j = _mm256_loadu_ps(y0 + tail);
-            __m256 vx1j = _mm256_loadu_ps(x1 + tail);
-            __m256 vy1j = _mm256_loadu_ps(y1 + tail);
-
-            __m256 vx0 = _mm256_max_ps(vx0i, vx0j);
-            __m256 vy0 = _mm256_max_ps(vy0i, vy0j);
-            __m256 vx1 = _mm256_min_ps(vx1i, vx1j);
-            __m256 vy1 = _mm256_min_ps(vy1i, vy1j);
-
-            __m256 vwidth  = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_fone);
-            __m256 vheight = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_fone);
-            __m256 varea = _mm256_mul_ps(_mm256_max_ps(vc_zero, vwidth), _mm256_max_ps(vc_zero, vheight));
-
-            __m256 vB_width  = _mm256_sub_ps(vx1j, vx0j);
-            __m256 vB_height = _mm256_sub_ps(vy1j, vy0j);
-            __m256 vB_area   = _mm256_mul_ps(_mm256_add_ps(vB_width, vc_fone), _mm256_add_ps(vB_height, vc_fone));
-
-            __m256 vdivisor = _mm256_sub_ps(_mm256_add_ps(vA_area, vB_area), varea);
-            __m256 vintersection_area = _mm256_div_ps(varea, vdivisor);
-
-            __m256 vcmp_0 = _mm256_cmp_ps(vx0i, vx1j, _CMP_LE_OS);
-            __m256 vcmp_1 = _mm256_cmp_ps(vy0i, vy1j, _CMP_LE_OS);
-            __m256 vcmp_2 = _mm256_cmp_ps(vx0j, vx1i, _CMP_LE_OS);
-            __m256 vcmp_3 = _mm256_cmp_ps(vy0j, vy1i, _CMP_LE_OS);
-            __m256 vcmp_4 = _mm256_cmp_ps(vc_nms_thresh, vintersection_area, _CMP_LT_OS);
-
-            vcmp_0 = _mm256_and_ps(vcmp_0, vcmp_1);
-            vcmp_2 = _mm256_and_ps(vcmp_2, vcmp_3);
-            vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_0);
-            vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_2);
-
-            _mm256_storeu_si256(pdst, _mm256_blendv_epi8(vdst, vc_ione, _mm256_castps_si256(vcmp_4)));
-        }
-#endif
-
-        for (; tail < num_boxes; ++tail) {
-            float res = 0.0f;
-
-            const float x0i = x0[box];
-            const float y0i = y0[box];
-            const float x1i = x1[box];
-            const float y1i = y1[box];
-
-            const float x0j = x0[tail];
-            const float y0j = y0[tail];
-            const float x1j = x1[tail];
-            const float y1j = y1[tail];
-
-            if (x0i <= x1j && y0i <= y1j && x0j <= x1i && y0j <= y1i) {
-                // overlapped region (= box)
-                const float x0 = std::max<float>(x0i, x0j);
-                const float y0 = std::max<float>(y0i, y0j);
-                const float x1 = std::min<float>(x1i, x1j);
-                const float y1 = std::min<float>(y1i, y1j);
-
-                // intersection area
-                const float width  = std::max<float>(0.0f,  x1 - x0 + coordinates_offset);
-                const float height = std::max<float>(0.0f,  y1 - y0 + coordinates_offset);
-                const float area   = width * height;
-
-                // area of A, B
-                const float A_area = (x1i - x0i + coordinates_offset) * (y1i - y0i + coordinates_offset);
-                const float B_area = (x1j - x0j + coordinates_offset) * (y1j - y0j + coordinates_offset);
-
-                // IoU
-                res = area / (A_area + B_area - area);
+        float* p_proposal = proposals + (h * bottom_W + w) * num_anchors * 5;
+
+        for (int anchor = 0; anchor < num_anchors; ++anchor) {
+            const float dx = p_box[(anchor * 4 + 0) * bottom_area] / box_coordinate_scale;
+            const float dy = p_box[(anchor * 4 + 1) * bottom_area] / box_coordinate_scale;
+
+            const float d_log_w = p_box[(anchor * 4 + 2) * bottom_area] / box_size_scale;
+            const float d_log_h = p_box[(anchor * 4 + 3) * bottom_area] / box_size_scale;
+
+            const float score = p_score[anchor * bottom_area];
+
+            BoxOps::Box box = {x + p_anchors_wm[anchor], y + p_anchors_hm[anchor],
+                               x + p_anchors_wp[anchor], y + p_anchors_hp[anchor]};
+
+            if (initial_clip) {
+                // adjust new corner locations to be within the image region
+                box = BoxOps::clip(box, img_W, img_H);
             }
 
-            if (nms_thresh < res)
-                is_dead[tail] = 1;
+            // new box according to the gradient (dx, dy, d(log w), d(log h)),
+            // adjusted to be within the image region
+            box = BoxOps::decode(box, dx, dy, d_log_w, d_log_h, coordinates_offset);
+            box = BoxOps::clip(box, img_W - coordinates_offset, img_H - coordinates_offset);
+
+            // recompute new width & height
+            const float box_w = box.x1 - box.x0 + coordinates_offset;
+            const float box_h = box.y1 - box.y0 + coordinates_offset;
+
+            p_proposal[5*anchor + 0] = box.x0;
+            p_proposal[5*anchor + 1] = box.y0;
+            p_proposal[5*anchor + 2] = box.x1;
+            p_proposal[5*anchor + 3] = box.y1;
+            p_proposal[5*anchor + 4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
         }
-    }
+    });
+}
 
-    *num_out = count;
+struct ProposalBox {
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    float score;
+};
+
+static void unpack_boxes(const ProposalBox* proposals, const int* order, float* unpacked_boxes, int pre_nms_topn) {
+    parallel_for(pre_nms_topn, [&](int i) {
+        const ProposalBox& box = proposals[order[i]];
+        unpacked_boxes[0*pre_nms_topn + i] = box.x0;
+        unpacked_boxes[1*pre_nms_topn + i] = box.y0;
+        unpacked_boxes[2*pre_nms_topn + i] = box.x1;
+        unpacked_boxes[3*pre_nms_topn + i] = box.y1;
+    });
 }
 
 static
@@ -302,8 +153,7 @@ void retrieve_rois_cpu(const int num_rois, const int item_index,
     const float *src_x1 = proposals + 2 * num_proposals;
     const float *src_y1 = proposals + 3 * num_proposals;
 
-    #pragma omp parallel for schedule(static)
-    for (int roi = 0; roi < num_rois; roi++) {
+    parallel_for(num_rois, [&](int roi) {
         int index = roi_indices[roi];
 
         const float x0 = src_x0[index];
@@ -316,7 +166,7 @@ void retrieve_rois_cpu(const int num_rois, const int item_index,
         rois[roi * 5 + 2] = y0;
         rois[roi * 5 + 3] = x1;
         rois[roi * 5 + 4] = y1;
-    }
+    });
 
     if (num_rois < post_nms_topn_) {
         for (int i = 5 * num_rois; i < 5 * post_nms_topn_; i++) {
@@ -426,14 +276,9 @@ public:
         //   num_proposals = num_anchors * H * W
         //   (x1, y1, x2, y2, score) for each proposal
         // NOTE: for bottom, only foreground scores are passed
-        struct ProposalBox {
-            float x0;
-            float y0;
-            float x1;
-            float y1;
-            float score;
-        };
         std::vector<ProposalBox> proposals_(num_proposals);
+        std::vector<uint32_t> score_keys(num_proposals);
+        std::vector<int> order(pre_nms_topn);
         std::vector<float> unpacked_boxes(4 * pre_nms_topn);
         std::vector<int> is_dead(pre_nms_topn);
 
@@ -446,13 +291,11 @@ public:
                                     min_box_H, min_box_W, feat_stride_,
                                     box_coordinate_scale_, box_size_scale_,
                                     coordinates_offset, initial_clip, swap_xy);
-            std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
-                              [](const ProposalBox& struct1, const ProposalBox& struct2) {
-                                  return (struct1.score > struct2.score);
-                              });
+            BoxOps::select_topn(&proposals_[0].score, 5, num_proposals, pre_nms_topn, score_keys, &order[0]);
 
-            unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes[0], pre_nms_topn);
-            nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], &roi_indices_[0], &num_rois, 0, nms_thresh_, post_nms_topn_, coordinates_offset);
+            unpack_boxes(&proposals_[0], &order[0], &unpacked_boxes[0], pre_nms_topn);
+            num_rois = BoxOps::nms(&unpacked_boxes[0], pre_nms_topn, &is_dead[0], &roi_indices_[0], 0, nms_thresh_,
+                                   post_nms_topn_, coordinates_offset);
             retrieve_rois_cpu(num_rois, n, pre_nms_topn, &unpacked_boxes[0], &roi_indices_[0], p_roi_item, post_nms_topn_);
         }
 
@@ -8,12 +8,18 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include <cassert>
 #include <algorithm>
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+inline int div_up(const int a, const int b) {
+    assert(b);
+    return (a + b - 1) / b;
+}
+
 class PSROIPoolingImpl: public ExtLayerBase {
 public:
     explicit PSROIPoolingImpl(const CNNLayer* layer) {
@@ -39,6 +45,14 @@ public:
             nw = static_cast<int>(outDims[3]);
 
             addConfig(layer, {DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
+            // The blocked score maps of the convolution are read as is, the bins of one output channel are spread
+            // over the channel blocks so the reorder would copy the whole maps to read a few values of each.
+#if defined(HAVE_AVX512F)
+            auto blk_layout = ConfLayout::BLK16;
+#else
+            auto blk_layout = ConfLayout::BLK8;
+#endif
+            addConfig(layer, {DataConfigurator(blk_layout), DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -59,8 +73,16 @@ public:
             }
         }
 
-        #pragma omp parallel for schedule(static)
-        for (int n = 0; n < real_rois; n++) {
+#if defined(HAVE_AVX512F)
+        const int blk_size = inputs[0]->layout() == NCHW ? 1 : 16;
+#else
+        const int blk_size = inputs[0]->layout() == NCHW ? 1 : 8;
+#endif
+        const int CB = div_up(channels, blk_size);
+
+        // The output channels of the ROIs are pooled in parallel, the channel gc of the input is the lane
+        // gc % blk_size of the block gc / blk_size (the plain layout is the blocked one of blocks of 1 channel).
+        parallel_nd(real_rois, nc, [&](int n, int c) {
             const float* bottom_rois = bottom_rois_beginning + n * 5;
             int roi_batch_ind = static_cast<int>(bottom_rois[0]);
             float roi_start_w = static_cast<float>(round(bottom_rois[1])) * spatial_scale_;
@@ -75,44 +97,42 @@ public:
             float bin_size_h = roi_height / static_cast<float>(pooled_height_);
             float bin_size_w = roi_width  / static_cast<float>(pooled_width_);
 
-            for (int c = 0; c < nc; c++) {
-                for (int h = 0; h < nh; h++) {
-                    int hstart = floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h);
-                    int hend = ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h);
+            for (int h = 0; h < nh; h++) {
+                int hstart = floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h);
+                int hend = ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h);
 
-                    hstart = std::min<int>(std::max<int>(hstart, 0), height);
-                    hend = std::min<int>(std::max<int>(hend, 0), height);
+                hstart = std::min<int>(std::max<int>(hstart, 0), height);
+                hend = std::min<int>(std::max<int>(hend, 0), height);
 
-                    for (int w = 0; w < nw; w++) {
-                        int index = n * nc * nh * nw + c * nh * nw + h * nw + w;
-                        dst_data[index] = 0.0f;
+                for (int w = 0; w < nw; w++) {
+                    int index = n * nc * nh * nw + c * nh * nw + h * nw + w;
+                    dst_data[index] = 0.0f;
 
-                        int wstart = floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w);
-                        int wend = ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w);
+                    int wstart = floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w);
+                    int wend = ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w);
 
-                        wstart = std::min<int>(std::max<int>(wstart, 0), width);
-                        wend = std::min<int>(std::max<int>(wend, 0), width);
+                    wstart = std::min<int>(std::max<int>(wstart, 0), width);
+                    wend = std::min<int>(std::max<int>(wend, 0), width);
 
-                        float bin_area = (hend - hstart) * (wend - wstart);
-                        if (bin_area) {
-                            int gc = (c * group_size_ + h) * group_size_ + w;
-                            const float *bottom_data =
-                                    bottom_data_beginning + ((roi_batch_ind * channels + gc) * height * width);
+                    float bin_area = (hend - hstart) * (wend - wstart);
+                    if (bin_area) {
+                        int gc = (c * group_size_ + h) * group_size_ + w;
+                        const float *bottom_data = bottom_data_beginning +
+                                ((roi_batch_ind * CB + gc / blk_size) * height * width) * blk_size + gc % blk_size;
 
-                            float out_sum = 0.0f;
-                            for (int hh = hstart; hh < hend; ++hh)
-                                for (int ww = wstart; ww < wend; ++ww)
-                                    out_sum += bottom_data[hh * width + ww];
+                        float out_sum = 0.0f;
+                        for (int hh = hstart; hh < hend; ++hh)
+                            for (int ww = wstart; ww < wend; ++ww)
+                                out_sum += bottom_data[(hh * width + ww) * blk_size];
 
-                            dst_data[index] = out_sum / bin_area;
-                        }
+                        dst_data[index] = out_sum / bin_area;
                     }
                 }
             }
-        }
+        });
 
-        #pragma omp parallel for schedule(static)
-        for (int n = real_rois; n < nn; n++) {
+        parallel_for(nn - real_rois, [&](int i) {
+            const int n = real_rois + i;
             for (int c = 0; c < nc; c++) {
                 for (int h = 0; h < nh; h++) {
                     for (int w = 0; w < nw; w++) {
@@ -121,7 +141,7 @@ public:
                     }
                 }
             }
-        }
+        });
 
         return OK;
     }
@@ -7,6 +7,9 @@
 #include "ext_base.hpp"
 #include "defs.h"
 #include "softmax.h"
+#include <algorithm>
+#include <cmath>
+#include <string>
 #include <vector>
 
 namespace InferenceEngine {
@@ -26,6 +29,25 @@ public:
             do_softmax = static_cast<bool>(layer->GetParamAsInt("do_softmax", 1));
             mask = layer->GetParamAsInts("mask", {});
 
+            // the boxes are decoded to the centers and the sizes relative to the image, the probabilities of the
+            // classes are multiplied by the objectness, so the output holds the final detections
+            decode_boxes = layer->GetParamsAsBool("decode_boxes", false);
+            if (decode_boxes) {
+                anchors = layer->GetParamAsFloats("anchors");
+                input_width = layer->GetParamAsInt("input_width", 0);
+                input_height = layer->GetParamAsInt("input_height", 0);
+                if (coords != 4)
+                    THROW_IE_EXCEPTION << "Boxes can be decoded only with 4 coordinates";
+                size_t anchors_num = num;
+                for (int anchor : mask)
+                    anchors_num = std::max<size_t>(anchors_num, anchor + 1);
+                if (anchors.size() < 2 * anchors_num)
+                    THROW_IE_EXCEPTION << "Incorrect number of anchors: " << anchors.size();
+                // the anchors of Yolo v3 are in pixels of the input image
+                if (!do_softmax && (input_width <= 0 || input_height <= 0))
+                    THROW_IE_EXCEPTION << "Boxes of Yolo layer can be decoded only with input_width and input_height";
+            }
+
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
@@ -59,19 +81,13 @@ public:
         }
         int inputs_size = IH * IW * num_ * (classes + coords + 1);
 
-        for (int b = 0; b < B; b++) {
-            for (int n = 0; n < num_; n++) {
-                int index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, 0);
-                for (int i = index; i < index + 2 * IW * IH; i++) {
-                    dst_data[i] = logistic_activate(dst_data[i]);
-                }
-
-                index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, coords);
-                for (int i = index; i < index + end_index; i++) {
-                    dst_data[i] = logistic_activate(dst_data[i]);
-                }
-            }
-        }
+        parallel_nd(B, num_, [&](int b, int n) {
+            int index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, 0);
+            logistic_activate(dst_data + index, 2 * IW * IH);
+
+            index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, coords);
+            logistic_activate(dst_data + index, end_index);
+        });
 
         if (do_softmax) {
             int index = entry_index(IW, IH, coords, classes, inputs_size, 0, 0, coords + 1);
@@ -81,6 +97,17 @@ public:
                                 IH, IW);
         }
 
+        if (decode_boxes) {
+            parallel_nd(B, num_, [&](int b, int n) {
+                int index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, 0);
+                int anchor = do_softmax ? n : mask[n];
+                // the anchors of Region (Yolo v2) are in cells
+                float width_scale = anchors[2 * anchor] / (do_softmax ? IW : input_width);
+                float height_scale = anchors[2 * anchor + 1] / (do_softmax ? IH : input_height);
+                decode(dst_data + index, IW, IH, width_scale, height_scale);
+            });
+        }
+
         return OK;
     }
 
@@ -90,6 +117,10 @@ private:
     int num;
     float do_softmax;
     std::vector<int> mask;
+    bool decode_boxes = false;
+    std::vector<float> anchors;
+    int input_width = 0;
+    int input_height = 0;
 
     inline int entry_index(int width, int height, int coords, int classes, int outputs, int batch, int location,
                            int entry) {
@@ -99,8 +130,70 @@ private:
                entry * width * height + loc;
     }
 
-    inline float logistic_activate(float x) {
-        return 1.f / (1.f + exp(-x));
+    inline void logistic_activate(float *data, int size) {
+        int i = 0;
+#if defined(HAVE_AVX2)
+        const __m256 vc_one = _mm256_set1_ps(1.f);
+        for (; i <= size - 8; i += 8) {
+            __m256 vexp = _avx_opt_exp_ps(_mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(data + i)));
+            _mm256_storeu_ps(data + i, _mm256_div_ps(vc_one, _mm256_add_ps(vc_one, vexp)));
+        }
+#elif defined(HAVE_SSE)
+        const __m128 vc_one = _mm_set1_ps(1.f);
+        for (; i <= size - 4; i += 4) {
+            __m128 vexp = _sse_opt_exp_ps(_mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(data + i)));
+            _mm_storeu_ps(data + i, _mm_div_ps(vc_one, _mm_add_ps(vc_one, vexp)));
+        }
+#endif
+        for (; i < size; i++) {
+            data[i] = 1.f / (1.f + std::exp(-data[i]));
+        }
+    }
+
+    inline void exp_activate(float *data, int size) {
+        int i = 0;
+#if defined(HAVE_AVX2)
+        for (; i <= size - 8; i += 8) {
+            _mm256_storeu_ps(data + i, _avx_opt_exp_ps(_mm256_loadu_ps(data + i)));
+        }
+#elif defined(HAVE_SSE)
+        for (; i <= size - 4; i += 4) {
+            _mm_storeu_ps(data + i, _sse_opt_exp_ps(_mm_loadu_ps(data + i)));
+        }
+#endif
+        for (; i < size; i++) {
+            data[i] = std::exp(data[i]);
+        }
+    }
+
+    // decodes the activated entries of one anchor: x, y, w, h, objectness and the classes
+    inline void decode(float *data, int width, int height, float width_scale, float height_scale) {
+        const int area = width * height;
+        float *px = data;
+        float *py = data + area;
+        float *pw = data + 2 * area;
+        float *ph = data + 3 * area;
+        const float *pobjectness = data + coords * area;
+
+        for (int h = 0; h < height; h++) {
+            for (int w = 0; w < width; w++) {
+                px[h * width + w] = (w + px[h * width + w]) / width;
+                py[h * width + w] = (h + py[h * width + w]) / height;
+            }
+        }
+
+        exp_activate(pw, 2 * area);
+        for (int i = 0; i < area; i++) {
+            pw[i] *= width_scale;
+            ph[i] *= height_scale;
+        }
+
+        for (int c = 0; c < classes; c++) {
+            float *pclass = data + (coords + 1 + c) * area;
+            for (int i = 0; i < area; i++) {
+                pclass[i] *= pobjectness[i];
+            }
+        }
     }
 };
 
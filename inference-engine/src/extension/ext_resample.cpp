@@ -37,8 +37,8 @@ public:
             auto blk_layout = ConfLayout::BLK8;
 #endif
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
-            if (type == "caffe.ResampleParameter.NEAREST")
-                addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(blk_layout)});
+            // the blocked data of the convolutions around is resampled without the reorders
+            addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(blk_layout)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -62,7 +62,8 @@ public:
         size_t OW = outputs[0]->getTensorDesc().getDims()[3];
 
         if (IW == OW && IH == OH && type == "caffe.ResampleParameter.LINEAR") {
-            memcpy(dst_data, src_data, IN * IC * IH * IW * sizeof(float));
+            size_t channels = layout == NCHW ? IC : div_up(IC, blk_size) * blk_size;
+            memcpy(dst_data, src_data, IN * channels * IH * IW * sizeof(float));
             return OK;
         }
 
@@ -85,21 +86,28 @@ public:
                     Upsample_Nearest_BLK<2>(src_data, dst_data, IN, IC, IH, IW);
                 }
             } else {
+                prepareNearestTables(IH, IW, fx, fy, OH, OW);
                 if (layout == NCHW) {
-                    NearestNeighborKernel_PLN(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW);
+                    NearestNeighborKernel_PLN(src_data, dst_data, IN, IC, IH, IW, OH, OW);
                 } else {
-                    NearestNeighborKernel_BLK(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW);
+                    NearestNeighborKernel_BLK(src_data, dst_data, IN, IC, IH, IW, OH, OW);
                 }
             }
         } else if (type == "caffe.ResampleParameter.LINEAR") {
             size_t kernel_width = 2;
 
 #if defined(HAVE_SSE) || defined(HAVE_AVX2)
-            if (!isDownsample && fx == 0.25f && fy == 0.25f)
+            if (layout == NCHW && !isDownsample && fx == 0.25f && fy == 0.25f) {
                 Upsample4x_TriangleInterpolation(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN);
-            else
+                return OK;
+            }
 #endif
-                InterpolationKernel(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN, kernel_width, isDownsample && antialias);
+            prepareLinearTables(IH, IW, fx, fy, OH, OW, kernel_width, isDownsample && antialias);
+            if (layout == NCHW) {
+                InterpolationKernel(src_data, IW, IH, dst_data, OW, OH, IC, IN);
+            } else {
+                InterpolationKernel_BLK(src_data, IW, IH, dst_data, OW, OH, IC, IN);
+            }
         }
         return OK;
     }
@@ -108,107 +116,209 @@ private:
     std::string type;
     bool antialias;
 
-    static inline float triangleCoeff(float x) {
-        return std::max(0.0f, 1 - std::abs(x));
-    }
-
-    static void InterpolationKernel(const float *in_ptr_,
-                                    const size_t iw, const size_t ih,
-                                    const float fx, const float fy,
-                                    float *out_ptr_,
-                                    const size_t ow, const size_t oh, const size_t channels, const size_t batch,
-                                    size_t kernel_width, bool antialias) {
-        for (size_t b = 0; b < batch; b++) {
-            for (size_t c = 0; c < channels; c++) {
-                const float *in_ptr = in_ptr_ + iw * ih * channels * b + iw * ih * c;
-                float *out_ptr = out_ptr_ + ow * oh * channels * b + ow * oh * c;
-
-                for (size_t oy = 0; oy < oh; oy++) {
-                    for (size_t ox = 0; ox < ow; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
-
-                        int ix_r = static_cast<int>(round(ix));
-                        int iy_r = static_cast<int>(round(iy));
+#if defined(HAVE_AVX512F)
+    static const int blk_size = 16;
+#else
+    static const int blk_size = 8;
+#endif
 
-                        float sum = 0;
-                        float wsum = 0;
+    // The source positions and the weights of every output row and column. They depend only on the shapes,
+    // so they are computed once and reused until the shapes change.
+    struct InterpolationTable {
+        // the number of the source points per output point
+        int taps = 0;
+        // the source points of the output point i are index[i * taps + k], the normalized weights are weight[...]
+        std::vector<int> index;
+        std::vector<float> weight;
+    };
+
+    size_t tables_ih = 0, tables_iw = 0, tables_oh = 0, tables_ow = 0;
+    bool tables_linear = false;
+    bool tables_antialias = false;
+    InterpolationTable table_y, table_x;
+
+    bool tablesAreValid(size_t IH, size_t IW, size_t OH, size_t OW, bool linear) {
+        if (tables_ih == IH && tables_iw == IW && tables_oh == OH && tables_ow == OW && tables_linear == linear)
+            return true;
+        tables_ih = IH;
+        tables_iw = IW;
+        tables_oh = OH;
+        tables_ow = OW;
+        tables_linear = linear;
+        return false;
+    }
 
-                        float ax = 1.0f / (antialias ? fx : 1.0f);
-                        float ay = 1.0f / (antialias ? fy : 1.0f);
+    void prepareNearestTables(size_t IH, size_t IW, float fx, float fy, size_t OH, size_t OW) {
+        if (tablesAreValid(IH, IW, OH, OW, false))
+            return;
 
-                        int rx = (fx < 1.0f) ? 2 : ceil(static_cast<float>(kernel_width) / ax);
-                        int ry = (fy < 1.0f) ? 2 : ceil(static_cast<float>(kernel_width) / ay);
+        table_y.taps = table_x.taps = 1;
+        table_y.index.resize(OH);
+        table_x.index.resize(OW);
+        for (size_t oy = 0; oy < OH; oy++) {
+            float iy = oy * fy + fx / 2.0f - 0.5f;
+            table_y.index[oy] = static_cast<int>(static_cast<size_t>(round(iy)));
+        }
+        for (size_t ox = 0; ox < OW; ox++) {
+            float ix = ox * fx + fy / 2.0f - 0.5f;
+            table_x.index[ox] = static_cast<int>(static_cast<size_t>(round(ix)));
+        }
+    }
 
-                        for (int y = iy_r - ry; y <= iy_r + ry; y++) {
-                            for (int x = ix_r - rx; x <= ix_r + rx; x++) {
-                                if (y < 0 || x < 0 || y >= static_cast<int>(ih) || x >= static_cast<int>(iw))
-                                    continue;
+    // the triangle filter is separable: the weight of the source point is the product of the weights by the axes,
+    // and the sum of the weights is the product of their sums, so the weights are normalized by the axes
+    static void prepareLinearTable(InterpolationTable &table, size_t in, size_t out, float f, float offset,
+                                   size_t kernel_width, bool antialias) {
+        float a = 1.0f / (antialias ? f : 1.0f);
+        int r = (f < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / a));
+
+        table.taps = 2 * r + 1;
+        table.index.assign(out * table.taps, 0);
+        table.weight.assign(out * table.taps, 0.0f);
+        for (size_t o = 0; o < out; o++) {
+            float i = o * f + offset;
+            int i_r = static_cast<int>(round(i));
+
+            float sum = 0.0f;
+            for (int k = 0; k < table.taps; k++) {
+                int src = i_r - r + k;
+                if (src < 0 || src >= static_cast<int>(in))
+                    continue;
+                float w = a * triangleCoeff(a * (i - src));
+                table.index[o * table.taps + k] = src;
+                table.weight[o * table.taps + k] = w;
+                sum += w;
+            }
+            for (int k = 0; k < table.taps; k++)
+                table.weight[o * table.taps + k] = sum != 0.0f ? table.weight[o * table.taps + k] / sum : 0.0f;
+        }
+    }
 
-                                float dx = ix - x;
-                                float dy = iy - y;
+    void prepareLinearTables(size_t IH, size_t IW, float fx, float fy, size_t OH, size_t OW,
+                             size_t kernel_width, bool antialias) {
+        if (tablesAreValid(IH, IW, OH, OW, true) && antialias == tables_antialias)
+            return;
+        tables_antialias = antialias;
 
-                                float w = ax * triangleCoeff(ax * dx) * ay * triangleCoeff(ay * dy);
+        prepareLinearTable(table_y, IH, OH, fy, fx / 2.0f - 0.5f, kernel_width, antialias);
+        prepareLinearTable(table_x, IW, OW, fx, fy / 2.0f - 0.5f, kernel_width, antialias);
+    }
 
-                                sum += w * in_ptr[y * iw + x];
-                                wsum += w;
-                            }
-                        }
+    static inline float triangleCoeff(float x) {
+        return std::max(0.0f, 1 - std::abs(x));
+    }
 
-                        out_ptr[oy * ow + ox] = (!wsum) ? 0 : (sum / wsum);
-                    }
+    void InterpolationKernel(const float *in_ptr_, const size_t iw, const size_t ih,
+                             float *out_ptr_, const size_t ow, const size_t oh,
+                             const size_t channels, const size_t batch) {
+        const int taps_y = table_y.taps;
+        const int taps_x = table_x.taps;
+
+        parallel_nd(static_cast<int>(batch), static_cast<int>(channels), static_cast<int>(oh), [&](int b, int c, int oy) {
+            const float *in_ptr = in_ptr_ + iw * ih * channels * b + iw * ih * c;
+            float *out_ptr = out_ptr_ + ow * oh * channels * b + ow * oh * c + oy * ow;
+
+            const int *py = &table_y.index[oy * taps_y];
+            const float *wy = &table_y.weight[oy * taps_y];
+
+            for (size_t ox = 0; ox < ow; ox++) {
+                const int *px = &table_x.index[ox * taps_x];
+                const float *wx = &table_x.weight[ox * taps_x];
+
+                float sum = 0.0f;
+                for (int ky = 0; ky < taps_y; ky++) {
+                    if (wy[ky] == 0.0f)
+                        continue;
+                    const float *in_row = in_ptr + py[ky] * iw;
+                    float row_sum = 0.0f;
+                    for (int kx = 0; kx < taps_x; kx++)
+                        row_sum += wx[kx] * in_row[px[kx]];
+                    sum += wy[ky] * row_sum;
                 }
+                out_ptr[ox] = sum;
             }
-        }
+        });
     }
 
-    static void NearestNeighborKernel_PLN(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW) {
-        for (size_t b = 0; b < B; b++) {
-            for (size_t c = 0; c < C; c++) {
-                const float *in_ptr = in_ptr_ + IW * IH * C * b + IW * IH * c;
-                float *out_ptr = out_ptr_ + OW * OH * C * b + OW * OH * c;
+    void InterpolationKernel_BLK(const float *in_ptr_, const size_t iw, const size_t ih,
+                                 float *out_ptr_, const size_t ow, const size_t oh,
+                                 const size_t channels, const size_t batch) {
+        const int CB = div_up(static_cast<int>(channels), blk_size);
+        const int taps_y = table_y.taps;
+        const int taps_x = table_x.taps;
 
-                for (size_t oy = 0; oy < OH; oy++) {
-                    for (size_t ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
+        parallel_nd(static_cast<int>(batch), CB, static_cast<int>(oh), [&](int b, int cb, int oy) {
+            const float *in_ptr = in_ptr_ + (iw * ih * CB * b + iw * ih * cb) * blk_size;
+            float *out_ptr = out_ptr_ + (ow * oh * CB * b + ow * oh * cb + oy * ow) * blk_size;
 
-                        size_t ix_r = static_cast<size_t>(round(ix));
-                        size_t iy_r = static_cast<size_t>(round(iy));
+            const int *py = &table_y.index[oy * taps_y];
+            const float *wy = &table_y.weight[oy * taps_y];
 
-                        out_ptr[oy * OW + ox] = in_ptr[iy_r * IW + ix_r];
+            for (size_t ox = 0; ox < ow; ox++) {
+                const int *px = &table_x.index[ox * taps_x];
+                const float *wx = &table_x.weight[ox * taps_x];
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                auto vsum = _mm_uni_setzero_ps();
+                for (int ky = 0; ky < taps_y; ky++) {
+                    if (wy[ky] == 0.0f)
+                        continue;
+                    const float *in_row = in_ptr + py[ky] * iw * blk_size;
+                    auto vrow_sum = _mm_uni_setzero_ps();
+                    for (int kx = 0; kx < taps_x; kx++) {
+                        auto vsrc = _mm_uni_loadu_ps(in_row + px[kx] * blk_size);
+                        vrow_sum = _mm_uni_add_ps(vrow_sum, _mm_uni_mul_ps(_mm_uni_set1_ps(wx[kx]), vsrc));
                     }
+                    vsum = _mm_uni_add_ps(vsum, _mm_uni_mul_ps(_mm_uni_set1_ps(wy[ky]), vrow_sum));
                 }
+                _mm_uni_storeu_ps(out_ptr + ox * blk_size, vsum);
+#else
+                float sum[blk_size] = {};
+                for (int ky = 0; ky < taps_y; ky++) {
+                    if (wy[ky] == 0.0f)
+                        continue;
+                    const float *in_row = in_ptr + py[ky] * iw * blk_size;
+                    for (int kx = 0; kx < taps_x; kx++) {
+                        for (int c = 0; c < blk_size; c++)
+                            sum[c] += wy[ky] * wx[kx] * in_row[px[kx] * blk_size + c];
+                    }
+                }
+                for (int c = 0; c < blk_size; c++)
+                    out_ptr[ox * blk_size + c] = sum[c];
+#endif
             }
-        }
+        });
     }
 
-    static void NearestNeighborKernel_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW) {
-        int blk_size = 8;
-        size_t CB = (size_t)div_up(C, blk_size);
+    void NearestNeighborKernel_PLN(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, int OH, int OW) {
+        parallel_nd(B, C, OH, [&](int b, int c, int oy) {
+            const float *in_ptr = in_ptr_ + IW * IH * C * b + IW * IH * c + table_y.index[oy] * IW;
+            float *out_ptr = out_ptr_ + OW * OH * C * b + OW * OH * c + oy * OW;
+            const int *px = table_x.index.data();
 
-        for (size_t b = 0; b < B; b++) {
-            for (size_t cb = 0; cb < CB; cb++) {
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
-
-                for (size_t oy = 0; oy < OH; oy++) {
-                    for (size_t ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
+            for (int ox = 0; ox < OW; ox++) {
+                out_ptr[ox] = in_ptr[px[ox]];
+            }
+        });
+    }
 
-                        size_t ix_r = static_cast<size_t>(round(ix));
-                        size_t iy_r = static_cast<size_t>(round(iy));
+    void NearestNeighborKernel_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, int OH, int OW) {
+        int CB = div_up(C, blk_size);
 
-                        for (int c = 0; c < blk_size; c++) {
-                            float value = in_ptr[iy_r * IW * blk_size + ix_r * blk_size + c];
+        parallel_nd(B, CB, OH, [&](int b, int cb, int oy) {
+            const float *in_ptr = in_ptr_ + (IW * IH * CB * b + IW * IH * cb + table_y.index[oy] * IW) * blk_size;
+            float *out_ptr = out_ptr_ + (OW * OH * CB * b + OW * OH * cb + oy * OW) * blk_size;
+            const int *px = table_x.index.data();
 
-                            out_ptr[oy * OW * blk_size + ox * blk_size + c] = value;
-                        }
-                    }
+            for (int ox = 0; ox < OW; ox++) {
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                _mm_uni_storeu_ps(out_ptr + ox * blk_size, _mm_uni_loadu_ps(in_ptr + px[ox] * blk_size));
+#else
+                for (int c = 0; c < blk_size; c++) {
+                    out_ptr[ox * blk_size + c] = in_ptr[px[ox] * blk_size + c];
                 }
+#endif
             }
-        }
+        });
     }
 
     template <int factor>
@@ -240,12 +350,6 @@ private:
 
     template <int factor>
     static void Upsample_Nearest_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW) {
-#if defined(HAVE_AVX512F)
-        int blk_size = 16;
-#else
-        int blk_size = 8;
-#endif
-
 #if defined(HAVE_AVX512F)
         typedef __m512 vec_type;
 #elif defined(HAVE_AVX2)
@@ -257,54 +361,47 @@ private:
         int OH = factor * IH;
         int OW = factor * IW;
 
-#if _MSC_VER && !__INTEL_COMPILER
-        #pragma omp parallel for schedule(static)
-#else
-        #pragma omp parallel for collapse(2) schedule(static)
-#endif
-        for (int b = 0; b < B; b++) {
-            for (int cb = 0; cb < CB; cb++) {
+        parallel_nd(B, CB, [&](int b, int cb) {
 #if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
+            const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
+            float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
 
-                for (size_t iy = 0; iy < IH; iy++) {
-                    for (size_t ix = 0; ix < IW; ix++) {
-                        size_t oy = factor * iy;
-                        size_t ox = factor * ix;
+            for (size_t iy = 0; iy < IH; iy++) {
+                for (size_t ix = 0; ix < IW; ix++) {
+                    size_t oy = factor * iy;
+                    size_t ox = factor * ix;
 
-                        vec_type vsrc = _mm_uni_loadu_ps(in_ptr + iy * IW * blk_size + ix * blk_size);
+                    vec_type vsrc = _mm_uni_loadu_ps(in_ptr + iy * IW * blk_size + ix * blk_size);
 
-                        for (int fh = 0; fh < factor; fh++) {
-                            for (int fw = 0; fw < factor; fw++) {
-                                _mm_uni_storeu_ps(out_ptr + (oy + fh) * OW * blk_size + (ox + fw) * blk_size, vsrc);
-                            }
+                    for (int fh = 0; fh < factor; fh++) {
+                        for (int fw = 0; fw < factor; fw++) {
+                            _mm_uni_storeu_ps(out_ptr + (oy + fh) * OW * blk_size + (ox + fw) * blk_size, vsrc);
                         }
                     }
                 }
+            }
 #else
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
+            const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
+            float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
 
-                for (int iy = 0; iy < IH; iy++) {
-                    for (int ix = 0; ix < IW; ix++) {
-                        int oy = factor * iy;
-                        int ox = factor * ix;
+            for (int iy = 0; iy < IH; iy++) {
+                for (int ix = 0; ix < IW; ix++) {
+                    int oy = factor * iy;
+                    int ox = factor * ix;
 
-                        for (int c = 0; c < blk_size; c++) {
-                            float value = in_ptr[iy * IW * blk_size + ix * blk_size + c];
+                    for (int c = 0; c < blk_size; c++) {
+                        float value = in_ptr[iy * IW * blk_size + ix * blk_size + c];
 
-                            for (int fh = 0; fh < factor; fh++) {
-                                for (int fw = 0; fw < factor; fw++) {
-                                    out_ptr[(oy + fh) * OW * blk_size + (ox + fw) * blk_size + c] = value;
-                                }
+                        for (int fh = 0; fh < factor; fh++) {
+                            for (int fw = 0; fw < factor; fw++) {
+                                out_ptr[(oy + fh) * OW * blk_size + (ox + fw) * blk_size + c] = value;
                             }
                         }
                     }
                 }
-#endif
             }
-        }
+#endif
+        });
     }
 
 
@@ -0,0 +1,295 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ext_list.hpp"
+#include "ext_base.hpp"
+
+#include <cfloat>
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+inline int div_up(const int a, const int b) {
+    assert(b);
+    return (a + b - 1) / b;
+}
+
+/**
+ * ROIAlign of the second stage detectors (Mask R-CNN): the bins of the ROIs are not rounded to the pixels, each bin
+ * takes the average (or the maximum) of the bilinear interpolations of the input at the regular grid of
+ * sampling_ratio x sampling_ratio points, the grid is ceil(bin size) points per side when sampling_ratio is 0.
+ * The ROIs are [batch index, x1, y1, x2, y2] in the input image, the ROIs after the one of batch index -1 are zeros.
+ */
+class ROIAlignImpl: public ExtLayerBase {
+public:
+    explicit ROIAlignImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.size() != 2 || layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
+
+            pooled_h = layer->GetParamAsInt("pooled_h");
+            pooled_w = layer->GetParamAsInt("pooled_w");
+            spatial_scale = layer->GetParamAsFloat("spatial_scale");
+            sampling_ratio = layer->GetParamAsInt("sampling_ratio", 0);
+            if (pooled_h <= 0 || pooled_w <= 0 || sampling_ratio < 0)
+                THROW_IE_EXCEPTION << "Incorrect ROIAlign parameters!";
+
+            std::string method = layer->GetParamAsString("method", "avg");
+            if (method == "max") {
+                max_mode = true;
+            } else if (method != "avg") {
+                THROW_IE_EXCEPTION << "Unsupported ROIAlign method: " << method;
+            }
+
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() != 4)
+                THROW_IE_EXCEPTION << "ROIAlign supports only 4D input!";
+            SizeVector roiDims = layer->insData[1].lock()->getTensorDesc().getDims();
+            if (roiDims.size() != 2 || roiDims[1] != 5)
+                THROW_IE_EXCEPTION << "Incorrect shape of the ROIs!";
+
+            addConfig(layer, {DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
+#if defined(HAVE_AVX512F)
+            auto blk_layout = ConfLayout::BLK16;
+#else
+            auto blk_layout = ConfLayout::BLK8;
+#endif
+            addConfig(layer, {DataConfigurator(blk_layout), DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(blk_layout)});
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc *resp) noexcept override {
+        const float *src_data = inputs[0]->buffer();
+        const float *src_rois = inputs[1]->buffer();
+        float *dst_data = outputs[0]->buffer();
+
+        SizeVector dims = inputs[0]->getTensorDesc().getDims();
+        const int C = static_cast<int>(dims[1]);
+        const int H = static_cast<int>(dims[2]);
+        const int W = static_cast<int>(dims[3]);
+        const int num_rois = static_cast<int>(outputs[0]->getTensorDesc().getDims()[0]);
+
+#if defined(HAVE_AVX512F)
+        const int blk_size = inputs[0]->layout() == NCHW ? 1 : 16;
+#else
+        const int blk_size = inputs[0]->layout() == NCHW ? 1 : 8;
+#endif
+        const int CB = div_up(C, blk_size);
+        const int bins = pooled_h * pooled_w;
+
+        int real_rois = 0;
+        for (; real_rois < num_rois; real_rois++) {
+            if (static_cast<int>(src_rois[real_rois * 5]) == -1)
+                break;
+        }
+
+        // The sampling points are shared by all the channels of the ROI
+        std::vector<std::vector<SamplePoint>> points(real_rois);
+        std::vector<int> counts(real_rois);
+        parallel_for(real_rois, [&](int n) {
+            counts[n] = samplePoints(src_rois + n * 5, H, W, blk_size, points[n]);
+        });
+
+        // The plain layout is pooled as the blocked one of blocks of 1 channel
+        parallel_nd(real_rois, CB, [&](int n, int cb) {
+            int roi_batch_ind = static_cast<int>(src_rois[n * 5]);
+            const float *src = src_data + (roi_batch_ind * CB + cb) * H * W * blk_size;
+            float *dst = dst_data + (n * CB + cb) * bins * blk_size;
+            if (blk_size == 1) {
+                poolChannel(src, dst, points[n], counts[n]);
+            } else {
+                poolBlock(src, dst, points[n], counts[n], blk_size);
+            }
+        });
+
+        parallel_for(num_rois - real_rois, [&](int i) {
+            const int n = real_rois + i;
+            std::fill_n(dst_data + n * CB * bins * blk_size, CB * bins * blk_size, 0.0f);
+        });
+
+        return OK;
+    }
+
+private:
+    // The bilinear interpolation of the input at a sampling point: the offsets and the weights of the 4 neighbours
+    struct SamplePoint {
+        int offset[4];
+        float weight[4];
+    };
+
+    int samplePoints(const float *roi, int H, int W, int blk_size, std::vector<SamplePoint>& points) const;
+    void poolChannel(const float *src, float *dst, const std::vector<SamplePoint>& points, int count) const;
+    void poolBlock(const float *src, float *dst, const std::vector<SamplePoint>& points, int count, int blk_size) const;
+
+    int pooled_h = 0;
+    int pooled_w = 0;
+    float spatial_scale = 0;
+    int sampling_ratio = 0;
+    bool max_mode = false;
+};
+
+int ROIAlignImpl::samplePoints(const float *roi, int H, int W, int blk_size, std::vector<SamplePoint>& points) const {
+    float roi_start_w = roi[1] * spatial_scale;
+    float roi_start_h = roi[2] * spatial_scale;
+    float roi_end_w = roi[3] * spatial_scale;
+    float roi_end_h = roi[4] * spatial_scale;
+
+    // Force malformed ROIs to be 1x1
+    float roi_width = std::max(roi_end_w - roi_start_w, 1.0f);
+    float roi_height = std::max(roi_end_h - roi_start_h, 1.0f);
+
+    float bin_size_h = roi_height / static_cast<float>(pooled_h);
+    float bin_size_w = roi_width / static_cast<float>(pooled_w);
+
+    int grid_h = sampling_ratio > 0 ? sampling_ratio : static_cast<int>(std::ceil(bin_size_h));
+    int grid_w = sampling_ratio > 0 ? sampling_ratio : static_cast<int>(std::ceil(bin_size_w));
+
+    points.resize(pooled_h * pooled_w * grid_h * grid_w);
+    size_t i = 0;
+    for (int ph = 0; ph < pooled_h; ph++) {
+        for (int pw = 0; pw < pooled_w; pw++) {
+            for (int iy = 0; iy < grid_h; iy++) {
+                float y = roi_start_h + ph * bin_size_h + (iy + 0.5f) * bin_size_h / grid_h;
+                for (int ix = 0; ix < grid_w; ix++) {
+                    float x = roi_start_w + pw * bin_size_w + (ix + 0.5f) * bin_size_w / grid_w;
+
+                    SamplePoint& point = points[i++];
+                    if (y < -1.0f || y > H || x < -1.0f || x > W) {
+                        // the point is out of the input, it counts as zero
+                        point = SamplePoint();
+                        continue;
+                    }
+
+                    float yy = std::max(y, 0.0f);
+                    float xx = std::max(x, 0.0f);
+                    int y_low = static_cast<int>(yy);
+                    int x_low = static_cast<int>(xx);
+                    int y_high = y_low + 1;
+                    int x_high = x_low + 1;
+                    if (y_low >= H - 1) {
+                        y_low = y_high = H - 1;
+                        yy = static_cast<float>(y_low);
+                    }
+                    if (x_low >= W - 1) {
+                        x_low = x_high = W - 1;
+                        xx = static_cast<float>(x_low);
+                    }
+
+                    float ly = yy - y_low;
+                    float lx = xx - x_low;
+                    float hy = 1.0f - ly;
+                    float hx = 1.0f - lx;
+
+                    point.offset[0] = (y_low * W + x_low) * blk_size;
+                    point.offset[1] = (y_low * W + x_high) * blk_size;
+                    point.offset[2] = (y_high * W + x_low) * blk_size;
+                    point.offset[3] = (y_high * W + x_high) * blk_size;
+                    point.weight[0] = hy * hx;
+                    point.weight[1] = hy * lx;
+                    point.weight[2] = ly * hx;
+                    point.weight[3] = ly * lx;
+                }
+            }
+        }
+    }
+    return grid_h * grid_w;
+}
+
+void ROIAlignImpl::poolChannel(const float *src, float *dst, const std::vector<SamplePoint>& points, int count) const {
+    const SamplePoint *point = points.data();
+    for (int bin = 0; bin < pooled_h * pooled_w; bin++) {
+        float acc = max_mode ? -FLT_MAX : 0.0f;
+        for (int i = 0; i < count; i++, point++) {
+            float value = point->weight[0] * src[point->offset[0]] + point->weight[1] * src[point->offset[1]] +
+                          point->weight[2] * src[point->offset[2]] + point->weight[3] * src[point->offset[3]];
+            acc = max_mode ? std::max(acc, value) : acc + value;
+        }
+        dst[bin] = max_mode ? acc : acc / count;
+    }
+}
+
+void ROIAlignImpl::poolBlock(const float *src, float *dst, const std::vector<SamplePoint>& points, int count,
+                             int blk_size) const {
+#if defined(HAVE_AVX512F)
+    typedef __m512 vec_type;
+#elif defined(HAVE_AVX2)
+    typedef __m256 vec_type;
+#endif
+
+    const SamplePoint *point = points.data();
+    for (int bin = 0; bin < pooled_h * pooled_w; bin++, point += count) {
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        // the vector is the block of the channels
+        vec_type vacc = max_mode ? _mm_uni_set1_ps(-FLT_MAX) : _mm_uni_setzero_ps();
+        for (int i = 0; i < count; i++) {
+            const SamplePoint& p = point[i];
+            vec_type vvalue = _mm_uni_mul_ps(_mm_uni_set1_ps(p.weight[0]), _mm_uni_loadu_ps(src + p.offset[0]));
+            vvalue = _mm_uni_add_ps(vvalue, _mm_uni_mul_ps(_mm_uni_set1_ps(p.weight[1]), _mm_uni_loadu_ps(src + p.offset[1])));
+            vvalue = _mm_uni_add_ps(vvalue, _mm_uni_mul_ps(_mm_uni_set1_ps(p.weight[2]), _mm_uni_loadu_ps(src + p.offset[2])));
+            vvalue = _mm_uni_add_ps(vvalue, _mm_uni_mul_ps(_mm_uni_set1_ps(p.weight[3]), _mm_uni_loadu_ps(src + p.offset[3])));
+            vacc = max_mode ? _mm_uni_max_ps(vacc, vvalue) : _mm_uni_add_ps(vacc, vvalue);
+        }
+        if (!max_mode)
+            vacc = _mm_uni_mul_ps(vacc, _mm_uni_set1_ps(1.0f / count));
+        _mm_uni_storeu_ps(dst + bin * blk_size, vacc);
+#else
+        for (int c = 0; c < blk_size; c++) {
+            float acc = max_mode ? -FLT_MAX : 0.0f;
+            for (int i = 0; i < count; i++) {
+                const SamplePoint& p = point[i];
+                float value = p.weight[0] * src[p.offset[0] + c] + p.weight[1] * src[p.offset[1] + c] +
+                              p.weight[2] * src[p.offset[2] + c] + p.weight[3] * src[p.offset[3] + c];
+                acc = max_mode ? std::max(acc, value) : acc + value;
+            }
+            dst[bin * blk_size + c] = max_mode ? acc : acc / count;
+        }
+#endif
+    }
+}
+
+class ROIAlignShapeInfer : public IShapeInferImpl {
+public:
+    StatusCode inferShapes(const std::vector<SizeVector>& inShapes,
+                           const std::map<std::string, std::string>& params,
+                           const std::map<std::string, Blob::Ptr>& blobs,
+                           std::vector<SizeVector>& outShapes,
+                           ResponseDesc* resp) noexcept override {
+        try {
+            if (inShapes.size() != 2 || inShapes[0].size() != 4 || inShapes[1].size() != 2)
+                THROW_IE_EXCEPTION << "Incorrect input shapes of ROIAlign!";
+
+            LayerParams lp{};
+            CNNLayer cnnLayer(lp);
+            cnnLayer.params = params;
+            size_t pooled_h = static_cast<size_t>(cnnLayer.GetParamAsInt("pooled_h"));
+            size_t pooled_w = static_cast<size_t>(cnnLayer.GetParamAsInt("pooled_w"));
+            outShapes.push_back({inShapes[1][0], inShapes[0][1], pooled_h, pooled_w});
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            if (resp) {
+                std::string errorMsg = ex.what();
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
+        }
+        return InferenceEngine::OK;
+    }
+};
+
+REG_FACTORY_FOR(ImplFactory<ROIAlignImpl>, ROIAlign);
+REG_SHAPE_INFER_FOR_TYPE(ROIAlignShapeInfer, ROIAlign);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -5,6 +5,7 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "box_ops.h"
 
 #include <cmath>
 #include <string>
@@ -15,35 +16,6 @@ namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
-struct simpler_nms_roi_t {
-    float x0, y0, x1, y1;
-
-    static inline const float clamp_v(const float v, const float v_min, const float v_max) {
-        return std::max(v_min, std::min(v, v_max));
-    }
-
-    float area() const { return std::max<float>(0, y1 - y0 + 1) * std::max<float>(0, x1 - x0 + 1); }
-
-    simpler_nms_roi_t intersect(simpler_nms_roi_t other) const {
-        return {
-            std::max(x0, other.x0),
-            std::max(y0, other.y0),
-            std::min(x1, other.x1),
-            std::min(y1, other.y1)
-        };
-    }
-    simpler_nms_roi_t clamp(simpler_nms_roi_t other) const {
-        return {
-            clamp_v(x0, other.x0, other.x1),
-            clamp_v(y0, other.y0, other.y1),
-            clamp_v(x1, other.x0, other.x1),
-            clamp_v(y1, other.y0, other.y1)
-        };
-    }
-};
-
-struct simpler_nms_delta_t { float shift_x, shift_y, log_w, log_h; };
-struct simpler_nms_proposal_t { simpler_nms_roi_t roi; float confidence; size_t ord; };
 struct simpler_nms_anchor { float start_x; float start_y; float end_x; float end_y; };
 
 
@@ -131,71 +103,6 @@ void GenerateAnchors(unsigned int base_size, const std::vector<float>& ratios,
     }
 }
 
-std::vector<simpler_nms_roi_t> simpler_nms_perform_nms(
-        const std::vector<simpler_nms_proposal_t>& proposals,
-        float iou_threshold,
-        size_t top_n) {
-    std::vector<simpler_nms_roi_t> res;
-    res.reserve(top_n);
-    for (const auto & prop : proposals) {
-        const auto bbox = prop.roi;
-        const float area = bbox.area();
-
-        // For any realistic WL, this condition is true for all top_n values anyway
-        if (prop.confidence > 0) {
-            bool overlaps = std::any_of(res.begin(), res.end(), [&](const simpler_nms_roi_t& res_bbox) {
-                float interArea = bbox.intersect(res_bbox).area();
-                float unionArea = res_bbox.area() + area - interArea;
-                return interArea > iou_threshold * unionArea;
-            });
-
-            if (!overlaps) {
-                res.push_back(bbox);
-                if (res.size() == top_n) break;
-            }
-        }
-    }
-
-    return res;
-}
-
-inline void sort_and_keep_at_most_top_n(
-        std::vector<simpler_nms_proposal_t>& proposals,
-        size_t top_n) {
-    const auto cmp_fn = [](const simpler_nms_proposal_t& a,
-                           const simpler_nms_proposal_t& b) {
-        return a.confidence > b.confidence || (a.confidence == b.confidence && a.ord > b.ord);
-    };
-
-    if (proposals.size() > top_n) {
-        std::partial_sort(proposals.begin(), proposals.begin() + top_n, proposals.end(), cmp_fn);
-        proposals.resize(top_n);
-    } else {
-        std::sort(proposals.begin(), proposals.end(), cmp_fn);
-    }
-}
-
-inline simpler_nms_roi_t simpler_nms_gen_bbox(
-        const simpler_nms_anchor& box,
-        const simpler_nms_delta_t& delta,
-        int anchor_shift_x,
-        int anchor_shift_y) {
-    auto anchor_w = box.end_x - box.start_x + 1;
-    auto anchor_h = box.end_y - box.start_y + 1;
-    auto center_x = box.start_x + anchor_w * .5f;
-    auto center_y = box.start_y + anchor_h *.5f;
-
-    float pred_center_x = delta.shift_x * anchor_w + center_x + anchor_shift_x;
-    float pred_center_y = delta.shift_y * anchor_h + center_y + anchor_shift_y;
-    float half_pred_w = exp(delta.log_w) * anchor_w * .5f;
-    float half_pred_h = exp(delta.log_h) * anchor_h * .5f;
-
-    return { pred_center_x - half_pred_w,
-             pred_center_y - half_pred_h,
-             pred_center_x + half_pred_w,
-             pred_center_y + half_pred_h };
-}
-
 class SimplerNMSImpl : public ExtLayerBase {
 public:
     explicit SimplerNMSImpl(const CNNLayer *layer) {
@@ -267,7 +174,10 @@ public:
 
         int scaled_min_bbox_size = min_box_size_ * IS;
 
-        std::vector<simpler_nms_proposal_t> sorted_proposals_confidence;
+        std::vector<BoxOps::Box> boxes;
+        std::vector<float> scores;
+        boxes.reserve(static_cast<size_t>(H) * W * anchors_num);
+        scores.reserve(static_cast<size_t>(H) * W * anchors_num);
 
         for (auto y = 0; y < H; ++y) {
             int anchor_shift_y = y * feat_stride_;
@@ -283,36 +193,58 @@ public:
                     float dx1 = delta_pred[location_index + SZ * (anchor_index * 4 + 2)];
                     float dy1 = delta_pred[location_index + SZ * (anchor_index * 4 + 3)];
 
-                    simpler_nms_delta_t bbox_delta { dx0, dy0, dx1, dy1 };
-
                     float proposal_confidence =
                             cls_scores[location_index + SZ * (anchor_index + anchors_num * 1)];
 
-                    simpler_nms_roi_t tmp_roi = simpler_nms_gen_bbox(anchors[anchor_index], bbox_delta, anchor_shift_x, anchor_shift_y);
-                    simpler_nms_roi_t roi = tmp_roi.clamp({ 0, 0, static_cast<float>(IW - 1), static_cast<float>(IH - 1)});
+                    const simpler_nms_anchor& anchor = anchors[anchor_index];
+                    BoxOps::Box shifted = {anchor.start_x + anchor_shift_x, anchor.start_y + anchor_shift_y,
+                                           anchor.end_x + anchor_shift_x, anchor.end_y + anchor_shift_y};
+                    BoxOps::Box roi = BoxOps::clip(BoxOps::decode(shifted, dx0, dy0, dx1, dy1, 1.0f),
+                                                   static_cast<float>(IW - 1), static_cast<float>(IH - 1));
 
                     int bbox_w = roi.x1 - roi.x0 + 1;
                     int bbox_h = roi.y1 - roi.y0 + 1;
 
                     if (bbox_w >= scaled_min_bbox_size && bbox_h >= scaled_min_bbox_size) {
-                        simpler_nms_proposal_t proposal { roi, proposal_confidence, sorted_proposals_confidence.size() };
-                        sorted_proposals_confidence.push_back(proposal);
+                        boxes.push_back(roi);
+                        scores.push_back(proposal_confidence);
                     }
                 }
             }
         }
 
-        sort_and_keep_at_most_top_n(sorted_proposals_confidence, pre_nms_topn_);
-        auto res = simpler_nms_perform_nms(sorted_proposals_confidence, iou_threshold_, post_nms_topn_);
-
-        size_t res_num_rois = res.size();
-
-        for (size_t i = 0; i < res_num_rois; ++i) {
+        const int num_proposals = static_cast<int>(boxes.size());
+        int pre_nms_topn = std::min(num_proposals, pre_nms_topn_);
+
+        std::vector<uint32_t> score_keys;
+        std::vector<int> order(pre_nms_topn);
+        BoxOps::select_topn(scores.data(), 1, num_proposals, pre_nms_topn, score_keys, order.data());
+
+        // For any realistic WL, all the top scores are positive anyway
+        while (pre_nms_topn > 0 && !(scores[order[pre_nms_topn - 1]] > 0))
+            pre_nms_topn--;
+
+        std::vector<float> unpacked_boxes(4 * pre_nms_topn);
+        parallel_for(pre_nms_topn, [&](int i) {
+            const BoxOps::Box& box = boxes[order[i]];
+            unpacked_boxes[0*pre_nms_topn + i] = box.x0;
+            unpacked_boxes[1*pre_nms_topn + i] = box.y0;
+            unpacked_boxes[2*pre_nms_topn + i] = box.x1;
+            unpacked_boxes[3*pre_nms_topn + i] = box.y1;
+        });
+
+        std::vector<int> is_dead(pre_nms_topn);
+        std::vector<int> roi_indices(pre_nms_topn);
+        int res_num_rois = BoxOps::nms(unpacked_boxes.data(), pre_nms_topn, is_dead.data(), roi_indices.data(), 0,
+                                       iou_threshold_, post_nms_topn_, 1.0f);
+
+        for (int i = 0; i < res_num_rois; ++i) {
+            int index = roi_indices[i];
             dst[5 * i + 0] = 0;    // roi_batch_ind, always zero on test time
-            dst[5 * i + 1] = res[i].x0;
-            dst[5 * i + 2] = res[i].y0;
-            dst[5 * i + 3] = res[i].x1;
-            dst[5 * i + 4] = res[i].y1;
+            dst[5 * i + 1] = unpacked_boxes[0*pre_nms_topn + index];
+            dst[5 * i + 2] = unpacked_boxes[1*pre_nms_topn + index];
+            dst[5 * i + 3] = unpacked_boxes[2*pre_nms_topn + index];
+            dst[5 * i + 4] = unpacked_boxes[3*pre_nms_topn + index];
         }
         return OK;
     }
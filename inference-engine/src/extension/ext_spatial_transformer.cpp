@@ -6,7 +6,7 @@
 #include "ext_list.hpp"
 #include "ext_base.hpp"
 
-#include "matrixmult.h"
+#include "grid_sampler.h"
 
 #include <algorithm>
 #include <vector>
@@ -16,6 +16,10 @@ namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+/**
+ * SpatialTransformer of the license plate and the text recognition networks: the affine transform [N, 6] maps
+ * the normalized grid of the output to the input of the same shape, which is sampled bilinearly (see GridSampler).
+ */
 class SpatialTransformerImpl: public ExtLayerBase {
 public:
     explicit SpatialTransformerImpl(const CNNLayer* layer) {
@@ -32,102 +36,58 @@ public:
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
                        ResponseDesc *resp) noexcept override {
         std::vector<size_t> real_dims = inputs[0]->getTensorDesc().getDims();
-        size_t data_size = inputs[0]->size();
 
         const auto *src_data = inputs[0]->cbuffer().as<const float *>();
-        auto *theta = inputs[1]->buffer().as<float *>();
+        const auto *theta = inputs[1]->cbuffer().as<const float *>();
         auto *dst_data = outputs[0]->buffer().as<float *>();
 
-        auto N = real_dims[0];
-        auto C = real_dims[1];
-        auto output_H_ = real_dims[2];
-        auto output_W_ = real_dims[3];
-
-        // Prepare input and output grid
-        std::vector<float> input_grid_data(N * output_H_ * output_W_ * 2);
-        std::vector<float> output_grid_data(3 * output_H_ * output_W_);
-        for (int i = 0; i < output_H_ * output_W_; ++i) {
-            output_grid_data[3 * i] = (i / output_W_) * 1.0 / output_H_ * 2 - 1;
-            output_grid_data[3 * i + 1] = (i % output_W_) * 1.0 / output_W_ * 2 - 1;
-            output_grid_data[3 * i + 2] = 1;
-        }
-
-        // Actually execute
-        for (int i = 0; i < N; ++i) {
-            auto coordinates = input_grid_data.begin() + (output_H_ * output_W_ * 2) * i;
-
-            auto M_size = output_H_ * output_W_;
-            auto N_size = 2;
-            auto K_size = 3;
-
-            matrixMult(&output_grid_data[0], theta + 6 * i, &(*coordinates), M_size, N_size, K_size, true);
-
-            int row_idx;
-            float px, py;
-
-            for (int j = 0; j < C; ++j) {
-                for (int s = 0; s < output_H_; ++s) {
-                    for (int t = 0; t < output_W_; ++t) {
-                        row_idx = output_W_ * s + t;
-
-                        px = coordinates[row_idx * 2];
-                        py = coordinates[row_idx * 2 + 1];
-
-                        size_t dst_offset = ((i * C + j) * output_H_ + s) * output_W_ + t;
-                        size_t src_offset = ((i * C + j) * output_H_ + 0) * output_W_ + 0;
-                        dst_data[dst_offset] = transform_forward_cpu(src_data + src_offset, px, py);
-                    }
+        const size_t N = real_dims[0];
+        const size_t C = real_dims[1];
+        const int H = static_cast<int>(real_dims[2]);
+        const int W = static_cast<int>(real_dims[3]);
+        const size_t points = static_cast<size_t>(H) * W;
+
+        // the grid of a sample is shared by its channels, the samples of a large batch (e.g. the text lines of
+        // an image) are transformed in parallel, the channels and the rows of a small batch are split
+        std::vector<GridSampler> samplers(parallel_get_max_threads());
+        if (N >= samplers.size()) {
+            parallel_for(N, [&](size_t n) {
+                GridSampler &sampler = samplers[parallel_get_thread_num()];
+                prepare(sampler, theta + 6 * n, H, W);
+                for (size_t c = 0; c < C; c++) {
+                    const size_t plane = (n * C + c) * points;
+                    sampler.sample(src_data + plane, dst_data + plane, 0, static_cast<int>(points));
                 }
+            });
+        } else {
+            for (size_t n = 0; n < N; n++) {
+                GridSampler &sampler = samplers[0];
+                prepare(sampler, theta + 6 * n, H, W);
+                parallel_nd(C, static_cast<size_t>(H), [&](size_t c, size_t s) {
+                    const size_t plane = (n * C + c) * points;
+                    sampler.sample(src_data + plane, dst_data + plane, static_cast<int>(s) * W,
+                                   static_cast<int>(s + 1) * W);
+                });
             }
         }
         return OK;
     }
 
 private:
-    float transform_forward_cpu(const float *pic, float px, float py) {
-        int H = 24;
-        int W = 94;
-
-        float res = 0.0f;
-        float x = (px + 1) / 2 * H;
-        float y = (py + 1) / 2 * W;
-
-        int m, n;
-        float w;
-
-        m = std::floor(x);
-        n = std::floor(y);
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
-        }
-
-        m = std::floor(x) + 1;
-        n = std::floor(y);
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
-        }
-
-        m = std::floor(x);
-        n = std::floor(y) + 1;
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
-        }
-
-        m = std::floor(x) + 1;
-        n = std::floor(y) + 1;
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
+    // the affine transform theta of the normalized output grid gives the coordinates of the points in the input,
+    // the first one goes along the rows
+    static void prepare(GridSampler &sampler, const float *theta, int H, int W) {
+        std::vector<float> rows(static_cast<size_t>(H) * W);
+        std::vector<float> cols(rows.size());
+        for (int s = 0; s < H; s++) {
+            const float gy = static_cast<float>(s) / H * 2 - 1;
+            for (int t = 0; t < W; t++) {
+                const float gx = static_cast<float>(t) / W * 2 - 1;
+                rows[s * W + t] = (theta[0] * gy + theta[1] * gx + theta[2] + 1) / 2 * H;
+                cols[s * W + t] = (theta[3] * gy + theta[4] * gx + theta[5] + 1) / 2 * W;
+            }
         }
-
-        return res;
+        sampler.prepare(rows.data(), cols.data(), H * W, H, W);
     }
 };
 
@@ -8,6 +8,7 @@
 #include "details/ie_cnn_network_iterator.hpp"
 #include "ie_layers.h"
 #include "ie_util_internal.hpp"
+#include "ie_graph_splitter.hpp"
 #include <fstream>
 #include <vector>
 #include <memory>
@@ -64,7 +65,8 @@ void FallbackPolicy::init(const std::string &config, const std::map<std::string,
     }
 }
 
-void FallbackPolicy::setAffinity(const std::map<std::string, std::string>& config, ICNNNetwork& network) {
+std::map<std::string, QueryNetworkResult> FallbackPolicy::queryNetwork(const std::map<std::string, std::string>& config,
+                                                                       ICNNNetwork& network) {
     std::map<std::string, QueryNetworkResult> queryResults;
     // go oger devices, create appropriate plugins and
     for (const auto &i : _fallbackDevices) {
@@ -72,6 +74,11 @@ void FallbackPolicy::setAffinity(const std::map<std::string, std::string>& confi
         _deviceLoaders[i]->QueryNetwork(i, network, config, r);
         queryResults[i] = r;
     }
+    return queryResults;
+}
+
+void FallbackPolicy::setAffinity(const std::map<std::string, std::string>& config, ICNNNetwork& network) {
+    auto queryResults = queryNetwork(config, network);
 
     details::CNNNetworkIterator i(const_cast<ICNNNetwork *>(&network));
     while (i != details::CNNNetworkIterator()) {
@@ -86,6 +93,12 @@ void FallbackPolicy::setAffinity(const std::map<std::string, std::string>& confi
         i++;
     }
 
+    // the cheap layers falling back between the layers of another device follow them
+    reduceBoundaries(network, [&](const CNNLayerPtr &layer, const std::string &device) {
+        auto &supported = queryResults[device].supportedLayers;
+        return supported.find(layer->name) != supported.end();
+    });
+
     if (_dumpDotFile) {
         std::ofstream file("hetero_affinity.dot");
         saveGraphToDot(network, file, dla_layer_colorer);
@@ -22,6 +22,16 @@ public:
 
     void setAffinity(const std::map<std::string, std::string>& config, ICNNNetwork& pNetwork);
 
+    /**
+     * @brief Returns the layers supported by every device of the fallback list
+     */
+    std::map<std::string, QueryNetworkResult> queryNetwork(const std::map<std::string, std::string>& config,
+                                                           ICNNNetwork& network);
+
+    const std::vector<std::string> &getDevices() const {
+        return _fallbackDevices;
+    }
+
 private:
     InferenceEngine::MapDeviceLoaders &_deviceLoaders;
     std::vector<std::string> _fallbackDevices;
@@ -0,0 +1,53 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_allocator.h"
+#include <cstdlib>
+#include <string>
+#include <blob_factory.hpp>
+#include <details/ie_irelease.hpp>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace HeteroPlugin {
+
+using namespace InferenceEngine;
+
+void *HeteroPageAlignedAllocator::alloc(size_t size) noexcept {
+    // the size is rounded up, so the last page is not shared with the other allocations
+    size = (size + pageSize - 1) / pageSize * pageSize;
+#ifdef _WIN32
+    return _aligned_malloc(size, pageSize);
+#else
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, pageSize, size) != 0)
+        return nullptr;
+    return ptr;
+#endif
+}
+
+bool HeteroPageAlignedAllocator::free(void *handle) noexcept {
+#ifdef _WIN32
+    _aligned_free(handle);
+#else
+    std::free(handle);
+#endif
+    return true;
+}
+
+bool isHostDevice(const std::string &device) {
+    return device == "CPU";
+}
+
+Blob::Ptr makeBoundaryBlob(const TensorDesc &desc) {
+    static std::shared_ptr<IAllocator> allocator = details::shared_from_irelease(new HeteroPageAlignedAllocator());
+    auto blob = make_blob_with_precision(desc, allocator);
+    blob->allocate();
+    return blob;
+}
+
+}  // namespace HeteroPlugin
@@ -0,0 +1,50 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <ie_allocator.hpp>
+#include <ie_blob.h>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Allocator of the page aligned buffers of the intermediate blobs passed from the CPU to the other devices.
+ * The CPU plugin writes its outputs in place into the blobs of the matching layout and the integrated GPU reads
+ * the page aligned host memory without a copy, so such a blob is not copied at the boundary of the subgraphs.
+ */
+class HeteroPageAlignedAllocator : public InferenceEngine::IAllocator {
+public:
+    static constexpr size_t pageSize = 4096;
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void *lock(void *handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void *handle) noexcept override {}
+
+    void *alloc(size_t size) noexcept override;
+
+    bool free(void *handle) noexcept override;
+};
+
+/**
+ * @brief Checks that the device of a subgraph works with the host memory, so it owns no buffers worth sharing
+ */
+bool isHostDevice(const std::string &device);
+
+/**
+ * @brief Allocates the page aligned blob of the given description
+ */
+InferenceEngine::Blob::Ptr makeBoundaryBlob(const InferenceEngine::TensorDesc &desc);
+
+}  // namespace HeteroPlugin
@@ -29,8 +29,7 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(HeteroInferRequest::Ptr request
 
 void HeteroAsyncInferRequest::StartAsync() {
     IE_PROFILING_AUTO_SCOPE(Hetero_Async)
-    if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
-    setIsRequestBusy(true);
+    if (!occupyRequest()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
     _heteroInferRequest->updateInOutIfNeeded();
     _heteroInferRequest->startFirstAsyncRequest();
 }
@@ -0,0 +1,328 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_auto_affinity.h"
+#include "hetero_executable_network.h"
+#include "details/ie_cnn_network_iterator.hpp"
+#include "ie_layers.h"
+#include "ie_util_internal.hpp"
+#include "ie_plugin_config.hpp"
+#include "hetero/hetero_plugin_config.hpp"
+#include <caseless.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace HeteroPlugin;
+using namespace InferenceEngine::PluginConfigParams;
+using namespace InferenceEngine::HeteroConfigParams;
+
+namespace {
+
+// the first inference warms the devices up, the minimum of the next ones is taken
+const int profilingIterations = 4;
+
+// the estimated cost of passing a blob to another device: the latency of the start of the next sub-request
+// and the copy of the blob over the memory bus
+const double transferLatencyUs = 20.0;
+const double transferBytesPerUs = 4000.0;
+
+const double unsupported = std::numeric_limits<double>::infinity();
+
+struct Transfer {
+    size_t producer;
+    std::vector<size_t> consumers;
+    double cost;
+};
+
+/**
+ * @brief Placement of the layers minimizing the sum of the layer times and of the transfers between the devices,
+ * every layer is moved to another device while it decreases the total time
+ */
+class Placement {
+public:
+    Placement(const std::vector<std::vector<double>> &times, const std::vector<Transfer> &transfers) :
+        _times(times), _transfers(transfers) {}
+
+    std::vector<size_t> find(size_t devices) const {
+        std::vector<size_t> best;
+        double bestCost = unsupported;
+        // the search starts from every device running all its layers and from the fastest device of every layer
+        for (size_t start = 0; start <= devices; start++) {
+            std::vector<size_t> assignment(_times.size());
+            for (size_t l = 0; l < _times.size(); l++) {
+                assignment[l] = start < devices && _times[l][start] != unsupported ? start : fastest(l);
+            }
+            double cost = improve(assignment);
+            if (cost < bestCost) {
+                bestCost = cost;
+                best = assignment;
+            }
+        }
+        return best;
+    }
+
+private:
+    size_t fastest(size_t layer) const {
+        auto &times = _times[layer];
+        return static_cast<size_t>(std::min_element(times.begin(), times.end()) - times.begin());
+    }
+
+    double cost(const std::vector<size_t> &assignment) const {
+        double total = 0;
+        for (size_t l = 0; l < assignment.size(); l++) {
+            total += _times[l][assignment[l]];
+        }
+        std::set<size_t> targets;
+        for (auto &&transfer : _transfers) {
+            targets.clear();
+            for (auto consumer : transfer.consumers) {
+                if (assignment[consumer] != assignment[transfer.producer]) {
+                    targets.insert(assignment[consumer]);
+                }
+            }
+            total += targets.size() * transfer.cost;
+        }
+        return total;
+    }
+
+    double improve(std::vector<size_t> &assignment) const {
+        double current = cost(assignment);
+        bool improved = true;
+        while (improved) {
+            improved = false;
+            for (size_t l = 0; l < assignment.size(); l++) {
+                for (size_t d = 0; d < _times[l].size(); d++) {
+                    if (d == assignment[l] || _times[l][d] == unsupported) {
+                        continue;
+                    }
+                    size_t previous = assignment[l];
+                    assignment[l] = d;
+                    double moved = cost(assignment);
+                    if (moved < current) {
+                        current = moved;
+                        improved = true;
+                    } else {
+                        assignment[l] = previous;
+                    }
+                }
+            }
+        }
+        return current;
+    }
+
+    const std::vector<std::vector<double>> &_times;
+    const std::vector<Transfer> &_transfers;
+};
+
+bool isSupported(const std::map<std::string, QueryNetworkResult> &queryResults, const std::string &device,
+                 const std::string &layer) {
+    auto result = queryResults.find(device);
+    return result != queryResults.end() &&
+           result->second.supportedLayers.find(layer) != result->second.supportedLayers.end();
+}
+
+std::vector<CNNLayerPtr> getPlacedLayers(ICNNNetwork &network) {
+    std::vector<CNNLayerPtr> layers;
+    details::CNNNetworkIterator i(&network);
+    while (i != details::CNNNetworkIterator()) {
+        CNNLayer::Ptr layer = *i;
+        if (!CaselessEq<std::string>()(layer->type, "input")) {
+            layers.push_back(layer);
+        }
+        i++;
+    }
+    return layers;
+}
+
+}  // namespace
+
+HeteroAutoAffinity::HeteroAutoAffinity(FallbackPolicy &fallbackPolicy, MapDeviceLoaders &deviceLoaders) :
+    _fallbackPolicy(fallbackPolicy), _deviceLoaders(deviceLoaders) {
+}
+
+void HeteroAutoAffinity::setAffinity(const std::map<std::string, std::string> &config, ICNNNetwork &network,
+                                     const std::vector<IExtensionPtr> &extensions) {
+    // the layers not found in the affinity file and the layers supported by one device keep the default affinity
+    _fallbackPolicy.setAffinity(config, network);
+    auto queryResults = _fallbackPolicy.queryNetwork(config, network);
+
+    auto itFile = config.find(KEY_HETERO_AFFINITY_FILE);
+    std::string fileName = itFile != config.end() ? itFile->second : "";
+    if (!fileName.empty() && loadAffinities(fileName, network, queryResults)) {
+        return;
+    }
+
+    const auto &devices = _fallbackPolicy.getDevices();
+    std::vector<CNNLayerPtr> layers;
+    std::map<std::string, size_t> indices;
+    std::vector<std::vector<double>> times;
+    for (auto &&layer : getPlacedLayers(network)) {
+        std::vector<double> layerTimes;
+        bool supported = false;
+        for (auto &&device : devices) {
+            bool isLayerSupported = isSupported(queryResults, device, layer->name);
+            layerTimes.push_back(isLayerSupported ? 0. : unsupported);
+            supported = supported || isLayerSupported;
+        }
+        if (supported) {
+            indices[layer->name] = layers.size();
+            layers.push_back(layer);
+            times.push_back(layerTimes);
+        }
+    }
+
+    for (size_t d = 0; d < devices.size(); d++) {
+        bool used = false;
+        for (auto &&layerTimes : times) {
+            used = used || layerTimes[d] != unsupported;
+        }
+        if (!used) {
+            continue;
+        }
+        for (auto &&measured : profile(devices[d], config, network, queryResults, extensions)) {
+            auto index = indices.find(measured.first);
+            if (index != indices.end() && times[index->second][d] != unsupported) {
+                times[index->second][d] = measured.second;
+            }
+        }
+    }
+
+    std::vector<Transfer> transfers;
+    for (size_t l = 0; l < layers.size(); l++) {
+        for (auto &&data : layers[l]->outData) {
+            Transfer transfer;
+            transfer.producer = l;
+            for (auto &&consumer : data->getInputTo()) {
+                auto index = indices.find(consumer.second->name);
+                if (index != indices.end()) {
+                    transfer.consumers.push_back(index->second);
+                }
+            }
+            if (transfer.consumers.empty()) {
+                continue;
+            }
+            size_t bytes = data->getPrecision().size();
+            for (auto dim : data->getTensorDesc().getDims()) {
+                bytes *= dim;
+            }
+            transfer.cost = transferLatencyUs + bytes / transferBytesPerUs;
+            transfers.push_back(transfer);
+        }
+    }
+
+    auto assignment = Placement(times, transfers).find(devices.size());
+    for (size_t l = 0; l < layers.size(); l++) {
+        layers[l]->affinity = devices[assignment[l]];
+    }
+
+    if (!fileName.empty()) {
+        saveAffinities(fileName, network);
+    }
+}
+
+std::map<std::string, double> HeteroAutoAffinity::profile(const std::string &device,
+                                                          const std::map<std::string, std::string> &config,
+                                                          ICNNNetwork &network, const QueryResults &queryResults,
+                                                          const std::vector<IExtensionPtr> &extensions) {
+    auto clonedNetwork = cloneNet(network);
+    std::set<std::string> deviceLayers;
+    for (auto &&layer : getPlacedLayers(*clonedNetwork)) {
+        if (isSupported(queryResults, device, layer->name)) {
+            layer->affinity = device;
+            deviceLayers.insert(layer->name);
+        }
+    }
+
+    auto profilingConfig = config;
+    profilingConfig.erase(KEY_HETERO_AUTO_AFFINITY);
+    profilingConfig.erase(KEY_HETERO_AFFINITY_FILE);
+    profilingConfig.erase(KEY_HETERO_PIPELINE_DEPTH);
+    profilingConfig.erase(KEY_HETERO_DUMP_GRAPH_DOT);
+    profilingConfig[KEY_PERF_COUNT] = YES;
+
+    auto executableNetwork = std::make_shared<HeteroExecutableNetwork>(*clonedNetwork, profilingConfig, extensions,
+                                                                       _deviceLoaders);
+    InputsDataMap inputs;
+    clonedNetwork->getInputsInfo(inputs);
+    OutputsDataMap outputs;
+    clonedNetwork->getOutputsInfo(outputs);
+    auto request = executableNetwork->CreateInferRequestImpl(inputs, outputs);
+    for (auto &&input : inputs) {
+        Blob::Ptr blob;
+        request->GetBlob(input.first.c_str(), blob);
+        std::memset(blob->buffer().as<uint8_t *>(), 0, blob->byteSize());
+    }
+
+    std::map<std::string, double> times;
+    for (int i = 0; i < profilingIterations; i++) {
+        request->Infer();
+        if (i == 0) {
+            continue;
+        }
+        std::map<std::string, InferenceEngineProfileInfo> perfMap;
+        request->GetPerformanceCounts(perfMap);
+        for (auto &&counter : perfMap) {
+            // the counters of the hetero request are named "subgraph<N>: <layer>"
+            auto separator = counter.first.find(": ");
+            std::string name = separator != std::string::npos ? counter.first.substr(separator + 2) : counter.first;
+            if (deviceLayers.find(name) == deviceLayers.end()) {
+                continue;
+            }
+            double time = static_cast<double>(std::max(counter.second.realTime_uSec, 0ll));
+            auto measured = times.find(name);
+            if (measured == times.end()) {
+                times[name] = time;
+            } else {
+                measured->second = std::min(measured->second, time);
+            }
+        }
+    }
+    return times;
+}
+
+bool HeteroAutoAffinity::loadAffinities(const std::string &fileName, ICNNNetwork &network,
+                                        const QueryResults &queryResults) const {
+    std::ifstream file(fileName);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::map<std::string, std::string> affinities;
+    std::string line;
+    while (std::getline(file, line)) {
+        auto separator = line.rfind('\t');
+        if (separator != std::string::npos) {
+            affinities[line.substr(0, separator)] = line.substr(separator + 1);
+        }
+    }
+
+    // the entries of the devices which do not support the layer anymore are skipped
+    for (auto &&layer : getPlacedLayers(network)) {
+        auto affinity = affinities.find(layer->name);
+        if (affinity != affinities.end() && isSupported(queryResults, affinity->second, layer->name)) {
+            layer->affinity = affinity->second;
+        }
+    }
+    return true;
+}
+
+void HeteroAutoAffinity::saveAffinities(const std::string &fileName, ICNNNetwork &network) const {
+    std::ofstream file(fileName);
+    if (!file.is_open()) {
+        THROW_IE_EXCEPTION << "Cannot write the affinity file " << fileName;
+    }
+    for (auto &&layer : getPlacedLayers(network)) {
+        if (!layer->affinity.empty()) {
+            file << layer->name << '\t' << layer->affinity << '\n';
+        }
+    }
+}
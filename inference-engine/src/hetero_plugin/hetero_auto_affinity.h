@@ -0,0 +1,51 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <ie_icnn_network.hpp>
+#include <ie_ihetero_plugin.hpp>
+
+#include "fallback_policy.h"
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Assigns the layers to the devices of the fallback list by their execution time (see
+ * HeteroConfigParams::KEY_HETERO_AUTO_AFFINITY). The network is executed once per device with all the layers
+ * supported by the device assigned to it and the time of every layer is taken from the performance counters.
+ * The layers are then placed to minimize the sum of their times and of the estimated cost of passing the blobs
+ * between the devices. The affinities can be cached in a file (see HeteroConfigParams::KEY_HETERO_AFFINITY_FILE).
+ */
+class HeteroAutoAffinity {
+public:
+    HeteroAutoAffinity(InferenceEngine::FallbackPolicy &fallbackPolicy, InferenceEngine::MapDeviceLoaders &deviceLoaders);
+
+    void setAffinity(const std::map<std::string, std::string> &config, InferenceEngine::ICNNNetwork &network,
+                     const std::vector<InferenceEngine::IExtensionPtr> &extensions);
+
+private:
+    typedef std::map<std::string, InferenceEngine::QueryNetworkResult> QueryResults;
+
+    /**
+     * @brief Returns the minimal time in microseconds of the layers executed on the device
+     */
+    std::map<std::string, double> profile(const std::string &device, const std::map<std::string, std::string> &config,
+                                          InferenceEngine::ICNNNetwork &network, const QueryResults &queryResults,
+                                          const std::vector<InferenceEngine::IExtensionPtr> &extensions);
+
+    bool loadAffinities(const std::string &fileName, InferenceEngine::ICNNNetwork &network,
+                        const QueryResults &queryResults) const;
+
+    void saveAffinities(const std::string &fileName, InferenceEngine::ICNNNetwork &network) const;
+
+    InferenceEngine::FallbackPolicy &_fallbackPolicy;
+    InferenceEngine::MapDeviceLoaders &_deviceLoaders;
+};
+
+}  // namespace HeteroPlugin
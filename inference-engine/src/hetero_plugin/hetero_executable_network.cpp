@@ -13,11 +13,13 @@
 #include <utility>
 #include <unordered_map>
 #include <fstream>
+#include <sstream>
 #include <algorithm>
 
 #include <ie_plugin_dispatcher.hpp>
 #include <ie_graph_splitter.hpp>
 #include "fallback_policy.h"
+#include "hetero_auto_affinity.h"
 #include <caseless.hpp>
 #include "ie_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
@@ -108,12 +110,42 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
     auto itDumpDotFile = config.find(KEY_HETERO_DUMP_GRAPH_DOT);
     bool dumpDotFile = itDumpDotFile != config.end() ? itDumpDotFile->second == YES : false;
 
+    auto itPipelineDepth = config.find(KEY_HETERO_PIPELINE_DEPTH);
+    if (itPipelineDepth != config.end()) {
+        std::stringstream ss(itPipelineDepth->second);
+        int depth = 0;
+        ss >> depth;
+        if (ss.fail() || depth < 0) {
+            THROW_IE_EXCEPTION << "Wrong value " << itPipelineDepth->second << " of the " << KEY_HETERO_PIPELINE_DEPTH
+                               << " option for heterogeneous plugin";
+        }
+        _pipelineDepth = static_cast<size_t>(depth);
+    }
+
+    auto itCallbackThreads = config.find(PluginConfigParams::KEY_CALLBACK_THREADS);
+    if (itCallbackThreads != config.end()) {
+        std::stringstream ss(itCallbackThreads->second);
+        int threads = 0;
+        ss >> threads;
+        if (ss.fail() || threads < 0) {
+            THROW_IE_EXCEPTION << "Wrong value " << itCallbackThreads->second << " of the "
+                               << PluginConfigParams::KEY_CALLBACK_THREADS << " option for heterogeneous plugin";
+        }
+        setCallbackThreads(threads);
+    }
+
     if (allEmpty) {
         FallbackPolicy fbPolicy(_deviceLoaders, dumpDotFile);
         auto it = config.find("TARGET_FALLBACK");
         if (it != config.end()) {
             fbPolicy.init(it->second, config, extensions);
-            fbPolicy.setAffinity(config, network);
+            auto itAutoAffinity = config.find(KEY_HETERO_AUTO_AFFINITY);
+            if (itAutoAffinity != config.end() && itAutoAffinity->second == YES) {
+                HeteroAutoAffinity autoAffinity(fbPolicy, _deviceLoaders);
+                autoAffinity.setAffinity(config, network, extensions);
+            } else {
+                fbPolicy.setAffinity(config, network);
+            }
         } else {
             THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
         }
@@ -188,6 +220,8 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
         }
     }
 
+    // the FP16 blobs of the CPU subgraphs converted to FP32
+    std::unordered_map<Blob::Ptr, Blob::Ptr> convertedBlobs;
     for (auto &&subgraph : subgraphs) {
         auto affinity = (*subgraph.begin())->affinity;
         tempLayers.assign(subgraph.begin(), subgraph.end());
@@ -254,12 +288,18 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
                     }
                 }
 
-                auto convertBlobFP16toFP32 = [](Blob::Ptr blob) -> Blob::Ptr {
+                // the cloned layers share the weights with the original network, and _weights and _biases are
+                // the "weights" and "biases" blobs of the layer, so every blob is converted once and stays shared
+                auto convertBlobFP16toFP32 = [&convertedBlobs](Blob::Ptr blob) -> Blob::Ptr {
+                    auto converted = convertedBlobs.find(blob);
+                    if (converted != convertedBlobs.end())
+                        return converted->second;
                     Blob::Ptr weightsBlob = make_shared_blob<float>(Precision::FP32, blob->layout(), blob->dims());
                     weightsBlob->allocate();
                     float* target = weightsBlob->buffer().as<float*>();
                     short* source = blob->buffer().as<short *>();
                     PrecisionUtils::f16tof32Arrays(target, source, blob->size(), 1.0f, 0.0f);
+                    convertedBlobs[blob] = weightsBlob;
                     return weightsBlob;
                 };
                 // convert blobs
@@ -321,17 +361,22 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
         d._clonedNetwork = nullptr;
     }
 
+    // the subnetworks are loaded and their clones sharing the weights with the network are dropped
+    auto itReleaseWeights = config.find(KEY_RELEASE_WEIGHTS);
+    if (itReleaseWeights != config.end() && itReleaseWeights->second == YES) {
+        releaseWeights(network_);
+    }
+
 
     networks = std::move(descs);
 }
 
-InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
-        InputsDataMap networkInputs,
-        OutputsDataMap networkOutputs) {
+HeteroInferRequest::SubRequestsList HeteroExecutableNetwork::getSubRequests() const {
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto i : networks) {
         HeteroInferRequest::SubRequestDesc desc;
+        desc._device = i._device;
         desc._network = i.network;
         desc._iNames = i._iNames;
         desc._oNames = i._oNames;
@@ -339,9 +384,23 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
 
         inferRequests.push_back(desc);
     }
+    return inferRequests;
+}
+
+InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
+        InputsDataMap networkInputs,
+        OutputsDataMap networkOutputs) {
+    if (_pipelineDepth > 0) {
+        std::lock_guard<std::mutex> lock(_pipelineMutex);
+        if (!_pipeline) {
+            _pipeline = std::make_shared<HeteroPipeline>(getSubRequests(), _pipelineDepth);
+        }
+        return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, _pipeline);
+    }
+
     return std::make_shared<HeteroInferRequest>(networkInputs,
                                                 networkOutputs,
-                                                inferRequests);
+                                                getSubRequests());
 }
 
 void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
@@ -354,3 +413,52 @@ void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncReques
                        [](IInferRequest *p) { p->Release(); });
     asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
 }
+
+void HeteroExecutableNetwork::GetMemoryFootprint(MemoryFootprint &footprint) {
+    footprint = MemoryFootprint();
+    for (auto &desc : networks) {
+        auto subFootprint = desc.network->GetMemoryFootprint();
+        footprint.weights += subFootprint.weights;
+        footprint.workspace += subFootprint.workspace;
+        footprint.perRequest += subFootprint.perRequest;
+        footprint.peak += subFootprint.peak;
+    }
+    footprint.io = GetIOBytes();
+}
+
+void HeteroExecutableNetwork::TrimImpl(bool releaseWeights) {
+    // the subrequests are registered by the subnetworks, so every subnetwork rejects the trimming while they infer
+    for (auto &desc : networks) {
+        try {
+            if (releaseWeights) {
+                desc.network->Hibernate();
+            } else {
+                desc.network->Trim();
+            }
+        } catch (const RequestBusy &ex) {
+            THROW_IE_EXCEPTION << details::as_status << REQUEST_BUSY << ex.what();
+        } catch (const NotImplemented &) {
+            // the subnetwork keeps its memory
+        }
+    }
+}
+
+void HeteroExecutableNetwork::GetMetrics(ExecutableNetworkMetrics &metrics) {
+    // the request counts and the latencies are the ones of the hetero requests, the subrequests are measured by
+    // their own networks
+    ExecutableNetworkThreadSafeDefault::GetMetrics(metrics);
+    metrics.optimalInferRequests = 0;
+    metrics.queueDepth = 0;
+    metrics.averageExecutionTime = 0;
+    for (auto &desc : networks) {
+        auto subMetrics = desc.network->GetMetrics();
+        metrics.optimalInferRequests = _pipelineDepth > 0
+                                       ? metrics.optimalInferRequests + subMetrics.optimalInferRequests
+                                       : std::max(metrics.optimalInferRequests, subMetrics.optimalInferRequests);
+        metrics.streams = std::max(metrics.streams, subMetrics.streams);
+        // every hetero request in flight runs one of its subrequests
+        metrics.queueDepth += subMetrics.queueDepth;
+        metrics.averageExecutionTime += subMetrics.averageExecutionTime;
+    }
+    metrics.optimalInferRequests = std::max(metrics.optimalInferRequests, 1u);
+}
@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -23,6 +24,7 @@
 #include "hetero_infer_request.h"
 #include "cnn_network_impl.hpp"
 #include "hetero_async_infer_request.h"
+#include "hetero_pipeline.h"
 
 namespace HeteroPlugin {
 
@@ -60,7 +62,26 @@ public:
 
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
 
+    /**
+     * @brief Returns the sum of the memory of the subnetworks, a hetero request creates one request per subnetwork
+     */
+    void GetMemoryFootprint(InferenceEngine::MemoryFootprint &footprint) override;
+
+    /**
+     * @brief Combines the metrics of the subnetworks, a hetero request runs the requests of the subnetworks one by
+     * one, the pipelined ones keep every subnetwork busy at once
+     */
+    void GetMetrics(InferenceEngine::ExecutableNetworkMetrics &metrics) override;
+
+protected:
+    /**
+     * @brief Trims every subnetwork, the ones whose plugins cannot release the memory keep it
+     */
+    void TrimImpl(bool releaseWeights) override;
+
 private:
+    HeteroInferRequest::SubRequestsList getSubRequests() const;
+
     struct NetworkDesc {
         std::string _device;
         InferenceEngine::details::CNNNetworkImplPtr _clonedNetwork;
@@ -71,6 +92,11 @@ private:
     };
     std::vector<NetworkDesc> networks;
 
+    // the pipeline is created by the first infer request, see KEY_HETERO_PIPELINE_DEPTH
+    size_t _pipelineDepth = 0;
+    HeteroPipeline::Ptr _pipeline;
+    std::mutex _pipelineMutex;
+
     InferenceEngine::MapDeviceLoaders &_deviceLoaders;
 };
 
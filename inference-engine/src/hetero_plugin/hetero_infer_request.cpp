@@ -4,6 +4,8 @@
 //
 
 #include "hetero_infer_request.h"
+#include "hetero_pipeline.h"
+#include "hetero_allocator.h"
 #include <ie_blob.h>
 #include <ie_plugin.hpp>
 #include <ie_util_internal.hpp>
@@ -12,6 +14,7 @@
 #include <ie_layouts.h>
 #include <assert.h>
 #include "ie_profiling.hpp"
+#include <blob_factory.hpp>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
@@ -25,7 +28,8 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
         THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
     }
 
-    auto requestBlob([&](const std::string &e, InferenceEngine::InferRequest::Ptr r) {
+    auto requestBlob([&](const std::string &e, const SubRequestDesc &desc) {
+        auto &r = desc._request;
         if (networkInputs.find(e) != networkInputs.end()) {
             if (_blobs.find(e) != _blobs.end()) {
                 r->SetBlob(e.c_str(), _blobs[e]);
@@ -43,7 +47,11 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
         } else {
             if (_blobs.find(e) != _blobs.end()) {
                 r->SetBlob(e.c_str(), _blobs[e]);
+            } else if (isBoundaryToDevice(_inferRequests, desc, e)) {
+                _blobs[e] = makeBoundaryBlob(r->GetBlob(e.c_str())->getTensorDesc());
+                r->SetBlob(e.c_str(), _blobs[e]);
             } else {
+                // the output of the device is read by the host in place through the blob of the device
                 _blobs[e] = r->GetBlob(e.c_str());
             }
         }
@@ -54,19 +62,101 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
         ireq._request = ireq._network->CreateInferRequestPtr();
         // go over all inputs and get blobs from subnet infer requests
         for (auto e : ireq._oNames) {
-            requestBlob(e, ireq._request);
+            requestBlob(e, ireq);
         }
     }
 
     // go over all outputs and get blobs from subnet infer requests
     for (auto r : _inferRequests) {
         for (auto e : r._iNames) {
-            requestBlob(e, r._request);
+            requestBlob(e, r);
         }
     }
 }
 
+HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                       InferenceEngine::OutputsDataMap networkOutputs,
+                                       const std::shared_ptr<HeteroPipeline> &pipeline) :
+        InferRequestInternal(networkInputs, networkOutputs),
+        _pipeline(pipeline) {
+    if (_networkOutputs.empty() || _networkInputs.empty()) {
+        THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
+    }
+
+    // the sub-requests are shared by all the requests, so only the inputs and the outputs belong to the request;
+    // the requests created per inference reuse the blobs of the released ones from the pool
+    for (auto &&input : _networkInputs)
+        _inputs[input.first] = make_pooled_blob(input.second->getTensorDesc());
+    for (auto &&output : _networkOutputs)
+        _outputs[output.first] = make_pooled_blob(output.second->getTensorDesc());
+}
+
+HeteroInferRequest::~HeteroInferRequest() {
+    // the running frame refers to the request
+    std::unique_lock<std::mutex> lock(_frameMutex);
+    _frameDone.wait(lock, [this] { return !_frameRunning; });
+}
+
+void HeteroInferRequest::startPipelinedFrame(bool notify) {
+    auto frame = std::make_shared<HeteroPipeline::Frame>();
+    for (auto &&input : _inputs) {
+        auto it = _preProcData.find(input.first);
+        frame->blobs[input.first] = it != _preProcData.end() ? it->second.getRoiBlob() : input.second;
+    }
+    for (auto &&output : _outputs) {
+        frame->blobs[output.first] = output.second;
+    }
+
+    HeteroPipeline::Frame *framePtr = frame.get();
+    frame->onDone = [this, framePtr, notify](StatusCode sts) {
+        // the request may be started again or destroyed as soon as the frame is marked done
+        std::function<void(InferRequest, StatusCode)> callback;
+        if (notify) {
+            callback = _lastCallback;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_frameMutex);
+            _executedRequests = framePtr->executedRequests;
+            _frameStatus = sts;
+            _frameRunning = false;
+        }
+        _frameDone.notify_all();
+        if (callback) {
+            callback(InferRequest(), sts);
+        }
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(_frameMutex);
+        _frameRunning = true;
+        _frameStatus = RESULT_NOT_READY;
+    }
+    _pipeline->Run(frame);
+}
+
+bool HeteroInferRequest::isBoundaryToDevice(const SubRequestsList &subRequests, const SubRequestDesc &producer,
+                                            const std::string &name) {
+    if (!isHostDevice(producer._device)) {
+        return false;
+    }
+    for (auto &&consumer : subRequests) {
+        if (!isHostDevice(consumer._device) && consumer._iNames.find(name) != consumer._iNames.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void HeteroInferRequest::InferImpl() {
+    if (_pipeline) {
+        startPipelinedFrame(false);
+        auto sts = waitAllRequests(IInferRequest::WaitMode::RESULT_READY);
+        if (sts != OK) {
+            THROW_IE_EXCEPTION << "Pipelined inference of the hetero network failed with the status " << sts;
+        }
+        return;
+    }
+
     updateInOutIfNeeded();
     size_t i = 0;
     for (auto &&desc : _inferRequests) {
@@ -79,6 +169,20 @@ void HeteroInferRequest::InferImpl() {
 
 void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
     perfMap.clear();
+    if (_pipeline) {
+        // the counters of the sub-requests which executed the last frame of the request
+        std::lock_guard<std::mutex> lock(_frameMutex);
+        for (size_t i = 0; i < _executedRequests.size(); i++) {
+            if (!_executedRequests[i]) {
+                continue;
+            }
+            auto perfMapRequest = _executedRequests[i]->GetPerformanceCounts();
+            for (auto &&r : perfMapRequest) {
+                perfMap[std::string("subgraph") + std::to_string(i + 1) + ": " + r.first] = r.second;
+            }
+        }
+        return;
+    }
     for (size_t i = 0; i < _inferRequests.size(); i++) {
         auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
         for (auto &&r : perfMapRequest) {
@@ -89,6 +193,10 @@ void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEng
 
 void HeteroInferRequest::updateInOutIfNeeded() {
     IE_PROFILING_AUTO_SCOPE(updateInOutIfNeeded);
+    if (_pipeline) {
+        // the blobs are bound to the sub-requests when the frame enters their subgraphs
+        return;
+    }
     assert(!_inferRequests.empty());
     for (auto &&desc : _inferRequests) {
         auto &r = desc._request;
@@ -123,16 +231,27 @@ void HeteroInferRequest::updateInOutIfNeeded() {
 }
 
 void HeteroInferRequest::startFirstAsyncRequest() {
+    if (_pipeline) {
+        startPipelinedFrame(true);
+        return;
+    }
     auto firstAsyncRequest = _inferRequests.begin()->_request;
     firstAsyncRequest->StartAsync();
 }
 
 void HeteroInferRequest::setCallbackForLastRequest(std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)>& callback) {
+    if (_pipeline) {
+        _lastCallback = callback;
+        return;
+    }
     auto lastRequest = _inferRequests.back()._request;
     if (lastRequest) lastRequest->SetCompletionCallback(callback);
 }
 
 void HeteroInferRequest::setCallbackSequence() {
+    if (_pipeline) {
+        return;
+    }
     for (auto desc = _inferRequests.begin(); desc != _inferRequests.end(); desc++) {
         auto &currentAsyncRequest = desc->_request;
         auto nextRequestDesc = std::next(desc);
@@ -149,6 +268,17 @@ void HeteroInferRequest::setCallbackSequence() {
 }
 
 StatusCode HeteroInferRequest::waitAllRequests(int64_t millis_timeout) {
+    if (_pipeline) {
+        std::unique_lock<std::mutex> lock(_frameMutex);
+        auto isDone = [this] { return !_frameRunning; };
+        if (millis_timeout == IInferRequest::WaitMode::RESULT_READY) {
+            _frameDone.wait(lock, isDone);
+        } else if (millis_timeout != IInferRequest::WaitMode::STATUS_ONLY &&
+                   !_frameDone.wait_for(lock, std::chrono::milliseconds(millis_timeout), isDone)) {
+            return RESULT_NOT_READY;
+        }
+        return _frameRunning ? RESULT_NOT_READY : _frameStatus;
+    }
     StatusCode status = INFER_NOT_STARTED;
     bool shareMsMode = true;
     std::chrono::high_resolution_clock::time_point startTime;
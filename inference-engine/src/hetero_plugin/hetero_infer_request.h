@@ -14,6 +14,9 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
 #include <unordered_set>
 #include <ie_common.h>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
@@ -23,11 +26,14 @@
 
 namespace HeteroPlugin {
 
+class HeteroPipeline;
+
 class HeteroInferRequest : public InferenceEngine::InferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
 
     struct SubRequestDesc {
+        std::string _device;
         InferenceEngine::ExecutableNetwork::Ptr _network;
         InferenceEngine::InferRequest::Ptr _request;
         std::unordered_set<std::string> _iNames;
@@ -40,6 +46,16 @@ public:
                                 InferenceEngine::OutputsDataMap networkOutputs,
                                 const SubRequestsList &inferRequests);
 
+    /**
+     * @brief Constructs the request executed by the shared sub-requests of the pipeline, the inputs and the outputs
+     * are allocated by the request itself
+     */
+    explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                InferenceEngine::OutputsDataMap networkOutputs,
+                                const std::shared_ptr<HeteroPipeline> &pipeline);
+
+    ~HeteroInferRequest();
+
     void InferImpl() override;
 
     void
@@ -57,9 +73,27 @@ public:
 
     bool isAnyRequestBusy();
 
+    /**
+     * @brief Checks that the intermediate blob is produced on the host and consumed by another device, such a blob
+     * is allocated page aligned by the hetero plugin and shared by both subgraphs (see HeteroPageAlignedAllocator)
+     */
+    static bool isBoundaryToDevice(const SubRequestsList &subRequests, const SubRequestDesc &producer,
+                                   const std::string &name);
+
 private:
+    void startPipelinedFrame(bool notify);
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
+
+    // pipelined mode, the state of the frame of the request
+    std::shared_ptr<HeteroPipeline> _pipeline;
+    std::vector<InferenceEngine::InferRequest::Ptr> _executedRequests;
+    std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)> _lastCallback;
+    mutable std::mutex _frameMutex;
+    std::condition_variable _frameDone;
+    bool _frameRunning = false;
+    InferenceEngine::StatusCode _frameStatus = InferenceEngine::INFER_NOT_STARTED;
 };
 
 }  // namespace HeteroPlugin
@@ -0,0 +1,193 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_pipeline.h"
+#include "hetero_allocator.h"
+#include <details/ie_exception.hpp>
+#include "ie_profiling.hpp"
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroPipeline::HeteroPipeline(const HeteroInferRequest::SubRequestsList &subgraphs, size_t depth) {
+    if (depth == 0) {
+        THROW_IE_EXCEPTION << "The depth of the hetero pipeline must be positive";
+    }
+
+    _stages.resize(subgraphs.size());
+    for (size_t s = 0; s < subgraphs.size(); s++) {
+        auto &stage = _stages[s];
+        stage.desc = subgraphs[s];
+        stage.lastConsumer = s;
+        for (size_t t = s + 1; t < subgraphs.size(); t++) {
+            for (auto &&name : subgraphs[t]._iNames) {
+                if (stage.desc._oNames.find(name) != stage.desc._oNames.end()) {
+                    stage.lastConsumer = t;
+                }
+            }
+        }
+
+        for (size_t r = 0; r < depth; r++) {
+            auto request = stage.desc._network->CreateInferRequestPtr();
+            // the host outputs consumed by the devices stay in the page aligned blobs bound to the sub-request
+            for (auto &&name : stage.desc._oNames) {
+                if (HeteroInferRequest::isBoundaryToDevice(subgraphs, stage.desc, name)) {
+                    request->SetBlob(name.c_str(), makeBoundaryBlob(request->GetBlob(name.c_str())->getTensorDesc()));
+                }
+            }
+            int index = static_cast<int>(r);
+            request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                    [this, s, index](InferRequest /*request*/, StatusCode sts) {
+                        IE_PROFILING_AUTO_SCOPE(Callback)
+                        onRequestDone(s, index, sts);
+                    });
+            stage.requests.push_back(request);
+            stage.running.push_back(nullptr);
+            stage.freeRequests.push_back(index);
+        }
+    }
+}
+
+HeteroPipeline::~HeteroPipeline() {
+    // the callbacks of the running sub-requests refer to the pipeline
+    for (auto &&stage : _stages) {
+        for (auto &&request : stage.requests) {
+            try {
+                request->Wait(IInferRequest::WaitMode::RESULT_READY);
+            } catch (...) {}
+        }
+    }
+}
+
+void HeteroPipeline::Run(const Frame::Ptr &frame) {
+    std::vector<StartedRequest> started;
+    std::vector<Frame::Ptr> finished;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        frame->intermediates.clear();
+        frame->executedRequests.assign(_stages.size(), nullptr);
+        frame->heldRequests.assign(_stages.size(), -1);
+        frame->status = OK;
+        _stages.front().waiting.push_back(frame);
+        schedule(started, finished);
+    }
+    start(started, finished);
+}
+
+void HeteroPipeline::onRequestDone(size_t stageIndex, int request, StatusCode status) {
+    std::vector<StartedRequest> started;
+    std::vector<Frame::Ptr> finished;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto &stage = _stages[stageIndex];
+        Frame::Ptr frame = stage.running[request];
+        if (!frame) {
+            return;
+        }
+
+        if (status != OK) {
+            frame->status = status;
+        } else {
+            for (auto &&name : stage.desc._oNames) {
+                if (frame->blobs.find(name) == frame->blobs.end()) {
+                    frame->intermediates[name] = stage.requests[request]->GetBlob(name.c_str());
+                }
+            }
+        }
+
+        if (frame->status != OK || stageIndex + 1 == _stages.size()) {
+            finish(frame, finished);
+        } else {
+            // the producers of the inputs of the stage are not needed anymore, if it was their last consumer
+            for (size_t t = 0; t <= stageIndex; t++) {
+                if (frame->heldRequests[t] >= 0 && _stages[t].lastConsumer <= stageIndex) {
+                    release(*frame, t);
+                }
+            }
+            _stages[stageIndex + 1].waiting.push_back(frame);
+        }
+        schedule(started, finished);
+    }
+    start(started, finished);
+}
+
+void HeteroPipeline::schedule(std::vector<StartedRequest> &started, std::vector<Frame::Ptr> &finished) {
+    // a failed frame frees the sub-requests of the earlier stages, so the stages are passed until nothing changes
+    bool progress = true;
+    while (progress) {
+        progress = false;
+        for (size_t s = 0; s < _stages.size(); s++) {
+            auto &stage = _stages[s];
+            while (!stage.freeRequests.empty() && !stage.waiting.empty()) {
+                Frame::Ptr frame = stage.waiting.front();
+                stage.waiting.pop_front();
+                int request = stage.freeRequests.back();
+                stage.freeRequests.pop_back();
+                frame->heldRequests[s] = request;
+                stage.running[request] = frame;
+                progress = true;
+                try {
+                    bindBlobs(s, *frame, *stage.requests[request]);
+                    started.emplace_back(s, request);
+                } catch (...) {
+                    frame->status = GENERAL_ERROR;
+                    finish(frame, finished);
+                }
+            }
+        }
+    }
+}
+
+void HeteroPipeline::start(const std::vector<StartedRequest> &started, const std::vector<Frame::Ptr> &finished) {
+    for (auto &&frame : finished) {
+        frame->onDone(frame->status);
+    }
+    for (auto &&request : started) {
+        IE_PROFILING_AUTO_SCOPE_TASK(_stages[request.first].desc._profilingTask);
+        try {
+            _stages[request.first].requests[request.second]->StartAsync();
+        } catch (...) {
+            onRequestDone(request.first, request.second, GENERAL_ERROR);
+        }
+    }
+}
+
+void HeteroPipeline::bindBlobs(size_t stageIndex, Frame &frame, InferRequest &request) {
+    auto &desc = _stages[stageIndex].desc;
+    for (auto &&name : desc._iNames) {
+        auto blob = frame.blobs.find(name);
+        if (blob != frame.blobs.end()) {
+            request.SetBlob(name.c_str(), blob->second);
+        } else {
+            request.SetBlob(name.c_str(), frame.intermediates.at(name));
+        }
+    }
+    // the intermediate outputs stay in the blobs of the sub-request, they are passed to the consumers
+    for (auto &&name : desc._oNames) {
+        auto blob = frame.blobs.find(name);
+        if (blob != frame.blobs.end()) {
+            request.SetBlob(name.c_str(), blob->second);
+        }
+    }
+}
+
+void HeteroPipeline::release(Frame &frame, size_t stageIndex) {
+    auto &stage = _stages[stageIndex];
+    int request = frame.heldRequests[stageIndex];
+    frame.executedRequests[stageIndex] = stage.requests[request];
+    frame.heldRequests[stageIndex] = -1;
+    stage.running[request] = nullptr;
+    stage.freeRequests.push_back(request);
+}
+
+void HeteroPipeline::finish(const Frame::Ptr &frame, std::vector<Frame::Ptr> &finished) {
+    for (size_t s = 0; s < _stages.size(); s++) {
+        if (frame->heldRequests[s] >= 0) {
+            release(*frame, s);
+        }
+    }
+    frame->intermediates.clear();
+    finished.push_back(frame);
+}
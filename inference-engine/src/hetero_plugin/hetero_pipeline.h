@@ -0,0 +1,88 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <ie_common.h>
+#include <ie_blob.h>
+#include <cpp/ie_infer_request.hpp>
+
+#include "hetero_infer_request.h"
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Pipelined execution of the subgraphs of a hetero network (see HeteroConfigParams::KEY_HETERO_PIPELINE_DEPTH).
+ * Every subgraph has its own pool of sub-requests shared by all the infer requests of the network, so the first
+ * subgraph of the next frame runs on its device while the second subgraph of the previous frame runs on another one.
+ * A sub-request producing the intermediate blobs is held by the frame until the last subgraph consuming them is done,
+ * so the depth of the pools bounds the number of the frames queued between the subgraphs.
+ */
+class HeteroPipeline {
+public:
+    typedef std::shared_ptr<HeteroPipeline> Ptr;
+
+    /**
+     * @brief A frame executed through the subgraphs, the blobs are the inputs and the outputs of the hetero request
+     */
+    struct Frame {
+        typedef std::shared_ptr<Frame> Ptr;
+
+        std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
+        std::function<void(InferenceEngine::StatusCode)> onDone;
+
+        // the sub-requests executed by the frame, filled when the frame is done
+        std::vector<InferenceEngine::InferRequest::Ptr> executedRequests;
+
+    private:
+        friend class HeteroPipeline;
+        std::map<std::string, InferenceEngine::Blob::Ptr> intermediates;
+        std::vector<int> heldRequests;
+        InferenceEngine::StatusCode status = InferenceEngine::OK;
+    };
+
+    HeteroPipeline(const HeteroInferRequest::SubRequestsList &subgraphs, size_t depth);
+
+    ~HeteroPipeline();
+
+    /**
+     * @brief Queues the frame to the first subgraph, onDone of the frame is called from the thread of the callback
+     * of the last executed sub-request
+     */
+    void Run(const Frame::Ptr &frame);
+
+private:
+    struct Stage {
+        HeteroInferRequest::SubRequestDesc desc;
+        std::vector<InferenceEngine::InferRequest::Ptr> requests;
+        std::vector<Frame::Ptr> running;
+        std::vector<int> freeRequests;
+        std::deque<Frame::Ptr> waiting;
+        // the index of the last stage consuming the intermediate blobs of the stage
+        size_t lastConsumer;
+    };
+    typedef std::pair<size_t, int> StartedRequest;
+
+    void onRequestDone(size_t stage, int request, InferenceEngine::StatusCode status);
+    // the functions below are called under the lock, the collected requests and frames are started and
+    // notified by start() after the lock is released
+    void schedule(std::vector<StartedRequest> &started, std::vector<Frame::Ptr> &finished);
+    void bindBlobs(size_t stage, Frame &frame, InferenceEngine::InferRequest &request);
+    void release(Frame &frame, size_t stage);
+    void finish(const Frame::Ptr &frame, std::vector<Frame::Ptr> &finished);
+    void start(const std::vector<StartedRequest> &started, const std::vector<Frame::Ptr> &finished);
+
+    std::vector<Stage> _stages;
+    std::mutex _mutex;
+};
+
+}  // namespace HeteroPlugin
@@ -0,0 +1,238 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "binary_format_parser.h"
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ie_parallel.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+const char BinaryFormatParser::magic[8] = {'I', 'E', 'B', 'I', 'N', 'I', 'R', '\0'};
+
+class BinaryFormatParser::Reader {
+public:
+    Reader(const void *data, size_t size)
+            : ptr(static_cast<const uint8_t *>(data)), end(static_cast<const uint8_t *>(data) + size) {}
+
+    uint32_t u32() {
+        const uint8_t *p = take(4);
+        return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 |
+               static_cast<uint32_t>(p[2]) << 16 | static_cast<uint32_t>(p[3]) << 24;
+    }
+
+    uint64_t u64() {
+        uint64_t low = u32();
+        return low | static_cast<uint64_t>(u32()) << 32;
+    }
+
+    float f32() {
+        uint32_t bits = u32();
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // the number of the items following it, each of them takes at least itemSize bytes
+    uint32_t count(size_t itemSize) {
+        uint32_t n = u32();
+        if (static_cast<size_t>(end - ptr) / itemSize < n)
+            THROW_IE_EXCEPTION << "Binary IR is truncated";
+        return n;
+    }
+
+    void readStrings() {
+        strings.resize(count(4));
+        for (auto &str : strings) {
+            uint32_t length = u32();
+            const char *chars = reinterpret_cast<const char *>(take(length));
+            str.assign(chars, length);
+        }
+    }
+
+    const std::string &str() {
+        uint32_t index = u32();
+        if (index >= strings.size())
+            THROW_IE_EXCEPTION << "Binary IR refers to the string " << index << " out of its string table";
+        return strings[index];
+    }
+
+    Precision precision() {
+        return Precision::FromStr(str());
+    }
+
+    bool atEnd() const {
+        return ptr == end;
+    }
+
+private:
+    const uint8_t *take(size_t bytes) {
+        if (static_cast<size_t>(end - ptr) < bytes)
+            THROW_IE_EXCEPTION << "Binary IR is truncated";
+        const uint8_t *p = ptr;
+        ptr += bytes;
+        return p;
+    }
+
+    const uint8_t *ptr;
+    const uint8_t *end;
+    std::vector<std::string> strings;
+};
+
+BinaryFormatParser::BinaryFormatParser() : V2FormatParser(2) {}
+
+bool BinaryFormatParser::isBinaryIR(const void *data, size_t size) {
+    return size >= sizeof(magic) && std::memcmp(data, magic, sizeof(magic)) == 0;
+}
+
+CNNLayer::Ptr BinaryFormatParser::CreateLayer(const LayerParams &prms) const {
+    auto &creators = getCreatorsByType();
+    auto creator = creators.find(prms.type);
+    CNNLayer::Ptr layer;
+    if (creator != creators.end())
+        layer = creator->second->CreateLayerFromParams(prms);
+    // the types without a creator are the generic layers, as in the XML
+    return layer ? layer : std::make_shared<GenericLayer>(prms);
+}
+
+CNNNetworkImplPtr BinaryFormatParser::Parse(const void *data, size_t size) {
+    if (!isBinaryIR(data, size))
+        THROW_IE_EXCEPTION << "The buffer is not a binary IR";
+    Reader reader(static_cast<const uint8_t *>(data) + sizeof(magic), size - sizeof(magic));
+    uint32_t fileVersion = reader.u32();
+    if (fileVersion != version)
+        THROW_IE_EXCEPTION << "Cannot parse the binary IR of the version " << fileVersion;
+    reader.readStrings();
+
+    _network.reset(new CNNNetworkImpl());
+    _network->setName(reader.str());
+    _network->setPrecision(reader.precision());
+
+    std::vector<CNNLayerPtr> layers(reader.count(4 * 7));
+    for (size_t i = 0; i < layers.size(); i++) {
+        LayerParseParameters lprms;
+        lprms.layerId = static_cast<int>(i);
+        lprms.prms.name = reader.str();
+        lprms.prms.type = reader.str();
+        lprms.prms.precision = reader.precision();
+
+        CNNLayerPtr layer = CreateLayer(lprms.prms);
+        for (uint32_t n = reader.count(8); n > 0; n--) {
+            const std::string &key = reader.str();
+            layer->params[key] = reader.str();
+        }
+
+        layer->insData.resize(reader.count(8));
+        for (auto &input : layer->insData) {
+            uint32_t from = reader.u32();
+            uint32_t port = reader.u32();
+            if (from >= i || port >= layers[from]->outData.size())
+                THROW_IE_EXCEPTION << "Layer " << layer->name << " is connected to the output " << port
+                                   << " of the layer " << from << ", which does not precede it";
+            const DataPtr &data = layers[from]->outData[port];
+            data->getInputTo()[layer->name] = layer;
+            input = data;
+        }
+
+        for (uint32_t n = reader.count(12); n > 0; n--) {
+            const std::string &dataName = reader.str();
+            Precision precision = reader.precision();
+            SizeVector dims(reader.count(8));
+            for (auto &dim : dims)
+                dim = static_cast<size_t>(reader.u64());
+
+            DataPtr &data = _network->getData(dataName);
+            if (data)
+                THROW_IE_EXCEPTION << "two layers set to the same output [" << dataName << "]";
+            data.reset(new Data(dataName, dims, precision, TensorDesc::getLayoutByDims(dims)));
+            data->setDims(dims);
+            data->getCreatorLayer() = layer;
+            layer->outData.push_back(data);
+        }
+
+        for (uint32_t n = reader.count(24); n > 0; n--) {
+            WeightSegment &segment = lprms.blobs[reader.str()];
+            segment.precision = reader.precision();
+            segment.start = static_cast<size_t>(reader.u64());
+            segment.size = static_cast<size_t>(reader.u64());
+        }
+
+        layersParseInfo[layer->name] = std::move(lprms);
+        _network->addLayer(layer);
+        layers[i] = layer;
+
+        if (CaselessEq<std::string>()(layer->type, "input")) {
+            if (layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << "Input layer must have 1 output";
+            InputInfo::Ptr info(new InputInfo());
+            info->setInputData(layer->outData[0]);
+            Precision inputPrecision = info->getInputPrecision();
+            if (inputPrecision == Precision::Q78)
+                info->setInputPrecision(Precision::I16);
+            if (inputPrecision == Precision::FP16)
+                info->setInputPrecision(Precision::FP32);
+            _network->setInputInfo(info);
+        }
+    }
+    if (layers.empty())
+        THROW_IE_EXCEPTION << "Incorrect model! Network doesn't contain layers.";
+
+    ParsePreProcess(reader);
+    if (!reader.atEnd())
+        THROW_IE_EXCEPTION << "Binary IR has data after the network";
+
+    // the typed fields of the layers are filled from their params as the XML parser does
+    std::vector<std::exception_ptr> errors(layers.size());
+    parallel_ranges(layers.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            try {
+                layers[i]->validateLayer();
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    }, 64);
+    for (const auto &error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    _network->resolveOutput();
+    OutputsDataMap outputsInfo;
+    _network->getOutputsInfo(outputsInfo);
+    for (auto &outputInfo : outputsInfo) {
+        outputInfo.second->setPrecision(Precision::FP32);
+    }
+    return _network;
+}
+
+void BinaryFormatParser::ParsePreProcess(Reader &reader) {
+    for (uint32_t n = reader.count(16); n > 0; n--) {
+        const std::string &inputName = reader.str();
+        auto variant = static_cast<MeanVariant>(reader.u32());
+        uint32_t channels = reader.u32();
+        Precision meanPrecision = reader.precision();
+
+        InputInfo::Ptr input = _network->getInput(inputName);
+        if (!input)
+            THROW_IE_EXCEPTION << "pre-process name ref '" << inputName << "' refers to un-existing input";
+        PreProcessInfo &pp = input->getPreProcess();
+        pp.init(channels);
+        std::vector<WeightSegment> &segments = _preProcessSegments[inputName];
+        segments.resize(channels);
+        for (uint32_t c = 0; c < channels; c++) {
+            pp[c]->meanValue = reader.f32();
+            pp[c]->stdScale = reader.f32();
+            segments[c].precision = meanPrecision;
+            segments[c].start = static_cast<size_t>(reader.u64());
+            segments[c].size = static_cast<size_t>(reader.u64());
+        }
+        pp.setVariant(variant);
+    }
+}
@@ -0,0 +1,60 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "v2_format_parser.h"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief The binary topology of the IR v2 networks, written by saveNetworkToBinaryIR and read by CNNNetReader in
+ * place of the .xml, the weights stay in the .bin file. The network is read straight from the (memory mapped) file
+ * without any text parsing: the strings are stored once in the string table and everything else refers to them by
+ * the index, the numbers are stored as they are.
+ *
+ * All the integers are little endian, uint32 unless noted, the strings are the indices to the string table:
+ *   header:       magic "IEBINIR\0", version
+ *   string table: count, count x (length, bytes)
+ *   network:      name, precision
+ *   layers:       count, count x layer in the topological order
+ *     layer:      name, type, precision,
+ *                 params count, count x (key, value),
+ *                 inputs count, count x (index of the creator layer, index of its output),
+ *                 outputs count, count x (data name, precision, rank, rank x uint64 dim),
+ *                 blobs count, count x (name, precision, uint64 offset, uint64 size)
+ *   pre-process:  count, count x (input name, mean variant, channels, mean precision,
+ *                 channels x (float mean value, float scale, uint64 mean offset, uint64 mean size))
+ */
+class BinaryFormatParser : public V2FormatParser {
+public:
+    static const char magic[8];
+    static const uint32_t version = 1;
+
+    BinaryFormatParser();
+
+    /**
+     * @brief Returns true if the buffer starts with the header of the binary topology
+     */
+    static bool isBinaryIR(const void *data, size_t size);
+
+    using V2FormatParser::Parse;
+
+    CNNNetworkImplPtr Parse(const void *data, size_t size);
+
+private:
+    class Reader;
+
+    CNNLayer::Ptr CreateLayer(const LayerParams &prms) const;
+    void ParsePreProcess(Reader &reader);
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include "blob_factory.hpp"
+#include "pooled_allocator.hpp"
 
 
 InferenceEngine::Blob::Ptr make_blob_with_precision(const InferenceEngine::TensorDesc& desc) {
@@ -16,6 +17,17 @@ InferenceEngine::Blob::Ptr make_blob_with_precision(const InferenceEngine::Tenso
     return make_blob_with_precision(desc.getPrecision(), desc, ptr);
 }
 
+InferenceEngine::Blob::Ptr make_blob_with_precision(const InferenceEngine::TensorDesc& desc,
+                                                    const std::shared_ptr<InferenceEngine::IAllocator>& alloc) {
+    return make_blob_with_precision(desc.getPrecision(), desc, alloc);
+}
+
+InferenceEngine::Blob::Ptr make_pooled_blob(const InferenceEngine::TensorDesc& desc) {
+    auto blob = make_blob_with_precision(desc, PooledAllocator::shared());
+    blob->allocate();
+    return blob;
+}
+
 InferenceEngine::Blob::Ptr CreateBlobFromData(const InferenceEngine::DataPtr &data) {
     // TODO Here some decision should be made about the layout.
     // For now we just pass the layout and use conversion to NCHW for ANY.
@@ -30,6 +42,7 @@ InferenceEngine::Blob::Ptr CreateBlobFromData(const InferenceEngine::DataPtr &da
         case InferenceEngine::Precision::Q78:
         case InferenceEngine::Precision::I16:
         case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::BF16:
             return std::make_shared<InferenceEngine::TBlob<short>>(data->getPrecision(), targetLayout, data->getDims());
         case InferenceEngine::Precision::U8:
             return std::make_shared<InferenceEngine::TBlob<uint8_t>>(data->getPrecision(), targetLayout, data->getDims());
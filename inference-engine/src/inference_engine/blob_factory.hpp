@@ -24,6 +24,10 @@ class BlobFactory {
     static InferenceEngine::Blob::Ptr make(const InferenceEngine::TensorDesc& desc, void* ptr) {
         return InferenceEngine::make_shared_blob<BlobType>(desc, reinterpret_cast<BlobType*>(ptr));
     }
+    static InferenceEngine::Blob::Ptr make(const InferenceEngine::TensorDesc& desc,
+                                           const std::shared_ptr<InferenceEngine::IAllocator>& alloc) {
+        return InferenceEngine::make_shared_blob<BlobType>(desc, alloc);
+    }
 };
 
 template <InferenceEngine::Precision::ePrecision precision, class ... Args> InferenceEngine::Blob::Ptr make_shared_blob2(Args && ... args) {
@@ -36,12 +40,22 @@ template <InferenceEngine::Precision::ePrecision precision, class ... Args> Infe
 
 INFERENCE_ENGINE_API_CPP(InferenceEngine::Blob::Ptr) make_blob_with_precision(const InferenceEngine::TensorDesc& desc);
 INFERENCE_ENGINE_API_CPP(InferenceEngine::Blob::Ptr) make_blob_with_precision(const InferenceEngine::TensorDesc& desc, void* ptr);
+INFERENCE_ENGINE_API_CPP(InferenceEngine::Blob::Ptr) make_blob_with_precision(const InferenceEngine::TensorDesc& desc,
+        const std::shared_ptr<InferenceEngine::IAllocator>& alloc);
+
+/**
+ * @brief Creates and allocates a transient blob from the pool of the process (see PooledAllocator): the blobs
+ * allocated and freed again and again with the same sizes reuse the memory of the freed ones
+ * @param desc - the descriptor of the blob
+ */
+INFERENCE_ENGINE_API_CPP(InferenceEngine::Blob::Ptr) make_pooled_blob(const InferenceEngine::TensorDesc& desc);
 
 template <class ... Args>
 InferenceEngine::Blob::Ptr make_blob_with_precision(InferenceEngine::Precision precision, Args &&... args) {
     switch (precision) {
         USE_FACTORY(FP32);
         USE_FACTORY(FP16);
+        USE_FACTORY(BF16);
         USE_FACTORY(Q78);
         USE_FACTORY(I16);
         USE_FACTORY(U8);
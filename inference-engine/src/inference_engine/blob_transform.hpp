@@ -5,7 +5,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include "ie_blob.h"
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 
@@ -50,44 +53,56 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     int W_dst_stride = dst->layout() == NHWC ? dst_strides[2] : dst_strides[3];
     int dst_off = dst_blk_desc.getOffsetPadding();
 
-    src_ptr += dst_off;
+    dst_ptr += dst_off;
 
     // WA. Because of wrong filler
     int _N_dst_stride = C*H*W;
-    int _C_dst_stride = H*W;
     int _W_dst_stride = C;
 
+    // the rows of the images are transposed in parallel, every row by the tiles of the pixels, so the source
+    // and the destination of the tile stay in L1
+    const int tile = 64;
+
     if (src->layout() == NHWC && dst->layout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t *dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t *src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t *src_ptr_l_l = src_ptr_l + h*H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
+        details::parallel_ranges(static_cast<size_t>(N) * H, [&](size_t begin, size_t end) {
+            for (size_t row = begin; row < end; row++) {
+                int n = static_cast<int>(row / H);
+                int h = static_cast<int>(row % H);
+                const data_t *src_row = src_ptr + n * N_src_stride + h * H_src_stride;
+                data_t *dst_row = dst_ptr + n * N_dst_stride + h * W;
+                for (int w0 = 0; w0 < W; w0 += tile) {
+                    int w1 = std::min(W, w0 + tile);
+                    for (int c = 0; c < C; c++) {
+                        const data_t *src_l = src_row + c * C_src_stride;
+                        data_t *dst_l = dst_row + c * C_dst_stride;
+                        for (int w = w0; w < w1; w++) {
+                            dst_l[w] = src_l[w * W_src_stride];
+                        }
                     }
                 }
             }
-        }
+        });
     } else if (src->layout() == NCHW && dst->layout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t *src_ptr_l = src_ptr + n * N_src_stride + c * H * W;
-                data_t *dst_ptr_l = dst_ptr + n * _N_dst_stride + c;
-                for (int hw = 0; hw < H*W; hw++) {
-                    *dst_ptr_l = *src_ptr_l;
-                    dst_ptr_l += _W_dst_stride;
-                    src_ptr_l++;
+        details::parallel_ranges(static_cast<size_t>(N) * H, [&](size_t begin, size_t end) {
+            for (size_t row = begin; row < end; row++) {
+                int n = static_cast<int>(row / H);
+                int h = static_cast<int>(row % H);
+                const data_t *src_row = src_ptr + n * N_src_stride + h * W;
+                data_t *dst_row = dst_ptr + n * _N_dst_stride + h * W * _W_dst_stride;
+                for (int w0 = 0; w0 < W; w0 += tile) {
+                    int w1 = std::min(W, w0 + tile);
+                    for (int c = 0; c < C; c++) {
+                        const data_t *src_l = src_row + c * H * W;
+                        data_t *dst_l = dst_row + c;
+                        for (int w = w0; w < w1; w++) {
+                            dst_l[w * _W_dst_stride] = src_l[w];
+                        }
+                    }
                 }
             }
-        }
+        });
     } else {
-        for (int i = 0; i < N*C*H*W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        std::memcpy(dst_ptr, src_ptr, static_cast<size_t>(N) * C * H * W * sizeof(data_t));
     }
 }
 
@@ -99,6 +114,7 @@ static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
             break;
 
         case Precision::FP16:
+        case Precision::BF16:
         case Precision::U16:
         case Precision::I16:
             blob_copy_4d_t<Precision::U16>(src, dst);
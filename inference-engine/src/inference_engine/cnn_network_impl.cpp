@@ -9,10 +9,12 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <cassert>
 #include <shape_infer/ie_reshaper.hpp>
 #include "debug.h"
 #include "graph_tools.hpp"
+#include "ie_load_profile.hpp"
 #include <vector>
 
 using namespace std;
@@ -32,12 +34,13 @@ void CNNNetworkImpl::getInputsInfo(InputsDataMap& inputs) const noexcept {
 
 void CNNNetworkImpl::addLayer(const CNNLayerPtr& layer) noexcept {
     _layers[layer->name] = layer;
+    _reshaper.reset();
 }
 
 void CNNNetworkImpl::validate(int version) {
     if (version != 1) {
-        std::set<std::string> layerNames;
-        std::set<std::string> dataNames;
+        std::unordered_set<std::string> layerNames;
+        std::unordered_set<std::string> dataNames;
 
         InputsDataMap inputs;
         this->getInputsInfo(inputs);
@@ -48,10 +51,10 @@ void CNNNetworkImpl::validate(int version) {
         bool res = CNNNetForestDFS(CNNNetGetAllInputLayers(*this), [&](CNNLayerPtr layer) {
             std::string layerName = layer->name;
 
-            for (auto i : layer->insData) {
+            for (auto &i : layer->insData) {
                 auto data = i.lock();
                 if (data) {
-                    auto inputTo = data->getInputTo();
+                    auto &inputTo = data->getInputTo();
                     auto iter = inputTo.find(layerName);
                     auto dataName = data->name;
                     if (iter == inputTo.end()) {
@@ -66,15 +69,15 @@ void CNNNetworkImpl::validate(int version) {
                     THROW_IE_EXCEPTION << "Data which inserted into the layer " << layerName << " is nullptr";
                 }
             }
-            for (auto data : layer->outData) {
-                auto inputTo = data->getInputTo();
-                std::string dataName = data->getName();
-                for (auto layerIter : inputTo) {
-                    CNNLayerPtr layerInData = layerIter.second;
+            for (auto &data : layer->outData) {
+                auto &inputTo = data->getInputTo();
+                const std::string &dataName = data->getName();
+                for (auto &layerIter : inputTo) {
+                    const CNNLayerPtr &layerInData = layerIter.second;
                     if (!layerInData) {
                         THROW_IE_EXCEPTION << "Layer which takes data " << dataName << " is nullptr";
                     }
-                    auto insertedDatas = layerInData->insData;
+                    auto &insertedDatas = layerInData->insData;
 
                     auto it = std::find_if(insertedDatas.begin(), insertedDatas.end(),
                                            [&](InferenceEngine::DataWeakPtr& d) {
@@ -136,7 +139,7 @@ StatusCode CNNNetworkImpl::addOutput(const std::string& layerName, size_t output
 
 void CNNNetworkImpl::resolveOutput() {
     // check orphan nodes...
-    for (auto kvp : _data) {
+    for (const auto& kvp : _data) {
         if (!kvp.second->isInitialized())
             THROW_IE_EXCEPTION << "data name [" << kvp.first << "] dimensions is not known";
 
@@ -175,8 +178,11 @@ StatusCode
 CNNNetworkImpl::reshape(const std::map<std::string, std::vector<size_t>>& inputShapes,
                         ResponseDesc* responseDesc) noexcept {
     try {
-        ShapeInfer::Reshaper reshaper(*this);
-        reshaper.run(inputShapes);
+        LoadPhaseScope phase("shape infer");
+        if (!_reshaper) {
+            _reshaper = std::make_shared<ShapeInfer::Reshaper>(*this);
+        }
+        _reshaper->run(inputShapes);
     } catch (const InferenceEngineException& e) {
         return DescriptionBuffer(GENERAL_ERROR, responseDesc) << e.what();
     } catch (const std::exception& e) {
@@ -191,6 +197,7 @@ StatusCode
 CNNNetworkImpl::AddExtension(const InferenceEngine::IShapeInferExtensionPtr& extension,
                              InferenceEngine::ResponseDesc* resp) noexcept {
     _shapeInferExts.push_back(extension);
+    _reshaper.reset();
     return OK;
 }
 
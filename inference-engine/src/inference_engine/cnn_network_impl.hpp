@@ -7,6 +7,7 @@
 
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <ie_icnn_network.hpp>
 #include "ie_common.h"
 #include "ie_data.h"
@@ -17,6 +18,9 @@
 #include <vector>
 
 namespace InferenceEngine {
+namespace ShapeInfer {
+class Reshaper;
+}  // namespace ShapeInfer
 namespace details {
 class INFERENCE_ENGINE_API_CLASS(CNNNetworkImpl) : public ICNNNetwork {
 public:
@@ -60,7 +64,7 @@ public:
         _name = name;
     }
 
-    const std::map<std::string, CNNLayerPtr>& allLayers() const {
+    const std::unordered_map<std::string, CNNLayerPtr>& allLayers() const {
         return _layers;
     }
 
@@ -78,6 +82,15 @@ public:
 
     void addLayer(const CNNLayerPtr& layer) noexcept override;
 
+    void removeLayer(const std::string& layerName) {
+        _layers.erase(layerName);
+        _reshaper.reset();
+    }
+
+    void removeData(const std::string& dataName) {
+        _data.erase(dataName);
+    }
+
     StatusCode getLayerByName(const char* layerName, CNNLayerPtr& out, ResponseDesc* resp) const noexcept override;
 
     // deprecated, as there is no ResponseDesc to put error message
@@ -118,8 +131,9 @@ public:
 
 protected:
     Precision precision {Precision::MIXED};
-    std::map<std::string, DataPtr> _data;
-    std::map<std::string, CNNLayerPtr> _layers;
+    // hashed by name: the loaders and the passes look the layers and the data up by name many times per network
+    std::unordered_map<std::string, DataPtr> _data;
+    std::unordered_map<std::string, CNNLayerPtr> _layers;
     InferenceEngine::InputsDataMap _inputData;
     std::map<std::string, DataPtr> _outputData;
     std::string _name;
@@ -127,6 +141,8 @@ protected:
     TargetDevice _targetDevice;
     DataPtr _emptyData;
     std::vector<IShapeInferExtensionPtr> _shapeInferExts;
+    /// @brief Reshaper is kept between the reshape calls to reuse its cache of inferred shapes
+    std::shared_ptr<ShapeInfer::Reshaper> _reshaper;
 };
 
 
@@ -11,6 +11,8 @@
 #include <string>
 #include <cassert>
 #include <cmath>
+#include <algorithm>
+#include <immintrin.h>
 
 #include <ie_common.h>
 #include <graph_tools.hpp>
@@ -19,45 +21,15 @@
 #include "cnn_network_impl.hpp"
 #include "cnn_network_stats_impl.hpp"
 #include "debug.h"
+#include "ie_parallel.hpp"
 
 using namespace std;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
-void CNNNetworkInt8Normalizer::AddLayerToCNNNetwork(CNNNetwork& net, CNNLayerPtr firstNode, CNNLayerPtr secondNode, CNNLayerPtr nodeToInsert) {
-    std::string layerName = nodeToInsert->name;
-
-    int out_index = -1;
-    for (int k = 0; k < firstNode->outData.size(); k++) {
-        if (firstNode->outData[k]->inputTo.find(secondNode->name) != firstNode->outData[k]->inputTo.end()) {
-            out_index = k;
-            break;
-        }
-    }
-
-    TensorDesc desc(firstNode->outData[out_index]->getTensorDesc());
-    DataPtr out = DataPtr(new Data(layerName, desc));
-    out->creatorLayer = nodeToInsert;
-
-    for (int i = 0; i < secondNode->insData.size(); i++) {
-        if (secondNode->insData[i].lock()->creatorLayer.lock() == firstNode) {
-            secondNode->insData[i] = out;
-            break;
-        }
-    }
-
-    out->inputTo[secondNode->name] = secondNode;
-    firstNode->outData[out_index]->inputTo.erase(secondNode->name);
-
-    firstNode->outData[out_index]->inputTo[layerName] = nodeToInsert;
-
-    nodeToInsert->insData.push_back(firstNode->outData[0]);
-    nodeToInsert->outData.push_back(out);
-    ((ICNNNetwork&) net).addLayer(nodeToInsert);
-}
-
-void CNNNetworkInt8Normalizer::AddScaleShiftBeforeAndAfterInt8(CNNNetwork& net) {
-    std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(net);
+void CNNNetworkInt8Normalizer::AddScaleShiftBeforeAndAfterInt8(GraphTransformer& transformer) {
+    // the inserted layers are not int8, so the order sorted before the insertions is enough
+    std::vector<CNNLayerPtr> sortedLayers = transformer.sortedLayers();
 
     for (auto iter : sortedLayers) {
         if (iter->precision == Precision::I8) {
@@ -76,7 +48,9 @@ void CNNNetworkInt8Normalizer::AddScaleShiftBeforeAndAfterInt8(CNNNetwork& net)
 
                         CNNLayerPtr ssCnnLayer(new ScaleShiftLayer(ssCnnLayerParams));
 
-                        AddLayerToCNNNetwork(net, previousNode, iter, ssCnnLayer);
+                        transformer.insertBetween(previousNode, iter, ssCnnLayer);
+                        // the quantized input of the int8 layer
+                        ssCnnLayer->outData[0]->setPrecision(Precision::U8);
 
                         size_t C = static_cast<size_t>(previousNode->outData[0]->getDims()[1]);
 
@@ -134,7 +108,7 @@ void CNNNetworkInt8Normalizer::AddScaleShiftBeforeAndAfterInt8(CNNNetwork& net)
 
                         CNNLayerPtr ssCnnLayer(new ScaleShiftLayer(ssCnnLayerParams));
 
-                        AddLayerToCNNNetwork(net, nextNode, nextNextNode, ssCnnLayer);
+                        transformer.insertBetween(nextNode, nextNextNode, ssCnnLayer);
 
                         size_t C = static_cast<size_t>(nextNode->outData[0]->getDims()[1]);
 
@@ -184,34 +158,46 @@ void CNNNetworkInt8Normalizer::ScaleDataToInt8(const float* srcData, size_t srcS
     const float* data = srcData;
     int8_t* int8data = static_cast<int8_t*>(int8blob->buffer());
 
-    size_t offset;
-
-    float val;
-
-    for (size_t ch = 0; ch < channels; ch++) {
-        offset = channelSize * ch;
-
-        for (size_t i = 0; i < channelSize; i++) {
-            val = data[offset + i] * scales[ch];
-
-            if (val > maxValue) {
-                val = maxValue;
-            } else if (val < -maxValue) {
-                val = -maxValue;
+    // the channels are quantized in parallel, 16 values per step: scaled, clamped, rounded to the nearest
+    // and packed with the saturation to int8
+    details::parallel_ranges(channels, [&](size_t begin, size_t end) {
+        const __m128 vmax = _mm_set1_ps(maxValue);
+        const __m128 vmin = _mm_set1_ps(-maxValue);
+        for (size_t ch = begin; ch < end; ch++) {
+            const float* src = data + channelSize * ch;
+            int8_t* dst = int8data + channelSize * ch;
+            const __m128 vscale = _mm_set1_ps(scales[ch]);
+
+            auto quantize = [&](const float* p) {
+                __m128 val = _mm_mul_ps(_mm_loadu_ps(p), vscale);
+                return _mm_cvtps_epi32(_mm_max_ps(_mm_min_ps(val, vmax), vmin));
+            };
+
+            size_t i = 0;
+            for (; i + 16 <= channelSize; i += 16) {
+                __m128i lo = _mm_packs_epi32(quantize(src + i), quantize(src + i + 4));
+                __m128i hi = _mm_packs_epi32(quantize(src + i + 8), quantize(src + i + 12));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi16(lo, hi));
+            }
+            for (; i < channelSize; i++) {
+                float val = std::min(std::max(src[i] * scales[ch], -maxValue), maxValue);
+                dst[i] = static_cast<int8_t>(std::nearbyint(val));
             }
-
-            int8data[offset + i] = val;
         }
-    }
+    }, std::max<size_t>(1, 4096 / std::max<size_t>(channelSize, 1)));
 }
 
-void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetwork& net, const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats) {
-    std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(net);
+void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, GraphTransformer& transformer, const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats) {
+    std::vector<CNNLayerPtr> sortedLayers = transformer.sortedLayers();
 
     for (auto iter : sortedLayers) {
         if (netNodesStats.find(iter->name) == netNodesStats.end()) {
             continue;
         }
+        // the statistics of the layer are still used by its consumers, the layer itself stays in fp32
+        if (iter->GetParamAsString("quantization_level", "") == "FP32") {
+            continue;
+        }
 
         if (iter->type == "Convolution" /* TODO || iter->type == "FullyConnected" */) {
             auto weights = iter->blobs["weights"];
@@ -229,6 +215,13 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
             int8biases->allocate();
             iter->blobs["biases"] = int8biases;
 
+            // the plugins read the weights of the layer from its members
+            auto* weightableLayer = dynamic_cast<WeightableLayer*>(iter.get());
+            if (weightableLayer != nullptr) {
+                weightableLayer->_weights = int8weights;
+                weightableLayer->_biases = int8biases;
+            }
+
             std::vector<float> weightScalers;
 
             size_t inputChannels = iter->insData[0].lock()->dims[2];
@@ -265,33 +258,33 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
             const float* weight = static_cast<const float*>(weights->buffer());
             const float* bias = static_cast<const float*>(biases->buffer());
 
-            std::vector<float> newWeights;  // "new" weights are weights multiplied by i-scale
+            // "new" weights are weights multiplied by i-scale, the output channels are scaled in parallel
+            size_t outChannelSize = weights->dims()[0] / outputChannels;
+            std::vector<float> newWeights(weights->dims()[0]);
+            weightScalers.resize(outputChannels);
             {
-                size_t W_CO = outputChannels,
-                        W_CI = inputChannels,
+                size_t W_CI = inputChannels,
                         W_HW = weights->dims()[0] / inputChannels / outputChannels;
 
-                for (size_t co = 0; co < W_CO; co++) {
-                    for (size_t ci = 0; ci < W_CI; ci++) {
-                        for (size_t hw = 0; hw < W_HW; hw++) {
-                            newWeights.push_back(weight[co * W_CI * W_HW + ci * W_HW + hw] * iScaleMemory[ci]);
+                details::parallel_ranges(outputChannels, [&](size_t begin, size_t end) {
+                    for (size_t co = begin; co < end; co++) {
+                        const float* src = weight + co * outChannelSize;
+                        float* dst = &newWeights[co * outChannelSize];
+                        for (size_t ci = 0; ci < W_CI; ci++) {
+                            for (size_t hw = 0; hw < W_HW; hw++) {
+                                dst[ci * W_HW + hw] = src[ci * W_HW + hw] * iScaleMemory[ci];
+                            }
                         }
+
+                        // Calculating weights normalization scale factor (w-scale)
+                        float max = FLT_MIN;
+                        DataStats::GetDataAbsMax(dst, outChannelSize, max);
+                        weightScalers[co] = maxSign / max;
                     }
-                }
+                });
             }
-
-            size_t outChannelSize = weights->dims()[0] / outputChannels;
-
-            // Calculating weights normalization scale factor (w-scale)
-            float* weight_iter;
-            size_t co;
-            for (co = 0, weight_iter = &newWeights[0]; co < outputChannels; co++, weight_iter += outChannelSize) {
-                float max = FLT_MIN;
-                DataStats::GetDataAbsMax(weight_iter, outChannelSize, max);
-
-                float scaler = maxSign / max;
+            for (float scaler : weightScalers) {
                 std::cout << "scaler: " << scaler << std::endl;
-                weightScalers.push_back(scaler);
             }
 
             std::shared_ptr<Data> wScaleData = std::shared_ptr<Data>(new Data("w-scale", { outputChannels }, Precision::FP32, Layout::C));
@@ -326,12 +319,10 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
             ScaleDataToInt8(&newWeights[0], weights->size(), int8weights, maxSign, weightScalers);
             ScaleDataToInt8(bias, biases->size(), int8biases, maxSign, weightScalers);
 
-            // Setting precisions
+            // Setting precisions, the input is marked as U8 by the ScaleShift inserted before the layer,
+            // so the producer of the data keeps its precision
             iter->precision = Precision::I8;
 
-            for (auto&& in : iter->insData) {
-                in.lock()->precision = Precision::U8;
-            }
             for (auto&& out : iter->outData) {
                 out->precision = Precision::I8;
             }
@@ -342,14 +333,22 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
 }
 
 void CNNNetworkInt8Normalizer::NormalizeNetwork(ICNNNetwork& network, ICNNNetworkStats& netStats) {
-    CNNNetwork cnnn(&network);
+    // the network is sorted once, the passes keep the order up to date
+    GraphTransformer transformer(network);
 
     int maxSign = 0x7F;
     int maxUnsign = 0xFF;
 
     // Applying int8-conversion
-    ConvertToInt8(maxSign, maxUnsign, cnnn, dynamic_cast<const CNNNetworkStatsImpl&>(netStats).getNodesStats());
+    ConvertToInt8(maxSign, maxUnsign, transformer, dynamic_cast<const CNNNetworkStatsImpl&>(netStats).getNodesStats());
 
     // Adding ScaleShift layers before and after each Convolution-Activation pair
-    AddScaleShiftBeforeAndAfterInt8(cnnn);
+    try {
+        AddScaleShiftBeforeAndAfterInt8(transformer);
+    } catch (...) {
+        // the layers inserted before the failure are removed, so the network stays connected
+        transformer.rollback();
+        throw;
+    }
+    transformer.commit();
 }
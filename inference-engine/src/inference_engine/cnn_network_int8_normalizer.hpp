@@ -15,6 +15,7 @@
 #include <ie_icnn_network.hpp>
 #include <ie_icnn_network_stats.hpp>
 #include <cpp/ie_cnn_network.h>
+#include "graph_transformer.h"
 
 namespace InferenceEngine {
 namespace details {
@@ -25,12 +26,15 @@ public:
     }
 
 public:
+    /**
+     * @brief Converts the convolutions having statistics to int8, the layers with the "quantization_level"
+     * parameter set to "FP32" are kept in fp32
+     */
     void NormalizeNetwork(ICNNNetwork& network, ICNNNetworkStats& netStats);
 
 protected:
-    void AddLayerToCNNNetwork(CNNNetwork& net, CNNLayerPtr firstNode, CNNLayerPtr secondNode, CNNLayerPtr nodeToInsert);
-    void AddScaleShiftBeforeAndAfterInt8(CNNNetwork& net);
-    void ConvertToInt8(int maxSign, int maxUnsign, CNNNetwork& net, const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats);
+    void AddScaleShiftBeforeAndAfterInt8(GraphTransformer& transformer);
+    void ConvertToInt8(int maxSign, int maxUnsign, GraphTransformer& transformer, const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats);
     void ScaleDataToInt8(const float* srcData, size_t srcSize, Blob::Ptr int8blob, float maxValue, const std::vector<float>& scales);
 };
 
@@ -59,6 +59,44 @@ public:
         TO_STATUS(_impl->GetMappedTopology(deployedTopology));
     }
 
+    StatusCode GetMemoryFootprint(MemoryFootprint &footprint, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->GetMemoryFootprint(footprint));
+    }
+
+    StatusCode GetMetrics(ExecutableNetworkMetrics &metrics, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->GetMetrics(metrics));
+    }
+
+    StatusCode Reshape(const ICNNNetwork::InputShapes &inputShapes, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->Reshape(inputShapes));
+    }
+
+    StatusCode Trim(bool releaseWeights, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->Trim(releaseWeights));
+    }
+
+    StatusCode StartAsyncRequests(IInferRequest::Ptr *requests, size_t count, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->StartAsyncRequests(std::vector<IInferRequest::Ptr>(requests, requests + count)));
+    }
+
+    StatusCode WaitRequests(IInferRequest::Ptr *requests, size_t count, bool waitAll, int64_t millis_timeout,
+                            size_t *completed, ResponseDesc *resp) noexcept override {
+        size_t index = 0;
+        try {
+            auto status = _impl->WaitRequests(std::vector<IInferRequest::Ptr>(requests, requests + count), waitAll,
+                                               millis_timeout, index);
+            if (completed) *completed = index;
+            return status;
+        } catch (const InferenceEngine::details::InferenceEngineException &iex) {
+            return InferenceEngine::DescriptionBuffer(iex.hasStatus() ? iex.getStatus() : GENERAL_ERROR, resp)
+                    << iex.what();
+        } catch (const std::exception &ex) {
+            return InferenceEngine::DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+        } catch (...) {
+            return InferenceEngine::DescriptionBuffer(UNEXPECTED);
+        }
+    }
+
     StatusCode  QueryState(IMemoryState::Ptr & pState, size_t idx
         , ResponseDesc *resp) noexcept override {
         try {
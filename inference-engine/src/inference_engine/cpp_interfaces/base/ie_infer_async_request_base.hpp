@@ -76,6 +76,19 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode SetROIs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois,
+                       ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetROIs(name, frame, rois));
+    }
+
+    StatusCode SetSequenceStates(const std::vector<SequenceState::Ptr> &sequences, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetSequenceStates(sequences));
+    }
+
+    StatusCode SetRequestedOutputs(const std::vector<std::string> &outputs, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetRequestedOutputs(outputs));
+    }
+
 protected:
     ~InferRequestBase() = default;
 };
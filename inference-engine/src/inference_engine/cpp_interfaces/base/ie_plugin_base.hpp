@@ -77,6 +77,14 @@ public:
         TO_STATUS(_impl->LoadNetwork(executableNetwork, network, config));
     }
 
+    StatusCode LoadNetwork(IExecutableNetwork::Ptr &executableNetwork,
+                           ICNNNetwork &network,
+                           const std::map<std::string, std::string> &config,
+                           const std::shared_ptr<IAllocator> &allocator,
+                           ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->LoadNetwork(executableNetwork, network, config, allocator));
+    }
+
     StatusCode Infer(const Blob &input, Blob &result, ResponseDesc *resp) noexcept override {
         TO_STATUS(_impl->Infer(input, result));
     }
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include "ie_api.h"
 #include "ie_task.hpp"
 
@@ -22,6 +23,17 @@ public:
      *  @return true if succeed to add task, otherwise - false
      */
     virtual bool startTask(Task::Ptr task) = 0;
+
+    /**
+     * @brief Adds the tasks for execution in their order, the executors with a locked queue add them under one lock
+     * @param tasks - the tasks to start
+     * @return the number of the added tasks, the tasks after the first one failed to be added are not started
+     */
+    virtual size_t startTasks(const std::vector<Task::Ptr> &tasks) {
+        size_t started = 0;
+        while (started < tasks.size() && startTask(tasks[started])) started++;
+        return started;
+    }
 };
 
 }  // namespace InferenceEngine
@@ -9,7 +9,10 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <chrono>
+#include <algorithm>
 #include <ie_profiling.hpp>
+#include <ie_trace.hpp>
 #include "details/ie_exception.hpp"
 #include "exception2status.hpp"
 #include "ie_task_synchronizer.hpp"
@@ -31,6 +34,9 @@ Task::Task(std::function<void()> function) : _status(TS_INITIAL), _function(func
 
 Task::Status Task::runNoThrowNoBusyCheck() noexcept {
     IE_PROFILING_AUTO_SCOPE(TaskExecution);
+    static const std::string traceName = "Task";
+    IE_TRACE_SCOPE(traceName, "task");
+    traceQueued();
     try {
         _exceptionPtr = nullptr;
         _function();
@@ -40,6 +46,7 @@ Task::Status Task::runNoThrowNoBusyCheck() noexcept {
         setStatus(TS_ERROR);
     }
     _isTaskDoneCondVar.notify_all();
+    if (_completionSignal) _completionSignal->notify();
     return getStatus();
 }
 
@@ -53,6 +60,16 @@ Task::Status Task::runWithSynchronizer(TaskSynchronizer::Ptr &taskSynchronizer)
 
 Task::Status Task::wait(int64_t millis_timeout) {
     _isOnWait = true;
+    if (_spinTime > 0 && millis_timeout != 0) {
+        int64_t spinTime = millis_timeout < 0 ? _spinTime : std::min<int64_t>(_spinTime, millis_timeout * 1000);
+        auto spinEnd = std::chrono::steady_clock::now() + std::chrono::microseconds(spinTime);
+        Status status = _status;
+        while (status != TS_INITIAL && status != TS_DONE && status != TS_ERROR &&
+               std::chrono::steady_clock::now() < spinEnd) {
+            std::this_thread::yield();
+            status = _status;
+        }
+    }
     std::exception_ptr exceptionPtr;
     try {
         std::unique_lock<std::mutex> lock(_taskStatusMutex);
@@ -76,9 +93,19 @@ bool Task::occupy() {
     std::unique_lock<std::mutex> guard(_taskStatusMutex);
     if (_status == Task::TS_BUSY) return false;
     _status = TS_BUSY;
+    _queuedTime = TraceSink::instance().enabled() ? TraceSink::now() : 0;
     return true;
 }
 
+void Task::traceQueued() {
+    if (_queuedTime != 0 && TraceSink::instance().enabled()) {
+        static const std::string traceName = "Queued";
+        TraceSink::instance().span(traceName, "task", reinterpret_cast<uint64_t>(this), _queuedTime,
+                                   TraceSink::now());
+    }
+    _queuedTime = 0;
+}
+
 Task::Status Task::getStatus() {
     std::unique_lock<std::mutex> guard(_taskStatusMutex);
     return _status;
@@ -5,13 +5,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #include <mutex>
 #include <memory>
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include "ie_api.h"
+#include "ie_iexecutable_network.hpp"
 #include "details/ie_exception.hpp"
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/ie_task_synchronizer.hpp"
@@ -20,6 +25,150 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief The condition variable shared by a group of the tasks, e.g. by the requests of an executable network:
+ * it is notified whenever one of the tasks completes, so a waiter waits for any or all of them without polling
+ */
+class TaskCompletionSignal {
+public:
+    typedef std::shared_ptr<TaskCompletionSignal> Ptr;
+
+    void notify() {
+        // the waiter checks the predicate under the mutex, so the completion cannot slip in between the check
+        // and the wait
+        { std::lock_guard<std::mutex> lock(_mutex); }
+        _condVar.notify_all();
+    }
+
+    /**
+     * @brief Waits until the predicate holds, blocks for millis_timeout at most, if it is not negative
+     * @return the last value of the predicate
+     */
+    template <class Predicate>
+    bool wait(int64_t millis_timeout, Predicate predicate) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (millis_timeout < 0) {
+            _condVar.wait(lock, predicate);
+            return true;
+        }
+        return _condVar.wait_for(lock, std::chrono::milliseconds(millis_timeout), predicate);
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condVar;
+};
+
+/**
+ * @brief Counts one of the latencies of the inferences into the buckets of LatencyHistogram, the requests running
+ * on any thread add to it without a lock
+ */
+class LatencyCounter {
+public:
+    LatencyCounter() {
+        for (auto &bucket : _buckets) bucket = 0;
+    }
+
+    void add(std::chrono::steady_clock::duration time) {
+        auto micros = std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+        uint64_t value = micros > 0 ? static_cast<uint64_t>(micros) : 0;
+        size_t bucket = 0;
+        for (uint64_t rest = value >> 1; rest != 0 && bucket + 1 < LatencyHistogram::BucketsCount; rest >>= 1)
+            bucket++;
+        _buckets[bucket]++;
+        _totalMicros += value;
+        _count++;
+        uint64_t max = _maxMicros;
+        while (value > max && !_maxMicros.compare_exchange_weak(max, value)) {}
+    }
+
+    /**
+     * @brief Returns the average latency in microseconds, 0 if none is measured
+     */
+    double averageMicros() const {
+        uint64_t count = _count;
+        return count == 0 ? 0. : static_cast<double>(_totalMicros) / count;
+    }
+
+    /**
+     * @brief Returns the histogram, the latencies added meanwhile may be counted partially
+     */
+    LatencyHistogram histogram() const {
+        LatencyHistogram histogram;
+        for (size_t i = 0; i < LatencyHistogram::BucketsCount; i++) {
+            histogram.buckets[i] = _buckets[i];
+            histogram.count += histogram.buckets[i];
+        }
+        histogram.averageMicros = averageMicros();
+        histogram.maxMicros = _maxMicros;
+        return histogram;
+    }
+
+private:
+    std::atomic<uint64_t> _buckets[LatencyHistogram::BucketsCount];
+    std::atomic<uint64_t> _totalMicros{0};
+    std::atomic<uint64_t> _count{0};
+    std::atomic<uint64_t> _maxMicros{0};
+};
+
+/**
+ * @brief The latencies of the inferences of a group of the requests, e.g. of the requests of an executable network,
+ * and the number of its requests in every phase of an inference. The requests add the latencies of every inference
+ * they run and move between the phases.
+ */
+class ExecutionStatistics {
+public:
+    typedef std::shared_ptr<ExecutionStatistics> Ptr;
+
+    enum Phase {
+        Idle,
+        // started and waiting for the executor, the pre-processing ahead of the inference included
+        Queued,
+        Running,
+        // completed and waiting for the callback or running it
+        Callback,
+        PhasesCount
+    };
+
+    ExecutionStatistics() {
+        for (auto &requests : _requests) requests = 0;
+    }
+
+    void add(std::chrono::steady_clock::duration time) {
+        execution.add(time);
+    }
+
+    /**
+     * @brief Returns the average time of an inference in microseconds, 0 if none is completed
+     */
+    double averageMicros() const {
+        return execution.averageMicros();
+    }
+
+    void move(Phase from, Phase to) {
+        if (from == to) return;
+        if (from != Idle) _requests[from]--;
+        if (to != Idle) _requests[to]++;
+    }
+
+    /**
+     * @brief Returns the number of the requests in the phase, the idle ones are not counted
+     */
+    unsigned int requests(Phase phase) const {
+        return phase == Idle ? 0 : static_cast<unsigned int>(std::max(_requests[phase].load(), 0));
+    }
+
+    // StartAsync -> the start of the inference
+    LatencyCounter queue;
+    // the start -> the completion of the inference
+    LatencyCounter execution;
+    // the completion of the inference -> the start of the callback
+    LatencyCounter callback;
+
+private:
+    std::atomic<int> _requests[PhasesCount];
+};
+
 class INFERENCE_ENGINE_API_CLASS(Task) {
 public:
     typedef std::shared_ptr<Task> Ptr;
@@ -82,17 +231,53 @@ public:
 
     bool isOnWait();
 
+    /**
+     * @brief Sets the priority of the task: the executors supporting the priorities (TaskExecutor) run the queued
+     * task of the highest priority first, the tasks of the same priority are run in FIFO order
+     */
+    void setPriority(int priority) {
+        _priority = priority;
+    }
+
+    int getPriority() const {
+        return _priority;
+    }
+
+    /**
+     * @brief Sets the signal notified after the task completes, in addition to the waiters of the task itself
+     */
+    void setCompletionSignal(const TaskCompletionSignal::Ptr &signal) {
+        _completionSignal = signal;
+    }
+
+    /**
+     * @brief Sets the time the waiters spin on the status of the task before they block on the condition variable,
+     * so a short task completes without the wake-up of the waiting thread
+     * @param micros - the spin time in microseconds, 0 (default) blocks at once
+     */
+    void setSpinTime(int micros) {
+        _spinTime = micros;
+    }
+
 protected:
     void setStatus(Status status);
 
+    // records the time the task waited in the queue of the executor, if the trace sink is enabled
+    void traceQueued();
+
 protected:
     std::function<void()> _function;
-    Status _status;
+    std::atomic<Status> _status;
     std::exception_ptr _exceptionPtr = nullptr;
     std::mutex _taskStatusMutex;
     std::condition_variable _isTaskDoneCondVar;
 
-    bool _isOnWait = false;
+    std::atomic<bool> _isOnWait = {false};
+    // the time the task was queued to an executor, recorded while the trace sink is enabled
+    uint64_t _queuedTime = 0;
+    int _priority = 0;
+    TaskCompletionSignal::Ptr _completionSignal;
+    int _spinTime = 0;
 };
 
 }  // namespace InferenceEngine
@@ -9,7 +9,8 @@
 #include <mutex>
 #include <condition_variable>
 #include <thread>
-#include <queue>
+#include <deque>
+#include <algorithm>
 #include <ie_profiling.hpp>
 #include "details/ie_exception.hpp"
 #include "ie_task.hpp"
@@ -17,33 +18,58 @@
 
 namespace InferenceEngine {
 
+namespace {
+// the executor, which owns the calling thread
+thread_local TaskExecutor *currentExecutor = nullptr;
+}  // namespace
+
 TaskExecutor::TaskExecutor(std::string name) : _isStopped(false), _name(name) {
     _thread = std::make_shared<std::thread>([&] {
-        while (!_isStopped) {
-            bool isQueueEmpty;
+        currentExecutor = this;
+        while (true) {
             Task::Ptr currentTask;
             {  // waiting for the new task or for stop signal
                 std::unique_lock<std::mutex> lock(_queueMutex);
                 _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
-                isQueueEmpty = _taskQueue.empty();
-                if (!isQueueEmpty) currentTask = _taskQueue.front();
-            }
-            if (_isStopped && isQueueEmpty)
-                break;
-            if (!isQueueEmpty) {
-                currentTask->runNoThrowNoBusyCheck();
-                std::unique_lock<std::mutex> lock(_queueMutex);
-                _taskQueue.pop();
-                isQueueEmpty = _taskQueue.empty();
-                if (isQueueEmpty) {
-                    // notify dtor, that all tasks were completed
-                    _queueCondVar.notify_all();
-                }
+                if (_taskQueue.empty())
+                    break;
+                currentTask = popTask();
             }
+            currentTask->runNoThrowNoBusyCheck();
         }
     });
 }
 
+Task::Ptr TaskExecutor::popTask() {
+    Task::Ptr task = _taskQueue.front();
+    _taskQueue.pop_front();
+    if (_taskQueue.empty()) {
+        // notify dtor, that all tasks were started, it joins the thread running the last one
+        _queueCondVar.notify_all();
+    }
+    return task;
+}
+
+bool TaskExecutor::preempt(int priority) {
+    TaskExecutor *executor = currentExecutor;
+    if (executor == nullptr)
+        return false;
+    bool preempted = false;
+    while (true) {
+        Task::Ptr task;
+        {
+            std::unique_lock<std::mutex> lock(executor->_queueMutex);
+            if (executor->_taskQueue.empty() || executor->_taskQueue.front()->getPriority() <= priority)
+                break;
+            task = executor->popTask();
+        }
+        // the preempting task may be preempted in turn by the tasks of a yet higher priority only
+        task->runNoThrowNoBusyCheck();
+        preempted = true;
+    }
+    return preempted;
+}
+
 TaskExecutor::~TaskExecutor() {
     {
         std::unique_lock<std::mutex> lock(_queueMutex);
@@ -59,12 +85,32 @@ TaskExecutor::~TaskExecutor() {
     }
 }
 
+void TaskExecutor::pushTask(const Task::Ptr &task) {
+    // after the queued tasks of the same or higher priority
+    auto position = std::find_if(_taskQueue.begin(), _taskQueue.end(), [&](const Task::Ptr &queued) {
+        return queued->getPriority() < task->getPriority();
+    });
+    _taskQueue.insert(position, task);
+}
+
 bool TaskExecutor::startTask(Task::Ptr task) {
     if (!task->occupy()) return false;
     std::unique_lock<std::mutex> lock(_queueMutex);
-    _taskQueue.push(task);
+    pushTask(task);
     _queueCondVar.notify_all();
     return true;
 }
 
+size_t TaskExecutor::startTasks(const std::vector<Task::Ptr> &tasks) {
+    size_t started = 0;
+    while (started < tasks.size() && tasks[started]->occupy()) started++;
+    if (started == 0) return 0;
+    std::unique_lock<std::mutex> lock(_queueMutex);
+    for (size_t i = 0; i < started; i++) {
+        pushTask(tasks[i]);
+    }
+    _queueCondVar.notify_all();
+    return started;
+}
+
 }  // namespace InferenceEngine
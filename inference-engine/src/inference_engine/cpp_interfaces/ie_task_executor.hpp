@@ -11,7 +11,7 @@
 #include <mutex>
 #include <condition_variable>
 #include <thread>
-#include <queue>
+#include <deque>
 #include "ie_api.h"
 #include "details/ie_exception.hpp"
 #include "cpp_interfaces/ie_task_synchronizer.hpp"
@@ -31,17 +31,36 @@ public:
 
     /**
      * @brief Add task for execution and notify working thread about new task to start.
-     * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one in FIFO mode.
+     * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one,
+     * the tasks of the higher priority (Task::setPriority) first and the tasks of the same priority in FIFO mode.
      * @param task - shared pointer to the task to start
      *  @return true if succeed to add task, otherwise - false
      */
     bool startTask(Task::Ptr task) override;
 
+    size_t startTasks(const std::vector<Task::Ptr> &tasks) override;
+
+    /**
+     * @brief Runs the queued tasks of a priority higher than the given one on the calling thread, if it is the
+     * working thread of a TaskExecutor. The long running tasks call it at their safe points (e.g. between the nodes
+     * of a graph) to let the tasks of the higher priority preempt them.
+     * @param priority - the priority of the calling task
+     * @return true if any task was run
+     */
+    static bool preempt(int priority);
+
 private:
+    // takes the first task of the queue, the queue mutex is to be held
+    Task::Ptr popTask();
+
+    // inserts the task after the queued tasks of the same or higher priority, the queue mutex is to be held
+    void pushTask(const Task::Ptr &task);
+
     std::shared_ptr<std::thread> _thread;
     std::mutex _queueMutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task::Ptr> _taskQueue;
+    // ordered by the priority of the tasks
+    std::deque<Task::Ptr> _taskQueue;
     bool _isStopped;
     std::string _name;
 };
@@ -10,6 +10,7 @@
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/ie_task.hpp"
 #include "cpp_interfaces/ie_task_with_stages.hpp"
+#include "ie_trace.hpp"
 
 namespace InferenceEngine {
 
@@ -22,6 +23,9 @@ StagedTask::StagedTask(std::function<void()> function, size_t stages) : Task(fun
 
 Task::Status StagedTask::runNoThrowNoBusyCheck() noexcept {
     std::lock_guard<std::mutex> lock(_runMutex);
+    traceQueued();
+    uint64_t traceBegin = TraceSink::instance().enabled() ? TraceSink::now() : 0;
+    size_t stage = _stages - _stage;
     try {
         _exceptionPtr = nullptr;
         if (_stage) {
@@ -36,8 +40,12 @@ Task::Status StagedTask::runNoThrowNoBusyCheck() noexcept {
         setStatus(TS_ERROR);
     }
 
+    if (traceBegin != 0 && TraceSink::instance().enabled())
+        TraceSink::instance().complete("Stage " + std::to_string(stage), "task", traceBegin, TraceSink::now());
+
     if (_status != TS_POSTPONED) {
         _isTaskDoneCondVar.notify_all();
+        if (_completionSignal) _completionSignal->notify();
     }
     return getStatus();
 }
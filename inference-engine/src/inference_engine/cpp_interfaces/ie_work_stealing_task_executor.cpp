@@ -0,0 +1,115 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include "details/ie_exception.hpp"
+#include "ie_work_stealing_task_executor.hpp"
+
+namespace InferenceEngine {
+
+WorkStealingTaskExecutor::WorkStealingTaskExecutor(size_t workersNum, std::string name) :
+        _nextWorker(0), _queuedTasks(0), _idleWorkers(0), _isStopped(false), _initCount(0), _name(name) {
+    if (workersNum == 0)
+        workersNum = std::max(1u, std::thread::hardware_concurrency());
+    startWorkers(std::vector<Task::Ptr>(workersNum));
+}
+
+WorkStealingTaskExecutor::WorkStealingTaskExecutor(const std::vector<Task::Ptr> &initTasks, std::string name) :
+        _nextWorker(0), _queuedTasks(0), _idleWorkers(0), _isStopped(false), _initCount(0), _name(name) {
+    if (initTasks.empty())
+        THROW_IE_EXCEPTION << "Task executor " << _name << " must have at least one worker";
+    startWorkers(initTasks);
+}
+
+void WorkStealingTaskExecutor::startWorkers(const std::vector<Task::Ptr> &initTasks) {
+    // all the queues exist before any worker may try to steal from them
+    for (size_t i = 0; i < initTasks.size(); i++) {
+        _workers.emplace_back(new Worker());
+    }
+    for (size_t i = 0; i < initTasks.size(); i++) {
+        _workers[i]->thread = std::thread(&WorkStealingTaskExecutor::run, this, i, initTasks[i]);
+    }
+    // waiting for all the workers to complete their initialization
+    std::unique_lock<std::mutex> lock(_idleMutex);
+    _idleCondVar.wait(lock, [&]() { return _initCount == initTasks.size(); });
+}
+
+WorkStealingTaskExecutor::~WorkStealingTaskExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(_idleMutex);
+        _isStopped = true;
+    }
+    _idleCondVar.notify_all();
+    // the workers leave only when all the queues are empty
+    for (auto &worker : _workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+void WorkStealingTaskExecutor::run(size_t workerId, const Task::Ptr &initTask) {
+    if (initTask) {
+        initTask->runNoThrowNoBusyCheck();
+    }
+    {
+        std::lock_guard<std::mutex> lock(_idleMutex);
+        _initCount++;
+    }
+    _idleCondVar.notify_all();
+
+    while (true) {
+        Task::Ptr task = popTask(workerId);
+        if (task) {
+            task->runNoThrowNoBusyCheck();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_idleMutex);
+        // the counter of the idle workers is changed before the check of the queued tasks, while startTask()
+        // does it the other way round, so either the worker sees the new task or the task wakes the worker up
+        _idleWorkers++;
+        _idleCondVar.wait(lock, [&]() { return _queuedTasks > 0 || _isStopped; });
+        _idleWorkers--;
+        if (_isStopped && _queuedTasks <= 0)
+            break;
+    }
+}
+
+Task::Ptr WorkStealingTaskExecutor::popTask(size_t workerId) {
+    // the own queue goes first, then the others starting from the neighbour
+    for (size_t i = 0; i < _workers.size(); i++) {
+        Worker &worker = *_workers[(workerId + i) % _workers.size()];
+        std::lock_guard<std::mutex> lock(worker.queueMutex);
+        if (!worker.taskQueue.empty()) {
+            Task::Ptr task = worker.taskQueue.front();
+            worker.taskQueue.pop_front();
+            _queuedTasks--;
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+bool WorkStealingTaskExecutor::startTask(Task::Ptr task) {
+    if (!task->occupy()) return false;
+    Worker &worker = *_workers[_nextWorker++ % _workers.size()];
+    {
+        std::lock_guard<std::mutex> lock(worker.queueMutex);
+        worker.taskQueue.push_back(task);
+    }
+    _queuedTasks++;
+    if (_idleWorkers > 0) {
+        std::lock_guard<std::mutex> lock(_idleMutex);
+        _idleCondVar.notify_one();
+    }
+    return true;
+}
+
+}  // namespace InferenceEngine
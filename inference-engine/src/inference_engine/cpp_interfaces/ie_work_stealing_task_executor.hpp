@@ -0,0 +1,85 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ie_api.h"
+#include "cpp_interfaces/ie_task.hpp"
+#include "cpp_interfaces/ie_itask_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class WorkStealingTaskExecutor
+ * @brief Task executor with a pool of worker threads, each with its own task queue.
+ * The started tasks are spread over the queues of the workers in round-robin order, so the concurrent
+ * startTask() calls rarely compete for the same lock. A worker executes the tasks of its own queue first
+ * and steals the oldest tasks from the queues of the other workers when its own queue is empty.
+ * The tasks are executed in parallel, so the executor suits only the tasks that do not share state.
+ */
+class INFERENCE_ENGINE_API_CLASS(WorkStealingTaskExecutor) : public ITaskExecutor {
+public:
+    typedef std::shared_ptr<WorkStealingTaskExecutor> Ptr;
+
+    /**
+     * @brief Creates the executor with the given number of workers
+     * @param workersNum - number of the worker threads, 0 means the number of hardware threads
+     * @param name - name of the executor
+     */
+    explicit WorkStealingTaskExecutor(size_t workersNum = 0, std::string name = "Default");
+
+    /**
+     * @brief Creates the executor with a worker per initialization task.
+     * Every worker executes its initialization task before any other one, the constructor returns when all
+     * the initialization tasks are completed.
+     * @param initTasks - initialization tasks of the workers
+     * @param name - name of the executor
+     */
+    explicit WorkStealingTaskExecutor(const std::vector<Task::Ptr> &initTasks, std::string name = "Default");
+
+    /**
+     * @brief Waits for all the started tasks to complete and stops the workers
+     */
+    ~WorkStealingTaskExecutor();
+
+    /**
+     * @brief Adds task for execution to the queue of the next worker and wakes up an idle worker if any.
+     * @note can be called from multiple threads, the tasks are executed in parallel
+     * @param task - shared pointer to the task to start
+     * @return true if succeed to add task, otherwise - false
+     */
+    bool startTask(Task::Ptr task) override;
+
+private:
+    struct Worker {
+        std::mutex queueMutex;
+        std::deque<Task::Ptr> taskQueue;
+        std::thread thread;
+    };
+
+    void startWorkers(const std::vector<Task::Ptr> &initTasks);
+    void run(size_t workerId, const Task::Ptr &initTask);
+    Task::Ptr popTask(size_t workerId);
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::atomic<size_t> _nextWorker;
+    std::atomic<int> _queuedTasks;
+    std::atomic<int> _idleWorkers;
+    std::atomic<bool> _isStopped;
+    std::atomic<size_t> _initCount;
+    std::mutex _idleMutex;
+    std::condition_variable _idleCondVar;
+    std::string _name;
+};
+
+}  // namespace InferenceEngine
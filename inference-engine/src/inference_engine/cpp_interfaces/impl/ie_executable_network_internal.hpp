@@ -9,6 +9,8 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <chrono>
+#include <algorithm>
 #include <ie_plugin_ptr.hpp>
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
@@ -60,6 +62,22 @@ public:
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
 
+    void GetMemoryFootprint(MemoryFootprint &footprint) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    void GetMetrics(ExecutableNetworkMetrics &metrics) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    void Reshape(const ICNNNetwork::InputShapes &inputShapes) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    void Trim(bool releaseWeights) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
     void SetPointerToPluginInternal(InferencePluginInternalPtr plugin) {
         _plugin = plugin;
     }
@@ -69,8 +87,78 @@ public:
         return {};
     }
 
+    void StartAsyncRequests(const std::vector<IInferRequest::Ptr> &requests) override {
+        for (const auto &request : requests) {
+            startRequest(request);
+        }
+    }
+
+    StatusCode WaitRequests(const std::vector<IInferRequest::Ptr> &requests, bool waitAll, int64_t millis_timeout,
+                            size_t &completed) override {
+        // without a completion signal shared by the requests only all of them can be awaited, one by one
+        if (!waitAll) THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+        checkWaitTimeout(millis_timeout);
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(std::max<int64_t>(millis_timeout, 0));
+        StatusCode merged = INFER_NOT_STARTED;
+        for (const auto &request : requests) {
+            if (!request) THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "The request to wait for is null";
+            int64_t timeout = millis_timeout;
+            if (millis_timeout > 0) {
+                auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        deadline - std::chrono::steady_clock::now());
+                timeout = std::max<int64_t>(left.count(), 0);
+            }
+            ResponseDesc resp;
+            merged = mergeWaitStatus(merged, request->Wait(timeout, &resp));
+        }
+        return merged;
+    }
+
 
 protected:
+    static void startRequest(const IInferRequest::Ptr &request) {
+        if (!request) THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "The request to start is null";
+        ResponseDesc resp;
+        auto status = request->StartAsync(&resp);
+        if (status != OK) THROW_IE_EXCEPTION << details::as_status << status << resp.msg;
+    }
+
+    static void checkWaitTimeout(int64_t millis_timeout) {
+        if (millis_timeout < IInferRequest::WaitMode::RESULT_READY) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Timeout can't be less "
+                               << IInferRequest::WaitMode::RESULT_READY << " for the wait for the requests";
+        }
+    }
+
+    /**
+     * @brief Merges the statuses of the awaited requests: a not ready request wins over a failed one, which wins
+     * over the succeeded ones, the requests not started are skipped
+     */
+    static StatusCode mergeWaitStatus(StatusCode merged, StatusCode status) {
+        if (status == INFER_NOT_STARTED || merged == RESULT_NOT_READY) return merged;
+        if (status == RESULT_NOT_READY || merged == INFER_NOT_STARTED || merged == OK) return status;
+        return merged;
+    }
+
+    /**
+     * @brief Returns the size of the inputs and outputs of the network in bytes
+     */
+    size_t GetIOBytes() const {
+        auto bytes = [](const TensorDesc &desc) {
+            size_t size = desc.getPrecision().size();
+            for (auto dim : desc.getDims())
+                size *= dim;
+            return size;
+        };
+        size_t total = 0;
+        for (const auto &input : _networkInputs)
+            total += bytes(input.second->getInputData()->getTensorDesc());
+        for (const auto &output : _networkOutputs)
+            total += bytes(output.second->getTensorDesc());
+        return total;
+    }
+
     InferenceEngine::InputsDataMap _networkInputs;
     InferenceEngine::OutputsDataMap _networkOutputs;
 
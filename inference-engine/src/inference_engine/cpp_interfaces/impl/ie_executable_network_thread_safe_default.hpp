@@ -9,11 +9,14 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <mutex>
+#include <utility>
 #include "cpp_interfaces/base/ie_infer_async_request_base.hpp"
 #include "cpp_interfaces/impl/ie_executable_network_internal.hpp"
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
 #include "cpp_interfaces/ie_task_executor.hpp"
+#include "cpp_interfaces/ie_work_stealing_task_executor.hpp"
 
 namespace InferenceEngine {
 
@@ -26,6 +29,30 @@ public:
         _taskSynchronizer = std::make_shared<TaskSynchronizer>();
         _taskExecutor = std::make_shared<TaskExecutor>();
         _callbackExecutor = std::make_shared<TaskExecutor>();
+        _completionSignal = std::make_shared<TaskCompletionSignal>();
+        _statistics = std::make_shared<ExecutionStatistics>();
+    }
+
+    /**
+     * @brief Given optional implementation of the metrics: the queue depth, the request counts and the latencies of
+     * the requests created by the network, a single stream and request, the plugins executing several requests at
+     * once override the rest
+     */
+    void GetMetrics(ExecutableNetworkMetrics &metrics) override {
+        metrics = ExecutableNetworkMetrics();
+        metrics.averageExecutionTime = _statistics->averageMicros();
+        metrics.queuedRequests = _statistics->requests(ExecutionStatistics::Queued);
+        metrics.runningRequests = _statistics->requests(ExecutionStatistics::Running);
+        metrics.callbackRequests = _statistics->requests(ExecutionStatistics::Callback);
+        metrics.queueLatency = _statistics->queue.histogram();
+        metrics.executionLatency = _statistics->execution.histogram();
+        metrics.callbackLatency = _statistics->callback.histogram();
+        std::lock_guard<std::mutex> lock(_requestsMutex);
+        for (auto &request : _requests) {
+            auto impl = request.second.lock();
+            if (impl && impl->GetTaskStatus() == Task::Status::TS_BUSY)
+                metrics.queueDepth++;
+        }
     }
 
     /**
@@ -43,15 +70,185 @@ public:
         syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
         auto asyncTreadSafeImpl = std::make_shared<AsyncInferRequestThreadSafeDefault>(
                 syncRequestImpl, _taskExecutor, _taskSynchronizer, _callbackExecutor);
+        asyncTreadSafeImpl->SetPriority(_requestPriority);
+        asyncTreadSafeImpl->SetPreprocessExecutor(_preprocessExecutor);
         asyncRequest.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncTreadSafeImpl),
                            [](IInferRequest *p) { p->Release(); });
         asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+        registerRequest(asyncRequest, asyncTreadSafeImpl);
+    }
+
+    /**
+     * @brief Prepares all the requests created by the network first and queues their tasks at once, per executor
+     */
+    void StartAsyncRequests(const std::vector<IInferRequest::Ptr> &requests) override {
+        struct Queue {
+            ITaskExecutor::Ptr executor;
+            std::vector<Task::Ptr> tasks;
+            std::vector<AsyncInferRequestThreadSafeDefault::Ptr> requests;
+        };
+        std::vector<Queue> queues;
+        std::exception_ptr error;
+        try {
+            for (const auto &request : requests) {
+                auto impl = findRequest(request);
+                if (!impl) {
+                    startRequest(request);
+                    continue;
+                }
+                ITaskExecutor::Ptr executor;
+                auto task = impl->PrepareStartAsync(executor);
+                if (!task) continue;
+                auto queue = std::find_if(queues.begin(), queues.end(), [&](const Queue &queue) {
+                    return queue.executor == executor;
+                });
+                if (queue == queues.end()) {
+                    queues.push_back({executor, {}, {}});
+                    queue = queues.end() - 1;
+                }
+                queue->tasks.push_back(task);
+                queue->requests.push_back(impl);
+            }
+        } catch (...) {
+            // the requests prepared before the failed one are started anyway
+            error = std::current_exception();
+        }
+        bool busy = false;
+        for (auto &queue : queues) {
+            for (size_t i = queue.executor->startTasks(queue.tasks); i < queue.tasks.size(); i++) {
+                queue.requests[i]->CancelStartAsync();
+                busy = true;
+            }
+        }
+        if (error) std::rethrow_exception(error);
+        if (busy) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+    }
+
+    /**
+     * @brief Waits on the completion signal of the network, which the requests notify on every completed inference
+     */
+    StatusCode WaitRequests(const std::vector<IInferRequest::Ptr> &requests, bool waitAll, int64_t millis_timeout,
+                            size_t &completed) override {
+        std::vector<AsyncInferRequestThreadSafeDefault::Ptr> impls;
+        for (const auto &request : requests) {
+            auto impl = findRequest(request);
+            if (!impl) return ExecutableNetworkInternal::WaitRequests(requests, waitAll, millis_timeout, completed);
+            impls.push_back(impl);
+        }
+        checkWaitTimeout(millis_timeout);
+
+        bool started = false;
+        auto ready = [&]() -> bool {
+            started = false;
+            bool all = true;
+            for (size_t i = 0; i < impls.size(); i++) {
+                auto status = impls[i]->GetTaskStatus();
+                if (status == Task::Status::TS_INITIAL) continue;
+                started = true;
+                bool done = status == Task::Status::TS_DONE || status == Task::Status::TS_ERROR;
+                if (done && !waitAll) {
+                    completed = i;
+                    return true;
+                }
+                all = all && done;
+            }
+            // nothing to wait for if none of the requests was started
+            return !started || (waitAll && all);
+        };
+        bool isReady = _completionSignal->wait(millis_timeout, ready);
+        if (!started) return INFER_NOT_STARTED;
+        if (!isReady) return RESULT_NOT_READY;
+
+        // the completed requests are released by their own wait, which returns at once
+        StatusCode merged = INFER_NOT_STARTED;
+        for (size_t i = 0; i < impls.size(); i++) {
+            if (!waitAll && i != completed) continue;
+            StatusCode status;
+            try {
+                status = impls[i]->Wait(IInferRequest::WaitMode::RESULT_READY);
+            } catch (...) {
+                status = GENERAL_ERROR;
+            }
+            merged = mergeWaitStatus(merged, status);
+        }
+        return merged;
+    }
+
+    /**
+     * @brief Given optional implementation of the trimming: it fails with REQUEST_BUSY while some of the requests of
+     * the network infer and lets the plugin release the memory otherwise (see TrimImpl). The requests must not be
+     * started until it returns. The requests are checked and the memory is released under the lock of the requests,
+     * so no request is created in between.
+     */
+    void Trim(bool releaseWeights) override {
+        std::lock_guard<std::mutex> lock(_requestsMutex);
+        for (auto &request : _requests) {
+            auto impl = request.second.lock();
+            if (impl && impl->IsBusy())
+                THROW_IE_EXCEPTION << details::as_status << REQUEST_BUSY << REQUEST_BUSY_str
+                                   << "The memory of the network cannot be trimmed while its requests infer";
+        }
+        TrimImpl(releaseWeights);
     }
 
 protected:
+    /**
+     * @brief Releases the memory of the idle network, the next inference allocates it again
+     * @param releaseWeights - true to release also the networks compiled for the other shapes of the inputs
+     */
+    virtual void TrimImpl(bool releaseWeights) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    /**
+     * @brief Lets the requests created by the network be started and awaited in groups (see StartAsyncRequests and
+     * WaitRequests), the networks creating their own requests register them too
+     */
+    void registerRequest(const IInferRequest::Ptr &asyncRequest, const AsyncInferRequestThreadSafeDefault::Ptr &impl) {
+        impl->SetCompletionSignal(_completionSignal);
+        impl->SetStatistics(_statistics);
+        std::lock_guard<std::mutex> lock(_requestsMutex);
+        for (auto it = _requests.begin(); it != _requests.end();) {
+            it = it->second.expired() ? _requests.erase(it) : std::next(it);
+        }
+        _requests[asyncRequest.get()] = impl;
+    }
+
+    AsyncInferRequestThreadSafeDefault::Ptr findRequest(const IInferRequest::Ptr &request) {
+        std::lock_guard<std::mutex> lock(_requestsMutex);
+        auto it = _requests.find(request.get());
+        return it == _requests.end() ? nullptr : it->second.lock();
+    }
+
+    /**
+     * @brief Sets the number of the threads the completion callbacks of the requests run on (KEY_CALLBACK_THREADS):
+     * 0 runs them inline on the inference threads, 1 (default) on a single thread, more on a pool of the threads
+     */
+    void setCallbackThreads(int threads) {
+        if (threads < 0) THROW_IE_EXCEPTION << "The number of the callback threads must not be negative";
+        if (threads == 0) {
+            _callbackExecutor = nullptr;
+        } else if (threads == 1) {
+            _callbackExecutor = std::make_shared<TaskExecutor>();
+        } else {
+            _callbackExecutor = std::make_shared<WorkStealingTaskExecutor>(static_cast<size_t>(threads), "Callbacks");
+        }
+    }
+
     TaskSynchronizer::Ptr _taskSynchronizer;
     ITaskExecutor::Ptr _taskExecutor = nullptr;
     ITaskExecutor::Ptr _callbackExecutor = nullptr;
+    // the pre-processing of the inputs of the asynchronous inferences, nullptr runs it within the inference
+    ITaskExecutor::Ptr _preprocessExecutor = nullptr;
+    // the priority of the asynchronous inferences of the network in the executors shared with other networks
+    int _requestPriority = 0;
+
+    // the requests created by the network by their public interface, all of them notify the completion signal
+    std::map<IInferRequest *, std::weak_ptr<AsyncInferRequestThreadSafeDefault>> _requests;
+    std::mutex _requestsMutex;
+    TaskCompletionSignal::Ptr _completionSignal;
+    // the execution times of the inferences of the registered requests
+    ExecutionStatistics::Ptr _statistics;
 };
 
 }  // namespace InferenceEngine
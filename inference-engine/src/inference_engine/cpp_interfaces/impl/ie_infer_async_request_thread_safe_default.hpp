@@ -7,10 +7,12 @@
 
 #include <memory>
 #include <map>
-#include <list>
+#include <vector>
 #include <string>
 #include <mutex>
 #include <exception>
+#include <chrono>
+#include <atomic>
 #include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
 #include <cpp_interfaces/ie_task_with_stages.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
@@ -21,6 +23,8 @@ namespace InferenceEngine {
 
 /**
  * @class CallbackManager for wrapping calling of callback
+ * @brief The callbacks run on the callback executor, the null executor runs them inline on the thread that completed
+ * the inference
  */
 class CallbackManager {
     std::exception_ptr _requestException = nullptr;
@@ -47,6 +51,8 @@ public:
 
     void startTask(Task::Ptr task) { _callbackExecutor->startTask(task); }
 
+    bool isInline() const { return _callbackExecutor == nullptr; }
+
     void reset() {
         _requestException = nullptr;
         _requestStatus = OK;
@@ -93,28 +99,30 @@ public:
               _requestExecutor(taskExecutor),
               _requestSynchronizer(taskSynchronizer),
               _callbackManager(callbackExecutor) {
-        _syncTask = std::make_shared<Task>([this]() { _syncRequest->Infer(); });
+        _syncTask = std::make_shared<Task>([this]() { inferTimed(); });
         _currentTask = _syncTask;
+        _asyncTasks.reserve(2);
     }
 
     virtual ~AsyncInferRequestThreadSafeDefault() {
         waitAllAsyncTasks();
+        setPhase(ExecutionStatistics::Idle);
     }
 
     void waitAllAsyncTasks() {
         try {
-            while (!_listAsyncTasks.empty()) {
-                _listAsyncTasks.remove_if([this](StagedTask::Ptr task) -> bool {
-                    auto sts = task->getStatus();
-                    return !task->isOnWait() && (Task::Status::TS_DONE == sts || Task::Status::TS_ERROR == sts ||
-                                                 Task::Status::TS_INITIAL == sts);
-                });
-                auto findIter = std::find_if(_listAsyncTasks.begin(), _listAsyncTasks.end(),
-                                             [this](StagedTask::Ptr task) { return !task->isOnWait(); });
-                if (findIter != _listAsyncTasks.end()) {
-                    try {
-                        (*findIter)->wait(-1);
-                    } catch (...) {}
+            // the callbacks may start the next inferences while the tasks are awaited
+            bool waited = true;
+            while (waited) {
+                waited = false;
+                for (size_t i = 0; i < _asyncTasks.size(); i++) {
+                    auto task = _asyncTasks[i];
+                    if (!task->isOnWait() && !isAsyncTaskFree(task)) {
+                        try {
+                            task->wait(-1);
+                        } catch (...) {}
+                        waited = true;
+                    }
                 }
             }
         } catch (...) {}
@@ -124,44 +132,173 @@ public:
         IE_PROFILING_AUTO_SCOPE(initNextAsyncTask)
         // Most probably was called from callback (or when callback was started) or it was a sync task before, so new task is required
         if (_currentTask->getStatus() == Task::Status::TS_POSTPONED || _currentTask == _syncTask) {
-            auto findIter = std::find_if(_listAsyncTasks.begin(), _listAsyncTasks.end(),
-                                         [this](StagedTask::Ptr task) -> bool {
-                                             return (!task->isOnWait()) && (task != _currentTask) &&
-                                                    (Task::Status::TS_DONE == task->getStatus() ||
-                                                     Task::Status::TS_ERROR == task->getStatus());
-                                         });
-            if (findIter == _listAsyncTasks.end()) {
-                _asyncTask = createAsyncRequestTask();
-                _listAsyncTasks.push_back(_asyncTask);
-            } else {
-                _asyncTask = *findIter;
-            }
+            _asyncTask = nextFreeAsyncTask();
         }
         _asyncTask->resetStages();
+        // without the pre-processing stage the task starts right from the inference one
+        if (!preprocessesAhead()) _asyncTask->stageDone();
         _currentTask = _asyncTask;
     }
 
+    /**
+     * @brief Whether the next asynchronous inference pre-processes the inputs as a separate stage on the
+     * pre-processing executor, so it overlaps with the inference of the previous request on the request executor
+     */
+    bool preprocessesAhead() const {
+        return _preprocessExecutor != nullptr && _syncRequest->HasPreprocessing();
+    }
+
+    /**
+     * @brief Returns the executor the first stage of the current asynchronous task is queued to
+     */
+    ITaskExecutor::Ptr firstStageExecutor() const {
+        return _asyncTask->getStage() == 3 ? _preprocessExecutor : _requestExecutor;
+    }
+
+    /**
+     * @brief Returns the task for the next asynchronous inference. The tasks are created once per request and are
+     * reused in turn, a new one is created only if all of them are still running the callbacks or are awaited.
+     */
+    StagedTask::Ptr nextFreeAsyncTask() {
+        for (size_t i = 0; i < _asyncTasks.size(); i++) {
+            _nextAsyncTask = (_nextAsyncTask + 1) % _asyncTasks.size();
+            const auto &task = _asyncTasks[_nextAsyncTask];
+            if (task != _currentTask && !task->isOnWait() && isAsyncTaskFree(task)) return task;
+        }
+        _asyncTasks.push_back(createAsyncRequestTask());
+        _asyncTasks.back()->setCompletionSignal(_completionSignal);
+        _asyncTasks.back()->setSpinTime(_spinTime);
+        _nextAsyncTask = _asyncTasks.size() - 1;
+        return _asyncTasks.back();
+    }
+
+    static bool isAsyncTaskFree(const StagedTask::Ptr &task) {
+        auto sts = task->getStatus();
+        return Task::Status::TS_DONE == sts || Task::Status::TS_ERROR == sts || Task::Status::TS_INITIAL == sts;
+    }
+
     virtual void startAsyncTask() {
-        if (!_requestExecutor->startTask(_currentTask)) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        if (startAsyncTaskElsewhere()) return;
+        if (!firstStageExecutor()->startTask(_currentTask)) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+    }
+
+    /**
+     * @brief Lets the requests, which queue some of their tasks elsewhere than to the request executor (e.g. to a
+     * batcher), take the current task
+     * @return true if the task was queued
+     */
+    virtual bool startAsyncTaskElsewhere() {
+        return false;
+    }
+
+    /**
+     * @brief Prepares the next asynchronous inference like StartAsync, but returns its task instead of queueing it,
+     * so the executable network queues the tasks of a group of the requests at once
+     * @param executor - receives the executor the task is to be queued to
+     * @return the task to queue, nullptr if the request has queued it itself
+     */
+    Task::Ptr PrepareStartAsync(ITaskExecutor::Ptr &executor) {
+        if (!occupyRequest()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        try {
+            _syncRequest->checkBlobs();
+            _callbackManager.reset();
+            initNextAsyncTask();
+            _currentTask->setPriority(_priority);
+            enqueued();
+            if (startAsyncTaskElsewhere()) return nullptr;
+        } catch (...) {
+            setPhase(ExecutionStatistics::Idle);
+            setIsRequestBusy(false);
+            throw;
+        }
+        executor = firstStageExecutor();
+        return _currentTask;
+    }
+
+    /**
+     * @brief Releases the request, whose task returned by PrepareStartAsync could not be queued
+     */
+    void CancelStartAsync() {
+        setPhase(ExecutionStatistics::Idle);
+        setIsRequestBusy(false);
+    }
+
+    /**
+     * @brief Returns the status of the last inference of the request without waiting for it
+     */
+    Task::Status GetTaskStatus() {
+        auto taskCopy = _currentTask;
+        return taskCopy->getStatus();
+    }
+
+    /**
+     * @brief Returns true from the start of an inference of the request until it completes
+     */
+    bool IsBusy() const {
+        return isRequestBusy();
+    }
+
+    /**
+     * @brief Sets the signal notified whenever an inference of the request completes, the executable network
+     * waits on it for any or all of its requests
+     */
+    void SetCompletionSignal(const TaskCompletionSignal::Ptr &signal) {
+        _completionSignal = signal;
+        _syncTask->setCompletionSignal(signal);
+        for (auto &task : _asyncTasks) task->setCompletionSignal(signal);
+    }
+
+    /**
+     * @brief Sets the executor the inputs of the asynchronous inferences are pre-processed on before the inference
+     * is queued to the request executor, nullptr pre-processes them within the inference
+     */
+    void SetPreprocessExecutor(const ITaskExecutor::Ptr &executor) {
+        _preprocessExecutor = executor;
+    }
+
+    /**
+     * @brief Sets the statistics the request adds the latencies of every inference to and counts its phases in
+     */
+    void SetStatistics(const ExecutionStatistics::Ptr &statistics) {
+        _statistics = statistics;
+    }
+
+    /**
+     * @brief Sets the time Wait spins on the completion of the inference before it blocks (see Task::setSpinTime)
+     */
+    void SetSpinTime(int micros) {
+        _spinTime = micros;
+        _syncTask->setSpinTime(micros);
+        for (auto &task : _asyncTasks) task->setSpinTime(micros);
     }
 
     void StartAsync_ThreadUnsafe() override {
         _syncRequest->checkBlobs();
         _callbackManager.reset();
         initNextAsyncTask();
-        startAsyncTask();
+        _currentTask->setPriority(_priority);
+        enqueued();
+        try {
+            startAsyncTask();
+        } catch (...) {
+            setPhase(ExecutionStatistics::Idle);
+            throw;
+        }
     }
 
     virtual void processAsyncTaskFailure(StagedTask::Ptr asyncTask) {
+        bool runsCallback = _callbackManager.isCallbackEnabled() && asyncTask->getStage() >= 1;
+        if (runsCallback) completed(ExecutionStatistics::Callback);
+        else setPhase(ExecutionStatistics::Idle);
         setIsRequestBusy(false);
         auto requestException = std::current_exception();
         // callback was set and hasn't been called, it must be called
-        if (_callbackManager.isCallbackEnabled() && asyncTask->getStage() >= 1) {
+        if (runsCallback) {
             // jump to the "callback" stage because of happened error
             while (asyncTask->getStage() != 1) asyncTask->stageDone();
             _callbackManager.set_requestStatus(GENERAL_ERROR);
             _callbackManager.set_requestException(requestException);
-            _callbackManager.startTask(asyncTask);
+            startCallbackStage(asyncTask);
         } else {
             std::rethrow_exception(requestException);
         }
@@ -172,20 +309,30 @@ public:
             auto asyncTaskCopy = _asyncTask;
             try {
                 switch (asyncTaskCopy->getStage()) {
+                    case 3: {
+                        _syncRequest->PreprocessAhead();
+                        asyncTaskCopy->stageDone();
+                        // the inference waits in the queue of the request executor, the pre-processing executor
+                        // takes the next request meanwhile
+                        if (!_requestExecutor->startTask(asyncTaskCopy)) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+                    }
+                        break;
                     case 2: {
-                        _syncRequest->Infer();
+                        if (_statistics) _statistics->queue.add(std::chrono::steady_clock::now() - _enqueueTime);
+                        inferTimed();
                         asyncTaskCopy->stageDone();
+                        // the phase is left before the task completes, Wait may start the next inference right away
                         if (_callbackManager.isCallbackEnabled()) {
-                            _callbackManager.startTask(asyncTaskCopy);
+                            completed(ExecutionStatistics::Callback);
+                            startCallbackStage(asyncTaskCopy);
                         } else {
+                            completed(ExecutionStatistics::Idle);
                             asyncTaskCopy->stageDone();
                         }
                     }
                         break;
                     case 1: {
-                        setIsRequestBusy(false);
-                        asyncTaskCopy->stageDone();
-                        _callbackManager.runCallback();
+                        runCallbackStage(asyncTaskCopy);
                     }
                         break;
                     default:
@@ -194,7 +341,36 @@ public:
             } catch (...) {
                 processAsyncTaskFailure(asyncTaskCopy);
             }
-        }, 2);
+        }, 3);
+    }
+
+    /**
+     * @brief Starts the callback stage of the task on the callback executor. The inline callbacks cannot re-run
+     * the task, which is still running the inference stage, so the stage is done in place.
+     */
+    void startCallbackStage(StagedTask::Ptr asyncTask) {
+        if (_callbackManager.isInline()) {
+            runCallbackStage(asyncTask);
+        } else {
+            _callbackManager.startTask(asyncTask);
+        }
+    }
+
+    void runCallbackStage(StagedTask::Ptr asyncTask) {
+        if (_statistics) _statistics->callback.add(std::chrono::steady_clock::now() - _doneTime);
+        setPhase(ExecutionStatistics::Idle);
+        setIsRequestBusy(false);
+        asyncTask->stageDone();
+        // the callback may start the next inference of the request, so the running callbacks are counted apart
+        // from the phase of the request
+        if (_statistics) _statistics->move(ExecutionStatistics::Idle, ExecutionStatistics::Callback);
+        try {
+            _callbackManager.runCallback();
+        } catch (...) {
+            if (_statistics) _statistics->move(ExecutionStatistics::Callback, ExecutionStatistics::Idle);
+            throw;
+        }
+        if (_statistics) _statistics->move(ExecutionStatistics::Callback, ExecutionStatistics::Idle);
     }
 
     StatusCode Wait(int64_t millis_timeout) override {
@@ -219,6 +395,7 @@ public:
     void Infer_ThreadUnsafe() override {
         _currentTask = _syncTask;
         auto status = _currentTask->runWithSynchronizer(_requestSynchronizer);
+        setPhase(ExecutionStatistics::Idle);
         if (status == Task::Status::TS_BUSY)
             THROW_IE_EXCEPTION << "Internal error: AsyncInferRequestThreadSafeDefault failed to start sync task";
         _currentTask->checkException();
@@ -253,20 +430,75 @@ public:
         _callbackManager.set_publicInterface(ptr);
     }
 
+    /**
+     * @brief Sets the priority the asynchronous inferences of the request are queued with to the executor
+     */
+    void SetPriority(int priority) {
+        _priority = priority;
+    }
+
     void SetBatch_ThreadUnsafe(int batch) override {
         _syncRequest->SetBatch(batch);
     }
 
+    void SetROIs_ThreadUnsafe(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) override {
+        _syncRequest->SetROIs(name, frame, rois);
+    }
+
+    void SetSequenceStates_ThreadUnsafe(const std::vector<SequenceState::Ptr> &sequences) override {
+        _syncRequest->SetSequenceStates(sequences);
+    }
+
+    void SetRequestedOutputs_ThreadUnsafe(const std::vector<std::string> &outputs) override {
+        _syncRequest->SetRequestedOutputs(outputs);
+    }
+
 protected:
+    void inferTimed() {
+        setPhase(ExecutionStatistics::Running);
+        auto start = std::chrono::steady_clock::now();
+        _syncRequest->Infer();
+        if (_statistics) _statistics->add(std::chrono::steady_clock::now() - start);
+    }
+
+    /**
+     * @brief Moves the request to the phase of an inference and counts it in the statistics
+     */
+    void setPhase(ExecutionStatistics::Phase phase) {
+        auto previous = _phase.exchange(phase);
+        if (_statistics) _statistics->move(previous, phase);
+    }
+
+    void enqueued() {
+        _enqueueTime = std::chrono::steady_clock::now();
+        setPhase(ExecutionStatistics::Queued);
+    }
+
+    void completed(ExecutionStatistics::Phase next) {
+        _doneTime = std::chrono::steady_clock::now();
+        setPhase(next);
+    }
+
     ITaskExecutor::Ptr _requestExecutor;
+    ITaskExecutor::Ptr _preprocessExecutor;
     TaskSynchronizer::Ptr _requestSynchronizer;
     InferRequestInternal::Ptr _syncRequest;
     Task::Ptr _syncTask;
     StagedTask::Ptr _asyncTask;
     Task::Ptr _currentTask;
-    std::list<StagedTask::Ptr> _listAsyncTasks;
+    // the tasks of the asynchronous inferences, _nextAsyncTask is the one taken last
+    std::vector<StagedTask::Ptr> _asyncTasks;
+    size_t _nextAsyncTask = 0;
+    TaskCompletionSignal::Ptr _completionSignal;
+    ExecutionStatistics::Ptr _statistics;
+    std::atomic<ExecutionStatistics::Phase> _phase{ExecutionStatistics::Idle};
+    // StartAsync and the completion of the current inference, the stages of the task hand them over via the executors
+    std::chrono::steady_clock::time_point _enqueueTime;
+    std::chrono::steady_clock::time_point _doneTime;
     void *_userData;
     CallbackManager _callbackManager;
+    int _priority = 0;
+    int _spinTime = 0;
 };
 
 }  // namespace InferenceEngine
@@ -8,6 +8,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <atomic>
 #include <cpp_interfaces/ie_task.hpp>
 #include "cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
@@ -18,8 +19,7 @@ namespace InferenceEngine {
  * @brief Wrapper of async request to support thread-safe execution.
  */
 class AsyncInferRequestThreadSafeInternal : public IAsyncInferRequestInternal {
-    bool _isRequestBusy = false;
-    std::mutex _isBusyMutex;
+    std::atomic<bool> _isRequestBusy = {false};
 
 public:
     typedef std::shared_ptr<AsyncInferRequestThreadSafeInternal> Ptr;
@@ -34,14 +34,20 @@ protected:
     }
 
     virtual void setIsRequestBusy(bool isBusy) {
-        std::unique_lock<std::mutex> lock(_isBusyMutex);
         _isRequestBusy = isBusy;
     }
 
+    /**
+     * @brief Makes the request busy in one atomic step, so of the concurrent calls only one starts the inference
+     * @return false if the request was busy already
+     */
+    bool occupyRequest() {
+        return !_isRequestBusy.exchange(true);
+    }
+
 public:
     void StartAsync() override {
-        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
-        setIsRequestBusy(true);
+        if (!occupyRequest()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
         try {
             StartAsync_ThreadUnsafe();
         } catch (...) {
@@ -66,8 +72,7 @@ public:
     }
 
     void Infer() override {
-        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
-        setIsRequestBusy(true);
+        if (!occupyRequest()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
         try {
             Infer_ThreadUnsafe();
         } catch (...) {
@@ -97,6 +102,21 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void SetROIs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetROIs_ThreadUnsafe(name, frame, rois);
+    }
+
+    void SetSequenceStates(const std::vector<SequenceState::Ptr> &sequences) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetSequenceStates_ThreadUnsafe(sequences);
+    }
+
+    void SetRequestedOutputs(const std::vector<std::string> &outputs) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetRequestedOutputs_ThreadUnsafe(outputs);
+    }
+
     /**
      * @brief methods with _ThreadUnsafe prefix are to implement in plugins
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
@@ -119,6 +139,12 @@ public:
     virtual void GetBlob_ThreadUnsafe(const char *name, Blob::Ptr &data) = 0;
 
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    virtual void SetROIs_ThreadUnsafe(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) = 0;
+
+    virtual void SetSequenceStates_ThreadUnsafe(const std::vector<SequenceState::Ptr> &sequences) = 0;
+
+    virtual void SetRequestedOutputs_ThreadUnsafe(const std::vector<std::string> &outputs) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -74,7 +74,13 @@ public:
      */
     void Infer() override {
         checkBlobs();
-        InferImpl();
+        try {
+            InferImpl();
+        } catch (...) {
+            _preprocessedAhead = false;
+            throw;
+        }
+        _preprocessedAhead = false;
     };
 
     /**
@@ -94,9 +100,13 @@ public:
         DataPtr foundOutput;
         size_t dataSize = data->size();
         if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
-            // Only precision is checked for an input with ROI inside (resize algorithm was set for the input).
-            if (foundInput->getPreProcess().getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE) {
-                if (foundInput->getInputPrecision() != data->precision()) {
+            // Only precision is checked for an input with ROI inside (resize algorithm or color format was set
+            // for the input). Images of a color format are always U8.
+            const PreProcessInfo &preProcess = foundInput->getPreProcess();
+            if (preProcess.isPreProcessingRequired()) {
+                Precision expected = preProcess.getColorFormat() != ColorFormat::RAW ? Precision(Precision::U8)
+                                                                                     : foundInput->getInputPrecision();
+                if (expected != data->precision()) {
                     THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                        << "Failed to set Blob with precision not corresponding to user input precision";
                 }
@@ -169,17 +179,78 @@ public:
         THROW_IE_EXCEPTION << "Dynamic batch is not supported";
     };
 
+    void SetSequenceStates(const std::vector<SequenceState::Ptr> &sequences) override {
+        THROW_IE_EXCEPTION << "Sequence states are not supported";
+    }
+
+    /**
+     * @brief Given optional implementation of setting the requested outputs: the names are checked and all the
+     * outputs are computed anyway, the plugins skipping the layers of the other outputs override it
+     * @param outputs - the names of the outputs of the network, empty for all of them.
+     */
+    void SetRequestedOutputs(const std::vector<std::string> &outputs) override {
+        for (const auto &output : outputs) {
+            if (_networkOutputs.find(output) == _networkOutputs.end())
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find the output with name: \'" << output << "\'";
+        }
+    }
+
+    /**
+     * @brief Given optional implementation of setting ROIs of a frame to avoid need for it to be implemented by plugin
+     * @param name - a name of the input with the resize algorithm set.
+     * @param frame - a reference to the frame, its precision must correspond to the input precision.
+     * @param rois - ROIs inside of the frame, every ROI is resized to the image of the same index in the batch.
+     */
+    void SetROIs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) override {
+        if (name == nullptr)
+            THROW_IE_EXCEPTION << NOT_FOUND_str + "Failed to set ROIs with empty name";
+        if (!frame)
+            THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty frame for input: \'" << name << "\'";
+        if (frame->buffer() == nullptr)
+            THROW_IE_EXCEPTION << "Frame was not allocated. Input name: \'" << name << "\'";
+        InputInfo::Ptr foundInput;
+        DataPtr foundOutput;
+        if (!findInputAndOutputBlobByName(name, foundInput, foundOutput))
+            THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to set ROIs for output \'" << name << "\'";
+        const PreProcessInfo &preProcess = foundInput->getPreProcess();
+        if (preProcess.getResizeAlgorithm() == ResizeAlgorithm::NO_RESIZE ||
+            preProcess.getColorFormat() != ColorFormat::RAW)
+            THROW_IE_EXCEPTION << "ROIs can be set only for an input with the resize algorithm and RAW color format";
+        if (foundInput->getInputPrecision() != frame->precision())
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
+                               << "Failed to set frame with precision not corresponding to user input precision";
+        _preProcData[name].setRois(frame, rois);
+    }
+
+    /**
+     * @brief Whether the inputs of the request are pre-processed (resized or converted) before the inference
+     */
+    virtual bool HasPreprocessing() const {
+        return !_preProcData.empty();
+    }
+
+    /**
+     * @brief Pre-processes the inputs ahead of Infer, the asynchronous inference runs it as a separate stage on its
+     * own executor. The execDataPreprocessing of the following Infer is skipped then.
+     */
+    void PreprocessAhead() {
+        _preprocessedAhead = false;
+        execDataPreprocessing();
+        _preprocessedAhead = true;
+    }
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      */
     void execDataPreprocessing() {
+        if (_preprocessedAhead)
+            return;
         for (auto &input : _inputs) {
             // If there is a pre-process entry for an input then it must be pre-processed
-            // using preconfigured resize algorithm.
+            // using preconfigured resize algorithm and color format.
             auto it = _preProcData.find(input.first);
             if (it != _preProcData.end()) {
-                _preProcData[input.first].execute(input.second,
-                                                  _networkInputs[input.first]->getPreProcess().getResizeAlgorithm());
+                _preProcData[input.first].execute(input.second, _networkInputs[input.first]->getPreProcess());
             }
         }
     }
@@ -191,6 +262,7 @@ protected:
     InferenceEngine::BlobMap _outputs;
     ExecutableNetworkInternalPtr _exeNetwork;
     std::map<std::string, PreProcessData> _preProcData;  // pre-process data per input
+    bool _preprocessedAhead = false;  // the inputs are pre-processed by PreprocessAhead for the next Infer
 
 protected:
     /**
@@ -58,12 +58,38 @@ public:
     virtual ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(ICNNNetwork &network,
                                                               const std::map<std::string, std::string> &config) = 0;
 
+    /**
+     * @brief Creates an executable network which allocates its memory with the given allocator
+     * @param network - a network object acquired from CNNNetReader
+     * @param config string-string map of config parameters relevant only for this load operation
+     * @param allocator - allocator of the memory of the network, nullptr means the default one of the plugin
+     * @return shared_ptr to the ExecutableNetwork object
+     */
+    virtual ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(ICNNNetwork &network,
+                                                              const std::map<std::string, std::string> &config,
+                                                              const std::shared_ptr<IAllocator> &allocator) {
+        if (allocator != nullptr)
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The plugin does not support custom allocators";
+        return LoadExeNetworkImpl(network, config);
+    }
+
     /**
      * Given optional implementation of load executable network to avoid need for it to be implemented by plugin
      */
     void LoadNetwork(IExecutableNetwork::Ptr &executableNetwork,
                      ICNNNetwork &network,
                      const std::map<std::string, std::string> &config) override {
+        LoadNetwork(executableNetwork, network, config, nullptr);
+    }
+
+    /**
+     * Given optional implementation of load executable network with an allocator to avoid need for it to be
+     * implemented by plugin
+     */
+    void LoadNetwork(IExecutableNetwork::Ptr &executableNetwork,
+                     ICNNNetwork &network,
+                     const std::map<std::string, std::string> &config,
+                     const std::shared_ptr<IAllocator> &allocator) override {
         InputsDataMap networkInputs;
         OutputsDataMap networkOutputs;
         network.getInputsInfo(networkInputs);
@@ -100,7 +126,7 @@ public:
             }
             _networkOutputs[it.first] = newData;
         }
-        auto impl = LoadExeNetworkImpl(network, config);
+        auto impl = LoadExeNetworkImpl(network, config, allocator);
         impl->setNetworkInputs(_networkInputs);
         impl->setNetworkOutputs(_networkOutputs);
         // skip setting shared ptr to avoid curricular dependency: ExecutableNetworkBase -> IExecutableNetworkInternal -> InferencePluginInternal
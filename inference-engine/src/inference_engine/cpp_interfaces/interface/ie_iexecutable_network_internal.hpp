@@ -63,6 +63,48 @@ public:
 
 
     virtual std::vector<IMemoryStateInternal::Ptr> QueryState() = 0;
+
+    /**
+     * @brief Get the memory used by the executable network
+     * @param footprint - the memory in bytes
+     */
+    virtual void GetMemoryFootprint(MemoryFootprint &footprint) = 0;
+
+    /**
+     * @brief Get the hints to size the pool of the infer requests of the network
+     * @param metrics - the optimal number of the requests, the streams, the queue depth and the execution time
+     */
+    virtual void GetMetrics(ExecutableNetworkMetrics &metrics) = 0;
+
+    /**
+     * @brief Changes the shapes of the inputs of the loaded network for the infer requests created afterwards
+     * @param inputShapes - the new shapes of the inputs by their names
+     */
+    virtual void Reshape(const ICNNNetwork::InputShapes &inputShapes) = 0;
+
+    /**
+     * @brief Releases the memory the idle network keeps between the inferences, the compiled network is kept
+     * @param releaseWeights - true to release also the networks compiled for the other shapes of the inputs
+     */
+    virtual void Trim(bool releaseWeights) = 0;
+
+    /**
+     * @brief Starts the asynchronous inferences of a group of the requests of the network
+     * @param requests - the requests to start
+     */
+    virtual void StartAsyncRequests(const std::vector<IInferRequest::Ptr> &requests) = 0;
+
+    /**
+     * @brief Waits for all or any of a group of the requests of the network
+     * @param requests - the requests to wait for
+     * @param waitAll - true to wait for all the started requests, false for the first completed one
+     * @param millis_timeout - maximum duration in milliseconds to block for, IInferRequest::WaitMode::RESULT_READY
+     * blocks until the requests complete
+     * @param completed - receives the index of the completed request, if waitAll is false
+     * @return the status of the awaited requests
+     */
+    virtual StatusCode WaitRequests(const std::vector<IInferRequest::Ptr> &requests, bool waitAll,
+                                    int64_t millis_timeout, size_t &completed) = 0;
 };
 
 }  // namespace InferenceEngine
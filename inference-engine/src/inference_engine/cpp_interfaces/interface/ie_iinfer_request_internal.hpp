@@ -56,6 +56,26 @@ public:
     * @param batch - new batch size to be used by all the following inference calls for this request.
     */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+    * @brief Sets a frame and the ROIs inside of it for an input with the resize algorithm set.
+    * @param name - a name of the input.
+    * @param frame - a reference to the frame.
+    * @param rois - ROIs inside of the frame, every ROI is resized to the image of the same index in the batch.
+    */
+    virtual void SetROIs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) = 0;
+
+    /**
+    * @brief Sets the sequences the following inferences read and advance the memory states of.
+    * @param sequences - the states of the sequences, one per sample of the batch.
+    */
+    virtual void SetSequenceStates(const std::vector<SequenceState::Ptr> &sequences) = 0;
+
+    /**
+    * @brief Sets the outputs the following inferences compute, empty for all the outputs.
+    * @param outputs - the names of the outputs of the network.
+    */
+    virtual void SetRequestedOutputs(const std::vector<std::string> &outputs) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -6,6 +6,7 @@
 #pragma once
 #include <string>
 #include <memory>
+#include <ie_blob.h>
 
 namespace InferenceEngine {
 /**
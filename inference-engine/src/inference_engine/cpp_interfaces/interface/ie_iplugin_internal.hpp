@@ -16,6 +16,8 @@
 #include <ie_icnn_network.hpp>
 #include <ie_iexecutable_network.hpp>
 #include <ie_iextension.h>
+#include <ie_allocator.hpp>
+#include "cpp_interfaces/exception2status.hpp"
 
 namespace InferenceEngine {
 
@@ -44,6 +46,22 @@ public:
                              ICNNNetwork &network,
                              const std::map<std::string, std::string> &config) = 0;
 
+    /**
+     * @brief Creates an executable network which allocates its memory with the given allocator
+     * @param executableNetwork - a reference to a shared ptr of the returned network interface
+     * @param network - a network object acquired from CNNNetReader
+     * @param config string-string map of config parameters relevant only for this load operation
+     * @param allocator - allocator of the memory of the network, nullptr means the default one of the plugin
+     */
+    virtual void LoadNetwork(IExecutableNetwork::Ptr &executableNetwork,
+                             ICNNNetwork &network,
+                             const std::map<std::string, std::string> &config,
+                             const std::shared_ptr<IAllocator> &allocator) {
+        if (allocator != nullptr)
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The plugin does not support custom allocators";
+        LoadNetwork(executableNetwork, network, config);
+    }
+
     /**
      * @deprecated use Infer() working with multiple inputs and outputs
      * @brief Infers an image(s)
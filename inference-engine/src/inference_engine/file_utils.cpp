@@ -6,6 +6,10 @@
 #include <file_utils.h>
 #include "details/ie_exception.hpp"
 #include <fstream>
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
 
 #include <w_unistd.h>
 
@@ -26,6 +30,47 @@ long long FileUtils::fileSize(const char *fileName) {
 }
 
 void FileUtils::readAllFile(const std::string &file_name, void *buffer, size_t maxSize) {
+    // the large files are read by several streams in parallel, the storage (e.g. the network one) serves several
+    // requests in flight faster than the sequential ones
+    const size_t chunk = 64 * 1024 * 1024;
+    const size_t maxStreams = 4;
+    size_t streams = std::min(maxStreams, maxSize / chunk);
+    if (streams > 1) {
+        size_t partSize = (maxSize + streams - 1) / streams;
+        std::vector<std::exception_ptr> errors(streams);
+        auto readPart = [&](size_t part) {
+            try {
+                size_t begin = part * partSize;
+                size_t size = std::min(partSize, maxSize - begin);
+                std::ifstream partFile(file_name, std::ios::binary | std::ios::in);
+                if (!partFile.is_open()) THROW_IE_EXCEPTION << "cannot open file " << file_name;
+                if (!partFile.seekg(static_cast<std::streamoff>(begin)) ||
+                        !partFile.read(reinterpret_cast<char *>(buffer) + begin, size))
+                    THROW_IE_EXCEPTION << "cannot read " << maxSize << " bytes from file " << file_name;
+            } catch (...) {
+                errors[part] = std::current_exception();
+            }
+        };
+        std::vector<std::thread> readers;
+        size_t part = 1;
+        try {
+            for (; part < streams; part++)
+                readers.emplace_back(readPart, part);
+        } catch (...) {
+            // the parts no thread is started for are read by the calling one
+        }
+        for (; part < streams; part++)
+            readPart(part);
+        readPart(0);
+        for (auto &reader : readers)
+            reader.join();
+        for (auto &error : errors) {
+            if (error)
+                std::rethrow_exception(error);
+        }
+        return;
+    }
+
     std::ifstream inputFile;
 
     inputFile.open(file_name, std::ios::binary | std::ios::in);
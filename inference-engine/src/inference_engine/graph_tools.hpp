@@ -7,6 +7,7 @@
 
 #include <unordered_set>
 #include <unordered_map>
+#include <deque>
 #include <vector>
 #include <string>
 #include <queue>
@@ -131,8 +132,8 @@ inline void UnorderedDFS(std::unordered_set<CNNLayer *> &visited,
  */
 template<class T>
 inline void BFS(InferenceEngine::CNNLayerPtr layer, const T &visit, int maxDepth) {
-    std::set<InferenceEngine::CNNLayer*> visited;
-    std::list<InferenceEngine::CNNLayerPtr> nextLayers;
+    std::unordered_set<InferenceEngine::CNNLayer*> visited;
+    std::deque<InferenceEngine::CNNLayerPtr> nextLayers;
     nextLayers.push_back(layer);
 
     int layersOnLevel = 1;
@@ -331,23 +332,77 @@ inline CNNLayerSet CNNNetGetAllInputLayers(const ICNNNetwork &network) {
 
 /**
  * Sort network layers topologically
+ * The layers get dense ids in the order they are discovered from the input layers and the edges are kept in the
+ * arrays of the ids, so the sort (Kahn's algorithm) does one hash lookup per edge and no recursion
  * @param network
  * @return sorted vector
  * @throws if sorting not possible - for example if loop detected
  */
 inline std::vector<CNNLayerPtr> CNNNetSortTopologically(const ICNNNetwork & network) {
-    std::vector<CNNLayerPtr> stackOfVisited;
-    bool res = CNNNetForestDFS(CNNNetGetAllInputLayers(network), [&](CNNLayerPtr  current){
-        stackOfVisited.push_back(current);
-    }, false);
+    std::vector<CNNLayerPtr> layers;
+    std::unordered_map<CNNLayer *, size_t> ids;
+    std::vector<std::vector<size_t>> consumers;
+    auto getId = [&](const CNNLayerPtr &layer) {
+        auto found = ids.find(layer.get());
+        if (found != ids.end()) {
+            return found->second;
+        }
+        size_t id = layers.size();
+        ids.emplace(layer.get(), id);
+        layers.push_back(layer);
+        consumers.emplace_back();
+        return id;
+    };
 
-    if (!res) {
-        THROW_IE_EXCEPTION << "Sorting not possible, due to existed loop.";
+    for (auto &input : CNNNetGetAllInputLayers(network)) {
+        getId(input);
+    }
+    // the layers discovered by the loop are appended to the end and visited by it as well
+    for (size_t id = 0; id < layers.size(); id++) {
+        CNNLayerPtr layer = layers[id];
+        for (auto &od : layer->outData) {
+            for (auto &nl : od->getInputTo()) {
+                if (nl.second) {
+                    size_t next = getId(nl.second);
+                    consumers[id].push_back(next);
+                }
+            }
+        }
     }
 
-    std::reverse(std::begin(stackOfVisited), std::end(stackOfVisited));
+    std::vector<size_t> producersLeft(layers.size(), 0);
+    for (auto &next : consumers) {
+        for (auto id : next) {
+            producersLeft[id]++;
+        }
+    }
+
+    std::deque<size_t> ready;
+    for (size_t id = 0; id < layers.size(); id++) {
+        if (producersLeft[id] == 0) {
+            ready.push_back(id);
+        }
+    }
+
+    std::vector<CNNLayerPtr> sorted;
+    sorted.reserve(layers.size());
+    while (!ready.empty()) {
+        size_t id = ready.front();
+        ready.pop_front();
+        sorted.push_back(layers[id]);
+        for (auto next : consumers[id]) {
+            if (--producersLeft[next] == 0) {
+                ready.push_back(next);
+            }
+        }
+    }
+
+    // the layers of a loop never run out of the producers
+    if (sorted.size() != layers.size()) {
+        THROW_IE_EXCEPTION << "Sorting not possible, due to existed loop.";
+    }
 
-    return stackOfVisited;
+    return sorted;
 }
 /**
  * @brief copy Data from original graph, and insert into new graph, using layers remap information
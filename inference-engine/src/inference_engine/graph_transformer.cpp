@@ -4,7 +4,12 @@
 //
 
 #include <assert.h>
+#include <memory>
+#include <string>
+#include <vector>
 #include "graph_transformer.h"
+#include "graph_tools.hpp"
+#include "cnn_network_impl.hpp"
 
 namespace InferenceEngine {
 
@@ -26,4 +31,199 @@ void replaceLayerWithNewLayer(ICNNNetwork &network, const CNNLayerPtr &layer, co
     network.addLayer(newLayer);
 }
 
+GraphTransformer::GraphTransformer(ICNNNetwork &network) : network(network) {
+    for (auto &layer : CNNNetSortTopologically(network)) {
+        positions[layer.get()] = order.insert(order.end(), layer);
+    }
+}
+
+std::vector<CNNLayerPtr> GraphTransformer::sortedLayers() const {
+    return std::vector<CNNLayerPtr>(order.begin(), order.end());
+}
+
+std::vector<CNNLayerPtr> GraphTransformer::match(const CNNLayerPtr &layer, const Pattern &pattern) const {
+    std::vector<CNNLayerPtr> chain;
+    CNNLayerPtr current = layer;
+    for (size_t i = 0; i < pattern.size(); i++) {
+        if (!current || (!pattern[i].empty() && current->type != pattern[i])) {
+            return {};
+        }
+        chain.push_back(current);
+        if (i + 1 == pattern.size()) {
+            break;
+        }
+        if (current->outData.size() != 1 || current->outData[0]->getInputTo().size() != 1) {
+            return {};
+        }
+        current = current->outData[0]->getInputTo().begin()->second;
+    }
+    return chain;
+}
+
+void GraphTransformer::forEachMatch(const Pattern &pattern,
+                                    const std::function<void(const std::vector<CNNLayerPtr> &)> &callback) {
+    // the snapshot keeps the visited layers alive, so the layers removed by the callback are not found by address
+    for (auto &layer : sortedLayers()) {
+        if (positions.find(layer.get()) == positions.end()) {
+            continue;
+        }
+        auto chain = match(layer, pattern);
+        if (!chain.empty()) {
+            callback(chain);
+        }
+    }
+}
+
+void GraphTransformer::insertBetween(const CNNLayerPtr &parent, const CNNLayerPtr &child, const CNNLayerPtr &layer) {
+    DataPtr parentData;
+    for (auto &data : parent->outData) {
+        if (data->getInputTo().find(child->name) != data->getInputTo().end()) {
+            parentData = data;
+            break;
+        }
+    }
+    if (!parentData) {
+        THROW_IE_EXCEPTION << "Layers are not adjacent: " << parent->name << " vs " << child->name;
+    }
+
+    size_t inIndex = 0;
+    while (inIndex < child->insData.size() && child->insData[inIndex].lock() != parentData) {
+        inIndex++;
+    }
+    if (inIndex == child->insData.size()) {
+        THROW_IE_EXCEPTION << "Layer " << child->name << " has no back connection to " << parent->name;
+    }
+
+    DataPtr out = std::make_shared<Data>(layer->name, parentData->getTensorDesc());
+    out->creatorLayer = layer;
+    out->inputTo[child->name] = child;
+    child->insData[inIndex] = out;
+
+    parentData->inputTo.erase(child->name);
+    parentData->inputTo[layer->name] = layer;
+    layer->insData.push_back(parentData);
+    layer->outData.push_back(out);
+
+    addToNetwork(layer, out);
+    insertInOrder(layer, child);
+
+    undo.push_back([=]() {
+        eraseFromOrder(layer);
+        removeFromNetwork(layer, out);
+
+        layer->insData.pop_back();
+        layer->outData.pop_back();
+        parentData->inputTo.erase(layer->name);
+        parentData->inputTo[child->name] = child;
+        child->insData[inIndex] = parentData;
+    });
+}
+
+void GraphTransformer::replaceLayer(const CNNLayerPtr &layer, const CNNLayerPtr &newLayer) {
+    auto swap = [this](const CNNLayerPtr &from, const CNNLayerPtr &to) {
+        replaceLayerWithNewLayer(network, from, to);
+        auto position = positions.find(from.get());
+        if (position != positions.end()) {
+            *position->second = to;
+            positions[to.get()] = position->second;
+            positions.erase(from.get());
+        }
+    };
+
+    swap(layer, newLayer);
+    undo.push_back([=]() {
+        swap(newLayer, layer);
+    });
+}
+
+void GraphTransformer::removeLayer(const CNNLayerPtr &layer) {
+    if (layer->insData.size() != 1 || layer->outData.size() != 1) {
+        THROW_IE_EXCEPTION << "Cannot remove layer " << layer->name << ": it must have a single input and output";
+    }
+    DataPtr input = layer->insData[0].lock();
+    DataPtr output = layer->outData[0];
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    if (outputs.find(output->name) != outputs.end()) {
+        THROW_IE_EXCEPTION << "Cannot remove layer " << layer->name << ": its output is an output of the network";
+    }
+
+    // the consumers already reading the input keep their edge on undo
+    struct Redirected {
+        CNNLayerPtr consumer;
+        size_t inIndex;
+        bool wasConsumer;
+    };
+    std::vector<Redirected> redirected;
+    for (auto &consumer : output->getInputTo()) {
+        bool wasConsumer = input->inputTo.find(consumer.first) != input->inputTo.end();
+        auto &insData = consumer.second->insData;
+        for (size_t i = 0; i < insData.size(); i++) {
+            if (insData[i].lock() == output) {
+                insData[i] = input;
+                redirected.push_back({consumer.second, i, wasConsumer});
+            }
+        }
+        input->inputTo[consumer.first] = consumer.second;
+    }
+    input->inputTo.erase(layer->name);
+
+    removeFromNetwork(layer, output);
+    CNNLayerPtr next = eraseFromOrder(layer);
+
+    undo.push_back([=]() {
+        insertInOrder(layer, next);
+        addToNetwork(layer, output);
+
+        input->inputTo[layer->name] = layer;
+        for (auto &edge : redirected) {
+            edge.consumer->insData[edge.inIndex] = output;
+            if (!edge.wasConsumer) {
+                input->inputTo.erase(edge.consumer->name);
+            }
+        }
+    });
+}
+
+void GraphTransformer::commit() {
+    undo.clear();
+}
+
+void GraphTransformer::rollback() {
+    for (auto it = undo.rbegin(); it != undo.rend(); ++it) {
+        (*it)();
+    }
+    undo.clear();
+}
+
+void GraphTransformer::insertInOrder(const CNNLayerPtr &layer, const CNNLayerPtr &before) {
+    auto position = before ? positions.at(before.get()) : order.end();
+    positions[layer.get()] = order.insert(position, layer);
+}
+
+CNNLayerPtr GraphTransformer::eraseFromOrder(const CNNLayerPtr &layer) {
+    auto position = positions.find(layer.get());
+    if (position == positions.end()) {
+        return nullptr;
+    }
+    auto next = order.erase(position->second);
+    positions.erase(position);
+    return next == order.end() ? nullptr : *next;
+}
+
+void GraphTransformer::addToNetwork(const CNNLayerPtr &layer, const DataPtr &data) {
+    network.addLayer(layer);
+    network.getData(data->name.c_str()) = data;
+}
+
+void GraphTransformer::removeFromNetwork(const CNNLayerPtr &layer, const DataPtr &data) {
+    auto impl = dynamic_cast<details::CNNNetworkImpl *>(&network);
+    if (impl == nullptr) {
+        THROW_IE_EXCEPTION << "Cannot remove layer " << layer->name << " from the network of unknown implementation";
+    }
+    impl->removeLayer(layer->name);
+    impl->removeData(data->name);
+}
+
 }  // namespace InferenceEngine
@@ -11,6 +11,11 @@
 #pragma once
 
 #include <ie_icnn_network.hpp>
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -22,4 +27,77 @@ namespace InferenceEngine {
  */
 void replaceLayerWithNewLayer(ICNNNetwork &network, const CNNLayerPtr &layer, const CNNLayerPtr &newLayer);
 
+/**
+ * @brief Rewrites a network in place. The topological order is sorted once by the constructor and every rewrite
+ * updates it locally, so a pass matching patterns over the whole network and rewriting them runs in a time linear
+ * in the size of the network instead of sorting it again after every change.
+ * The rewrites are applied at once and recorded until commit; rollback undoes the rewrites since the last commit.
+ */
+class GraphTransformer {
+public:
+    /**
+     * @brief The types of a chain of layers, each of them but the last having a single consumer;
+     * an empty type matches any layer
+     */
+    typedef std::vector<std::string> Pattern;
+
+    explicit GraphTransformer(ICNNNetwork &network);
+
+    /**
+     * @brief The layers of the network in the topological order
+     */
+    std::vector<CNNLayerPtr> sortedLayers() const;
+
+    /**
+     * @brief Returns the chain starting with the layer and matching the pattern or an empty vector
+     */
+    std::vector<CNNLayerPtr> match(const CNNLayerPtr &layer, const Pattern &pattern) const;
+
+    /**
+     * @brief Calls the callback with the chains matching the pattern, in the topological order of their first layers.
+     * The callback may rewrite the network: the layers it removes or replaces are not visited anymore and the
+     * layers it inserts are not visited by this call
+     */
+    void forEachMatch(const Pattern &pattern, const std::function<void(const std::vector<CNNLayerPtr> &)> &callback);
+
+    /**
+     * @brief Inserts the layer on the edge from parent to child. The layer gets a new output data named like the
+     * layer and described like the output of the parent
+     */
+    void insertBetween(const CNNLayerPtr &parent, const CNNLayerPtr &child, const CNNLayerPtr &layer);
+
+    /**
+     * @brief Replaces the layer with newLayer having the same name, see replaceLayerWithNewLayer
+     */
+    void replaceLayer(const CNNLayerPtr &layer, const CNNLayerPtr &newLayer);
+
+    /**
+     * @brief Removes the layer having a single input and a single output, its consumers read its input instead.
+     * The output of the layer must not be an output of the network
+     */
+    void removeLayer(const CNNLayerPtr &layer);
+
+    /**
+     * @brief Keeps the rewrites done so far
+     */
+    void commit();
+
+    /**
+     * @brief Undoes the rewrites since the last commit, in the reverse order
+     */
+    void rollback();
+
+private:
+    // before == nullptr inserts the layer at the end
+    void insertInOrder(const CNNLayerPtr &layer, const CNNLayerPtr &before);
+    CNNLayerPtr eraseFromOrder(const CNNLayerPtr &layer);
+    void addToNetwork(const CNNLayerPtr &layer, const DataPtr &data);
+    void removeFromNetwork(const CNNLayerPtr &layer, const DataPtr &data);
+
+    ICNNNetwork &network;
+    std::list<CNNLayerPtr> order;
+    std::unordered_map<CNNLayer *, std::list<CNNLayerPtr>::iterator> positions;
+    std::vector<std::function<void()>> undo;
+};
+
 }  // namespace InferenceEngine
@@ -8,14 +8,18 @@
 #include <sstream>
 #include <memory>
 #include <map>
+#include <vector>
 
 #include "debug.h"
 #include "parsers.h"
 #include <ie_cnn_net_reader_impl.h>
 #include "v2_format_parser.h"
+#include "binary_format_parser.h"
+#include "mmap_allocator.hpp"
 #include <file_utils.h>
 #include <ie_plugin.hpp>
 #include "xml_parse_utils.h"
+#include "ie_load_profile.hpp"
 
 using namespace std;
 using namespace InferenceEngine;
@@ -42,6 +46,7 @@ StatusCode CNNNetReaderImpl::SetWeights(const TBlob<uint8_t>::Ptr& weights, Resp
         return DescriptionBuffer(desc) << "network must be read first";
     }
     try {
+        LoadPhaseScope phase("set weights");
         _parser->SetWeights(weights);
     }
     catch (const InferenceEngineException& iee) {
@@ -56,8 +61,15 @@ int CNNNetReaderImpl::GetFileVersion(pugi::xml_node& root) {
 }
 
 StatusCode CNNNetReaderImpl::ReadNetwork(const void* model, size_t size, ResponseDesc* resp) noexcept {
+    if (BinaryFormatParser::isBinaryIR(model, size))
+        return ReadBinaryNetwork(model, size, resp);
+
     pugi::xml_document xmlDoc;
-    pugi::xml_parse_result res = xmlDoc.load_buffer(model, size);
+    pugi::xml_parse_result res;
+    {
+        LoadPhaseScope phase("xml parse");
+        res = xmlDoc.load_buffer(model, size);
+    }
     if (res.status != pugi::status_ok) {
         return DescriptionBuffer(resp) << res.description() << "at offset " << res.offset;
     }
@@ -69,6 +81,10 @@ StatusCode CNNNetReaderImpl::ReadNetwork(const void* model, size_t size, Respons
 }
 
 StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* resp) noexcept {
+    return ReadWeights(filepath, false, resp);
+}
+
+StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, bool mmap, ResponseDesc* resp) noexcept {
     long long fileSize = FileUtils::fileSize(filepath);
     if (fileSize == 0)
         return OK;
@@ -81,9 +97,29 @@ StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* res
 
     size_t ulFileSize = static_cast<size_t>(fileSize);
 
+    if (mmap) {
+        // the blobs of the layers are proxies of the weights blob, so they keep the mapping alive
+        MappedFileAllocator* allocator;
+        {
+            LoadPhaseScope phase("read weights");
+            allocator = MappedFileAllocator::create(filepath);
+        }
+        if (allocator != nullptr && allocator->size() == ulFileSize) {
+            // the layers get the proxies of the blob at once, the plugins read the weights while the rest is read
+            allocator->prefetch();
+            TBlob<uint8_t>::Ptr weightsPtr(new TBlob<uint8_t>(Precision::U8, C, {ulFileSize},
+                                                              shared_from_irelease<IAllocator>(allocator)));
+            weightsPtr->allocate();
+            return SetWeights(weightsPtr, resp);
+        }
+        if (allocator != nullptr)
+            allocator->Release();
+    }
+
     TBlob<uint8_t>::Ptr weightsPtr(new TBlob<uint8_t>(Precision::U8, C, {ulFileSize}));
     weightsPtr->allocate();
     try {
+        LoadPhaseScope phase("read weights");
         FileUtils::readAllFile(filepath, weightsPtr->buffer(), ulFileSize);
     }
     catch (const InferenceEngineException& iee) {
@@ -94,8 +130,38 @@ StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* res
 }
 
 StatusCode CNNNetReaderImpl::ReadNetwork(const char* filepath, ResponseDesc* resp) noexcept {
+    char header[sizeof(BinaryFormatParser::magic)] = {};
+    std::ifstream(filepath, std::ios::binary).read(header, sizeof(header));
+    if (BinaryFormatParser::isBinaryIR(header, sizeof(header))) {
+        long long fileSize = FileUtils::fileSize(filepath);
+        if (fileSize < 0)
+            return DescriptionBuffer(resp) << "filesize for: " << filepath << " - " << fileSize << "<0";
+        size_t ulFileSize = static_cast<size_t>(fileSize);
+
+        // the network is read from the mapping in place, the mapping is dropped once it is read
+        MappedFileAllocator* allocator = MappedFileAllocator::create(filepath);
+        if (allocator != nullptr) {
+            auto mapping = shared_from_irelease<IAllocator>(allocator);
+            if (allocator->size() == ulFileSize)
+                return ReadBinaryNetwork(allocator->alloc(ulFileSize), ulFileSize, resp);
+        }
+
+        std::vector<char> model(ulFileSize);
+        try {
+            FileUtils::readAllFile(filepath, model.data(), ulFileSize);
+        }
+        catch (const InferenceEngineException& iee) {
+            return DescriptionBuffer(resp) << iee.what();
+        }
+        return ReadBinaryNetwork(model.data(), ulFileSize, resp);
+    }
+
     pugi::xml_document xmlDoc;
-    pugi::xml_parse_result res = xmlDoc.load_file(filepath);
+    pugi::xml_parse_result res;
+    {
+        LoadPhaseScope phase("xml parse");
+        res = xmlDoc.load_file(filepath);
+    }
     if (res.status != pugi::status_ok) {
         std::ifstream t(filepath);
         std::string str((std::istreambuf_iterator<char>(t)),
@@ -126,17 +192,41 @@ StatusCode CNNNetReaderImpl::ReadNetwork(const char* filepath, ResponseDesc* res
 }
 
 StatusCode CNNNetReaderImpl::ReadNetwork(pugi::xml_document& xmlDoc) {
-    description.clear();
-
-    try {
+    return ParseNetwork([&]() {
         // check which version it is...
         pugi::xml_node root = xmlDoc.document_element();
 
         version = GetFileVersion(root);
         if (version > 2) THROW_IE_EXCEPTION << "cannot parse future versions: " << version;
         _parser = parserCreator->create(version);
+        // the parser validates the parameters of every layer it creates
+        LoadPhaseScope phase("parse");
         network = _parser->Parse(root);
+    });
+}
+
+StatusCode CNNNetReaderImpl::ReadBinaryNetwork(const void* model, size_t size, ResponseDesc* resp) noexcept {
+    StatusCode ret = ParseNetwork([&]() {
+        // the binary topology keeps the networks of IR v2
+        version = 2;
+        auto parser = std::make_shared<BinaryFormatParser>();
+        _parser = parser;
+        LoadPhaseScope phase("parse");
+        network = parser->Parse(model, size);
+    });
+    if (ret != OK) {
+        return DescriptionBuffer(resp) << "Error reading network: " << description;
+    }
+    return OK;
+}
+
+StatusCode CNNNetReaderImpl::ParseNetwork(const std::function<void()>& parse) {
+    description.clear();
+
+    try {
+        parse();
         name = network->getName();
+        LoadPhaseScope phase("validate");
         network->validate(version);
         parseSuccess = true;
     } catch (const std::string& err) {
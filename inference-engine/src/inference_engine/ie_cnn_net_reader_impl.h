@@ -7,6 +7,7 @@
 
 #include "ie_icnn_net_reader.h"
 #include "cnn_network_impl.hpp"
+#include <functional>
 #include <memory>
 #include <string>
 #include <map>
@@ -43,6 +44,8 @@ public:
 
     StatusCode ReadWeights(const char *filepath, ResponseDesc *resp) noexcept override;
 
+    StatusCode ReadWeights(const char *filepath, bool mmap, ResponseDesc *resp) noexcept override;
+
     ICNNNetwork *getNetwork(ResponseDesc *resp) noexcept override {
         return network.get();
     }
@@ -79,6 +82,12 @@ private:
 
     StatusCode ReadNetwork(pugi::xml_document &xmlDoc);
 
+    // reads the binary topology written by saveNetworkToBinaryIR, see BinaryFormatParser
+    StatusCode ReadBinaryNetwork(const void *model, size_t size, ResponseDesc *resp) noexcept;
+
+    // runs the parse setting the network and validates it, the errors are kept in the description
+    StatusCode ParseNetwork(const std::function<void()> &parse);
+
     std::string description;
     std::string name;
     InferenceEngine::details::CNNNetworkImplPtr network;
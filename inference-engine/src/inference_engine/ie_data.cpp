@@ -25,6 +25,7 @@ Blob::Ptr Blob::CreateFromData(const DataPtr &data) {
         case Precision::Q78:
         case Precision::I16:
         case Precision::FP16:
+        case Precision::BF16:
             return std::make_shared<TBlob<short>>(data->getPrecision(), targetLayout, data->getDims());
         case Precision::U8:
             return std::make_shared<TBlob<uint8_t>>(data->getPrecision(), targetLayout, data->getDims());
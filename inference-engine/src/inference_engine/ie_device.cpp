@@ -62,6 +62,10 @@ FindPluginResponse InferenceEngine::findPlugin(const FindPluginRequest& req) {
         return{ {
                 "HeteroPlugin",
             } };
+    case TargetDevice::eMULTI:
+        return{ {
+                "MultiDevicePlugin",
+            } };
 
     default:
         THROW_IE_EXCEPTION << "Cannot find plugin for device: " << getDeviceName(req.device);
@@ -6,6 +6,8 @@
 #include "ie_graph_splitter.hpp"
 
 #include <cassert>
+#include <deque>
+#include <map>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -13,6 +15,8 @@
 #include <string>
 
 #include <ade_util.hpp>
+#include <details/ie_cnn_network_iterator.hpp>
+#include "caseless.hpp"
 
 #include <typed_graph.hpp>
 #include <helpers/subgraphs.hpp>
@@ -156,7 +160,7 @@ ISplitChecker::GraphSelectionResult DefaultSplitChecker::selectSubgraph(
     for (auto i : util::iota(std::size_t(1), subgraphs.size())) {
         auto size = subgraphs[i].size();
         if (size > maxSize) {
-            index = 1;
+            index = i;
             maxSize = size;
         }
     }
@@ -166,6 +170,115 @@ ISplitChecker::GraphSelectionResult DefaultSplitChecker::selectSubgraph(
     return ret;
 }
 
+namespace {
+bool isCheapLayer(const CNNLayerPtr& layer) {
+    static const caseless_set<std::string> cheapTypes = {
+        "ReLU", "Activation", "Clamp", "Power", "ScaleShift", "Reshape", "Flatten", "Squeeze", "Unsqueeze",
+        "Crop", "Split", "Slice", "Concat"
+    };
+    return cheapTypes.find(layer->type) != cheapTypes.end();
+}
+
+std::size_t dataBytes(const DataPtr& data) {
+    const auto& desc = data->getTensorDesc();
+    std::size_t size = desc.getPrecision().size();
+    for (auto dim : desc.getDims()) {
+        size *= dim;
+    }
+    return size;
+}
+
+// Calls visit(neighbour, bytes) for the layers connected with the layer by its inputs and outputs
+template<typename F>
+void forEachNeighbour(const CNNLayerPtr& layer, const F& visit) {
+    for (auto&& dataIt : layer->insData) {
+        auto data = dataIt.lock();
+        auto prevLayer = data ? data->creatorLayer.lock() : nullptr;
+        if (nullptr != prevLayer) {
+            visit(prevLayer, dataBytes(data));
+        }
+    }
+    for (auto&& data : layer->outData) {
+        for (auto&& next : data->inputTo) {
+            visit(next.second, dataBytes(data));
+        }
+    }
+}
+}  // namespace
+
+void reduceBoundaries(ICNNNetwork& network,
+                      const std::function<bool(const CNNLayerPtr&, const std::string&)>& isSupported) {
+    std::vector<CNNLayerPtr> layers;
+    for (details::CNNNetworkIterator it(&network); it != details::CNNNetworkIterator(); it++) {
+        layers.push_back(*it);
+    }
+
+    // every move strictly reduces the size of the boundaries, the limit only bounds the time on the plateaus
+    for (std::size_t pass = 0; pass < layers.size(); pass++) {
+        bool moved = false;
+        std::unordered_set<CNNLayerPtr> grouped;
+        for (auto&& first : layers) {
+            if (!isCheapLayer(first) || first->affinity.empty() || util::contains(grouped, first)) {
+                continue;
+            }
+
+            // the cheap layers connected with each other on the same device are moved together
+            const std::string affinity = first->affinity;
+            std::vector<CNNLayerPtr> group = {first};
+            std::unordered_set<CNNLayerPtr> inGroup = {first};
+            for (std::size_t i = 0; i < group.size(); i++) {
+                forEachNeighbour(group[i], [&](const CNNLayerPtr& neighbour, std::size_t) {
+                    if (neighbour->affinity == affinity && isCheapLayer(neighbour) && !util::contains(inGroup, neighbour)) {
+                        inGroup.insert(neighbour);
+                        group.push_back(neighbour);
+                    }
+                });
+            }
+            grouped.insert(group.begin(), group.end());
+
+            // the bytes passed to and from the group per affinity of the neighbours outside of it
+            std::map<std::string, std::size_t> edgeBytes;
+            std::size_t totalBytes = 0;
+            for (auto&& layer : group) {
+                forEachNeighbour(layer, [&](const CNNLayerPtr& neighbour, std::size_t bytes) {
+                    if (!util::contains(inGroup, neighbour) && !neighbour->affinity.empty()) {
+                        edgeBytes[neighbour->affinity] += bytes;
+                        totalBytes += bytes;
+                    }
+                });
+            }
+
+            // the boundaries of the group on a device are the edges to the neighbours on the other devices
+            std::string best = affinity;
+            std::size_t bestCost = totalBytes - edgeBytes[affinity];
+            for (auto&& candidate : edgeBytes) {
+                std::size_t cost = totalBytes - candidate.second;
+                if (cost >= bestCost) {
+                    continue;
+                }
+                bool supported = true;
+                for (auto&& layer : group) {
+                    supported = supported && isSupported(layer, candidate.first);
+                }
+                if (supported) {
+                    best = candidate.first;
+                    bestCost = cost;
+                }
+            }
+
+            if (best != affinity) {
+                for (auto&& layer : group) {
+                    layer->affinity = best;
+                }
+                moved = true;
+            }
+        }
+        if (!moved) {
+            break;
+        }
+    }
+}
+
 namespace {
 struct SubgraphDesc {
     std::size_t topoIndex = static_cast<std::size_t>(-1);
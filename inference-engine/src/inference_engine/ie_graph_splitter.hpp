@@ -29,6 +29,17 @@ INFERENCE_ENGINE_API_CPP(std::vector<LayersSet>)
 splitGraph(ICNNNetwork& network,
            const std::vector<std::string>& plugins);
 
+/// Moves the groups of the cheap layers (activations, reshapes, splits and concatenations) to the affinity of
+/// their neighbours when it reduces the size of the tensors passed between the devices, so the short subgraphs
+/// between the subgraphs of another device are merged into them. Every boundary costs a synchronization and a
+/// copy, which takes longer than the cheap layers themselves.
+///
+/// @param network - source network with the affinities set
+/// @param isSupported - tells if the layer can be executed with the affinity
+INFERENCE_ENGINE_API_CPP(void)
+reduceBoundaries(ICNNNetwork& network,
+                 const std::function<bool(const CNNLayerPtr&, const std::string&)>& isSupported);
+
 /// Sort sugraphs topologically, behaviour is undefined if there are circular
 /// refences between subgraps
 ///
@@ -0,0 +1,343 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_infer_pipeline.hpp"
+#include "details/ie_exception.hpp"
+#include "ie_trace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace InferenceEngine {
+
+namespace {
+
+/**
+ * @brief The queue between two stages, the producers block while it is full and the consumers while it is empty
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) : _capacity(std::max<size_t>(capacity, 1)) {}
+
+    /**
+     * @brief Returns false if the queue is closed, the item is dropped then
+     */
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _notFull.wait(lock, [&]() { return _closed || _items.size() < _capacity; });
+        if (_closed)
+            return false;
+        _items.push_back(std::move(item));
+        _notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Returns false if the queue is closed and all its items are taken
+     */
+    bool pop(T &item) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _notEmpty.wait(lock, [&]() { return _closed || !_items.empty(); });
+        if (_items.empty())
+            return false;
+        item = std::move(_items.front());
+        _items.pop_front();
+        _notFull.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief The producers are done, the consumers take the rest of the items
+     */
+    void close() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+        _notEmpty.notify_all();
+        _notFull.notify_all();
+    }
+
+    /**
+     * @brief Closes the queue and drops its items
+     */
+    void cancel() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+        _items.clear();
+        _notEmpty.notify_all();
+        _notFull.notify_all();
+    }
+
+private:
+    size_t _capacity;
+    bool _closed = false;
+    std::deque<T> _items;
+    std::mutex _mutex;
+    std::condition_variable _notEmpty;
+    std::condition_variable _notFull;
+};
+
+struct QueuedFrame {
+    PipelineFrame::Ptr frame;
+    // the time the frame entered the queue, in the microseconds of the trace sink
+    uint64_t queued;
+};
+
+using FrameQueue = BoundedQueue<QueuedFrame>;
+
+}  // namespace
+
+class InferPipeline::Impl {
+public:
+    enum StageId {
+        Decode,
+        Preprocess,
+        Infer,
+        Postprocess,
+        Sink,
+        StagesCount
+    };
+
+    Impl(const std::vector<InferRequest::Ptr> &requests, const InferPipelineConfig &config, const Source &decode,
+         const Stage &preprocess, const Stage &postprocess, const Stage &sink)
+            : _requestsCount(requests.size()), _config(config), _decode(decode), _preprocess(preprocess),
+              _postprocess(postprocess), _sink(sink), _freeRequests(requests.size()),
+              _preprocessQueue(config.queueCapacity), _inferQueue(config.queueCapacity),
+              _postprocessQueue(config.queueCapacity), _sinkQueue(config.queueCapacity) {
+        if (requests.empty())
+            THROW_IE_EXCEPTION << "The pipeline needs at least one infer request";
+        for (const auto &request : requests) {
+            if (!request || !*request)
+                THROW_IE_EXCEPTION << "The pipeline cannot infer with an empty request";
+            _freeRequests.push(request);
+        }
+        if (!_decode || !_preprocess || !_sink)
+            THROW_IE_EXCEPTION << "The pipeline needs the decode, preprocess and sink stages";
+        if (_config.preprocessWorkers == 0 || _config.postprocessWorkers == 0)
+            THROW_IE_EXCEPTION << "The pipeline stages need at least one worker";
+        if (_config.inferWorkers == 0)
+            _config.inferWorkers = _requestsCount;
+
+        const char *names[StagesCount] = {"decode", "preprocess", "infer", "postprocess", "sink"};
+        for (int stage = 0; stage < StagesCount; stage++) {
+            _statistics[stage] = {names[stage], 0, 0.0, 0.0};
+            _traceNames[stage] = std::string("Pipeline ") + names[stage];
+        }
+    }
+
+    ~Impl() {
+        stop();
+        join();
+    }
+
+    void start() {
+        std::lock_guard<std::mutex> lock(_threadsMutex);
+        if (_started)
+            THROW_IE_EXCEPTION << "The pipeline is already started";
+        _started = true;
+
+        _threads.emplace_back([this]() { runStage([this]() { decodeFrames(); }); });
+        startWorkers(Preprocess, _config.preprocessWorkers, _preprocessQueue, _inferQueue,
+                     [this](PipelineFrame &frame) {
+                         _preprocess(frame);
+                     });
+        startWorkers(Infer, _config.inferWorkers, _inferQueue, _postprocessQueue, [](PipelineFrame &frame) {
+            frame.request->StartAsync();
+            StatusCode status = frame.request->Wait(IInferRequest::WaitMode::RESULT_READY);
+            if (status != OK)
+                THROW_IE_EXCEPTION << "The inference of the frame " << frame.index << " failed with the status "
+                                   << status;
+        });
+        startWorkers(Postprocess, _config.postprocessWorkers, _postprocessQueue, _sinkQueue,
+                     [this](PipelineFrame &frame) {
+                         if (_postprocess)
+                             _postprocess(frame);
+                         // the request is not needed by the sink, the next frame is pre-processed with it
+                         _freeRequests.push(frame.request);
+                         frame.request.reset();
+                     });
+        _threads.emplace_back([this]() { runStage([this]() { sinkFrames(); }); });
+    }
+
+    void wait() {
+        join();
+        std::lock_guard<std::mutex> lock(_errorMutex);
+        if (_error)
+            std::rethrow_exception(_error);
+    }
+
+    void stop() {
+        _stopped = true;
+        _preprocessQueue.cancel();
+        _inferQueue.cancel();
+        _postprocessQueue.cancel();
+        _sinkQueue.cancel();
+        _freeRequests.cancel();
+    }
+
+    std::vector<PipelineStageStatistics> statistics() const {
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+        return std::vector<PipelineStageStatistics>(_statistics, _statistics + StagesCount);
+    }
+
+private:
+    void join() {
+        std::vector<std::thread> threads;
+        {
+            std::lock_guard<std::mutex> lock(_threadsMutex);
+            threads.swap(_threads);
+        }
+        for (auto &thread : threads) {
+            if (thread.joinable())
+                thread.join();
+        }
+    }
+
+    // the first exception of the stages is kept for wait, the failed stage stops the whole pipeline
+    template <typename F>
+    void runStage(const F &body) {
+        try {
+            body();
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(_errorMutex);
+                if (!_error)
+                    _error = std::current_exception();
+            }
+            stop();
+        }
+    }
+
+    void record(StageId stage, const PipelineFrame &frame, uint64_t queued, uint64_t begin, uint64_t end) {
+        {
+            std::lock_guard<std::mutex> lock(_statisticsMutex);
+            auto &statistics = _statistics[stage];
+            statistics.frames++;
+            statistics.busyMs += (end - begin) / 1000.0;
+            statistics.waitMs += (begin - queued) / 1000.0;
+        }
+        auto &trace = TraceSink::instance();
+        if (trace.enabled()) {
+            trace.complete(_traceNames[stage], "pipeline", begin, end);
+            if (begin > queued)
+                trace.span(_traceNames[stage] + " queue", "pipeline", frame.index, queued, begin);
+        }
+    }
+
+    void decodeFrames() {
+        for (uint64_t index = 0; !_stopped; index++) {
+            auto frame = std::make_shared<PipelineFrame>();
+            frame->index = index;
+            uint64_t begin = TraceSink::now();
+            if (!_decode(*frame))
+                break;
+            uint64_t end = TraceSink::now();
+            record(Decode, *frame, begin, begin, end);
+            if (!_preprocessQueue.push({frame, end}))
+                break;
+        }
+        _preprocessQueue.close();
+    }
+
+    template <typename F>
+    void startWorkers(StageId stage, size_t workers, FrameQueue &input, FrameQueue &output, const F &process) {
+        auto active = std::make_shared<std::atomic<size_t>>(workers);
+        for (size_t i = 0; i < workers; i++) {
+            _threads.emplace_back([this, stage, active, &input, &output, process]() {
+                runStage([&]() {
+                    QueuedFrame item = {};
+                    while (!_stopped && input.pop(item)) {
+                        auto &frame = *item.frame;
+                        // the pre-processing waits for a free request as long as the pool is empty
+                        if (stage == Preprocess && !_freeRequests.pop(frame.request))
+                            break;
+                        uint64_t begin = TraceSink::now();
+                        process(frame);
+                        uint64_t end = TraceSink::now();
+                        record(stage, frame, item.queued, begin, end);
+                        if (!output.push({item.frame, end}))
+                            break;
+                    }
+                });
+                // the last worker of the stage lets the next stage drain its queue
+                if (--*active == 0)
+                    output.close();
+            });
+        }
+    }
+
+    void sinkFrames() {
+        // the frames come out of the parallel stages out of order, they are delivered by their index
+        std::map<uint64_t, QueuedFrame> pending;
+        uint64_t next = 0;
+        QueuedFrame item = {};
+        while (!_stopped && _sinkQueue.pop(item)) {
+            pending[item.frame->index] = item;
+            for (auto it = pending.begin(); !_stopped && it != pending.end() && it->first == next;
+                 it = pending.erase(it), next++) {
+                uint64_t begin = TraceSink::now();
+                _sink(*it->second.frame);
+                record(Sink, *it->second.frame, it->second.queued, begin, TraceSink::now());
+            }
+        }
+    }
+
+    size_t _requestsCount;
+    InferPipelineConfig _config;
+    Source _decode;
+    Stage _preprocess;
+    Stage _postprocess;
+    Stage _sink;
+
+    BoundedQueue<InferRequest::Ptr> _freeRequests;
+    FrameQueue _preprocessQueue;
+    FrameQueue _inferQueue;
+    FrameQueue _postprocessQueue;
+    FrameQueue _sinkQueue;
+    std::atomic<bool> _stopped{false};
+
+    std::mutex _threadsMutex;
+    std::vector<std::thread> _threads;
+    bool _started = false;
+
+    std::mutex _errorMutex;
+    std::exception_ptr _error;
+
+    mutable std::mutex _statisticsMutex;
+    PipelineStageStatistics _statistics[StagesCount];
+    std::string _traceNames[StagesCount];
+};
+
+InferPipeline::InferPipeline(const std::vector<InferRequest::Ptr> &requests, const InferPipelineConfig &config,
+                             const Source &decode, const Stage &preprocess, const Stage &postprocess,
+                             const Stage &sink)
+        : _impl(new Impl(requests, config, decode, preprocess, postprocess, sink)) {}
+
+InferPipeline::~InferPipeline() = default;
+
+void InferPipeline::start() {
+    _impl->start();
+}
+
+void InferPipeline::wait() {
+    _impl->wait();
+}
+
+void InferPipeline::stop() {
+    _impl->stop();
+}
+
+std::vector<PipelineStageStatistics> InferPipeline::statistics() const {
+    return _impl->statistics();
+}
+
+}  // namespace InferenceEngine
@@ -7,6 +7,7 @@
 #include "ie_layer_validators.hpp"
 #include "debug.h"
 #include "xml_parse_utils.h"
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <map>
@@ -26,12 +27,12 @@ void CNNLayer::validateLayer() {
 }
 
 struct WeightableParams {
-    size_t kernel_w, kernel_h, outputs, groups;
+    size_t kernel_w, kernel_h, kernel_d, outputs, groups;
     bool isKernelFromInput;
 
     WeightableParams(size_t _outputs, bool _isKernelFromInput, size_t _groups = 0, size_t _kernel_h = 0,
-                     size_t _kernel_w = 0) : outputs(_outputs), isKernelFromInput(_isKernelFromInput),
-                                             kernel_h(_kernel_h), kernel_w(_kernel_w),
+                     size_t _kernel_w = 0, size_t _kernel_d = 1) : outputs(_outputs), isKernelFromInput(_isKernelFromInput),
+                                             kernel_h(_kernel_h), kernel_w(_kernel_w), kernel_d(_kernel_d),
                                              groups(_groups) {}
 };
 
@@ -54,7 +55,7 @@ void checkWeightable(const std::map<std::string, Blob::Ptr>& blobs,
 
     if (firstInputShape.empty()) THROW_IE_EXCEPTION << "Input shape can't be empty";
 
-    size_t KW = 1, KH = 1, IC, OC;
+    size_t KW = 1, KH = 1, KD = 1, IC, OC;
     IC = firstInputShape[1];
     if (params.isKernelFromInput) {
         if (firstInputShape.size() == 4) {
@@ -64,6 +65,8 @@ void checkWeightable(const std::map<std::string, Blob::Ptr>& blobs,
     } else {
         KH = params.kernel_h;
         KW = params.kernel_w;
+        if (firstInputShape.size() == 5)
+            KD = params.kernel_d;
     }
     OC = params.outputs;
 
@@ -74,10 +77,11 @@ void checkWeightable(const std::map<std::string, Blob::Ptr>& blobs,
         if (weights == nullptr || weights->dims().empty()) THROW_IE_EXCEPTION << "Weights can't be empty";
 
         auto weightsSize = details::product(weights->dims());
-        size_t expectedWeightsSize = OC * KW * KH * IC;
+        size_t expectedWeightsSize = OC * KW * KH * KD * IC;
         if (params.groups) expectedWeightsSize /= params.groups;
         if (expectedWeightsSize != weightsSize) {
-            THROW_IE_EXCEPTION << "New shapes " << details::dumpVec(firstInputShape) << " make Kernels(" << KH << "x"
+            THROW_IE_EXCEPTION << "New shapes " << details::dumpVec(firstInputShape) << " make Kernels("
+                               << (firstInputShape.size() == 5 ? std::to_string(KD) + "x" : "") << KH << "x"
                                << KW << "), Channels(" << IC << "), Output depth(" << OC << "), Groups("
                                << params.groups << ") not matching weights size: " << weightsSize;
         }
@@ -212,12 +216,16 @@ void ConvolutionValidator::parseParams(CNNLayer* layer) {
     casted->_out_depth = casted->GetParamAsUInt("output");
     casted->_kernel_x = casted->GetParamAsUInt("kernel-x");
     casted->_kernel_y = casted->GetParamAsUInt("kernel-y");
+    casted->_kernel_z = casted->GetParamAsUInt("kernel-z", 1);
     casted->_stride_x = casted->GetParamAsUInt("stride-x", 1);
     casted->_stride_y = casted->GetParamAsUInt("stride-y", 1);
+    casted->_stride_z = casted->GetParamAsUInt("stride-z", 1);
     casted->_padding_x = casted->GetParamAsUInt("pad-x", 0);
     casted->_padding_y = casted->GetParamAsUInt("pad-y", 0);
+    casted->_padding_z = casted->GetParamAsUInt("pad-z", 0);
     casted->_dilation_x = casted->GetParamAsUInt("dilation-x", 1);
     casted->_dilation_y = casted->GetParamAsUInt("dilation-y", 1);
+    casted->_dilation_z = casted->GetParamAsUInt("dilation-z", 1);
     casted->_group = casted->GetParamAsUInt("group", 1);
     // TODO: checks for presence of all required attributes, and that there's no extraneous parameters only.
 
@@ -230,6 +238,10 @@ void ConvolutionValidator::parseParams(CNNLayer* layer) {
         casted->_stride_y = 1;
         LogError("Warning! in layer %s: Stride y is 0, setting to 1", casted->name.c_str());
     }
+    if (0 == casted->_stride_z) {
+        casted->_stride_z = 1;
+        LogError("Warning! in layer %s: Stride z is 0, setting to 1", casted->name.c_str());
+    }
 }
 
 void ConvolutionValidator::checkParams(const CNNLayer* layer) {
@@ -245,8 +257,8 @@ void ConvolutionValidator::checkCorrespondence(const CNNLayer* layer,
                                                const std::vector<SizeVector>& inShapes) const {
     auto casted = dynamic_cast<const ConvolutionLayer*>(layer);
     if (!casted) THROW_IE_EXCEPTION << "Layer is not instance of ConvolutionLayer class";
-    checkWeightable(blobs, inShapes, {casted->_out_depth, false, casted->_group, casted->_kernel_y, casted->_kernel_x},
-                    {4});
+    checkWeightable(blobs, inShapes, {casted->_out_depth, false, casted->_group, casted->_kernel_y, casted->_kernel_x,
+                                      casted->_kernel_z}, {4, 5});
 }
 
 void DeconvolutionValidator::parseParams(CNNLayer* layer) {
@@ -328,6 +340,9 @@ void PoolingValidator::parseParams(CNNLayer* layer) {
         casted->_stride_y = casted->GetParamAsUInt("stride-y", 1);
         casted->_padding_x = casted->GetParamAsUInt("pad-x", 0);
         casted->_padding_y = casted->GetParamAsUInt("pad-y", 0);
+        casted->_kernel_z = casted->GetParamAsUInt("kernel-z", 1);
+        casted->_stride_z = casted->GetParamAsUInt("stride-z", 1);
+        casted->_padding_z = casted->GetParamAsUInt("pad-z", 0);
 
         // TODO: All kind of pool methods
         casted->_exclude_pad = casted->GetParamsAsBool("exclude-pad", false);
@@ -374,6 +389,96 @@ void PowerValidator::checkParams(const CNNLayer* layer) {
 
 PowerValidator::PowerValidator(const std::string& _type) : LayerValidator(_type) {}
 
+void GemmValidator::parseParams(CNNLayer* layer) {
+    auto casted = dynamic_cast<GemmLayer*>(layer);
+    if (!casted) {
+        THROW_IE_EXCEPTION << "Layer is not instance of GemmLayer class";
+    }
+    casted->alpha = casted->GetParamAsFloat("alpha", 1.f);
+    casted->beta = casted->GetParamAsFloat("beta", 1.f);
+    casted->transpose_a = casted->GetParamsAsBool("transpose_a", false);
+    casted->transpose_b = casted->GetParamsAsBool("transpose_b", false);
+}
+
+void GemmValidator::checkParams(const CNNLayer* layer) {
+    LayerValidator::checkParams(layer);
+}
+
+void GemmValidator::checkShapes(const CNNLayer* layer, const std::vector<SizeVector>& inShapes) const {
+    auto casted = dynamic_cast<const GemmLayer*>(layer);
+    if (!casted) {
+        THROW_IE_EXCEPTION << "Layer is not instance of GemmLayer class";
+    }
+    size_t numInputs = inShapes.size();
+    if (numInputs != 2 && numInputs != 3)
+        THROW_IE_EXCEPTION << "Gemm can take only 2 or 3 inputs, but actually it has: " << numInputs;
+    for (const auto& shape : inShapes) {
+        if (shape.size() < 2)
+            THROW_IE_EXCEPTION << "Gemm inputs should have at least 2 dimensions, but one of them has: "
+                               << shape.size();
+    }
+    const SizeVector& shapeA = inShapes[0];
+    const SizeVector& shapeB = inShapes[1];
+    size_t K = casted->transpose_a ? shapeA[shapeA.size() - 2] : shapeA.back();
+    size_t KB = casted->transpose_b ? shapeB.back() : shapeB[shapeB.size() - 2];
+    if (K != KB)
+        THROW_IE_EXCEPTION << "Gemm inputs have the incompatible inner dimensions: " << K << " and " << KB;
+
+    // the i-th dimension from the innermost one, the missing outer dimensions are 1
+    auto dimAt = [](const SizeVector& shape, size_t i) -> size_t {
+        return i < shape.size() ? shape[shape.size() - 1 - i] : 1;
+    };
+    size_t rank = std::max(shapeA.size(), shapeB.size());
+    for (size_t i = 2; i < rank; i++) {
+        size_t a = dimAt(shapeA, i);
+        size_t b = dimAt(shapeB, i);
+        if (a != b && a != 1 && b != 1)
+            THROW_IE_EXCEPTION << "Gemm inputs have the incompatible batch dimensions " << dumpVec(shapeA)
+                               << " and " << dumpVec(shapeB);
+    }
+    if (numInputs == 3) {
+        const SizeVector& shapeC = inShapes[2];
+        size_t M = casted->transpose_a ? shapeA.back() : shapeA[shapeA.size() - 2];
+        size_t N = casted->transpose_b ? shapeB[shapeB.size() - 2] : shapeB.back();
+        bool broadcastable = shapeC.size() <= rank;
+        for (size_t i = 0; i < shapeC.size() && broadcastable; i++) {
+            size_t out = i == 0 ? N : i == 1 ? M : std::max(dimAt(shapeA, i), dimAt(shapeB, i));
+            broadcastable = dimAt(shapeC, i) == out || dimAt(shapeC, i) == 1;
+        }
+        if (!broadcastable)
+            THROW_IE_EXCEPTION << "Gemm third input " << dumpVec(shapeC) << " cannot be broadcast to the output";
+    }
+}
+
+GemmValidator::GemmValidator(const std::string& _type) : LayerValidator(_type) {}
+
+void GatherValidator::parseParams(CNNLayer* layer) {
+    auto casted = dynamic_cast<GatherLayer*>(layer);
+    if (!casted) {
+        THROW_IE_EXCEPTION << "Layer is not instance of GatherLayer class";
+    }
+    casted->axis = casted->GetParamAsInt("axis", 0);
+}
+
+void GatherValidator::checkParams(const CNNLayer* layer) {
+    LayerValidator::checkParams(layer);
+}
+
+void GatherValidator::checkShapes(const CNNLayer* layer, const std::vector<SizeVector>& inShapes) const {
+    auto casted = dynamic_cast<const GatherLayer*>(layer);
+    if (!casted) {
+        THROW_IE_EXCEPTION << "Layer is not instance of GatherLayer class";
+    }
+    if (inShapes.size() != 2)
+        THROW_IE_EXCEPTION << "Gather can take only 2 inputs, but actually it has: " << inShapes.size();
+    int rank = static_cast<int>(inShapes[0].size());
+    if (casted->axis < -rank || casted->axis >= rank)
+        THROW_IE_EXCEPTION << "Gather axis " << casted->axis << " is out of the dictionary dimensions "
+                           << dumpVec(inShapes[0]);
+}
+
+GatherValidator::GatherValidator(const std::string& _type) : LayerValidator(_type) {}
+
 void PReLUValidator::parseParams(CNNLayer* layer) {
     auto casted = dynamic_cast<PReLULayer*>(layer);
     if (!casted) {
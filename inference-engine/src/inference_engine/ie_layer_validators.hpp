@@ -232,6 +232,28 @@ public:
     void checkParams(const CNNLayer* layer) override;
 };
 
+class INFERENCE_ENGINE_API_CLASS(GemmValidator) : public LayerValidator {
+public:
+    explicit GemmValidator(const std::string& _type);
+
+    void parseParams(CNNLayer* layer) override;
+
+    void checkParams(const CNNLayer* layer) override;
+
+    void checkShapes(const CNNLayer* layer, const std::vector<SizeVector>& inShapes) const override;
+};
+
+class INFERENCE_ENGINE_API_CLASS(GatherValidator) : public LayerValidator {
+public:
+    explicit GatherValidator(const std::string& _type);
+
+    void parseParams(CNNLayer* layer) override;
+
+    void checkParams(const CNNLayer* layer) override;
+
+    void checkShapes(const CNNLayer* layer, const std::vector<SizeVector>& inShapes) const override;
+};
+
 class INFERENCE_ENGINE_API_CLASS(PReLUValidator) : public LayerValidator {
 public:
     explicit PReLUValidator(const std::string& _type);
@@ -378,6 +400,8 @@ REG_LAYER_VALIDATOR_FOR_TYPE(NormValidator, LRN);
 REG_LAYER_VALIDATOR_FOR_TYPE(SplitValidator, Split);
 REG_LAYER_VALIDATOR_FOR_TYPE(SplitValidator, Slice);
 REG_LAYER_VALIDATOR_FOR_TYPE(ConcatValidator, Concat);
+REG_LAYER_VALIDATOR_FOR_TYPE(GemmValidator, Gemm);
+REG_LAYER_VALIDATOR_FOR_TYPE(GatherValidator, Gather);
 
 }  // namespace details
 }  // namespace InferenceEngine
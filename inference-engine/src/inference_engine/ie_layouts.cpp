@@ -80,6 +80,15 @@ TensorDesc::TensorDesc(const Precision &precision, SizeVector dims, const Blocki
                     layout = Layout::BLOCKED;
                 }
                 return;
+            case 5:
+                if (blockingDesc.getOrder() == SizeVector{0, 1, 2, 3, 4}) {
+                    layout = Layout::NCDHW;
+                } else if (blockingDesc.getOrder() == SizeVector{0, 2, 3, 4, 1}) {
+                    layout = Layout::NDHWC;
+                } else {
+                    layout = Layout::BLOCKED;
+                }
+                return;
             default:
                 break;
         }
@@ -129,47 +138,73 @@ Layout TensorDesc::getLayoutByDims(SizeVector dims) {
             return Layout::CHW;
         case 4:
             return Layout::NCHW;
+        case 5:
+            return Layout::NCDHW;
         default:
             return Layout::BLOCKED;
     }
 }
 
-size_t TensorDesc::offset(const SizeVector& v) const {
-    if (layout == Layout::ANY)
-        THROW_IE_EXCEPTION << "Cannot calculate offset for any format!";
+namespace {
 
-    SizeVector off_v = v;
+// the offsets are calculated element by element in the loops, so the positions of the common ranks avoid the heap
+const size_t maxLocalDims = 16;
+
+// the offset of the position of the logical dimensions, which is divided by the blocks in place
+size_t blockedOffset(const BlockingDesc& blockingDesc, size_t* pos) {
     const SizeVector& blockedDims = blockingDesc.getBlockDims();
     const SizeVector& strides = blockingDesc.getStrides();
     const SizeVector& order = blockingDesc.getOrder();
+    const SizeVector& paddings = blockingDesc.getOffsetPaddingToData();
 
     size_t n_blocked_dims = order.size();
     if (blockedDims.size() != n_blocked_dims || strides.size() != n_blocked_dims) {
         THROW_IE_EXCEPTION << "Cannot calculate offset. Incorrect primitive descriptor!";
     }
-    SizeVector blockedShift(n_blocked_dims);
-    for (size_t i = 1; i <= n_blocked_dims; i++) {
-        blockedShift[n_blocked_dims - i] = off_v[order[n_blocked_dims - i]] % blockedDims[n_blocked_dims - i];
-        off_v[order[n_blocked_dims - i]] /= blockedDims[n_blocked_dims - i];
-    }
     size_t offset = blockingDesc.getOffsetPadding();
-    for (int d = 0; d < n_blocked_dims; ++d) {
-        const size_t p = blockedShift[d] + blockingDesc.getOffsetPaddingToData()[d];
-        offset += p * strides[d];
+    for (size_t i = 1; i <= n_blocked_dims; i++) {
+        const size_t d = n_blocked_dims - i;
+        const size_t shift = pos[order[d]] % blockedDims[d];
+        pos[order[d]] /= blockedDims[d];
+        offset += (shift + paddings[d]) * strides[d];
     }
     return offset;
 }
 
+}  // namespace
+
+size_t TensorDesc::offset(const SizeVector& v) const {
+    if (layout == Layout::ANY)
+        THROW_IE_EXCEPTION << "Cannot calculate offset for any format!";
+
+    if (v.size() > maxLocalDims) {
+        SizeVector pos = v;
+        return blockedOffset(blockingDesc, pos.data());
+    }
+    size_t pos[maxLocalDims];
+    std::copy(v.begin(), v.end(), pos);
+    return blockedOffset(blockingDesc, pos);
+}
+
 size_t TensorDesc::offset(size_t l) const {
+    if (layout == Layout::ANY)
+        THROW_IE_EXCEPTION << "Cannot calculate offset for any format!";
+
     size_t n_dims = dims.size();
-    SizeVector pos(n_dims);
-    for (int rd = 0; rd < n_dims; ++rd) {
+    SizeVector heapPos;
+    size_t localPos[maxLocalDims];
+    size_t* pos = localPos;
+    if (n_dims > maxLocalDims) {
+        heapPos.resize(n_dims);
+        pos = heapPos.data();
+    }
+    for (size_t rd = 0; rd < n_dims; ++rd) {
         const size_t d = n_dims - 1 - rd;
         const size_t cur_dim = dims[d];
         pos[d] = l % cur_dim;
         l /= cur_dim;
     }
-    return offset(pos);
+    return blockedOffset(blockingDesc, pos);
 }
 
 void TensorDesc::reshape(const SizeVector &dims, Layout layout) {
@@ -254,6 +289,16 @@ BlockingDesc::BlockingDesc(const SizeVector& dims, Layout layout): offsetPadding
             l_order = {0, 2, 3, 1};
             l_dims = {dims[0], dims[2], dims[3], dims[1]};
             break;
+        case Layout::NCDHW:
+            checkDims(dims.size(), 5);
+            l_order = {0, 1, 2, 3, 4};
+            l_dims = dims;
+            break;
+        case Layout::NDHWC:
+            checkDims(dims.size(), 5);
+            l_order = {0, 2, 3, 4, 1};
+            l_dims = {dims[0], dims[2], dims[3], dims[4], dims[1]};
+            break;
         case Layout::CHW:
             checkDims(dims.size(), 3);
             l_order = {0, 1, 2};
@@ -0,0 +1,65 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_load_profile.hpp"
+#include "details/ie_exception.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+
+LoadProfile &LoadProfile::instance() {
+    static LoadProfile profile;
+    return profile;
+}
+
+void LoadProfile::reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _phases.clear();
+}
+
+void LoadProfile::add(const std::string &phase, double ms) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = std::find_if(_phases.begin(), _phases.end(), [&](const LoadPhase &item) {
+        return item.name == phase;
+    });
+    if (found == _phases.end()) {
+        _phases.push_back({phase, ms, 1});
+    } else {
+        found->totalMs += ms;
+        found->count++;
+    }
+}
+
+std::vector<LoadPhase> LoadProfile::phases() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _phases;
+}
+
+namespace {
+
+LoadProgress::Ptr &currentProgress() {
+    static thread_local LoadProgress::Ptr progress;
+    return progress;
+}
+
+}  // namespace
+
+void LoadProgress::setCurrent(const Ptr &progress) {
+    currentProgress() = progress;
+}
+
+void LoadProgress::phaseStarted(const char *phase) {
+    const Ptr &progress = currentProgress();
+    if (!progress)
+        return;
+    if (progress->_cancelled)
+        THROW_IE_EXCEPTION << "The network loading is cancelled before the phase " << phase;
+    if (progress->_callback)
+        progress->_callback(phase);
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,53 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_parallel.hpp"
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace InferenceEngine {
+namespace details {
+
+WorkStealingTaskExecutor &getParallelExecutor() {
+    static WorkStealingTaskExecutor executor(0, "Parallel");
+    return executor;
+}
+
+void parallel_ranges(size_t count, const std::function<void(size_t, size_t)> &body, size_t grain) {
+    const size_t ranges = std::max<size_t>(1, count / std::max<size_t>(1, grain));
+    const size_t threads = std::min<size_t>(ranges, std::max(1u, std::thread::hardware_concurrency()));
+    if (threads <= 1) {
+        body(0, count);
+        return;
+    }
+
+    const size_t chunk = (count + threads - 1) / threads;
+    std::vector<Task::Ptr> tasks;
+    for (size_t begin = chunk; begin < count; begin += chunk) {
+        const size_t end = std::min(count, begin + chunk);
+        tasks.push_back(std::make_shared<Task>([&body, begin, end]() { body(begin, end); }));
+        getParallelExecutor().startTask(tasks.back());
+    }
+    std::exception_ptr exception;
+    try {
+        body(0, chunk);
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    for (auto &task : tasks) {
+        task->wait(-1);
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+    for (auto &task : tasks) {
+        task->checkException();
+    }
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
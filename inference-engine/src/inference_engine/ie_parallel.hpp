@@ -0,0 +1,30 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include "cpp_interfaces/ie_work_stealing_task_executor.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Dedicated pool of the threads executing the parallel parts of the library (pre-processing, conversions)
+ */
+WorkStealingTaskExecutor &getParallelExecutor();
+
+/**
+ * @brief Splits [0, count) into the contiguous ranges and calls body(begin, end) for them in parallel.
+ * The calling thread takes the first range, the others go to the pool of the library.
+ * @param count - the number of the items
+ * @param body - the function processing the range of the items
+ * @param grain - the smallest range worth a separate thread
+ */
+void parallel_ranges(size_t count, const std::function<void(size_t, size_t)> &body, size_t grain = 1);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,284 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "ie_blob.h"
+#include "ie_preprocess.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Fused color conversion, bilinear resize and layout conversion of an input image.
+ * Every pixel of the output (network input) blob is computed in a single pass over the source image: the source
+ * samples are interpolated in the source color space and converted to the BGR color order of the network,
+ * then stored in the layout (NCHW or NHWC) and precision (U8 or FP32) of the output blob.
+ *
+ * The source blob is U8 and, depending on the color format, has:
+ * - RGB, BGR: 3 channels, NCHW or NHWC layout
+ * - RGBX, BGRX: 4 channels (the fourth is ignored), NHWC layout
+ * - NV12: 1 channel, the height is 3/2 of the image height: the Y plane followed by the interleaved UV plane
+ *
+ * The rows of the output are independent, so they can be computed in parallel by the caller.
+ */
+class ColorConvertResize {
+public:
+    ColorConvertResize(const Blob::Ptr &inBlob, const Blob::Ptr &outBlob, ColorFormat colorFormat)
+            : _colorFormat(colorFormat) {
+        const auto &inDesc = inBlob->getTensorDesc();
+        const auto &outDesc = outBlob->getTensorDesc();
+        if (inDesc.getDims().size() != 4 || outDesc.getDims().size() != 4)
+            THROW_IE_EXCEPTION << "Color conversion supports only 4D blobs";
+        if (inDesc.getPrecision() != Precision::U8)
+            THROW_IE_EXCEPTION << "Color conversion supports only U8 source images";
+        if (outDesc.getPrecision() != Precision::U8 && outDesc.getPrecision() != Precision::FP32)
+            THROW_IE_EXCEPTION << "Color conversion supports only U8 and FP32 network inputs";
+        if (outDesc.getLayout() != NCHW && outDesc.getLayout() != NHWC)
+            THROW_IE_EXCEPTION << "Color conversion supports only NCHW and NHWC network inputs";
+
+        const auto &inDims = inDesc.getDims();
+        const auto &outDims = outDesc.getDims();
+        if (outDims[1] != 3)
+            THROW_IE_EXCEPTION << "Color conversion requires the network input with 3 channels";
+        if (inDims[0] != outDims[0])
+            THROW_IE_EXCEPTION << "Color conversion requires the same batch of the image and the network input";
+
+        _batch = outDims[0];
+        _srcW = inDims[3];
+        switch (colorFormat) {
+        case RGB:
+        case BGR:
+            if (inDims[1] != 3)
+                THROW_IE_EXCEPTION << "RGB and BGR images must have 3 channels";
+            if (inDesc.getLayout() != NCHW && inDesc.getLayout() != NHWC)
+                THROW_IE_EXCEPTION << "RGB and BGR images must have NCHW or NHWC layout";
+            _srcH = inDims[2];
+            _srcPlanar = inDesc.getLayout() == NCHW;
+            _srcChannels = 3;
+            break;
+        case RGBX:
+        case BGRX:
+            if (inDims[1] != 4 || inDesc.getLayout() != NHWC)
+                THROW_IE_EXCEPTION << "RGBX and BGRX images must have 4 channels and NHWC layout";
+            _srcH = inDims[2];
+            _srcChannels = 4;
+            break;
+        case NV12:
+            // the chroma plane has the half of the image height, so the height of the blob must be divisible by 3
+            if (inDims[1] != 1 || inDims[2] % 3 != 0 || _srcW % 2 != 0)
+                THROW_IE_EXCEPTION << "NV12 image must have 1 channel, even width and the height of 3/2 of "
+                                      "the even image height";
+            _srcH = inDims[2] * 2 / 3;
+            _srcChannels = 1;
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported color format " << colorFormat;
+        }
+
+        _src = inBlob->cbuffer().as<const uint8_t *>() + inDesc.getBlockingDesc().getOffsetPadding();
+        _srcImageSize = inDims[1] * inDims[2] * inDims[3];
+        _dstW = outDims[3];
+        _dstH = outDims[2];
+        _dstPlanar = outDesc.getLayout() == NCHW;
+        _dstFP32 = outDesc.getPrecision() == Precision::FP32;
+        _dst = outBlob->buffer().as<uint8_t *>() +
+               outDesc.getBlockingDesc().getOffsetPadding() * outDesc.getPrecision().size();
+
+        fillTable(_srcW, _dstW, _x);
+        fillTable(_srcH, _dstH, _y);
+        if (colorFormat == NV12) {
+            // the chroma samples are centered between the luma ones, so the same mapping applies to the halved planes
+            fillTable(_srcW / 2, _dstW, _chromaX);
+            fillTable(_srcH / 2, _dstH, _chromaY);
+        }
+    }
+
+    size_t imageWidth() const {
+        return _srcW;
+    }
+
+    size_t imageHeight() const {
+        return _srcH;
+    }
+
+    /**
+     * @brief Returns the total number of the output rows (batch * height)
+     */
+    size_t rows() const {
+        return _batch * _dstH;
+    }
+
+    /**
+     * @brief Computes the output rows [rowBegin, rowEnd)
+     */
+    void run(size_t rowBegin, size_t rowEnd) const {
+        for (size_t row = rowBegin; row < rowEnd; row++) {
+            const size_t n = row / _dstH;
+            const size_t y = row % _dstH;
+            const uint8_t *image = _src + n * _srcImageSize;
+            if (_colorFormat == NV12)
+                runNV12Row(image, n, y);
+            else
+                runRGBRow(image, n, y);
+        }
+    }
+
+private:
+    struct Coord {
+        size_t i0, i1;
+        float w;
+    };
+
+    // pixel centers are aligned, the coordinates outside of the image are clamped to the border
+    static void fillTable(size_t srcSize, size_t dstSize, std::vector<Coord> &table) {
+        const float scale = static_cast<float>(srcSize) / dstSize;
+        table.resize(dstSize);
+        for (size_t i = 0; i < dstSize; i++) {
+            float f = (i + 0.5f) * scale - 0.5f;
+            if (f < 0.f) f = 0.f;
+            auto i0 = static_cast<size_t>(f);
+            if (i0 > srcSize - 1) i0 = srcSize - 1;
+            table[i].i0 = i0;
+            table[i].i1 = std::min(i0 + 1, srcSize - 1);
+            table[i].w = std::min(1.f, f - i0);
+        }
+    }
+
+    static float lerp(float a, float b, float w) {
+        return a + (b - a) * w;
+    }
+
+    void store(size_t n, size_t y, size_t x, float b, float g, float r) const {
+        const size_t imageSize = 3 * _dstH * _dstW;
+        size_t idx[3];
+        for (size_t c = 0; c < 3; c++) {
+            idx[c] = n * imageSize + (_dstPlanar ? (c * _dstH + y) * _dstW + x : (y * _dstW + x) * 3 + c);
+        }
+        if (_dstFP32) {
+            auto dst = reinterpret_cast<float *>(_dst);
+            dst[idx[0]] = b;
+            dst[idx[1]] = g;
+            dst[idx[2]] = r;
+        } else {
+            auto saturate = [](float v) {
+                return static_cast<uint8_t>(std::min(255.f, std::max(0.f, v + 0.5f)));
+            };
+            _dst[idx[0]] = saturate(b);
+            _dst[idx[1]] = saturate(g);
+            _dst[idx[2]] = saturate(r);
+        }
+    }
+
+    void runRGBRow(const uint8_t *image, size_t n, size_t y) const {
+        const Coord &cy = _y[y];
+        // the position of the channel in the pixel, and the distance between the channels
+        const size_t pixelStep = _srcPlanar ? 1 : _srcChannels;
+        const size_t channelStep = _srcPlanar ? _srcH * _srcW : 1;
+        const bool swapRB = _colorFormat == RGB || _colorFormat == RGBX;
+        const uint8_t *row0 = image + cy.i0 * _srcW * pixelStep;
+        const uint8_t *row1 = image + cy.i1 * _srcW * pixelStep;
+        for (size_t x = 0; x < _dstW; x++) {
+            const Coord &cx = _x[x];
+            float v[3];
+            for (size_t c = 0; c < 3; c++) {
+                const size_t o0 = cx.i0 * pixelStep + c * channelStep;
+                const size_t o1 = cx.i1 * pixelStep + c * channelStep;
+                v[c] = lerp(lerp(row0[o0], row0[o1], cx.w), lerp(row1[o0], row1[o1], cx.w), cy.w);
+            }
+            if (swapRB)
+                store(n, y, x, v[2], v[1], v[0]);
+            else
+                store(n, y, x, v[0], v[1], v[2]);
+        }
+    }
+
+    void runNV12Row(const uint8_t *image, size_t n, size_t y) const {
+        const Coord &cy = _y[y];
+        const Coord &ccy = _chromaY[y];
+        const uint8_t *yRow0 = image + cy.i0 * _srcW;
+        const uint8_t *yRow1 = image + cy.i1 * _srcW;
+        const uint8_t *uvPlane = image + _srcH * _srcW;
+        const uint8_t *uvRow0 = uvPlane + ccy.i0 * _srcW;
+        const uint8_t *uvRow1 = uvPlane + ccy.i1 * _srcW;
+        for (size_t x = 0; x < _dstW; x++) {
+            const Coord &cx = _x[x];
+            const Coord &ccx = _chromaX[x];
+            const float luma = lerp(lerp(yRow0[cx.i0], yRow0[cx.i1], cx.w),
+                                    lerp(yRow1[cx.i0], yRow1[cx.i1], cx.w), cy.w);
+            float uv[2];
+            for (size_t c = 0; c < 2; c++) {
+                const size_t o0 = ccx.i0 * 2 + c;
+                const size_t o1 = ccx.i1 * 2 + c;
+                uv[c] = lerp(lerp(uvRow0[o0], uvRow0[o1], ccx.w), lerp(uvRow1[o0], uvRow1[o1], ccx.w), ccy.w);
+            }
+            // BT.601 limited range
+            const float c = 1.164f * (luma - 16.f);
+            const float d = uv[0] - 128.f;
+            const float e = uv[1] - 128.f;
+            store(n, y, x, c + 2.018f * d, c - 0.391f * d - 0.813f * e, c + 1.596f * e);
+        }
+    }
+
+    ColorFormat _colorFormat;
+    size_t _batch = 0;
+    size_t _srcW = 0, _srcH = 0, _srcChannels = 0, _srcImageSize = 0;
+    bool _srcPlanar = false;
+    size_t _dstW = 0, _dstH = 0;
+    bool _dstPlanar = true, _dstFP32 = false;
+    const uint8_t *_src = nullptr;
+    uint8_t *_dst = nullptr;
+    std::vector<Coord> _x, _y, _chromaX, _chromaY;
+};
+
+/**
+ * @brief Converts the image to the network input according to the color format and the resize algorithm.
+ * The bilinear resize is fused with the color conversion, the area resize is done after the conversion of
+ * the whole image to the temporary blob.
+ * @param image - the source image
+ * @param outBlob - the network input
+ * @param info - pre-processing information of the input
+ * @param tmp - the temporary blob, kept by the caller between the calls
+ * @param runRows - callable (kernel) executing kernel.run() for all the rows of the kernel, possibly in parallel
+ * @param resize - callable (in, out, algorithm) resizing the planar blobs of the same precision
+ */
+template <typename RowsRunner, typename Resizer>
+void colorConvertResize(const Blob::Ptr &image, Blob::Ptr &outBlob, const PreProcessInfo &info, Blob::Ptr &tmp,
+                        RowsRunner runRows, Resizer resize) {
+    const ResizeAlgorithm algorithm = info.getResizeAlgorithm();
+    const SizeVector &outDims = outBlob->getTensorDesc().getDims();
+    if (algorithm != RESIZE_AREA) {
+        ColorConvertResize kernel(image, outBlob, info.getColorFormat());
+        if (algorithm == NO_RESIZE && (kernel.imageHeight() != outDims[2] || kernel.imageWidth() != outDims[3]))
+            THROW_IE_EXCEPTION << "Input image size differs from the network input size, but no resize algorithm is set";
+        runRows(kernel);
+        return;
+    }
+
+    const SizeVector &imageDims = image->getTensorDesc().getDims();
+    if (imageDims.size() != 4)
+        THROW_IE_EXCEPTION << "Color conversion supports only 4D blobs";
+    const size_t imageHeight = info.getColorFormat() == NV12 ? imageDims[2] * 2 / 3 : imageDims[2];
+    SizeVector tmpDims = {outDims[0], 3, imageHeight, imageDims[3]};
+    if (!tmp || tmp->getTensorDesc().getDims() != tmpDims ||
+        tmp->getTensorDesc().getPrecision() != outBlob->getTensorDesc().getPrecision()) {
+        if (outBlob->getTensorDesc().getPrecision() == Precision::FP32)
+            tmp = make_shared_blob<float>(TensorDesc(Precision::FP32, tmpDims, NCHW));
+        else
+            tmp = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, tmpDims, NCHW));
+        tmp->allocate();
+    }
+    ColorConvertResize kernel(image, tmp, info.getColorFormat());
+    runRows(kernel);
+    resize(tmp, outBlob, algorithm);
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -4,9 +4,18 @@
 //
 
 #include <algorithm>
+#include <exception>
+#include <functional>
+#include <list>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <immintrin.h>
 #include "ie_preprocess_data.hpp"
+#include "ie_preprocess_color.hpp"
 #include "blob_transform.hpp"
+#include "blob_factory.hpp"
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 
@@ -18,6 +27,13 @@ namespace {
 # define ALWAYS_INLINE  static __inline
 #endif
 
+// the kernels are compiled for several instruction sets, the best one for the CPU is selected at load time
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 6) && defined(__linux__)
+# define MULTIVERSION  __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+# define MULTIVERSION
+#endif
+
 #define MAX(v1, v2) ((v1) < (v2) ? (v2) : (v1))
 #define MIN(v1, v2) ((v1) < (v2) ? (v1) : (v2))
 
@@ -56,7 +72,8 @@ ALWAYS_INLINE uint8_t saturateU32toU8(uint32_t v) {
     return static_cast<uint8_t>(v > UINT8_MAX ? UINT8_MAX : v);
 }
 
-void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
+MULTIVERSION
+void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer, bool tables_ready) {
     Border border = {REPLICATE, 0};
 
     auto dstDims = outBlob->getTensorDesc().getDims();
@@ -120,50 +137,53 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
     tptr_[swidth * kRowsBlockSize + 2 + 4] = (uint8_t) border.value;
     tptr_[swidth * kRowsBlockSize + 3 + 4] = (uint8_t) border.value;
 
-    for (int dx = dst_go_x; dx < dst_go_x + dwidth; dx++) {
-        auto fx = static_cast<float>((dx + 0.5) * scale_x - 0.5);
-        int32_t sx = floor(fx);
-        fx -= sx;
+    // the tables of the coordinates and the weights are kept by the cached buffer
+    if (!tables_ready) {
+        for (int dx = dst_go_x; dx < dst_go_x + dwidth; dx++) {
+            auto fx = static_cast<float>((dx + 0.5) * scale_x - 0.5);
+            int32_t sx = floor(fx);
+            fx -= sx;
+
+            int32_t sx0 = sx;
+            if (sx < 0 && border.type == REPLICATE) {
+                fx = 0;
+                sx0 = 0;
+            }
 
-        int32_t sx0 = sx;
-        if (sx < 0 && border.type == REPLICATE) {
-            fx = 0;
-            sx0 = 0;
-        }
+            fx = fx * SCALE;
 
-        fx = fx * SCALE;
+            if (sx >= src_full_width - 1 && border.type == REPLICATE) {
+                fx = 1.f * SCALE - 1;
+                sx0 = MAX(src_full_width - 2, 0);
+            }
 
-        if (sx >= src_full_width - 1 && border.type == REPLICATE) {
-            fx = 1.f * SCALE - 1;
-            sx0 = MAX(src_full_width - 2, 0);
+            pxofs1[dx - dst_go_x] = kRowsBlockSize * (sx0 - src_go_x);
+            for (int i = 0; i < alpha_clones_num; i++) {
+                alpha[(dx - dst_go_x) * alpha_clones_num + i] = (int16_t) fx;
+            }
         }
 
-        pxofs1[dx - dst_go_x] = kRowsBlockSize * (sx0 - src_go_x);
-        for (int i = 0; i < alpha_clones_num; i++) {
-            alpha[(dx - dst_go_x) * alpha_clones_num + i] = (int16_t) fx;
-        }
-    }
+        for (int dy = dst_go_y; dy < dst_go_y + dheight; dy++) {
+            float fy = static_cast<float>((dy + 0.5) * scale_y - 0.5);
+            int32_t sy = floor(fy);
+            fy -= sy;
 
-    for (int dy = dst_go_y; dy < dst_go_y + dheight; dy++) {
-        float fy = static_cast<float>((dy + 0.5) * scale_y - 0.5);
-        int32_t sy = floor(fy);
-        fy -= sy;
+            int32_t sy0 = sy;
+            if (sy < 0 && border.type == REPLICATE) {
+                fy = 0;
+                sy0 = 0;
+            }
 
-        int32_t sy0 = sy;
-        if (sy < 0 && border.type == REPLICATE) {
-            fy = 0;
-            sy0 = 0;
-        }
+            fy = fy * SCALE;
 
-        fy = fy * SCALE;
+            if (sy >= src_full_height - 1 && border.type == REPLICATE) {
+                fy = 1.f * SCALE - 1;
+                sy0 = MAX(src_full_height - 2, 0);
+            }
 
-        if (sy >= src_full_height - 1 && border.type == REPLICATE) {
-            fy = 1.f * SCALE - 1;
-            sy0 = MAX(src_full_height - 2, 0);
+            yofs[dy - dst_go_y] = (sy0 - src_go_y) * sstep;
+            beta[dy - dst_go_y] = (int16_t) fy;
         }
-
-        yofs[dy - dst_go_y] = (sy0 - src_go_y) * sstep;
-        beta[dy - dst_go_y] = (int16_t) fy;
     }
 
     if (swidth < cols_block_size || dwidth < cols_block_size || dheight < kRowsBlockSize) {
@@ -372,7 +392,8 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
     }
 }
 
-void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
+MULTIVERSION
+void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer, bool tables_ready) {
     Border border = {REPLICATE, 0};
 
     auto dstDims = outBlob->getTensorDesc().getDims();
@@ -412,44 +433,47 @@ void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* bu
     auto* beta = alpha + dwidth;
     auto* tptr = beta + dheight;
 
-    for (int dx = dst_go_x; dx < dst_go_x + dwidth; dx++) {
-        auto fx = static_cast<float>((dx + 0.5) * scale_x - 0.5);
-        int32_t sx = floor(fx);
-        fx -= sx;
+    // the tables of the coordinates and the weights are kept by the cached buffer
+    if (!tables_ready) {
+        for (int dx = dst_go_x; dx < dst_go_x + dwidth; dx++) {
+            auto fx = static_cast<float>((dx + 0.5) * scale_x - 0.5);
+            int32_t sx = floor(fx);
+            fx -= sx;
+
+            int32_t sx0 = sx;
+            if (sx < 0 && border.type == REPLICATE) {
+                fx = 0;
+                sx0 = 0;
+            }
 
-        int32_t sx0 = sx;
-        if (sx < 0 && border.type == REPLICATE) {
-            fx = 0;
-            sx0 = 0;
-        }
+            if (sx >= src_full_width - 1 && border.type == REPLICATE) {
+                fx = 1.f;
+                sx0 = std::max(src_full_width - 2, 0);
+            }
 
-        if (sx >= src_full_width - 1 && border.type == REPLICATE) {
-            fx = 1.f;
-            sx0 = std::max(src_full_width - 2, 0);
+            xofs[dx - dst_go_x] = (int16_t)(sx0 - src_go_x);
+            alpha[dx - dst_go_x] = fx;
         }
 
-        xofs[dx - dst_go_x] = (int16_t)(sx0 - src_go_x);
-        alpha[dx - dst_go_x] = fx;
-    }
+        for (int dy = dst_go_y; dy < dst_go_y + dheight; dy++) {
+            auto fy = static_cast<float>((dy + 0.5) * scale_y - 0.5);
+            int32_t sy = floor(fy);
+            fy -= sy;
 
-    for (int dy = dst_go_y; dy < dst_go_y + dheight; dy++) {
-        auto fy = static_cast<float>((dy + 0.5) * scale_y - 0.5);
-        int32_t sy = floor(fy);
-        fy -= sy;
+            int32_t sy0 = sy;
+            if (sy < 0 && border.type == REPLICATE) {
+                fy = 0;
+                sy0 = 0;
+            }
 
-        int32_t sy0 = sy;
-        if (sy < 0 && border.type == REPLICATE) {
-            fy = 0;
-            sy0 = 0;
-        }
+            if (sy >= src_full_height - 1 && border.type == REPLICATE) {
+                fy = 1.f;
+                sy0 = std::max(src_full_height - 2, 0);
+            }
 
-        if (sy >= src_full_height - 1 && border.type == REPLICATE) {
-            fy = 1.f;
-            sy0 = std::max(src_full_height - 2, 0);
+            yofs[dy - dst_go_y] = (sy0 - src_go_y);
+            beta[dy - dst_go_y] = fy;
         }
-
-        yofs[dy - dst_go_y] = (sy0 - src_go_y);
-        beta[dy - dst_go_y] = fy;
     }
 
     auto full_pass = [&](int c, int y) {
@@ -590,7 +614,9 @@ void generate_alpha_and_id_arrays(int x_max_count, int dcols, const uint16_t* xa
     }
 }
 
-void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
+// the tables are ready when the buffer was already used for the images of the same sizes
+MULTIVERSION
+void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer, bool tables_ready) {
     auto dstDims = outBlob->getTensorDesc().getDims();
     auto srcDims = inBlob->getTensorDesc().getDims();
 
@@ -633,8 +659,10 @@ void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t
     auto* xalpha = ysi + dheight;
     auto* yalpha = xalpha + dwidth*x_max_count + 8*16;
 
-    computeResizeAreaTab(src_go_x, dst_go_x, src_full_width,   dwidth, scale_x, xsi, xalpha, x_max_count);
-    computeResizeAreaTab(src_go_y, dst_go_y, src_full_height, dheight, scale_y, ysi, yalpha, y_max_count);
+    if (!tables_ready) {
+        computeResizeAreaTab(src_go_x, dst_go_x, src_full_width,   dwidth, scale_x, xsi, xalpha, x_max_count);
+        computeResizeAreaTab(src_go_y, dst_go_y, src_full_height, dheight, scale_y, ysi, yalpha, y_max_count);
+    }
 
     int vest_sum_size = 2*swidth;
     uint16_t* vert_sum = yalpha + dheight*y_max_count;
@@ -649,7 +677,9 @@ void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t
 
     uint16_t* alpha[] = {alpha0, alpha1, alpha2, alpha3};
     uint16_t* sxid[] = {sxid0, sxid1, sxid2, sxid3};
-    generate_alpha_and_id_arrays(x_max_count, dwidth, xalpha, xsi, alpha, sxid);
+    if (!tables_ready) {
+        generate_alpha_and_id_arrays(x_max_count, dwidth, xalpha, xsi, alpha, sxid);
+    }
 
     auto full_pass = [&](int c, int y) {
         uint8_t* pdst_row = dptr + (y * dstep) + c * origDstW * origDstH;
@@ -955,6 +985,7 @@ int computeResizeAreaTabFP32(int src_go, int dst_go, int ssize, int dsize, float
     return k;
 }
 
+MULTIVERSION
 void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
     auto dstDims = outBlob->getTensorDesc().getDims();
     auto srcDims = inBlob->getTensorDesc().getDims();
@@ -1119,6 +1150,7 @@ void VResizeLinear(float** src, data_t* dst, const float* beta, int width) {
 }
 
 template<typename data_t>
+MULTIVERSION
 static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
     auto dstDims = outBlob->getTensorDesc().getDims();
     auto srcDims = inBlob->getTensorDesc().getDims();
@@ -1314,40 +1346,88 @@ size_t resize_get_buffer_size(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeA
     return buffer_size;
 }
 
-void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorithm) {
-    if (inBlob->getTensorDesc().getLayout() != NCHW || outBlob->getTensorDesc().getLayout() != NCHW)
-        THROW_IE_EXCEPTION << "Resize supports only NCHW layout";
-
-    if (!((inBlob->getTensorDesc().getPrecision() == Precision::U8 && outBlob->getTensorDesc().getPrecision() == Precision::U8) ||
-          (inBlob->getTensorDesc().getPrecision() == Precision::FP32 && outBlob->getTensorDesc().getPrecision() == Precision::FP32)))
-        THROW_IE_EXCEPTION << "Resize supports only U8 and FP32 precisions";
+/**
+ * @brief Buffers of the resize kernels with the coordinate and weight tables computed for the recently used
+ * (algorithm, precision, source size, source row stride, destination size) combinations.
+ * The tables are placed at the beginning of the buffer and the following scratch space is rewritten by every call,
+ * so a video stream of the same resolution computes the tables only once per thread.
+ */
+class ResizeTablesCache {
+public:
+    uint8_t *get(const Blob::Ptr &inBlob, const Blob::Ptr &outBlob, ResizeAlgorithm algorithm,
+                 size_t bufferSize, bool &tablesReady) {
+        const auto &srcDims = inBlob->getTensorDesc().getDims();
+        const auto &dstDims = outBlob->getTensorDesc().getDims();
+        const Key key = {algorithm, inBlob->getTensorDesc().getPrecision(),
+                         inBlob->getTensorDesc().getBlockingDesc().getStrides()[2],
+                         srcDims[3], srcDims[2], dstDims[3], dstDims[2]};
+        for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+            if (it->first == key) {
+                _entries.splice(_entries.begin(), _entries, it);
+                // the layout of the tables depends only on the key, the resize keeps the content
+                auto &buffer = _entries.front().second;
+                if (buffer.size() < bufferSize)
+                    buffer.resize(bufferSize);
+                tablesReady = true;
+                return buffer.data();
+            }
+        }
+        if (_entries.size() >= maxEntries) {
+            _entries.pop_back();
+        }
+        _entries.emplace_front(key, std::vector<uint8_t>(bufferSize));
+        tablesReady = false;
+        return _entries.front().second.data();
+    }
 
-    if (algorithm != RESIZE_BILINEAR && algorithm != RESIZE_AREA)
-        THROW_IE_EXCEPTION << "Unsupported resize algorithm type";
+private:
+    struct Key {
+        ResizeAlgorithm algorithm;
+        Precision precision;
+        size_t srcStride, srcW, srcH, dstW, dstH;
+        bool operator==(const Key &other) const {
+            return algorithm == other.algorithm && precision == other.precision && srcStride == other.srcStride &&
+                   srcW == other.srcW && srcH == other.srcH && dstW == other.dstW && dstH == other.dstH;
+        }
+    };
 
-    size_t buffer_size = resize_get_buffer_size(inBlob, outBlob, algorithm);
-    auto* buffer = static_cast<uint8_t *>(malloc(buffer_size));
-    if (buffer == nullptr) {
-        THROW_IE_EXCEPTION << "Could not allocate memory for blob";
-    }
+    static constexpr size_t maxEntries = 16;
+    std::list<std::pair<Key, std::vector<uint8_t>>> _entries;
+};
 
+void resize_plane(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorithm) {
     auto dstDims = outBlob->getTensorDesc().getDims();
     auto srcDims = inBlob->getTensorDesc().getDims();
     float scale_x = static_cast<float>(dstDims[3]) / srcDims[3];
     float scale_y = static_cast<float>(dstDims[2]) / srcDims[2];
 
-    if (algorithm == RESIZE_BILINEAR) {
-        if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
-            resize_bilinear_u8(inBlob, outBlob, buffer);
+    size_t buffer_size = resize_get_buffer_size(inBlob, outBlob, algorithm);
+    bool is_u8 = inBlob->getTensorDesc().getPrecision() == Precision::U8;
+    if (algorithm == RESIZE_BILINEAR || (algorithm == RESIZE_AREA && is_u8 && scale_x < 1 && scale_y < 1)) {
+        // the kernels with the precomputed tables take them from the cache of the thread
+        thread_local ResizeTablesCache tablesCache;
+        bool tables_ready = false;
+        auto* buffer = tablesCache.get(inBlob, outBlob, algorithm, buffer_size, tables_ready);
+        if (algorithm == RESIZE_AREA) {
+            resize_area_u8_downscale(inBlob, outBlob, buffer, tables_ready);
+        } else if (is_u8) {
+            resize_bilinear_u8(inBlob, outBlob, buffer, tables_ready);
         } else {
-            resize_bilinear_fp32(inBlob, outBlob, buffer);
+            resize_bilinear_fp32(inBlob, outBlob, buffer, tables_ready);
         }
-    } else if (algorithm == RESIZE_AREA) {
-        if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
-            if (scale_x < 1 && scale_y < 1)
-                resize_area_u8_downscale(inBlob, outBlob, buffer);
-            else
-                resize_area_upscale<uint8_t>(inBlob, outBlob, buffer);
+        return;
+    }
+
+    // the scratch buffer of the thread is reused by the following calls
+    thread_local std::vector<uint8_t> scratch;
+    if (scratch.size() < buffer_size) {
+        scratch.resize(buffer_size);
+    }
+    auto* buffer = scratch.data();
+
+    if (algorithm == RESIZE_AREA) {
+        if (is_u8) {
+            resize_area_upscale<uint8_t>(inBlob, outBlob, buffer);
         } else {
             if (scale_x < 1 && scale_y < 1)
                 resize_area_fp32_downscale(inBlob, outBlob, buffer);
@@ -1355,20 +1435,120 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
                 resize_area_upscale<float>(inBlob, outBlob, buffer);
         }
     }
+}
+
+/**
+ * @brief Keeps the temporary NCHW blob if it matches the precision and the dimensions, otherwise recreates it
+ */
+void reuse_or_create_planar(Blob::Ptr &tmp, Precision precision, const SizeVector &dims) {
+    if (tmp && tmp->getTensorDesc().getPrecision() == precision && tmp->getTensorDesc().getDims() == dims)
+        return;
+    // the frames of other sizes come and go, so the scratch blobs are taken from the pool
+    tmp = make_pooled_blob(TensorDesc(precision == Precision::FP32 ? Precision::FP32 : Precision::U8, dims, NCHW));
+}
+
+template <typename T>
+Blob::Ptr make_image_view(const Blob::Ptr &blob, size_t n) {
+    const auto &desc = blob->getTensorDesc();
+    const auto &dims = desc.getDims();
+    const auto &strides = desc.getBlockingDesc().getStrides();
+    SizeVector imageDims = {1, dims[1], dims[2], dims[3]};
+    BlockingDesc imageBlocking(imageDims, {0, 1, 2, 3}, 0, {0, 0, 0, 0}, strides);
+    T *image = blob->buffer().as<T *>() + desc.getBlockingDesc().getOffsetPadding() + n * strides[0];
+    return make_shared_blob<T>(TensorDesc(desc.getPrecision(), imageDims, imageBlocking), image);
+}
+
+template <typename T>
+Blob::Ptr make_plane_view(const Blob::Ptr &blob, size_t n, size_t c) {
+    const auto &desc = blob->getTensorDesc();
+    const auto &dims = desc.getDims();
+    const auto &strides = desc.getBlockingDesc().getStrides();
+    SizeVector planeDims = {1, 1, dims[2], dims[3]};
+    // the strides are kept, so the view addresses the plane inside of the whole blob (or the image of the ROI)
+    BlockingDesc planeBlocking(planeDims, {0, 1, 2, 3}, 0, {0, 0, 0, 0}, strides);
+    T *plane = blob->buffer().as<T *>() + desc.getBlockingDesc().getOffsetPadding() + n * strides[0] + c * strides[1];
+    return make_shared_blob<T>(TensorDesc(desc.getPrecision(), planeDims, planeBlocking), plane);
+}
+
+void check_resize(const Blob::Ptr &inBlob, const Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm) {
+    if (inBlob->getTensorDesc().getLayout() != NCHW || outBlob->getTensorDesc().getLayout() != NCHW)
+        THROW_IE_EXCEPTION << "Resize supports only NCHW layout";
+
+    if (!((inBlob->getTensorDesc().getPrecision() == Precision::U8 && outBlob->getTensorDesc().getPrecision() == Precision::U8) ||
+          (inBlob->getTensorDesc().getPrecision() == Precision::FP32 && outBlob->getTensorDesc().getPrecision() == Precision::FP32)))
+        THROW_IE_EXCEPTION << "Resize supports only U8 and FP32 precisions";
+
+    if (algorithm != RESIZE_BILINEAR && algorithm != RESIZE_AREA)
+        THROW_IE_EXCEPTION << "Unsupported resize algorithm type";
 
-    free(buffer);
+    if (inBlob->getTensorDesc().getDims()[1] != outBlob->getTensorDesc().getDims()[1])
+        THROW_IE_EXCEPTION << "Resize supports only the blobs with the same number of channels";
+}
+
+/**
+ * @brief Resizes the planes of the images of inImages to the images of outBlob of the same index.
+ * Every plane (an image channel) is resized independently, the planes are split across the threads.
+ */
+void resize_images(const std::vector<Blob::Ptr> &inImages, const Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm) {
+    const size_t channels = outBlob->getTensorDesc().getDims()[1];
+    const bool isU8 = outBlob->getTensorDesc().getPrecision() == Precision::U8;
+    auto resizePlanes = [&](size_t begin, size_t end) {
+        for (size_t p = begin; p < end; p++) {
+            const Blob::Ptr &inImage = inImages[p / channels];
+            if (isU8) {
+                resize_plane(make_plane_view<uint8_t>(inImage, 0, p % channels),
+                             make_plane_view<uint8_t>(outBlob, p / channels, p % channels), algorithm);
+            } else {
+                resize_plane(make_plane_view<float>(inImage, 0, p % channels),
+                             make_plane_view<float>(outBlob, p / channels, p % channels), algorithm);
+            }
+        }
+    };
+
+    details::parallel_ranges(inImages.size() * channels, resizePlanes);
+}
+
+void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorithm) {
+    check_resize(inBlob, outBlob, algorithm);
+
+    const size_t batch = inBlob->getTensorDesc().getDims()[0];
+    if (batch != outBlob->getTensorDesc().getDims()[0])
+        THROW_IE_EXCEPTION << "Resize supports only the blobs with the same batch";
+
+    std::vector<Blob::Ptr> images;
+    for (size_t n = 0; n < batch; n++) {
+        if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
+            images.push_back(make_image_view<uint8_t>(inBlob, n));
+        } else {
+            images.push_back(make_image_view<float>(inBlob, n));
+        }
+    }
+    resize_images(images, outBlob, algorithm);
 }
 
 }  // anonymous namespace
 
 void PreProcessData::setRoiBlob(const Blob::Ptr &blob) {
     _roiBlob = blob;
+    _rois.clear();
+}
+
+void PreProcessData::setRois(const Blob::Ptr &frame, const std::vector<ROI> &rois) {
+    if (rois.empty()) {
+        THROW_IE_EXCEPTION << "Input pre-processing requires at least one ROI";
+    }
+    _roiBlob = frame;
+    _rois = rois;
 }
 
 Blob::Ptr PreProcessData::getRoiBlob() const {
     return _roiBlob;
 }
 
+bool PreProcessData::hasRois() const {
+    return !_rois.empty();
+}
+
 void PreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm) {
     IE_PROFILING_AUTO_SCOPE_TASK(perf_preprocessing)
 
@@ -1380,32 +1560,97 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorith
         THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
     }
 
-    Blob::Ptr res_in, res_out;
-    if (_roiBlob->getTensorDesc().getLayout() == NHWC) {
-        if (_roiBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-            _tmp1 = make_shared_blob<float>(Precision::FP32, NCHW, _roiBlob->dims());
-        } else {
-            _tmp1 = make_shared_blob<uint8_t>(Precision::U8, NCHW, _roiBlob->dims());
+    if (!_rois.empty()) {
+        resizeRois(outBlob, algorithm);
+        return;
+    }
+
+    resizeBlob(_roiBlob, outBlob, algorithm);
+}
+
+void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo &info) {
+    if (info.getColorFormat() == RAW) {
+        execute(outBlob, info.getResizeAlgorithm());
+        return;
+    }
+
+    IE_PROFILING_AUTO_SCOPE_TASK(perf_preprocessing)
+
+    if (_roiBlob == nullptr) {
+        THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
+    }
+
+    if (!_rois.empty()) {
+        THROW_IE_EXCEPTION << "Input pre-processing of ROIs supports only RAW color format";
+    }
+
+    details::colorConvertResize(_roiBlob, outBlob, info, _tmpColor,
+                                [this](const details::ColorConvertResize &kernel) {
+                                    IE_PROFILING_AUTO_SCOPE_TASK(perf_color_convert)
+                                    details::parallel_ranges(kernel.rows(), [&kernel](size_t begin, size_t end) {
+                                        kernel.run(begin, end);
+                                    });
+                                },
+                                [this](const Blob::Ptr &in, Blob::Ptr &out, ResizeAlgorithm algorithm) {
+                                    resizeBlob(in, out, algorithm);
+                                });
+}
+
+void PreProcessData::resizeRois(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm) {
+    const size_t batch = outBlob->getTensorDesc().getDims()[0];
+    if (_rois.size() > batch) {
+        THROW_IE_EXCEPTION << "Number of ROIs (" << _rois.size() << ") exceeds the batch of the input (" << batch << ")";
+    }
+
+    Blob::Ptr frame = _roiBlob;
+    if (frame->getTensorDesc().getLayout() == NHWC) {
+        reuse_or_create_planar(_tmp1, frame->getTensorDesc().getPrecision(), frame->getTensorDesc().getDims());
+        {
+            IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_before)
+            blob_copy(frame, _tmp1);
         }
-        _tmp1->allocate();
+        frame = _tmp1;
+    }
+
+    Blob::Ptr out = outBlob;
+    if (outBlob->getTensorDesc().getLayout() == NHWC) {
+        reuse_or_create_planar(_tmp2, outBlob->getTensorDesc().getPrecision(), outBlob->getTensorDesc().getDims());
+        out = _tmp2;
+    }
+
+    check_resize(frame, out, algorithm);
+    std::vector<Blob::Ptr> crops;
+    for (const auto &roi : _rois) {
+        crops.push_back(make_shared_blob(frame, roi));
+    }
+
+    {
+        IE_PROFILING_AUTO_SCOPE_TASK(perf_resize)
+        resize_images(crops, out, algorithm);
+    }
+
+    if (out == _tmp2) {
+        IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_after)
+        blob_copy(_tmp2, outBlob);
+    }
+}
+
+void PreProcessData::resizeBlob(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm) {
+    Blob::Ptr res_in, res_out;
+    if (inBlob->getTensorDesc().getLayout() == NHWC) {
+        reuse_or_create_planar(_tmp1, inBlob->getTensorDesc().getPrecision(), inBlob->getTensorDesc().getDims());
 
         {
             IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_before)
-            blob_copy(_roiBlob, _tmp1);
+            blob_copy(inBlob, _tmp1);
         }
         res_in = _tmp1;
     } else {
-        res_in = _roiBlob;
+        res_in = inBlob;
     }
 
     if (outBlob->getTensorDesc().getLayout() == NHWC) {
-        if (_roiBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-            _tmp2 = make_shared_blob<float>(Precision::FP32, NCHW, outBlob->dims());
-        } else {
-            _tmp2 = make_shared_blob<uint8_t>(Precision::U8, NCHW, outBlob->dims());
-        }
-        _tmp2->allocate();
-
+        reuse_or_create_planar(_tmp2, inBlob->getTensorDesc().getPrecision(), outBlob->getTensorDesc().getDims());
         res_out = _tmp2;
     } else {
         res_out = outBlob;
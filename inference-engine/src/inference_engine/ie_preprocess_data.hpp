@@ -7,6 +7,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "ie_blob.h"
 #include "ie_input_info.hpp"
@@ -24,11 +25,20 @@ class INFERENCE_ENGINE_API_CLASS(PreProcessData) {
     Blob::Ptr _roiBlob = nullptr;
     Blob::Ptr _tmp1 = nullptr;
     Blob::Ptr _tmp2 = nullptr;
+    Blob::Ptr _tmpColor = nullptr;
+    /**
+     * @brief ROIs of the frame stored as the ROI blob, every ROI is resized to an image of the batch.
+     */
+    std::vector<ROI> _rois;
 
     InferenceEngine::ProfilingTask perf_resize {"Resize"};
     InferenceEngine::ProfilingTask perf_reorder_before {"Reorder before"};
     InferenceEngine::ProfilingTask perf_reorder_after {"Reorder after"};
     InferenceEngine::ProfilingTask perf_preprocessing {"Preprocessing"};
+    InferenceEngine::ProfilingTask perf_color_convert {"Color convert"};
+
+    void resizeBlob(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm);
+    void resizeRois(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm);
 
 public:
     /**
@@ -37,18 +47,40 @@ public:
      */
     void setRoiBlob(const Blob::Ptr &blob);
 
+    /**
+     * @brief Sets the frame and the ROIs inside of it. During pre-processing every ROI is cropped and resized to
+     * the image of the same index in the batch of the default input blob, all the ROIs are resized in parallel.
+     * @param frame the frame, a single image.
+     * @param rois the ROIs inside of the frame, not more than the batch of the input.
+     */
+    void setRois(const Blob::Ptr &frame, const std::vector<ROI> &rois);
+
     /**
      * @brief Gets pointer to the ROI blob used for a given input.
      * @return Blob pointer.
      */
     Blob::Ptr getRoiBlob() const;
 
+    /**
+     * @brief Checks that the ROI blob is a frame with the ROIs set by setRois().
+     * @return true if the ROIs are set.
+     */
+    bool hasRois() const;
+
     /**
      * @brief Executes input pre-processing with a given resize algorithm.
      * @param outBlob pre-processed output blob to be used for inference.
      * @param algorithm resize algorithm.
      */
     void execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm);
+
+    /**
+     * @brief Executes input pre-processing according to the pre-processing information of the input:
+     * converts the ROI blob of the given color format to the BGR network input and resizes it.
+     * @param outBlob pre-processed output blob to be used for inference.
+     * @param info pre-processing information of the input.
+     */
+    void execute(Blob::Ptr &outBlob, const PreProcessInfo &info);
 };
 
 }  // namespace InferenceEngine
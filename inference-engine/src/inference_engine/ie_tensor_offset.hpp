@@ -0,0 +1,178 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Offsets of the elements of the tensors of a known rank
+ * @file ie_tensor_offset.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "ie_layouts.h"
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The offsets of the elements of a tensor of the rank N in the memory described by the TensorDesc, as
+ * TensorDesc::offset computes them. The strides of the logical dimensions are gathered once by the constructor, so
+ * an offset is a sum of N products instead of the walk over the vectors of the descriptor: the offset of a planar
+ * tensor (Blocked = false) compiles to the pointer arithmetic, a blocked one (e.g. nChw8c) also splits every
+ * blocked dimension into the index of the block and the index inside of it.
+ */
+template <size_t N, bool Blocked = false>
+class TensorOffset {
+public:
+    explicit TensorOffset(const TensorDesc &desc) {
+        if (!fits(desc))
+            THROW_IE_EXCEPTION << "Cannot calculate the offsets of the rank " << N << (Blocked ? " blocked" : " planar")
+                               << " tensor for the descriptor of the rank " << desc.getDims().size();
+        const BlockingDesc &blocking = desc.getBlockingDesc();
+        const SizeVector &order = blocking.getOrder();
+        const SizeVector &blockedDims = blocking.getBlockDims();
+        const SizeVector &blockedStrides = blocking.getStrides();
+        const SizeVector &paddings = blocking.getOffsetPaddingToData();
+
+        bool seen[N] = {};
+        size_t inner[N] = {};
+        base = blocking.getOffsetPadding();
+        for (size_t d = 0; d < N; d++) {
+            dims[d] = desc.getDims()[d];
+            blocks[d] = 1;
+            blockStrides[d] = 0;
+        }
+        // the innermost occurrence of a dimension is the index inside of the block, the outer one is of the block
+        for (size_t k = order.size(); k-- > 0;) {
+            size_t d = order[k];
+            if (k < paddings.size())
+                base += paddings[k] * blockedStrides[k];
+            if (seen[d]) {
+                blockStrides[d] = strides[d];
+                blocks[d] = blockedDims[inner[d]];
+            } else {
+                inner[d] = k;
+            }
+            strides[d] = blockedStrides[k];
+            seen[d] = true;
+        }
+
+        dense = true;
+        size_t stride = 1;
+        for (size_t d = N; d-- > 0;) {
+            dense = dense && blocks[d] == 1 && strides[d] == stride;
+            stride *= dims[d];
+        }
+    }
+
+    /**
+     * @brief Returns true if the offsets of the descriptor can be calculated with this rank and blocking
+     */
+    static bool fits(const TensorDesc &desc) {
+        const SizeVector &order = desc.getBlockingDesc().getOrder();
+        if (desc.getLayout() == Layout::ANY || desc.getDims().size() != N || order.size() < N || order.size() > 2 * N)
+            return false;
+        size_t occurrences[N] = {};
+        for (size_t d : order) {
+            if (d >= N || ++occurrences[d] > 2)
+                return false;
+        }
+        return Blocked || order.size() == N;
+    }
+
+    /**
+     * @brief Returns the offset of the element of the logical indices
+     */
+    size_t operator()(const size_t (&pos)[N]) const {
+        size_t offset = base;
+        for (size_t d = 0; d < N; d++) {
+            if (Blocked)
+                offset += pos[d] / blocks[d] * strides[d] + pos[d] % blocks[d] * blockStrides[d];
+            else
+                offset += pos[d] * strides[d];
+        }
+        return offset;
+    }
+
+    /**
+     * @brief Returns the offset of the element of the logical (row-major) index, as TensorDesc::offset(size_t)
+     */
+    size_t linear(size_t l) const {
+        if (dense)
+            return base + l;
+        size_t pos[N];
+        for (size_t d = N; d-- > 0;) {
+            pos[d] = l % dims[d];
+            l /= dims[d];
+        }
+        return (*this)(pos);
+    }
+
+    /**
+     * @brief Returns true if the elements follow each other in the logical order
+     */
+    bool isDense() const {
+        return dense;
+    }
+
+private:
+    size_t base;
+    size_t dims[N];
+    // the strides of the blocks of the dimensions and of the elements inside of the blocks
+    size_t strides[N];
+    size_t blocks[N];
+    size_t blockStrides[N];
+    bool dense;
+};
+
+namespace details {
+
+template <size_t N, bool SrcBlocked, bool DstBlocked, typename T>
+void copyByOffsets(const T *src, const TensorDesc &srcDesc, T *dst, const TensorDesc &dstDesc,
+                   size_t begin, size_t end) {
+    TensorOffset<N, SrcBlocked> srcOffset(srcDesc);
+    TensorOffset<N, DstBlocked> dstOffset(dstDesc);
+    for (size_t i = begin; i < end; i++)
+        dst[dstOffset.linear(i)] = src[srcOffset.linear(i)];
+}
+
+template <size_t N, bool SrcBlocked, typename T>
+bool copyByOffsets(const T *src, const TensorDesc &srcDesc, T *dst, const TensorDesc &dstDesc,
+                   size_t begin, size_t end) {
+    if (!TensorOffset<N, SrcBlocked>::fits(srcDesc) || !TensorOffset<N, true>::fits(dstDesc))
+        return false;
+    if (TensorOffset<N>::fits(dstDesc))
+        copyByOffsets<N, SrcBlocked, false>(src, srcDesc, dst, dstDesc, begin, end);
+    else
+        copyByOffsets<N, SrcBlocked, true>(src, srcDesc, dst, dstDesc, begin, end);
+    return true;
+}
+
+template <size_t N, typename T>
+bool copyByOffsets(const T *src, const TensorDesc &srcDesc, T *dst, const TensorDesc &dstDesc,
+                   size_t begin, size_t end) {
+    if (TensorOffset<N>::fits(srcDesc))
+        return copyByOffsets<N, false>(src, srcDesc, dst, dstDesc, begin, end);
+    return copyByOffsets<N, true>(src, srcDesc, dst, dstDesc, begin, end);
+}
+
+}  // namespace details
+
+/**
+ * @brief Copies the elements of the logical indices [begin, end) of the tensor of srcDesc to the tensor of dstDesc,
+ * dst[dstDesc.offset(i)] = src[srcDesc.offset(i)]. The tensors of the rank 4 and 5 use TensorOffset, the others
+ * fall back to TensorDesc::offset.
+ */
+template <typename T>
+void copyByOffsets(const T *src, const TensorDesc &srcDesc, T *dst, const TensorDesc &dstDesc,
+                   size_t begin, size_t end) {
+    if (details::copyByOffsets<4>(src, srcDesc, dst, dstDesc, begin, end) ||
+        details::copyByOffsets<5>(src, srcDesc, dst, dstDesc, begin, end))
+        return;
+    for (size_t i = begin; i < end; i++)
+        dst[dstDesc.offset(i)] = src[srcDesc.offset(i)];
+}
+
+}  // namespace InferenceEngine
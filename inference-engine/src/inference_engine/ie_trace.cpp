@@ -0,0 +1,161 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+// the threads are numbered in the order of their first event, the named tracks follow them
+std::atomic<uint64_t> threadCount{0};
+constexpr uint64_t firstTrack = 1000000;
+
+uint64_t currentThread() {
+    thread_local uint64_t thread = ++threadCount;
+    return thread;
+}
+
+std::string quoted(const std::string &value) {
+    std::ostringstream out;
+    out << '"';
+    for (char c : value) {
+        switch (c) {
+        case '"':  out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                    << std::dec << std::setfill(' ');
+            else
+                out << c;
+        }
+    }
+    out << '"';
+    return out.str();
+}
+
+}  // namespace
+
+TraceSink &TraceSink::instance() {
+    static TraceSink sink;
+    return sink;
+}
+
+TraceSink::~TraceSink() {
+    stop();
+}
+
+uint64_t TraceSink::now() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void TraceSink::start(const std::string &file, uint64_t windowMs) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_enabled && file == _file)
+        return;
+    flush();
+    _file = file;
+    if (file.empty())
+        return;
+
+    std::ofstream probe(file);
+    if (!probe.is_open())
+        THROW_IE_EXCEPTION << "Cannot open the trace file " << file;
+    _windowEnd = windowMs == 0 ? UINT64_MAX : now() + windowMs * 1000;
+    _enabled = true;
+}
+
+void TraceSink::stop() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    flush();
+}
+
+void TraceSink::complete(const std::string &name, const char *category, uint64_t begin, uint64_t end) {
+    record({name, category, 'X', begin, end, currentThread(), 0});
+}
+
+void TraceSink::complete(const std::string &name, const char *category, const char *track,
+                         uint64_t begin, uint64_t end) {
+    record({name, category, 'X', begin, end, 0, trackId(track)});
+}
+
+void TraceSink::span(const std::string &name, const char *category, uint64_t id, uint64_t begin, uint64_t end) {
+    record({name, category, 'b', begin, end, currentThread(), id});
+}
+
+void TraceSink::record(Event &&event) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_enabled)
+        return;
+    // the first event after the window writes the trace
+    if (event.end > _windowEnd) {
+        flush();
+        return;
+    }
+    _events.push_back(std::move(event));
+}
+
+uint64_t TraceSink::trackId(const char *track) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_enabled)
+        return 0;
+    auto found = std::find(_tracks.begin(), _tracks.end(), track);
+    if (found != _tracks.end())
+        return firstTrack + (found - _tracks.begin());
+    _tracks.push_back(track);
+    return firstTrack + _tracks.size() - 1;
+}
+
+void TraceSink::flush() {
+    if (!_enabled)
+        return;
+    _enabled = false;
+
+    std::ofstream out(_file);
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [" << std::endl;
+    bool first = true;
+    auto separator = [&]() -> std::ofstream & {
+        out << (first ? "" : ",\n");
+        first = false;
+        return out;
+    };
+    for (size_t i = 0; i < _tracks.size(); i++) {
+        separator() << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << firstTrack + i
+                    << ", \"args\": {\"name\": " << quoted(_tracks[i]) << "}}";
+    }
+    for (auto &event : _events) {
+        // the events of the named tracks keep the track in the id
+        uint64_t thread = event.thread != 0 ? event.thread : event.id;
+        std::string common = "{\"name\": " + quoted(event.name) + ", \"cat\": " + quoted(event.category) +
+                             ", \"pid\": 1, \"tid\": " + std::to_string(thread);
+        if (event.phase == 'X') {
+            separator() << common << ", \"ph\": \"X\", \"ts\": " << event.begin
+                        << ", \"dur\": " << event.end - event.begin << "}";
+        } else {
+            separator() << common << ", \"ph\": \"b\", \"id\": " << event.id << ", \"ts\": " << event.begin << "}";
+            separator() << common << ", \"ph\": \"e\", \"id\": " << event.id << ", \"ts\": " << event.end << "}";
+        }
+    }
+    out << std::endl << "]}" << std::endl;
+
+    _events.clear();
+    _tracks.clear();
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,121 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @class TraceSink
+ * @brief Records the timeline of the inference (the queueing and the stages of the tasks, the execution of the nodes
+ * and the primitives of the plugins) and writes it in the Chrome trace format (chrome://tracing, Perfetto UI).
+ * The sink is shared by all the plugins of the process, it is started by KEY_TRACE_FILE and records the events until
+ * the window set by KEY_TRACE_WINDOW ends, the sink is stopped or the process exits. The disabled sink costs one
+ * atomic load per event.
+ */
+class INFERENCE_ENGINE_API_CLASS(TraceSink) {
+public:
+    static TraceSink &instance();
+
+    /**
+     * @brief Starts recording to the file, the events recorded to another file are written before.
+     * Starting the recording to the same file again does nothing.
+     * @param file - the path of the JSON file, empty stops the recording
+     * @param windowMs - the duration of the recording in milliseconds, 0 records until the sink is stopped
+     */
+    void start(const std::string &file, uint64_t windowMs);
+
+    /**
+     * @brief Stops the recording and writes the recorded events to the file
+     */
+    void stop();
+
+    bool enabled() const {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the time in microseconds the events are recorded in
+     */
+    static uint64_t now();
+
+    /**
+     * @brief Records the event, which began and ended on the current thread
+     */
+    void complete(const std::string &name, const char *category, uint64_t begin, uint64_t end);
+
+    /**
+     * @brief Records the event on the named track instead of the current thread (e.g. the device executing
+     * the primitives)
+     */
+    void complete(const std::string &name, const char *category, const char *track, uint64_t begin, uint64_t end);
+
+    /**
+     * @brief Records the event, which may overlap with the other events of the thread (e.g. the task waiting in
+     * the queue). The events with the same id and name are shown on one row.
+     */
+    void span(const std::string &name, const char *category, uint64_t id, uint64_t begin, uint64_t end);
+
+    ~TraceSink();
+
+private:
+    struct Event {
+        std::string name;
+        const char *category;
+        char phase;
+        uint64_t begin;
+        uint64_t end;
+        uint64_t thread;
+        uint64_t id;
+    };
+
+    TraceSink() = default;
+
+    void record(Event &&event);
+    uint64_t trackId(const char *track);
+    void flush();
+
+    std::atomic<bool> _enabled{false};
+    std::mutex _mutex;
+    std::string _file;
+    uint64_t _windowEnd = 0;
+    std::vector<Event> _events;
+    std::vector<std::string> _tracks;
+};
+
+/**
+ * @brief Records the scope as the complete event if the trace sink is enabled
+ */
+class TraceScope {
+public:
+    TraceScope(const std::string &name, const char *category) : _name(name), _category(category) {
+        if (TraceSink::instance().enabled())
+            _begin = TraceSink::now();
+    }
+
+    // the name is not copied, so it has to outlive the scope
+    TraceScope(std::string &&name, const char *category) = delete;
+
+    ~TraceScope() {
+        if (_begin != 0 && TraceSink::instance().enabled())
+            TraceSink::instance().complete(_name, _category, _begin, TraceSink::now());
+    }
+
+private:
+    const std::string &_name;
+    const char *_category;
+    uint64_t _begin = 0;
+};
+
+}  // namespace InferenceEngine
+
+#define IE_TRACE_SCOPE(name, category) ::InferenceEngine::TraceScope __traceScope(name, category)
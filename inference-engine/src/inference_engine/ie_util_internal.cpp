@@ -7,6 +7,7 @@
 #include "graph_tools.hpp"
 #include "caseless.hpp"
 #include "ie_utils.hpp"
+#include "binary_format_parser.h"
 
 #include <ie_layers.h>
 
@@ -19,6 +20,9 @@
 #include <memory>
 #include <utility>
 #include <iomanip>
+#include <algorithm>
+#include <limits>
+#include <cstring>
 
 namespace InferenceEngine {
 
@@ -126,6 +130,8 @@ CNNLayerPtr clonelayer(const CNNLayer& source) {
         &layerCloneImpl<ScaleShiftLayer        >,
         &layerCloneImpl<PReLULayer             >,
         &layerCloneImpl<TileLayer              >,
+        &layerCloneImpl<GemmLayer              >,
+        &layerCloneImpl<GatherLayer            >,
         &layerCloneImpl<ReshapeLayer           >,
         &layerCloneImpl<CropLayer              >,
         &layerCloneImpl<EltwiseLayer           >,
@@ -190,6 +196,19 @@ details::CNNNetworkImplPtr cloneNet(const ICNNNetwork &network) {
 }
 
 
+void releaseWeights(ICNNNetwork &network) {
+    details::CNNNetworkIterator i(&network);
+    while (i != details::CNNNetworkIterator()) {
+        CNNLayerPtr layer = *i;
+        layer->blobs.clear();
+        if (auto weightable = dynamic_cast<WeightableLayer *>(layer.get())) {
+            weightable->_weights.reset();
+            weightable->_biases.reset();
+        }
+        i++;
+    }
+}
+
 details::CNNNetworkImplPtr cloneNet(const std::vector<CNNLayerPtr>& layers,
                                     std::function<CNNLayerPtr(const CNNLayer&)> layerCloner) {
     // TODO layerCloner std::function is heavy and can be replaced with
@@ -570,4 +589,298 @@ std::unordered_set<DataPtr> getRootDataObjects(ICNNNetwork &network) {
     return ret;
 }
 
+namespace {
+std::string xmlEscape(const std::string &str) {
+    std::string res;
+    for (auto c : str) {
+        switch (c) {
+            case '&': res += "&amp;"; break;
+            case '<': res += "&lt;"; break;
+            case '>': res += "&gt;"; break;
+            case '"': res += "&quot;"; break;
+            default: res += c;
+        }
+    }
+    return res;
+}
+
+void saveDims(std::ostream &xml, const SizeVector &dims) {
+    for (auto dim : dims) {
+        xml << "                    <dim>" << dim << "</dim>\n";
+    }
+}
+// The reader names the output data of a layer with several outputs as "<layer name>.<port id>",
+// so the original port id is restored from the name to keep the names of the outputs unchanged
+size_t outputPortId(const CNNLayerPtr &layer, size_t outIdx) {
+    const std::string prefix = layer->name + ".";
+    const std::string &dataName = layer->outData[outIdx]->getName();
+    if (layer->outData.size() > 1 && dataName.compare(0, prefix.size(), prefix) == 0) {
+        const std::string suffix = dataName.substr(prefix.size());
+        if (!suffix.empty() && std::all_of(suffix.begin(), suffix.end(), ::isdigit))
+            return std::stoul(suffix);
+    }
+    return layer->insData.size() + outIdx;
+}
+}  // namespace
+
+void saveNetworkToIR(ICNNNetwork &network, std::ostream &xml, std::ostream &weights) {
+    auto layers = CNNNetSortTopologically(network);
+
+    std::unordered_map<CNNLayer*, size_t> layerIds;
+    for (size_t i = 0; i < layers.size(); i++) {
+        layerIds[layers[i].get()] = i;
+    }
+
+    size_t offset = 0;
+    auto saveBlob = [&](const std::string &name, const Blob::Ptr &blob, const Precision &layerPrecision) {
+        xml << "                <" << xmlEscape(name) << " offset=\"" << offset << "\" size=\"" << blob->byteSize() << "\"";
+        if (blob->precision() != layerPrecision)
+            xml << " precision=\"" << blob->precision().name() << "\"";
+        xml << "/>\n";
+        weights.write(blob->cbuffer().as<const char*>(), blob->byteSize());
+        offset += blob->byteSize();
+    };
+
+    xml << std::setprecision(std::numeric_limits<float>::max_digits10);
+    xml << "<?xml version=\"1.0\" ?>\n";
+    xml << "<net name=\"" << xmlEscape(network.getName()) << "\" version=\"2\" batch=\"" << network.getBatchSize() << "\">\n";
+    xml << "    <layers>\n";
+    for (size_t i = 0; i < layers.size(); i++) {
+        auto &layer = layers[i];
+        xml << "        <layer id=\"" << i << "\" name=\"" << xmlEscape(layer->name) << "\" type=\"" << xmlEscape(layer->type)
+            << "\" precision=\"" << layer->precision.name() << "\">\n";
+        if (!layer->params.empty()) {
+            xml << "            <data";
+            for (auto &param : layer->params) {
+                xml << " " << xmlEscape(param.first) << "=\"" << xmlEscape(param.second) << "\"";
+            }
+            xml << "/>\n";
+        }
+        // input ports are numbered first, the output ports go after them
+        if (!layer->insData.empty()) {
+            xml << "            <input>\n";
+            for (size_t j = 0; j < layer->insData.size(); j++) {
+                auto data = layer->insData[j].lock();
+                if (!data)
+                    THROW_IE_EXCEPTION << "Layer " << layer->name << " has empty input data";
+                xml << "                <port id=\"" << j << "\">\n";
+                saveDims(xml, data->getTensorDesc().getDims());
+                xml << "                </port>\n";
+            }
+            xml << "            </input>\n";
+        }
+        if (!layer->outData.empty()) {
+            xml << "            <output>\n";
+            for (size_t j = 0; j < layer->outData.size(); j++) {
+                xml << "                <port id=\"" << outputPortId(layer, j) << "\">\n";
+                saveDims(xml, layer->outData[j]->getTensorDesc().getDims());
+                xml << "                </port>\n";
+            }
+            xml << "            </output>\n";
+        }
+        if (!layer->blobs.empty()) {
+            xml << "            <blobs>\n";
+            for (auto &blob : layer->blobs) {
+                if (blob.second)
+                    saveBlob(blob.first, blob.second, layer->precision);
+            }
+            xml << "            </blobs>\n";
+        }
+        xml << "        </layer>\n";
+    }
+    xml << "    </layers>\n";
+
+    xml << "    <edges>\n";
+    for (size_t i = 0; i < layers.size(); i++) {
+        auto &layer = layers[i];
+        for (size_t j = 0; j < layer->insData.size(); j++) {
+            auto data = layer->insData[j].lock();
+            auto creator = data->getCreatorLayer().lock();
+            if (!creator || layerIds.find(creator.get()) == layerIds.end())
+                THROW_IE_EXCEPTION << "Data " << data->getName() << " has no creator layer";
+            auto outPort = std::find(creator->outData.begin(), creator->outData.end(), data) - creator->outData.begin();
+            xml << "        <edge from-layer=\"" << layerIds[creator.get()] << "\" from-port=\""
+                << outputPortId(creator, outPort) << "\" to-layer=\"" << i << "\" to-port=\"" << j << "\"/>\n";
+        }
+    }
+    xml << "    </edges>\n";
+
+    // The IR keeps pre-processing information for a single input only
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (auto &input : inputs) {
+        PreProcessInfo &pp = input.second->getPreProcess();
+        if (pp.getMeanVariant() == NONE || pp.getNumberOfChannels() == 0)
+            continue;
+        xml << "    <pre-process reference-layer-name=\"" << xmlEscape(input.first) << "\"";
+        if (pp.getMeanVariant() == MEAN_IMAGE)
+            xml << " mean-precision=\"" << pp[0]->meanData->precision().name() << "\"";
+        xml << ">\n";
+        for (size_t c = 0; c < pp.getNumberOfChannels(); c++) {
+            xml << "        <channel id=\"" << c << "\">\n";
+            if (pp.getMeanVariant() == MEAN_IMAGE) {
+                saveBlob("mean", pp[c]->meanData, Precision::UNSPECIFIED);
+            } else {
+                xml << "            <mean value=\"" << pp[c]->meanValue << "\"/>\n";
+            }
+            xml << "            <scale value=\"" << pp[c]->stdScale << "\"/>\n";
+            xml << "        </channel>\n";
+        }
+        xml << "    </pre-process>\n";
+        break;
+    }
+    xml << "</net>\n";
+}
+
+namespace {
+// the writer of BinaryFormatParser: the strings are interned to the table, which is written before the rest
+class BinaryIRWriter {
+public:
+    void u32(uint32_t value) {
+        for (int i = 0; i < 4; i++)
+            body.push_back(static_cast<char>(value >> (8 * i)));
+    }
+
+    void u64(uint64_t value) {
+        u32(static_cast<uint32_t>(value));
+        u32(static_cast<uint32_t>(value >> 32));
+    }
+
+    void f32(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        u32(bits);
+    }
+
+    void count(size_t value) {
+        u32(static_cast<uint32_t>(value));
+    }
+
+    void str(const std::string &value) {
+        auto it = stringIds.find(value);
+        if (it == stringIds.end()) {
+            it = stringIds.emplace(value, static_cast<uint32_t>(strings.size())).first;
+            strings.push_back(value);
+        }
+        u32(it->second);
+    }
+
+    void write(std::ostream &out) const {
+        BinaryIRWriter head;
+        head.u32(details::BinaryFormatParser::version);
+        head.count(strings.size());
+        for (auto &value : strings) {
+            head.count(value.size());
+            head.body += value;
+        }
+        out.write(details::BinaryFormatParser::magic, sizeof(details::BinaryFormatParser::magic));
+        out.write(head.body.data(), head.body.size());
+        out.write(body.data(), body.size());
+    }
+
+private:
+    std::string body;
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, uint32_t> stringIds;
+};
+}  // namespace
+
+void saveNetworkToBinaryIR(ICNNNetwork &network, std::ostream &topology, std::ostream &weights) {
+    auto layers = CNNNetSortTopologically(network);
+
+    std::unordered_map<CNNLayer*, uint32_t> layerIds;
+    for (size_t i = 0; i < layers.size(); i++) {
+        layerIds[layers[i].get()] = static_cast<uint32_t>(i);
+    }
+
+    BinaryIRWriter writer;
+    uint64_t offset = 0;
+    auto saveBlob = [&](const Blob::Ptr &blob) {
+        writer.u64(offset);
+        writer.u64(blob->byteSize());
+        weights.write(blob->cbuffer().as<const char*>(), blob->byteSize());
+        offset += blob->byteSize();
+    };
+
+    writer.str(network.getName());
+    writer.str(network.getPrecision().name());
+    writer.count(layers.size());
+    for (auto &layer : layers) {
+        writer.str(layer->name);
+        writer.str(layer->type);
+        writer.str(layer->precision.name());
+
+        writer.count(layer->params.size());
+        for (auto &param : layer->params) {
+            writer.str(param.first);
+            writer.str(param.second);
+        }
+
+        writer.count(layer->insData.size());
+        for (auto &input : layer->insData) {
+            auto data = input.lock();
+            if (!data)
+                THROW_IE_EXCEPTION << "Layer " << layer->name << " has empty input data";
+            auto creator = data->getCreatorLayer().lock();
+            if (!creator || layerIds.find(creator.get()) == layerIds.end())
+                THROW_IE_EXCEPTION << "Data " << data->getName() << " has no creator layer";
+            auto outPort = std::find(creator->outData.begin(), creator->outData.end(), data) - creator->outData.begin();
+            writer.u32(layerIds[creator.get()]);
+            writer.count(outPort);
+        }
+
+        writer.count(layer->outData.size());
+        for (auto &data : layer->outData) {
+            writer.str(data->getName());
+            writer.str(data->getPrecision().name());
+            const SizeVector &dims = data->getTensorDesc().getDims();
+            writer.count(dims.size());
+            for (auto dim : dims)
+                writer.u64(dim);
+        }
+
+        size_t blobs = 0;
+        for (auto &blob : layer->blobs)
+            blobs += blob.second ? 1 : 0;
+        writer.count(blobs);
+        for (auto &blob : layer->blobs) {
+            if (!blob.second)
+                continue;
+            writer.str(blob.first);
+            writer.str(blob.second->precision().name());
+            saveBlob(blob.second);
+        }
+    }
+
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    size_t preProcessed = 0;
+    for (auto &input : inputs) {
+        PreProcessInfo &pp = input.second->getPreProcess();
+        preProcessed += pp.getMeanVariant() != NONE && pp.getNumberOfChannels() != 0 ? 1 : 0;
+    }
+    writer.count(preProcessed);
+    for (auto &input : inputs) {
+        PreProcessInfo &pp = input.second->getPreProcess();
+        if (pp.getMeanVariant() == NONE || pp.getNumberOfChannels() == 0)
+            continue;
+        writer.str(input.first);
+        writer.u32(pp.getMeanVariant());
+        writer.count(pp.getNumberOfChannels());
+        writer.str(pp.getMeanVariant() == MEAN_IMAGE ? pp[0]->meanData->precision().name() : "");
+        for (size_t c = 0; c < pp.getNumberOfChannels(); c++) {
+            writer.f32(pp[c]->meanValue);
+            writer.f32(pp[c]->stdScale);
+            if (pp.getMeanVariant() == MEAN_IMAGE) {
+                saveBlob(pp[c]->meanData);
+            } else {
+                writer.u64(0);
+                writer.u64(0);
+            }
+        }
+    }
+
+    writer.write(topology);
+}
+
 }  // namespace InferenceEngine
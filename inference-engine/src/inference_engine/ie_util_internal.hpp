@@ -76,11 +76,21 @@ cloneNet(const std::vector<InferenceEngine::CNNLayerPtr>& layers,
 /**
  * Clones the whole network. All layers and data objects will be cloned
  *
- * Blobs inside layers are reused
+ * Blobs inside layers are reused: the weights are shared by reference with the original network, so the clone
+ * costs only the structure and the metadata. The code changing the weights of the clone must replace the blobs
+ * instead of writing to them
  * */
 INFERENCE_ENGINE_API_CPP(InferenceEngine::details::CNNNetworkImplPtr)
 cloneNet(const InferenceEngine::ICNNNetwork &network);
 
+/**
+ * @brief Drops the weights of the layers of the network: the blobs, _weights and _biases.
+ * The blobs of the IR reader are views of the weights file, which is freed when the last of them is dropped,
+ * so the plugins call it once the weights are copied to their own memory (KEY_RELEASE_WEIGHTS)
+ * @param network - network to release the weights of, it can not be loaded again
+ */
+INFERENCE_ENGINE_API_CPP(void) releaseWeights(InferenceEngine::ICNNNetwork &network);
+
 namespace traverse {
 
 INFERENCE_ENGINE_API_CPP(void)
@@ -140,6 +150,27 @@ INFERENCE_ENGINE_API_CPP(void) saveGraphToDot(InferenceEngine::ICNNNetwork &netw
 INFERENCE_ENGINE_API_CPP(std::unordered_set<DataPtr>)
 getRootDataObjects(ICNNNetwork &network);
 
+/**
+ * @brief Serializes network to the IR (version 2) format, that can be read back by CNNNetReader
+ *
+ * @param network - network to serialize
+ * @param xml - output stream for the topology (.xml)
+ * @param weights - output stream for the weights (.bin)
+ */
+INFERENCE_ENGINE_API_CPP(void) saveNetworkToIR(InferenceEngine::ICNNNetwork &network, std::ostream &xml, std::ostream &weights);
+
+/**
+ * @brief Serializes network to the binary topology (see BinaryFormatParser) and the weights, CNNNetReader reads the
+ * topology in place of the .xml without parsing any text. Together with CNNNetReader it converts the IR to the
+ * binary topology, the weights are written in the order of the layers as saveNetworkToIR does
+ *
+ * @param network - network to serialize
+ * @param topology - output stream for the binary topology
+ * @param weights - output stream for the weights (.bin)
+ */
+INFERENCE_ENGINE_API_CPP(void) saveNetworkToBinaryIR(InferenceEngine::ICNNNetwork &network, std::ostream &topology,
+                                                     std::ostream &weights);
+
 }  // namespace InferenceEngine
 
 #endif  // IE_UTIL_HPP
@@ -49,7 +49,7 @@ InferenceEngine::LayerComplexity getComplexity(const InferenceEngine::CNNLayerPt
                                  std::function<void(CNNLayer &)>> layerComplexityLookup = {
         {"Convolution", [&](CNNLayer &l) {
             auto* conv = dynamic_cast<ConvolutionLayer*>(&l);
-            unsigned long filter_m = conv->_kernel_x * conv->_kernel_y * (inDims[1] / conv->_group);
+            unsigned long filter_m = conv->_kernel_x * conv->_kernel_y * conv->_kernel_z * (inDims[1] / conv->_group);
             flops = 2 * out_size * filter_m;
             params = filter_m * conv->_out_depth + conv->_out_depth;
         }},
@@ -84,10 +84,17 @@ InferenceEngine::LayerComplexity getComplexity(const InferenceEngine::CNNLayerPt
 
                 flops = out_size * kernel_h * kernel_w;
             } else {
-                flops = out_size * (pool->_kernel_y * pool->_kernel_y);
+                flops = out_size * (pool->_kernel_y * pool->_kernel_y * pool->_kernel_z);
             }
         }},
 
+        {"Gemm", [&](CNNLayer &l) {
+            auto* gemm = dynamic_cast<GemmLayer*>(&l);
+            // the dims are in the reversed order, the columns of the matrices go first
+            unsigned long K = gemm->transpose_a ? inDims[1] : inDims[0];
+            flops = 2 * out_size * K;
+        }},
+
         {"Eltwise", [&](CNNLayer &l) {
             auto* eltwise = dynamic_cast<EltwiseLayer*>(&l);
             flops = in_size * (2 * eltwise->insData.size() - 1);
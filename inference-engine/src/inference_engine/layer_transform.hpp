@@ -43,6 +43,8 @@ using AllLayers = std::tuple <
     PowerLayer*,
     BatchNormalizationLayer*,
     ClampLayer*,
+    GemmLayer*,
+    GatherLayer*,
     WeightableLayer*,
     CNNLayer*
 >;
@@ -8,6 +8,8 @@
 #include "details/ie_exception.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <limits>
 #include <vector>
 #include <map>
 
@@ -41,55 +43,116 @@ MemorySolver::MemorySolver(const std::vector<Box> boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
-    }
+void MemorySolver::setAlignment(int id, int alignment) {
+    if (alignment <= 0) THROW_IE_EXCEPTION << "Alignment of the box " << id << " should be positive";
+    _alignments[id] = alignment;
 }
 
-int MemorySolver::solve() {
-    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box*>> time_slots(_time_duration);
-    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
-
-    // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
-        { return l.size > r.size; });
-
-    int _min_required = 0;
-
-    for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
+void MemorySolver::setInPlace(int id, int parentId) {
+    _inPlace[id] = parentId;
+}
+
+int MemorySolver::place(std::vector<Box> &boxes, bool bestFit, std::map<int, int> &offsets) const {
+    struct Placed {
+        const Box *box;
+        int offset;
+    };
+    std::vector<Placed> placed;
+    placed.reserve(boxes.size());
+
+    auto aliases = [&](const Box &l, const Box &r) {
+        auto it = _inPlace.find(l.id);
+        if (it != _inPlace.end() && it->second == r.id) return true;
+        it = _inPlace.find(r.id);
+        return it != _inPlace.end() && it->second == l.id;
+    };
+
+    int min_required = 0;
+    for (const Box &box : boxes) {
+        auto found = _alignments.find(box.id);
+        const int alignment = found == _alignments.end() ? 1 : found->second;
+        auto align = [alignment](int offset) { return (offset + alignment - 1) / alignment * alignment; };
+
+        // the memory occupied by the boxes living at the same time, the aliased boxes may share the offset
+        struct Busy {
+            int begin, end;
+            bool alias;
+        };
+        std::vector<Busy> busy;
+        for (const Placed &p : placed) {
+            if (p.box->finish < box.start || p.box->start > box.finish) continue;
+            busy.push_back({p.offset, p.offset + p.box->size, aliases(box, *p.box)});
+        }
+
+        int offset = -1;
+        for (const Busy &candidate : busy) {
+            if (!candidate.alias || candidate.begin % alignment != 0) continue;
+            bool free = true;
+            for (const Busy &b : busy) {
+                if (b.alias && b.begin == candidate.begin) continue;
+                if (b.begin < candidate.begin + box.size && candidate.begin < b.end) {
+                    free = false;
+                    break;
                 }
             }
-        } while (popped_up);
+            if (free) {
+                offset = candidate.begin;
+                break;
+            }
+        }
 
-        // add current box to covered time slot
-        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+        if (offset == -1) {
+            std::sort(busy.begin(), busy.end(), [](const Busy &l, const Busy &r) { return l.begin < r.begin; });
+            int bottom = 0;
+            int best_gap = std::numeric_limits<int>::max();
+            for (const Busy &b : busy) {
+                int gap = b.begin - align(bottom);
+                if (gap >= box.size && gap < best_gap) {
+                    offset = align(bottom);
+                    best_gap = gap;
+                    if (!bestFit) break;
+                }
+                bottom = std::max(bottom, b.end);
+            }
+            // no gap fits the box, so it is placed on top of the others
+            if (offset == -1) offset = align(bottom);
+        }
 
-        // store the max top bound for each box
-        _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;
+        placed.push_back({&box, offset});
+        offsets[box.id] = offset;
+        min_required = std::max(min_required, offset + box.size);
     }
+    return min_required;
+}
 
-    return _min_required;
+int MemorySolver::solve() {
+    typedef std::function<bool(const Box&, const Box&)> Order;
+    const std::vector<Order> orders = {
+        // the biggest first
+        [](const Box& l, const Box& r) { return l.size > r.size; },
+        // in the execution order, the longest living first
+        [](const Box& l, const Box& r) { return l.start < r.start || (l.start == r.start && l.finish > r.finish); },
+        // the longest living first, then the biggest
+        [](const Box& l, const Box& r) {
+            int l_life = l.finish - l.start, r_life = r.finish - r.start;
+            return l_life > r_life || (l_life == r_life && l.size > r.size);
+        },
+    };
+
+    int min_required = -1;
+    for (const auto &order : orders) {
+        for (bool bestFit : {false, true}) {
+            std::vector<Box> boxes = _boxes;
+            std::stable_sort(boxes.begin(), boxes.end(), order);
+            std::map<int, int> offsets;
+            int required = place(boxes, bestFit, offsets);
+            if (min_required == -1 || required < min_required) {
+                min_required = required;
+                _offsets.swap(offsets);
+            }
+        }
+    }
+    return min_required;
 }
 
 int MemorySolver::maxDepth() {
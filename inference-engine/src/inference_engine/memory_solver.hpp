@@ -66,8 +66,25 @@ public:
 
     explicit MemorySolver(const std::vector<Box> boxes);
 
+    /**
+     * @brief Requires the offset of the box to be a multiple of the alignment. Should be called before solve().
+     * @param id - identifier of the box
+     * @param alignment - alignment of the offset in the units of the box size
+     */
+    void setAlignment(int id, int alignment);
+
+    /**
+     * @brief Allows the box to alias the parent box (e.g. the output of an in-place layer), so they may be placed
+     * at the same offset even though their lifetimes intersect. Should be called before solve().
+     * @param id - identifier of the box
+     * @param parentId - identifier of the box to alias
+     */
+    void setInPlace(int id, int parentId);
+
     /**
      * @brief Solve memory location with maximal reuse.
+     * Several placement heuristics (first-fit and best-fit over the boxes sorted by size, by start and by
+     * lifetime) are tried, the offsets of the smallest result are kept.
      * @return Size of common memory blob required for storing all
      */
     int solve();
@@ -83,11 +100,14 @@ public:
 private:
     std::vector<Box> _boxes;
     std::map<int, int> _offsets;
+    std::map<int, int> _alignments;
+    std::map<int, int> _inPlace;
     int _top_depth = -1;
     int _depth = -1;
     int _time_duration = -1;
 
     void calcDepth();
+    int place(std::vector<Box> &boxes, bool bestFit, std::map<int, int> &offsets) const;
 };
 
 }  // namespace InferenceEngine
@@ -0,0 +1,104 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_allocator.hpp"
+#include <algorithm>
+
+#ifdef _WIN32
+#define _WINSOCKAPI_
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFileAllocator *MappedFileAllocator::create(const std::string &filePath) noexcept {
+    MappedFileAllocator *allocator = nullptr;
+    try {
+        allocator = new MappedFileAllocator();
+    } catch (...) {
+        return nullptr;
+    }
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        allocator->Release();
+        return nullptr;
+    }
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        allocator->_mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (allocator->_mapping != nullptr) {
+            allocator->_data = MapViewOfFile(allocator->_mapping, FILE_MAP_COPY, 0, 0, 0);
+            allocator->_size = static_cast<size_t>(fileSize.QuadPart);
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd == -1) {
+        allocator->Release();
+        return nullptr;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+        void *data = mmap(nullptr, fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            allocator->_data = data;
+            allocator->_size = static_cast<size_t>(fileStat.st_size);
+        }
+    }
+    // the mapping keeps the file referenced
+    close(fd);
+#endif
+    if (allocator->_data == nullptr) {
+        allocator->Release();
+        return nullptr;
+    }
+    return allocator;
+}
+
+void MappedFileAllocator::prefetch() noexcept {
+    if (!_prefetchers.empty() || _size <= prefetchChunk)
+        return;
+#ifndef _WIN32
+    // the kernel starts the asynchronous readahead of the whole file, the threads keep several reads in flight
+    madvise(_data, _size, MADV_WILLNEED);
+#endif
+    int threads = static_cast<int>(std::min<size_t>(prefetchThreads, _size / prefetchChunk));
+    try {
+        for (int t = 0; t < threads; t++)
+            _prefetchers.emplace_back(&MappedFileAllocator::prefetchChunks, this);
+    } catch (...) {
+        // the pages not prefetched are read on the first touch anyway
+    }
+}
+
+void MappedFileAllocator::prefetchChunks() noexcept {
+    const volatile char *data = static_cast<const char *>(_data);
+    const size_t pageSize = 4096;
+    for (size_t chunk = _nextChunk++; chunk * prefetchChunk < _size && !_stopPrefetch; chunk = _nextChunk++) {
+        size_t end = std::min(_size, (chunk + 1) * prefetchChunk);
+        char sink = 0;
+        for (size_t offset = chunk * prefetchChunk; offset < end; offset += pageSize)
+            sink ^= data[offset];
+        (void)sink;
+    }
+}
+
+MappedFileAllocator::~MappedFileAllocator() {
+    _stopPrefetch = true;
+    for (auto &prefetcher : _prefetchers)
+        prefetcher.join();
+#ifdef _WIN32
+    if (_data != nullptr) UnmapViewOfFile(_data);
+    if (_mapping != nullptr) CloseHandle(_mapping);
+#else
+    if (_data != nullptr) munmap(_data, _size);
+#endif
+}
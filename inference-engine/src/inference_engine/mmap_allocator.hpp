@@ -0,0 +1,79 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ie_allocator.hpp"
+
+/**
+ * @brief Allocator that serves the memory of a file mapped to the address space of the process.
+ * The file is mapped copy-on-write: the pages are shared with the page cache (and so with all the other
+ * processes that map the same file) until somebody writes to them, only the written pages are copied.
+ * The only "allocation" it supports is the single block of the file size.
+ * The pages are read when they are touched first, prefetch reads them ahead in the background, so the parsing and
+ * the repacking of the weights run on the pages already read while the rest of the file is still being read.
+ */
+class MappedFileAllocator : public InferenceEngine::IAllocator {
+public:
+    /**
+     * @brief Maps the file
+     * @param filePath - path to the file
+     * @return the allocator or nullptr if the file cannot be mapped
+     */
+    static MappedFileAllocator *create(const std::string &filePath) noexcept;
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void *lock(void *handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void *handle) noexcept override {}
+
+    void *alloc(size_t size) noexcept override {
+        return size <= _size ? _data : nullptr;
+    }
+
+    bool free(void *handle) noexcept override {
+        // the mapping lives until the allocator is released
+        return true;
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    /**
+     * @brief Starts reading the pages of the file in the background by several threads, the chunks of the file are
+     * read in parallel in the order of the file, the threads are stopped when the allocator is released
+     */
+    void prefetch() noexcept;
+
+    static constexpr size_t prefetchChunk = 4 * 1024 * 1024;
+    static constexpr int prefetchThreads = 4;
+
+protected:
+    ~MappedFileAllocator() override;
+
+private:
+    MappedFileAllocator() = default;
+
+    void prefetchChunks() noexcept;
+
+    void *_data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    void *_mapping = nullptr;
+#endif
+    std::vector<std::thread> _prefetchers;
+    std::atomic<size_t> _nextChunk{0};
+    std::atomic<bool> _stopPrefetch{false};
+};
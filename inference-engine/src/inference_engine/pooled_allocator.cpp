@@ -0,0 +1,103 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pooled_allocator.hpp"
+#include <new>
+#include <details/ie_irelease.hpp>
+
+namespace {
+
+// the header of a block keeps its size class, the data follows it with the alignment of new
+constexpr size_t headerSize = 16;
+const int classCount = PooledAllocator::sizeClass(PooledAllocator::maxClassSize) + 1;
+
+// stays valid after the cache of the exiting thread is destroyed, so the blobs freed later bypass it
+thread_local bool cacheDestroyed = false;
+
+struct ThreadCache {
+    std::unique_ptr<void *[]> blocks{new void *[classCount * PooledAllocator::maxCachedBlocks]};
+    std::unique_ptr<size_t[]> counts{new size_t[classCount]()};
+    size_t bytes = 0;
+
+    ~ThreadCache() {
+        for (int c = 0; c < classCount; c++) {
+            for (size_t i = 0; i < counts[c]; i++)
+                delete[] static_cast<char *>(blocks[c * PooledAllocator::maxCachedBlocks + i]);
+        }
+        cacheDestroyed = true;
+    }
+};
+
+ThreadCache *threadCache() noexcept {
+    if (cacheDestroyed)
+        return nullptr;
+    try {
+        thread_local ThreadCache cache;
+        return &cache;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+}  // namespace
+
+std::shared_ptr<InferenceEngine::IAllocator> PooledAllocator::shared() {
+    static std::shared_ptr<InferenceEngine::IAllocator> allocator =
+            InferenceEngine::details::shared_from_irelease(new PooledAllocator());
+    return allocator;
+}
+
+int PooledAllocator::sizeClass(size_t size) noexcept {
+    if (size > maxClassSize)
+        return -1;
+    // the size in the units of 64 bytes, the classes are 4 + j units shifted by the power of two
+    size_t units = (size + 63) / 64;
+    if (units < 4)
+        units = 4;
+    int power = 0;
+    while ((units >> (power + 1)) != 0)
+        power++;
+    for (int j = 0; j < 4; j++) {
+        if ((static_cast<size_t>(4 + j) << (power - 2)) >= units)
+            return 4 * (power - 2) + j;
+    }
+    return 4 * (power - 1);
+}
+
+void *PooledAllocator::alloc(size_t size) noexcept {
+    int c = sizeClass(size);
+    if (c >= 0) {
+        ThreadCache *cache = threadCache();
+        if (cache && cache->counts[c] > 0) {
+            char *block = static_cast<char *>(cache->blocks[c * maxCachedBlocks + --cache->counts[c]]);
+            cache->bytes -= classSize(c);
+            return block + headerSize;
+        }
+        size = classSize(c);
+    }
+
+    char *block = new (std::nothrow) char[size + headerSize];
+    if (block == nullptr)
+        return nullptr;
+    *reinterpret_cast<int *>(block) = c;
+    return block + headerSize;
+}
+
+bool PooledAllocator::free(void *handle) noexcept {
+    if (handle == nullptr)
+        return true;
+    char *block = static_cast<char *>(handle) - headerSize;
+    int c = *reinterpret_cast<int *>(block);
+    if (c >= 0) {
+        ThreadCache *cache = threadCache();
+        if (cache && cache->counts[c] < maxCachedBlocks && cache->bytes + classSize(c) <= maxCachedBytes) {
+            cache->blocks[c * maxCachedBlocks + cache->counts[c]++] = block;
+            cache->bytes += classSize(c);
+            return true;
+        }
+    }
+    delete[] block;
+    return true;
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include "ie_allocator.hpp"
+
+/**
+ * @brief Allocator of the transient blobs, which are allocated and freed again and again with the same sizes
+ * (the scratch blobs of the pre-processing, the I/O blobs of the requests created per inference).
+ * The sizes are rounded up to the size classes of four steps per power of two, and the freed blocks are kept in
+ * a cache of the freeing thread to serve the next allocation of the class on the thread, so the allocations of
+ * the steady state do not reach the system allocator. Every thread caches up to maxCachedBytes, the blocks over
+ * maxClassSize are not pooled. The cache of a thread is freed when the thread exits.
+ */
+class PooledAllocator : public InferenceEngine::IAllocator {
+public:
+    static constexpr size_t maxClassSize = 256 * 1024 * 1024;
+    static constexpr size_t maxCachedBytes = 256 * 1024 * 1024;
+    static constexpr size_t maxCachedBlocks = 8;
+
+    /**
+     * @brief The allocator shared by the process, the blocks it caches are served to any of its blobs
+     */
+    static std::shared_ptr<InferenceEngine::IAllocator> shared();
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void *lock(void *handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void *handle) noexcept override {}
+
+    void *alloc(size_t size) noexcept override;
+
+    bool free(void *handle) noexcept override;
+
+    /**
+     * @brief Returns the size class of the given size or -1 for the sizes over maxClassSize
+     */
+    static int sizeClass(size_t size) noexcept;
+
+    /**
+     * @brief Returns the bytes of the blocks of the size class
+     */
+    static size_t classSize(int sizeClass) noexcept {
+        // 256, 320, 384, 448, 512, 640, ...
+        return (static_cast<size_t>(4 + sizeClass % 4) << (sizeClass / 4)) * 64;
+    }
+};
@@ -5,28 +5,16 @@
 
 #include "precision_utils.h"
 #include <stdint.h>
+#include <cstring>
 #include <details/ie_exception.hpp>
 #include <ie_blob.h>
 #include <emmintrin.h>
 #include <nmmintrin.h>
 #include "inference_engine.hpp"
+#include "ie_parallel.hpp"
 
 using namespace InferenceEngine;
 
-void PrecisionUtils::f16tof32Arrays(float *dst, const short *src, size_t nelem, float scale, float bias) {
-    const ie_fp16 *_src = reinterpret_cast<const ie_fp16 *>(src);
-
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
-    }
-}
-
-void PrecisionUtils::f32tof16Arrays(short *dst, const float *src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
-    }
-}
-
 // Function to convert F32 into F16
 // F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
 // F16: exp_bias:15  SEEEEEMM MMMMMMMM
@@ -146,6 +134,117 @@ ie_fp16 PrecisionUtils::f32tof16(float x) {
     return v.u | s;
 }
 
+// the array kernels are compiled for several instruction sets, the best one for the CPU is selected at load time
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 6) && defined(__linux__)
+# define MULTIVERSION  __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+# define MULTIVERSION
+#endif
+
+// the arrays smaller than this are converted by the calling thread
+#define PARALLEL_GRAIN (64 * 1024)
+
+namespace {
+
+inline uint32_t asuint(float v) {
+    uint32_t u;
+    std::memcpy(&u, &v, sizeof(u));
+    return u;
+}
+
+// Branch-free forms of f16tof32() and f32tof16() with the same results, so the loops are vectorized
+inline float f16tof32_select(ie_fp16 x) {
+    uint32_t h = static_cast<uint16_t>(x);
+    uint32_t s = (h & 0x8000) << 16;
+    uint32_t m = h & 0x03FF;
+
+    uint32_t nan_inf = ((m | (m ? 0x0200 : 0)) << (23 - 10)) | EXP_MASK_F32;
+    uint32_t normal = ((h & 0x7FFF) << (23 - 10)) + ((127 - 15) << 23);
+    uint32_t u = (h & EXP_MASK_F16) == EXP_MASK_F16 ? nan_inf : ((h & EXP_MASK_F16) == 0 ? 0 : normal);
+
+    return asfloat(u | s);
+}
+
+inline ie_fp16 f32tof16_select(float x) {
+    const float min16 = asfloat((127 - 14) << 23);
+    const float max16 = asfloat(((127 + 15) << 23) | 0x007FE000);
+    const uint32_t max16f16 = ((15 + 15) << 10) | 0x3FF;
+
+    uint32_t v = asuint(x);
+    uint32_t s = (v >> 16) & 0x8000;
+    v &= 0x7FFFFFFF;
+
+    uint32_t nan_inf = s | (v >> (23 - 10)) | ((v & 0x007FFFFF) ? 0x0200 : 0);
+
+    float f = asfloat(v) + asfloat(v & EXP_MASK_F32) * asfloat((127 - 11) << 23);
+    uint32_t normal = (asuint(f) - ((127 - 15) << 23)) >> (23 - 10);
+    uint32_t r = f < min16 * 0.5F ? 0 : (f < min16 ? (1 << 10) : (f >= max16 ? max16f16 : normal));
+
+    return static_cast<ie_fp16>((v & EXP_MASK_F32) == EXP_MASK_F32 ? nan_inf : (r | s));
+}
+
+// BF16 is the upper half of FP32: the lower half is rounded to the nearest even, the NaNs stay quiet NaNs
+inline short f32tobf16_select(float x) {
+    uint32_t v = asuint(x);
+    uint32_t rounded = (v + 0x7FFF + ((v >> 16) & 1)) >> 16;
+    uint32_t nan = (v >> 16) | 0x0040;
+    return static_cast<short>((v & 0x7FFFFFFF) > EXP_MASK_F32 ? nan : rounded);
+}
+
+MULTIVERSION
+void f16tof32Range(float *dst, const ie_fp16 *src, size_t begin, size_t end, float scale, float bias) {
+    for (size_t i = begin; i < end; i++) {
+        dst[i] = f16tof32_select(src[i]) * scale + bias;
+    }
+}
+
+MULTIVERSION
+void f32tof16Range(ie_fp16 *dst, const float *src, size_t begin, size_t end, float scale, float bias) {
+    for (size_t i = begin; i < end; i++) {
+        dst[i] = f32tof16_select(src[i] * scale + bias);
+    }
+}
+
+MULTIVERSION
+void bf16tof32Range(float *dst, const short *src, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+        dst[i] = asfloat(static_cast<uint32_t>(static_cast<uint16_t>(src[i])) << 16);
+    }
+}
+
+MULTIVERSION
+void f32tobf16Range(short *dst, const float *src, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+        dst[i] = f32tobf16_select(src[i]);
+    }
+}
+
+}  // namespace
+
+void PrecisionUtils::f16tof32Arrays(float *dst, const short *src, size_t nelem, float scale, float bias) {
+    details::parallel_ranges(nelem, [=](size_t begin, size_t end) {
+        f16tof32Range(dst, src, begin, end, scale, bias);
+    }, PARALLEL_GRAIN);
+}
+
+void PrecisionUtils::f32tof16Arrays(short *dst, const float *src, size_t nelem, float scale, float bias) {
+    details::parallel_ranges(nelem, [=](size_t begin, size_t end) {
+        f32tof16Range(dst, src, begin, end, scale, bias);
+    }, PARALLEL_GRAIN);
+}
+
+void PrecisionUtils::bf16tof32Arrays(float *dst, const short *src, size_t nelem) {
+    details::parallel_ranges(nelem, [=](size_t begin, size_t end) {
+        bf16tof32Range(dst, src, begin, end);
+    }, PARALLEL_GRAIN);
+}
+
+void PrecisionUtils::f32tobf16Arrays(short *dst, const float *src, size_t nelem) {
+    details::parallel_ranges(nelem, [=](size_t begin, size_t end) {
+        f32tobf16Range(dst, src, begin, end);
+    }, PARALLEL_GRAIN);
+}
+
 namespace InferenceEngine {
     template<>
     void copyToFloat<uint8_t>(float *dst, const InferenceEngine::Blob *src) {
@@ -22,6 +22,10 @@ INFERENCE_ENGINE_API_CPP(void) f16tof32Arrays(float *dst, const short *src, size
 
 INFERENCE_ENGINE_API_CPP(void) f32tof16Arrays(short *dst, const float *src, size_t nelem, float scale = 1.f, float bias = 0.f);
 
+INFERENCE_ENGINE_API_CPP(void) bf16tof32Arrays(float *dst, const short *src, size_t nelem);
+
+INFERENCE_ENGINE_API_CPP(void) f32tobf16Arrays(short *dst, const float *src, size_t nelem);
+
 }  // namespace PrecisionUtils
 
 }  // namespace InferenceEngine
@@ -31,6 +31,8 @@
 #include "ie_resample_shape_infer.hpp"
 #include "ie_interp_shape_infer.hpp"
 #include "ie_argmax_shape_infer.hpp"
+#include "ie_gemm_shape_infer.hpp"
+#include "ie_gather_shape_infer.hpp"
 #include <algorithm>
 #include <memory>
 #include <string>
@@ -133,6 +135,8 @@ REG_SHAPE_INFER_FOR_TYPE(ReorgYoloShapeProp, ReorgYolo);
 REG_SHAPE_INFER_FOR_TYPE(RegionYoloShapeProp, RegionYolo);
 REG_SHAPE_INFER_FOR_TYPE(SpatialTransformerShapeProp, SpatialTransformer);
 REG_SHAPE_INFER_FOR_TYPE(ArgMaxShapeProp, ArgMax);
+REG_SHAPE_INFER_FOR_TYPE(GemmShapeProp, Gemm);
+REG_SHAPE_INFER_FOR_TYPE(GatherShapeProp, Gather);
 
 }  // namespace ShapeInfer
 }  // namespace InferenceEngine
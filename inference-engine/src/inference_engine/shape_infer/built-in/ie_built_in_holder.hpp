@@ -10,6 +10,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include <ie_layers.h>
 #include <ie_iextension.h>
@@ -58,11 +59,29 @@ public:
             THROW_IE_EXCEPTION << "Internal error: failed to find validator for layer with type: " << _type;
     }
 
-    void validate(CNNLayer* layer, const std::vector<SizeVector>& inShapes,
+    /**
+     * @brief Fills the fields of the layer from the params and checks them against the shapes and blobs.
+     * The layers passed here have nothing but the params and the type set, so the parsed layer is cached per params:
+     * the repeated reshapes of the network only copy it and re-check the shapes.
+     */
+    template <class LayerType>
+    void validate(LayerType* layer, const std::vector<SizeVector>& inShapes,
                   const std::map<std::string, std::string>& params,
                   const std::map<std::string, Blob::Ptr>& blobs) {
-        _validator->parseParams(layer);
-        _validator->checkParams(layer);
+        std::shared_ptr<CNNLayer> parsed;
+        {
+            std::lock_guard<std::mutex> lock(_parsedMutex);
+            auto found = _parsed.find(params);
+            if (found != _parsed.end()) parsed = found->second;
+        }
+        if (parsed) {
+            *layer = *std::static_pointer_cast<LayerType>(parsed);
+        } else {
+            _validator->parseParams(layer);
+            _validator->checkParams(layer);
+            std::lock_guard<std::mutex> lock(_parsedMutex);
+            _parsed[params] = std::make_shared<LayerType>(*layer);
+        }
         _validator->checkShapes(layer, inShapes);
         _validator->checkCorrespondence(layer, blobs, inShapes);
     }
@@ -92,6 +111,10 @@ public:
 protected:
     std::string _type;
     details::LayerValidator::Ptr _validator;
+
+private:
+    std::mutex _parsedMutex;
+    std::map<std::map<std::string, std::string>, std::shared_ptr<CNNLayer>> _parsed;
 };
 
 }  // namespace ShapeInfer
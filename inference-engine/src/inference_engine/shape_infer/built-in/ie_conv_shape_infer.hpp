@@ -35,13 +35,19 @@ public:
         convLayer.type = _type;
         validate(&convLayer, inShapes, params, blobs);
 
-        float OH_temp, OW_temp;
         auto dims = inShapes[0];
+        // the 5D inputs are convolved along the depth too
+        bool is3D = dims.size() == 5;
         size_t inputN = dims[0];
-        size_t IH = dims[2];
-        size_t IW = dims[3];
-        size_t KH = 0, KW = 0;
+        size_t ID = is3D ? dims[2] : 1;
+        size_t IH = dims[dims.size() - 2];
+        size_t IW = dims[dims.size() - 1];
+        size_t KD = 0, KH = 0, KW = 0;
         int PR = -1, PB = -1;
+        if (convLayer._dilation_z)
+            KD = (convLayer._kernel_z - 1) * convLayer._dilation_z + 1;
+        else
+            KD = convLayer._kernel_z;
         if (convLayer._dilation_y)
             KH = (convLayer._kernel_y - 1) * convLayer._dilation_y + 1;
         else
@@ -50,39 +56,42 @@ public:
             KW = (convLayer._kernel_x - 1) * convLayer._dilation_x + 1;
         else
             KW = convLayer._kernel_x;
+        size_t SD = convLayer._stride_z;
         size_t SH = convLayer._stride_y;
         size_t SW = convLayer._stride_x;
+        size_t PD = convLayer._padding_z;
         size_t PH = convLayer._padding_y;
         size_t PW = convLayer._padding_x;
         size_t OC = convLayer._out_depth;
         auto it = convLayer.params.find("auto_pad");
         std::string padType;
         if (it != convLayer.params.end()) padType = it->second;
-        if (padType == "valid") {
-            OH_temp = std::ceil((IH - KH + 1.f) / SH);
-            OW_temp = std::ceil((IW - KW + 1.f) / SW);
-        } else if (padType == "same_upper") {
-            OH_temp = std::ceil(1.f * IH / SH);
-            OW_temp = std::ceil(1.f * IW / SW);
-        } else if (padType == "same_lower") {
-            OH_temp = std::floor(1.f * IH / SH);
-            OW_temp = std::floor(1.f * IW / SW);
-        } else {
+        if (padType != "valid" && padType != "same_upper" && padType != "same_lower") {
             PR = convLayer.GetParamAsInt("pad-r", -1);
             PB = convLayer.GetParamAsInt("pad-b", -1);
-            if (PR < 0 || PB < 0) {
-                OH_temp = std::floor((IH + 2.f * PH - KH) / SH) + 1;
-                OW_temp = std::floor((IW + 2.f * PW - KW) / SW) + 1;
-            } else {
-                OH_temp = std::floor(1.f * (IH + PH + PB - KH) / SH) + 1;
-                OW_temp = std::floor(1.f * (IW + PW + PR - KW) / SW) + 1;
-            }
         }
-        if (OH_temp < 0 || OW_temp < 0)
+        // the output size along an axis of the size I, the (dilated) kernel K, the stride S and the paddings P, PE
+        auto outSize = [&](size_t I, size_t K, size_t S, size_t P, size_t PE) -> float {
+            if (padType == "valid")
+                return std::ceil((I - K + 1.f) / S);
+            if (padType == "same_upper")
+                return std::ceil(1.f * I / S);
+            if (padType == "same_lower")
+                return std::floor(1.f * I / S);
+            return std::floor((1.f * (I + P + PE) - K) / S) + 1;
+        };
+        bool padEnd = PR >= 0 && PB >= 0;
+        float OD_temp = is3D ? outSize(ID, KD, SD, PD, PD) : 1.f;
+        float OH_temp = outSize(IH, KH, SH, PH, padEnd ? static_cast<size_t>(PB) : PH);
+        float OW_temp = outSize(IW, KW, SW, PW, padEnd ? static_cast<size_t>(PR) : PW);
+        if (OD_temp < 0 || OH_temp < 0 || OW_temp < 0)
             THROW_IE_EXCEPTION << "New shapes " << details::dumpVec(dims) << " make output shape negative";
         size_t OH = static_cast<size_t>(OH_temp);
         size_t OW = static_cast<size_t>(OW_temp);
-        outShapes.push_back({inputN, OC, OH, OW});
+        if (is3D)
+            outShapes.push_back({inputN, OC, static_cast<size_t>(OD_temp), OH, OW});
+        else
+            outShapes.push_back({inputN, OC, OH, OW});
     }
 };
 
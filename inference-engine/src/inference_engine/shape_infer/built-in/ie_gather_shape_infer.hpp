@@ -0,0 +1,47 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_built_in_holder.hpp"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace ShapeInfer {
+
+/**
+ *@brief Implementation of Shape inference for Gather layer
+ */
+class GatherShapeProp : public BuiltInShapeInferImpl {
+public:
+    explicit GatherShapeProp(const std::string& type) : BuiltInShapeInferImpl(type) {}
+
+    void inferShapesImpl(const std::vector<SizeVector>& inShapes,
+                         const std::map<std::string, std::string>& params,
+                         const std::map<std::string, Blob::Ptr>& blobs,
+                         std::vector<SizeVector>& outShapes) override {
+        LayerParams lp{};
+        GatherLayer gatherLayer(lp);
+        gatherLayer.params = params;
+        gatherLayer.type = _type;
+        validate(&gatherLayer, inShapes, params, blobs);
+
+        const SizeVector& dictShape = inShapes[0];
+        const SizeVector& indicesShape = inShapes[1];
+        int axis = gatherLayer.axis < 0 ? gatherLayer.axis + static_cast<int>(dictShape.size()) : gatherLayer.axis;
+
+        // the axis dimension of the dictionary is replaced by the dimensions of the indices
+        SizeVector outShape(dictShape.begin(), dictShape.begin() + axis);
+        outShape.insert(outShape.end(), indicesShape.begin(), indicesShape.end());
+        outShape.insert(outShape.end(), dictShape.begin() + axis + 1, dictShape.end());
+        outShapes.push_back(outShape);
+    }
+};
+
+}  // namespace ShapeInfer
+}  // namespace InferenceEngine
@@ -0,0 +1,52 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_built_in_holder.hpp"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace ShapeInfer {
+
+/**
+ *@brief Implementation of Shape inference for Gemm layer
+ */
+class GemmShapeProp : public BuiltInShapeInferImpl {
+public:
+    explicit GemmShapeProp(const std::string& type) : BuiltInShapeInferImpl(type) {}
+
+    void inferShapesImpl(const std::vector<SizeVector>& inShapes,
+                         const std::map<std::string, std::string>& params,
+                         const std::map<std::string, Blob::Ptr>& blobs,
+                         std::vector<SizeVector>& outShapes) override {
+        LayerParams lp{};
+        GemmLayer gemmLayer(lp);
+        gemmLayer.params = params;
+        gemmLayer.type = _type;
+        validate(&gemmLayer, inShapes, params, blobs);
+
+        const SizeVector& shapeA = inShapes[0];
+        const SizeVector& shapeB = inShapes[1];
+        // the batch dimensions of the inputs are broadcast to each other
+        size_t rank = std::max(shapeA.size(), shapeB.size());
+        SizeVector outShape(rank, 1);
+        for (size_t i = 2; i < rank; i++) {
+            size_t a = i < shapeA.size() ? shapeA[shapeA.size() - 1 - i] : 1;
+            size_t b = i < shapeB.size() ? shapeB[shapeB.size() - 1 - i] : 1;
+            outShape[rank - 1 - i] = std::max(a, b);
+        }
+        outShape[rank - 2] = gemmLayer.transpose_a ? shapeA.back() : shapeA[shapeA.size() - 2];
+        outShape[rank - 1] = gemmLayer.transpose_b ? shapeB[shapeB.size() - 2] : shapeB.back();
+        outShapes.push_back(outShape);
+    }
+};
+
+}  // namespace ShapeInfer
+}  // namespace InferenceEngine
@@ -32,62 +32,62 @@ public:
         poolLayer.type = _type;
         validate(&poolLayer, inShapes, params, blobs);
 
-        float OHTemp = 1.f, OWTemp = 1.f;
         auto dims = inShapes[0];
+        // the 5D inputs are pooled along the depth too
+        bool is3D = dims.size() == 5;
         int PR = -1, PB = -1;
         size_t inputN = dims[0];
         size_t IC = dims[1];
-        size_t IH = dims[2];
-        size_t IW = dims[3];
+        size_t ID = is3D ? dims[2] : 1;
+        size_t IH = dims[dims.size() - 2];
+        size_t IW = dims[dims.size() - 1];
+        size_t KD = poolLayer._kernel_z;
         size_t KH = poolLayer._kernel_y;
         size_t KW = poolLayer._kernel_x;
+        size_t SD = poolLayer._stride_z;
         size_t SH = poolLayer._stride_y;
         size_t SW = poolLayer._stride_x;
+        size_t PD = poolLayer._padding_z;
         size_t PH = poolLayer._padding_y;
         size_t PW = poolLayer._padding_x;
 
         auto it = poolLayer.params.find("auto_pad");
         std::string padType;
         if (it != poolLayer.params.end()) padType = it->second;
-        if (padType == "valid") {
-            OHTemp = std::ceil((IH - KH + 1.f) / SH);
-            OWTemp = std::ceil((IW - KW + 1.f) / SW);
-        } else if (padType == "same_upper") {
-            OHTemp = std::ceil(1.f * IH / SH);
-            OWTemp = std::ceil(1.f * IW / SW);
-        } else if (padType == "same_lower") {
-            OHTemp = std::floor(1.f * IH / SH);
-            OWTemp = std::floor(1.f * IW / SW);
-        } else {
+        bool isCeil = true;
+        if (padType != "valid" && padType != "same_upper" && padType != "same_lower") {
             it = poolLayer.params.find("rounding-type");
-            bool isCeil = true;
             if (it != poolLayer.params.end()) {
                 if (it->second == "floor") isCeil = false;
             }
             PR = poolLayer.GetParamAsInt("pad-r", -1);
             PB = poolLayer.GetParamAsInt("pad-b", -1);
-            if (PR < 0 || PB < 0) {
-                OHTemp += (IH + 2.f * PH - KH) / SH;
-                OWTemp += (IW + 2.f * PW - KW) / SW;
-            } else {
-                OHTemp += 1.f * (IH + PH + PB - KH) / SH;
-                OWTemp += 1.f * (IW + PW + PR - KW) / SW;
-            }
-            if (isCeil) {
-                OHTemp = std::ceil(OHTemp);
-                OWTemp = std::ceil(OWTemp);
-            } else {
-                OHTemp = std::floor(OHTemp);
-                OWTemp = std::floor(OWTemp);
-            }
-            if ((OHTemp - 1) * SH >= IH + PH) --OHTemp;
-            if ((OWTemp - 1) * SW >= IW + PW) --OWTemp;
         }
-        if (OHTemp < 0 || OWTemp < 0)
+        // the output size along an axis of the size I, the kernel K, the stride S and the paddings P, PE
+        auto outSize = [&](size_t I, size_t K, size_t S, size_t P, size_t PE) -> float {
+            if (padType == "valid")
+                return std::ceil((I - K + 1.f) / S);
+            if (padType == "same_upper")
+                return std::ceil(1.f * I / S);
+            if (padType == "same_lower")
+                return std::floor(1.f * I / S);
+            float O = 1.f + (1.f * (I + P + PE) - K) / S;
+            O = isCeil ? std::ceil(O) : std::floor(O);
+            if ((O - 1) * S >= I + P) --O;
+            return O;
+        };
+        bool padEnd = PR >= 0 && PB >= 0;
+        float ODTemp = is3D ? outSize(ID, KD, SD, PD, PD) : 1.f;
+        float OHTemp = outSize(IH, KH, SH, PH, padEnd ? static_cast<size_t>(PB) : PH);
+        float OWTemp = outSize(IW, KW, SW, PW, padEnd ? static_cast<size_t>(PR) : PW);
+        if (ODTemp < 0 || OHTemp < 0 || OWTemp < 0)
             THROW_IE_EXCEPTION << "New shapes " << details::dumpVec(dims) << " make output shape negative";
         size_t OH = static_cast<size_t>(OHTemp);
         size_t OW = static_cast<size_t>(OWTemp);
-        outShapes.emplace_back(std::initializer_list<size_t>{inputN, IC, OH, OW});
+        if (is3D)
+            outShapes.emplace_back(std::initializer_list<size_t>{inputN, IC, static_cast<size_t>(ODTemp), OH, OW});
+        else
+            outShapes.emplace_back(std::initializer_list<size_t>{inputN, IC, OH, OW});
     }
 };
 
@@ -8,6 +8,9 @@
 #include <string>
 #include <memory>
 #include <tuple>
+#include <list>
+#include <utility>
+#include <algorithm>
 #include <ie_layers.h>
 #include <graph_tools.hpp>
 #include <ie_layer_validators.hpp>
@@ -86,6 +89,15 @@ void Reshaper::AddExtension(const IShapeInferExtensionPtr& extension) {
         }
     }
     _extensions.push_back(extension);
+    // shapes inferred by the replaced implementations are not valid anymore
+    _shapesCache.clear();
+}
+
+void Reshaper::setCacheSize(size_t size) {
+    _cacheSize = size;
+    if (_shapesCache.size() > _cacheSize) {
+        _shapesCache.resize(_cacheSize);
+    }
 }
 
 ReshapeLauncher::Ptr Reshaper::getLauncherByLayerName(const std::string& layerName) const {
@@ -99,6 +111,10 @@ ReshapeLauncher::Ptr Reshaper::getLauncherByLayerName(const std::string& layerNa
 }
 
 void Reshaper::run(const std::map<std::string, SizeVector>& inputShapes) {
+    // inputs without the given shape keep the current one, so it's a part of the cache key too
+    auto allInputShapes = resolveInputShapes(inputShapes);
+    if (restoreFromCache(allInputShapes)) return;
+
     // Reset all shapes from previous run
     for (const auto& launcher : _launchers) {
         launcher->reset();
@@ -109,9 +125,9 @@ void Reshaper::run(const std::map<std::string, SizeVector>& inputShapes) {
         std::string layerName = input->name;
         for (auto const& outData : input->outData) {
             std::string dataName = outData->name;
-            auto foundShapeIt = inputShapes.find(dataName);
+            auto foundShapeIt = allInputShapes.find(dataName);
             auto foundLauncher = getLauncherByLayerName(layerName);
-            if (foundShapeIt != inputShapes.end()) {
+            if (foundShapeIt != allInputShapes.end()) {
                 foundLauncher->setShapeByName(foundShapeIt->second, dataName);
             } else {
                 foundLauncher->setIRShapeByName(dataName);
@@ -130,6 +146,51 @@ void Reshaper::run(const std::map<std::string, SizeVector>& inputShapes) {
         auto foundLauncher = getLauncherByLayerName(layer->name);
         foundLauncher->applyChanges(layer.get());
     }
+
+    storeToCache(allInputShapes);
+}
+
+std::map<std::string, SizeVector>
+Reshaper::resolveInputShapes(const std::map<std::string, SizeVector>& inputShapes) const {
+    std::map<std::string, SizeVector> allInputShapes;
+    for (auto const& input : _inputLayers) {
+        for (auto const& outData : input->outData) {
+            auto foundShapeIt = inputShapes.find(outData->name);
+            allInputShapes[outData->name] = foundShapeIt != inputShapes.end() ? foundShapeIt->second
+                                                                              : outData->getTensorDesc().getDims();
+        }
+    }
+    return allInputShapes;
+}
+
+bool Reshaper::restoreFromCache(const std::map<std::string, SizeVector>& inputShapes) {
+    auto found = std::find_if(_shapesCache.begin(), _shapesCache.end(),
+                              [&inputShapes](const std::pair<std::map<std::string, SizeVector>, DataShapes>& entry) {
+                                  return entry.first == inputShapes;
+                              });
+    if (found == _shapesCache.end()) return false;
+
+    for (const auto& dataShape : found->second) {
+        if (dataShape.first->getTensorDesc().getDims() != dataShape.second)
+            dataShape.first->setDims(dataShape.second);
+    }
+    _shapesCache.splice(_shapesCache.begin(), _shapesCache, found);
+    return true;
+}
+
+void Reshaper::storeToCache(const std::map<std::string, SizeVector>& inputShapes) {
+    if (!_cacheSize) return;
+
+    DataShapes dataShapes;
+    for (auto& layer : _allSortedLayers) {
+        for (const auto& outData : layer->outData) {
+            if (outData) dataShapes.emplace_back(outData, outData->getTensorDesc().getDims());
+        }
+    }
+    _shapesCache.emplace_front(inputShapes, std::move(dataShapes));
+    if (_shapesCache.size() > _cacheSize) {
+        _shapesCache.pop_back();
+    }
 }
 
 caseless_set<std::string> Reshaper::getTypeNamesFromExtension(const IShapeInferExtensionPtr& extension) {
@@ -72,23 +72,41 @@ public:
 
     /**
      * @brief Launches shape inference for the given ICNNNetworkAdds and input shapes.
-     * Throws if shape infer failed without corruption of original shapes
+     * Throws if shape infer failed without corruption of original shapes.
+     * Output shapes of all data are cached per input shapes, so the repeated run only restores them.
      * @param inputShapes - Map of input names (data) to their input shapes.
      */
     void run(const std::map<std::string, SizeVector>& inputShapes);
 
+    /**
+     * @brief Sets the maximum number of input shapes combinations to keep in the cache. Zero disables caching.
+     * @param size - maximum number of cached entries
+     */
+    void setCacheSize(size_t size);
+
     using Ptr = std::shared_ptr<Reshaper>;
 private:
     ReshapeLauncher::Ptr getLauncherByLayerName(const std::string& layerName) const;
 
     static caseless_set<std::string> getTypeNamesFromExtension(const IShapeInferExtensionPtr& extension);
 
+    std::map<std::string, SizeVector> resolveInputShapes(const std::map<std::string, SizeVector>& inputShapes) const;
+
+    bool restoreFromCache(const std::map<std::string, SizeVector>& inputShapes);
+
+    void storeToCache(const std::map<std::string, SizeVector>& inputShapes);
+
+    using DataShapes = std::vector<std::pair<DataPtr, SizeVector>>;
+
 private:
     std::vector<IShapeInferExtensionPtr> _extensions;
     std::set<ReshapeLauncher::Ptr> _launchers;
     std::vector<CNNLayerPtr> _allSortedLayers{};
     CNNLayerSet _inputLayers{};
     caseless_set<std::string> _allTypes;
+    // most recently used input shapes are first
+    std::list<std::pair<std::map<std::string, SizeVector>, DataShapes>> _shapesCache;
+    size_t _cacheSize = 32;
 };
 
 }  // namespace ShapeInfer
@@ -0,0 +1,99 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shm_allocator.hpp"
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#define _WINSOCKAPI_
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SharedMemoryAllocator *SharedMemoryAllocator::create(const std::string &name, size_t size, bool create) noexcept {
+    if (name.empty() || (create && size == 0))
+        return nullptr;
+    SharedMemoryAllocator *allocator = nullptr;
+    try {
+        allocator = new SharedMemoryAllocator();
+    } catch (...) {
+        return nullptr;
+    }
+#ifdef _WIN32
+    std::string mappingName = "Local\\" + name;
+    if (create) {
+        allocator->_mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                                 static_cast<DWORD>(static_cast<uint64_t>(size) >> 32),
+                                                 static_cast<DWORD>(size), mappingName.c_str());
+        if (allocator->_mapping != nullptr && GetLastError() == ERROR_ALREADY_EXISTS) {
+            allocator->Release();
+            return nullptr;
+        }
+    } else {
+        allocator->_mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, mappingName.c_str());
+    }
+    if (allocator->_mapping != nullptr) {
+        allocator->_data = MapViewOfFile(allocator->_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+        MEMORY_BASIC_INFORMATION info;
+        if (allocator->_data != nullptr && size == 0 && VirtualQuery(allocator->_data, &info, sizeof(info)) != 0)
+            size = info.RegionSize;
+        allocator->_size = size;
+    }
+#else
+    // the portable names of the POSIX shared memory start with the single slash
+    std::string segmentName = name[0] == '/' ? name : "/" + name;
+    int fd = create ? shm_open(segmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)
+                    : shm_open(segmentName.c_str(), O_RDWR, 0);
+    if (fd == -1) {
+        allocator->Release();
+        return nullptr;
+    }
+    if (create) {
+        allocator->_createdName = segmentName;
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+            size = 0;
+    } else {
+        struct stat segmentStat;
+        if (fstat(fd, &segmentStat) != 0 || static_cast<size_t>(segmentStat.st_size) < size)
+            size = 0;
+        else if (size == 0)
+            size = static_cast<size_t>(segmentStat.st_size);
+    }
+    if (size > 0) {
+        void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (data != MAP_FAILED) {
+            allocator->_data = data;
+            allocator->_size = size;
+        }
+    }
+    // the mapping keeps the segment referenced
+    close(fd);
+#endif
+    if (allocator->_data == nullptr) {
+        allocator->Release();
+        return nullptr;
+    }
+    return allocator;
+}
+
+SharedMemoryAllocator::~SharedMemoryAllocator() {
+#ifdef _WIN32
+    if (_data != nullptr) UnmapViewOfFile(_data);
+    if (_mapping != nullptr) CloseHandle(_mapping);
+#else
+    if (_data != nullptr) munmap(_data, _size);
+    if (!_createdName.empty()) shm_unlink(_createdName.c_str());
+#endif
+}
+
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateSharedMemoryAllocator(const char *name, size_t size,
+                                                                            bool create) noexcept {
+    return name == nullptr ? nullptr : SharedMemoryAllocator::create(name, size, create);
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include "ie_allocator.hpp"
+
+/**
+ * @brief Allocator that serves the memory of a named shared memory segment (POSIX shared memory, the named file
+ * mapping on Windows), so the blobs of several processes mapping the segment of the same name share their data.
+ * The process creating the segment removes its name when the allocator is released, the mappings of the other
+ * processes stay valid until they release their allocators.
+ * The only "allocation" it supports is the single block of the segment size.
+ */
+class SharedMemoryAllocator : public InferenceEngine::IAllocator {
+public:
+    /**
+     * @brief Creates or opens the segment and maps it
+     * @param name - the name of the segment
+     * @param size - the bytes of the created segment, the opened one is mapped whole if 0
+     * @param create - creates the segment if true, opens the existing one otherwise
+     * @return the allocator or nullptr if the segment cannot be created or mapped
+     */
+    static SharedMemoryAllocator *create(const std::string &name, size_t size, bool create) noexcept;
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void *lock(void *handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void *handle) noexcept override {}
+
+    void *alloc(size_t size) noexcept override {
+        return size <= _size ? _data : nullptr;
+    }
+
+    bool free(void *handle) noexcept override {
+        // the mapping lives until the allocator is released
+        return true;
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+protected:
+    ~SharedMemoryAllocator() override;
+
+private:
+    SharedMemoryAllocator() = default;
+
+    void *_data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    void *_mapping = nullptr;
+#else
+    // the name to unlink, empty for the opened segments
+    std::string _createdName;
+#endif
+};
@@ -10,7 +10,10 @@
 #include "xml_parse_utils.h"
 #include "ie_blob_proxy.hpp"
 #include "range_iterator.hpp"
+#include "ie_parallel.hpp"
 #include <fstream>
+#include <exception>
+#include <vector>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -114,11 +117,10 @@ void V2FormatParser::ParseGenericParams(pugi::xml_node& node, LayerParseParamete
 
 InferenceEngine::CNNLayer::Ptr V2FormatParser::CreateLayer(pugi::xml_node& node,
                                                        LayerParseParameters& layerParsePrms) const {
-    for (auto &creator : getCreators()) {
-        if (!creator->shouldCreate(layerParsePrms.prms.type))
-            continue;
-        return creator->CreateLayer(node, layerParsePrms);
-    }
+    auto &creators = getCreatorsByType();
+    auto creator = creators.find(layerParsePrms.prms.type);
+    if (creator != creators.end())
+        return creator->second->CreateLayer(node, layerParsePrms);
     static V2LayerCreator<GenericLayer> genericCreator("");
     return genericCreator.CreateLayer(node, layerParsePrms);
 }
@@ -188,9 +190,10 @@ CNNNetworkImplPtr V2FormatParser::Parse(pugi::xml_node& root) {
         CNNLayer::Ptr layer = CreateLayer(node, lprms);
         if (!layer) THROW_IE_EXCEPTION << "Don't know how to create Layer type: " << lprms.prms.type;
 
-        layersParseInfo[layer->name] = lprms;
+        LayerParseParameters& parseInfo = layersParseInfo[layer->name];
+        parseInfo = std::move(lprms);
         _network->addLayer(layer);
-        layerById[lprms.layerId] = layer;
+        layerById[parseInfo.layerId] = layer;
 
         if (equal(layer->type, "input")) {
             inputLayers.push_back(layer);
@@ -198,18 +201,18 @@ CNNNetworkImplPtr V2FormatParser::Parse(pugi::xml_node& root) {
 
         if (identifyNetworkPrecision) {
             if (!_network->getPrecision()) {
-                _network->setPrecision(lprms.prms.precision);
+                _network->setPrecision(parseInfo.prms.precision);
             }
-            if (_network->getPrecision() != lprms.prms.precision) {
+            if (_network->getPrecision() != parseInfo.prms.precision) {
                 _network->setPrecision(Precision::MIXED);
                 identifyNetworkPrecision = false;
             }
         }
 
-        for (const auto& outPort : lprms.outputPorts) {
-            const std::string outId = details::stringFormat("%d.%d", lprms.layerId, outPort.portId);
-            const std::string outName = lprms.outputPorts.size() == 1 ? lprms.prms.name
-                : details::stringFormat("%s.%d", lprms.prms.name.c_str(), outPort.portId);
+        for (const auto& outPort : parseInfo.outputPorts) {
+            const std::string outId = details::stringFormat("%d.%d", parseInfo.layerId, outPort.portId);
+            const std::string outName = parseInfo.outputPorts.size() == 1 ? parseInfo.prms.name
+                : details::stringFormat("%s.%d", parseInfo.prms.name.c_str(), outPort.portId);
             DataPtr& ptr = _network->getData(outName.c_str());
             if (!ptr) {
                 ptr.reset(new Data(outName, outPort.dims, outPort.precision, TensorDesc::getLayoutByDims(outPort.dims)));
@@ -309,6 +312,8 @@ CNNNetworkImplPtr V2FormatParser::Parse(pugi::xml_node& root) {
         THROW_IE_EXCEPTION << "Incorrect model! Network doesn't contain layers.";
 
     // check all input ports are occupied
+    std::vector<CNNLayer*> layers;
+    layers.reserve(_network->allLayers().size());
     for (const auto& kvp : _network->allLayers()) {
         const CNNLayer::Ptr& layer = kvp.second;
         const LayerParseParameters& parseInfo = layersParseInfo[layer->name];
@@ -322,7 +327,23 @@ CNNNetworkImplPtr V2FormatParser::Parse(pugi::xml_node& root) {
                                    << parseInfo.inputPorts[i].portId << " is not connected to any data";
             }
         }
-        layer->validateLayer();
+        layers.push_back(layer.get());
+    }
+    // the validation of a layer reads only its own params and data, so the layers are validated in parallel;
+    // the error of the first invalid layer is reported as the serial validation did
+    std::vector<std::exception_ptr> errors(layers.size());
+    parallel_ranges(layers.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            try {
+                layers[i]->validateLayer();
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    }, 64);
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
     }
     // parse mean image
     ParsePreProcess(root);
@@ -372,6 +393,8 @@ Blob::Ptr V2FormatParser::GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights,
         return GetTypedBlobFromSegment<short>(weights, segment);
     } else if (segment.precision == Precision::U8) {
         return GetTypedBlobFromSegment<uint8_t>(weights, segment);
+    } else if (segment.precision == Precision::I8) {
+        return GetTypedBlobFromSegment<int8_t>(weights, segment);
     } else {
         THROW_IE_EXCEPTION << "precision " << segment.precision << " is not supported...";
     }
@@ -395,6 +418,11 @@ void V2FormatParser::SetWeights(const TBlob<uint8_t>::Ptr& weights) {
                 pWL->_biases  = GetBlobFromSegment(weights, lprms.blobs["biases"]);
                 pWL->blobs["biases"] = pWL->_biases;
             }
+            // the compressed weights come with their scales, e.g. the per output channel w-scale of the I8 weights
+            for (const auto& s : lprms.blobs) {
+                if (s.first != "weights" && s.first != "biases")
+                    pWL->blobs[s.first] = GetBlobFromSegment(weights, s.second);
+            }
         }
         auto pGL = dynamic_cast<GenericLayer *>(kvp.second.get());
         if (pGL == nullptr) continue;
@@ -614,8 +642,21 @@ const std::vector<std::shared_ptr<BaseCreator> >& V2FormatParser::getCreators()
         std::make_shared<V2LayerCreator<TileLayer>>("Tile"),
         std::make_shared<ActivationLayerCreator>("Activation"),
         std::make_shared<V2LayerCreator<BatchNormalizationLayer>>("BatchNormalization"),
+        std::make_shared<V2LayerCreator<GemmLayer>>("Gemm"),
+        std::make_shared<V2LayerCreator<GatherLayer>>("Gather"),
     };
     return creators;
 }
 
 
+const caseless_unordered_map<std::string, std::shared_ptr<BaseCreator> >& V2FormatParser::getCreatorsByType() const {
+    static caseless_unordered_map<std::string, std::shared_ptr<BaseCreator> > creatorsByType = [this]() {
+        caseless_unordered_map<std::string, std::shared_ptr<BaseCreator> > result;
+        for (auto &creator : getCreators()) {
+            // the first creator registered for the type wins, as in the linear lookup
+            result.emplace(creator->type(), creator);
+        }
+        return result;
+    }();
+    return creatorsByType;
+}
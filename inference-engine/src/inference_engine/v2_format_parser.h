@@ -58,6 +58,18 @@ public:
 
     virtual CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& layerParsePrms) = 0;
 
+    /**
+     * @brief Creates the layer of the params stored by the binary topology (see BinaryFormatParser), which are the
+     * params of a layer created already, or returns nullptr if the creator makes the layers from the XML only
+     */
+    virtual CNNLayer::Ptr CreateLayerFromParams(const LayerParams& prms) {
+        return nullptr;
+    }
+
+    const std::string& type() const {
+        return type_;
+    }
+
     bool shouldCreate(const std::string& nodeType) const {
         CaselessEq<std::string> comparator;
         return comparator(nodeType, type_);
@@ -74,14 +86,18 @@ public:
     void SetWeights(const TBlob<uint8_t>::Ptr& weights) override;
     void ParseDims(SizeVector& dims, const pugi::xml_node &node) const;
 
+protected:
+    std::map<std::string, LayerParseParameters> layersParseInfo;
+    CNNNetworkImplPtr _network;
+    std::map<std::string, std::vector<WeightSegment>> _preProcessSegments;
+
+    const caseless_unordered_map<std::string, std::shared_ptr<BaseCreator> > &getCreatorsByType() const;
+
 private:
     int _version;
     Precision _defPrecision;
-    std::map<std::string, LayerParseParameters> layersParseInfo;
     std::map<std::string, DataPtr> _portsToData;
 
-    CNNNetworkImplPtr _network;
-    std::map<std::string, std::vector<WeightSegment>> _preProcessSegments;
     const std::vector<std::shared_ptr<BaseCreator> > &getCreators() const;
     void ParsePort(LayerParseParameters::LayerPortData& port, pugi::xml_node &node) const;
     void ParseGenericParams(pugi::xml_node& node, LayerParseParameters& layerParsePrms) const;
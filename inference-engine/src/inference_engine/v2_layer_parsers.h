@@ -15,8 +15,8 @@
 #include <string>
 #include <map>
 
-inline pugi::xml_node GetChild(const pugi::xml_node& node, std::vector<std::string> tags, bool failIfMissing = true) {
-    for (auto tag : tags) {
+inline pugi::xml_node GetChild(const pugi::xml_node& node, const std::vector<std::string>& tags, bool failIfMissing = true) {
+    for (const auto& tag : tags) {
         pugi::xml_node dn = node.child(tag.c_str());
         if (!dn.empty()) return dn;
     }
@@ -38,21 +38,23 @@ public:
     CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& layerParsePrms) override {
         auto res = std::make_shared<LT>(layerParsePrms.prms);
 
+        // the creators are shared by all the parsers, so the tags are not stored in them
+        std::vector<std::string> childTags;
         if (std::is_same<LT, FullyConnectedLayer>::value) {
-            layerChild[res->name] = {"fc", "fc_data", "data"};
+            childTags = {"fc", "fc_data", "data"};
         } else if (std::is_same<LT, NormLayer>::value) {
-            layerChild[res->name] = {"lrn", "norm", "norm_data", "data"};
+            childTags = {"lrn", "norm", "norm_data", "data"};
         } else if (std::is_same<LT, CropLayer>::value) {
-            layerChild[res->name] = {"crop", "crop-data", "data"};
+            childTags = {"crop", "crop-data", "data"};
         } else if (std::is_same<LT, BatchNormalizationLayer>::value) {
-            layerChild[res->name] = {"batch_norm", "batch_norm_data", "data"};
+            childTags = {"batch_norm", "batch_norm_data", "data"};
         } else if ((std::is_same<LT, EltwiseLayer>::value)) {
-            layerChild[res->name] = {"elementwise", "elementwise_data", "data"};
+            childTags = {"elementwise", "elementwise_data", "data"};
         } else {
-            layerChild[res->name] = {"data", tolower(res->type) + "_data", tolower(res->type)};
+            childTags = {"data", tolower(res->type) + "_data", tolower(res->type)};
         }
 
-        pugi::xml_node dn = GetChild(node, layerChild[res->name], false);
+        pugi::xml_node dn = GetChild(node, childTags, false);
 
         if (!dn.empty()) {
             if (dn.child("crop").empty()) {
@@ -97,7 +99,9 @@ public:
         return res;
     }
 
-    std::map <std::string, std::vector<std::string>> layerChild;
+    CNNLayer::Ptr CreateLayerFromParams(const LayerParams& prms) override {
+        return std::make_shared<LT>(prms);
+    }
 };
 
 class ActivationLayerCreator : public BaseCreator {
@@ -4,19 +4,67 @@
 //
 
 #include "config.h"
+#include "mkldnn_allocator.h"
 #include "ie_plugin_config.hpp"
 #include "ie_common.h"
+#include "mkldnn/omp_manager.h"
+#include "ie_trace.hpp"
 
 #include <string>
 #include <map>
 #include <algorithm>
+#include <stdexcept>
+#include <vector>
 #include <cpp_interfaces/exception2status.hpp>
 
 namespace MKLDNNPlugin {
 
 using namespace InferenceEngine;
 
+namespace {
+
+// the list of the cpus and the ranges of the cpus, e.g. "0-7,16"
+std::vector<unsigned> parseCpuList(const std::string &val) {
+    std::vector<unsigned> cpus;
+    std::size_t pos = 0;
+    while (pos < val.size()) {
+        std::size_t end = val.find(',', pos);
+        if (end == std::string::npos)
+            end = val.size();
+        const std::string range = val.substr(pos, end - pos);
+        const std::size_t dash = range.find('-');
+        int first, last;
+        try {
+            std::size_t parsed = 0;
+            first = std::stoi(range.substr(0, dash), &parsed);
+            if (parsed != (dash == std::string::npos ? range.size() : dash))
+                throw std::invalid_argument(range);
+            last = first;
+            if (dash != std::string::npos) {
+                last = std::stoi(range.substr(dash + 1), &parsed);
+                if (parsed != range.size() - dash - 1)
+                    throw std::invalid_argument(range);
+            }
+        } catch (const std::exception&) {
+            THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CORES
+                               << ". Expected only the comma separated cpus and ranges of the cpus, e.g. 0-7,16";
+        }
+        if (first < 0 || last < first)
+            THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CORES
+                               << ". The range " << range << " is empty";
+        for (int cpu = first; cpu <= last; cpu++) {
+            if (std::find(cpus.begin(), cpus.end(), static_cast<unsigned>(cpu)) == cpus.end())
+                cpus.push_back(cpu);
+        }
+        pos = end + 1;
+    }
+    return cpus;
+}
+
+}  // namespace
+
 void Config::readProperties(const std::map<std::string, std::string> &prop) {
+    bool traceChanged = false;
     for (auto& kvp : prop) {
         std::string key = kvp.first;
         std::string val = kvp.second;
@@ -27,6 +75,115 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BIND_THREAD
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_THREADS_NUM) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THREADS_NUM
+                                   << ". Expected only non-negative numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THREADS_NUM
+                                   << ". Expected only non-negative numbers";
+            threadsNum = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_CORES) {
+            cores = parseCpuList(val);
+        } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) {
+            if (val == PluginConfigParams::CPU_THROUGHPUT_NUMA) {
+                throughputStreams = cpu::OpenMpManager::getNumberOfNumaNodes();
+            } else if (val == PluginConfigParams::CPU_THROUGHPUT_AUTO) {
+                // bare minimum of streams: every stream gets about 4 cores, which is enough
+                // for the small-batch topologies that scale badly on the whole machine
+                const int num_cores = cpu::OpenMpManager::getOpenMpThreadNumber();
+                throughputStreams = std::max(1, num_cores / 4);
+            } else {
+                int val_i;
+                try {
+                    val_i = std::stoi(val);
+                } catch (const std::exception&) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS
+                                       << ". Expected only positive numbers (#streams) or "
+                                       << "PluginConfigParams::CPU_THROUGHPUT_NUMA/CPU_THROUGHPUT_AUTO";
+                }
+                if (val_i < 1)
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS
+                                       << ". Expected only positive numbers (#streams)";
+                throughputStreams = val_i;
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_WORK_STEALING) {
+            if (val == PluginConfigParams::YES) workStealing = true;
+            else if (val == PluginConfigParams::NO) workStealing = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_WORK_STEALING
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_ALLOCATOR) {
+            allocator = createAllocator(val);
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_DOMAIN) {
+            memoryDomain = val;
+        } else if (key == PluginConfigParams::KEY_TUNING_MODE) {
+            if (val == PluginConfigParams::TUNING_DISABLED) tuningMode = TuningMode::Disabled;
+            else if (val == PluginConfigParams::TUNING_CREATE) tuningMode = TuningMode::Create;
+            else if (val == PluginConfigParams::TUNING_USE_EXISTING) tuningMode = TuningMode::UseExisting;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_TUNING_MODE
+                                   << ". Expected only TUNING_DISABLED/TUNING_CREATE/TUNING_USE_EXISTING";
+        } else if (key == PluginConfigParams::KEY_TUNING_FILE) {
+            tuningFile = val;
+        } else if (key == PluginConfigParams::KEY_CPU_RESHAPE_CACHE_SIZE) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_RESHAPE_CACHE_SIZE
+                                   << ". Expected only non-negative numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_RESHAPE_CACHE_SIZE
+                                   << ". Expected only non-negative numbers";
+            reshapeCacheSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT
+                                   << ". Expected only non-negative numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT
+                                   << ". Expected only non-negative numbers";
+            autoBatchTimeout = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_BATCH_TILE) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BATCH_TILE
+                                   << ". Expected only non-negative numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BATCH_TILE
+                                   << ". Expected only non-negative numbers";
+            batchTile = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SPATIAL_TILES) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPATIAL_TILES
+                                   << ". Expected only non-negative numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPATIAL_TILES
+                                   << ". Expected only non-negative numbers";
+            spatialTiles = val_i;
         } else if (key == PluginConfigParams::KEY_DYN_BATCH_LIMIT) {
             int val_i = std::stoi(val);
             // zero and any negative value will be treated
@@ -52,10 +209,96 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_TRACE_FILE) {
+            traceFile = val;
+            traceChanged = true;
+        } else if (key == PluginConfigParams::KEY_TRACE_WINDOW) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_TRACE_WINDOW
+                                   << ". Expected only non-negative numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_TRACE_WINDOW
+                                   << ". Expected only non-negative numbers";
+            traceWindow = val_i;
+            traceChanged = true;
+        } else if (key == PluginConfigParams::KEY_REQUEST_PRIORITY) {
+            try {
+                requestPriority = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_REQUEST_PRIORITY
+                                   << ". Expected only integer numbers";
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_PREEMPTION) {
+            if (val == PluginConfigParams::YES) preemption = true;
+            else if (val == PluginConfigParams::NO) preemption = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PREEMPTION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CALLBACK_THREADS) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CALLBACK_THREADS
+                                   << ". Expected only non-negative numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CALLBACK_THREADS
+                                   << ". Expected only non-negative numbers";
+            callbackThreads = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_LATENCY_SPIN) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_LATENCY_SPIN
+                                   << ". Expected only non-negative numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_LATENCY_SPIN
+                                   << ". Expected only non-negative numbers";
+            latencySpin = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_ARGMAX_OUTPUTS) {
+            argmaxOutputs.clear();
+            std::size_t pos = 0;
+            while (pos < val.size()) {
+                std::size_t end = val.find(',', pos);
+                if (end == std::string::npos)
+                    end = val.size();
+                if (end == pos)
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_ARGMAX_OUTPUTS
+                                       << ". Expected only the comma separated names of the outputs";
+                argmaxOutputs.push_back(val.substr(pos, end - pos));
+                pos = end + 1;
+            }
+        } else if (key == PluginConfigParams::KEY_RELEASE_WEIGHTS) {
+            if (val == PluginConfigParams::YES) releaseWeights = true;
+            else if (val == PluginConfigParams::NO) releaseWeights = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_RELEASE_WEIGHTS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
+            if (val == PluginConfigParams::YES) enforceBF16 = true;
+            else if (val == PluginConfigParams::NO) enforceBF16 = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_WARM_UP) {
+            if (val == PluginConfigParams::YES) warmUp = true;
+            else if (val == PluginConfigParams::NO) warmUp = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WARM_UP
+                                   << ". Expected only YES/NO";
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
     }
+    if (traceChanged)
+        TraceSink::instance().start(traceFile, traceWindow);
 }
 
 }  // namespace MKLDNNPlugin
@@ -7,15 +7,64 @@
 
 #include <string>
 #include <map>
+#include <memory>
+#include <vector>
+#include <ie_allocator.hpp>
 
 namespace MKLDNNPlugin {
 
 struct Config {
+    enum class TuningMode {
+        Disabled,
+        Create,
+        UseExisting,
+    };
+
     bool useThreadBinding = true;
+    // the threads and the logical cpus of the network, 0 and empty take the physical cores of the process
+    int threadsNum = 0;
+    std::vector<unsigned> cores;
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     int batchLimit = 0;
+    int throughputStreams = 1;
+    bool workStealing = false;
+    bool parallelBranches = false;
+    // nullptr means the default allocation of the MKLDNN memory and the blobs
+    std::shared_ptr<InferenceEngine::IAllocator> allocator;
+    // the graphs of the same non-empty domain share the memory of the intermediate data
+    std::string memoryDomain;
+    // the implementations of the convolutions, deconvolutions and poolings are selected by timing (see MKLDNNTuner)
+    TuningMode tuningMode = TuningMode::Disabled;
+    std::string tuningFile;
+    // the number of the graphs compiled for the reshaped inputs, 0 keeps the input shapes of the network
+    int reshapeCacheSize = 0;
+    // the time window of the auto-batching of the asynchronous requests in microseconds, 0 disables it
+    int autoBatchTimeout = 0;
+    // the samples and the bands of the image rows the graph is compiled for, 0 runs the whole inputs at once
+    int batchTile = 0;
+    int spatialTiles = 0;
+    // the Chrome trace of the inference is written to the non-empty file once the window (in milliseconds) ends
+    std::string traceFile;
+    int traceWindow = 0;
+    // the priority of the async requests in the shared executor, the higher priority ones preempt the network
+    // between the nodes if the preemption is enabled
+    int requestPriority = 0;
+    bool preemption = false;
+    // the threads the completion callbacks run on, 0 runs them inline on the inference threads
+    int callbackThreads = 1;
+    // the weights of the network are dropped once the graphs copied them
+    bool releaseWeights = false;
+    // the time in microseconds the synchronous inference spins for the completion, 0 runs it through the executor
+    int latencySpin = 0;
+    // the outputs holding the argmax of their channels instead of the channels
+    std::vector<std::string> argmaxOutputs;
+    // the fully connected layers keep their FP32 weights in BF16 and accumulate in FP32
+    bool enforceBF16 = false;
+    // the graphs run an inference at the load, so the first inference of the application does not pay for the
+    // first touch of the memory and the start of the threads
+    bool warmUp = false;
 
     void readProperties(const std::map<std::string, std::string> &config);
 };
@@ -4,6 +4,8 @@
 //
 
 #include "mean_image.h"
+#include <algorithm>
+#include <ie_parallel_for.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -78,27 +80,83 @@ void MeanImage::Subtract(const MKLDNNDims &inputDims, float *input) {
     }
 
     int MB = inputDims[0];
-    int srcSize = inputDims.size() / MB;
-
-    if (meanBuffer && meanBuffer->size()) {
-        const float * meanBufferValues = meanBuffer->readOnly();
-#   pragma omp parallel for collapse(2) schedule(static)
-        for (int mb = 0; mb < MB; mb++) {
-            for (int i = 0; i < srcSize; i++) {
-                input[srcSize * mb + i] -= meanBufferValues[i];
-            }
+    int C = inputDims[1];
+    int planeSize = inputDims.size() / MB / C;
+
+    if ((!meanBuffer || !meanBuffer->size()) && meanValues.empty())
+        return;
+
+    // the planes are processed in parallel, the contiguous loop over the plane is vectorized
+    const float *meanBufferValues = nullptr;
+    if (meanBuffer && meanBuffer->size())
+        meanBufferValues = meanBuffer->readOnly();
+    parallel_nd(MB, C, [&](int mb, int c) {
+        float *plane = input + (static_cast<size_t>(mb) * C + c) * planeSize;
+        if (meanBufferValues) {
+            const float *mean = meanBufferValues + static_cast<size_t>(c) * planeSize;
+            for (int i = 0; i < planeSize; i++)
+                plane[i] -= mean[i];
+        } else {
+            float mean = meanValues[c];
+            for (int i = 0; i < planeSize; i++)
+                plane[i] -= mean;
         }
-    } else if (!meanValues.empty()) {
-        int C = inputDims[1];
-        srcSize /= inputDims[1];
+    });
+}
+
+void MeanImage::Convert(const MKLDNNDims &inputDims, const uint8_t *input, bool nhwc, float *output) {
+    convert(inputDims, input, nhwc, output);
+}
+
+void MeanImage::Convert(const MKLDNNDims &inputDims, const float *input, bool nhwc, float *output) {
+    convert(inputDims, input, nhwc, output);
+}
 
-#   pragma omp parallel for collapse(3) schedule(static)
-        for (int mb = 0; mb < MB; mb++) {
+template <typename T>
+void MeanImage::convert(const MKLDNNDims &inputDims, const T *input, bool nhwc, float *output) {
+    IE_ASSERT(input != nullptr && output != nullptr);
+
+    if (inputDims.ndims() != 4) {
+        THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
+    }
+
+    const int MB = inputDims[0];
+    const int C = inputDims[1];
+    const int H = inputDims[2];
+    const int W = inputDims[3];
+
+    const float *meanBufferValues = nullptr;
+    if (meanBuffer && meanBuffer->size())
+        meanBufferValues = meanBuffer->readOnly();
+    const bool withMeanValues = !meanBufferValues && !meanValues.empty();
+
+    // the interleaved row is transposed by the tiles of the pixels, so the source of the tile stays in L1
+    const int tile = 64;
+
+    parallel_nd(MB, H, [&](int mb, int h) {
+        for (int w0 = 0; w0 < W; w0 += tile) {
+            const int w1 = std::min(W, w0 + tile);
             for (int c = 0; c < C; c++) {
-                for (int i = 0; i < srcSize; i++) {
-                    input[srcSize * mb * C + c * srcSize + i] -= meanValues[c];
+                float *dst = output + ((mb * C + c) * H + h) * W;
+                const T *src = nhwc ? input + ((mb * H + h) * W) * C + c
+                                    : input + ((mb * C + c) * H + h) * W;
+                const int stride = nhwc ? C : 1;
+
+                if (meanBufferValues) {
+                    const float *mean = meanBufferValues + (c * H + h) * W;
+                    for (int w = w0; w < w1; w++)
+                        dst[w] = static_cast<float>(src[w * stride]) - mean[w];
+                } else {
+                    const float mean = withMeanValues ? meanValues[c] : 0.f;
+                    if (stride == 1) {
+                        for (int w = w0; w < w1; w++)
+                            dst[w] = static_cast<float>(src[w]) - mean;
+                    } else {
+                        for (int w = w0; w < w1; w++)
+                            dst[w] = static_cast<float>(src[w * stride]) - mean;
+                    }
                 }
             }
         }
-    }
+    });
 }
@@ -9,6 +9,7 @@
 #include "mkldnn_dims.h"
 #include <vector>
 #include <limits>
+#include <ie_parallel_for.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -20,6 +21,24 @@ public:
     void Load(const MKLDNNDims& inputDims, InferenceEngine::InputInfo::Ptr inputInfo);
     void Subtract(const MKLDNNDims &inputDims, float *input);
 
+    /**
+     * @brief Converts the input of the planar (NCHW) or interleaved (NHWC) layout to the planar FP32 memory and
+     * subtracts the mean in the same pass. The rows of the images are processed in parallel.
+     * @param inputDims - dimensions of the input (N, C, H, W)
+     * @param input - the input data
+     * @param nhwc - true if the input is interleaved
+     * @param output - the planar FP32 memory of the network input
+     */
+    void Convert(const MKLDNNDims &inputDims, const uint8_t *input, bool nhwc, float *output);
+    void Convert(const MKLDNNDims &inputDims, const float *input, bool nhwc, float *output);
+
+    /**
+     * @brief Returns the per channel mean values, empty for the mean image
+     */
+    const std::vector<float>& getMeanValues() const {
+        return meanValues;
+    }
+
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
     void Subtract(const MKLDNNDims &inputDims, T *input) {
         IE_ASSERT(input != nullptr);
@@ -33,36 +52,31 @@ public:
 
         if (meanBuffer && meanBuffer->size()) {
             const float * meanBufferValues = meanBuffer->readOnly();
-        #   pragma omp parallel for collapse(2) schedule(static)
-            for (int mb = 0; mb < MB; mb++) {
-                for (int i = 0; i < srcSize; i++) {
-                    int buf = input[srcSize * mb + i];
-                    buf -= meanBufferValues[i];
-                    if (buf < std::numeric_limits<T>::min()) buf = std::numeric_limits<T>::min();
-                    if (buf > std::numeric_limits<T>::max()) buf = std::numeric_limits<T>::max();
-                    input[srcSize * mb + i] = buf;
-                }
-            }
+            InferenceEngine::parallel_nd(MB, srcSize, [&](int mb, int i) {
+                int buf = input[srcSize * mb + i];
+                buf -= meanBufferValues[i];
+                if (buf < std::numeric_limits<T>::min()) buf = std::numeric_limits<T>::min();
+                if (buf > std::numeric_limits<T>::max()) buf = std::numeric_limits<T>::max();
+                input[srcSize * mb + i] = buf;
+            });
         } else if (!meanValues.empty()) {
             int C = inputDims[1];
             srcSize /= inputDims[1];
 
-        #   pragma omp parallel for collapse(3) schedule(static)
-            for (int mb = 0; mb < MB; mb++) {
-                for (int c = 0; c < C; c++) {
-                    for (int i = 0; i < srcSize; i++) {
-                        int buf = input[srcSize * mb * C + c * srcSize + i];
-                        buf -= meanValues[c];
-                        if (buf < std::numeric_limits<T>::min()) buf = std::numeric_limits<T>::min();
-                        if (buf > std::numeric_limits<T>::max()) buf = std::numeric_limits<T>::max();
-                        input[srcSize * mb * C + c * srcSize + i] = buf;
-                    }
-                }
-            }
+            InferenceEngine::parallel_nd(MB, C, srcSize, [&](int mb, int c, int i) {
+                int buf = input[srcSize * mb * C + c * srcSize + i];
+                buf -= meanValues[c];
+                if (buf < std::numeric_limits<T>::min()) buf = std::numeric_limits<T>::min();
+                if (buf > std::numeric_limits<T>::max()) buf = std::numeric_limits<T>::max();
+                input[srcSize * mb * C + c * srcSize + i] = buf;
+            });
         }
     }
 
 private:
+    template <typename T>
+    void convert(const MKLDNNDims &inputDims, const T *input, bool nhwc, float *output);
+
     std::vector<float> meanValues;
 
     InferenceEngine::TBlob<float>::Ptr meanBuffer;
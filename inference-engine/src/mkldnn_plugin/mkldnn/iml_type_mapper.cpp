@@ -24,6 +24,8 @@ impl_desc_type MKLDNNPlugin::parse_impl_name(std::string impl_desc_name) {
     SEARCH_WORD(_1x1);
     SEARCH_WORD(_dw);
     SEARCH_WORD(reorder);
+    SEARCH_WORD(subpixel);
+    SEARCH_WORD(sparse);
 #undef SEARCH_WORD
 
 #define SEARCH_WORD_2(_wrd, _key) if (impl_desc_name.find(#_wrd) != std::string::npos) \
@@ -35,3 +37,42 @@ impl_desc_type MKLDNNPlugin::parse_impl_name(std::string impl_desc_name) {
 
     return res;
 }
+
+std::string MKLDNNPlugin::impl_type_to_string(impl_desc_type type) {
+    std::string str_type;
+
+    auto add_type = [&](std::string t) {
+        if (!str_type.empty() && t.c_str()[0] != '_')
+            str_type += "_";
+        str_type += t;
+    };
+
+#define SEARCH_TYPE(_type)                                          \
+    if ((type & impl_desc_type::_type) == impl_desc_type::_type)    \
+        add_type(#_type)
+
+    SEARCH_TYPE(undef);
+    SEARCH_TYPE(reorder);
+    SEARCH_TYPE(jit);
+    SEARCH_TYPE(gemm);
+    SEARCH_TYPE(sparse);
+    SEARCH_TYPE(ref);
+
+    SEARCH_TYPE(avx512);
+    SEARCH_TYPE(avx2);
+    SEARCH_TYPE(sse42);
+    SEARCH_TYPE(blas);
+    SEARCH_TYPE(any);
+
+    SEARCH_TYPE(winograd);
+    SEARCH_TYPE(subpixel);
+    SEARCH_TYPE(_dw);
+    SEARCH_TYPE(_1x1);
+#undef SEARCH_TYPE
+
+    if (type == impl_desc_type::unknown)
+        str_type = "unknown";
+    else if (str_type.empty())
+        str_type = "undef";
+    return str_type;
+}
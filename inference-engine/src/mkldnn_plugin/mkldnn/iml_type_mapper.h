@@ -29,6 +29,10 @@ enum impl_desc_type {
     reorder = 1<<17,
     // winograd
     winograd = 1<<18,
+    // sub-pixel decomposition of the strided deconvolution
+    subpixel = 1<<19,
+    // compressed sparse rows of the pruned weights
+    sparse = 1<<20,
     // real types
     ref_any             = ref  | any,
 
@@ -37,6 +41,10 @@ enum impl_desc_type {
     gemm_avx512         = gemm | avx512,
     gemm_avx2           = gemm | avx2,
     gemm_sse42          = gemm | sse42,
+    gemm_subpixel       = gemm | subpixel,
+
+    sparse_sse42        = sparse | sse42,
+    sparse_sse42_1x1    = sparse | sse42 | _1x1,
 
     jit_avx512_winograd = jit  | avx512 | winograd,
     jit_avx512          = jit  | avx512,
@@ -56,5 +64,9 @@ enum impl_desc_type {
 };
 
 impl_desc_type parse_impl_name(std::string impl_desc_name);
+/**
+ * @brief Returns the name of the implementation type, which is parsed back by parse_impl_name
+ */
+std::string impl_type_to_string(impl_desc_type type);
 
 }  // namespace MKLDNNPlugin
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include <iostream>
+#include <algorithm>
 
 namespace MKLDNNPlugin {
 namespace cpu {
@@ -261,6 +262,7 @@ OpenMpManager::OpenMpManager(Collection *collection) :
     getOpenMpEnvVars();
     getCurrentCpuSet();
     getCurrentCoreSet();
+    getNumaNodesCpus();
 }
 
 OpenMpManager &OpenMpManager::getInstance() {
@@ -305,12 +307,66 @@ void OpenMpManager::bindOpenMpThreads(int env_cores) {
     }
 }
 
+// Limits the OpenMP team of the calling thread to the given cpus and pins every
+// thread of the team to its own cpu. Used by the throughput streams, where each
+// stream owns a separate subset of cores (preferably of the same NUMA node).
+void OpenMpManager::bindOpenMpThreadsToCpus(const std::vector<unsigned> &cpus) {
+    OpenMpManager &openMpManager = getInstance();
+
+    if (cpus.empty())
+        return;
+
+    omp_set_num_threads(cpus.size());
+
+    if (!openMpManager.isThreadsBindAllowed())
+        return;
+
+    #pragma omp parallel
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpus[omp_get_thread_num() % cpus.size()], &set);
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+}
+
 int OpenMpManager::getOpenMpThreadNumber() {
     OpenMpManager &openMpManager = getInstance();
 
     return openMpManager.getCoreNumber();
 }
 
+int OpenMpManager::getNumberOfNumaNodes() {
+    OpenMpManager &openMpManager = getInstance();
+
+    return std::max<int>(1, openMpManager.numaNodesCpus.size());
+}
+
+std::vector<unsigned> OpenMpManager::getNumaNodeCpus(unsigned numaNode) {
+    OpenMpManager &openMpManager = getInstance();
+
+    if (numaNode >= openMpManager.numaNodesCpus.size())
+        return {};
+    return openMpManager.numaNodesCpus[numaNode];
+}
+
+std::vector<unsigned> OpenMpManager::getAvailableCoreCpus() {
+    OpenMpManager &openMpManager = getInstance();
+
+    std::vector<unsigned> cpus;
+    for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &openMpManager.currentCoreSet))
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+bool OpenMpManager::isCpuAvailable(unsigned cpu) {
+    OpenMpManager &openMpManager = getInstance();
+
+    return cpu < CPU_SETSIZE && CPU_ISSET(cpu, &openMpManager.currentCpuSet);
+}
+
 
 void OpenMpManager::getOpenMpEnvVars() {
     isAnyOpenMpEnvVarSpecified = false;
@@ -338,18 +394,34 @@ void OpenMpManager::getDefaultCpuSet(cpu_set_t *defaultCpuSet) {
 /* Function getCurrentCoreSet() fills currentCoreSet variable with a set of
    available CPUs, where only one CPU per core is chosen. When multiple CPUs
    of single core are used, function is selecting only first one of all
-   available. */
+   available. The CPUs of a core are told by the physical id and the core id
+   of /proc/cpuinfo, so any enumeration of the hyper-threads is handled. */
 void OpenMpManager::getCurrentCoreSet() {
     unsigned numberOfProcessors = collection.getNumberOfProcessors();
     unsigned totalNumberOfCpuCores = collection.getTotalNumberOfCpuCores();
 
+    std::set<std::pair<unsigned, unsigned>> usedCores;
+    for (unsigned processorId = 0; processorId < numberOfProcessors; processorId++) {
+        const Processor &processor = collection.getProcessor(processorId);
+        usedCores.insert(std::make_pair(processor.physicalId, processor.coreId));
+    }
+    // without the core ids (e.g. in some virtual machines) the hyper-threads are assumed to be enumerated core by core
+    const bool haveCoreIds = totalNumberOfCpuCores > 0 && usedCores.size() == totalNumberOfCpuCores;
+
     cpu_set_t usedCoreSet;
     CPU_ZERO(&usedCoreSet);
     CPU_ZERO(&currentCoreSet);
-
-    for (int processorId = 0; processorId < numberOfProcessors; processorId++) {
-        if (CPU_ISSET(processorId, &currentCpuSet)) {
-            unsigned coreId = processorId % totalNumberOfCpuCores;
+    usedCores.clear();
+
+    for (unsigned processorId = 0; processorId < numberOfProcessors; processorId++) {
+        if (!CPU_ISSET(processorId, &currentCpuSet))
+            continue;
+        if (haveCoreIds) {
+            const Processor &processor = collection.getProcessor(processorId);
+            if (usedCores.insert(std::make_pair(processor.physicalId, processor.coreId)).second)
+                CPU_SET(processorId, &currentCoreSet);
+        } else {
+            unsigned coreId = totalNumberOfCpuCores > 0 ? processorId % totalNumberOfCpuCores : processorId;
             if (!CPU_ISSET(coreId, &usedCoreSet)) {
                 CPU_SET(coreId, &usedCoreSet);
                 CPU_SET(processorId, &currentCoreSet);
@@ -358,6 +430,71 @@ void OpenMpManager::getCurrentCoreSet() {
     }
 }
 
+/* Function parses the list of cpus in the format of /sys/devices/system/node/node#/cpulist,
+   e.g. "0-13,28-41" */
+static std::vector<unsigned> parseCpuList(const std::string &cpuList) {
+    std::vector<unsigned> cpus;
+    const char *text = cpuList.c_str();
+    while (*text) {
+        char *end;
+        unsigned first = strtoul(text, &end, 10);
+        if (end == text)
+            break;
+        unsigned last = first;
+        text = end;
+        if (*text == '-') {
+            last = strtoul(text + 1, &end, 10);
+            text = end;
+        }
+        for (unsigned cpu = first; cpu <= last; cpu++)
+            cpus.push_back(cpu);
+        while (*text == ',' || isspace(*text))
+            text++;
+    }
+    return cpus;
+}
+
+/* Function getNumaNodesCpus() fills numaNodesCpus with the cpus of currentCoreSet
+   grouped by NUMA nodes. The nodes are read from the sysfs, when it is not available
+   each socket (physical id) is considered as a separate node. */
+void OpenMpManager::getNumaNodesCpus() {
+    unsigned numberOfProcessors = collection.getNumberOfProcessors();
+
+    numaNodesCpus.clear();
+    for (unsigned node = 0;; node++) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!file.is_open())
+            break;
+        std::string cpuList((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        std::vector<unsigned> nodeCpus;
+        for (auto cpu : parseCpuList(cpuList)) {
+            if (cpu < numberOfProcessors && CPU_ISSET(cpu, &currentCoreSet))
+                nodeCpus.push_back(cpu);
+        }
+        // nodes without (available) cpus, e.g. memory-only ones, are of no use for streams
+        if (!nodeCpus.empty())
+            numaNodesCpus.push_back(nodeCpus);
+    }
+
+    if (!numaNodesCpus.empty())
+        return;
+
+    std::vector<unsigned> physicalIds;
+    for (unsigned processorId = 0; processorId < numberOfProcessors; processorId++) {
+        if (!CPU_ISSET(processorId, &currentCoreSet))
+            continue;
+        unsigned physicalId = collection.getProcessor(processorId).physicalId;
+        auto found = std::find(physicalIds.begin(), physicalIds.end(), physicalId);
+        if (found == physicalIds.end()) {
+            physicalIds.push_back(physicalId);
+            numaNodesCpus.push_back({});
+            found = physicalIds.end() - 1;
+        }
+        numaNodesCpus[found - physicalIds.begin()].push_back(processorId);
+    }
+}
+
 void OpenMpManager::selectAllCoreCpus(cpu_set_t *set, unsigned physicalCoreId) {
     unsigned numberOfProcessors = collection.getNumberOfProcessors();
     unsigned totalNumberOfCpuCores = collection.getTotalNumberOfCpuCores();
@@ -132,8 +132,20 @@ public:
 
     static void bindOpenMpThreads(int env_cores = 0);
 
+    static void bindOpenMpThreadsToCpus(const std::vector<unsigned> &cpus);
+
     static int getOpenMpThreadNumber();
 
+    static int getNumberOfNumaNodes();
+
+    static std::vector<unsigned> getNumaNodeCpus(unsigned numaNode);
+
+    // the available cpus, one per physical core
+    static std::vector<unsigned> getAvailableCoreCpus();
+
+    // whether the process may run on the cpu
+    static bool isCpuAvailable(unsigned cpu);
+
     static void printVerboseInformation();
 
     static bool isMajorThread(int currentThread);
@@ -145,6 +157,8 @@ private:
     bool isAnyOpenMpEnvVarSpecified;
     cpu_set_t currentCpuSet;
     cpu_set_t currentCoreSet;
+    // available cpus (one per physical core) of every NUMA node
+    std::vector<std::vector<unsigned>> numaNodesCpus;
 
     explicit OpenMpManager(Collection *collection);
 
@@ -164,6 +178,8 @@ private:
 
     void getCurrentCoreSet();
 
+    void getNumaNodesCpus();
+
     void selectAllCoreCpus(cpu_set_t *set, unsigned physicalCoreId);
 
     unsigned getPhysicalCoreId(unsigned logicalCoreId);
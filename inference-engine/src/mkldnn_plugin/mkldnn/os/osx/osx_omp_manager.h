@@ -22,6 +22,10 @@ public:
         return getCoreNumber();
     }
 
+    static int getNumberOfNumaNodes() {
+        return 1;
+    }
+
     static int getCoreNumber() {
         return 4;
     }
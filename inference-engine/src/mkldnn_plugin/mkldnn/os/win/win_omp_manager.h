@@ -23,6 +23,10 @@ public:
         return getCoreNumber();
     }
 
+    static int getNumberOfNumaNodes() {
+        return 1;
+    }
+
     static int getCoreNumber() {
         int num_cores = std::thread::hardware_concurrency();
         unsigned long size = 0;
@@ -0,0 +1,58 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_allocator.h"
+#include <cstdlib>
+#include <string>
+#include <ie_plugin_config.hpp>
+#include <details/ie_exception.hpp>
+#include <details/ie_irelease.hpp>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+using namespace InferenceEngine;
+
+void *MKLDNNHugePagesAllocator::alloc(size_t size) noexcept {
+    // the size is rounded up, so the last huge page is not shared with the other allocations
+    size = (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+#ifdef _WIN32
+    return _aligned_malloc(size, hugePageSize);
+#else
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, hugePageSize, size) != 0)
+        return nullptr;
+#ifdef MADV_HUGEPAGE
+    // it is only a hint, so the failure is not an error
+    madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+    return ptr;
+#endif
+}
+
+bool MKLDNNHugePagesAllocator::free(void *handle) noexcept {
+#ifdef _WIN32
+    _aligned_free(handle);
+#else
+    std::free(handle);
+#endif
+    return true;
+}
+
+std::shared_ptr<IAllocator> createAllocator(const std::string &name) {
+    if (name == PluginConfigParams::CPU_ALLOCATOR_SYSTEM)
+        return nullptr;
+    if (name == PluginConfigParams::CPU_ALLOCATOR_HUGE_PAGES)
+        return details::shared_from_irelease(new MKLDNNHugePagesAllocator());
+    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_ALLOCATOR
+                       << ". Expected only PluginConfigParams::CPU_ALLOCATOR_SYSTEM/CPU_ALLOCATOR_HUGE_PAGES";
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,46 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <ie_allocator.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Allocator of the buffers aligned to the 2 MB huge pages.
+ * On Linux the buffers are advised to be backed by the transparent huge pages, so the large activations
+ * and weights take much fewer TLB entries. The allocation falls back to the regular pages if the system
+ * has no free huge pages.
+ */
+class MKLDNNHugePagesAllocator : public InferenceEngine::IAllocator {
+public:
+    static constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void *lock(void *handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void *handle) noexcept override {}
+
+    void *alloc(size_t size) noexcept override;
+
+    bool free(void *handle) noexcept override;
+};
+
+/**
+ * @brief Creates the allocator selected by the PluginConfigParams::KEY_CPU_MEMORY_ALLOCATOR value
+ * @return the allocator or nullptr for the default allocation of the plugin
+ */
+std::shared_ptr<InferenceEngine::IAllocator> createAllocator(const std::string &name);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,90 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Bump pointer storage for the objects that live as long as the graph.
+ * The objects are never returned to the arena one by one, the memory is freed all at once when the arena
+ * and every object allocated from it are destroyed. Allocation is not thread safe, it is done while the
+ * graph is built.
+ */
+class MKLDNNArena {
+public:
+    typedef std::shared_ptr<MKLDNNArena> Ptr;
+
+    explicit MKLDNNArena(size_t chunkSize = 64 * 1024): chunkSize(chunkSize) {}
+
+    void *allocate(size_t size, size_t alignment) {
+        if (!chunks.empty()) {
+            void *ptr = allocateInChunk(size, alignment);
+            if (ptr) return ptr;
+        }
+        capacity = std::max(chunkSize, size + alignment);
+        chunks.emplace_back(new char[capacity]);
+        used = 0;
+        return allocateInChunk(size, alignment);
+    }
+
+private:
+    void *allocateInChunk(size_t size, size_t alignment) {
+        auto base = reinterpret_cast<uintptr_t>(chunks.back().get());
+        uintptr_t ptr = (base + used + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+        if (ptr + size > base + capacity)
+            return nullptr;
+        used = ptr + size - base;
+        return reinterpret_cast<void *>(ptr);
+    }
+
+    size_t chunkSize;
+    size_t capacity = 0;
+    size_t used = 0;
+    std::vector<std::unique_ptr<char[]>> chunks;
+};
+
+/**
+ * @brief Standard allocator on top of the MKLDNNArena, intended for std::allocate_shared.
+ * The allocator holds the arena, so the arena outlives the control blocks of the shared pointers.
+ */
+template <typename T>
+class MKLDNNArenaAllocator {
+public:
+    typedef T value_type;
+
+    explicit MKLDNNArenaAllocator(const MKLDNNArena::Ptr &arena): arena(arena) {}
+
+    template <typename U>
+    MKLDNNArenaAllocator(const MKLDNNArenaAllocator<U> &other): arena(other.arena) {}
+
+    T *allocate(size_t n) {
+        return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const MKLDNNArenaAllocator<U> &other) const noexcept {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const MKLDNNArenaAllocator<U> &other) const noexcept {
+        return arena != other.arena;
+    }
+
+private:
+    template <typename U> friend class MKLDNNArenaAllocator;
+
+    MKLDNNArena::Ptr arena;
+};
+
+}  // namespace MKLDNNPlugin
@@ -4,21 +4,40 @@
 //
 
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_streams.h"
 #include <memory>
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                                                                const InferenceEngine::TaskSynchronizer::Ptr &taskSynchronizer,
-                                                               const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor)
-        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, taskSynchronizer, callbackExecutor) {}
+                                                               const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                                                               const MKLDNNAutoBatcher::Ptr &batcher)
+        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, taskSynchronizer, callbackExecutor),
+          batcher(batcher) {}
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
     waitAllAsyncTasks();
 }
 
 void MKLDNNPlugin::MKLDNNAsyncInferRequest::Infer() {
+    if (latencySpin > 0) {
+        // the calling thread runs the graph, so there is no hand over to the executor thread and back
+        keepThreadsSpinning(latencySpin);
+        InferenceEngine::AsyncInferRequestThreadSafeDefault::Infer();
+        return;
+    }
     _callbackManager.disableCallback();
     StartAsync();
     Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
     _callbackManager.enableCallback();
 }
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::SetLatencySpin(int micros) {
+    latencySpin = micros;
+    SetSpinTime(micros);
+}
+
+bool MKLDNNPlugin::MKLDNNAsyncInferRequest::startAsyncTaskElsewhere() {
+    auto request = std::dynamic_pointer_cast<MKLDNNInferRequest>(_syncRequest);
+    return batcher && request && batcher->enqueue(request, _currentTask);
+}
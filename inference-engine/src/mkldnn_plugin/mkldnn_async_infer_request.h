@@ -9,6 +9,7 @@
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include "mkldnn_infer_request.h"
+#include "mkldnn_auto_batching.h"
 
 namespace MKLDNNPlugin {
 
@@ -17,11 +18,26 @@ public:
     MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                             const InferenceEngine::TaskSynchronizer::Ptr &taskSynchronizer,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            const MKLDNNAutoBatcher::Ptr &batcher = nullptr);
 
     ~MKLDNNAsyncInferRequest() override;
 
     void Infer() override;
+
+    /**
+     * @brief Sets the latency mode (see KEY_CPU_LATENCY_SPIN): Infer runs the graph on the calling thread and
+     * the waits spin for the given time in microseconds before they block, 0 disables the mode
+     */
+    void SetLatencySpin(int micros);
+
+protected:
+    // the request is queued to the batcher, which executes it together with the other requests
+    bool startAsyncTaskElsewhere() override;
+
+private:
+    MKLDNNAutoBatcher::Ptr batcher;
+    int latencySpin = 0;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,136 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_auto_batching.h"
+#include <cpp_interfaces/exception2status.hpp>
+#include <exception>
+#include <memory>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+MKLDNNAutoBatcher::MKLDNNAutoBatcher(int batchLimit, int timeout, const ITaskExecutor::Ptr &executor,
+                                     const std::function<MKLDNNInferRequest::Ptr()> &createRequest)
+        : batchLimit(batchLimit), timeout(timeout), executor(executor), createRequest(createRequest) {
+    collector = std::thread([this]() { collect(); });
+}
+
+MKLDNNAutoBatcher::~MKLDNNAutoBatcher() {
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        stopped = true;
+        queueCondVar.notify_all();
+    }
+    if (collector.joinable())
+        collector.join();
+
+    std::unique_lock<std::mutex> lock(queueMutex);
+    queueCondVar.wait(lock, [this]() { return executingBatches == 0; });
+}
+
+bool MKLDNNAutoBatcher::enqueue(const MKLDNNInferRequest::Ptr &request, const Task::Ptr &task) {
+    int samples = request->GetBatchedSamples();
+    if (samples <= 0)
+        return false;
+
+    // the task is busy until the batch is executed, so the waiting for the request blocks
+    if (!task->occupy())
+        THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+
+    std::unique_lock<std::mutex> lock(queueMutex);
+    queue.push_back({request, task, samples, std::chrono::steady_clock::now()});
+    queuedSamples += samples;
+    queueCondVar.notify_all();
+    return true;
+}
+
+void MKLDNNAutoBatcher::collect() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    while (true) {
+        queueCondVar.wait(lock, [this]() { return stopped || !queue.empty(); });
+        if (queue.empty())
+            break;
+
+        // the window starts with the first queued request and ends when the batch is filled
+        auto deadline = queue.front().arrival + timeout;
+        queueCondVar.wait_until(lock, deadline, [this]() { return stopped || queuedSamples >= batchLimit; });
+
+        std::vector<QueuedRequest> batch;
+        int samples = 0;
+        while (!queue.empty() && samples + queue.front().samples <= batchLimit) {
+            samples += queue.front().samples;
+            batch.push_back(queue.front());
+            queue.pop_front();
+        }
+        queuedSamples -= samples;
+        executingBatches++;
+
+        auto task = std::make_shared<Task>([this, batch]() {
+            execute(batch);
+            std::unique_lock<std::mutex> lock(queueMutex);
+            executingBatches--;
+            queueCondVar.notify_all();
+        });
+        lock.unlock();
+        executor->startTask(task);
+        lock.lock();
+    }
+}
+
+void MKLDNNAutoBatcher::execute(const std::vector<QueuedRequest> &batch) {
+    std::exception_ptr exception;
+    if (batch.size() > 1) {
+        MKLDNNInferRequest::Ptr batchRequest;
+        try {
+            batchRequest = getBatchRequest();
+            int offset = 0;
+            for (auto &queued : batch) {
+                queued.request->CopyInputsToBatch(*batchRequest, offset, queued.samples);
+                offset += queued.samples;
+            }
+
+            batchRequest->SetBatch(offset);
+            batchRequest->Infer();
+
+            offset = 0;
+            for (auto &queued : batch) {
+                queued.request->CopyOutputsFromBatch(*batchRequest, offset, queued.samples);
+                offset += queued.samples;
+            }
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        if (batchRequest)
+            releaseBatchRequest(batchRequest);
+
+        for (auto &queued : batch)
+            queued.request->SetBatchedResult(exception);
+    }
+
+    // the single request is executed by its own task, the batched ones only report the result
+    for (auto &queued : batch)
+        queued.task->runNoThrowNoBusyCheck();
+}
+
+MKLDNNInferRequest::Ptr MKLDNNAutoBatcher::getBatchRequest() {
+    {
+        std::lock_guard<std::mutex> lock(batchRequestsMutex);
+        if (!batchRequests.empty()) {
+            auto request = batchRequests.back();
+            batchRequests.pop_back();
+            return request;
+        }
+    }
+    return createRequest();
+}
+
+void MKLDNNAutoBatcher::releaseBatchRequest(const MKLDNNInferRequest::Ptr &request) {
+    std::lock_guard<std::mutex> lock(batchRequestsMutex);
+    batchRequests.push_back(request);
+}
+
+}  // namespace MKLDNNPlugin
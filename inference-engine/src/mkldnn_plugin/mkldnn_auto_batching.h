@@ -0,0 +1,88 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cpp_interfaces/ie_itask_executor.hpp>
+#include "mkldnn_infer_request.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @class MKLDNNAutoBatcher
+ * @brief Collects the asynchronous requests started within the time window (see KEY_CPU_AUTO_BATCH_TIMEOUT) and
+ * executes them as one inference of the dynamic batch. The inputs of the requests are copied into the batch request,
+ * the outputs are copied back, and then the tasks of the requests are run to report the results and the callbacks.
+ * The window starts with the first queued request and ends earlier when the batch of the network is filled.
+ */
+class MKLDNNAutoBatcher {
+public:
+    typedef std::shared_ptr<MKLDNNAutoBatcher> Ptr;
+
+    /**
+     * @param batchLimit - the batch of the network, the largest number of the samples executed at once
+     * @param timeout - the time window in microseconds
+     * @param executor - the executor of the network, which runs the batches
+     * @param createRequest - creates the request executing the batch
+     */
+    MKLDNNAutoBatcher(int batchLimit, int timeout, const InferenceEngine::ITaskExecutor::Ptr &executor,
+                      const std::function<MKLDNNInferRequest::Ptr()> &createRequest);
+
+    /**
+     * @brief Stops collecting the requests, the queued ones and the started batches are finished before
+     */
+    ~MKLDNNAutoBatcher();
+
+    /**
+     * @brief Queues the started request to the next batch
+     * @param request - the request, which inputs are set
+     * @param task - the task of the request reporting its result, it is occupied until the batch is executed
+     * @return false if the request cannot be batched (e.g. it has the full batch or pre-processing), so the caller
+     * executes it as usual
+     */
+    bool enqueue(const MKLDNNInferRequest::Ptr &request, const InferenceEngine::Task::Ptr &task);
+
+private:
+    struct QueuedRequest {
+        MKLDNNInferRequest::Ptr request;
+        InferenceEngine::Task::Ptr task;
+        int samples;
+        std::chrono::steady_clock::time_point arrival;
+    };
+
+    void collect();
+    void execute(const std::vector<QueuedRequest> &batch);
+
+    MKLDNNInferRequest::Ptr getBatchRequest();
+    void releaseBatchRequest(const MKLDNNInferRequest::Ptr &request);
+
+    int batchLimit;
+    std::chrono::microseconds timeout;
+    InferenceEngine::ITaskExecutor::Ptr executor;
+    std::function<MKLDNNInferRequest::Ptr()> createRequest;
+
+    std::mutex queueMutex;
+    std::condition_variable queueCondVar;
+    std::deque<QueuedRequest> queue;
+    int queuedSamples = 0;
+    // the batches passed to the executor, the batcher is not destroyed until they are finished
+    int executingBatches = 0;
+    bool stopped = false;
+    std::thread collector;
+
+    // the requests executing the batches, several batches are executed at once by the streams
+    std::mutex batchRequestsMutex;
+    std::vector<MKLDNNInferRequest::Ptr> batchRequests;
+};
+
+}  // namespace MKLDNNPlugin
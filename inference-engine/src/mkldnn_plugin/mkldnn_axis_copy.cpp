@@ -0,0 +1,287 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_axis_copy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <immintrin.h>
+#include <ie_parallel_for.hpp>
+#include <details/ie_exception.hpp>
+
+#include "mkldnn_extension_utils.h"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the chunks are cut into the pieces of this size, so a few large parts are copied by all the threads
+const size_t pieceSize = 64 * 1024;
+// the destination larger than this does not fit the caches, it is written around them
+const size_t streamingSize = 4 * 1024 * 1024;
+
+void streamRow(float *dst, const float *src, size_t size) {
+    size_t i = 0;
+    for (; i < size && (reinterpret_cast<uintptr_t>(dst + i) & 15) != 0; i++)
+        dst[i] = src[i];
+    for (; i + 4 <= size; i += 4)
+        _mm_stream_ps(dst + i, _mm_loadu_ps(src + i));
+    for (; i < size; i++)
+        dst[i] = src[i];
+}
+
+inline size_t blockedOffset(size_t idx, size_t block, size_t outerStride, size_t innerStride) {
+    return block == 1 ? idx * outerStride : idx / block * outerStride + idx % block * innerStride;
+}
+
+template <typename T>
+void copyElements(uint8_t *dst, size_t dstOffset, size_t dstBlock, size_t dstOuter, size_t dstInner,
+                  const uint8_t *src, size_t srcOffset, size_t srcBlock, size_t srcOuter, size_t srcInner,
+                  size_t count) {
+    T *d = reinterpret_cast<T *>(dst) + dstOffset;
+    const T *s = reinterpret_cast<const T *>(src) + srcOffset;
+    for (size_t i = 0; i < count; i++)
+        d[blockedOffset(i, dstBlock, dstOuter, dstInner)] = s[blockedOffset(i, srcBlock, srcOuter, srcInner)];
+}
+
+}  // namespace
+
+MKLDNNAxisCopy::MKLDNNAxisCopy(const MKLDNNMemoryPtr &whole, const MKLDNNDims &dims, size_t axis)
+        : axis(axis) {
+    if (!whole || !whole->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "The memory of the concatenated tensor is not allocated.";
+    if (axis >= static_cast<size_t>(dims.ndims()))
+        THROW_IE_EXCEPTION << "The axis " << axis << " is out of the dimensions of the concatenated tensor.";
+    this->whole = describe(whole, dims);
+    elementSize = MKLDNNExtensionUtils::sizeOfDataType(whole->GetDataType());
+    chunkPieceSize = std::max<size_t>(pieceSize / elementSize, 1);
+
+    batchOutermost = this->whole.blocks[0] == 1;
+    for (size_t d = 1; d < this->whole.dims.size(); d++) {
+        if (this->whole.outerStrides[d] > this->whole.outerStrides[0])
+            batchOutermost = false;
+    }
+}
+
+MKLDNNAxisCopy::Tensor MKLDNNAxisCopy::describe(const MKLDNNMemoryPtr &memory, const MKLDNNDims &dims) const {
+    auto desc = memory->GetDescriptor();
+    const auto &blocking = desc.data.layout_desc.blocking;
+    Tensor tensor;
+    tensor.memory = memory;
+    tensor.format = memory->GetFormat();
+    tensor.offset = static_cast<size_t>(blocking.offset_padding);
+    tensor.dense = tensor.offset == 0;
+    for (int d = 0; d < dims.ndims(); d++) {
+        tensor.dims.push_back(static_cast<size_t>(dims[d]));
+        tensor.blocks.push_back(static_cast<size_t>(blocking.block_dims[d]));
+        tensor.outerStrides.push_back(static_cast<size_t>(blocking.strides[0][d]));
+        tensor.innerStrides.push_back(static_cast<size_t>(blocking.strides[1][d]));
+        if (blocking.padding_dims[d] != dims[d])
+            tensor.dense = false;
+    }
+    return tensor;
+}
+
+void MKLDNNAxisCopy::addPart(const MKLDNNMemoryPtr &part, const MKLDNNDims &dims, size_t axisOffset) {
+    if (!part || !part->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "The memory of the part of the concatenated tensor is not allocated.";
+    if (static_cast<size_t>(dims.ndims()) != whole.dims.size())
+        THROW_IE_EXCEPTION << "The part of the concatenated tensor has other number of dimensions.";
+    if (part->GetDataType() != whole.memory->GetDataType())
+        THROW_IE_EXCEPTION << "The part of the concatenated tensor has other data type.";
+    for (size_t d = 0; d < whole.dims.size(); d++) {
+        size_t end = static_cast<size_t>(dims[d]) + (d == axis ? axisOffset : 0);
+        if (end > whole.dims[d])
+            THROW_IE_EXCEPTION << "The part of the concatenated tensor is out of its dimensions.";
+    }
+
+    Part item;
+    item.tensor = describe(part, dims);
+    item.axisOffset = axisOffset;
+    item.chunked = canChunk(item);
+    parts.push_back(item);
+}
+
+bool MKLDNNAxisCopy::canChunk(Part &part) const {
+    const auto &t = part.tensor;
+    if (t.format != whole.format || t.format == memory::format_undef || t.format == memory::any ||
+            t.format == memory::blocked || !t.dense || !whole.dense)
+        return false;
+    for (size_t d = 0; d < whole.dims.size(); d++) {
+        if (t.blocks[d] != whole.blocks[d] || t.innerStrides[d] != whole.innerStrides[d])
+            return false;
+        if (d != axis && t.dims[d] != whole.dims[d])
+            return false;
+    }
+    const size_t block = whole.blocks[axis];
+    if (t.dims[axis] % block || part.axisOffset % block || t.outerStrides[axis] != whole.outerStrides[axis])
+        return false;
+
+    // the dimensions laid out in memory before the axis, the same layout orders them the same way in both tensors
+    size_t outerCount = 1;
+    for (size_t d = 0; d < whole.dims.size(); d++) {
+        if (d != axis && whole.outerStrides[d] >= whole.outerStrides[axis])
+            outerCount *= whole.dims[d] / whole.blocks[d];
+    }
+    const size_t chunk = t.outerStrides[axis] * (t.dims[axis] / block);
+    const size_t wholeChunk = whole.outerStrides[axis] * (whole.dims[axis] / block);
+
+    size_t partSize = 1;
+    size_t wholeSize = 1;
+    for (size_t d = 0; d < whole.dims.size(); d++) {
+        partSize *= t.dims[d];
+        wholeSize *= whole.dims[d];
+    }
+    if (chunk == 0 || outerCount * chunk != partSize || outerCount * wholeChunk != wholeSize)
+        return false;
+
+    part.outerCount = outerCount;
+    part.chunk = chunk;
+    part.wholeChunkOffset = part.axisOffset / block * whole.outerStrides[axis];
+    return true;
+}
+
+size_t MKLDNNAxisCopy::unitsCount(const Part &part, size_t batch) const {
+    const auto &dims = part.tensor.dims;
+    const bool limited = axis != 0 && batch < dims[0];
+    if (part.chunked && (!limited || batchOutermost)) {
+        size_t outer = limited ? part.outerCount / dims[0] * batch : part.outerCount;
+        return outer * ((part.chunk + chunkPieceSize - 1) / chunkPieceSize);
+    }
+    // the rows of the innermost logical dimension
+    size_t rows = 1;
+    for (size_t d = 0; d + 1 < dims.size(); d++)
+        rows *= d == 0 && limited ? batch : dims[d];
+    return rows;
+}
+
+void MKLDNNAxisCopy::copyChunk(const Part &part, size_t unit, bool toWhole, bool streaming) const {
+    const size_t pieces = (part.chunk + chunkPieceSize - 1) / chunkPieceSize;
+    const size_t outer = unit / pieces;
+    const size_t begin = unit % pieces * chunkPieceSize;
+    const size_t count = std::min(chunkPieceSize, part.chunk - begin);
+    const size_t wholeChunk = whole.outerStrides[axis] * (whole.dims[axis] / whole.blocks[axis]);
+
+    auto *wholeData = reinterpret_cast<uint8_t *>(whole.memory->GetData()) +
+                      (outer * wholeChunk + part.wholeChunkOffset + begin) * elementSize;
+    auto *partData = reinterpret_cast<uint8_t *>(part.tensor.memory->GetData()) +
+                     (outer * part.chunk + begin) * elementSize;
+    uint8_t *dst = toWhole ? wholeData : partData;
+    const uint8_t *src = toWhole ? partData : wholeData;
+    if (streaming)
+        streamRow(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(src), count);
+    else
+        memcpy(dst, src, count * elementSize);
+}
+
+void MKLDNNAxisCopy::copyRow(const Part &part, size_t row, size_t batch, bool toWhole) const {
+    const auto &t = part.tensor;
+    const size_t last = t.dims.size() - 1;
+    size_t partOffset = t.offset;
+    size_t wholeOffset = whole.offset;
+    for (size_t d = last; d-- > 0;) {
+        const size_t extent = d == 0 && axis != 0 ? std::min(batch, t.dims[0]) : t.dims[d];
+        const size_t idx = row % extent;
+        row /= extent;
+        const size_t wholeIdx = idx + (d == axis ? part.axisOffset : 0);
+        partOffset += blockedOffset(idx, t.blocks[d], t.outerStrides[d], t.innerStrides[d]);
+        wholeOffset += blockedOffset(wholeIdx, whole.blocks[d], whole.outerStrides[d], whole.innerStrides[d]);
+    }
+
+    auto *partData = reinterpret_cast<uint8_t *>(t.memory->GetData());
+    auto *wholeData = reinterpret_cast<uint8_t *>(whole.memory->GetData());
+    const size_t count = t.dims[last];
+    if (last == axis) {
+        // the row of the whole tensor starts at the offset of the part, the blocks are counted from its start
+        if (whole.blocks[last] == 1) {
+            wholeOffset += part.axisOffset * whole.outerStrides[last];
+        } else {
+            // the element by element offsets of the shifted row, it is rare: the axis is the innermost dimension
+            for (size_t i = 0; i < count; i++) {
+                const size_t w = wholeOffset + blockedOffset(i + part.axisOffset, whole.blocks[last],
+                                                             whole.outerStrides[last], whole.innerStrides[last]);
+                const size_t p = partOffset + blockedOffset(i, t.blocks[last], t.outerStrides[last],
+                                                            t.innerStrides[last]);
+                if (toWhole)
+                    memcpy(wholeData + w * elementSize, partData + p * elementSize, elementSize);
+                else
+                    memcpy(partData + p * elementSize, wholeData + w * elementSize, elementSize);
+            }
+            return;
+        }
+    }
+
+    const size_t partBlock = t.blocks[last], partOuter = t.outerStrides[last], partInner = t.innerStrides[last];
+    const size_t wholeBlock = whole.blocks[last], wholeOuter = whole.outerStrides[last];
+    const size_t wholeInner = whole.innerStrides[last];
+    if (partBlock == 1 && wholeBlock == 1 && partOuter == 1 && wholeOuter == 1) {
+        if (toWhole)
+            memcpy(wholeData + wholeOffset * elementSize, partData + partOffset * elementSize, count * elementSize);
+        else
+            memcpy(partData + partOffset * elementSize, wholeData + wholeOffset * elementSize, count * elementSize);
+        return;
+    }
+
+    switch (elementSize) {
+    case 4:
+        if (toWhole)
+            copyElements<uint32_t>(wholeData, wholeOffset, wholeBlock, wholeOuter, wholeInner,
+                                   partData, partOffset, partBlock, partOuter, partInner, count);
+        else
+            copyElements<uint32_t>(partData, partOffset, partBlock, partOuter, partInner,
+                                   wholeData, wholeOffset, wholeBlock, wholeOuter, wholeInner, count);
+        break;
+    case 1:
+        if (toWhole)
+            copyElements<uint8_t>(wholeData, wholeOffset, wholeBlock, wholeOuter, wholeInner,
+                                  partData, partOffset, partBlock, partOuter, partInner, count);
+        else
+            copyElements<uint8_t>(partData, partOffset, partBlock, partOuter, partInner,
+                                  wholeData, wholeOffset, wholeBlock, wholeOuter, wholeInner, count);
+        break;
+    default:
+        THROW_IE_EXCEPTION << "The concatenation does not support the elements of " << elementSize << " bytes.";
+    }
+}
+
+void MKLDNNAxisCopy::copy(bool toWhole, size_t batch) {
+    // the units of all the parts are numbered one after another, the threads take them evenly
+    unitsEnd.resize(parts.size());
+    size_t total = 0;
+    size_t copied = 0;
+    for (size_t i = 0; i < parts.size(); i++) {
+        total += unitsCount(parts[i], batch);
+        unitsEnd[i] = total;
+        size_t size = 1;
+        for (auto dim : parts[i].tensor.dims)
+            size *= dim;
+        copied += size;
+    }
+    const bool limited = axis != 0 && batch < whole.dims[0];
+    if (limited)
+        copied = copied / whole.dims[0] * batch;
+    const bool streaming = elementSize == sizeof(float) && copied * elementSize >= streamingSize;
+
+    parallel_nt(0, [&](int ithr, int nthr) {
+        bool streamed = false;
+        for_1d(ithr, nthr, total, [&](size_t unit) {
+            const size_t i = std::upper_bound(unitsEnd.begin(), unitsEnd.end(), unit) - unitsEnd.begin();
+            const auto &part = parts[i];
+            const size_t local = unit - (i == 0 ? 0 : unitsEnd[i - 1]);
+            if (part.chunked && (!limited || batchOutermost)) {
+                copyChunk(part, local, toWhole, streaming);
+                streamed = streamed || streaming;
+            } else {
+                copyRow(part, local, batch, toWhole);
+            }
+        });
+        if (streamed)
+            _mm_sfence();
+    });
+}
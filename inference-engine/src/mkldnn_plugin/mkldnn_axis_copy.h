@@ -0,0 +1,92 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "mkldnn_memory.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Copies the parts of a tensor concatenated along one axis into the tensor (Concat) or out of it (Split) when
+ * the node cannot be in place. The parts of all the inputs or outputs are copied at once by the threads. Every tensor
+ * keeps its own layout, it is converted during the copy, so the node needs no reorders around it:
+ *  - the part with the layout of the whole tensor is copied by its contiguous chunks of the outer dimensions, the
+ *    large destinations are written by the non-temporal stores which do not evict the cache;
+ *  - the other parts are copied element by element through the blocking of both tensors.
+ */
+class MKLDNNAxisCopy {
+public:
+    /**
+     * @param whole - the memory of the concatenated tensor
+     * @param dims - the dimensions of the concatenated tensor
+     * @param axis - the axis of the concatenation
+     */
+    MKLDNNAxisCopy(const MKLDNNMemoryPtr &whole, const MKLDNNDims &dims, size_t axis);
+
+    /**
+     * @brief Adds the part placed at the offset along the axis of the whole tensor, the parts must have its data type
+     */
+    void addPart(const MKLDNNMemoryPtr &part, const MKLDNNDims &dims, size_t axisOffset);
+
+    /**
+     * @brief Copies the parts into the whole tensor, the batch limits the first dimension unless it is the axis
+     */
+    void concat(size_t batch) {
+        copy(true, batch);
+    }
+
+    /**
+     * @brief Copies the whole tensor into the parts
+     */
+    void split(size_t batch) {
+        copy(false, batch);
+    }
+
+private:
+    struct Tensor {
+        MKLDNNMemoryPtr memory;
+        mkldnn::memory::format format;
+        std::vector<size_t> dims;
+        // the element of the logical index is at offset + sum(idx / blocks * outerStrides + idx % blocks * innerStrides)
+        size_t offset;
+        std::vector<size_t> blocks;
+        std::vector<size_t> outerStrides;
+        std::vector<size_t> innerStrides;
+        // no padding, the tensor fills its memory
+        bool dense;
+    };
+
+    struct Part {
+        Tensor tensor;
+        size_t axisOffset;
+        // the part has the layout of the whole tensor, it is copied by the chunks of the outer dimensions
+        bool chunked;
+        size_t outerCount;
+        size_t chunk;
+        size_t wholeChunkOffset;
+    };
+
+    Tensor describe(const MKLDNNMemoryPtr &memory, const MKLDNNDims &dims) const;
+    bool canChunk(Part &part) const;
+    size_t unitsCount(const Part &part, size_t batch) const;
+    void copyChunk(const Part &part, size_t unit, bool toWhole, bool streaming) const;
+    void copyRow(const Part &part, size_t row, size_t batch, bool toWhole) const;
+    void copy(bool toWhole, size_t batch);
+
+    Tensor whole;
+    size_t axis;
+    size_t elementSize;
+    size_t chunkPieceSize;
+    // the batch limits the outer count of the chunks only when the first dimension is the outermost one
+    bool batchOutermost;
+    std::vector<Part> parts;
+    std::vector<size_t> unitsEnd;
+};
+
+}  // namespace MKLDNNPlugin
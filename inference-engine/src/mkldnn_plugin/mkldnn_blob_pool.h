@@ -0,0 +1,76 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <ie_blob.h>
+#include <ie_allocator.hpp>
+#include <blob_factory.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The blobs of an infer request, which dimensions change between the inferences: the outputs of the reshaped
+ * inputs (see KEY_CPU_RESHAPE_CACHE_SIZE), the converted inputs and the windows of the tiles.
+ * The blob of a name is a view of the buffer of the name. The buffer is never shrunk, it only grows to the largest
+ * blob requested so far, so the blobs that fit it are created without allocating the data on the inference path.
+ * The views keep their buffer alive, so the blobs held by the user stay valid after the buffer grows.
+ * The pool is not thread safe, it is used by one request at a time.
+ */
+class MKLDNNBlobPool {
+public:
+    explicit MKLDNNBlobPool(const std::shared_ptr<InferenceEngine::IAllocator> &allocator = nullptr)
+            : allocator(allocator) {}
+
+    /**
+     * @brief Makes the buffer of the name at least of the given size, e.g. of the max batch or the largest shape
+     */
+    void reserve(const std::string &name, size_t byteSize) {
+        Entry &entry = entries[name];
+        if (entry.buffer && entry.buffer->byteSize() >= byteSize)
+            return;
+        entry.buffer = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::U8,
+                                                                            {byteSize}, InferenceEngine::C),
+                                                allocator);
+        entry.buffer->allocate();
+        entry.view.reset();
+    }
+
+    /**
+     * @brief Returns the blob of the descriptor over the buffer of the name, the same blob as before if the descriptor
+     * has not changed. The buffer is reallocated only if the blob does not fit it.
+     */
+    InferenceEngine::Blob::Ptr get(const std::string &name, const InferenceEngine::TensorDesc &desc) {
+        Entry &entry = entries[name];
+        if (entry.view && entry.view->getTensorDesc() == desc)
+            return entry.view;
+
+        size_t byteSize = desc.getPrecision().size();
+        for (size_t dim : desc.getDims()) byteSize *= dim;
+        // the empty blobs still get a buffer, so the views never point to nullptr
+        reserve(name, std::max<size_t>(byteSize, 1));
+
+        InferenceEngine::Blob::Ptr buffer = entry.buffer;
+        InferenceEngine::Blob::Ptr view = make_blob_with_precision(desc, buffer->buffer().as<void *>());
+        // the control block of the returned pointer owns the view and the buffer under it
+        entry.view = InferenceEngine::Blob::Ptr(view.get(), [view, buffer](InferenceEngine::Blob *) {});
+        return entry.view;
+    }
+
+private:
+    struct Entry {
+        InferenceEngine::Blob::Ptr buffer;
+        InferenceEngine::Blob::Ptr view;
+    };
+
+    std::shared_ptr<InferenceEngine::IAllocator> allocator;
+    std::map<std::string, Entry> entries;
+};
+
+}  // namespace MKLDNNPlugin
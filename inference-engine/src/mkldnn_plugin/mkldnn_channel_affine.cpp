@@ -0,0 +1,97 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_channel_affine.h"
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+bool isFP32Blob(const Blob::Ptr &blob, size_t channels) {
+    return blob == nullptr || blob->size() == 0 ||
+           (blob->precision() == Precision::FP32 && (blob->size() == 1 || blob->size() == channels));
+}
+
+float channelValue(const Blob::Ptr &blob, size_t c, float defaultValue) {
+    if (blob == nullptr || blob->size() == 0)
+        return defaultValue;
+    const float *data = blob->cbuffer().as<const float *>();
+    return data[blob->size() == 1 ? 0 : c];
+}
+
+}  // namespace
+
+bool MKLDNNChannelAffine::canFold(const CNNLayer &layer, size_t channels) {
+    if (layer.type == "ScaleShift") {
+        auto *scaleShift = dynamic_cast<const ScaleShiftLayer *>(&layer);
+        return scaleShift && isFP32Blob(scaleShift->_weights, channels) && isFP32Blob(scaleShift->_biases, channels);
+    }
+    if (layer.type == "BatchNormalization") {
+        // the variance and the mean are required, there is no transform without them
+        auto *batchNorm = dynamic_cast<const BatchNormalizationLayer *>(&layer);
+        return batchNorm && batchNorm->_weights != nullptr && batchNorm->_biases != nullptr &&
+               batchNorm->_weights->size() != 0 && batchNorm->_biases->size() != 0 &&
+               isFP32Blob(batchNorm->_weights, channels) && isFP32Blob(batchNorm->_biases, channels);
+    }
+    return false;
+}
+
+bool MKLDNNChannelAffine::isFolded(const MKLDNNNodePtr &node) {
+    return node->getCnnLayer() && (node->getType() == Depthwise || node->getType() == BatchNormalization) &&
+           (node->getCnnLayer()->type == "ScaleShift" || node->getCnnLayer()->type == "BatchNormalization");
+}
+
+MKLDNNChannelAffine::MKLDNNChannelAffine(const std::vector<MKLDNNNodePtr> &fusedNodes, size_t channels) {
+    for (auto &node : fusedNodes) {
+        if (!isFolded(node))
+            continue;
+        const CNNLayer &layer = *node->getCnnLayer();
+        if (!canFold(layer, channels))
+            THROW_IE_EXCEPTION << "Cannot fold " << node->getName() << " into the weights of the "
+                               << channels << " channels.";
+        if (scale.empty()) {
+            scale.assign(channels, 1.f);
+            shift.assign(channels, 0.f);
+        }
+
+        std::vector<float> layerScale(channels), layerShift(channels);
+        if (layer.type == "ScaleShift") {
+            auto &scaleShift = dynamic_cast<const ScaleShiftLayer &>(layer);
+            for (size_t c = 0; c < channels; c++) {
+                layerScale[c] = channelValue(scaleShift._weights, c, 1.f);
+                layerShift[c] = channelValue(scaleShift._biases, c, 0.f);
+            }
+        } else {
+            // (x - mean) / sqrt(variance + epsilon)
+            auto &batchNorm = dynamic_cast<const BatchNormalizationLayer &>(layer);
+            for (size_t c = 0; c < channels; c++) {
+                layerScale[c] = 1.f / std::sqrt(channelValue(batchNorm._weights, c, 1.f) + batchNorm.epsilon);
+                layerShift[c] = -channelValue(batchNorm._biases, c, 0.f) * layerScale[c];
+            }
+        }
+
+        for (size_t c = 0; c < channels; c++) {
+            scale[c] *= layerScale[c];
+            shift[c] = shift[c] * layerScale[c] + layerShift[c];
+        }
+    }
+}
+
+bool MKLDNNChannelAffine::hasShift() const {
+    for (float value : shift) {
+        if (value != 0.f)
+            return true;
+    }
+    return false;
+}
+
+void MKLDNNChannelAffine::foldBiases(float *biases) const {
+    for (size_t c = 0; c < scale.size(); c++)
+        biases[c] = biases[c] * scale[c] + shift[c];
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <ie_layers.h>
+
+#include "mkldnn_node.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The transform y = scale[c] * x + shift[c] per channel of the ScaleShift and BatchNormalization layers.
+ * A convolution, deconvolution or FullyConnected followed by them folds them into its weights and biases at load:
+ * scale * (W * x + b) + shift = (scale * W) * x + (scale * b + shift) per output channel.
+ */
+class MKLDNNChannelAffine {
+public:
+    /**
+     * @brief Tells if the layer is a ScaleShift or a BatchNormalization with the FP32 blobs of one value or of a
+     * value per channel
+     */
+    static bool canFold(const InferenceEngine::CNNLayer &layer, size_t channels);
+
+    /**
+     * @brief Composes the ScaleShift and BatchNormalization nodes among the fused ones, in their order; the other
+     * fused nodes (the activations) are applied after the weights, so they are skipped
+     */
+    MKLDNNChannelAffine(const std::vector<MKLDNNNodePtr> &fusedNodes, size_t channels);
+
+    /**
+     * @brief Tells if the node is folded into the weights of the node it is fused to
+     */
+    static bool isFolded(const MKLDNNNodePtr &node);
+
+    bool empty() const {
+        return scale.empty();
+    }
+    bool hasShift() const;
+
+    /**
+     * @brief scale * b + shift of the biases of all the channels
+     */
+    void foldBiases(float *biases) const;
+
+    std::vector<float> scale;
+    std::vector<float> shift;
+};
+
+}  // namespace MKLDNNPlugin
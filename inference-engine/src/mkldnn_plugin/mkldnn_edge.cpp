@@ -142,7 +142,7 @@ void MKLDNNPlugin::MKLDNNEdge::allocate(const void* mem_ptr) {
         THROW_IE_EXCEPTION << "Cannot get input descriptor!";
 
     auto parentPtr = getParent();
-    memoryPtr.reset(new MKLDNNMemory(parentPtr->getEngine()));
+    memoryPtr.reset(new MKLDNNMemory(parentPtr->getEngine(), parentPtr->getAllocator()));
     memoryPtr->Create(MKLDNNMemoryDesc(inputDesc), mem_ptr);
     status = Status::Allocated;
 }
@@ -517,7 +517,7 @@ InferenceEngine::TensorDesc MKLDNNPlugin::MKLDNNEdge::getSpecifiedOutputDesc(std
 
 const MKLDNNPlugin::MKLDNNMemory &MKLDNNPlugin::MKLDNNEdge::getMemory() {
     if (status == Status::NotAllocated) {
-        memoryPtr.reset(new MKLDNNMemory(getParent()->getEngine()));
+        memoryPtr.reset(new MKLDNNMemory(getParent()->getEngine(), getParent()->getAllocator()));
         memoryPtr->Create(MKLDNNMemoryDesc(getDesc()), getSharedEdge()->getMemoryPtr()->GetData());
         memoryFromEdge.reset();
         changeStatus(Status::Allocated);
@@ -528,7 +528,7 @@ const MKLDNNPlugin::MKLDNNMemory &MKLDNNPlugin::MKLDNNEdge::getMemory() {
 
 MKLDNNPlugin::MKLDNNMemoryPtr &MKLDNNPlugin::MKLDNNEdge::getMemoryPtr() {
     if (status == Status::NotAllocated) {
-        memoryPtr.reset(new MKLDNNMemory(getParent()->getEngine()));
+        memoryPtr.reset(new MKLDNNMemory(getParent()->getEngine(), getParent()->getAllocator()));
         memoryPtr->Create(MKLDNNMemoryDesc(getDesc()), getSharedEdge()->getMemoryPtr()->GetData());
         memoryFromEdge.reset();
         changeStatus(Status::Allocated);
@@ -38,6 +38,8 @@ memory::data_type MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::P
             return memory::s8;
         case InferenceEngine::Precision::U8:
             return memory::u8;
+        case InferenceEngine::Precision::I32:
+            return memory::s32;
 
         default: {
             THROW_IE_EXCEPTION << "The plugin does not support " << prec.name();
@@ -49,6 +51,14 @@ InferenceEngine::Precision MKLDNNExtensionUtils::DataTypeToIEPrecision(memory::d
     switch (dataType) {
         case memory::f32:
             return InferenceEngine::Precision(InferenceEngine::Precision::FP32);
+        case memory::s32:
+            return InferenceEngine::Precision(InferenceEngine::Precision::I32);
+        case memory::s16:
+            return InferenceEngine::Precision(InferenceEngine::Precision::I16);
+        case memory::s8:
+            return InferenceEngine::Precision(InferenceEngine::Precision::I8);
+        case memory::u8:
+            return InferenceEngine::Precision(InferenceEngine::Precision::U8);
 
         default: {
             THROW_IE_EXCEPTION << "Unsupported data type.";
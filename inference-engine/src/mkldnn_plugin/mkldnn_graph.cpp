@@ -10,6 +10,9 @@
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <mutex>
+#include <functional>
+#include <exception>
 #include <caseless.hpp>
 
 #include "mkldnn_graph.h"
@@ -17,16 +20,38 @@
 #include <debug.h>
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
+#include <nodes/mkldnn_tile_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn/omp_manager.h"
 #include <omp.h>
+#include <ie_parallel_for.hpp>
 #include <graph_tools.hpp>
 #include <cpp_interfaces/ie_executor_manager.hpp>
+#include <cpp_interfaces/ie_work_stealing_task_executor.hpp>
+#include <cpp_interfaces/ie_task_executor.hpp>
 #include "ie_algorithm.hpp"
 #include "memory_solver.hpp"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_auto_batching.h"
+#include "mkldnn_streams.h"
+#include "mkldnn_network_serializer.h"
+#include "mkldnn_memory_domain.h"
+#include "mkldnn_memory_state.h"
+#include "mkldnn_tuner.h"
+#include <precision_utils.h>
+#include <blob_factory.hpp>
+#include <ie_util_internal.hpp>
+#include <ie_trace.hpp>
+#include <ie_load_profile.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 // #define DEBUG_DUMP_PATH "/home/user/HDD/gna-mkldnn/"
 // #define DEBUG_DUMP_NEW_FOLDER_PER_INFER
 #ifdef DEBUG_DUMP_PATH
@@ -69,7 +94,12 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
         ForgetGraphData();
     }
 
-    if (config.useThreadBinding) BindThreads(eng);
+    // in the throughput mode every stream binds its own threads (see pinStreamThreads),
+    // the network with its own team applies it to the calling thread instead of the plugin wide binding
+    if (!teamCpus.empty())
+        applyThreadTeam(teamCpus, config.useThreadBinding);
+    else if (config.useThreadBinding && config.throughputStreams <= 1)
+        BindThreads(eng);
 
     // go over the inputs and create input primitives
     InputsDataMap inputs;
@@ -157,6 +187,11 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
     std::map<std::string, DataPtr> output;
     network.getOutputsInfo(output);
 
+    for (auto &argmaxOutput : config.argmaxOutputs) {
+        if (output.find(argmaxOutput) == output.end())
+            THROW_IE_EXCEPTION << "Cannot find the output " << argmaxOutput << " of KEY_CPU_ARGMAX_OUTPUTS";
+    }
+
     for (auto it = output.begin(); it != output.end(); it++) {
         MKLDNNNodePtr node = FindNodeWithName((*it).second->getCreatorLayer().lock()->name);
         if (!node)
@@ -164,39 +199,144 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
 
         std::string name = "out_" + (*it).first;
 
+        // the integer outputs are converted by the reorder writing the memory of the output, the FP16, the BF16 and
+        // the argmax ones are produced in FP32 and converted while they are pulled
+        const TensorDesc &outDesc = (*it).second->getTensorDesc();
+        Precision precision = outDesc.getPrecision();
+        if (std::find(config.argmaxOutputs.begin(), config.argmaxOutputs.end(), (*it).first) !=
+                config.argmaxOutputs.end()) {
+            SizeVector dims = outDesc.getDims();
+            if ((dims.size() != 2 && dims.size() != 4) || (precision != Precision::U8 && precision != Precision::I32))
+                THROW_IE_EXCEPTION << "The argmax output " << (*it).first << " must be 2D or 4D of U8 or I32 precision";
+            if (precision == Precision::U8 && dims[1] > 256)
+                THROW_IE_EXCEPTION << "The " << dims[1] << " channels of the argmax output " << (*it).first
+                                   << " do not fit U8";
+            dims[1] = 1;
+            convertedOutputs[(*it).first] = TensorDesc(precision, dims, outDesc.getLayout());
+            precision = Precision::FP32;
+        } else if (precision == Precision::FP16 || precision == Precision::BF16) {
+            convertedOutputs[(*it).first] = outDesc;
+            precision = Precision::FP32;
+        }
+
         CNNLayerPtr layer(new CNNLayer({name,
                                         "Output",
-                                        (*it).second->getCreatorLayer().lock()->outData[0]->getPrecision()}));
+                                        precision}));
         layer->insData.push_back((*it).second);
         MKLDNNNodePtr outputLayer(new MKLDNNInputNode(layer, getEngine()));
-        MKLDNNEdgePtr edgePtr(new MKLDNNEdge(node, outputLayer));
+        MKLDNNEdgePtr edgePtr = CreateEdge(node, outputLayer);
         graphEdges.push_back(edgePtr);
         outputLayer->addEdge(edgePtr, 0, node->getChildEdges().size());
         graphNodes.push_back(outputLayer);
         outputNodes.push_back(outputLayer);
     }
 
-    MKLDNNGraphOptimizer optimizer;
-    optimizer.Optimize(*this);
-    SortTopologically();
+    {
+        LoadPhaseScope phase("optimize");
+        MKLDNNGraphOptimizer optimizer;
+        optimizer.Optimize(*this);
+        SortTopologically();
+    }
 
-    InitNodes();
+    {
+        LoadPhaseScope phase("primitive selection");
+        InitNodes();
 
-    for (auto &node : graphNodes) {
-        node->initOptimalPrimitiveDescriptor();
+        for (auto &node : graphNodes) {
+            node->initOptimalPrimitiveDescriptor();
+        }
+        InitEdges();
+
+        SortTopologically();
     }
-    InitEdges();
 
-    SortTopologically();
+    if (config.parallelBranches)
+        CalculateExecutionLevels();
 
-    Allocate();
+    {
+        LoadPhaseScope phase("memory planning");
+        Allocate();
+    }
+
+    {
+        // the primitives JIT their kernels and reorder the weights to the layouts they selected
+        LoadPhaseScope phase("kernel compile");
+        CreatePrimitives();
+    }
 
-    CreatePrimitives();
+    InitMemoryStates();
 
     for (auto &graphNode : graphNodes) {
         graphNode->cleanup();
     }
 
+    {
+        LoadPhaseScope phase("constant folding");
+        FoldConstants();
+    }
+
+    // the constant nodes are computed at the load, so the inferences walk the rest only
+    executableNodes.clear();
+    for (auto &graphNode : graphNodes) {
+        if (!graphNode->isConstant())
+            executableNodes.push_back(graphNode);
+    }
+    CalculateOutputDependencies();
+
+    status = Ready;
+
+    if (config.warmUp) {
+        LoadPhaseScope phase("warm-up");
+        WarmUp();
+    }
+}
+
+void MKLDNNGraph::CalculateOutputDependencies() {
+    // the nodes without the children other than the outputs (the memory outputs) are executed for every output
+    std::vector<bool> sinks(graphNodes.size(), false);
+    std::vector<MKLDNNNodePtr> stack;
+    auto markParents = [&](std::vector<bool> &mask) {
+        while (!stack.empty()) {
+            MKLDNNNodePtr node = stack.back();
+            stack.pop_back();
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                auto parent = node->getParentEdgeAt(i)->getParent();
+                if (parent->execIndex < 0 || mask[parent->execIndex])
+                    continue;
+                mask[parent->execIndex] = true;
+                stack.push_back(parent);
+            }
+        }
+    };
+    for (auto &node : graphNodes) {
+        if (node->getType() != Output && node->getChildEdges().empty() && node->execIndex >= 0) {
+            sinks[node->execIndex] = true;
+            stack.push_back(node);
+        }
+    }
+    markParents(sinks);
+
+    for (auto &node : outputNodes) {
+        std::vector<bool> &mask = outputDependencies[node->getName().substr(4)];
+        mask = sinks;
+        mask[node->execIndex] = true;
+        stack.push_back(node);
+        markParents(mask);
+    }
+}
+
+void MKLDNNGraph::GetOutputsMask(const std::vector<std::string> &outputs, std::vector<bool> &mask) const {
+    mask.assign(graphNodes.size(), false);
+    for (const auto &output : outputs) {
+        auto dependencies = outputDependencies.find(output);
+        if (dependencies == outputDependencies.end())
+            THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find the output with name: '" << output << "'";
+        for (size_t i = 0; i < mask.size(); i++)
+            mask[i] = mask[i] || dependencies->second[i];
+    }
+}
+
+void MKLDNNGraph::FoldConstants() {
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
@@ -204,13 +344,20 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
         graphNode->execute(stream);
     }
 
-    status = Ready;
+    // only the outputs of the constant subgraphs are used by the inference, they are kept in the workspace,
+    // while the primitives, the weights and the intermediate data of the constant nodes are not needed anymore
+    for (auto &graphNode : graphNodes) {
+        if (graphNode->isConstant())
+            graphNode->foldConstant();
+    }
+    memLoadWorkspace.reset();
 }
 
 void MKLDNNGraph::ParseNode(const CNNLayerPtr& cnnLayer, MKLDNNNodePtr& parent,
                             const MKLDNNExtensionManager::Ptr& extMgr, size_t outIdx,
                             std::vector<ParsedLayer>& queuelayers) {
-    if (cnnLayer->precision != Precision::FP32) {
+    // int8 layers come from CNNNetworkInt8Normalizer, the nodes choose the int8 primitives by themselves
+    if (cnnLayer->precision != Precision::FP32 && cnnLayer->precision != Precision::I8) {
         THROW_IE_EXCEPTION << "The plugin does not support " << cnnLayer->precision;
     }
 
@@ -226,12 +373,12 @@ void MKLDNNGraph::ParseNode(const CNNLayerPtr& cnnLayer, MKLDNNNodePtr& parent,
         MKLDNNEdgePtr edgePtr;
         size_t shift = 0;
         if (outIdx >= parent->getChildEdges().size() || !parent->getChildEdges()[outIdx].lock()) {
-            edgePtr.reset(new MKLDNNEdge(parent, node));
+            edgePtr = CreateEdge(parent, node);
             graphEdges.push_back(edgePtr);
         } else {
             edgePtr = parent->getChildEdgeAt(outIdx);
             if (edgePtr->getChild() != node) {
-                edgePtr.reset(new MKLDNNEdge(parent, node));
+                edgePtr = CreateEdge(parent, node);
                 graphEdges.push_back(edgePtr);
                 shift = parent->getChildEdges().size();
             }
@@ -282,6 +429,34 @@ void MKLDNNGraph::ParseNode(const CNNLayerPtr& cnnLayer, MKLDNNNodePtr& parent,
     }
 }
 
+/**
+ * Calls the body for the nodes in parallel. The extension nodes call the factories of the user, which are not
+ * required to be thread safe, so they go one by one before the others, as well as all the nodes if not concurrent.
+ */
+static void forEachNode(const std::vector<MKLDNNNodePtr> &nodes, bool concurrent,
+                        const std::function<void(const MKLDNNNodePtr &)> &body) {
+    std::vector<MKLDNNNodePtr> parallelNodes;
+    for (auto &node : nodes) {
+        if (concurrent && node->getType() != Generic)
+            parallelNodes.push_back(node);
+        else
+            body(node);
+    }
+
+    std::vector<std::exception_ptr> errors(parallelNodes.size());
+    parallel_for_dynamic(parallelNodes.size(), [&](size_t i) {
+        try {
+            body(parallelNodes[i]);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (auto &error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
 void MKLDNNGraph::InitNodes() {
     for (auto &node : graphNodes) {
         if (node->getType() == Input && _meanImages.find(node->getName()) != _meanImages.end()) {
@@ -289,11 +464,23 @@ void MKLDNNGraph::InitNodes() {
             if (inputNode)
                 inputNode->withMeanImage();
         }
-        node->getSupportedDescriptors();
+    }
 
-        node->initSupportedPrimitiveDescriptors();
+    if (config.enforceBF16) {
+        for (auto &node : graphNodes) {
+            auto *fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+            if (fcNode)
+                fcNode->setBF16Weights();
+        }
     }
 
+    // a node enumerates its descriptors from its layer, its fused nodes and the dims of its edges, the formats
+    // of the neighbours are negotiated by the selection below, so only the selection follows the topological order
+    forEachNode(graphNodes, true, [](const MKLDNNNodePtr &node) {
+        node->getSupportedDescriptors();
+        node->initSupportedPrimitiveDescriptors();
+    });
+
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
     }
@@ -364,63 +551,248 @@ void MKLDNNGraph::InitEdges() {
         }
         return inArgs + "_" + outArgs;
     };
+    // the consumers reading a tensor in the same layout share one reorder of it, unless they overwrite their input
+    struct SharedReorder {
+        MKLDNNNodePtr parent;
+        InferenceEngine::TensorDesc input;
+        InferenceEngine::TensorDesc output;
+        MKLDNNNodePtr reorder;
+    };
+    std::vector<SharedReorder> sharedReorders;
+
     size_t numberOfEdges = graphEdges.size();
     for (auto i = 0; i < numberOfEdges; i++) {
-        if (graphEdges[i]->needReorder()) {
-            std::string layerName = graphEdges[i]->getParent()->getName() + "_" +
-                    reorderArgs(graphEdges[i]->getInputDesc(), graphEdges[i]->getOutputDesc()) + "_" +
-                    graphEdges[i]->getChild()->getName();
+        if (!graphEdges[i]->needReorder())
+            continue;
+
+        MKLDNNEdgePtr edge = graphEdges[i];
+        MKLDNNNodePtr parent = edge->getParent();
+        MKLDNNNodePtr child = edge->getChild();
+        int oIndex = edge->getOutputNum();
+        int iIndex = edge->getInputNum();
+        if (iIndex < 0 || oIndex < 0)
+            THROW_IE_EXCEPTION << "Cannot create reorder for nodes: "
+                               << parent->getName() << " and " << child->getName() << ".";
+
+        // the child edges of a node with several outputs are matched to the outputs by their indices, so only the
+        // edges of a single output can be removed; the memory of the outputs of the graph is replaced by the blobs
+        // of the requests
+        bool shareable = parent->getSelectedPrimitiveDescriptor()->getConfig().outConfs.size() == 1 &&
+                         child->getType() != Output && !edge->inPlace(MKLDNNEdge::LOOK_DOWN);
+        auto shared = std::find_if(sharedReorders.begin(), sharedReorders.end(), [&](const SharedReorder &reorder) {
+            return shareable && reorder.parent == parent && reorder.input == edge->getInputDesc() &&
+                   reorder.output == edge->getOutputDesc();
+        });
+
+        MKLDNNNodePtr reorder;
+        if (shared != sharedReorders.end()) {
+            reorder = shared->reorder;
+            parent->childEdges.erase(parent->childEdges.begin() + iIndex);
+        } else {
+            std::string layerName = parent->getName() + "_" +
+                    reorderArgs(edge->getInputDesc(), edge->getOutputDesc()) + "_" + child->getName();
             CNNLayerPtr layer(new CNNLayer({layerName,
                                             "Reorder",
-                                            graphEdges[i]->getInputDesc().getPrecision()}));
-            MKLDNNNodePtr newReorder(new MKLDNNReorderNode(layer, getEngine()));
-            auto *reorderPtr = dynamic_cast<MKLDNNReorderNode *>(newReorder.get());
+                                            edge->getInputDesc().getPrecision()}));
+            reorder.reset(new MKLDNNReorderNode(layer, getEngine()));
+            auto *reorderPtr = dynamic_cast<MKLDNNReorderNode *>(reorder.get());
             if (reorderPtr) {
-                reorderPtr->setDescs(graphEdges[i]->getInputDesc(), graphEdges[i]->getOutputDesc());
+                reorderPtr->setDescs(edge->getInputDesc(), edge->getOutputDesc());
             }
-            MKLDNNEdgePtr beforeNode(new MKLDNNEdge(graphEdges[i]->getParent(), newReorder));
-            beforeNode->setDims(graphEdges[i]->getDims());
-            MKLDNNEdgePtr afterNode(new MKLDNNEdge(newReorder, graphEdges[i]->getChild()));
-            afterNode->setDims(graphEdges[i]->getDims());
-
-            int oIndex = graphEdges[i]->getOutputNum();
-            int iIndex = graphEdges[i]->getInputNum();
-            if (iIndex < 0 || oIndex < 0)
-                THROW_IE_EXCEPTION << "Cannot create reorder for nodes: "
-                                   << graphEdges[i]->getParent()->getName() << " and "
-                                   << graphEdges[i]->getChild()->getName() << ".";
+            MKLDNNEdgePtr beforeNode = CreateEdge(parent, reorder);
+            beforeNode->setDims(edge->getDims());
 
             // Add edge for beforeNode
-            graphEdges[i]->getParent()->childEdges[iIndex].reset();
-            graphEdges[i]->getParent()->childEdges[iIndex] = beforeNode;
-            beforeNode->getChild()->parentEdges.push_back(beforeNode);
+            parent->childEdges[iIndex].reset();
+            parent->childEdges[iIndex] = beforeNode;
+            reorder->parentEdges.push_back(beforeNode);
+            beforeNode->getDesc();
+            graphEdges.push_back(beforeNode);
+            graphNodes.push_back(reorder);
+            if (shareable)
+                sharedReorders.push_back({parent, edge->getInputDesc(), edge->getOutputDesc(), reorder});
+        }
 
-            // Add edge for afterNode
-            afterNode->getParent()->childEdges.push_back(afterNode);
-            graphEdges[i]->getChild()->parentEdges[oIndex].reset();
-            graphEdges[i]->getChild()->parentEdges[oIndex] = afterNode;
+        MKLDNNEdgePtr afterNode = CreateEdge(reorder, child);
+        afterNode->setDims(edge->getDims());
 
-            newReorder->getSupportedDescriptors();
-            newReorder->initSupportedPrimitiveDescriptors();
-            newReorder->selectOptimalPrimitiveDescriptor();
+        // Add edge for afterNode
+        reorder->childEdges.push_back(afterNode);
+        child->parentEdges[oIndex].reset();
+        child->parentEdges[oIndex] = afterNode;
 
-            beforeNode->getDesc();
+        if (shared == sharedReorders.end()) {
+            reorder->getSupportedDescriptors();
+            reorder->initSupportedPrimitiveDescriptors();
+            reorder->selectOptimalPrimitiveDescriptor();
+        }
+
+        afterNode->getDesc();
+        graphEdges.push_back(afterNode);
+
+        graphEdges.erase(graphEdges.begin() + i);
+        i--;
+        numberOfEdges--;
+    }
+
+    MergeReorders();
+}
+
+void MKLDNNGraph::MergeReorders() {
+    // a reorder of the output of another reorder read by it only, e.g. of a Reorder layer of the network, converts
+    // the input of the first one at once; the two cancel each other when the layouts are the same
+    std::vector<MKLDNNNodePtr> reorders;
+    for (auto &node : graphNodes) {
+        if (node->getType() == Reorder)
+            reorders.push_back(node);
+    }
+
+    while (!reorders.empty()) {
+        MKLDNNNodePtr second = reorders.back();
+        reorders.pop_back();
+        if (std::find(graphNodes.begin(), graphNodes.end(), second) == graphNodes.end() ||
+                second->getParentEdges().size() != 1 || second->getChildEdges().size() != 1)
+            continue;
+        MKLDNNEdgePtr middle = second->getParentEdgeAt(0);
+        MKLDNNNodePtr first = middle->getParent();
+        if (first->getType() != Reorder || first->getParentEdges().size() != 1 || first->getChildEdges().size() != 1 ||
+                first->isConstant() != second->isConstant())
+            continue;
+        MKLDNNEdgePtr in = first->getParentEdgeAt(0);
+        MKLDNNEdgePtr out = second->getChildEdgeAt(0);
+        MKLDNNNodePtr parent = in->getParent();
+        MKLDNNNodePtr child = out->getChild();
+        int iIndex = in->getInputNum();
+        int oIndex = out->getOutputNum();
+        if (iIndex < 0 || oIndex < 0)
+            continue;
+
+        InferenceEngine::TensorDesc input = in->getInputDesc();
+        InferenceEngine::TensorDesc output = out->getOutputDesc();
+        MKLDNNNodePtr reorder = parent;
+        if (!MKLDNNExtensionUtils::initTensorsAreEqual(input, output)) {
+            CNNLayerPtr layer(new CNNLayer({first->getName() + "_" + second->getName(),
+                                            "Reorder",
+                                            input.getPrecision()}));
+            reorder.reset(new MKLDNNReorderNode(layer, getEngine()));
+            dynamic_cast<MKLDNNReorderNode *>(reorder.get())->setDescs(input, output);
+            MKLDNNEdgePtr beforeNode = CreateEdge(parent, reorder);
+            beforeNode->setDims(in->getDims());
+            parent->childEdges[iIndex] = beforeNode;
+            reorder->parentEdges.push_back(beforeNode);
             graphEdges.push_back(beforeNode);
-            afterNode->getDesc();
-            graphEdges.push_back(afterNode);
+            graphNodes.push_back(reorder);
+        }
 
-            graphNodes.push_back(newReorder);
-            graphEdges.erase(graphEdges.begin() + i);
-            i--;
-            numberOfEdges--;
+        MKLDNNEdgePtr afterNode = CreateEdge(reorder, child);
+        afterNode->setDims(out->getDims());
+        if (reorder == parent)
+            parent->childEdges[iIndex] = afterNode;
+        else
+            reorder->childEdges.push_back(afterNode);
+        child->parentEdges[oIndex] = afterNode;
+        graphEdges.push_back(afterNode);
+
+        if (reorder != parent) {
+            reorder->getSupportedDescriptors();
+            reorder->initSupportedPrimitiveDescriptors();
+            reorder->selectOptimalPrimitiveDescriptor();
+            reorder->getParentEdgeAt(0)->getDesc();
+            reorders.push_back(reorder);
         }
+        afterNode->getDesc();
+
+        for (auto &edge : {in, middle, out})
+            graphEdges.erase(std::find(graphEdges.begin(), graphEdges.end(), edge));
+        for (auto &node : {first, second})
+            graphNodes.erase(std::find(graphNodes.begin(), graphNodes.end(), node));
     }
 }
 
+// returns the whole pages of the buffer to the system, they are read as zeros when they are touched again
+static void releasePages(void *data, size_t size) {
+#if defined(__linux__)
+    const uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(data) + pageSize - 1) / pageSize * pageSize;
+    uintptr_t end = (reinterpret_cast<uintptr_t>(data) + size) / pageSize * pageSize;
+    // it is only a hint, so the failure is not an error
+    if (end > begin)
+        madvise(reinterpret_cast<void *>(begin), end - begin, MADV_DONTNEED);
+#endif
+}
+
 static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+// The new state edge of a MemoryOutput whose buffer InitMemoryStates may swap with the state one: it has the state
+// descriptor and is neither a user input nor computed once
+static inline bool isSwappableState(MKLDNNEdgePtr edge) {
+    auto memoryOutput = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(edge->getChild());
+    if (!memoryOutput || !memoryOutput->getInputNode() || memoryOutput->getInputNode()->getChildEdges().empty())
+        return false;
+    return edge->getParent()->getType() != Input && !isConstOutput(edge) &&
+           memoryOutput->getInputNode()->getChildEdgeAt(0)->getDesc() == edge->getDesc();
+}
+
+void MKLDNNGraph::GetMemoryFootprint(InferenceEngine::MemoryFootprint &footprint,
+                                     std::unordered_set<const void *> &countedWeights) const {
+    std::function<void(const MKLDNNNodePtr &)> addWeights = [&](const MKLDNNNodePtr &node) {
+        for (auto &blob : node->internalBlobs) {
+            if (blob && countedWeights.insert(blob->buffer()).second)
+                footprint.weights += blob->byteSize();
+        }
+        for (auto &memory : node->internalBlobMemory) {
+            if (memory && countedWeights.insert(memory->GetData()).second)
+                footprint.weights += memory->GetSize();
+        }
+        for (auto &fused : node->fusedWith)
+            addWeights(fused);
+        for (auto &merged : node->mergedWith)
+            addWeights(merged);
+    };
+    for (auto &node : graphNodes)
+        addWeights(node);
+
+    // the trimmed graph keeps only the persistent data
+    footprint.workspace += trimState->trimmed ? trimState->data.size() * sizeof(float) : workspaceSize;
+}
+
+void MKLDNNGraph::Trim() {
+    std::lock_guard<std::mutex> lock(trimState->mutex);
+    if (trimState->trimmed || !memWorkspace)
+        return;
+    float *workspace = static_cast<float *>(memWorkspace->GetData());
+    size_t persistentSize = 0;
+    for (auto &range : persistentRanges)
+        persistentSize += range.second;
+    trimState->data.resize(persistentSize);
+    float *saved = trimState->data.data();
+    for (auto &range : persistentRanges) {
+        std::copy(workspace + range.first, workspace + range.first + range.second, saved);
+        saved += range.second;
+    }
+    releasePages(workspace, memWorkspace->GetSize());
+    trimState->trimmed = true;
+}
+
+void MKLDNNGraph::RestoreTrimmed() {
+    if (!trimState->trimmed)
+        return;
+    std::lock_guard<std::mutex> lock(trimState->mutex);
+    if (!trimState->trimmed)
+        return;
+    // the inputs pushed since the graph was trimmed do not overlap the persistent data, so only it is copied back
+    float *workspace = static_cast<float *>(memWorkspace->GetData());
+    const float *saved = trimState->data.data();
+    for (auto &range : persistentRanges) {
+        std::copy(saved, saved + range.second, workspace + range.first);
+        saved += range.second;
+    }
+    std::vector<float>().swap(trimState->data);
+    trimState->trimmed = false;
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
 
@@ -490,12 +862,28 @@ void MKLDNNGraph::AllocateWithReuse() {
     const int alignment = 16;  // 64 bytes or 16 floats
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    // the nodes of the same level may be executed at the same time, so the lifetime of
+    // the data is measured in execution levels rather than in execution order indexes
+    auto execOrder = [&](const MKLDNNNodePtr& node) {
+        return parallelLevels.empty() ? node->execIndex : node->execLevel;
+    };
+    // the constant data must survive the execution of the other graphs of the memory domain
+    std::vector<bool> isPrivate(edge_clasters.size(), true);
+    std::vector<bool> isLoadOnly(edge_clasters.size(), false);
+    // the data of the inputs, the constants and the outputs of the graph, which must not be overwritten
+    std::vector<bool> isPinned(edge_clasters.size(), false);
+    // the data kept from one inference to the next one: the constants and the states of the Memory layers
+    std::vector<bool> isPersistent(edge_clasters.size(), false);
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = execOrder(edge->getParent());
+            int e_finish = execOrder(edge->getChild());
+            // the eltwise reads the input of the broadcast tile instead of the output
+            auto tile = std::dynamic_pointer_cast<MKLDNNTileNode>(edge->getChild());
+            if (tile && tile->isBroadcastView())
+                e_finish = execOrder(tile->getChildEdgeAt(0)->getChild());
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -511,7 +899,7 @@ void MKLDNNGraph::AllocateWithReuse() {
         // Constant data are filled once on load.
         // So we need it untouchable during all execution time
         // -1 is a place holder for a max timestamp.
-        bool isConst = false, isOutput = false, isInput = false;
+        bool isConst = false, isOutput = false, isInput = false, isNewState = false;
         for (auto &edge : edge_clasters[i]) {
             isConst  |= isConstOutput(edge);
             isOutput |= edge->getChild()->getType() == Output;
@@ -520,37 +908,144 @@ void MKLDNNGraph::AllocateWithReuse() {
             // WA. MemoryOutput will keep data in that edge
             // So need to make it immortal..
             isConst |= edge->getParent()->getType() == MemoryInput;
+            isNewState |= isSwappableState(edge);
         }
+        // the new state becomes the current one after the inference if MemoryOutput swaps the states, which
+        // InitMemoryStates does only for the buffers not exchanged with the user blobs
+        isConst |= isNewState && !isInput && !isOutput;
 
         if (isInput  | isConst) box.start = 0;
         if (isOutput | isConst) box.finish = -1;
 
         box.size = div_up(box.size, alignment);
+        isPrivate[i] = isConst;
+        isPinned[i] = isInput || isConst || isOutput;
+        isPersistent[i] = isConst;
+
+        // the data passed between the constant nodes is needed only while the constants are computed on load,
+        // except the data of the network outputs
+        bool loadOnly = true;
+        for (auto &edge : edge_clasters[i])
+            loadOnly &= edge->getParent()->isConstant() && edge->getChild()->isConstant();
+        isLoadOnly[i] = loadOnly && !isConst && !isOutput;
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = memSolver.solve() * alignment;
+    sharedWorkspace.reset();
+    memDomain.reset();
+    if (!config.memoryDomain.empty()) {
+        memDomain = MKLDNNMemoryDomain::get(config.memoryDomain);
+    } else {
+        std::fill(isPrivate.begin(), isPrivate.end(), true);
+    }
 
-    memWorkspace.reset(new MKLDNNMemory(eng));
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::FP32, {1, total_size}, Layout::NC)));
+    std::vector<MemorySolver::Box> privateBoxes, sharedBoxes, loadBoxes;
+    for (int i = 0; i < boxes.size(); i++) {
+        if (isLoadOnly[i])
+            loadBoxes.push_back(boxes[i]);
+        else
+            (isPrivate[i] ? privateBoxes : sharedBoxes).push_back(boxes[i]);
+    }
+    MemorySolver privateSolver(privateBoxes);
+    MemorySolver sharedSolver(sharedBoxes);
+    MemorySolver loadSolver(loadBoxes);
+
+    // the output of a node reading every element of an input before writing the same element of the output may
+    // take the memory of the input, when the input is not read after the node
+    std::map<MKLDNNEdgePtr, int> clasterOf;
+    for (int i = 0; i < edge_clasters.size(); i++) {
+        for (auto &edge : edge_clasters[i])
+            clasterOf[edge] = i;
+    }
+    for (auto &node : graphNodes) {
+        if (node->getChildEdges().empty())
+            continue;
+        auto out = node->getChildEdgeAt(0);
+        int co = clasterOf[out];
+        if (isPinned[co] || boxes[co].start != execOrder(node))
+            continue;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            if (!node->canShareInputMemory(i))
+                continue;
+            auto in = node->getParentEdgeAt(i);
+            int ci = clasterOf[in];
+            if (ci == co || isPinned[ci] || isLoadOnly[ci] != isLoadOnly[co] || isPrivate[ci] != isPrivate[co] ||
+                    boxes[ci].finish != execOrder(node) || !(in->getDesc() == out->getDesc()))
+                continue;
+            bool lastReader = true;
+            for (auto &edge : edge_clasters[ci])
+                lastReader &= edge->getChild() == node || execOrder(edge->getChild()) < execOrder(node);
+            if (!lastReader)
+                continue;
+            MemorySolver &solver = isLoadOnly[co] ? loadSolver : isPrivate[co] ? privateSolver : sharedSolver;
+            solver.setInPlace(co, ci);
+            break;
+        }
+    }
+    size_t private_size = privateSolver.solve() * alignment;
+    size_t shared_size = sharedSolver.solve() * alignment;
+    size_t load_size = loadSolver.solve() * alignment;
+
+    workspaceSize = (private_size + shared_size) * sizeof(float);
+    loadWorkspaceSize = load_size * sizeof(float);
+
+    float* shared_data = nullptr;
+    if (memDomain && shared_size > 0) {
+        sharedWorkspace = memDomain->map(shared_size * sizeof(float));
+        shared_data = static_cast<float*>(sharedWorkspace.get());
+    }
+    if (!shared_data) {
+        // the system cannot share the memory, so the data is placed after the private one
+        private_size += shared_size;
+    }
+
+    // the workspace is zeroed (first touched) by the creating thread, so in the throughput mode,
+    // where the threads of a stream are pinned to a NUMA node, it is allocated on the local node
+    memWorkspace.reset(new MKLDNNMemory(eng, config.allocator));
+    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::FP32, {1, private_size}, Layout::NC)));
     float* workspace_ptr = static_cast<float*>(memWorkspace->GetData());
+    if (!shared_data) {
+        shared_data = workspace_ptr + private_size - shared_size;
+    }
+
+    // the separate workspace of the constant subgraphs is released by FoldConstants
+    memLoadWorkspace.reset();
+    float* load_data = nullptr;
+    if (load_size > 0) {
+        memLoadWorkspace.reset(new MKLDNNMemory(eng, config.allocator));
+        memLoadWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::FP32, {1, load_size}, Layout::NC)));
+        load_data = static_cast<float*>(memLoadWorkspace->GetData());
+    }
 
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int offset = memSolver.getOffset(i);
+                float* base_ptr = isLoadOnly[i] ? load_data : isPrivate[i] ? workspace_ptr : shared_data;
+                int offset = isLoadOnly[i] ? loadSolver.getOffset(i)
+                                           : isPrivate[i] ? privateSolver.getOffset(i) : sharedSolver.getOffset(i);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in float
+                edge->allocate(base_ptr + offset * alignment);  // alignment in float
                 count++;
             }
         }
         IE_ASSERT(count == 1);
     }
+
+    // the persistent data is always in the private workspace, Trim saves it before the pages are released
+    persistentRanges.clear();
+    std::vector<float>().swap(trimState->data);
+    trimState->trimmed = false;
+    for (int i = 0; i < edge_clasters.size(); i++) {
+        if (isPersistent[i])
+            persistentRanges.emplace_back(privateSolver.getOffset(i) * alignment, boxes[i].size * alignment);
+    }
 }
 
 void MKLDNNGraph::Allocate() {
+    // the memory created by the nodes (e.g. the repacked weights) comes from the allocator of the graph
+    for (auto& node : graphNodes) node->setAllocator(config.allocator);
+
     // resolve edges. Define which will be a view on others
     //   NeedAllocation - real blob
     //   NotAllocated - view on other blob, peer or in-place
@@ -567,11 +1062,139 @@ void MKLDNNGraph::Allocate() {
 }
 
 void MKLDNNGraph::CreatePrimitives() {
-    for (auto& node : graphNodes) {
+    // the memory is allocated by this point, the nodes only JIT their kernels and repack their weights, which are
+    // shared through the synchronized weights cache; a custom allocator of the application may not be thread safe
+    forEachNode(graphNodes, config.allocator == nullptr, [](const MKLDNNNodePtr &node) {
         node->createPrimitive();
+    });
+}
+
+void MKLDNNGraph::InitMemoryStates() {
+    swappingMemoryNodes.clear();
+    for (auto& node : graphNodes) {
+        auto memoryOutput = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(node);
+        if (!memoryOutput || !memoryOutput->getInputNode() || memoryOutput->getInputNode()->getChildEdges().empty())
+            continue;
+
+        const MKLDNNMemory& state = memoryOutput->getInputNode()->getChildEdgeAt(0)->getMemory();
+        const MKLDNNMemory& newState = memoryOutput->getParentEdgeAt(0)->getMemory();
+        void* stateData = state.GetData();
+        void* newStateData = newState.GetData();
+        // only the new state buffers kept immortal by AllocateWithReuse can become the state
+        bool canSwap = stateData != newStateData && isSwappableState(memoryOutput->getParentEdgeAt(0)) &&
+                       state.GetPrimitiveDescriptor() == newState.GetPrimitiveDescriptor();
+
+        // both buffers are immortal, so the edges viewing them are found by the data pointer
+        std::vector<MKLDNNMemoryPtr> stateMemories, newStateMemories;
+        for (size_t i = 0; canSwap && i < graphEdges.size(); i++) {
+            auto& edge = graphEdges[i];
+            void* data = edge->getMemory().GetData();
+            if (data != stateData && data != newStateData)
+                continue;
+            // the infer request may replace the memory of the inputs and the outputs with the user blobs,
+            // and the constant data is computed only once
+            if (edge->getParent()->getType() == Input || edge->getChild()->getType() == Output || isConstOutput(edge))
+                canSwap = false;
+            (data == stateData ? stateMemories : newStateMemories).push_back(edge->getMemoryPtr());
+        }
+
+        if (canSwap) {
+            memoryOutput->setStateMemories(stateMemories, newStateMemories);
+            swappingMemoryNodes.push_back(memoryOutput);
+        }
     }
 }
 
+void MKLDNNGraph::SwapMemoryStates() {
+    for (auto& node : swappingMemoryNodes)
+        node->swapStates();
+}
+
+void MKLDNNGraph::CalculateExecutionLevels() {
+    // level of the node is the length of the longest path from the inputs,
+    // so the nodes of the same level do not depend on each other
+    parallelLevels.clear();
+    for (auto &node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            level = std::max(level, node->getParentEdgeAt(i)->getParent()->execLevel + 1);
+        node->execLevel = level;
+
+        if (node->isConstant())
+            continue;
+        if (parallelLevels.size() <= static_cast<size_t>(level))
+            parallelLevels.resize(level + 1);
+        parallelLevels[level].push_back(node);
+    }
+}
+
+void MKLDNNGraph::ExecuteLevel(const std::vector<MKLDNNNodePtr>& level, mkldnn::stream& stream, int batch,
+                               PerfCounters& counters, const std::vector<bool> *executed) {
+    auto executeNode = [&](const MKLDNNNodePtr& node, mkldnn::stream& strm) {
+        if (executed && !(*executed)[node->execIndex])
+            return;
+        PERF(counters, node);
+
+        if (batch > 0)
+            node->setDynamicBatchLim(batch);
+
+        IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+        IE_TRACE_SCOPE(node->getName(), "node");
+        node->execute(strm);
+    };
+
+    const int threads = parallel_get_max_threads();
+    const int branches = std::min<int>(level.size(), threads);
+    if (branches <= 1) {
+        for (auto &node : level)
+            executeNode(node, stream);
+        return;
+    }
+
+#if IE_THREAD == IE_THREAD_OMP
+    // every branch is executed by its own part of the threads
+    const int threadsPerBranch = std::max(1, threads / branches);
+    std::exception_ptr exception = nullptr;
+    // the branches are executed by the nested OpenMP teams, the nesting of the application is restored afterwards
+    const int maxActiveLevels = omp_get_max_active_levels();
+    omp_set_max_active_levels(std::max(maxActiveLevels, omp_get_active_level() + 2));
+    #pragma omp parallel num_threads(branches)
+    {
+        // mkldnn stream is not thread safe
+        mkldnn::stream branchStream(stream::kind::eager);
+        omp_set_num_threads(threadsPerBranch);
+        #pragma omp for schedule(dynamic, 1)
+        for (int i = 0; i < static_cast<int>(level.size()); i++) {
+            try {
+                executeNode(level[i], branchStream);
+            } catch (...) {
+                #pragma omp critical
+                exception = std::current_exception();
+            }
+        }
+    }
+    omp_set_max_active_levels(maxActiveLevels);
+    if (exception)
+        std::rethrow_exception(exception);
+#else
+    // the runtime shares the threads between the nested loops of the branches by itself
+    std::vector<std::exception_ptr> errors(level.size());
+    parallel_for_dynamic(level.size(), [&](size_t i) {
+        // mkldnn stream is not thread safe
+        mkldnn::stream branchStream(stream::kind::eager);
+        try {
+            executeNode(level[i], branchStream);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (auto &error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+#endif
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
@@ -582,14 +1205,46 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
-        if (ext_data_ptr != inter_data_ptr)
-        input->second->getChildEdgeAt(0)->getMemory().SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
-                MKLDNNMemory::Convert(in->getTensorDesc().getLayout()), ext_data_ptr, in->byteSize(), false);
+        auto &inter_mem = input->second->getChildEdgeAt(0)->getMemory();
+        auto meanImage = _meanImages.find(name);
+        const auto &inDesc = in->getTensorDesc();
+        const bool inDense = MKLDNNMemory::IsDenseDesc(inDesc);
+        const bool inPlanar = inDense && inDesc.getLayout() == InferenceEngine::NCHW;
+        const bool inInterleaved = inDense && inDesc.getLayout() == InferenceEngine::NHWC;
+
+        // the U8 or interleaved input and the mean are converted to the planar FP32 input of the network in one pass,
+        // the other cases go through the reorder
+        if (ext_data_ptr != inter_data_ptr && inter_mem.GetDataType() == memory::f32 &&
+                MKLDNNMemory::formatEquals(inter_mem.GetFormat(), memory::nchw) && (inPlanar || inInterleaved) &&
+                (inDesc.getPrecision() == InferenceEngine::Precision::U8 ||
+                 (inDesc.getPrecision() == InferenceEngine::Precision::FP32 &&
+                  (inInterleaved || meanImage != _meanImages.end())))) {
+            MeanImage noMean;
+            MeanImage &mean = meanImage != _meanImages.end() ? meanImage->second : noMean;
+            MKLDNNDims inDims(inDesc.getDims());
+            if (inDesc.getPrecision() == InferenceEngine::Precision::U8) {
+                mean.Convert(inDims, static_cast<const uint8_t *>(ext_data_ptr), inInterleaved,
+                             reinterpret_cast<float *>(inter_data_ptr));
+            } else {
+                mean.Convert(inDims, static_cast<const float *>(ext_data_ptr), inInterleaved,
+                             reinterpret_cast<float *>(inter_data_ptr));
+            }
+            return;
+        }
 
-        // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
-            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
-                _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr));
+        if (!inDense) {
+            // the view of a frame (e.g. the ROI made by make_shared_blob(roi)) is gathered into the network input
+            // straight from the frame, the precision is converted by the same reorder
+            inter_mem.SetStridedData(inDesc, ext_data_ptr);
+        } else if (ext_data_ptr != inter_data_ptr) {
+            inter_mem.SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision()),
+                              MKLDNNMemory::Convert(inDesc.getLayout()), ext_data_ptr, in->byteSize(), false);
+        }
+
+        if (meanImage != _meanImages.end()) {
+            // the mean is subtracted from the network input, which is FP32 if the mean is set
+            if (inter_mem.GetDataType() == memory::f32) {
+                meanImage->second.Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr));
             } else {
                 THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
             }
@@ -599,26 +1254,83 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
-void MKLDNNGraph::PullOutputData(BlobMap &out) {
+void MKLDNNGraph::PullConvertedOutput(const MKLDNNMemory &intr_blob, const TensorDesc &desc, const Blob::Ptr &ext_blob,
+                                      int samples) {
+    if (ext_blob->getTensorDesc().getPrecision() != desc.getPrecision() ||
+            ext_blob->size() != details::product(desc.getDims()))
+        THROW_IE_EXCEPTION << "Output blob does not match the converted output (" << desc.getPrecision() << " of "
+                           << details::product(desc.getDims()) << " elements)";
+    const std::vector<int> dims = intr_blob.GetDims();
+    const float *src = reinterpret_cast<const float *>(intr_blob.GetData()) +
+                       intr_blob.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const size_t sampleSize = intr_blob.GetSize() / sizeof(float) / dims[0];
+
+    if (desc.getPrecision() == Precision::FP16) {
+        PrecisionUtils::f32tof16Arrays(ext_blob->buffer().as<ie_fp16 *>(), src, sampleSize * samples);
+        return;
+    }
+    if (desc.getPrecision() == Precision::BF16) {
+        PrecisionUtils::f32tobf16Arrays(ext_blob->buffer().as<short *>(), src, sampleSize * samples);
+        return;
+    }
+
+    // the argmax of the channels of every sample and pixel, the channels are interleaved in the NHWC output memory
+    const size_t channels = dims[1];
+    const size_t spatial = sampleSize / channels;
+    const bool interleaved = MKLDNNMemory::formatEquals(intr_blob.GetFormat(), memory::nhwc);
+    const size_t channelStride = interleaved ? 1 : spatial;
+    const size_t pixelStride = interleaved ? channels : 1;
+    auto argmax = [&](size_t i) {
+        const float *pixel = src + (i / spatial) * sampleSize + (i % spatial) * pixelStride;
+        size_t best = 0;
+        for (size_t c = 1; c < channels; c++) {
+            if (pixel[c * channelStride] > pixel[best * channelStride])
+                best = c;
+        }
+        return best;
+    };
+    if (desc.getPrecision() == Precision::U8) {
+        auto *dst = ext_blob->buffer().as<uint8_t *>();
+        parallel_for(samples * spatial, [&](size_t i) { dst[i] = static_cast<uint8_t>(argmax(i)); });
+    } else {
+        auto *dst = ext_blob->buffer().as<int32_t *>();
+        parallel_for(samples * spatial, [&](size_t i) { dst[i] = static_cast<int32_t>(argmax(i)); });
+    }
+}
+
+void MKLDNNGraph::PullOutputData(BlobMap &out, const std::vector<bool> *executed) {
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
 
     for (MKLDNNNodePtr &node : outputNodes) {
+        if (executed && !(*executed)[node->execIndex])
+            continue;
         // remove out_ from node name
         std::string name = node->getName().substr(4);
         const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
         if (out.find(name) == out.end()) {
-            // TODO: Create blob from MemoryDesc
-            Blob::Ptr outBlob = make_shared_blob<float>({Precision::FP32, node->getParentEdgeAt(0)->getDims().ToSizeVector(),
-                                                         TensorDesc::getLayoutByDims(node->getParentEdgeAt(0)->getDims().ToSizeVector())},
-                                                        reinterpret_cast<float*>(intr_blob.GetData()));
-            out[name] = outBlob;
+            auto converted = convertedOutputs.find(name);
+            if (converted != convertedOutputs.end()) {
+                out[name] = make_blob_with_precision(converted->second);
+                out[name]->allocate();
+            } else {
+                out[name] = node->getParentEdgeAt(0)->getBlob();
+            }
         }
 
         Blob::Ptr &ext_blob = out[name];
 
-        // TODO: Why we allow allocation of output memory inside Infer call??
-        // Suggestion is to disable this behaviour
+        auto converted = convertedOutputs.find(name);
+        if (converted != convertedOutputs.end()) {
+            int samples = node->batchToProcess();
+            if (config.batchLimit)
+                samples = std::min<int>(config.batchLimit, samples);
+            PullConvertedOutput(intr_blob, converted->second, ext_blob, samples);
+            continue;
+        }
+
+        // the infer requests pass the allocated blobs (see MKLDNNBlobPool), so the output memory is only
+        // allocated here for the direct callers passing the empty blobs
         if (ext_blob->buffer() == nullptr) {
             SizeVector dims = node->getParentEdgeAt(0)->getDims().ToSizeVector();
             std::reverse(dims.begin(), dims.end());  // Blobs dims are in reverse order (legacy of OpenVX :-( )
@@ -636,6 +1348,17 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         // That is the same memory. No need to copy
         if (ext_blob_ptr == intr_blob_ptr) continue;
 
+        // The output blob has another layout than the graph output (e.g. NHWC vs NCHW), so it cannot be bound
+        // to the edge memory and plain copy is not enough: the data is reordered directly to the user blob
+        memory::format ext_format = MKLDNNMemory::Convert(ext_blob->layout());
+        if (ext_format != memory::blocked && !MKLDNNMemory::formatEquals(ext_format, intr_blob.GetFormat()) &&
+                MKLDNNExtensionUtils::IEPrecisionToDataType(ext_blob->precision()) == intr_blob.GetDataType()) {
+            MKLDNNMemory ext_mem(getEngine());
+            ext_mem.Create(intr_blob.GetDims(), intr_blob.GetDataType(), ext_format, ext_blob_ptr);
+            mkldnn::stream(stream::kind::eager).submit({mkldnn::reorder(intr_blob.GetPrimitive(), ext_mem.GetPrimitive())});
+            continue;
+        }
+
         int MB = intr_blob.GetDims()[0];
         int MB_to_process = node->batchToProcess();
         // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
@@ -777,25 +1500,51 @@ void dump_as_bitmaps(const std::string name, const float* data,
 }
 #endif
 
-void MKLDNNGraph::Infer(int batch) {
+void MKLDNNGraph::Infer(int batch, PerfCounters *counters, const std::vector<bool> *executed) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    RestoreTrimmed();
+
+    // the inference may run on the thread other than the one created the graph (the shared executor, the caller of
+    // the inline Infer), the team is cached per thread, so it is only applied once to every thread
+    applyThreadTeam(teamCpus, config.useThreadBinding);
+
+    PerfCounters &nodeCounters = counters ? *counters : perfCounters;
+    nodeCounters.prepare(graphNodes.size());
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+
+    // the memory is planned for the execution by levels, if the graph was created in CPU_PARALLEL_BRANCHES mode
+    if (!parallelLevels.empty()) {
+        for (auto &level : parallelLevels)
+            ExecuteLevel(level, stream, batch, nodeCounters, executed);
+        SwapMemoryStates();
+        return;
+    }
 #ifdef DEBUG_DUMP_NEW_FOLDER_PER_INFER
         static int folderIdx = 0;
         folderIdx++;
 #endif
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    for (const MKLDNNNodePtr &node : executableNodes) {
+        // the nodes only the outputs not requested by the infer request depend on
+        if (executed && !(*executed)[node->execIndex])
+            continue;
+
+        // the inferences of the higher priority networks queued to the shared executor run before the next node
+        if (config.preemption)
+            TaskExecutor::preempt(config.requestPriority);
+
+        PERF(nodeCounters, node);
 
         if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+            node->setDynamicBatchLim(batch);
 
-        if (!graphNodes[i]->isConstant()) {
-            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+        {
+            IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+            IE_TRACE_SCOPE(node->getName(), "node");
+            node->execute(stream);
         }
 
 #ifdef DEBUG_DUMP_PATH
@@ -805,19 +1554,19 @@ void MKLDNNGraph::Infer(int batch) {
             std::to_string(folderIdx - 1) +
 #endif
             "/";
-            std::cout << "Try to create logs for " << graphNodes[i]->getName() << std::endl;
-            std::string nodeName = graphNodes[i]->name;
+            std::cout << "Try to create logs for " << node->getName() << std::endl;
+            std::string nodeName = node->name;
             std::replace(nodeName.begin(), nodeName.end(), '/', '_');
             std::ofstream layer_data_dump;
-            for (size_t j = 0; j < graphNodes[i]->getChildEdges().size(); j++) {
-                auto childEdge = graphNodes[i]->getChildEdgeAt(j);
-                std::string childName = graphNodes[i]->getChildEdgeAt(j)->getChild()->getName();
+            for (size_t j = 0; j < node->getChildEdges().size(); j++) {
+                auto childEdge = node->getChildEdgeAt(j);
+                std::string childName = node->getChildEdgeAt(j)->getChild()->getName();
                 std::replace(childName.begin(), childName.end(), '/', '_');
 
                 //  std::string fname = DEBUG_DUMP_PATH + nodeName + "_dst_" + childName + "_" + std::to_string(j) + ".txt";
                 std::string tname = folderName + nodeName + "_dst_" + childName + "_" + std::to_string(j);
                 std::string fname = tname + ".txt";
-                if (graphNodes[i]->getChildEdges().size() == 1) {
+                if (node->getChildEdges().size() == 1) {
                     fname = folderName + nodeName + "_dst.txt";
                 }
                 layer_data_dump.open(fname);
@@ -841,8 +1590,8 @@ void MKLDNNGraph::Infer(int batch) {
                 }
             }
 
-            for (size_t p = 0 ; p < graphNodes[i]->getParentEdges().size(); p++) {
-                auto parentEdge = graphNodes[i]->getParentEdgeAt(p);
+            for (size_t p = 0 ; p < node->getParentEdges().size(); p++) {
+                auto parentEdge = node->getParentEdgeAt(p);
                 auto parent = parentEdge->getParent();
                 std::string parentName = parent->getName();
                 std::replace(parentName.begin(), parentName.end(), '/', '_');
@@ -851,9 +1600,9 @@ void MKLDNNGraph::Infer(int batch) {
                 std::string fname = tname + ".txt";
                 layer_data_dump.open(fname);
                 if (layer_data_dump.is_open()) {
-                    float *data = static_cast<float *>(graphNodes[i]->getParentEdges()[p]
+                    float *data = static_cast<float *>(node->getParentEdges()[p]
                             .lock()->getMemory().GetData());
-                    mkldnn::impl::memory_desc_wrapper src_d(graphNodes[i]->getParentEdges()[p]
+                    mkldnn::impl::memory_desc_wrapper src_d(node->getParentEdges()[p]
                                                                     .lock()->getMemory().GetDescriptor().data);
     #ifdef DEBUG_BMP_OUTPUT
                     dump_as_bitmaps(tname, data, parentEdge->getDims().ToSizeVector(), src_d.format());
@@ -871,7 +1620,7 @@ void MKLDNNGraph::Infer(int batch) {
                 }
             }
 
-            GenericLayer* genericLayer = dynamic_cast<GenericLayer*>(graphNodes[i]->getCnnLayer().get());
+            GenericLayer* genericLayer = dynamic_cast<GenericLayer*>(node->getCnnLayer().get());
             if (genericLayer != nullptr) {
                 for (auto blob : genericLayer->blobs) {
                     layer_data_dump.open(folderName + nodeName + "_" + blob.first + ".txt");
@@ -894,6 +1643,35 @@ void MKLDNNGraph::Infer(int batch) {
         }
 #endif
     }
+
+    SwapMemoryStates();
+}
+
+void MKLDNNGraph::WarmUp() {
+    // the inference would advance the states of the memory layers
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput)
+            return;
+    }
+
+    // the zero inputs keep the garbage of the fresh memory (NaNs, denormals) out of the first run
+    for (auto &input : inputNodes) {
+        for (size_t i = 0; i < input.second->getChildEdges().size(); i++)
+            input.second->getChildEdgeAt(i)->getMemoryPtr()->FillZero();
+    }
+
+    // the inference does not count in the statistics of the graph
+    PerfCounters counters;
+    Infer(-1, &counters);
+}
+
+void MKLDNNGraph::InferTiles(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &outputs,
+                             PerfCounters *counters, MKLDNNBlobPool &tilePool) {
+    if (!IsReady())
+        THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
+    if (!tiling)
+        THROW_IE_EXCEPTION << "The graph is not compiled for a tile of the inputs.";
+    tiling->Infer(*this, inputs, outputs, counters, tilePool);
 }
 
 MKLDNNNodePtr MKLDNNGraph::FindNodeWithName(const std::string& name) const {
@@ -958,12 +1736,23 @@ void MKLDNNGraph::SortTopologically() {
     graphNodes.assign(sorted.begin(), sorted.end());
 }
 
-void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
+void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap,
+                              const PerfCounters *counters) const {
+    const PerfCounters &nodeCounters = counters ? *counters : perfCounters;
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
             getPerfMapFor = [&](std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap, const MKLDNNNodePtr& node) {
         InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[node->getName()];
+        // the fused and merged nodes are not executed, so they have no statistics
+        static const PerfCount notExecuted;
+        const PerfCount &counter = node->execIndex >= 0 && static_cast<size_t>(node->execIndex) < nodeCounters.size() &&
+                                   graphNodes[node->execIndex] == node ? nodeCounters[node->execIndex] : notExecuted;
         // TODO: Why time counter is signed?
-        pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
+        pc.cpu_uSec = pc.realTime_uSec = (long long) counter.avg();
+        pc.minRealTime_uSec = (long long) counter.minTime();
+        pc.p50RealTime_uSec = (long long) counter.percentile(50);
+        pc.p99RealTime_uSec = (long long) counter.percentile(99);
+        pc.maxRealTime_uSec = (long long) counter.maxTime();
+        pc.num_runs = counter.count();
         pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
@@ -1010,7 +1799,10 @@ void MKLDNNGraph::getInputBlobs(InferenceEngine::BlobMap &resp) {
 void MKLDNNGraph::getOutputBlobs(InferenceEngine::BlobMap &resp) {
     for (auto &it : outputNodes) {
         std::string name = it->getName().substr(4);
-        resp[name] = it->getParentEdgeAt(0)->getBlob();
+        // the converted outputs are described by the blobs they are pulled to, the memory is never used
+        auto converted = convertedOutputs.find(name);
+        resp[name] = converted != convertedOutputs.end() ? make_blob_with_precision(converted->second)
+                                                         : it->getParentEdgeAt(0)->getBlob();
     }
 }
 
@@ -1048,7 +1840,23 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(InferenceEngine::ICNNNetwork &network
             type != Crop &&
             type != BatchNormalization &&
             type != Copy) {
-            check_result = false;
+            // the layers moving the data across the batch keep the samples apart only in some configurations
+            if (type == ::MKLDNNPlugin::Type::Reshape || type == Flatten) {
+                // the samples are kept if the batch stays the outermost dimension
+                if (layer->insData.empty() || layer->outData.empty() ||
+                        layer->insData[0].lock()->getTensorDesc().getDims()[0] !=
+                        layer->outData[0]->getTensorDesc().getDims()[0])
+                    check_result = false;
+            } else if (type == Permute) {
+                std::vector<int> order = layer->GetParamAsInts("order", {});
+                if (order.empty() || order[0] != 0)
+                    check_result = false;
+            } else if (type == Tile) {
+                if (layer->GetParamAsInt("axis", 0) == 0)
+                    check_result = false;
+            } else {
+                check_result = false;
+            }
         }
     }, false);
 
@@ -1064,8 +1872,18 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr) {
-    graph.reset(new MKLDNNGraph());
-    graph->setConfig(cfg);
+    // the copy (sharing the weights with the original network) is kept for Export
+    clonedNetwork = cloneNet(network);
+
+    // the tuned implementations are set to the layers of the copy, so the graphs are created from it
+    ICNNNetwork *graphNetwork = &network;
+    if (cfg.tuningMode != Config::TuningMode::Disabled) {
+        MKLDNNTuner tuner(cfg);
+        if (cfg.tuningMode == Config::TuningMode::Create)
+            tuner.tune(*clonedNetwork, extMgr);
+        tuner.apply(*clonedNetwork);
+        graphNetwork = clonedNetwork.get();
+    }
 
     if (cfg.batchLimit > 1) {
         // check topology for applicability
@@ -1074,44 +1892,294 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(InferenceEngine::ICNNNetwork &network,
         }
     }
 
-    if (graph->getProperty().exclusiveAsyncRequests) {
+    if (!cfg.memoryDomain.empty() && !cfg.exclusiveAsyncRequests) {
+        THROW_IE_EXCEPTION << "The memory domain " << cfg.memoryDomain << " is shared by the networks, which "
+                           << "are executed one at a time only with KEY_EXCLUSIVE_ASYNC_REQUESTS=YES";
+    }
+
+    if (cfg.reshapeCacheSize > 0 &&
+            (cfg.enableDynamicBatch || (!cfg.exclusiveAsyncRequests && cfg.throughputStreams > 1))) {
+        THROW_IE_EXCEPTION << "The input shapes of the network can be changed (KEY_CPU_RESHAPE_CACHE_SIZE) "
+                           << "only without the streams and the dynamic batch";
+    }
+
+    if (cfg.releaseWeights && cfg.reshapeCacheSize > 0) {
+        THROW_IE_EXCEPTION << "The weights are released after the load (KEY_RELEASE_WEIGHTS) only without "
+                           << "the reshape cache, which creates the graphs of the new input shapes later";
+    }
+
+    if (cfg.autoBatchTimeout > 0 && !cfg.enableDynamicBatch) {
+        THROW_IE_EXCEPTION << "The async requests are batched (KEY_CPU_AUTO_BATCH_TIMEOUT) "
+                           << "only with the dynamic batch enabled";
+    }
+
+    if (cfg.preemption && (!cfg.exclusiveAsyncRequests || !cfg.memoryDomain.empty())) {
+        THROW_IE_EXCEPTION << "The network is preempted (KEY_CPU_PREEMPTION) only with "
+                           << "KEY_EXCLUSIVE_ASYNC_REQUESTS=YES and without the memory domain";
+    }
+
+    if (cfg.latencySpin > 0 && (cfg.exclusiveAsyncRequests || cfg.throughputStreams > 1 ||
+                                cfg.autoBatchTimeout > 0)) {
+        THROW_IE_EXCEPTION << "The inference runs on the calling thread (KEY_CPU_LATENCY_SPIN) only without "
+                           << "KEY_EXCLUSIVE_ASYNC_REQUESTS, the streams and the auto-batching";
+    }
+
+    // the graphs are compiled for one tile of the inputs, the copy reshaped to it is kept until they are created
+    MKLDNNGraphTiling::Ptr tiling;
+    details::CNNNetworkImplPtr tileNetwork;
+    if (cfg.batchTile > 0 || cfg.spatialTiles > 1) {
+        if (cfg.enableDynamicBatch || cfg.reshapeCacheSize > 0) {
+            THROW_IE_EXCEPTION << "The inputs are partitioned (KEY_CPU_BATCH_TILE, KEY_CPU_SPATIAL_TILES) only "
+                               << "without the dynamic batch and the reshape cache";
+        }
+        if (cfg.batchTile > 0 && !CanProcessDynBatch(*graphNetwork)) {
+            THROW_IE_EXCEPTION << "The layers of the network mix the samples, so the batch cannot be partitioned "
+                               << "(KEY_CPU_BATCH_TILE)";
+        }
+        tiling = std::make_shared<MKLDNNGraphTiling>(*graphNetwork, cfg.batchTile, cfg.spatialTiles);
+        if (tiling->isTiled()) {
+            tileNetwork = tiling->createTileNetwork(*graphNetwork);
+            graphNetwork = tileNetwork.get();
+        } else {
+            tiling.reset();
+        }
+    }
+
+    if (cfg.exclusiveAsyncRequests) {
         ExecutorManager *executorManager = ExecutorManager::getInstance();
         _taskExecutor = executorManager->getExecutor(TargetDeviceInfo::name(TargetDevice::eCPU));
     }
+    _requestPriority = cfg.requestPriority;
+    setCallbackThreads(cfg.callbackThreads);
+
+    // exclusive mode muxes all the requests into the single queue, so there is no room for streams
+    const int streams = cfg.exclusiveAsyncRequests ? 1 : cfg.throughputStreams;
+    // the own thread team of the network, the streams split it between themselves
+    const std::vector<unsigned> teamCpus = getTeamCpus(cfg.threadsNum, cfg.cores);
+    if (streams > 1) {
+        // graphs are created from the same network, so the creation is serialized,
+        // while the memory of each graph is still allocated by the thread of the stream
+        std::mutex createGraphMutex;
+        std::vector<Task::Ptr> tasks;
+        for (int n = 0; n < streams; n++) {
+            MKLDNNGraph::Ptr _graph = std::make_shared<MKLDNNGraph>();
+            _graph->setConfig(cfg);
+            graphs.push_back(_graph);
+            _graph->setTiling(tiling);
+            auto task = std::make_shared<InferenceEngine::Task>([=, &createGraphMutex]() {
+                pinStreamThreads(n, streams, cfg.useThreadBinding, teamCpus);
+                {
+                    std::lock_guard<std::mutex> lock(createGraphMutex);
+                    _graph->CreateGraph(*graphNetwork, extensionManager);
+                }
+                // every worker thread (stream) executes the requests on its own graph
+                MultiWorkerTaskExecutor::ptrContext.ptrGraph = _graph;
+            });
+            tasks.push_back(task);
+        }
+        // special executor with as many threads as requested #streams, each with it's own initialization task
+        if (cfg.workStealing)
+            _taskExecutor = std::make_shared<WorkStealingTaskExecutor>(tasks, "CPUStreamsExecutor");
+        else
+            _taskExecutor = std::make_shared<MultiWorkerTaskExecutor>(tasks, "CPUStreamsExecutor");
+        for (auto &task : tasks) task->checkException();
+    } else {
+        MKLDNNGraph::Ptr _graph = std::make_shared<MKLDNNGraph>();
+        _graph->setConfig(cfg);
+        graphs.push_back(_graph);
+        _graph->setTiling(tiling);
+        _graph->setTeamCpus(teamCpus);
+
+        // initialization in taskExecutor thread
+        auto task = std::make_shared<InferenceEngine::Task>([&]() {
+            _graph->CreateGraph(*graphNetwork, extensionManager);
+        });
 
-    // initialization in taskExecutor thread
-    auto task = std::make_shared<InferenceEngine::Task>([&]() {
-        graph->CreateGraph(network, extensionManager);
-    });
+        _taskExecutor->startTask(task);
+        Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
 
-    _taskExecutor->startTask(task);
-    Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+        if (sts == Task::TS_ERROR) task->checkException();
+    }
+
+    if (cfg.autoBatchTimeout > 0) {
+        // the batch requests are not bound to the network, so the batcher does not keep it alive
+        auto createRequest = [this]() {
+            auto request = std::make_shared<MKLDNNInferRequest>(_networkInputs, _networkOutputs);
+            request->SetGraph(graphs[0]);
+            return request;
+        };
+        autoBatcher = std::make_shared<MKLDNNAutoBatcher>(cfg.batchLimit, cfg.autoBatchTimeout, _taskExecutor,
+                                                          createRequest);
+    } else if (streams > 1) {
+        // the inputs of the next requests are resized and converted while the streams infer the previous ones
+        _preprocessExecutor = std::make_shared<WorkStealingTaskExecutor>(static_cast<size_t>(streams),
+                                                                         "CPUPreprocessing");
+    } else {
+        _preprocessExecutor = std::make_shared<TaskExecutor>("CPUPreprocessing");
+    }
+
+    if (cfg.releaseWeights) {
+        // the nodes of the graphs keep their own copies of the weights
+        releaseWeights(network);
+        releaseWeights(*clonedNetwork);
+        weightsReleased = true;
+    }
+}
+
+void MKLDNNExecNetwork::TrimImpl(bool releaseWeights) {
+    for (auto &graph : graphs)
+        graph->Trim();
+    std::lock_guard<std::mutex> lock(reshapedGraphsMutex);
+    // the graphs of the other shapes are compiled again from the copy of the network on their next request
+    if (releaseWeights && !weightsReleased)
+        reshapedGraphs.clear();
+    for (auto &reshaped : reshapedGraphs)
+        reshaped.second->Trim();
+}
+
+void MKLDNNExecNetwork::GetMemoryFootprint(InferenceEngine::MemoryFootprint &footprint) {
+    footprint = InferenceEngine::MemoryFootprint();
+    std::unordered_set<const void *> countedWeights;
+    size_t loadWorkspace = 0;
+    auto addGraph = [&](const MKLDNNGraph::Ptr &graph) {
+        graph->GetMemoryFootprint(footprint, countedWeights);
+        loadWorkspace = std::max(loadWorkspace, graph->GetLoadWorkspaceSize());
+    };
+    for (auto &graph : graphs)
+        addGraph(graph);
+    {
+        std::lock_guard<std::mutex> lock(reshapedGraphsMutex);
+        for (auto &reshaped : reshapedGraphs)
+            addGraph(reshaped.second);
+    }
+
+    footprint.io = GetIOBytes();
+    // every request keeps its own input and output blobs
+    footprint.perRequest = footprint.io;
+    // the constants of a graph are computed in a separate workspace released once the graph is loaded
+    footprint.peak = footprint.weights + footprint.workspace + loadWorkspace;
+}
+
+void MKLDNNExecNetwork::GetMetrics(InferenceEngine::ExecutableNetworkMetrics &metrics) {
+    ExecutableNetworkThreadSafeDefault::GetMetrics(metrics);
+    // a graph per stream
+    metrics.streams = static_cast<unsigned int>(graphs.size());
+    metrics.optimalInferRequests = metrics.streams;
+    if (autoBatcher)
+        metrics.optimalInferRequests *= static_cast<unsigned int>(std::max(graphs[0]->getProperty().batchLimit, 1));
+}
+
+std::vector<InferenceEngine::IMemoryStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
+    // the state of a memory id combines the memory inputs of every graph
+    std::map<std::string, std::vector<MKLDNNNodePtr>> memoryInputs;
+    std::vector<std::string> ids;
+    for (auto &graph : graphs) {
+        for (auto &node : graph->GetNodes()) {
+            auto memoryInput = std::dynamic_pointer_cast<MKLDNNMemoryInputNode>(node);
+            if (!memoryInput || memoryInput->getChildEdges().empty())
+                continue;
+            if (memoryInputs.find(memoryInput->getId()) == memoryInputs.end())
+                ids.push_back(memoryInput->getId());
+            memoryInputs[memoryInput->getId()].push_back(node);
+        }
+    }
 
-    if (sts == Task::TS_ERROR) task->checkException();
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> states;
+    for (auto &id : ids)
+        states.push_back(std::make_shared<MKLDNNMemoryState>(id, memoryInputs[id]));
+    return states;
+}
+
+void MKLDNNExecNetwork::Export(const std::string &modelFileName) {
+    if (weightsReleased)
+        THROW_IE_EXCEPTION << "The network can not be exported, its weights were released after the load";
+    std::map<std::string, std::string> primitives;
+    for (auto &node : graphs[0]->GetNodes()) {
+        std::string type = node->getPrimitiveDescriptorType();
+        if (type != "unknown" && type != "undef")
+            primitives[node->getName()] = "cpu:" + type;
+    }
+
+    std::ofstream file(modelFileName, std::ios::out | std::ios::binary);
+    if (!file.is_open())
+        THROW_IE_EXCEPTION << "Cannot open file " << modelFileName << " for writing";
+    SerializeNetwork(*clonedNetwork, primitives, file);
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
-    if (graph)  // TODO: graph field cannot be empty
+    for (auto &graph : graphs)
         graph->setProperty(properties);
+    std::lock_guard<std::mutex> lock(reshapedGraphsMutex);
+    for (auto &reshaped : reshapedGraphs)
+        reshaped.second->setProperty(properties);
+}
+
+MKLDNNGraph::Ptr MKLDNNExecNetwork::GetGraph(const std::map<std::string, SizeVector> &inputShapes) {
+    InputsDataMap inputs;
+    clonedNetwork->getInputsInfo(inputs);
+    bool originalShapes = true;
+    for (auto &input : inputs) {
+        auto shape = inputShapes.find(input.first);
+        if (shape != inputShapes.end() && shape->second != input.second->getTensorDesc().getDims())
+            originalShapes = false;
+    }
+    if (originalShapes)
+        return graphs[0];
+
+    std::lock_guard<std::mutex> lock(reshapedGraphsMutex);
+    for (auto it = reshapedGraphs.begin(); it != reshapedGraphs.end(); it++) {
+        if (it->first == inputShapes) {
+            reshapedGraphs.splice(reshapedGraphs.begin(), reshapedGraphs, it);
+            return it->second;
+        }
+    }
+
+    Config cfg = graphs[0]->getProperty();
+    if (cfg.reshapeCacheSize <= 0)
+        THROW_IE_EXCEPTION << "The input shapes of the network cannot be changed without KEY_CPU_RESHAPE_CACHE_SIZE";
+
+    // the copy shares the weights with the original network, only the dimensions of the data are changed
+    auto reshapedNetwork = cloneNet(*clonedNetwork);
+    ResponseDesc resp;
+    if (reshapedNetwork->reshape(inputShapes, &resp) != OK)
+        THROW_IE_EXCEPTION << "Failed to reshape the network: " << resp.msg;
+
+    MKLDNNGraph::Ptr graph = std::make_shared<MKLDNNGraph>();
+    graph->setConfig(cfg);
+    graph->CreateGraph(*reshapedNetwork, extensionManager);
+
+    reshapedGraphs.emplace_front(inputShapes, graph);
+    if (reshapedGraphs.size() > static_cast<size_t>(cfg.reshapeCacheSize))
+        reshapedGraphs.pop_back();
+    return graph;
 }
 
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
     auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor,
-                                                                      _taskSynchronizer, _callbackExecutor);
+                                                                      _taskSynchronizer, _callbackExecutor,
+                                                                      autoBatcher);
+    asyncRequestImpl->SetPriority(_requestPriority);
+    // the batched requests are pre-processed within the inference, there is no pre-processing executor for them
+    asyncRequestImpl->SetPreprocessExecutor(_preprocessExecutor);
+    asyncRequestImpl->SetLatencySpin(graphs[0]->getProperty().latencySpin);
     asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
                        [](IInferRequest *p) { p->Release(); });
 
     asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
+    registerRequest(asyncRequest, asyncRequestImpl);
 
     auto mkldnnSyncRequest = dynamic_cast<MKLDNNInferRequest *>(syncRequestImpl.get());
     if (!mkldnnSyncRequest)
         THROW_IE_EXCEPTION << " Cannot get mkldnn sync request.";
-    mkldnnSyncRequest->SetGraph(graph);
+    mkldnnSyncRequest->SetGraph(graphs[0]);
 }
 
 MKLDNNExecNetwork::~MKLDNNExecNetwork() {
-    graph.reset();
+    // the queued requests are executed with the graphs
+    autoBatcher.reset();
+    reshapedGraphs.clear();
+    graphs.clear();
     extensionManager.reset();
 }
@@ -9,7 +9,13 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <utility>
+#include <unordered_set>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cnn_network_impl.hpp>
 
 #include "mkldnn_memory.h"
 #include "config.h"
@@ -19,9 +25,15 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_arena.h"
+#include "mkldnn_memory_domain.h"
+#include "mkldnn_tiling.h"
 
 namespace MKLDNNPlugin {
 
+class MKLDNNMemoryOutputNode;
+class MKLDNNAutoBatcher;
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -31,7 +43,8 @@ public:
         Ready = 1,
     };
 
-    MKLDNNGraph(): status(NotReady), eng(mkldnn::engine(mkldnn::engine::kind::cpu, 0)) {}
+    MKLDNNGraph(): status(NotReady), eng(mkldnn::engine(mkldnn::engine::kind::cpu, 0)),
+                   arena(std::make_shared<MKLDNNArena>()) {}
 
     Status GetStatus() {
         return status;
@@ -55,9 +68,72 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
-    void PullOutputData(InferenceEngine::BlobMap &out);
+    /**
+     * @brief Copies the outputs of the graph to the blobs
+     * @param executed - the nodes executed by Infer (see GetOutputsMask), the outputs of the others are not copied
+     */
+    void PullOutputData(InferenceEngine::BlobMap &out, const std::vector<bool> *executed = nullptr);
+
+    /**
+     * @brief Executes the graph
+     * @param batch - the dynamic batch or -1 for the batch of the graph
+     * @param counters - the per node statistics of the infer request, the ones of the graph if nullptr
+     * @param executed - the mask of the nodes by their execution index (see GetOutputsMask), all of them if nullptr
+     */
+    void Infer(int batch = -1, PerfCounters *counters = nullptr, const std::vector<bool> *executed = nullptr);
+
+    /**
+     * @brief Fills the mask of the nodes the outputs depend on by their execution index, Infer skips the others
+     * @param outputs - the names of the outputs of the network
+     */
+    void GetOutputsMask(const std::vector<std::string> &outputs, std::vector<bool> &mask) const;
+
+    /**
+     * @brief Sets the partitioning of the inputs the graph was compiled for (see MKLDNNGraphTiling)
+     */
+    void setTiling(const MKLDNNGraphTiling::Ptr &graphTiling) {
+        tiling = graphTiling;
+    }
+
+    /**
+     * @brief Sets the cpus of the thread team of the network (see getTeamCpus), empty keeps the team of the plugin
+     */
+    void setTeamCpus(const std::vector<unsigned> &cpus) {
+        teamCpus = cpus;
+    }
+
+    /**
+     * @brief Returns true if the graph is compiled for a tile of the inputs, it is executed with InferTiles then
+     */
+    bool IsTiled() const {
+        return tiling != nullptr;
+    }
+
+    /**
+     * @brief Executes the graph compiled for a tile over the whole inputs and stitches the outputs
+     * @param inputs - the input blobs of the network dimensions
+     * @param outputs - the output blobs of the network dimensions
+     * @param counters - the per node statistics of the infer request, the ones of the graph if nullptr
+     * @param tilePool - the blobs of the tiles kept by the infer request, so they are allocated once per request
+     */
+    void InferTiles(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &outputs,
+                    PerfCounters *counters, MKLDNNBlobPool &tilePool);
+
+    /**
+     * @brief Returns true if the output is converted on the way to its blob (the FP16 outputs and the ones of
+     * KEY_CPU_ARGMAX_OUTPUTS), so the blob can not be bound to the memory of the graph
+     */
+    bool IsConvertedOutput(const std::string &name) const {
+        return convertedOutputs.find(name) != convertedOutputs.end();
+    }
 
-    void Infer(int batch = -1);
+    /**
+     * @brief Returns the mutex serializing the inferences run on the calling threads (see KEY_CPU_LATENCY_SPIN)
+     * with the ones run by the executor
+     */
+    std::mutex& GetInferMutex() {
+        return *inferMutex;
+    }
 
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
@@ -75,7 +151,36 @@ public:
         return eng;
     }
 
-    void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
+    /**
+     * @brief Creates the edge in the arena of the graph, the edge is not added to the graph
+     */
+    MKLDNNEdgePtr CreateEdge(const MKLDNNNodePtr& parent, const MKLDNNNodePtr& child) {
+        return std::allocate_shared<MKLDNNEdge>(MKLDNNArenaAllocator<MKLDNNEdge>(arena), parent, child);
+    }
+
+    void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap,
+                     const PerfCounters *counters = nullptr) const;
+
+    /**
+     * @brief Adds the weights and the workspace of the graph to the footprint
+     * @param countedWeights - the data of the weights counted already, the graphs of the streams may share them
+     */
+    void GetMemoryFootprint(InferenceEngine::MemoryFootprint &footprint,
+                            std::unordered_set<const void *> &countedWeights) const;
+
+    /**
+     * @brief Returns the pages of the workspace of the idle graph to the system. The constant data and the states of
+     * the Memory layers are saved aside, the next Infer copies them back and the other pages are allocated again as
+     * they are touched. The workspace shared through KEY_CPU_MEMORY_DOMAIN is kept.
+     */
+    void Trim();
+
+    /**
+     * @brief Returns the size of the workspace of the constant nodes, which is used while the graph is loaded only
+     */
+    size_t GetLoadWorkspaceSize() const {
+        return loadWorkspaceSize;
+    }
 
 protected:
     MKLDNNNodePtr FindNodeWithName(const std::string& name) const;
@@ -89,30 +194,89 @@ protected:
         inputNodes.clear();
         outputNodes.clear();
         graphNodes.clear();
+        executableNodes.clear();
+        outputDependencies.clear();
         graphEdges.clear();
+        parallelLevels.clear();
+        swappingMemoryNodes.clear();
         _meanImages.clear();
+        convertedOutputs.clear();
+        // the memory of the old arena is freed when the last object allocated from it is gone
+        arena = std::make_shared<MKLDNNArena>();
     }
     Status status;
     Config config;
 
     MKLDNNMemoryPtr memWorkspace;
+    // the data passed between the constant nodes, it is released when the constants are computed
+    MKLDNNMemoryPtr memLoadWorkspace;
+    // the workspace of the non-constant data shared with the other graphs of the memory domain
+    MKLDNNMemoryDomain::Ptr memDomain;
+    std::shared_ptr<void> sharedWorkspace;
+    // the sizes of the workspaces in bytes, the shared one is counted in the workspace size
+    size_t workspaceSize = 0;
+    size_t loadWorkspaceSize = 0;
+    // the offsets and the sizes (in floats) of the persistent data in the private workspace (see Trim)
+    std::vector<std::pair<size_t, size_t>> persistentRanges;
+    // the persistent data saved while the graph is trimmed, held by pointer so that the graph stays assignable
+    struct TrimState {
+        std::vector<float> data;
+        std::atomic<bool> trimmed{false};
+        std::mutex mutex;
+    };
+    std::shared_ptr<TrimState> trimState = std::make_shared<TrimState>();
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
+    // the non constant nodes in the execution order, the ones Infer executes
+    std::vector<MKLDNNNodePtr> executableNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
+    // the non constant nodes grouped by execution levels, filled in CPU_PARALLEL_BRANCHES mode only
+    std::vector<std::vector<MKLDNNNodePtr>> parallelLevels;
+    // the nodes every output depends on by their execution index, the memory outputs and their inputs included
+    std::map<std::string, std::vector<bool>> outputDependencies;
+    // the memory outputs exchanging the state buffers with their input siblings after every inference
+    std::vector<std::shared_ptr<MKLDNNMemoryOutputNode>> swappingMemoryNodes;
 
     std::map<std::string, MeanImage> _meanImages;
+    // the descriptors of the output blobs differing from the FP32 memory of the graph outputs: FP16 outputs and
+    // the argmax of the channels (see KEY_CPU_ARGMAX_OUTPUTS), PullOutputData converts the data on the way
+    std::map<std::string, InferenceEngine::TensorDesc> convertedOutputs;
+    // the partitioning of the inputs (see KEY_CPU_BATCH_TILE, KEY_CPU_SPATIAL_TILES), nullptr for the whole inputs
+    MKLDNNGraphTiling::Ptr tiling;
+    // the cpus of the thread team of the network (see KEY_CPU_THREADS_NUM, KEY_CPU_CORES), empty for the plugin team
+    std::vector<unsigned> teamCpus;
+    // held by pointer so that the graph stays assignable
+    std::shared_ptr<std::mutex> inferMutex = std::make_shared<std::mutex>();
+
+    // the statistics of the inferences executed without the counters of a request
+    PerfCounters perfCounters;
 
     mkldnn::engine eng;
 
+    // the storage of the edges of the graph
+    MKLDNNArena::Ptr arena;
+
     void InitNodes();
     void InitEdges();
+    void MergeReorders();
     void Allocate();
     void AllocateWithReuse();
+    // copies the persistent data back to the workspace of the trimmed graph
+    void RestoreTrimmed();
     void CreatePrimitives();
+    void FoldConstants();
+    void InitMemoryStates();
+    void SwapMemoryStates();
+    void WarmUp();
+    void CalculateOutputDependencies();
+    void CalculateExecutionLevels();
+    void ExecuteLevel(const std::vector<MKLDNNNodePtr>& level, mkldnn::stream& stream, int batch,
+                      PerfCounters& counters, const std::vector<bool> *executed);
 
     friend class MKLDNNInferRequest;
+    friend class MKLDNNGraphOptimizer;
 
 private:
     struct ParsedLayer {
@@ -122,6 +286,9 @@ private:
     };
     void ParseNode(const InferenceEngine::CNNLayerPtr& cnnLayer, MKLDNNNodePtr& parent,
                    const MKLDNNExtensionManager::Ptr& extMgr, size_t outIdx, std::vector<ParsedLayer>& layers);
+    // converts the FP32 memory of the first samples of the output to the blob of the converted output descriptor
+    void PullConvertedOutput(const MKLDNNMemory &intr_blob, const InferenceEngine::TensorDesc &desc,
+                             const InferenceEngine::Blob::Ptr &ext_blob, int samples);
 };
 
 
@@ -141,11 +308,59 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    /**
+     * @brief Exports the network, so it can be loaded with IInferencePlugin::ImportNetwork.
+     * Together with the topology and the weights the implementation selected for every layer is saved,
+     * so the imported network is executed by the same primitives.
+     * @param modelFileName - path to the file to write
+     */
+    void Export(const std::string &modelFileName) override;
+
+    /**
+     * @brief Returns the states of the Memory layers, a state is shared by all the streams of the network
+     */
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
+
+    /**
+     * @brief Returns the memory of the graphs of all the streams and the reshaped inputs. The workspace shared through
+     * KEY_CPU_MEMORY_DOMAIN is counted by every network of the domain.
+     */
+    void GetMemoryFootprint(InferenceEngine::MemoryFootprint &footprint) override;
+
+    /**
+     * @brief Reports a request per stream, the auto-batching takes a request per sample of the batch of every stream
+     */
+    void GetMetrics(InferenceEngine::ExecutableNetworkMetrics &metrics) override;
+
+    /**
+     * @brief Returns the graph compiled for the given input shapes (see KEY_CPU_RESHAPE_CACHE_SIZE).
+     * The graph of the original shapes is graphs[0], the graphs of the other shapes are compiled on the first request
+     * and the least recently used of them is dropped when there are more than the configured number.
+     * @param inputShapes - the dimensions of every input of the network
+     */
+    MKLDNNGraph::Ptr GetGraph(const std::map<std::string, InferenceEngine::SizeVector> &inputShapes);
+
 protected:
-    MKLDNNGraph::Ptr graph;
+    // the copy of the original network, the source for Export
+    InferenceEngine::details::CNNNetworkImplPtr clonedNetwork;
+    // the weights of the network are dropped after the load (see KEY_RELEASE_WEIGHTS), so it can not be exported
+    bool weightsReleased = false;
+    // one graph per stream (see KEY_CPU_THROUGHPUT_STREAMS), the graphs[0] is also used to resolve blobs
+    std::vector<MKLDNNGraph::Ptr> graphs;
     MKLDNNExtensionManager::Ptr extensionManager;
+    // the graphs compiled for the reshaped inputs, the most recently used are first
+    std::list<std::pair<std::map<std::string, InferenceEngine::SizeVector>, MKLDNNGraph::Ptr>> reshapedGraphs;
+    std::mutex reshapedGraphsMutex;
+    // executes the concurrent async requests as one dynamic batch (see KEY_CPU_AUTO_BATCH_TIMEOUT)
+    std::shared_ptr<MKLDNNAutoBatcher> autoBatcher;
 
     bool CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const;
+
+    /**
+     * @brief Trims the graphs of all the streams and of the reshaped inputs, with releaseWeights the reshaped ones are
+     * dropped from the cache unless the weights of the network were released on load
+     */
+    void TrimImpl(bool releaseWeights) override;
 };
 
 }  // namespace MKLDNNPlugin
@@ -7,10 +7,20 @@
 #include <list>
 #include <memory>
 #include <set>
+#include <vector>
+#include <functional>
+#include <algorithm>
 #include <nodes/mkldnn_activation_node.h>
 #include "mkldnn_graph_optimizer.h"
 #include "nodes/mkldnn_pooling_node.h"
 #include "nodes/mkldnn_eltwise_node.h"
+#include "nodes/mkldnn_eltwise_chain_node.h"
+#include "nodes/mkldnn_inverted_residual_node.h"
+#include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_gemm_node.h"
+#include "nodes/mkldnn_gather_node.h"
+#include "mkldnn_channel_affine.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -19,27 +29,148 @@ using namespace InferenceEngine;
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
 void MKLDNNGraphOptimizer::Optimize(MKLDNNGraph &graph) {
+    FoldMeanValuesIntoConvolution(graph);
+    FeedU8InputsToConvolutions(graph);
+    RemoveDropped(graph);
+
     MergeGroupConvolution(graph);
     RemoveDropped(graph);
 
+    FoldChannelAffineIntoWeights(graph);
+    RemoveDropped(graph);
+
     FuseConvolutionAndActivation(graph);
     RemoveDropped(graph);
 
+    FuseFullyConnectedAndActivation(graph);
+    RemoveDropped(graph);
+
+    FusePoolingAndActivation(graph);
+    RemoveDropped(graph);
+
+    FuseGemmTransposesAndScale(graph);
+    RemoveDropped(graph);
+
+    FuseGatherAndBagPooling(graph);
+    RemoveDropped(graph);
+
+    FuseInvertedResiduals(graph);
+    RemoveDropped(graph);
+
     FuseConvolutionAndDWConvolution(graph);
     RemoveDropped(graph);
 
+    FuseInt8Requantization(graph);
+    RemoveDropped(graph);
+
     FuseBatchNormWithScale(graph);
     RemoveDropped(graph);
 
     RemoveIdentityOperator(graph);
     RemoveDropped(graph);
 
+    FuseElementwiseChains(graph);
+    RemoveDropped(graph);
+
     FuseConvolutionSumAndConvolutionSumActivation(graph);
     RemoveDropped(graph);
 
     RemoveDroppedEdges(graph);
 }
 
+void MKLDNNGraphOptimizer::FoldMeanValuesIntoConvolution(MKLDNNGraph &graph) {
+    for (auto input = graph._meanImages.begin(); input != graph._meanImages.end();) {
+        auto inputNode = graph.inputNodes.find(input->first);
+        const std::vector<float> &meanValues = input->second.getMeanValues();
+        if (meanValues.empty() || inputNode == graph.inputNodes.end() || !canFoldMeanValues(inputNode->second)) {
+            input++;
+            continue;
+        }
+
+        auto conv = inputNode->second->getChildEdgeAt(0)->getChild();
+        dynamic_cast<MKLDNNConvolutionNode *>(conv.get())->setInputMean(meanValues);
+        // the input is pushed as is, so it keeps its precision
+        input = graph._meanImages.erase(input);
+    }
+}
+
+bool MKLDNNGraphOptimizer::canFoldMeanValues(const MKLDNNNodePtr &input) {
+    // the mean is subtracted from the padded borders as well, so the convolution has to be without padding
+    if (input->getChildEdges().size() != 1)
+        return false;
+
+    auto conv = input->getChildEdgeAt(0)->getChild();
+    auto* convNode = dynamic_cast<MKLDNNConvolutionNode *>(conv.get());
+    if (conv->getType() != Convolution || !convNode || convNode->isInt8Convolution() || !conv->fusedWith.empty() ||
+            !conv->getMergeWith().empty() || conv->getParentEdges().size() != 1 || conv->getChildEdges().empty())
+        return false;
+
+    auto* convLayer = dynamic_cast<ConvolutionLayer *>(conv->getCnnLayer().get());
+    if (!convLayer || convLayer->_weights == nullptr || convLayer->_weights->precision() != Precision::FP32 ||
+            (convLayer->_biases != nullptr && convLayer->_biases->size() != 0 &&
+             convLayer->_biases->precision() != Precision::FP32))
+        return false;
+
+    auto srcDims = conv->getParentEdgeAt(0)->getDims();
+    auto dstDims = conv->getChildEdgeAt(0)->getDims();
+    if (srcDims.ndims() != 4 || dstDims.ndims() != 4 || convLayer->_padding_x != 0 || convLayer->_padding_y != 0)
+        return false;
+
+    // the output is not larger than the input without the padding (the right padding is zero too)
+    int kernel[] = {static_cast<int>(convLayer->_kernel_y), static_cast<int>(convLayer->_kernel_x)};
+    int stride[] = {static_cast<int>(convLayer->_stride_y), static_cast<int>(convLayer->_stride_x)};
+    int dilation[] = {static_cast<int>(convLayer->_dilation_y), static_cast<int>(convLayer->_dilation_x)};
+    for (int i = 0; i < 2; i++) {
+        int src = srcDims[2 + i];
+        int krn = (kernel[i] - 1) * std::max(dilation[i], 1) + 1;
+        if (stride[i] <= 0 || src < krn || dstDims[2 + i] != (src - krn) / stride[i] + 1)
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNGraphOptimizer::FeedU8InputsToConvolutions(MKLDNNGraph &graph) {
+    for (auto &input : graph.inputNodes) {
+        auto* inputNode = dynamic_cast<MKLDNNInputNode *>(input.second.get());
+        if (!inputNode || graph._meanImages.find(input.first) != graph._meanImages.end() ||
+                input.second->getCnnLayer()->outData[0]->getPrecision() != Precision::U8 ||
+                input.second->getChildEdges().size() != 1)
+            continue;
+
+        auto child = input.second->getChildEdgeAt(0)->getChild();
+        auto* convNode = dynamic_cast<MKLDNNConvolutionNode *>(child.get());
+        if (convNode && child->getType() == Convolution && !convNode->isInt8Convolution()) {
+            // mkldnn has no FP32 convolution of the U8 source, the input converts it while it is pushed
+            inputNode->withFP32Output();
+            continue;
+        }
+
+        // the ScaleShift of a calibrated network quantizing the input for the int8 convolution: the U8 input is
+        // quantized already, the convolution reads it as is and scales the accumulators instead
+        if (child->getType() != Depthwise || child->getCnnLayer()->type != "ScaleShift" ||
+                child->getChildEdges().size() != 1 || !child->fusedWith.empty())
+            continue;
+        auto conv = child->getChildEdgeAt(0)->getChild();
+        convNode = dynamic_cast<MKLDNNConvolutionNode *>(conv.get());
+        if (!convNode || conv->getType() != Convolution || !convNode->isInt8Convolution() ||
+                conv->getParentEdges().size() != 1 || !conv->getMergeWith().empty())
+            continue;
+
+        size_t channels = child->getChildEdgeAt(0)->getDims()[1];
+        if (!MKLDNNChannelAffine::canFold(*child->getCnnLayer(), channels))
+            continue;
+        MKLDNNChannelAffine affine({child}, channels);
+        float scale = affine.scale[0];
+        // a scale over 1 saturates the quantized input, which the convolution would not do
+        if (affine.hasShift() || scale <= 0.f || scale > 1.f ||
+                std::any_of(affine.scale.begin(), affine.scale.end(), [&](float s) { return s != scale; }))
+            continue;
+
+        convNode->setInputScale(scale);
+        DropNode(graph, child);
+    }
+}
+
 void MKLDNNGraphOptimizer::MergeGroupConvolution(MKLDNNGraph &graph) {
     for (auto node : graph.GetNodes()) {
         // Split with at least 2 Convolutions
@@ -118,6 +249,68 @@ void MKLDNNGraphOptimizer::FuseBatchNormWithScale(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FoldChannelAffineIntoWeights(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isFP32Blob = [](const Blob::Ptr &blob, size_t size) {
+        return blob == nullptr || blob->size() == 0 ||
+               (blob->precision() == Precision::FP32 && (size == 0 || blob->size() == size));
+    };
+
+    // the channels of the output of the layers folding the ScaleShift and BatchNormalization into the weights
+    auto foldingChannels = [&](const MKLDNNNodePtr &node) -> size_t {
+        auto* weightable = dynamic_cast<WeightableLayer *>(node->getCnnLayer().get());
+        if (!weightable || weightable->_weights == nullptr || !node->getMergeWith().empty())
+            return 0;
+        switch (node->getType()) {
+            case Convolution: {
+                auto* convNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get());
+                auto* convLayer = dynamic_cast<ConvolutionLayer *>(weightable);
+                if (!convNode || convNode->isInt8Convolution() || !convLayer ||
+                        !isFP32Blob(convLayer->_weights, 0) || !isFP32Blob(convLayer->_biases, 0))
+                    return 0;
+                return convLayer->_out_depth;
+            }
+            case Deconvolution: {
+                auto* deconvLayer = dynamic_cast<DeconvolutionLayer *>(weightable);
+                if (!deconvLayer || !isFP32Blob(deconvLayer->_weights, 0) ||
+                        !isFP32Blob(deconvLayer->_biases, deconvLayer->_out_depth))
+                    return 0;
+                return deconvLayer->_out_depth;
+            }
+            case FullyConnected: {
+                // the compressed weights fold the layers into their scales
+                auto* fcLayer = dynamic_cast<FullyConnectedLayer *>(weightable);
+                Precision precision = weightable->_weights->precision();
+                if (!fcLayer || (precision != Precision::FP32 && precision != Precision::FP16 &&
+                                 precision != Precision::I8))
+                    return 0;
+                return fcLayer->_out_num;
+            }
+            default:
+                return 0;
+        }
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto node = graphNodes[i];
+        if (!node->getCnnLayer() || !node->fusedWith.empty())
+            continue;
+        size_t channels = foldingChannels(node);
+        if (channels == 0)
+            continue;
+
+        // a chain of them, e.g. BatchNormalization followed by ScaleShift, is folded at once
+        while (node->getChildEdges().size() == 1) {
+            auto child = node->getChildEdgeAt(0)->getChild();
+            if (!MKLDNNChannelAffine::isFolded(child) || !MKLDNNChannelAffine::canFold(*child->getCnnLayer(), channels))
+                break;
+            node->fuseWith(child);
+            DropNode(graph, child);
+        }
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndActivation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -169,11 +362,190 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndActivation(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndActivation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isFusingSupported = [&](MKLDNNNodePtr node) {
+        if (!node->getCnnLayer())
+            return false;
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+
+        return activationNode &&
+               (activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_relu           ||
+                activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_elu            ||
+                activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_logistic       ||
+                activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_bounded_relu   ||
+                activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_clamp);
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto fc = graphNodes[i];
+        if (fc->getType() != FullyConnected || fc->getChildEdges().size() != 1 ||
+                !std::all_of(fc->fusedWith.begin(), fc->fusedWith.end(), MKLDNNChannelAffine::isFolded))
+            continue;
+
+        auto activation = fc->getChildEdgeAt(0)->getChild();
+        if (isFusingSupported(activation)) {
+            fc->fuseWith(activation);
+            DropNode(graph, activation);
+        }
+    }
+}
+
+void MKLDNNGraphOptimizer::FusePoolingAndActivation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto pool = graphNodes[i];
+        if (pool->getType() != Pooling || !pool->fusedWith.empty() || pool->getChildEdges().size() != 1 ||
+                !pool->getCnnLayer())
+            continue;
+
+        // the int8 data passes through the pooling as is, the activation runs on FP32 only
+        if (pool->getCnnLayer()->outData[0]->getPrecision() != Precision::FP32)
+            continue;
+
+        auto activation = pool->getChildEdgeAt(0)->getChild();
+        if (activation->getType() == Activation && activation->getCnnLayer() &&
+                dynamic_cast<MKLDNNActivationNode *>(activation.get())) {
+            pool->fuseWith(activation);
+            DropNode(graph, activation);
+        }
+    }
+}
+
+/**
+ *  The attention of the transformers multiplies the matrices transposed by Permutes and scales the product before
+ *  the SoftMax. The Permutes swapping the two innermost dimensions of the inputs and of the output of Gemm are
+ *  dropped, Gemm reads and writes the matrices transposed. The Power scaling the product is folded into alpha and beta.
+ *
+ *  Before:
+ *      [Permute ->] Gemm [-> Power (scale)] [-> Permute]
+ *  After:
+ *      Gemm
+ */
+void MKLDNNGraphOptimizer::FuseGemmTransposesAndScale(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isInnerTranspose = [](const MKLDNNNodePtr &node) {
+        if (node->getType() != Permute || !node->getCnnLayer() || node->getParentEdges().size() != 1 ||
+                node->getChildEdges().size() != 1)
+            return false;
+        std::vector<int> order = node->getCnnLayer()->GetParamAsInts("order");
+        size_t rank = order.size();
+        if (rank < 2)
+            return false;
+        for (size_t i = 0; i + 2 < rank; i++) {
+            if (order[i] != static_cast<int>(i))
+                return false;
+        }
+        return order[rank - 2] == static_cast<int>(rank - 1) && order[rank - 1] == static_cast<int>(rank - 2);
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto gemm = graphNodes[i];
+        auto* gemmNode = dynamic_cast<MKLDNNGemmNode *>(gemm.get());
+        if (!gemmNode || gemm->getType() != Gemm)
+            continue;
+
+        for (size_t input = 0; input < 2 && input < gemm->getParentEdges().size(); input++) {
+            auto permute = gemm->getParentEdgeAt(input)->getParent();
+            if (!isInnerTranspose(permute))
+                continue;
+            // the source of the Permute feeding the Gemm directly as well would have two edges to it
+            auto source = permute->getParentEdgeAt(0)->getParent();
+            bool feedsGemm = false;
+            for (size_t j = 0; j < gemm->getParentEdges().size(); j++)
+                feedsGemm |= gemm->getParentEdgeAt(j)->getParent() == source;
+            if (feedsGemm)
+                continue;
+
+            gemm->inDims[input] = permute->inDims[0];
+            gemmNode->fuseInputTranspose(input);
+            DropNode(graph, permute);
+        }
+
+        if (gemm->getChildEdges().size() != 1)
+            continue;
+        auto power = gemm->getChildEdgeAt(0)->getChild();
+        auto* powerLayer = dynamic_cast<PowerLayer *>(power->getCnnLayer().get());
+        if (power->getType() == Power && powerLayer && powerLayer->power == 1.0f && powerLayer->offset == 0.0f) {
+            gemmNode->fuseScale(powerLayer->scale);
+            DropNode(graph, power);
+        }
+
+        if (gemm->getChildEdges().size() != 1)
+            continue;
+        auto permute = gemm->getChildEdgeAt(0)->getChild();
+        if (isInnerTranspose(permute)) {
+            gemm->outDims[0] = permute->outDims[0];
+            gemmNode->fuseOutputTranspose();
+            DropNode(graph, permute);
+        }
+    }
+}
+
+/**
+ *  The embedding bag gathers the rows of the dictionary for the indices [N, 1, L] and averages (or sums up) the L rows
+ *  of every bag. The IR has it as the average Pooling over the L gathered rows, the sum is the average scaled by L.
+ *  Gather pools the rows while it reads them, the [N, 1, L, D] gathered rows are never written.
+ *
+ *  Before:
+ *      Gather -> Pooling (avg, kernel L x 1) [-> Power (scale L)]
+ *  After:
+ *      Gather (bag pooling)
+ */
+void MKLDNNGraphOptimizer::FuseGatherAndBagPooling(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto gather = graphNodes[i];
+        auto* gatherNode = dynamic_cast<MKLDNNGatherNode *>(gather.get());
+        auto* gatherLayer = dynamic_cast<GatherLayer *>(gather->getCnnLayer().get());
+        if (!gatherNode || !gatherLayer || gather->getType() != Gather || gather->getChildEdges().size() != 1)
+            continue;
+
+        // the rows of the dictionary are gathered along its outer axis into [N, 1, L, D]
+        auto dictDims = gather->inDims[0];
+        auto outDims = gather->outDims[0];
+        if ((gatherLayer->axis != 0 && gatherLayer->axis != -dictDims.ndims()) || dictDims.ndims() != 2 ||
+                outDims.ndims() != 4 || outDims[1] != 1)
+            continue;
+
+        auto pooling = gather->getChildEdgeAt(0)->getChild();
+        auto* poolingLayer = dynamic_cast<PoolingLayer *>(pooling->getCnnLayer().get());
+        if (pooling->getType() != Pooling || !poolingLayer || poolingLayer->_type != PoolingLayer::AVG)
+            continue;
+        int bagSize = outDims[2];
+        if (poolingLayer->_kernel_y != static_cast<unsigned int>(bagSize) || poolingLayer->_kernel_x != 1 ||
+                poolingLayer->_padding_y != 0 || poolingLayer->_padding_x != 0 || pooling->outDims[0][2] != 1)
+            continue;
+
+        gather->outDims[0] = pooling->outDims[0];
+        gatherNode->fuseBagPooling(true);
+        DropNode(graph, pooling);
+
+        if (gather->getChildEdges().size() != 1)
+            continue;
+        auto power = gather->getChildEdgeAt(0)->getChild();
+        auto* powerLayer = dynamic_cast<PowerLayer *>(power->getCnnLayer().get());
+        if (power->getType() == Power && powerLayer && powerLayer->power == 1.0f && powerLayer->offset == 0.0f &&
+                powerLayer->scale == static_cast<float>(bagSize)) {
+            gatherNode->fuseBagPooling(false);
+            DropNode(graph, power);
+        }
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isConvolutionNode = [](MKLDNNNodePtr node) {
-        return node->getType() == Convolution || node->getType() == Convolution_Activation;
+        auto* convolutionNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get());
+        // the fused depthwise convolution is fp32 and 2D only
+        return (node->getType() == Convolution || node->getType() == Convolution_Activation) &&
+               convolutionNode && !convolutionNode->isInt8Convolution() && node->inDims[0].ndims() == 4;
     };
 
     auto is1x1Convolution = [](ConvolutionLayer* layer) {
@@ -194,6 +566,12 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     auto isSutableChildConvolution = [](MKLDNNNodePtr node) {
         auto* layer = dynamic_cast<ConvolutionLayer*>(node->getCnnLayer().get());
 
+        // the fused depthwise convolution takes the original weights, so the fused ScaleShift would be lost
+        for (auto &fusedNode : node->fusedWith) {
+            if (fusedNode->getType() == Depthwise)
+                return false;
+        }
+
         bool isSupportedParams = layer->_out_depth == layer->_group &&
                                  layer->_kernel_x == 3 && layer->_kernel_y == 3 &&
                                  layer->_padding_x == 1 && layer->_padding_y == 1 &&
@@ -228,6 +606,235 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     }
 }
 
+/**
+ *  The inverted residual blocks of MobileNet v2 expand the channels 4-6 times, the expanded tensor of the first
+ *  blocks does not fit in L2 and is written and read back by the depthwise convolution. Such blocks run as one node
+ *  over the bands of the output rows, the expanded rows of a band stay in L2.
+ *
+ *  Before:
+ *      conv 1x1 [+ relu] -> dw conv 3x3 [+ relu] -> conv 1x1 [-> Eltwise sum with the input of the block]
+ *  After:
+ *      InvertedResidual
+ */
+void MKLDNNGraphOptimizer::FuseInvertedResiduals(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto onlyChild = [](const MKLDNNNodePtr &node) -> MKLDNNNodePtr {
+        return node->getChildEdges().size() == 1 ? node->getChildEdgeAt(0)->getChild() : nullptr;
+    };
+
+    auto isFusingWorthwhile = [](const MKLDNNNodePtr &expand) {
+        auto dims = expand->getChildEdgeAt(0)->getDims();
+        size_t expandedSize = static_cast<size_t>(dims[1]) * dims[2] * dims[3] * sizeof(float);
+        return expandedSize > mkldnn_get_cache_size(2, true);
+    };
+
+    // the parent edge of the Eltwise sum of two inputs which adds the other input to the projection
+    auto getResidualEdge = [](const MKLDNNNodePtr &sum, const MKLDNNNodePtr &project) -> MKLDNNEdgePtr {
+        auto* eltwiseLayer = dynamic_cast<EltwiseLayer *>(sum->getCnnLayer().get());
+        if (sum->getType() != Eltwise || !eltwiseLayer || eltwiseLayer->_operation != EltwiseLayer::Sum ||
+                sum->getParentEdges().size() != 2 || sum->getChildEdges().empty())
+            return nullptr;
+        for (auto coeff : eltwiseLayer->coeff) {
+            if (coeff != 1.0f)
+                return nullptr;
+        }
+        auto edge0 = sum->getParentEdgeAt(0);
+        auto edge1 = sum->getParentEdgeAt(1);
+        if (edge0->getParent() == project && edge1->getParent() != project)
+            return edge1->getDims() == edge0->getDims() ? edge1 : nullptr;
+        if (edge1->getParent() == project && edge0->getParent() != project)
+            return edge0->getDims() == edge1->getDims() ? edge0 : nullptr;
+        return nullptr;
+    };
+
+    size_t count = graphNodes.size();
+    for (size_t i = 0; i < count; i++) {
+        auto expand = graphNodes[i];
+        if (expand->isDropped() || !MKLDNNInvertedResidualNode::canFuse(expand, 0))
+            continue;
+        auto depthwise = onlyChild(expand);
+        if (!depthwise || !MKLDNNInvertedResidualNode::canFuse(depthwise, 1))
+            continue;
+        auto project = onlyChild(depthwise);
+        if (!project || !MKLDNNInvertedResidualNode::canFuse(project, 2) || !isFusingWorthwhile(expand))
+            continue;
+
+        auto sum = onlyChild(project);
+        MKLDNNEdgePtr residualEdge = sum ? getResidualEdge(sum, project) : nullptr;
+        if (!residualEdge)
+            sum.reset();
+        auto tail = sum ? sum : project;
+
+        MKLDNNNodePtr blockNode(new MKLDNNInvertedResidualNode(expand->getCnnLayer(), expand->getEngine()));
+        blockNode->fuseWith(expand);
+        blockNode->fuseWith(depthwise);
+        blockNode->fuseWith(project);
+        if (sum)
+            blockNode->fuseWith(sum);
+        blockNode->outDims = tail->outDims;
+
+        // the block takes the input of the expansion, the residual input of the sum and the consumers of the tail
+        auto inputEdge = expand->getParentEdgeAt(0);
+        MKLDNNEdgePtr newEdge = graph.CreateEdge(inputEdge->getParent(), blockNode);
+        graph.GetEdges().push_back(newEdge);
+        blockNode->addEdge(newEdge, 0, inputEdge->getInputNum());
+        if (sum) {
+            blockNode->inDims.push_back(residualEdge->getDims());
+            newEdge = graph.CreateEdge(residualEdge->getParent(), blockNode);
+            graph.GetEdges().push_back(newEdge);
+            blockNode->addEdge(newEdge, 1, residualEdge->getInputNum());
+        }
+        for (size_t j = 0; j < tail->getChildEdges().size(); j++) {
+            auto edge = tail->getChildEdgeAt(j);
+            newEdge = graph.CreateEdge(blockNode, edge->getChild());
+            graph.GetEdges().push_back(newEdge);
+            blockNode->addEdge(newEdge, edge->getOutputNum(), j);
+        }
+
+        expand->remove();
+        depthwise->remove();
+        project->remove();
+        if (sum)
+            sum->remove();
+        graphNodes.push_back(blockNode);
+    }
+}
+
+/**
+ *  CNNNetworkInt8Normalizer surrounds every int8 convolution with ScaleShift layers: the one before the
+ *  convolution quantizes its input and the one after it dequantizes the output. When the dequantized outputs
+ *  of int8 convolutions reach the next int8 convolution through poolings and channel concatenations only,
+ *  both ScaleShifts are folded into the output scales of the producers. The producers requantize their
+ *  results directly to the input range of the consumer, so the data between them stays in int8.
+ *
+ *  Before:
+ *      int8 conv+relu -> ScaleShift -> [Pooling | Concat]* -> ScaleShift -> int8 conv
+ *  After:
+ *      int8 conv+relu -> [Pooling | Concat]* -> int8 conv
+ */
+void MKLDNNGraphOptimizer::FuseInt8Requantization(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto getInt8Convolution = [](const MKLDNNNodePtr &node) -> MKLDNNConvolutionNode* {
+        auto* convolutionNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get());
+        return convolutionNode && convolutionNode->isInt8Convolution() ? convolutionNode : nullptr;
+    };
+
+    // per channel scales of a ScaleShift without shifts, positive scales commute with the poolings
+    auto getScales = [](const MKLDNNNodePtr &node, size_t channels, std::vector<float> &scales) {
+        if (node->getType() != Depthwise || node->getCnnLayer()->type != "ScaleShift" ||
+                node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            return false;
+
+        auto* layer = dynamic_cast<ScaleShiftLayer *>(node->getCnnLayer().get());
+        if (layer == nullptr || layer->_weights == nullptr || layer->_weights->precision() != Precision::FP32)
+            return false;
+        if (layer->_biases != nullptr) {
+            if (layer->_biases->precision() != Precision::FP32)
+                return false;
+            const float *shifts = layer->_biases->cbuffer().as<const float *>();
+            for (size_t c = 0; c < layer->_biases->size(); c++)
+                if (shifts[c] != 0.0f) return false;
+        }
+
+        const float *weights = layer->_weights->cbuffer().as<const float *>();
+        size_t size = layer->_weights->size();
+        if (size != channels && size != 1)
+            return false;
+        scales.resize(channels);
+        for (size_t c = 0; c < channels; c++) {
+            scales[c] = weights[size == 1 ? 0 : c];
+            if (scales[c] <= 0.0f) return false;
+        }
+        return true;
+    };
+
+    struct Producer {
+        MKLDNNConvolutionNode* convolution;
+        MKLDNNNodePtr scaleShift;
+        std::vector<float> scales;
+        size_t channelsOffset;
+    };
+
+    std::function<bool(const MKLDNNNodePtr&, size_t, std::vector<Producer>&, std::vector<MKLDNNNodePtr>&)> collect =
+            [&](const MKLDNNNodePtr &node, size_t channelsOffset, std::vector<Producer> &producers,
+                std::vector<MKLDNNNodePtr> &passThrough) {
+        if (node->getChildEdges().size() != 1 || node->getParentEdges().empty())
+            return false;
+
+        size_t channels = node->getChildEdgeAt(0)->getDims()[1];
+        Producer producer;
+        if (getScales(node, channels, producer.scales)) {
+            auto parent = node->getParentEdgeAt(0)->getParent();
+            producer.convolution = getInt8Convolution(parent);
+            // the requantized data have to be non-negative to fit the unsigned input of the consumer
+            if (producer.convolution == nullptr || parent->getChildEdges().size() != 1 ||
+                    producer.convolution->getInt8OutputDataType() != memory::u8 ||
+                    (producer.convolution->getOutputScales().size() != channels &&
+                     producer.convolution->getOutputScales().size() != 1))
+                return false;
+            producer.scaleShift = node;
+            producer.channelsOffset = channelsOffset;
+            producers.push_back(producer);
+            return true;
+        }
+
+        if (node->getType() == Pooling && node->getParentEdges().size() == 1) {
+            passThrough.push_back(node);
+            return collect(node->getParentEdgeAt(0)->getParent(), channelsOffset, producers, passThrough);
+        }
+
+        auto* concatLayer = dynamic_cast<ConcatLayer *>(node->getCnnLayer().get());
+        if (node->getType() == Concatenation && concatLayer && concatLayer->_axis == 1) {
+            passThrough.push_back(node);
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                auto parentEdge = node->getParentEdgeAt(i);
+                if (!collect(parentEdge->getParent(), channelsOffset, producers, passThrough))
+                    return false;
+                channelsOffset += parentEdge->getDims()[1];
+            }
+            return true;
+        }
+
+        return false;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto scaleShift = graphNodes[i];
+        if (scaleShift->isDropped() || scaleShift->getParentEdges().size() != 1 ||
+                scaleShift->getChildEdges().size() != 1)
+            continue;
+
+        std::vector<float> inputScales;
+        if (!getInt8Convolution(scaleShift->getChildEdgeAt(0)->getChild()) ||
+                !getScales(scaleShift, scaleShift->getChildEdgeAt(0)->getDims()[1], inputScales))
+            continue;
+
+        std::vector<Producer> producers;
+        std::vector<MKLDNNNodePtr> passThrough;
+        if (!collect(scaleShift->getParentEdgeAt(0)->getParent(), 0, producers, passThrough))
+            continue;
+
+        for (auto &producer : producers) {
+            std::vector<float> scales = producer.convolution->getOutputScales();
+            if (scales.size() == 1)
+                scales.resize(producer.scales.size(), scales[0]);
+            for (size_t c = 0; c < scales.size(); c++)
+                scales[c] *= producer.scales[c] * inputScales[producer.channelsOffset + c];
+            producer.convolution->setOutputScales(scales);
+            DropNode(graph, producer.scaleShift);
+        }
+        // the nodes in between take the precision of their data
+        for (auto &node : passThrough) {
+            for (auto &input : node->getCnnLayer()->insData)
+                input.lock()->setPrecision(Precision::U8);
+            node->getCnnLayer()->outData[0]->setPrecision(Precision::U8);
+        }
+        DropNode(graph, scaleShift);
+    }
+}
+
 /**
  *  Check if there is a data dependency between parent and child
  *  BFS starting from parent and comparing with child
@@ -332,7 +939,9 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
         auto sum = graphNode;
         auto lastNode = sum;
 
-        bool fuse_allowed = mergedConv->getChildEdges().size() == 1;
+        auto* mergedConvNode = dynamic_cast<MKLDNNConvolutionNode *>(mergedConv.get());
+        bool fuse_allowed = mergedConv->getChildEdges().size() == 1 &&
+                            mergedConvNode && !mergedConvNode->isInt8Convolution();
         for (size_t j = 0; fuse_allowed && j < mergedConv->getParentEdges().size(); j++)
             if (mergedConv->getParentEdgeAt(j)->getParent() == peerNode)
                 fuse_allowed = false;
@@ -360,7 +969,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
 
         mergedConv->fuseWith(lastNode);
 
-        MKLDNNEdgePtr edgePtr(new MKLDNNEdge(peerNode, mergedConv));
+        MKLDNNEdgePtr edgePtr = graph.CreateEdge(peerNode, mergedConv);
         graph.GetEdges().push_back(edgePtr);
 
         size_t childIdx = 0;
@@ -378,7 +987,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
             int idxParent = edgePtr->getOutputNum();
             int idxChild = edgePtr->getInputNum();
 
-            MKLDNNEdgePtr newEdge(new MKLDNNEdge(mergedConv, child));
+            MKLDNNEdgePtr newEdge = graph.CreateEdge(mergedConv, child);
             graph.GetEdges().push_back(newEdge);
             child->addEdge(newEdge, idxParent, idxChild);
         }
@@ -409,10 +1018,69 @@ void MKLDNNGraphOptimizer::RemoveIdentityOperator(MKLDNNGraph &graph) {
 
         if (node->getType() == Copy) toDrop = true;
 
+        if (node->getType() == Permute) {
+            std::vector<int> order = node->getCnnLayer()->GetParamAsInts("order");
+            toDrop = true;
+            for (size_t i = 0; i < order.size(); i++) {
+                if (order[i] != static_cast<int>(i)) toDrop = false;
+            }
+        }
+
         if (toDrop) DropNode(graph, node);
     }
 }
 
+void MKLDNNGraphOptimizer::FuseElementwiseChains(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // the next layer of the chain is the only consumer of the previous one
+    auto nextInChain = [](const MKLDNNNodePtr &node) -> MKLDNNNodePtr {
+        if (node->getChildEdges().size() != 1)
+            return nullptr;
+        auto child = node->getChildEdgeAt(0)->getChild();
+        return MKLDNNEltwiseChainNode::canChain(child) ? child : nullptr;
+    };
+
+    size_t count = graphNodes.size();
+    for (size_t i = 0; i < count; i++) {
+        auto head = graphNodes[i];
+        if (head->isDropped() || !MKLDNNEltwiseChainNode::canStartChain(head))
+            continue;
+        // the chain is built from its first layer
+        if (head->getParentEdges().size() == 1 &&
+                MKLDNNEltwiseChainNode::canStartChain(head->getParentEdgeAt(0)->getParent()) &&
+                nextInChain(head->getParentEdgeAt(0)->getParent()) == head)
+            continue;
+
+        std::vector<MKLDNNNodePtr> chain = {head};
+        for (auto next = nextInChain(head); next; next = nextInChain(next))
+            chain.push_back(next);
+        if (chain.size() < 2)
+            continue;
+
+        MKLDNNNodePtr chainNode(new MKLDNNEltwiseChainNode(head->getCnnLayer(), head->getEngine()));
+        for (auto &node : chain)
+            chainNode->fuseWith(node);
+        for (size_t j = 1; j < chain.size(); j++)
+            DropNode(graph, chain[j]);
+
+        // the chain takes the inputs of the first layer and the consumers of the last one
+        for (size_t j = 0; j < head->getParentEdges().size(); j++) {
+            auto edge = head->getParentEdgeAt(j);
+            MKLDNNEdgePtr newEdge = graph.CreateEdge(edge->getParent(), chainNode);
+            graph.GetEdges().push_back(newEdge);
+            chainNode->addEdge(newEdge, j, edge->getInputNum());
+        }
+        for (size_t j = 0; j < head->getChildEdges().size(); j++) {
+            auto edge = head->getChildEdgeAt(j);
+            MKLDNNEdgePtr newEdge = graph.CreateEdge(chainNode, edge->getChild());
+            graph.GetEdges().push_back(newEdge);
+            chainNode->addEdge(newEdge, edge->getOutputNum(), j);
+        }
+        graphNodes.push_back(chainNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::RemoveDropped(MKLDNNGraph& graph) {
     auto& nodes = graph.GetNodes();
 
@@ -475,7 +1143,7 @@ void MKLDNNGraphOptimizer::DropNode(MKLDNNGraph &graph, MKLDNNNodePtr &node) {
                 node->removeEdge(remEdge);
                 removeEdge(graph, remEdge);
             }
-            MKLDNNEdgePtr newEdge(new MKLDNNEdge(parent, child));
+            MKLDNNEdgePtr newEdge = graph.CreateEdge(parent, child);
             graph.GetEdges().push_back(newEdge);
             parent->addEdge(newEdge, outNum, inNum);
         }
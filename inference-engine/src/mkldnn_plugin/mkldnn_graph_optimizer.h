@@ -18,18 +18,29 @@ public:
     void Optimize(MKLDNNGraph& graph);
 
 private:
+    void FoldMeanValuesIntoConvolution(MKLDNNGraph& graph);
+    void FeedU8InputsToConvolutions(MKLDNNGraph& graph);
     void MergeGroupConvolution(MKLDNNGraph& graph);
+    void FoldChannelAffineIntoWeights(MKLDNNGraph &graph);
     void FuseConvolutionAndActivation(MKLDNNGraph &graph);
+    void FuseFullyConnectedAndActivation(MKLDNNGraph &graph);
+    void FusePoolingAndActivation(MKLDNNGraph &graph);
+    void FuseGemmTransposesAndScale(MKLDNNGraph &graph);
+    void FuseGatherAndBagPooling(MKLDNNGraph &graph);
+    void FuseInvertedResiduals(MKLDNNGraph &graph);
     void FuseConvolutionAndDWConvolution(MKLDNNGraph &graph);
+    void FuseInt8Requantization(MKLDNNGraph &graph);
     void FuseBatchNormWithScale(MKLDNNGraph& graph);
     void FuseConvolutionSumAndConvolutionSumActivation(MKLDNNGraph &graph);
     void RemoveIdentityOperator(MKLDNNGraph& graph);
+    void FuseElementwiseChains(MKLDNNGraph& graph);
     void RemoveDropped(MKLDNNGraph& graph);
     void RemoveDroppedEdges(MKLDNNGraph& graph);
 
     void DropNode(MKLDNNGraph& graph, MKLDNNNodePtr& node);
 
     bool IsOneOf(Type type, std::vector<Type> types);
+    bool canFoldMeanValues(const MKLDNNNodePtr &input);
 };
 
 }  // namespace MKLDNNPlugin
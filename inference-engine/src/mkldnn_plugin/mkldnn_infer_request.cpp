@@ -5,12 +5,17 @@
 
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
+#include <cstring>
 #include <vector>
 #include <string>
 #include <map>
+#include <mutex>
 #include <blob_factory.hpp>
+#include <precision_utils.h>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
+#include "mkldnn_streams.h"
+#include "mkldnn_memory_state.h"
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                                      InferenceEngine::OutputsDataMap networkOutputs)
@@ -28,7 +33,7 @@ template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std
         THROW_IE_EXCEPTION << "Input data was not allocated.";
     }
 
-    graph->PushInputData(inputName, inputBlob);
+    execGraph->PushInputData(inputName, inputBlob);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
@@ -37,12 +42,98 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         THROW_IE_EXCEPTION << "Network not loaded.";
     }
 
+    if (batchedResultReady) {
+        batchedResultReady = false;
+        auto exception = batchedException;
+        batchedException = nullptr;
+        if (exception)
+            std::rethrow_exception(exception);
+        return;
+    }
+
+    // Infer of the latency mode runs on the calling thread, so it may run the graph together with the executor
+    std::unique_lock<std::mutex> inferLock;
+    if (graph->getProperty().latencySpin > 0)
+        inferLock = std::unique_lock<std::mutex>(graph->GetInferMutex());
+
+    // in the throughput mode the request is executed on the graph of the stream (worker thread) it was scheduled to
+    auto streamGraph = MultiWorkerTaskExecutor::ptrContext.ptrGraph;
+    execGraph = streamGraph ? streamGraph : graph;
+    if (graph->getProperty().reshapeCacheSize > 0)
+        selectReshapedGraph();
+
     // execute input pre-processing.
     execDataPreprocessing();
 
     changeDefaultPtr();
-    // need to retain converted blobs until infer finish
-    std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
+    try {
+        if (execGraph->IsTiled()) {
+            if (!sequences.empty())
+                THROW_IE_EXCEPTION << "Sequence states cannot be inferred by the tiled network";
+            // the graph is compiled for a tile, it reads the windows of the input blobs and writes the output ones
+            execGraph->InferTiles(_inputs, _outputs, &perfCounters, tilePool);
+        } else {
+            const std::vector<bool> *executed = nullptr;
+            if (!requestedOutputs.empty()) {
+                if (maskGraph.lock() != execGraph) {
+                    execGraph->GetOutputsMask(requestedOutputs, outputsMask);
+                    maskGraph = execGraph;
+                }
+                executed = &outputsMask;
+            }
+
+            pushInputs();
+            if (sequences.empty()) {
+                execGraph->Infer(m_curBatch, &perfCounters, executed);
+            } else {
+                MKLDNNSequenceBinding binding(execGraph->graphNodes, sequences);
+                execGraph->Infer(m_curBatch, &perfCounters, executed);
+                binding.release(true);
+            }
+            execGraph->PullOutputData(_outputs, executed);
+        }
+    } catch (...) {
+        restoreDefaultPtr();
+        throw;
+    }
+    // the graph of the stream (or of the reshaped inputs) is shared by all the requests, so it must not keep
+    // pointers to the blobs of this request after the inference
+    if (streamGraph || execGraph != graph)
+        restoreDefaultPtr();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::selectReshapedGraph() {
+    std::map<std::string, InferenceEngine::SizeVector> inputShapes;
+    for (auto &input : _networkInputs)
+        inputShapes[input.first] = input.second->getTensorDesc().getDims();
+
+    auto exeNetwork = std::dynamic_pointer_cast<MKLDNNExecNetwork>(_exeNetwork);
+    if (!exeNetwork)
+        THROW_IE_EXCEPTION << "Cannot get the CPU executable network of the request.";
+    auto shapesGraph = exeNetwork->GetGraph(inputShapes);
+    if (shapesGraph != graph) {
+        // the edges of the original graph keep pointing to the blobs of the request otherwise
+        restoreDefaultPtr();
+    }
+    execGraph = shapesGraph;
+
+    // the output blobs follow the output shapes of the selected graph
+    InferenceEngine::BlobMap blobs;
+    execGraph->getOutputBlobs(blobs);
+    for (auto &blob : blobs) {
+        auto output = _networkOutputs.find(blob.first);
+        const InferenceEngine::TensorDesc &desc = blob.second->getTensorDesc();
+        if (output == _networkOutputs.end() || output->second->getTensorDesc().getDims() == desc.getDims())
+            continue;
+        output->second->setDims(desc.getDims());
+        // the buffer of the output is only reallocated for the shape larger than any before
+        _outputs[blob.first] = outputPool.get(blob.first, desc);
+        if (externalPtr.find(blob.first) != externalPtr.end())
+            externalPtr[blob.first] = _outputs[blob.first]->buffer();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::pushInputs() {
     for (auto input : _inputs) {
         if (!_networkInputs[input.first]) {
             THROW_IE_EXCEPTION <<
@@ -65,61 +156,54 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                 pushInput<float>(input.first, input.second);
                 break;
             case InferenceEngine::Precision::U16:
+                if (!MKLDNNMemory::IsDenseDesc(input.second->getTensorDesc()))
+                    THROW_IE_EXCEPTION << "The input " << input.first << " of precision U16 must be dense";
                 // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                        InferenceEngine::Precision::FP32,
-                        input.second->getTensorDesc().getLayout(), input.second->dims());
-                convertedInputs.push_back(iconv);
-                iconv->allocate();
+                iconv = convertedPool.get(input.first, InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32,
+                        input.second->getTensorDesc().getDims(), input.second->getTensorDesc().getLayout()));
                 in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
                 InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
                 pushInput<float>(input.first, iconv);
                 break;
+            case InferenceEngine::Precision::BF16:
+                if (!MKLDNNMemory::IsDenseDesc(input.second->getTensorDesc()))
+                    THROW_IE_EXCEPTION << "The input " << input.first << " of precision BF16 must be dense";
+                // the BF16 input is the upper halves of the FP32 values of the network input
+                iconv = convertedPool.get(input.first, InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32,
+                        input.second->getTensorDesc().getDims(), input.second->getTensorDesc().getLayout()));
+                InferenceEngine::PrecisionUtils::bf16tof32Arrays(iconv->buffer().as<float *>(),
+                        input.second->cbuffer().as<const short *>(), input.second->size());
+                pushInput<float>(input.first, iconv);
+                break;
             case InferenceEngine::Precision::I16:
-                if (graph->hasMeanImageFor(input.first)) {
+                if (graph->hasMeanImageFor(input.first) && MKLDNNMemory::IsDenseDesc(input.second->getTensorDesc())) {
                     // If a mean image exists, we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
+                    iconv = convertedPool.get(input.first, InferenceEngine::TensorDesc(
+                            InferenceEngine::Precision::FP32, input.second->getTensorDesc().getDims(),
+                            input.second->getTensorDesc().getLayout()));
                     in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
                     InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
                     pushInput<float>(input.first, iconv);
                 } else {
-                    // Instead we can send I16 directly
+                    // Instead we can send I16 directly, the view of a frame is converted while it is gathered
                     pushInput<int16_t>(input.first, input.second);
                 }
                 break;
             case InferenceEngine::Precision::U8:
-                if (graph->hasMeanImageFor(input.first)) {
-                    // If a mean image exists, we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
-                } else {
-                    // Instead we can send I8 directly
-                    pushInput<uint8_t>(input.first, input.second);
-                }
+                // the graph converts the blob to FP32 and subtracts the mean image (if any) in one pass
+                pushInput<uint8_t>(input.first, input.second);
                 break;
             default:
                 THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->precision();
         }
     }
-    graph->Infer(m_curBatch);
-    graph->PullOutputData(_outputs);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     if (!graph || !graph->IsReady())
         THROW_IE_EXCEPTION << "Graph is not ready!";
-    graph->GetPerfData(perfMap);
+    (execGraph ? execGraph : graph)->GetPerfData(perfMap, &perfCounters);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine::Blob::Ptr &data) {
@@ -150,10 +234,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             desc.setPrecision(_networkInputs[name]->getInputPrecision());
         }
 
-        _inputs[name] = make_blob_with_precision(desc);
+        _inputs[name] = make_blob_with_precision(desc, graph->getProperty().allocator);
         _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+        if (desc.getPrecision() == originPrecision && graph->_meanImages.find(name) == graph->_meanImages.end() &&
+                !graph->getProperty().batchLimit && !graph->IsTiled()) {
             externalPtr[name] = _inputs[name]->buffer();
         }
         data = _inputs[name];
@@ -170,10 +254,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             return;
         }
 
-        _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
-        _outputs[name]->allocate();
-        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
+        // the graph compiled for a tile has the outputs of the tile dimensions
+        if (graph->IsTiled() && _networkOutputs.find(name) != _networkOutputs.end())
+            desc = InferenceEngine::TensorDesc(desc.getPrecision(), _networkOutputs[name]->getTensorDesc().getDims(),
+                                               desc.getLayout());
+        // the outputs are resized with the reshaped inputs, so they are the views of the growing buffers
+        _outputs[name] = outputPool.get(name, desc);
+        // the blob of any precision of the graph memory is bound to it, the converted outputs are pulled
+        if (!graph->IsConvertedOutput(name) && !graph->getProperty().batchLimit && !graph->IsTiled()) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -195,25 +284,38 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
     InferenceEngine::DataPtr foundOutput;
     size_t dataSize = data->size();
     if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
-        // Only precision is checked for an input with ROI inside (resize algorithm was set for the input).
-        if (foundInput->getPreProcess().getResizeAlgorithm() != InferenceEngine::ResizeAlgorithm::NO_RESIZE) {
-            if (foundInput->getInputPrecision() != data->precision()) {
+        // Only precision is checked for an input with ROI inside (resize algorithm or color format was set
+        // for the input). Images of a color format are always U8.
+        const InferenceEngine::PreProcessInfo &preProcess = foundInput->getPreProcess();
+        if (preProcess.isPreProcessingRequired()) {
+            InferenceEngine::Precision expected = preProcess.getColorFormat() != InferenceEngine::ColorFormat::RAW
+                                                  ? InferenceEngine::Precision(InferenceEngine::Precision::U8) : foundInput->getInputPrecision();
+            if (expected != data->precision()) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set Blob with precision "
                                    << data->precision();
             }
             // Stores the given blob as ROI blob. It will be used to fill in a network input during pre-processing.
             _preProcData[name].setRoiBlob(data);
         } else {
-            size_t inputSize = InferenceEngine::details::product(foundInput->getDims());
-            if (dataSize != inputSize) {
-                THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
+            const InferenceEngine::SizeVector &inputDims = foundInput->getTensorDesc().getDims();
+            const InferenceEngine::SizeVector &dataDims = data->getTensorDesc().getDims();
+            if (graph->getProperty().reshapeCacheSize > 0 && dataDims.size() == inputDims.size()) {
+                // the graph compiled for the new input shape is selected by the next inference
+                if (dataDims != inputDims)
+                    foundInput->getInputData()->setDims(dataDims);
+            } else {
+                size_t inputSize = InferenceEngine::details::product(foundInput->getDims());
+                if (dataSize != inputSize) {
+                    THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
             }
 
             // Checking for the input precision
             switch (data->precision()) {
                 case InferenceEngine::Precision::FP32:
                 case InferenceEngine::Precision::FP16:
+                case InferenceEngine::Precision::BF16:
                 case InferenceEngine::Precision::I16:
                 case InferenceEngine::Precision::U16:
                 case InferenceEngine::Precision::U8:
@@ -224,8 +326,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
                                        << data->precision();
             }
 
+            // the view of a frame (the ROI, the padded rows) is read through its strides by PushInputData
             if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit &&
+                !graph->IsTiled() && MKLDNNMemory::IsDenseDesc(data->getTensorDesc())) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -242,8 +346,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                << "Failed to set Blob with precision not corresponding to user output precision";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        // The blob becomes the memory of the graph output only if the graph writes the data exactly as
+        // it is expected by the blob, otherwise the data is copied (converted) by PullOutputData
+        InferenceEngine::BlobMap blobs;
+        graph->getOutputBlobs(blobs);
+        auto outBlob = blobs.find(name);
+        if (outBlob != blobs.end() && !graph->getProperty().batchLimit && !graph->IsTiled() &&
+                !graph->IsConvertedOutput(name) &&
+                data->getTensorDesc().getPrecision() == outBlob->second->getTensorDesc().getPrecision() &&
+                data->getTensorDesc().getLayout() == outBlob->second->getTensorDesc().getLayout()) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -252,14 +363,24 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
     }
 }
 
-static inline void changeEdgePtr(MKLDNNPlugin::MKLDNNEdgePtr edge, void *newPtr) {
-    edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
+void MKLDNNPlugin::MKLDNNInferRequest::changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
+    auto& memPrim = edge->getMemory().GetPrimitivePtr();
+    // only the very first (the graph's own) pointer is remembered, to be able to restore it later
+    defaultPtrs.emplace(edge, memPrim->get_data_handle());
+    memPrim->set_data_handle(newPtr);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::restoreDefaultPtr() {
+    for (auto& it : defaultPtrs) {
+        it.first->getMemory().GetPrimitivePtr()->set_data_handle(it.second);
+    }
+    defaultPtrs.clear();
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
     for (auto& it : externalPtr) {
-        auto input = graph->inputNodes.find(it.first);
-        if (input != graph->inputNodes.end()) {
+        auto input = execGraph->inputNodes.find(it.first);
+        if (input != execGraph->inputNodes.end()) {
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
             // Input cannot be in-place with other primitives
@@ -291,7 +412,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
         }
 
         MKLDNNNodePtr output;
-        for (auto& out : graph->outputNodes) {
+        for (auto& out : execGraph->outputNodes) {
             if (out->getName() == "out_" + it.first) {
                 output = out;
                 break;
@@ -329,6 +450,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph::Ptr &graph) {
     this->graph = graph;
+    outputPool = MKLDNNBlobPool(graph->getProperty().allocator);
+    convertedPool = MKLDNNBlobPool(graph->getProperty().allocator);
+    tilePool = MKLDNNBlobPool(graph->getProperty().allocator);
 
     InferenceEngine::BlobMap blobs;
     this->graph->getInputBlobs(blobs);
@@ -339,6 +463,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph:
     blobs.clear();
     this->graph->getOutputBlobs(blobs);
     for (const auto& it : blobs) {
+        // the argmax outputs have a single channel, the blobs of the request are checked against it
+        auto output = _networkOutputs.find(it.first);
+        if (this->graph->IsConvertedOutput(it.first) && output != _networkOutputs.end())
+            output->second->setDims(it.second->getTensorDesc().getDims());
         InferenceEngine::Blob::Ptr blob;
         GetBlob(it.first.c_str(), blob);
     }
@@ -355,3 +483,76 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
 
     m_curBatch = new_batch;
 }
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetSequenceStates(const std::vector<InferenceEngine::SequenceState::Ptr> &sequences) {
+    for (auto &sequence : sequences) {
+        if (!sequence)
+            THROW_IE_EXCEPTION << "Cannot set an empty sequence state.";
+    }
+    this->sequences = sequences;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetRequestedOutputs(const std::vector<std::string> &outputs) {
+    InferRequestInternal::SetRequestedOutputs(outputs);
+    requestedOutputs = outputs;
+    maskGraph.reset();
+}
+
+int MKLDNNPlugin::MKLDNNInferRequest::GetBatchedSamples() {
+    if (!graph || !graph->getProperty().enableDynamicBatch)
+        return 0;
+    int batchLimit = graph->getProperty().batchLimit;
+    int samples = m_curBatch > 0 ? m_curBatch : batchLimit;
+    if (samples >= batchLimit || !_preProcData.empty() || !sequences.empty())
+        return 0;
+
+    // the samples are copied as they are, so the blobs must be of the layout and precision of the network
+    InferenceEngine::BlobMap blobs;
+    graph->getInputBlobs(blobs);
+    for (auto &input : _inputs) {
+        auto networkInput = _networkInputs.find(input.first);
+        if (networkInput == _networkInputs.end() || blobs.find(input.first) == blobs.end())
+            return 0;
+        InferenceEngine::TensorDesc desc = networkInput->second->getTensorDesc();
+        desc.setPrecision(networkInput->second->getInputPrecision());
+        if (input.second->getTensorDesc() != desc)
+            return 0;
+    }
+    blobs.clear();
+    graph->getOutputBlobs(blobs);
+    for (auto &output : _outputs) {
+        auto blob = blobs.find(output.first);
+        if (blob == blobs.end() || output.second->getTensorDesc() != blob->second->getTensorDesc())
+            return 0;
+    }
+    return samples;
+}
+
+static void copySamples(const InferenceEngine::Blob::Ptr &src, int srcOffset,
+                        const InferenceEngine::Blob::Ptr &dst, int dstOffset, int samples) {
+    size_t sampleSize = src->byteSize() / src->getTensorDesc().getDims()[0];
+    memcpy(dst->buffer().as<uint8_t *>() + dstOffset * sampleSize,
+           src->cbuffer().as<const uint8_t *>() + srcOffset * sampleSize, samples * sampleSize);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::CopyInputsToBatch(MKLDNNInferRequest &batchRequest, int offset, int samples) {
+    for (auto &input : _inputs) {
+        InferenceEngine::Blob::Ptr batchBlob;
+        batchRequest.GetBlob(input.first.c_str(), batchBlob);
+        copySamples(input.second, 0, batchBlob, offset, samples);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::CopyOutputsFromBatch(MKLDNNInferRequest &batchRequest, int offset,
+                                                            int samples) {
+    for (auto &output : _outputs) {
+        InferenceEngine::Blob::Ptr batchBlob;
+        batchRequest.GetBlob(output.first.c_str(), batchBlob);
+        copySamples(batchBlob, offset, output.second, 0, samples);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetBatchedResult(const std::exception_ptr &exception) {
+    batchedResultReady = true;
+    batchedException = exception;
+}
@@ -6,10 +6,12 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_blob_pool.h"
+#include <exception>
 #include <memory>
 #include <string>
 #include <map>
-#include <mkldnn_preprocess_data.hpp>
+#include <vector>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -42,28 +44,76 @@ public:
 
     void SetBatch(int batch = -1) override;
 
-    void execDataPreprocessing() {
-        for (auto &input : _inputs) {
-            // If there is a pre-process entry for an input then it must be pre-processed
-            // using preconfigured resize algorithm.
-            auto it = _preProcData.find(input.first);
-            if (it != _preProcData.end()) {
-                _preProcData[input.first].execute(input.second,
-                                                  _networkInputs[input.first]->getPreProcess().getResizeAlgorithm());
-            }
-        }
-    }
+    /**
+     * @brief Sets the sequences the following inferences read and advance the memory states of instead of the states
+     * of the graph, see MKLDNNSequenceBinding
+     */
+    void SetSequenceStates(const std::vector<InferenceEngine::SequenceState::Ptr> &sequences) override;
+
+    /**
+     * @brief Sets the outputs the following inferences compute, the nodes only the other outputs depend on are
+     * skipped and the other outputs are not copied
+     */
+    void SetRequestedOutputs(const std::vector<std::string> &outputs) override;
+
+    /**
+     * @brief Returns the number of the samples of the request, which inputs can be stacked with the inputs of the other
+     * requests by the auto-batching (see KEY_CPU_AUTO_BATCH_TIMEOUT), or 0 if the request is to be executed alone:
+     * it has the full batch, the pre-processing or the blobs of other layout
+     */
+    int GetBatchedSamples();
+
+    /**
+     * @brief Copies the samples of the inputs to the inputs of the batch request starting from the given sample
+     */
+    void CopyInputsToBatch(MKLDNNInferRequest &batchRequest, int offset, int samples);
+
+    /**
+     * @brief Copies the samples of the outputs of the batch request starting from the given sample to the outputs
+     */
+    void CopyOutputsFromBatch(MKLDNNInferRequest &batchRequest, int offset, int samples);
+
+    /**
+     * @brief Sets the result of the batch the request was executed in, so the next inference only reports it
+     * @param exception - the error of the batch inference or nullptr
+     */
+    void SetBatchedResult(const std::exception_ptr &exception);
 
 private:
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
+    void pushInputs();
+
+    // picks the graph compiled for the current input shapes and reallocates the outputs of other shapes
+    void selectReshapedGraph();
+
     void changeDefaultPtr();
+    void changeEdgePtr(const MKLDNNEdgePtr &edge, void *newPtr);
+    void restoreDefaultPtr();
     MKLDNNGraph::Ptr graph;
+    // the graph the request was executed on last time: differs from the 'graph' in the throughput mode,
+    // where every stream has its own replica of the graph
+    MKLDNNGraph::Ptr execGraph;
     std::map<std::string, void*> externalPtr;
-    // HOTFIX for openmp resize. Remove this line, execDataPreprocessing()
-    // and mkldnn_preprocess_data files in order to disable this hotfix
-    std::map<std::string, MKLDNNPreProcessData> _preProcData;  // pre-process data per input
-
+    // the original memory pointers of the graph edges bound to the blobs of the request
+    std::map<MKLDNNEdgePtr, void*> defaultPtrs;
     int m_curBatch;
+    // the outputs follow the shapes of the reshaped graphs, the inputs of U16 and I16 are converted to FP32 on every
+    // inference, their blobs are reused while they fit the largest ones seen (see MKLDNNBlobPool)
+    MKLDNNBlobPool outputPool;
+    MKLDNNBlobPool convertedPool;
+    MKLDNNBlobPool tilePool;
+    // the execution time statistics of the nodes over the inferences of this request
+    PerfCounters perfCounters;
+    // the outputs are already computed by the batch of the auto-batching
+    bool batchedResultReady = false;
+    std::exception_ptr batchedException;
+    // the sequences of the samples of the batch, empty to infer the states of the graph
+    std::vector<InferenceEngine::SequenceState::Ptr> sequences;
+    // the outputs the request computes, empty for all of them, and the mask of the nodes they depend on in the
+    // graph it was calculated for
+    std::vector<std::string> requestedOutputs;
+    std::vector<bool> outputsMask;
+    std::weak_ptr<MKLDNNGraph> maskGraph;
 };
 }  // namespace MKLDNNPlugin
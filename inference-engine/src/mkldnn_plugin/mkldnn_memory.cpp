@@ -19,7 +19,28 @@ using namespace mkldnn;
 
 namespace MKLDNNPlugin {
 
-MKLDNNMemory::MKLDNNMemory(const engine& eng) : eng(eng) {}
+MKLDNNMemory::MKLDNNMemory(const engine& eng, const std::shared_ptr<IAllocator>& allocator)
+        : eng(eng), allocator(allocator) {}
+
+void MKLDNNMemory::allocate(const memory::primitive_desc& pdesc) {
+    if (!allocator) {
+        prim.reset(new memory(pdesc));
+        return;
+    }
+    auto alloc = allocator;
+    void* handle = alloc->alloc(pdesc.get_size());
+    void* ptr = handle ? alloc->lock(handle) : nullptr;
+    if (ptr == nullptr) {
+        if (handle) alloc->free(handle);
+        THROW_IE_EXCEPTION << "Cannot allocate " << pdesc.get_size() << " bytes of memory";
+    }
+    // the primitive may outlive this object, so the buffer is released together with the primitive
+    prim = std::shared_ptr<memory>(new memory(pdesc, ptr), [alloc, handle](memory* p) {
+        delete p;
+        alloc->unlock(handle);
+        alloc->free(handle);
+    });
+}
 
 size_t MKLDNNMemory::GetSize() const {
     uint8_t itemSize = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(GetDataType()));
@@ -54,7 +75,7 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data) {
     uint8_t itemSize = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(desc.data.data_type));
 
     if (data == nullptr) {
-        prim.reset(new memory(primitive_desc));
+        allocate(primitive_desc);
 
         size_t real_size = 0;
         if (prim->get_primitive_desc().desc().data.ndims > 0) {
@@ -84,7 +105,7 @@ void MKLDNNMemory::CreateFrom(memory::dims dims, const MKLDNNMemory& src) {
 
 void MKLDNNMemory::CreateFrom(memory::primitive_desc &pdesc, const void* data) {
     if (data == nullptr) {
-        prim = std::shared_ptr<memory>(new memory(pdesc));
+        allocate(pdesc);
     } else {
         prim = std::shared_ptr<memory>(new memory(pdesc, const_cast<void*>(data)));
     }
@@ -99,8 +120,6 @@ void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, co
 
         std::vector<int> dims(memData.dims, memData.dims + memData.ndims);
 
-        auto dataType = GetDataType();
-
         MKLDNNMemory src(eng);
         src.Create(dims, dataType, format, data);
 
@@ -128,6 +147,16 @@ void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, co
     }
 }
 
+void MKLDNNMemory::SetStridedData(const TensorDesc &desc, const void *data) const {
+    memory::desc srcDesc = MKLDNNMemoryDesc(desc);
+    // the generic blocked format keeps away the reorders specialized for the dense formats
+    srcDesc.data.format = mkldnn_blocked;
+
+    MKLDNNMemory src(eng);
+    src.Create(srcDesc, data);
+    mkldnn::stream(stream::kind::eager).submit({mkldnn::reorder(src.GetPrimitive(), GetPrimitive())});
+}
+
 void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, const std::vector<void*>& data,
                            const std::vector<size_t>& size, bool ftz) const {
     size_t totalSize = static_cast<size_t >(std::accumulate(size.begin(), size.end(), 0));
@@ -150,6 +179,22 @@ void MKLDNNMemory::FillZero() {
     memset(dataPtr, 0, GetSize());
 }
 
+bool MKLDNNMemory::IsDenseDesc(const TensorDesc &desc) {
+    const BlockingDesc &blk = desc.getBlockingDesc();
+    const SizeVector &dims = blk.getBlockDims();
+    const SizeVector &strides = blk.getStrides();
+    const SizeVector &offsets = blk.getOffsetPaddingToData();
+    if (blk.getOffsetPadding() != 0)
+        return false;
+    size_t stride = 1;
+    for (size_t i = dims.size(); i-- > 0;) {
+        if ((i < strides.size() && strides[i] != stride) || (i < offsets.size() && offsets[i] != 0))
+            return false;
+        stride *= dims[i];
+    }
+    return true;
+}
+
 bool MKLDNNMemory::isConsistant(memory::dims dims, memory::format format) {
     using f = mkldnn::memory::format;
 
@@ -191,7 +236,21 @@ bool MKLDNNMemory::isConsistant(memory::dims dims, memory::format format) {
         case f::gOhIw16o4i:
         case f::Goihw8g:
         case f::Goihw16g:
+        case f::ncdhw:
+        case f::ndhwc:
+        case f::nCdhw16c:
+        case f::oidhw:
+        case f::OIdhw16i16o:
+        case f::OIdhw16o16i:
+        case f::Oidhw16o:
+        case f::Odhwi16o:
             ndims = 5; break;
+        case f::goidhw:
+        case f::gOIdhw16i16o:
+        case f::gOIdhw16o16i:
+        case f::gOidhw16o:
+        case f::gOdhwi16o:
+            ndims = 6; break;
         case f::format_undef:
             ndims = 0; break;
         case f::any:
@@ -207,13 +266,15 @@ bool MKLDNNMemory::isConsistant(memory::dims dims, memory::format format) {
 bool MKLDNNMemory::formatEquals(const memory::format &lformat, const memory::format &rformat) noexcept {
     return (lformat == rformat) || (lformat == memory::nc && rformat == memory::oi) ||
            (lformat == memory::oi && rformat == memory::nc) || (lformat == memory::nchw && rformat == memory::oihw) ||
-           (lformat == memory::oihw && rformat == memory::nchw);
+           (lformat == memory::oihw && rformat == memory::nchw) || (lformat == memory::ncdhw && rformat == memory::oidhw) ||
+           (lformat == memory::oidhw && rformat == memory::ncdhw);
 }
 
 bool MKLDNNMemory::IsPlainFormat(memory::format format) {
     std::vector<memory::format> plains = {memory::nc, memory::nchw, memory::nhwc, memory::chwn,
         memory::oi, memory::io, memory::oihw, memory::ihwo,
         memory::goihw,
+        memory::ncdhw, memory::ndhwc, memory::oidhw, memory::goidhw,
         memory::blocked};
 
     for (auto it : plains) {
@@ -233,6 +294,8 @@ memory::format MKLDNNMemory::GetPlainFormat(memory::dims dims) {
             return memory::nc;
         case 4:
             return memory::nchw;
+        case 5:
+            return memory::ncdhw;
         default:
             return memory::blocked;
     }
@@ -276,6 +339,10 @@ memory::format MKLDNNMemory::Convert(const InferenceEngine::Layout layout) {
             return memory::nchw;
         case NHWC:
             return memory::nhwc;
+        case NCDHW:
+            return memory::ncdhw;
+        case NDHWC:
+            return memory::ndhwc;
         case NC:
             return memory::nc;
         case C:
@@ -325,6 +392,20 @@ std::string MKLDNNMemory::formatToString(memory::format fmt) {
         case memory::gOIhw8o8i: return "gOIhw8o8i";
         case memory::gOIhw16o16i: return "gOIhw16o16i";
         case memory::gOhIw16o4i: return "gOhIw16o4i";
+
+        case memory::ncdhw: return "ncdhw";
+        case memory::ndhwc: return "ndhwc";
+        case memory::nCdhw16c: return "nCdhw16c";
+        case memory::oidhw: return "oidhw";
+        case memory::OIdhw16i16o: return "OIdhw16i16o";
+        case memory::OIdhw16o16i: return "OIdhw16o16i";
+        case memory::Oidhw16o: return "Oidhw16o";
+        case memory::Odhwi16o: return "Odhwi16o";
+        case memory::goidhw: return "goidhw";
+        case memory::gOIdhw16i16o: return "gOIdhw16i16o";
+        case memory::gOIdhw16o16i: return "gOIdhw16o16i";
+        case memory::gOidhw16o: return "gOidhw16o";
+        case memory::gOdhwi16o: return "gOdhwi16o";
         default: {
             THROW_IE_EXCEPTION << "Unsupported data type.";
         }
@@ -391,9 +472,15 @@ MKLDNNMemoryDesc::operator InferenceEngine::TensorDesc() const {
         case mkldnn_u8:
             precision = Precision::U8;
             break;
+        case mkldnn_s8:
+            precision = Precision::I8;
+            break;
         case mkldnn_s16:
             precision = Precision::I16;
             break;
+        case mkldnn_s32:
+            precision = Precision::I32;
+            break;
         default:
             THROW_IE_EXCEPTION << "Cannot cast to TensorDesc. Unsupported precision!";
     }
@@ -448,6 +535,28 @@ MKLDNNMemoryDesc::operator InferenceEngine::TensorDesc() const {
             blkDims.push_back(16);
             layout = Layout::BLOCKED;
             break;
+        case memory::oidhw:
+        case memory::ncdhw:
+            layout = Layout::NCDHW;
+            order = {0, 1, 2, 3, 4};
+            blkDims = getDims().ToSizeVector();
+            break;
+        case memory::ndhwc:
+            layout = Layout::NDHWC;
+            order = {0, 2, 3, 4, 1};
+            blkDims = {static_cast<size_t>(getDims()[0]),
+                       static_cast<size_t>(getDims()[2]),
+                       static_cast<size_t>(getDims()[3]),
+                       static_cast<size_t>(getDims()[4]),
+                       static_cast<size_t>(getDims()[1])};
+            break;
+        case memory::nCdhw16c:
+            order = {0, 1, 2, 3, 4, 1};
+            blkDims = getDims().ToSizeVector();
+            blkDims[1] = blkDims[1] / 16 + (blkDims[1] % 16 ? 1 : 0);
+            blkDims.push_back(16);
+            layout = Layout::BLOCKED;
+            break;
         case memory::blocked:
             order.clear();
             blkDims = getDims().ToSizeVector();
@@ -499,9 +608,15 @@ MKLDNNMemoryDesc::MKLDNNMemoryDesc(const TensorDesc& tDesc):
         case Precision::U8:
             data_type = mkldnn::memory::data_type::u8;
             break;
+        case Precision::I8:
+            data_type = mkldnn::memory::data_type::s8;
+            break;
         case Precision::I16:
             data_type = mkldnn::memory::data_type::s16;
             break;
+        case Precision::I32:
+            data_type = mkldnn::memory::data_type::s32;
+            break;
         default:
             THROW_IE_EXCEPTION << "Cannot create MKLDNNMemoryDesc from TensorDesc. Unsupported precision!";
     }
@@ -521,6 +636,12 @@ MKLDNNMemoryDesc::MKLDNNMemoryDesc(const TensorDesc& tDesc):
         case NHWC:
             mkldnnFormat = memory::format::nhwc;
             break;
+        case NCDHW:
+            mkldnnFormat = memory::format::ncdhw;
+            break;
+        case NDHWC:
+            mkldnnFormat = memory::format::ndhwc;
+            break;
         case OIHW:
             mkldnnFormat = memory::format::oihw;
             break;
@@ -559,6 +680,17 @@ MKLDNNMemoryDesc::MKLDNNMemoryDesc(const TensorDesc& tDesc):
                         break;
                     }
                 }
+            } else if (realDims.ndims() == 5) {
+                if (order.size() == 6 && order == SizeVector{0, 1, 2, 3, 4, 1} && blkdDims[5] == 16) {
+                    mkldnnFormat = memory::format::nCdhw16c;
+                    break;
+                } else if (order == SizeVector{0, 1, 2, 3, 4}) {
+                    mkldnnFormat = memory::format::ncdhw;
+                    break;
+                } else if (order == SizeVector{0, 2, 3, 4, 1}) {
+                    mkldnnFormat = memory::format::ndhwc;
+                    break;
+                }
             }
             mkldnnFormat = memory::format::blocked;
             break;
@@ -635,8 +767,10 @@ MKLDNNMemoryDesc::MKLDNNMemoryDesc(const TensorDesc& tDesc):
     }
 
     if (notDefault) {
+        // the strides of the blocking descriptor follow the order of the blocked dimensions (e.g. N, H, W, C for NHWC),
+        // the outer strides of mkldnn follow the logical ones
         for (size_t i = 0; i < strides.size() && i < desc.data.ndims; i++) {
-            desc.data.layout_desc.blocking.strides[0][i] = static_cast<int>(strides[order[i]]);
+            desc.data.layout_desc.blocking.strides[0][order[i]] = static_cast<int>(strides[i]);
         }
     }
 }
@@ -657,6 +791,7 @@ MKLDNNDims MKLDNNMemoryDesc::autoBlockingDims(const MKLDNNDims &dims, mkldnn::me
             res[1] = rnd_up(res[1], 8);
             break;
         case memory::format::nChw16c:
+        case memory::format::nCdhw16c:
             res[1] = rnd_up(res[1], 16);
             break;
         case memory::format::gOIhw16o16i:
@@ -69,7 +69,12 @@ using MKLDNNMemoryPtr = std::shared_ptr<MKLDNNMemory>;
 
 class MKLDNNMemory {
 public:
-    explicit MKLDNNMemory(const mkldnn::engine& eng);
+    /**
+     * @param eng - engine of the memory
+     * @param allocator - allocator of the memory created without the user data, nullptr means the MKLDNN allocation
+     */
+    explicit MKLDNNMemory(const mkldnn::engine& eng,
+                          const std::shared_ptr<InferenceEngine::IAllocator>& allocator = nullptr);
 
     const mkldnn::memory& GetPrimitive() const {
         return *prim;
@@ -118,6 +123,10 @@ public:
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format format, const std::vector<void*>& data,
                  const std::vector<size_t>& size, bool ftz = true) const;
 
+    // copies the data of a strided or padded layout (e.g. the ROI of a frame) into the memory by one reorder,
+    // the precision is converted on the way
+    void SetStridedData(const InferenceEngine::TensorDesc &desc, const void *data) const;
+
     void FillZero();
 
     static bool IsPlainFormat(mkldnn::memory::format format);
@@ -125,14 +134,19 @@ public:
     static bool isConsistant(mkldnn::memory::dims dims, mkldnn::memory::format format);
     static bool formatEquals(const mkldnn::memory::format &lformat, const mkldnn::memory::format &rformat) noexcept;
     static mkldnn::memory::format Convert(const InferenceEngine::Layout layout);
+    // false if the descriptor has the offsets or the strides of a view (a ROI, the padded rows)
+    static bool IsDenseDesc(const InferenceEngine::TensorDesc &desc);
 
     static std::string formatToString(mkldnn::memory::format fmt);
 
     static void CreateBlockingDesc(mkldnn::memory::desc& desc);
 
 private:
+    void allocate(const mkldnn::memory::primitive_desc& pdesc);
+
     std::shared_ptr<mkldnn::memory> prim;
     mkldnn::engine eng;
+    std::shared_ptr<InferenceEngine::IAllocator> allocator;
 };
 
 
@@ -0,0 +1,63 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_domain.h"
+#include <algorithm>
+#include <map>
+#include <string>
+#include <details/ie_exception.hpp>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+MKLDNNMemoryDomain::Ptr MKLDNNMemoryDomain::get(const std::string &id) {
+    static std::mutex registryMutex;
+    static std::map<std::string, std::weak_ptr<MKLDNNMemoryDomain>> registry;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto domain = registry[id].lock();
+    if (!domain) {
+        domain.reset(new MKLDNNMemoryDomain());
+        registry[id] = domain;
+    }
+    return domain;
+}
+
+MKLDNNMemoryDomain::MKLDNNMemoryDomain() {
+#if defined(__linux__) && defined(SYS_memfd_create)
+    fd = static_cast<int>(syscall(SYS_memfd_create, "ie_cpu_memory_domain", 0));
+#endif
+}
+
+MKLDNNMemoryDomain::~MKLDNNMemoryDomain() {
+#ifdef __linux__
+    // the mappings stay valid after the descriptor is closed
+    if (fd >= 0) close(fd);
+#endif
+}
+
+std::shared_ptr<void> MKLDNNMemoryDomain::map(size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+#ifdef __linux__
+    if (fd >= 0 && size > 0) {
+        capacity = std::max(capacity, size);
+        // the file never shrinks, so the mappings of the smaller workspaces stay within it
+        if (capacity == size && ftruncate(fd, size) != 0)
+            THROW_IE_EXCEPTION << "Cannot grow the shared memory domain to " << size << " bytes";
+        void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED)
+            THROW_IE_EXCEPTION << "Cannot map " << size << " bytes of the shared memory domain";
+        return std::shared_ptr<void>(ptr, [size](void *p) { munmap(p, size); });
+    }
+#endif
+    return nullptr;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,53 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Physical memory shared by the workspaces of the graphs loaded with the same memory domain id
+ * (see PluginConfigParams::KEY_CPU_MEMORY_DOMAIN).
+ * On Linux the memory is an anonymous shared memory file, every graph maps it to its own addresses,
+ * so a bigger graph loaded later grows the file without moving the mappings of the graphs loaded before.
+ * The resident memory of the domain is the size of the largest workspace. The graphs of the domain must never
+ * be executed at the same time.
+ */
+class MKLDNNMemoryDomain {
+public:
+    typedef std::shared_ptr<MKLDNNMemoryDomain> Ptr;
+
+    /**
+     * @brief Returns the domain with the given id, the domain exists as long as any graph uses it
+     */
+    static Ptr get(const std::string &id);
+
+    ~MKLDNNMemoryDomain();
+
+    /**
+     * @brief Maps the first size bytes of the shared memory, growing it if needed
+     * @return the mapping, which is valid as long as the returned pointer is alive, or nullptr if the system
+     * does not support the shared memory, then the graph keeps its own workspace
+     */
+    std::shared_ptr<void> map(size_t size);
+
+    size_t size() const {
+        return capacity;
+    }
+
+private:
+    MKLDNNMemoryDomain();
+
+    std::mutex mutex;
+    int fd = -1;
+    size_t capacity = 0;
+};
+
+}  // namespace MKLDNNPlugin
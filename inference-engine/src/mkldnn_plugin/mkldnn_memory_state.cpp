@@ -0,0 +1,152 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blob_factory.hpp>
+#include "mkldnn_memory_state.h"
+#include "mkldnn_extension_utils.h"
+#include "nodes/mkldnn_memory_node.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNMemoryState::MKLDNNMemoryState(const std::string& name, const std::vector<MKLDNNNodePtr>& inputNodes)
+        : name(name), inputNodes(inputNodes) {
+    if (inputNodes.empty())
+        THROW_IE_EXCEPTION << "Memory state " << name << " has no memory input nodes";
+}
+
+std::string MKLDNNMemoryState::GetName() const {
+    return name;
+}
+
+void MKLDNNMemoryState::Reset() {
+    for (auto& node : inputNodes) {
+        // the edges of the state share the buffer, so the first one is enough
+        const MKLDNNMemory& state = node->getChildEdgeAt(0)->getMemory();
+        if (baseState) {
+            state.SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(baseState->getTensorDesc().getPrecision()),
+                          MKLDNNMemory::Convert(baseState->getTensorDesc().getLayout()),
+                          baseState->cbuffer(), baseState->byteSize(), false);
+        } else {
+            memset(state.GetData(), 0, state.GetSize());
+        }
+    }
+}
+
+void MKLDNNMemoryState::SetState(Blob::Ptr newState) {
+    auto stateSize = static_cast<size_t>(inputNodes[0]->getChildEdgeAt(0)->getDims().size());
+    if (!newState || newState->size() != stateSize)
+        THROW_IE_EXCEPTION << "Memory state " << name << " of " << stateSize << " elements cannot be set from the blob of "
+                           << (newState ? newState->size() : 0) << " elements";
+    baseState = newState;
+}
+
+Blob::CPtr MKLDNNMemoryState::GetLastState() const {
+    return inputNodes[0]->getChildEdgeAt(0)->getBlob();
+}
+
+namespace {
+
+// the buffer of the state of the memory id in the sequence, allocated with zeros on the first use; the sequences
+// come and go, so the buffers are taken from the pool
+Blob::Ptr& sequenceBuffer(SequenceState& sequence, const std::string& id, bool next, size_t size) {
+    auto& buffers = sequence.buffers[id];
+    Blob::Ptr& buffer = next ? buffers.second : buffers.first;
+    if (!buffer || buffer->byteSize() != size) {
+        buffer = make_pooled_blob(TensorDesc(Precision::FP32, {size / sizeof(float)}, Layout::C));
+        memset(buffer->buffer(), 0, size);
+    }
+    return buffer;
+}
+
+}  // namespace
+
+MKLDNNSequenceBinding::MKLDNNSequenceBinding(const std::vector<MKLDNNNodePtr>& graphNodes,
+                                             const std::vector<SequenceState::Ptr>& sequences)
+        : sequences(sequences) {
+    for (auto& sequence : sequences) {
+        if (!sequence)
+            THROW_IE_EXCEPTION << "Cannot infer an empty sequence state";
+    }
+
+    for (auto& node : graphNodes) {
+        auto memoryOutput = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(node);
+        if (!memoryOutput || !memoryOutput->getInputNode() || memoryOutput->getInputNode()->getChildEdges().empty())
+            continue;
+
+        auto& state = memoryOutput->getInputNode()->getChildEdgeAt(0)->getMemory();
+        auto dims = state.GetDims();
+        size_t batch = dims.empty() ? 1 : static_cast<size_t>(dims[0]);
+        if (sequences.size() > batch)
+            THROW_IE_EXCEPTION << "Cannot infer " << sequences.size() << " sequences with the memory "
+                               << memoryOutput->getId() << " of the batch " << batch;
+        Binding binding = {memoryOutput.get(), memoryOutput->getId(), state.GetSize() / batch, nullptr, nullptr, {}};
+        bindings.push_back(binding);
+    }
+
+    try {
+        for (auto& binding : bindings) {
+            // the state of the batch 1 is the sample, so the swapping node can infer the buffers of the sequence
+            if (sequences.size() == 1 && binding.node->swapsStates() &&
+                    binding.sampleSize == binding.node->getInputNode()->getChildEdgeAt(0)->getMemory().GetSize()) {
+                void* state = sequenceBuffer(*sequences[0], binding.id, false, binding.sampleSize)->buffer();
+                void* newState = sequenceBuffer(*sequences[0], binding.id, true, binding.sampleSize)->buffer();
+                binding.state = binding.node->getStateData();
+                binding.newState = binding.node->getNewStateData();
+                binding.node->setStateData(state, newState);
+                continue;
+            }
+
+            auto* data = static_cast<uint8_t*>(stateData(binding));
+            binding.backup.assign(data, data + binding.sampleSize * sequences.size());
+            for (size_t i = 0; i < sequences.size(); i++) {
+                memcpy(data + i * binding.sampleSize,
+                       sequenceBuffer(*sequences[i], binding.id, false, binding.sampleSize)->cbuffer(),
+                       binding.sampleSize);
+            }
+        }
+    } catch (...) {
+        release(false);
+        throw;
+    }
+}
+
+MKLDNNSequenceBinding::~MKLDNNSequenceBinding() {
+    if (!released)
+        release(false);
+}
+
+void* MKLDNNSequenceBinding::stateData(const Binding& binding) const {
+    // the swapping nodes exchange the buffers, so the state is looked up after the inference again
+    return binding.node->getInputNode()->getChildEdgeAt(0)->getMemory().GetData();
+}
+
+void MKLDNNSequenceBinding::release(bool completed) {
+    released = true;
+    for (auto& binding : bindings) {
+        if (binding.state) {
+            // the state produced to the second buffer of the sequence becomes its current one
+            auto& buffers = sequences[0]->buffers[binding.id];
+            if (completed && binding.node->getStateData() == static_cast<void*>(buffers.second->buffer()))
+                std::swap(buffers.first, buffers.second);
+            binding.node->setStateData(binding.state, binding.newState);
+            continue;
+        }
+        if (binding.backup.empty())
+            continue;
+
+        auto* data = static_cast<uint8_t*>(stateData(binding));
+        for (size_t i = 0; completed && i < sequences.size(); i++) {
+            memcpy(sequenceBuffer(*sequences[i], binding.id, false, binding.sampleSize)->buffer(),
+                   data + i * binding.sampleSize, binding.sampleSize);
+        }
+        memcpy(data, binding.backup.data(), binding.backup.size());
+    }
+    bindings.clear();
+}
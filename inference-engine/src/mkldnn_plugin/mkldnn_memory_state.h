@@ -0,0 +1,90 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
+#include "mkldnn_node.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief State of the Memory layers with the same id in all the graphs (streams) of the executable network.
+ * The state is read directly from the memory of the graph: the last state is not copied, and the memory output
+ * nodes exchange the state buffers instead of copying the new state after every inference.
+ */
+class MKLDNNMemoryState : public InferenceEngine::IMemoryStateInternal {
+public:
+    /**
+     * @param name - id of the Memory layers
+     * @param inputNodes - the memory input node of every graph
+     */
+    MKLDNNMemoryState(const std::string& name, const std::vector<MKLDNNNodePtr>& inputNodes);
+
+    std::string GetName() const override;
+
+    /**
+     * @brief Fills the state of every graph with the state given to SetState or with zeros
+     */
+    void Reset() override;
+
+    void SetState(InferenceEngine::Blob::Ptr newState) override;
+
+    /**
+     * @brief Returns the state of the first graph without a copy, the blob is valid until the next inference
+     */
+    InferenceEngine::Blob::CPtr GetLastState() const override;
+
+private:
+    std::string name;
+    std::vector<MKLDNNNodePtr> inputNodes;
+    InferenceEngine::Blob::Ptr baseState;
+};
+
+class MKLDNNMemoryOutputNode;
+
+/**
+ * @brief Binds the states of the sequences (see InferenceEngine::SequenceState) to the memory nodes of a graph for
+ * one inference, the sequence i to the sample i of the batch. A single sequence of a graph of the batch 1 is bound
+ * by pointing the edges of the swapping memory nodes to the buffers of the sequence, so switching the sequences
+ * costs no copy; the states of the other nodes and of the batches are copied to the samples of the graph state and
+ * back. The states of the graph are restored by release.
+ */
+class MKLDNNSequenceBinding {
+public:
+    MKLDNNSequenceBinding(const std::vector<MKLDNNNodePtr>& graphNodes,
+                          const std::vector<InferenceEngine::SequenceState::Ptr>& sequences);
+
+    ~MKLDNNSequenceBinding();
+
+    /**
+     * @brief Unbinds the sequences, their states advance only if the inference is completed
+     */
+    void release(bool completed);
+
+private:
+    struct Binding {
+        MKLDNNMemoryOutputNode* node;
+        std::string id;
+        // the bytes of the state of one sample
+        size_t sampleSize;
+        // the buffers of the swapping node in the graph, nullptr if the state is copied
+        void* state;
+        void* newState;
+        // the state of the graph overwritten by the copied samples
+        std::vector<uint8_t> backup;
+    };
+
+    void* stateData(const Binding& binding) const;
+
+    std::vector<Binding> bindings;
+    std::vector<InferenceEngine::SequenceState::Ptr> sequences;
+    bool released = false;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,150 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_network_serializer.h"
+#include <ie_util_internal.hpp>
+#include <details/ie_exception.hpp>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+
+using namespace InferenceEngine;
+
+namespace {
+const char exportMagic[] = "MKLDNNPlugin ExecutableNetwork";
+const uint32_t exportVersion = 1;
+
+template <typename T>
+void writeValue(std::ostream &out, const T &value) {
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+T readValue(std::istream &in) {
+    T value;
+    if (!in.read(reinterpret_cast<char *>(&value), sizeof(T)))
+        THROW_IE_EXCEPTION << "Unexpected end of the exported network";
+    return value;
+}
+
+void writeString(std::ostream &out, const std::string &str) {
+    writeValue<uint64_t>(out, str.size());
+    out.write(str.data(), str.size());
+}
+
+std::string readString(std::istream &in) {
+    auto size = readValue<uint64_t>(in);
+    std::string str(size, '\0');
+    if (size && !in.read(&str[0], size))
+        THROW_IE_EXCEPTION << "Unexpected end of the exported network";
+    return str;
+}
+}  // namespace
+
+void MKLDNNPlugin::SerializeNetwork(ICNNNetwork &network, const std::map<std::string, std::string> &primitives,
+                                    std::ostream &out) {
+    // the copy shares the weights with the original network, only the priorities of the layers are changed
+    auto clonedNetwork = cloneNet(network);
+    for (auto &primitive : primitives) {
+        CNNLayerPtr layer;
+        if (clonedNetwork->getLayerByName(primitive.first.c_str(), layer, nullptr) != OK)
+            continue;
+        if (layer->params.find("PrimitivesPriority") == layer->params.end())
+            layer->params["PrimitivesPriority"] = primitive.second;
+    }
+
+    std::stringstream xml, weights;
+    saveNetworkToIR(*clonedNetwork, xml, weights);
+
+    out.write(exportMagic, sizeof(exportMagic));
+    writeValue(out, exportVersion);
+    writeString(out, xml.str());
+    writeString(out, weights.str());
+
+    // the precisions and layouts requested by the user are not the part of the IR
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    writeValue<uint64_t>(out, inputs.size());
+    for (auto &input : inputs) {
+        writeString(out, input.first);
+        writeString(out, input.second->getInputPrecision().name());
+        writeValue<uint32_t>(out, input.second->getLayout());
+    }
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    writeValue<uint64_t>(out, outputs.size());
+    for (auto &output : outputs) {
+        auto creator = output.second->getCreatorLayer().lock();
+        if (!creator)
+            THROW_IE_EXCEPTION << "Output " << output.first << " has no creator layer";
+        size_t index = 0;
+        while (index < creator->outData.size() && creator->outData[index] != output.second) index++;
+        writeString(out, output.first);
+        writeString(out, creator->name);
+        writeValue<uint64_t>(out, index);
+        writeString(out, output.second->getPrecision().name());
+        writeValue<uint32_t>(out, output.second->getLayout());
+    }
+
+    if (!out.good())
+        THROW_IE_EXCEPTION << "Failed to write the exported network";
+}
+
+CNNNetReader::Ptr MKLDNNPlugin::DeserializeNetwork(std::istream &in) {
+    std::vector<char> magic(sizeof(exportMagic));
+    if (!in.read(magic.data(), magic.size()) || std::string(magic.data()) != exportMagic)
+        THROW_IE_EXCEPTION << "The file is not a network exported by the MKLDNNPlugin";
+    auto version = readValue<uint32_t>(in);
+    if (version != exportVersion)
+        THROW_IE_EXCEPTION << "Unsupported version of the exported network: " << version;
+
+    auto xml = readString(in);
+    auto weights = readString(in);
+
+    CNNNetReader::Ptr reader = std::make_shared<CNNNetReader>();
+    reader->ReadNetwork(xml.data(), xml.size());
+    TBlob<uint8_t>::Ptr weightsBlob(new TBlob<uint8_t>(Precision::U8, C, {weights.size()}));
+    weightsBlob->allocate();
+    if (!weights.empty())
+        memcpy(weightsBlob->buffer(), weights.data(), weights.size());
+    reader->SetWeights(weightsBlob);
+
+    CNNNetwork network = reader->getNetwork();
+    InputsDataMap inputs = network.getInputsInfo();
+    auto inputsNum = readValue<uint64_t>(in);
+    for (uint64_t i = 0; i < inputsNum; i++) {
+        auto name = readString(in);
+        auto precision = Precision::FromStr(readString(in));
+        auto layout = static_cast<Layout>(readValue<uint32_t>(in));
+        if (inputs.find(name) == inputs.end())
+            THROW_IE_EXCEPTION << "Input " << name << " of the exported network is not found";
+        inputs[name]->setInputPrecision(precision);
+        inputs[name]->setLayout(layout);
+    }
+
+    auto outputsNum = readValue<uint64_t>(in);
+    for (uint64_t i = 0; i < outputsNum; i++) {
+        auto name = readString(in);
+        auto layerName = readString(in);
+        auto index = readValue<uint64_t>(in);
+        auto precision = Precision::FromStr(readString(in));
+        auto layout = static_cast<Layout>(readValue<uint32_t>(in));
+
+        OutputsDataMap outputs = network.getOutputsInfo();
+        if (outputs.find(name) == outputs.end()) {
+            network.addOutput(layerName, index);
+            outputs = network.getOutputsInfo();
+            if (outputs.find(name) == outputs.end())
+                THROW_IE_EXCEPTION << "Output " << name << " of the exported network is not found";
+        }
+        outputs[name]->setPrecision(precision);
+        outputs[name]->setLayout(layout);
+    }
+
+    return reader;
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <ie_icnn_network.hpp>
+#include <cpp/ie_cnn_net_reader.h>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Writes the network of the executable network to the stream in the format of ExecutableNetwork::Export().
+ * The stream contains the IR of the network together with the precisions and layouts of its inputs and outputs.
+ * @param network - network to export
+ * @param primitives - the implementation selected for every node (layer name -> "cpu:<type>"), it is stored
+ *        as the PrimitivesPriority of the layer, so the imported graph is built of the same primitives
+ * @param out - output stream
+ */
+void SerializeNetwork(InferenceEngine::ICNNNetwork &network, const std::map<std::string, std::string> &primitives,
+                      std::ostream &out);
+
+/**
+ * @brief Reads the network written by SerializeNetwork()
+ * @param in - input stream
+ * @return the reader keeping the restored network
+ */
+InferenceEngine::CNNNetReader::Ptr DeserializeNetwork(std::istream &in);
+
+}  // namespace MKLDNNPlugin
@@ -7,9 +7,13 @@
 #include "mkldnn_extension_mngr.h"
 
 #include "caseless.hpp"
+#include "mkldnn_weights_cache.h"
+#include <blob_factory.hpp>
+#include <precision_utils.h>
 #include <vector>
 #include <string>
 #include <limits>
+#include <sstream>
 
 #include <nodes/mkldnn_batchnorm_node.h>
 #include <nodes/mkldnn_concat_node.h>
@@ -32,6 +36,9 @@
 #include <nodes/mkldnn_tile_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <nodes/mkldnn_permute_node.h>
+#include <nodes/mkldnn_gemm_node.h>
+#include <nodes/mkldnn_gather_node.h>
+#include <nodes/mkldnn_reorg_yolo_node.h>
 #include <nodes/mkldnn_memory_node.hpp>
 #include <mkldnn_types.h>
 
@@ -63,6 +70,9 @@ MKLDNNNode::Register<MKLDNNSoftMaxNode> MKLDNNSoftMaxNode::reg;
 MKLDNNNode::Register<MKLDNNSplitNode> MKLDNNSplitNode::reg;
 MKLDNNNode::Register<MKLDNNTileNode> MKLDNNTileNode::reg;
 MKLDNNNode::Register<MKLDNNPermuteNode> MKLDNNPermuteNode::reg;
+MKLDNNNode::Register<MKLDNNGemmNode> MKLDNNGemmNode::reg;
+MKLDNNNode::Register<MKLDNNGatherNode> MKLDNNGatherNode::reg;
+MKLDNNNode::Register<MKLDNNReorgYoloNode> MKLDNNReorgYoloNode::reg;
 MKLDNNNode::Register<MKLDNNMemoryInputNode> MKLDNNMemoryInputNode::reg;
 MKLDNNNode::Register<MKLDNNMemoryOutputNode> MKLDNNMemoryOutputNode::reg;
 
@@ -247,7 +257,7 @@ void MKLDNNNode::resolveNotAllocatedEdges() {
             continue;
 
         auto * memPtr = reinterpret_cast<char*>(parentEdge->getMemory().GetData());
-        parentEdge->getMemoryPtr().reset(new MKLDNNMemory(getEngine()));
+        parentEdge->getMemoryPtr().reset(new MKLDNNMemory(getEngine(), getAllocator()));
         parentEdge->getMemoryPtr()->Create(MKLDNNMemoryDesc(selected_pd->getConfig().inConfs[i].desc), memPtr);
 
         parentEdge->changeStatus(MKLDNNEdge::Status::Allocated);
@@ -259,7 +269,7 @@ void MKLDNNNode::resolveNotAllocatedEdges() {
             continue;
 
         auto * memPtr = reinterpret_cast<char*>(childEdge->getMemory().GetData());
-        childEdge->getMemoryPtr().reset(new MKLDNNMemory(getEngine()));
+        childEdge->getMemoryPtr().reset(new MKLDNNMemory(getEngine(), getAllocator()));
         childEdge->getMemoryPtr()->Create(MKLDNNMemoryDesc(selected_pd->getConfig().outConfs[i].desc), memPtr);
 
         childEdge->changeStatus(MKLDNNEdge::Status::Allocated);
@@ -274,39 +284,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
         type = selectedPrimitiveDesc->getImplementationType();
     }
 
-    std::string str_type;
-
-    auto add_type = [&](std::string t) {
-        if (!str_type.empty() && t.c_str()[0] != '_')
-            str_type += "_";
-        str_type += t;
-    };
-
-#define SEARCH_TYPE(_type)                                          \
-    if ((type & impl_desc_type::_type) == impl_desc_type::_type)    \
-        add_type(#_type)
-
-    SEARCH_TYPE(undef);
-    SEARCH_TYPE(reorder);
-    SEARCH_TYPE(jit);
-    SEARCH_TYPE(gemm);
-    SEARCH_TYPE(ref);
-
-    SEARCH_TYPE(avx512);
-    SEARCH_TYPE(avx2);
-    SEARCH_TYPE(sse42);
-    SEARCH_TYPE(blas);
-    SEARCH_TYPE(any);
-
-    SEARCH_TYPE(winograd);
-    SEARCH_TYPE(_dw);
-    SEARCH_TYPE(_1x1);
-
-    if (type == impl_desc_type::unknown)
-        str_type = "unknown";
-    else if (str_type.empty())
-        str_type = "undef";
-    return str_type;
+    return impl_type_to_string(type);
 }
 
 const MKLDNNEdgePtr MKLDNNNode::getParentEdgeAt(size_t idx) const {
@@ -349,7 +327,7 @@ void MKLDNNNode::initSupportedPrimitiveDescriptors() {
 
     for (auto& desc : descs) {
         try {
-            primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(engine);
+            primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(engine, initPrimitiveAttr());
             do {
                 InferenceEngine::LayerConfig config;
                 config.dynBatchSupport = true;
@@ -397,7 +375,7 @@ void MKLDNNNode::initDescriptor(const InferenceEngine::LayerConfig &config) {
     for (size_t j = 0; j < descs.size(); j++) {
         try {
             const auto &desc = descs[j];
-            primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(engine);
+            primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(engine, initPrimitiveAttr());
             do {
                 InferenceEngine::LayerConfig cfg;
                 cfg.dynBatchSupport = true;
@@ -470,16 +448,34 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
     if (blb == nullptr)
         THROW_IE_EXCEPTION << "Cannot get internal blob layer for node " << getName() << ".";
 
-    InferenceEngine::TensorDesc desc(blb->precision(), dims, InferenceEngine::TensorDesc::getLayoutByDims(dims));
-    InferenceEngine::TBlob<float>::Ptr internalBlob = InferenceEngine::make_shared_blob<float>(desc);
+    // the weights stored in FP16 to halve the IR are decompressed once, the primitives run on FP32
+    const bool fromFP16 = blb->precision() == InferenceEngine::Precision::FP16;
+    InferenceEngine::Precision precision = blb->precision();
+    if (fromFP16)
+        precision = InferenceEngine::Precision::FP32;
+    InferenceEngine::TensorDesc desc(precision, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims));
+    InferenceEngine::Blob::Ptr internalBlob = make_blob_with_precision(desc);
     internalBlob->allocate();
-    char *data = internalBlob->buffer();
+    char *data = internalBlob->buffer().as<char *>();
     size_t intBuffSize = internalBlob->byteSize();
 
-    size_t offset = blb->byteSize();
-    checkSize(intBuffSize, offset);
-    memcpy(data, blb->buffer(), blb->byteSize());
-    data += blb->byteSize();
+    size_t offset = 0;
+    auto append = [&](const InferenceEngine::Blob::Ptr &blob) {
+        if ((blob->precision() == InferenceEngine::Precision::FP16) != fromFP16)
+            THROW_IE_EXCEPTION << "Cannot merge the FP16 and the FP32 internal blobs of node " << getName() << ".";
+        size_t size = fromFP16 ? blob->size() * sizeof(float) : blob->byteSize();
+        offset += size;
+        checkSize(intBuffSize, offset);
+        if (fromFP16) {
+            InferenceEngine::PrecisionUtils::f16tof32Arrays(reinterpret_cast<float *>(data), blob->cbuffer().as<const short *>(),
+                                           blob->size());
+        } else {
+            memcpy(data, blob->buffer(), blob->byteSize());
+        }
+        data += size;
+    };
+
+    append(blb);
     for (const auto &merged : getMergeWith()) {
         wLayer = dynamic_cast<InferenceEngine::WeightableLayer*>(merged->getCnnLayer().get());
         if (wLayer == nullptr)
@@ -489,10 +485,7 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
 
         if (blb == nullptr)
             THROW_IE_EXCEPTION << "Cannot get internal blob layer for node " << getName() << ".";
-        offset += blb->byteSize();
-        checkSize(intBuffSize, offset);
-        memcpy(data, blb->buffer(), blb->byteSize());
-        data += blb->byteSize();
+        append(blb);
     }
 
     return internalBlob;
@@ -518,7 +511,6 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
     internalBlobMemory.clear();
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         auto& internalBlob = internalBlobs[i];
-        internalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(engine)));
         MKLDNNDims blobDims = MKLDNNDims(internalBlob->getTensorDesc().getDims());
         memory::format format = memory::oihw;
 
@@ -527,20 +519,35 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
         } else if (blobDims.ndims() == 2) {
             format = memory::oi;
         } else if (blobDims.ndims() == 5) {
-            format = memory::goihw;
+            // the weights of a 3D convolution have the rank of its input, the grouped ones one more
+            format = getParentEdgeAt(0)->getDims().ndims() == 5 ? memory::oidhw : memory::goihw;
+        } else if (blobDims.ndims() == 6) {
+            format = memory::goidhw;
         }
         auto inDataType = MKLDNNMemoryDesc(getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc).getDataType();
+        auto blobDataType = inDataType;
+        // quantized blobs are converted to the type requested by the primitive (e.g. int8 biases to int32)
+        if (internalBlob->getTensorDesc().getPrecision() != InferenceEngine::Precision::FP32) {
+            blobDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(internalBlob->getTensorDesc().getPrecision());
+            inDataType = intDescs[i].getDataType();
+        }
 
         MKLDNNDims real_dims = intDescs[i].getDims();
-        if (blobDims == real_dims) {  // No auto blocking
-            // TODO: Cannot create memory from intDescs[i] because ScaleShift changes dims
-            internalBlobMemory[i]->Create(blobDims, inDataType, intDescs[i].getFormat());
-            internalBlobMemory[i]->SetData(inDataType, format, internalBlob->buffer(),
-                                           blobDims.size() * MKLDNNExtensionUtils::sizeOfDataType(inDataType));
-        } else {  // Auto blocking, logic and real dims are different
+        auto createMemory = [&]() -> MKLDNNMemoryPtr {
+            MKLDNNMemoryPtr blobMemory(new MKLDNNMemory(engine, getAllocator()));
+            if (blobDims == real_dims) {  // No auto blocking
+                // TODO: Cannot create memory from intDescs[i] because ScaleShift changes dims
+                blobMemory->Create(blobDims, inDataType, intDescs[i].getFormat());
+                blobMemory->SetData(blobDataType, format, internalBlob->buffer(),
+                                blobDims.size() * MKLDNNExtensionUtils::sizeOfDataType(blobDataType));
+                return blobMemory;
+            }
+            // Auto blocking, logic and real dims are different
             if (blobDims.ndims() != real_dims.ndims() || blobDims.ndims() > 5)
                 THROW_IE_EXCEPTION << getName() << " Error: CPU plugin supports auto blocking only "
                                    << "for blobs with a number of dimensions less than 6!";
+            if (blobDataType != memory::f32)
+                THROW_IE_EXCEPTION << getName() << " Error: CPU plugin supports auto blocking only for fp32 blobs!";
             InferenceEngine::Blob::Ptr tmp_wght =
                     InferenceEngine::make_shared_blob<float>(InferenceEngine::Precision::FP32, real_dims.ToSizeVector());
 
@@ -585,9 +592,22 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
                 tmp_data[r_indx] = in_data[l_indx];
             }
-            internalBlobMemory[i]->Create(real_dims, inDataType, intDescs[i].getFormat());
-            internalBlobMemory[i]->SetData(inDataType, format, tmp_wght->buffer(), tmp_wght->byteSize());
+            blobMemory->Create(real_dims, inDataType, intDescs[i].getFormat());
+            blobMemory->SetData(inDataType, format, tmp_wght->buffer(), tmp_wght->byteSize());
+            return blobMemory;
+        };
+
+        if (!shareInternalBlobs) {
+            internalBlobMemory.push_back(createMemory());
+            continue;
         }
+        // the same weights repacked to the same memory are shared by all the graphs of the process
+        MKLDNNMemoryDesc targetDesc(blobDims == real_dims ? blobDims : real_dims, inDataType, intDescs[i].getFormat());
+        std::stringstream tag;
+        tag << blobDataType << "_" << format << "_" << getAllocator().get();
+        std::string key = MKLDNNWeightsCache::makeKey(internalBlob->buffer(), internalBlob->byteSize(),
+                                                      targetDesc, tag.str());
+        internalBlobMemory.push_back(MKLDNNWeightsCache::findOrCreate(key, createMemory));
     }
 }
 
@@ -656,6 +676,19 @@ void MKLDNNNode::cleanup() {
     }
 }
 
+void MKLDNNNode::foldConstant() {
+    prim.reset(nullptr);
+    internalBlobMemory.clear();
+
+    for (auto it : fusedWith) {
+        it->foldConstant();
+    }
+
+    for (auto it : mergedWith) {
+        it->foldConstant();
+    }
+}
+
 std::string MKLDNNNode::typeToStr(Type type) {
     switch (type) {
         case Generic:
@@ -716,6 +749,16 @@ std::string MKLDNNNode::typeToStr(Type type) {
             return "MemoryOutput";
         case MemoryInput:
             return "MemoryInput";
+        case EltwiseChain:
+            return "EltwiseChain";
+        case InvertedResidual:
+            return "InvertedResidual";
+        case Gemm:
+            return "Gemm";
+        case Gather:
+            return "Gather";
+        case ReorgYolo:
+            return "ReorgYolo";
         default:
             return "Unknown";
     }
@@ -724,6 +767,8 @@ std::string MKLDNNNode::typeToStr(Type type) {
 const std::vector<impl_desc_type>& MKLDNNNode::getPrimitivesPriority() {
     std::vector<impl_desc_type> priorities = {
             impl_desc_type::unknown,
+            impl_desc_type::gemm_subpixel,
+            impl_desc_type::sparse_sse42_1x1,
             impl_desc_type::jit_uni_dw,
             impl_desc_type::jit_uni_1x1,
             impl_desc_type::jit_uni,
@@ -929,6 +974,9 @@ int MKLDNNNode::getMaxBatch() {
 }
 
 void MKLDNNNode::setDynamicBatchLim(int lim) {
+    // the primitives keep the batch of the previous inference
+    if (lim == dynBatchLim)
+        return;
     dynBatchLim = lim;
     if (prim) {
         prim.setBatchLimit(batchToProcess(), getParentEdges().size(), getChildEdges().size());
@@ -59,6 +59,11 @@ enum Type {
     Copy,
     MemoryOutput,
     MemoryInput,
+    EltwiseChain,
+    InvertedResidual,
+    Gemm,
+    Gather,
+    ReorgYolo,
 };
 
 static Type TypeFromName(const std::string type) {
@@ -100,6 +105,9 @@ static Type TypeFromName(const std::string type) {
             { "BatchNormalization", BatchNormalization },
             { "Flatten", Flatten },
             { "Permute", Permute },
+            { "Gemm", Gemm },
+            { "Gather", Gather },
+            { "ReorgYolo", ReorgYolo },
             { "Copy", Copy },
             { "MemoryInput", MemoryInput},  // for construction from name ctor, arbitrary name is used
             { "Memory", MemoryOutput },  // for construction from layer ctor
@@ -153,6 +161,8 @@ public:
     void removeEdge(const MKLDNNEdgeWeakPtr& edge);
 
     virtual void cleanup();
+    // releases the primitive and the weights of the constant node, whose outputs are already computed
+    virtual void foldConstant();
     void remove();
 
     const std::vector<MKLDNNEdgeWeakPtr> &getParentEdges() const noexcept {
@@ -175,6 +185,17 @@ public:
         return engine;
     }
 
+    /**
+     * @brief Sets the allocator of the memory created by the node, i.e. the repacked weights and the output data
+     */
+    void setAllocator(const std::shared_ptr<InferenceEngine::IAllocator>& alloc) {
+        allocator = alloc;
+    }
+
+    const std::shared_ptr<InferenceEngine::IAllocator>& getAllocator() const {
+        return allocator;
+    }
+
     bool isConstant();
 
     bool isInplace() const;
@@ -191,7 +212,11 @@ public:
         return mergedWith;
     }
 
-    const std::string getName() const {
+    const std::vector <MKLDNNNodePtr> &getFusedWith() {
+        return fusedWith;
+    }
+
+    const std::string &getName() const {
         return name;
     }
 
@@ -230,8 +255,6 @@ public:
 
     std::string getPrimitiveDescriptorType();
 
-    PerfCount &PerfCounter() { return perfCounter; }
-
     InferenceEngine::ProfilingTask &GetProfilingTask() { return profilingTask; }
 
     virtual void setDynamicBatchLim(int lim);
@@ -248,6 +271,10 @@ public:
     virtual void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                                   const std::vector<InferenceEngine::TensorDesc>& outputDesc) {}
     virtual void initDescriptor(const InferenceEngine::LayerConfig& config);
+    // the attributes of the mkl-dnn primitive, e.g. the post-ops of the fused nodes
+    virtual mkldnn::primitive_attr initPrimitiveAttr() const {
+        return mkldnn::primitive_attr();
+    }
     virtual bool created() const = 0;
     virtual bool created(const MKLDNNExtensionManager::Ptr& extMgr) {
         return created();
@@ -341,6 +368,9 @@ protected:
     ConstantType constant = ConstantType::Unknown;
     std::vector<InferenceEngine::Blob::Ptr> internalBlobs;
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
+    // the repacked internal blobs are shared with the other graphs (see MKLDNNWeightsCache),
+    // so a node changing its internal blob memory after the creation must not share it
+    bool shareInternalBlobs = true;
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     MKLDNNPrimitive prim;
     std::vector<MKLDNNDescriptor> descs;
@@ -353,6 +383,14 @@ protected:
     bool isInitConfig(const InferenceEngine::LayerConfig& config) const;
     virtual void selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& priority);
     virtual bool canBeInPlace() const;
+    /**
+     * @brief Tells if the output may be placed in the memory of the input of the index: the node reads every
+     * element of the input before it writes the element of the output at the same offset. The graph places them
+     * together when the input is not read after the node (see MemorySolver::setInPlace)
+     */
+    virtual bool canShareInputMemory(size_t inputIdx) const {
+        return false;
+    }
 
     virtual const std::vector<impl_desc_type>& getPrimitivesPriority();
 
@@ -377,15 +415,17 @@ private:
 
     InferenceEngine::CNNLayerPtr cnnLayer;
     mkldnn::engine engine;
+    std::shared_ptr<InferenceEngine::IAllocator> allocator;
 
     std::string name;
     const std::string typeStr;
     Type type;
     int execIndex = -1;
+    // index of the group of independent nodes, which can be executed at the same time (see CPU_PARALLEL_BRANCHES)
+    int execLevel = -1;
 
     std::string typeToStr(Type type);
 
-    PerfCount perfCounter;
     InferenceEngine::ProfilingTask profilingTask;
 
     bool isEdgesEmpty(const std::vector<MKLDNNEdgeWeakPtr>& edges) const;
@@ -5,14 +5,22 @@
 
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_network_serializer.h"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 #include <memory>
+#include <fstream>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
 InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network, const std::map<std::string, std::string> &config) {
+    return LoadExeNetworkImpl(network, config, nullptr);
+}
+
+InferenceEngine::ExecutableNetworkInternal::Ptr
+Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network, const std::map<std::string, std::string> &config,
+                           const std::shared_ptr<InferenceEngine::IAllocator> &allocator) {
     auto specifiedDevice = network.getTargetDevice();
     auto supportedDevice = InferenceEngine::TargetDevice::eCPU;
     if (specifiedDevice != InferenceEngine::TargetDevice::eDefault && specifiedDevice != supportedDevice) {
@@ -26,7 +34,8 @@ Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network, const std::map
     for (auto ii : _networkInputs) {
         auto input_precision = ii.second->getInputPrecision();
         if (input_precision != InferenceEngine::Precision::U16 && input_precision != InferenceEngine::Precision::I16
-            && input_precision != InferenceEngine::Precision::FP32 && input_precision != InferenceEngine::Precision::U8) {
+            && input_precision != InferenceEngine::Precision::FP32 && input_precision != InferenceEngine::Precision::U8
+            && input_precision != InferenceEngine::Precision::BF16) {
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
                                << "Input image format " << input_precision << " is not supported yet...";
         }
@@ -37,6 +46,8 @@ Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network, const std::map
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
     Config conf = engConfig;
     conf.readProperties(config);
+    if (allocator)
+        conf.allocator = allocator;
 
     if (conf.enableDynamicBatch) {
         conf.batchLimit = network.getBatchSize();
@@ -61,6 +72,19 @@ void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     }
 }
 
+InferenceEngine::IExecutableNetwork::Ptr
+Engine::ImportNetwork(const std::string &modelFileName, const std::map<std::string, std::string> &config) {
+    std::ifstream file(modelFileName, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+        THROW_IE_EXCEPTION << "Cannot open file " << modelFileName;
+    auto reader = DeserializeNetwork(file);
+
+    IExecutableNetwork::Ptr executableNetwork;
+    ICNNNetwork &network = reader->getNetwork();
+    LoadNetwork(executableNetwork, network, config);
+    return executableNetwork;
+}
+
 void Engine::AddExtension(InferenceEngine::IExtensionPtr extension) {
     extensionManager->AddExtension(extension);
 }
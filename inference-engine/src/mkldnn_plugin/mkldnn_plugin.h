@@ -22,6 +22,24 @@ public:
     LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    /**
+     * @brief Loads the network, which allocates the intermediate data, the repacked weights and the input/output
+     * blobs with the given allocator
+     */
+    InferenceEngine::ExecutableNetworkInternal::Ptr
+    LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network,
+                       const std::map<std::string, std::string> &config,
+                       const std::shared_ptr<InferenceEngine::IAllocator> &allocator) override;
+
+    /**
+     * @brief Loads the network exported by ExecutableNetwork::Export()
+     * @param modelFileName - path to the exported network
+     * @param config - string-string map of config parameters relevant only for this load operation
+     * @return the executable network
+     */
+    InferenceEngine::IExecutableNetwork::Ptr ImportNetwork(const std::string &modelFileName,
+                                                           const std::map<std::string, std::string> &config) override;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
     /**
      * @deprecated
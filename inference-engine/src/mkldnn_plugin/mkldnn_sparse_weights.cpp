@@ -0,0 +1,142 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_sparse_weights.h"
+#include "mkldnn_weights_cache.h"
+#include <algorithm>
+#include <immintrin.h>
+#include <ie_parallel_for.hpp>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the share of the nonzero weights, below which the sparse multiplications beat the dense primitives:
+// a nonzero weight costs an indexed load besides the multiply-add, the dense kernels use wider vectors
+const float maxDensity = 0.2f;
+
+inline float horizontalSum(__m128 v) {
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+    return _mm_cvtss_f32(v);
+}
+
+}  // namespace
+
+bool MKLDNNSparseWeights::isSparse(const float *weights, size_t size) {
+    if (size == 0)
+        return false;
+    size_t nonzeros = size - std::count(weights, weights + size, 0.0f);
+    return nonzeros <= static_cast<size_t>(maxDensity * size);
+}
+
+MKLDNNSparseWeights::MKLDNNSparseWeights(const engine &eng, const float *weights, int rows, int cols)
+        : rows(rows), cols(cols) {
+    const size_t size = static_cast<size_t>(rows) * cols;
+    const int nonzeros = static_cast<int>(size - std::count(weights, weights + size, 0.0f));
+
+    // the empty matrices still get the memories, so the data pointers are never null
+    MKLDNNDims indicesDims({rows + 1 + nonzeros});
+    MKLDNNDims valuesDims({std::max(nonzeros, 1)});
+    MKLDNNMemoryDesc indicesDesc(indicesDims, memory::s32, memory::x);
+    MKLDNNMemoryDesc valuesDesc(valuesDims, memory::f32, memory::x);
+
+    auto createIndices = [&]() -> MKLDNNMemoryPtr {
+        MKLDNNMemoryPtr sparseMemory(new MKLDNNMemory(eng));
+        sparseMemory->Create(indicesDims, memory::s32, memory::x);
+        int *offsets = reinterpret_cast<int *>(sparseMemory->GetData());
+        int *columns = offsets + rows + 1;
+        int count = 0;
+        for (int r = 0; r < rows; r++) {
+            offsets[r] = count;
+            for (int c = 0; c < cols; c++) {
+                if (weights[static_cast<size_t>(r) * cols + c] != 0.0f)
+                    columns[count++] = c;
+            }
+        }
+        offsets[rows] = count;
+        return sparseMemory;
+    };
+    auto createValues = [&]() -> MKLDNNMemoryPtr {
+        MKLDNNMemoryPtr sparseMemory(new MKLDNNMemory(eng));
+        sparseMemory->Create(valuesDims, memory::f32, memory::x);
+        float *data = reinterpret_cast<float *>(sparseMemory->GetData());
+        std::remove_copy(weights, weights + size, data, 0.0f);
+        return sparseMemory;
+    };
+
+    indices = MKLDNNWeightsCache::findOrCreate(
+            MKLDNNWeightsCache::makeKey(weights, size * sizeof(float), indicesDesc, "sparse_indices"), createIndices);
+    values = MKLDNNWeightsCache::findOrCreate(
+            MKLDNNWeightsCache::makeKey(weights, size * sizeof(float), valuesDesc, "sparse_values"), createValues);
+}
+
+void MKLDNNSparseWeights::multiplyRows(const float *src, float *dst, int batch, const float *biases) const {
+    const int *offsets = reinterpret_cast<const int *>(indices->GetData());
+    const int *columns = offsets + rows + 1;
+    const float *weights = reinterpret_cast<const float *>(values->GetData());
+
+    // the nonzero values of a row are read once for the whole batch, the inputs are gathered by their columns
+    parallel_for(rows, [&](int r) {
+        const int begin = offsets[r];
+        const int end = offsets[r + 1];
+        const float bias = biases ? biases[r] : 0.0f;
+        for (int n = 0; n < batch; n++) {
+            const float *x = src + static_cast<size_t>(n) * cols;
+            __m128 sum = _mm_setzero_ps();
+            int i = begin;
+            for (; i <= end - 4; i += 4) {
+                const __m128 gathered = _mm_setr_ps(x[columns[i]], x[columns[i + 1]],
+                                                    x[columns[i + 2]], x[columns[i + 3]]);
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(weights + i), gathered));
+            }
+            float result = horizontalSum(sum);
+            for (; i < end; i++)
+                result += weights[i] * x[columns[i]];
+            dst[static_cast<size_t>(n) * rows + r] = result + bias;
+        }
+    });
+}
+
+void MKLDNNSparseWeights::multiplyChannels(const float *src, float *dst, int pixels, const float *biases) const {
+    const int *offsets = reinterpret_cast<const int *>(indices->GetData());
+    const int *columns = offsets + rows + 1;
+    const float *weights = reinterpret_cast<const float *>(values->GetData());
+
+    // an output channel accumulates the input channels of its nonzero weights, two of them per pass over it
+    parallel_for(rows, [&](int r) {
+        float *y = dst + static_cast<size_t>(r) * pixels;
+        std::fill(y, y + pixels, biases ? biases[r] : 0.0f);
+
+        const int end = offsets[r + 1];
+        int i = offsets[r];
+        for (; i <= end - 2; i += 2) {
+            const float *x0 = src + static_cast<size_t>(columns[i]) * pixels;
+            const float *x1 = src + static_cast<size_t>(columns[i + 1]) * pixels;
+            const __m128 w0 = _mm_set1_ps(weights[i]);
+            const __m128 w1 = _mm_set1_ps(weights[i + 1]);
+            int p = 0;
+            for (; p <= pixels - 4; p += 4) {
+                __m128 acc = _mm_loadu_ps(y + p);
+                acc = _mm_add_ps(acc, _mm_mul_ps(w0, _mm_loadu_ps(x0 + p)));
+                acc = _mm_add_ps(acc, _mm_mul_ps(w1, _mm_loadu_ps(x1 + p)));
+                _mm_storeu_ps(y + p, acc);
+            }
+            for (; p < pixels; p++)
+                y[p] += weights[i] * x0[p] + weights[i + 1] * x1[p];
+        }
+        if (i < end) {
+            const float *x0 = src + static_cast<size_t>(columns[i]) * pixels;
+            const __m128 w0 = _mm_set1_ps(weights[i]);
+            int p = 0;
+            for (; p <= pixels - 4; p += 4)
+                _mm_storeu_ps(y + p, _mm_add_ps(_mm_loadu_ps(y + p), _mm_mul_ps(w0, _mm_loadu_ps(x0 + p))));
+            for (; p < pixels; p++)
+                y[p] += weights[i] * x0[p];
+        }
+    });
+}
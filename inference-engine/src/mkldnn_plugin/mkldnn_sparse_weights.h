@@ -0,0 +1,61 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mkldnn.hpp>
+
+#include "mkldnn_memory.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The weights matrix [rows, cols] of a pruned layer in the compressed sparse row format: the nonzero values
+ * of every row with their columns. The matrix multiplications read only the nonzero weights, so they are faster
+ * than the dense primitives when most of the weights are zero (see isSparse).
+ * The rows are stored in the weights cache, so the graphs of the streams share them.
+ */
+class MKLDNNSparseWeights {
+public:
+    typedef std::shared_ptr<MKLDNNSparseWeights> Ptr;
+
+    /**
+     * @brief Tells if the weights have few enough nonzero values for the sparse multiplications to be faster
+     */
+    static bool isSparse(const float *weights, size_t size);
+
+    MKLDNNSparseWeights(const mkldnn::engine &eng, const float *weights, int rows, int cols);
+
+    int getRows() const {
+        return rows;
+    }
+    int getCols() const {
+        return cols;
+    }
+
+    /**
+     * @brief dst[n][r] = sum(weights[r][c] * src[n][c]) + biases[r] for the rows of the batch (fully connected layer)
+     * @param biases - the biases of the rows or nullptr
+     */
+    void multiplyRows(const float *src, float *dst, int batch, const float *biases) const;
+
+    /**
+     * @brief dst[r][p] = sum(weights[r][c] * src[c][p]) + biases[r] for the planar channels of an image
+     * (1x1 convolution without strides and paddings)
+     * @param biases - the biases of the rows or nullptr
+     */
+    void multiplyChannels(const float *src, float *dst, int pixels, const float *biases) const;
+
+private:
+    int rows;
+    int cols;
+    // the offsets of the rows (rows + 1 of them) followed by the columns of the nonzero values
+    MKLDNNMemoryPtr indices;
+    MKLDNNMemoryPtr values;
+};
+
+}  // namespace MKLDNNPlugin
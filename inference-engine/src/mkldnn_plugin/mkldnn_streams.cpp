@@ -0,0 +1,190 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <queue>
+#include <algorithm>
+#include <ie_profiling.hpp>
+#include "details/ie_exception.hpp"
+#include "mkldnn_streams.h"
+#include "mkldnn/omp_manager.h"
+#include <omp.h>
+
+namespace MKLDNNPlugin {
+
+thread_local MultiWorkerTaskContext MultiWorkerTaskExecutor::ptrContext;
+
+void pinStreamThreads(int streamId, int streams, bool bindThreads, const std::vector<unsigned> &teamCpus) {
+    if (!teamCpus.empty()) {
+        // the cpus of the network are split between the streams in the contiguous shares
+        const size_t first = streamId * teamCpus.size() / streams;
+        const size_t last = std::max(first + 1, (streamId + 1) * teamCpus.size() / streams);
+        std::vector<unsigned> streamCpus;
+        for (size_t i = first; i < last; i++)
+            streamCpus.push_back(teamCpus[i % teamCpus.size()]);
+        applyThreadTeam(streamCpus, bindThreads);
+        return;
+    }
+#if !(defined(__APPLE__) || defined(_WIN32))
+    // streams are evenly distributed over the NUMA nodes, so every stream is executed by the cores of a single node
+    // (as long as there are more streams than nodes), and the cores of the node are evenly split between its streams
+    const int nodes = cpu::OpenMpManager::getNumberOfNumaNodes();
+    const int node = streamId * nodes / streams;
+    int firstStreamOfNode = 0;
+    while (firstStreamOfNode * nodes / streams < node) firstStreamOfNode++;
+    int lastStreamOfNode = firstStreamOfNode;
+    while (lastStreamOfNode < streams && lastStreamOfNode * nodes / streams == node) lastStreamOfNode++;
+    const int streamsOfNode = lastStreamOfNode - firstStreamOfNode;
+
+    std::vector<unsigned> nodeCpus = cpu::OpenMpManager::getNumaNodeCpus(node);
+    const size_t cpusPerStream = std::max<size_t>(1, nodeCpus.size() / streamsOfNode);
+    const size_t firstCpu = std::min(nodeCpus.size(), (streamId - firstStreamOfNode) * cpusPerStream);
+    std::vector<unsigned> streamCpus(nodeCpus.begin() + firstCpu,
+                                     nodeCpus.begin() + std::min(nodeCpus.size(), firstCpu + cpusPerStream));
+    if (!streamCpus.empty()) {
+        if (bindThreads) {
+            // the workspace and the repacked weights are first touched by the (pinned) worker thread,
+            // so the memory of the stream's graph is allocated on the local NUMA node
+            cpu::OpenMpManager::bindOpenMpThreadsToCpus(streamCpus);
+        } else {
+            omp_set_num_threads(streamCpus.size());
+        }
+        return;
+    }
+#endif
+    omp_set_num_threads(std::max(1, cpu::OpenMpManager::getOpenMpThreadNumber() / streams));
+}
+
+std::vector<unsigned> getTeamCpus(int threadsNum, const std::vector<unsigned> &cores) {
+    if (threadsNum <= 0 && cores.empty())
+        return {};
+    std::vector<unsigned> cpus = cores;
+#if !(defined(__APPLE__) || defined(_WIN32))
+    for (unsigned cpu : cpus) {
+        if (!cpu::OpenMpManager::isCpuAvailable(cpu))
+            THROW_IE_EXCEPTION << "The cpu " << cpu << " of the network is not available to the process";
+    }
+    if (cpus.empty())
+        cpus = cpu::OpenMpManager::getAvailableCoreCpus();
+#endif
+    if (cpus.empty()) {
+        // no pinning, only the number of the threads is honored
+        const int threads = threadsNum > 0 ? threadsNum : cpu::OpenMpManager::getOpenMpThreadNumber();
+        for (int i = 0; i < threads; i++)
+            cpus.push_back(i);
+        return cpus;
+    }
+    if (threadsNum > 0) {
+        // more threads than cpus share the cpus round robin
+        std::vector<unsigned> team;
+        for (int i = 0; i < threadsNum; i++)
+            team.push_back(cpus[i % cpus.size()]);
+        cpus = team;
+    }
+    return cpus;
+}
+
+void applyThreadTeam(const std::vector<unsigned> &cpus, bool bindThreads) {
+    // the team is the setting of the calling thread, so the last applied one is remembered per thread
+    static thread_local std::vector<unsigned> appliedCpus;
+    static thread_local bool appliedBind = false;
+    if (cpus.empty() || (cpus == appliedCpus && bindThreads == appliedBind))
+        return;
+#if !(defined(__APPLE__) || defined(_WIN32))
+    if (bindThreads)
+        cpu::OpenMpManager::bindOpenMpThreadsToCpus(cpus);
+    else
+        omp_set_num_threads(cpus.size());
+#else
+    omp_set_num_threads(cpus.size());
+#endif
+    appliedCpus = cpus;
+    appliedBind = bindThreads;
+}
+
+void keepThreadsSpinning(int micros) {
+#if defined(KMP_VERSION_MAJOR)
+    // the block time is the setting of the calling thread, it is read once per thread as the call is on every Infer
+    static thread_local int blockTime = -1;
+    const int millis = (micros + 999) / 1000;
+    if (blockTime < 0)
+        blockTime = kmp_get_blocktime();
+    if (millis > blockTime) {
+        kmp_set_blocktime(millis);
+        blockTime = millis;
+    }
+#endif
+}
+
+MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<InferenceEngine::Task::Ptr>& init_tasks, std::string name) :
+        _isStopped(false), _name(name), _initCount(0) {
+    for (auto& t : init_tasks) {
+        _threads.emplace_back([&, t] {
+            // initialization (no contention, every worker thread is doing it's own task)
+            t->runNoThrowNoBusyCheck();
+            {
+                std::unique_lock<std::mutex> lock(_queueMutex);
+                _initCount++;
+            }
+            _queueCondVar.notify_all();
+
+            while (!_isStopped) {
+                bool isQueueEmpty;
+                InferenceEngine::Task::Ptr currentTask = nullptr;
+                {  // waiting for the new task or for stop signal
+                    std::unique_lock<std::mutex> lock(_queueMutex);
+                    _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
+                    isQueueEmpty = _taskQueue.empty();
+                    if (!isQueueEmpty) {
+                        currentTask = _taskQueue.front();
+                        _taskQueue.pop();
+                        isQueueEmpty = _taskQueue.empty();
+                    }
+                }
+                if (currentTask) {
+                    currentTask->runNoThrowNoBusyCheck();
+                }
+                if (_isStopped)
+                    break;
+                if (isQueueEmpty)  // notify dtor, that all tasks were completed
+                    _queueCondVar.notify_all();
+            }
+        });
+    }
+    // waiting for all the workers to complete their initialization
+    std::unique_lock<std::mutex> lock(_queueMutex);
+    _queueCondVar.wait(lock, [&]() { return _initCount == static_cast<int>(init_tasks.size()); });
+}
+
+MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
+    {
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        if (!_taskQueue.empty()) {
+            _queueCondVar.wait(lock, [this]() { return _taskQueue.empty(); });
+        }
+        _isStopped = true;
+        _queueCondVar.notify_all();
+    }
+    for (auto& thread : _threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+bool MultiWorkerTaskExecutor::startTask(InferenceEngine::Task::Ptr task) {
+    if (!task->occupy()) return false;
+    std::unique_lock<std::mutex> lock(_queueMutex);
+    _taskQueue.push(task);
+    _queueCondVar.notify_all();
+    return true;
+}
+
+}  // namespace MKLDNNPlugin
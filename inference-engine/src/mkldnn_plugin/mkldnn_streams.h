@@ -0,0 +1,100 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cpp_interfaces/ie_itask_executor.hpp>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNGraph;
+
+/**
+ * @brief Per-thread state of the MultiWorkerTaskExecutor worker.
+ * Every worker (stream) owns its own replica of the graph.
+ */
+struct MultiWorkerTaskContext {
+    std::shared_ptr<MKLDNNGraph> ptrGraph;
+};
+
+/**
+ * @class MultiWorkerTaskExecutor
+ * @brief Task executor with a number of worker threads (streams), each with its own initialization task.
+ * The initialization task is executed in the worker thread before any other task, so all memory
+ * allocated by it (e.g. graph replica) is local to the worker. The requests then are executed by the
+ * first worker that is free, in FIFO order.
+ */
+class MultiWorkerTaskExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    typedef std::shared_ptr<MultiWorkerTaskExecutor> Ptr;
+
+    explicit MultiWorkerTaskExecutor(const std::vector<InferenceEngine::Task::Ptr>&, std::string name = "Default");
+
+    ~MultiWorkerTaskExecutor();
+
+    /**
+     * @brief Adds task for execution and notifies one of the working threads about the new task.
+     * @note can be called from multiple threads - tasks will be added to the queue and executed in FIFO mode.
+     * @param task - shared pointer to the task to start
+     *  @return true if succeed to add task, otherwise - false
+     */
+    bool startTask(InferenceEngine::Task::Ptr task) override;
+
+    static thread_local MultiWorkerTaskContext ptrContext;
+
+private:
+    std::vector<std::thread> _threads;
+    std::mutex _queueMutex;
+    std::condition_variable _queueCondVar;
+    std::queue<InferenceEngine::Task::Ptr> _taskQueue;
+    std::atomic<bool> _isStopped;
+    std::string _name;
+    std::atomic<int> _initCount;
+};
+
+/**
+ * @brief Pins the OpenMP team of the calling (worker) thread to the subset of cores owned by the stream.
+ * The streams are distributed over the NUMA nodes, so the cores of a stream belong to the same node.
+ * @param streamId - index of the stream
+ * @param streams - total number of the streams
+ * @param bindThreads - whether the threads should be pinned or just their number limited
+ * @param teamCpus - the cpus of the network (see getTeamCpus), if not empty they are split between the streams
+ * instead of the cores of the NUMA nodes
+ */
+void pinStreamThreads(int streamId, int streams, bool bindThreads, const std::vector<unsigned> &teamCpus = {});
+
+/**
+ * @brief Returns the cpus of the thread team of a network (see KEY_CPU_THREADS_NUM and KEY_CPU_CORES), one cpu per
+ * thread, empty if neither is set and the team of the plugin is to be used. The cores default to the available
+ * physical cores, the hyper-threads are only taken when the cores are listed explicitly.
+ * Throws if a listed cpu is not available to the process. On the platforms without pinning only the size matters.
+ * @param threadsNum - the number of the threads, 0 takes one thread per core
+ * @param cores - the listed cpus, empty takes the available physical cores
+ */
+std::vector<unsigned> getTeamCpus(int threadsNum, const std::vector<unsigned> &cores);
+
+/**
+ * @brief Sizes the team of the parallel loops of the calling thread to the cpus and pins it to them if bindThreads
+ * is set. The team is kept per calling thread, so the call is cheap when the cpus are those of the previous call.
+ */
+void applyThreadTeam(const std::vector<unsigned> &cpus, bool bindThreads);
+
+/**
+ * @brief Keeps the OpenMP team of the calling thread spinning between the parallel regions at least for the given time
+ * (see KEY_CPU_LATENCY_SPIN), so the back to back inferences do not wake the sleeping threads up.
+ * Only the OpenMP runtimes with the block time control (Intel, LLVM) are affected, the block time is never reduced.
+ * @param micros - the time in microseconds
+ */
+void keepThreadsSpinning(int micros);
+
+}  // namespace MKLDNNPlugin
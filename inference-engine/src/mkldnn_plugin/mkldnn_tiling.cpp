@@ -0,0 +1,398 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tiling.h"
+#include "mkldnn_graph.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <graph_tools.hpp>
+#include <ie_util_internal.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the rows of a data relative to the rows of the inputs
+struct DataRows {
+    // the rows of the data per input row
+    int num = 1;
+    int den = 1;
+    // the first and the last rows of the data, which depend on the input rows out of the band window
+    int top = 0;
+    int bottom = 0;
+};
+
+int gcd(int a, int b) {
+    return b == 0 ? a : gcd(b, a % b);
+}
+
+int floorDiv(int a, int b) {
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+int ceilDiv(int a, int b) {
+    return -floorDiv(-a, b);
+}
+
+int roundUp(int a, int b) {
+    return ceilDiv(a, b) * b;
+}
+
+int rowsOf(const DataPtr &data) {
+    return static_cast<int>(data->getTensorDesc().getDims()[2]);
+}
+
+void scaleRows(DataRows &rows, int num, int den) {
+    rows.num *= num;
+    rows.den *= den;
+    int d = gcd(rows.num, rows.den);
+    rows.num /= d;
+    rows.den /= d;
+}
+
+// the output row j reads the input rows [j * stride - pad, j * stride - pad + extent)
+void windowRows(const DataRows &in, DataRows &out, int inRows, int outRows,
+                int kernel, int stride, int pad, int dilation) {
+    stride = std::max(stride, 1);
+    int extent = (kernel - 1) * std::max(dilation, 1) + 1;
+    out = in;
+    scaleRows(out, 1, stride);
+    out.top = std::max(0, ceilDiv(in.top + pad, stride));
+    out.bottom = std::max(0, outRows - 1 - floorDiv(inRows - in.bottom + pad - extent, stride));
+}
+
+// the output row o receives the input rows i with o = i * stride - pad + k * dilation
+void deconvolutionRows(const DataRows &in, DataRows &out, int inRows, int outRows,
+                       int kernel, int stride, int pad, int dilation) {
+    stride = std::max(stride, 1);
+    int extent = (kernel - 1) * std::max(dilation, 1) + 1;
+    out = in;
+    scaleRows(out, stride, 1);
+    out.top = std::max(0, (in.top - 1) * stride + extent - pad);
+    out.bottom = std::max(0, outRows - (inRows - in.bottom) * stride + pad);
+}
+
+// copies the rows of the samples between the blobs of the same layout, rows < 0 copies the whole samples
+void copyWindow(const Blob &src, int srcSample, int srcRow, Blob &dst, int dstSample, int dstRow,
+                int samples, int rows) {
+    const uint8_t *srcData = src.cbuffer().as<const uint8_t *>();
+    uint8_t *dstData = dst.buffer().as<uint8_t *>();
+    const SizeVector &srcDims = src.getTensorDesc().getDims();
+    const SizeVector &dstDims = dst.getTensorDesc().getDims();
+    const size_t elementSize = src.element_size();
+    const size_t srcSampleSize = src.size() / srcDims[0] * elementSize;
+    const size_t dstSampleSize = dst.size() / dstDims[0] * elementSize;
+
+    if (rows < 0) {
+        memcpy(dstData + dstSample * dstSampleSize, srcData + srcSample * srcSampleSize, samples * srcSampleSize);
+        return;
+    }
+
+    // the planar layout keeps the rows of every channel apart, the interleaved one keeps the channels in a row
+    const bool planar = src.getTensorDesc().getLayout() == NCHW;
+    const size_t planes = planar ? srcDims[1] : 1;
+    const size_t rowSize = srcDims[3] * (planar ? 1 : srcDims[1]) * elementSize;
+    const size_t srcPlaneSize = srcDims[2] * rowSize;
+    const size_t dstPlaneSize = dstDims[2] * rowSize;
+    for (int n = 0; n < samples; n++) {
+        for (size_t c = 0; c < planes; c++) {
+            memcpy(dstData + (dstSample + n) * dstSampleSize + c * dstPlaneSize + dstRow * rowSize,
+                   srcData + (srcSample + n) * srcSampleSize + c * srcPlaneSize + srcRow * rowSize,
+                   rows * rowSize);
+        }
+    }
+}
+
+}  // namespace
+
+MKLDNNGraphTiling::MKLDNNGraphTiling(ICNNNetwork &network, int batchTile, int spatialTiles) {
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    if (inputs.empty())
+        THROW_IE_EXCEPTION << "The network without inputs cannot be partitioned";
+
+    batch = static_cast<int>(inputs.begin()->second->getTensorDesc().getDims()[0]);
+    this->batchTile = batchTile > 0 ? std::min(batchTile, batch) : batch;
+    if (this->batchTile < batch) {
+        for (auto &input : inputs) {
+            if (input.second->getTensorDesc().getDims()[0] != static_cast<size_t>(batch))
+                THROW_IE_EXCEPTION << "The input " << input.first << " does not have the batch of the network, "
+                                   << "so the batch cannot be partitioned (KEY_CPU_BATCH_TILE)";
+        }
+        for (auto &output : outputs) {
+            if (output.second->getTensorDesc().getDims()[0] != static_cast<size_t>(batch))
+                THROW_IE_EXCEPTION << "The output " << output.first << " does not have the batch of the network, "
+                                   << "so the batch cannot be partitioned (KEY_CPU_BATCH_TILE)";
+        }
+    }
+
+    bandStarts = {0};
+    if (spatialTiles <= 1)
+        return;
+
+    std::map<Data *, DataRows> rows;
+    for (auto &input : inputs) {
+        const SizeVector &dims = input.second->getTensorDesc().getDims();
+        if (dims.size() != 4)
+            THROW_IE_EXCEPTION << "The input " << input.first << " is not an image, "
+                               << "so the rows cannot be partitioned (KEY_CPU_SPATIAL_TILES)";
+        if (height != 0 && dims[2] != static_cast<size_t>(height))
+            THROW_IE_EXCEPTION << "The inputs of the network have different heights, "
+                               << "so the rows cannot be partitioned (KEY_CPU_SPATIAL_TILES)";
+        if (input.second->getPreProcess().getMeanVariant() == MEAN_IMAGE)
+            THROW_IE_EXCEPTION << "The mean image of the input " << input.first << " covers the whole image, "
+                               << "so the rows cannot be partitioned (KEY_CPU_SPATIAL_TILES)";
+        height = static_cast<int>(dims[2]);
+        rows[input.second->getInputData().get()] = DataRows();
+    }
+
+    // the data are followed from the inputs: the scale of their rows and the rows depending on the band borders
+    int rowsGranularity = 1;
+    for (auto &layer : CNNNetSortTopologically(network)) {
+        auto type = TypeFromName(layer->type);
+        if (type == Input) {
+            if (layer->outData.empty() || rows.find(layer->outData[0].get()) == rows.end())
+                THROW_IE_EXCEPTION << "The constant " << layer->name << " is not partitioned with the input rows "
+                                   << "(KEY_CPU_SPATIAL_TILES)";
+            continue;
+        }
+
+        DataRows in;
+        bool first = true;
+        for (auto &insData : layer->insData) {
+            auto data = insData.lock();
+            auto dataRows = data ? rows.find(data.get()) : rows.end();
+            if (dataRows == rows.end() || data->getTensorDesc().getDims().size() != 4)
+                THROW_IE_EXCEPTION << "The input of the layer " << layer->name << " is not an image, "
+                                   << "so the rows cannot be partitioned (KEY_CPU_SPATIAL_TILES)";
+            if (!first && (dataRows->second.num != in.num || dataRows->second.den != in.den))
+                THROW_IE_EXCEPTION << "The inputs of the layer " << layer->name << " have different scales, "
+                                   << "so the rows cannot be partitioned (KEY_CPU_SPATIAL_TILES)";
+            in.num = dataRows->second.num;
+            in.den = dataRows->second.den;
+            in.top = std::max(first ? 0 : in.top, dataRows->second.top);
+            in.bottom = std::max(first ? 0 : in.bottom, dataRows->second.bottom);
+            first = false;
+        }
+        if (first || layer->outData.empty())
+            THROW_IE_EXCEPTION << "The layer " << layer->name << " has no inputs or outputs";
+
+        for (auto &outData : layer->outData) {
+            if (outData->getTensorDesc().getDims().size() != 4)
+                THROW_IE_EXCEPTION << "The output of the layer " << layer->name << " is not an image, "
+                                   << "so the rows cannot be partitioned (KEY_CPU_SPATIAL_TILES)";
+        }
+        const int inRows = rowsOf(layer->insData[0].lock());
+        const int outRows = rowsOf(layer->outData[0]);
+
+        DataRows out = in;
+        bool supported = true;
+        if (auto *conv = dynamic_cast<ConvolutionLayer *>(layer.get())) {
+            windowRows(in, out, inRows, outRows, conv->_kernel_y, conv->_stride_y, conv->_padding_y,
+                       conv->_dilation_y);
+        } else if (auto *deconv = dynamic_cast<DeconvolutionLayer *>(layer.get())) {
+            deconvolutionRows(in, out, inRows, outRows, deconv->_kernel_y, deconv->_stride_y, deconv->_padding_y,
+                              deconv->_dilation_y);
+        } else if (auto *pool = dynamic_cast<PoolingLayer *>(layer.get())) {
+            windowRows(in, out, inRows, outRows, pool->_kernel_y, pool->_stride_y, pool->_padding_y, 1);
+        } else if (type == Lrn) {
+            auto *norm = dynamic_cast<NormLayer *>(layer.get());
+            if (!norm)
+                supported = false;
+            else if (!norm->_isAcrossMaps)
+                windowRows(in, out, inRows, outRows, norm->_size, 1, norm->_size / 2, 1);
+        } else if (type == Concatenation) {
+            auto *concat = dynamic_cast<ConcatLayer *>(layer.get());
+            supported = concat && concat->_axis == 1;
+        } else if (type == Split) {
+            auto *split = dynamic_cast<SplitLayer *>(layer.get());
+            supported = split && split->_axis == 1;
+        } else if (type == SoftMax) {
+            auto *softmax = dynamic_cast<SoftMaxLayer *>(layer.get());
+            supported = softmax && softmax->axis == 1;
+        } else {
+            // the layers computing every pixel from the same pixel of the inputs
+            supported = type == Activation || type == Depthwise || type == Power || type == Eltwise ||
+                        type == BatchNormalization || type == Copy;
+        }
+        if (!supported)
+            THROW_IE_EXCEPTION << "The layer " << layer->name << " of type " << layer->type
+                               << " mixes the rows of the image, so they cannot be partitioned (KEY_CPU_SPATIAL_TILES)";
+
+        // the first rows of the bands must be the rows of all the data, i.e. the multiples of all the denominators
+        rowsGranularity = rowsGranularity / gcd(rowsGranularity, out.den) * out.den;
+        for (auto &outData : layer->outData)
+            rows[outData.get()] = out;
+    }
+
+    // the halos cover the rows of the outputs depending on the rows out of the band window
+    int haloTop = 0, haloBottom = 0;
+    for (auto &output : outputs) {
+        auto dataRows = rows.find(output.second.get());
+        if (dataRows == rows.end())
+            THROW_IE_EXCEPTION << "The output " << output.first << " does not depend on the inputs, "
+                               << "so the rows cannot be partitioned (KEY_CPU_SPATIAL_TILES)";
+        const DataRows &r = dataRows->second;
+        OutputRows &outRows = outputRows[output.first];
+        outRows.scaleNum = r.num;
+        outRows.scaleDen = r.den;
+        outRows.rows = rowsOf(output.second);
+        haloTop = std::max(haloTop, ceilDiv(r.top * r.den, r.num));
+        haloBottom = std::max(haloBottom, ceilDiv(r.bottom * r.den, r.num));
+    }
+
+    bandStep = roundUp(ceilDiv(height, spatialTiles), rowsGranularity);
+    const int bands = ceilDiv(height, bandStep);
+    haloTop = roundUp(haloTop, rowsGranularity);
+    haloBottom = roundUp(haloBottom, rowsGranularity);
+
+    // the rows of the full outputs kept from the band must be computed from the real data of its window, the rows
+    // lost to the borders of the full outputs (e.g. by the convolutions without padding) are added to the halo
+    for (; bands > 1; haloBottom += rowsGranularity) {
+        // the windows of the same height start at the multiples of the granularity, the last one ends on the
+        // last row of the inputs
+        tileRows = bandStep + haloTop + haloBottom;
+        tileRows += ((height - tileRows) % rowsGranularity + rowsGranularity) % rowsGranularity;
+        if (tileRows >= height)
+            break;
+
+        bandStarts.resize(bands);
+        for (int band = 0; band < bands; band++)
+            bandStarts[band] = std::min(std::max(0, band * bandStep - haloTop), height - tileRows);
+
+        bool valid = true;
+        for (int band = 0; band < bands && valid; band++) {
+            for (auto &output : outputs) {
+                const DataRows &r = rows[output.second.get()];
+                const OutputRows &outRows = outputRows[output.first];
+                const int tileOutRows = outRows.rows - (height - tileRows) * r.num / r.den;
+                const int shift = bandStarts[band] * r.num / r.den;
+                const int first = band == 0 ? 0 : std::min(outRows.rows, band * bandStep * r.num / r.den);
+                const int last = band == bands - 1 ? outRows.rows
+                                                   : std::min(outRows.rows, (band + 1) * bandStep * r.num / r.den);
+                const int validFirst = shift + (bandStarts[band] > 0 ? r.top : 0);
+                const int validLast = shift + tileOutRows - (bandStarts[band] + tileRows < height ? r.bottom : 0);
+                if (first < last && (first < validFirst || last > validLast))
+                    valid = false;
+            }
+        }
+        if (valid)
+            return;
+    }
+
+    // the halo covers the whole inputs, the network is run on the whole rows
+    tileRows = height;
+    bandStep = height;
+    bandStarts = {0};
+}
+
+SizeVector MKLDNNGraphTiling::tileDims(const SizeVector &dims, int rows) const {
+    SizeVector tile = dims;
+    tile[0] = batchTile;
+    if (rows >= 0)
+        tile[2] = rows;
+    return tile;
+}
+
+details::CNNNetworkImplPtr MKLDNNGraphTiling::createTileNetwork(ICNNNetwork &network) const {
+    const bool bands = bandStarts.size() > 1;
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    std::map<std::string, SizeVector> shapes;
+    for (auto &input : inputs)
+        shapes[input.first] = tileDims(input.second->getTensorDesc().getDims(), bands ? tileRows : -1);
+
+    // the copy shares the weights with the original network, only the dimensions of the data are changed
+    auto tileNetwork = cloneNet(network);
+    ResponseDesc resp;
+    if (tileNetwork->reshape(shapes, &resp) != OK)
+        THROW_IE_EXCEPTION << "Failed to reshape the network to the tile: " << resp.msg;
+
+    // the layers shifted by the band window must shift their outputs by the scaled rows, e.g. the global pooling
+    // computes other values on the band
+    if (bands) {
+        OutputsDataMap outputs;
+        tileNetwork->getOutputsInfo(outputs);
+        for (auto &output : outputs) {
+            const OutputRows &outRows = outputRows.at(output.first);
+            const int expected = outRows.rows - (height - tileRows) * outRows.scaleNum / outRows.scaleDen;
+            if (rowsOf(output.second) != expected)
+                THROW_IE_EXCEPTION << "The rows of the output " << output.first << " do not follow the rows of the "
+                                   << "band, so the rows cannot be partitioned (KEY_CPU_SPATIAL_TILES)";
+        }
+    }
+    return tileNetwork;
+}
+
+void MKLDNNGraphTiling::Infer(MKLDNNGraph &graph, const BlobMap &inputs, BlobMap &outputs,
+                              PerfCounters *counters, MKLDNNBlobPool &tilePool) const {
+    const bool bands = bandStarts.size() > 1;
+
+    // the windows of the blobs, the output ones receive the converted data of the graph outputs. They are kept by the
+    // pool of the request apart for the inputs and the outputs, so an input and an output of the same name do not
+    // reallocate each other every inference
+    BlobMap tileInputs, tileOutputs;
+    for (auto &input : inputs) {
+        const TensorDesc &desc = input.second->getTensorDesc();
+        if (desc.getPrecision() != Precision::FP32 && desc.getPrecision() != Precision::U8)
+            THROW_IE_EXCEPTION << "The input " << input.first << " of precision " << desc.getPrecision()
+                               << " is not supported by the partitioned inference";
+        if (bands && desc.getLayout() != NCHW && desc.getLayout() != NHWC)
+            THROW_IE_EXCEPTION << "The input " << input.first << " of layout " << desc.getLayout()
+                               << " is not supported by the partitioned inference";
+        if (!MKLDNNMemory::IsDenseDesc(desc))
+            THROW_IE_EXCEPTION << "The input " << input.first << " with the strides of a view "
+                               << "is not supported by the partitioned inference";
+        const TensorDesc tileDesc(desc.getPrecision(), tileDims(desc.getDims(), bands ? tileRows : -1),
+                                  desc.getLayout());
+        tileInputs[input.first] = tilePool.get("in:" + input.first, tileDesc);
+    }
+    for (auto &output : outputs) {
+        const TensorDesc &desc = output.second->getTensorDesc();
+        if (bands && desc.getLayout() != NCHW && desc.getLayout() != NHWC)
+            THROW_IE_EXCEPTION << "The output " << output.first << " of layout " << desc.getLayout()
+                               << " is not supported by the partitioned inference";
+        const OutputRows *outRows = bands ? &outputRows.at(output.first) : nullptr;
+        const int rows = outRows ? outRows->rows - (height - tileRows) * outRows->scaleNum / outRows->scaleDen : -1;
+        const TensorDesc tileDesc(desc.getPrecision(), tileDims(desc.getDims(), rows), desc.getLayout());
+        tileOutputs[output.first] = tilePool.get("out:" + output.first, tileDesc);
+    }
+
+    for (int sample = 0; sample < batch; sample += batchTile) {
+        // the samples of the last tile after the end of the batch keep the data of the previous tile
+        const int samples = std::min(batchTile, batch - sample);
+        for (size_t band = 0; band < bandStarts.size(); band++) {
+            for (auto &input : inputs) {
+                copyWindow(*input.second, sample, bandStarts[band], *tileInputs[input.first], 0, 0, samples,
+                           bands ? tileRows : -1);
+                graph.PushInputData(input.first, tileInputs[input.first]);
+            }
+
+            graph.Infer(-1, counters);
+            graph.PullOutputData(tileOutputs);
+
+            for (auto &output : outputs) {
+                if (!bands) {
+                    copyWindow(*tileOutputs[output.first], 0, 0, *output.second, sample, 0, samples, -1);
+                    continue;
+                }
+                const OutputRows &outRows = outputRows.at(output.first);
+                const int num = outRows.scaleNum, den = outRows.scaleDen;
+                const int first = band == 0 ? 0 : std::min(outRows.rows, static_cast<int>(band) * bandStep * num / den);
+                const int last = band + 1 == bandStarts.size() ? outRows.rows
+                                 : std::min(outRows.rows, static_cast<int>(band + 1) * bandStep * num / den);
+                if (first < last)
+                    copyWindow(*tileOutputs[output.first], 0, first - bandStarts[band] * num / den, *output.second,
+                               sample, first, samples, last - first);
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ie_icnn_network.hpp>
+#include <ie_blob.h>
+#include <cnn_network_impl.hpp>
+#include "perf_count.h"
+#include "mkldnn_blob_pool.h"
+
+namespace MKLDNNPlugin {
+
+class MKLDNNGraph;
+
+/**
+ * @class MKLDNNGraphTiling
+ * @brief The partitioning of the inference of the large inputs (see KEY_CPU_BATCH_TILE and KEY_CPU_SPATIAL_TILES):
+ * the graph is compiled for one tile of the inputs, i.e. for a part of the batch and/or a band of the image rows,
+ * and the inference runs it tile by tile, copying the windows of the input blobs in and the rows of the outputs out.
+ * The bands overlap by the halo of the receptive fields of the layers, only the rows computed from the real data of
+ * the band are taken from every tile, so the stitched outputs are equal to the outputs of the whole inputs.
+ */
+class MKLDNNGraphTiling {
+public:
+    typedef std::shared_ptr<MKLDNNGraphTiling> Ptr;
+
+    /**
+     * @brief Plans the tiles, throws if the layers of the network do not allow the requested partitioning
+     * @param batchTile - the samples of one tile, 0 keeps the batch of the network
+     * @param spatialTiles - the bands of the image rows, 0 or 1 keeps the rows of the network
+     */
+    MKLDNNGraphTiling(InferenceEngine::ICNNNetwork &network, int batchTile, int spatialTiles);
+
+    /**
+     * @brief Returns false if the inputs fit one tile, the graph of the whole network is to be used then
+     */
+    bool isTiled() const {
+        return batchTile < batch || bandStarts.size() > 1;
+    }
+
+    /**
+     * @brief Returns the copy of the network reshaped to the dimensions of one tile
+     */
+    InferenceEngine::details::CNNNetworkImplPtr createTileNetwork(InferenceEngine::ICNNNetwork &network) const;
+
+    /**
+     * @brief Runs the graph compiled for the tile network over the whole inputs
+     * @param graph - the graph of the tile network
+     * @param inputs - the input blobs of the network dimensions
+     * @param outputs - the output blobs of the network dimensions, they receive the stitched outputs
+     * @param counters - the per node statistics accumulated over the tiles
+     * @param tilePool - the blobs of the tiles, they are reused by the next inferences of the request
+     */
+    void Infer(MKLDNNGraph &graph, const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &outputs,
+               PerfCounters *counters, MKLDNNBlobPool &tilePool) const;
+
+private:
+    // the rows of an output: the output rows per input row is scaleNum / scaleDen, the full output has
+    // rows = height * scaleNum / scaleDen + offset rows
+    struct OutputRows {
+        int scaleNum = 1;
+        int scaleDen = 1;
+        int offset = 0;
+        int rows = 0;
+    };
+
+    InferenceEngine::SizeVector tileDims(const InferenceEngine::SizeVector &dims, int rows) const;
+
+    int batch = 1;
+    int batchTile = 1;
+    // the rows of the inputs, the rows of the band window and the first input row of every band window
+    int height = 0;
+    int tileRows = 0;
+    std::vector<int> bandStarts;
+    // the input rows of the band without the halo, the first band takes the rows from 0
+    int bandStep = 0;
+    std::map<std::string, OutputRows> outputRows;
+};
+
+}  // namespace MKLDNNPlugin
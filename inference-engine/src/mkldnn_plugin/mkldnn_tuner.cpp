@@ -0,0 +1,209 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tuner.h"
+#include "mkldnn_graph.h"
+#include "mkldnn/iml_type_mapper.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <ie_util_internal.hpp>
+#include <details/ie_cnn_network_iterator.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+const char PRIORITY_PARAM[] = "PrimitivesPriority";
+
+// the best of several runs filters out the noise of the machine
+const int TIMING_ITERATIONS = 10;
+
+uint64_t timeNode(const MKLDNNNodePtr &node) {
+    // the reorders inserted for the layout of the chosen implementation are a part of its cost
+    std::vector<MKLDNNNodePtr> nodes;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        auto parent = node->getParentEdgeAt(i)->getParent();
+        if (parent->getType() == Reorder)
+            nodes.push_back(parent);
+    }
+    nodes.push_back(node);
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto child = node->getChildEdgeAt(i)->getChild();
+        if (child->getType() == Reorder)
+            nodes.push_back(child);
+    }
+
+    mkldnn::stream stream(mkldnn::stream::kind::eager);
+    uint64_t best = std::numeric_limits<uint64_t>::max();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto &n : nodes)
+            n->execute(stream);
+        auto finish = std::chrono::high_resolution_clock::now();
+        best = std::min<uint64_t>(best, std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count());
+    }
+    return best;
+}
+
+}  // namespace
+
+MKLDNNTuner::MKLDNNTuner(const Config &config) : config(config) {
+    // the tuning graphs are never executed together with the other graphs of the memory domain
+    this->config.memoryDomain.clear();
+    this->config.tuningMode = Config::TuningMode::Disabled;
+
+    if (config.tuningFile.empty())
+        THROW_IE_EXCEPTION << "The tuning file is not specified for the tuning mode of the CPU plugin";
+
+    std::ifstream file(config.tuningFile);
+    if (!file.is_open()) {
+        if (config.tuningMode == Config::TuningMode::UseExisting)
+            THROW_IE_EXCEPTION << "Cannot open the tuning file " << config.tuningFile;
+        return;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t pos = line.rfind('\t');
+        if (pos == std::string::npos)
+            continue;
+        winners[line.substr(0, pos)] = line.substr(pos + 1);
+    }
+}
+
+bool MKLDNNTuner::isTunable(const CNNLayerPtr &layer) {
+    return layer->type == "Convolution" || layer->type == "Deconvolution" || layer->type == "Pooling";
+}
+
+std::string MKLDNNTuner::getLayerKey(const CNNLayerPtr &layer) {
+    std::ostringstream key;
+    key << layer->type << ";" << layer->precision.name();
+    auto addDims = [&](const SizeVector &dims) {
+        key << ";";
+        for (size_t i = 0; i < dims.size(); i++)
+            key << (i ? "x" : "") << dims[i];
+    };
+    for (auto &inData : layer->insData)
+        addDims(inData.lock()->getDims());
+    for (auto &outData : layer->outData)
+        addDims(outData->getDims());
+    for (auto &param : layer->params) {
+        if (param.first != PRIORITY_PARAM)
+            key << ";" << param.first << "=" << param.second;
+    }
+
+    // the key and the implementation are separated by a tab in the file, the key is kept in one word
+    std::string str = key.str();
+    str.erase(std::remove_if(str.begin(), str.end(), ::isspace), str.end());
+    return str;
+}
+
+void MKLDNNTuner::tune(ICNNNetwork &network, const MKLDNNExtensionManager::Ptr &extMgr) {
+    // the implementation types of the supported primitive descriptors are the candidates of a layer
+    std::map<std::string, std::vector<impl_desc_type>> candidates;
+    size_t rounds = 0;
+    {
+        MKLDNNGraph graph;
+        graph.setConfig(config);
+        graph.CreateGraph(network, extMgr);
+        for (auto &node : graph.GetNodes()) {
+            auto layer = node->getCnnLayer();
+            if (!layer || !isTunable(layer) || layer->params.find(PRIORITY_PARAM) != layer->params.end() ||
+                    winners.find(getLayerKey(layer)) != winners.end())
+                continue;
+
+            std::vector<impl_desc_type> types;
+            for (auto &desc : node->getSupportedPrimitiveDescriptors()) {
+                if (std::find(types.begin(), types.end(), desc.getImplementationType()) == types.end())
+                    types.push_back(desc.getImplementationType());
+            }
+            if (types.size() > 1) {
+                rounds = std::max(rounds, types.size());
+                candidates[layer->name] = types;
+            }
+        }
+    }
+
+    // every round forces the next candidate of all the layers at once, so the number of the graphs
+    // to create is the largest number of the candidates of a layer
+    std::map<std::string, std::map<std::string, uint64_t>> timings;
+    for (size_t round = 0; round < rounds; round++) {
+        auto tuningNetwork = cloneNet(network);
+        for (auto &layerCandidates : candidates) {
+            if (round >= layerCandidates.second.size())
+                continue;
+            CNNLayerPtr layer;
+            if (tuningNetwork->getLayerByName(layerCandidates.first.c_str(), layer, nullptr) != OK)
+                THROW_IE_EXCEPTION << "Cannot find layer " << layerCandidates.first << " in the tuning network";
+            layer->params[PRIORITY_PARAM] = "cpu:" + impl_type_to_string(layerCandidates.second[round]);
+        }
+
+        MKLDNNGraph graph;
+        graph.setConfig(config);
+        graph.CreateGraph(*tuningNetwork, extMgr);
+
+        // the intermediate data are filled by an inference from the zero inputs
+        BlobMap inputs;
+        graph.getInputBlobs(inputs);
+        for (auto &input : inputs)
+            memset(input.second->buffer(), 0, input.second->byteSize());
+        graph.Infer();
+
+        for (auto &node : graph.GetNodes()) {
+            auto layer = node->getCnnLayer();
+            auto layerCandidates = layer ? candidates.find(layer->name) : candidates.end();
+            if (layerCandidates == candidates.end() || round >= layerCandidates->second.size() ||
+                    node->getSelectedPrimitiveDescriptor() == nullptr)
+                continue;
+
+            // the selected type differs from the forced one, if the candidate can not work with the layouts
+            // of the neighbours, such a choice is timed as it is
+            std::string type = node->getPrimitiveDescriptorType();
+            auto &layerTimings = timings[getLayerKey(layer)];
+            uint64_t time = timeNode(node);
+            if (layerTimings.find(type) == layerTimings.end() || layerTimings[type] > time)
+                layerTimings[type] = time;
+        }
+    }
+
+    for (auto &layerTimings : timings) {
+        auto fastest = std::min_element(layerTimings.second.begin(), layerTimings.second.end(),
+                                        [](const std::pair<const std::string, uint64_t> &a,
+                                           const std::pair<const std::string, uint64_t> &b) {
+                                            return a.second < b.second;
+                                        });
+        winners[layerTimings.first] = fastest->first;
+    }
+    save();
+}
+
+void MKLDNNTuner::apply(ICNNNetwork &network) const {
+    details::CNNNetworkIterator i(&network);
+    for (; i != details::CNNNetworkIterator(); i++) {
+        CNNLayerPtr layer = *i;
+        if (!isTunable(layer) || layer->params.find(PRIORITY_PARAM) != layer->params.end())
+            continue;
+        auto winner = winners.find(getLayerKey(layer));
+        if (winner != winners.end())
+            layer->params[PRIORITY_PARAM] = "cpu:" + winner->second;
+    }
+}
+
+void MKLDNNTuner::save() const {
+    std::ofstream file(config.tuningFile);
+    if (!file.is_open())
+        THROW_IE_EXCEPTION << "Cannot open the tuning file " << config.tuningFile << " for writing";
+    for (auto &winner : winners)
+        file << winner.first << "\t" << winner.second << "\n";
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <ie_icnn_network.hpp>
+
+#include "config.h"
+#include "mkldnn_extension_mngr.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Selects the implementations of the convolutions, deconvolutions and poolings by timing them on the machine
+ * (see PluginConfigParams::KEY_TUNING_MODE).
+ * The candidates of a layer are the implementation types of its supported primitive descriptors (direct jit,
+ * winograd, 1x1, gemm, ...). Every candidate is forced through the "PrimitivesPriority" parameter of the layer,
+ * and the node is timed together with the reorders inserted around it. The winners are stored in the tuning file
+ * by the layer parameters and shapes, so a file created for one network is also used for the layers of the others.
+ */
+class MKLDNNTuner {
+public:
+    /**
+     * @brief Reads the tuning file, a missing file is an error in TUNING_USE_EXISTING mode only
+     */
+    explicit MKLDNNTuner(const Config &config);
+
+    /**
+     * @brief Times the candidates of the layers missing in the tuning file and saves the updated file
+     */
+    void tune(InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr &extMgr);
+
+    /**
+     * @brief Sets the "PrimitivesPriority" parameter of the tuned layers, the priorities specified by the user
+     * are kept
+     */
+    void apply(InferenceEngine::ICNNNetwork &network) const;
+
+    static std::string getLayerKey(const InferenceEngine::CNNLayerPtr &layer);
+
+private:
+    static bool isTunable(const InferenceEngine::CNNLayerPtr &layer);
+    void save() const;
+
+    Config config;
+    // the layer key to the name of the fastest implementation type
+    std::map<std::string, std::string> winners;
+};
+
+}  // namespace MKLDNNPlugin
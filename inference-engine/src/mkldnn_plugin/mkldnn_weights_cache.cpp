@@ -0,0 +1,84 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_weights_cache.h"
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+std::mutex &MKLDNNWeightsCache::mutex() {
+    static std::mutex cacheMutex;
+    return cacheMutex;
+}
+
+std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> &MKLDNNWeightsCache::storage() {
+    static std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> cache;
+    return cache;
+}
+
+MKLDNNMemoryPtr MKLDNNWeightsCache::findOrCreate(const std::string &key,
+                                                 const std::function<MKLDNNMemoryPtr()> &create) {
+    std::lock_guard<std::mutex> lock(mutex());
+    auto &cache = storage();
+    auto found = cache.find(key);
+    if (found != cache.end()) {
+        auto memory = found->second.lock();
+        if (memory)
+            return memory;
+    }
+
+    // the memories of the unloaded graphs are gone, so their keys are dropped
+    for (auto it = cache.begin(); it != cache.end();) {
+        if (it->second.expired())
+            it = cache.erase(it);
+        else
+            it++;
+    }
+
+    auto memory = create();
+    cache[key] = memory;
+    return memory;
+}
+
+std::string MKLDNNWeightsCache::makeKey(const void *data, size_t size, const mkldnn::memory::desc &desc,
+                                        const std::string &tag) {
+    std::stringstream key;
+    key << std::hex << hash(data, size) << std::dec << "_" << size << "_" << desc.data.data_type << "_"
+        << desc.data.format << "_";
+    for (int i = 0; i < desc.data.ndims; i++)
+        key << desc.data.dims[i] << ",";
+    key << "_" << tag;
+    return key.str();
+}
+
+size_t MKLDNNWeightsCache::size() {
+    std::lock_guard<std::mutex> lock(mutex());
+    size_t count = 0;
+    for (auto &it : storage())
+        if (!it.second.expired())
+            count++;
+    return count;
+}
+
+uint64_t MKLDNNWeightsCache::hash(const void *data, size_t size) {
+    // FNV-1a over the 8 byte words, the tail is hashed byte by byte
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t result = 0xcbf29ce484222325ULL;
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    size_t words = size / sizeof(uint64_t);
+    for (size_t i = 0; i < words; i++) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+        result = (result ^ word) * prime;
+    }
+    for (size_t i = words * sizeof(uint64_t); i < size; i++)
+        result = (result ^ bytes[i]) * prime;
+    return result;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,57 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "mkldnn_memory.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Process-wide storage of the weights repacked to the formats of the primitives (e.g. OIhw8i8o).
+ * The memory is found by the hash of the original weights and the description of the target memory, so the same
+ * model loaded twice, the graphs of the streams and the graphs of the reshaped inputs keep one copy of the repacked
+ * weights. The memory is shared read-only and exists as long as any node uses it.
+ */
+class MKLDNNWeightsCache {
+public:
+    /**
+     * @brief Returns the memory stored with the key or creates and stores it
+     * @param key - the key made by makeKey
+     * @param create - creates the memory with the repacked weights if it is not stored
+     */
+    static MKLDNNMemoryPtr findOrCreate(const std::string &key, const std::function<MKLDNNMemoryPtr()> &create);
+
+    /**
+     * @brief Makes the key of the weights repacked to the memory of the given description
+     * @param data - the original weights
+     * @param size - the size of the original weights in bytes
+     * @param desc - the description of the target memory
+     * @param tag - distinguishes the memory of the same weights and description, which differs by other reason
+     * (e.g. allocator or source format)
+     */
+    static std::string makeKey(const void *data, size_t size, const mkldnn::memory::desc &desc, const std::string &tag);
+
+    /**
+     * @brief Returns the number of the stored memories, which are still used
+     */
+    static size_t size();
+
+private:
+    static uint64_t hash(const void *data, size_t size);
+
+    static std::mutex &mutex();
+    static std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> &storage();
+};
+
+}  // namespace MKLDNNPlugin
@@ -7,6 +7,7 @@
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <algorithm>
+#include <cmath>
 #include <string>
 #include <mkldnn_extension_utils.h>
 
@@ -16,7 +17,9 @@ using namespace InferenceEngine;
 
 caseless_map<std::string, std::function<void(GenericLayer*, mkldnn::algorithm&, float&, float&)>> MKLDNNActivationNode::initializers = {
         {"relu", [](GenericLayer* activationLayer, mkldnn::algorithm& algorithm, float& alpha, float& beta) {
-            alpha = activationLayer->GetParamAsFloat("negative_slope", 0.0f);
+            // the ReLU and Clamp layers of the IR come with the params parsed by their validators
+            auto reluLayer = dynamic_cast<ReLULayer*>(activationLayer);
+            alpha = reluLayer ? reluLayer->negative_slope : activationLayer->GetParamAsFloat("negative_slope", 0.0f);
             beta = 0.0f;
             algorithm = eltwise_relu;
         }},
@@ -71,8 +74,9 @@ caseless_map<std::string, std::function<void(GenericLayer*, mkldnn::algorithm&,
             algorithm = eltwise_bounded_relu;
         }},
         {"clamp", [](GenericLayer* activationLayer, mkldnn::algorithm& algorithm, float& alpha, float& beta) {
-            alpha = activationLayer->GetParamAsFloat("max", 1.0f);
-            beta = activationLayer->GetParamAsFloat("min", 0.0f);
+            auto clampLayer = dynamic_cast<ClampLayer*>(activationLayer);
+            alpha = clampLayer ? clampLayer->max_value : activationLayer->GetParamAsFloat("max", 1.0f);
+            beta = clampLayer ? clampLayer->min_value : activationLayer->GetParamAsFloat("min", 0.0f);
             algorithm = eltwise_clamp;
         }}
 };
@@ -128,13 +132,67 @@ void MKLDNNActivationNode::initValues() {
     if (comparator(type, "sigmoid"))
         type = "logistic";
 
-    if (initializers.find(type) == initializers.end())
+    auto initializer = initializers.find(type);
+    if (initializer == initializers.end())
         THROW_IE_EXCEPTION << "Node " << getName() << " has unsupported activation primitive: "
                            << activationLayer->type << " : " << type;
-    initializers[type](activationLayer, algorithm, alpha, beta);
+    initializer->second(activationLayer, algorithm, alpha, beta);
     initialized = true;
 }
 
+void MKLDNNActivationNode::apply(float *data, size_t size) {
+    const float a = getAlpha();
+    const float b = getBeta();
+    switch (getAlgorithm()) {
+        case eltwise_relu:
+            for (size_t i = 0; i < size; i++)
+                data[i] = data[i] > 0.0f ? data[i] : data[i] * a;
+            break;
+        case eltwise_elu:
+            for (size_t i = 0; i < size; i++)
+                data[i] = data[i] > 0.0f ? data[i] : a * (std::exp(data[i]) - 1.0f);
+            break;
+        case eltwise_tanh:
+            for (size_t i = 0; i < size; i++)
+                data[i] = std::tanh(data[i]);
+            break;
+        case eltwise_logistic:
+            for (size_t i = 0; i < size; i++)
+                data[i] = 1.0f / (1.0f + std::exp(-data[i]));
+            break;
+        case eltwise_square:
+            for (size_t i = 0; i < size; i++)
+                data[i] = data[i] * data[i];
+            break;
+        case eltwise_abs:
+            for (size_t i = 0; i < size; i++)
+                data[i] = std::fabs(data[i]);
+            break;
+        case eltwise_sqrt:
+            for (size_t i = 0; i < size; i++)
+                data[i] = data[i] > 0.0f ? std::sqrt(data[i]) : 0.0f;
+            break;
+        case eltwise_linear:
+            for (size_t i = 0; i < size; i++)
+                data[i] = a * data[i] + b;
+            break;
+        case eltwise_bounded_relu:
+            for (size_t i = 0; i < size; i++)
+                data[i] = std::min(std::max(data[i], 0.0f), a);
+            break;
+        case eltwise_soft_relu:
+            for (size_t i = 0; i < size; i++)
+                data[i] = std::log1p(std::exp(data[i]));
+            break;
+        case eltwise_clamp:
+            for (size_t i = 0; i < size; i++)
+                data[i] = data[i] > a ? a : (data[i] < b ? b : data[i]);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported activation of node " << getName();
+    }
+}
+
 void MKLDNNActivationNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                             const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
     MKLDNNMemoryDesc inDesc(inputDesc[0]);
@@ -25,6 +25,9 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void createPrimitive() override;
     bool created() const override;
+    bool canShareInputMemory(size_t inputIdx) const override {
+        return true;
+    }
 
     mkldnn::algorithm getAlgorithm() {
         if (!initialized)
@@ -44,6 +47,11 @@ public:
         return beta;
     }
 
+    /**
+     * @brief Applies the activation to the planar data in place, for the custom kernels of the nodes it is fused to
+     */
+    void apply(float *data, size_t size);
+
     MKLDNNMemoryDesc getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
     MKLDNNMemoryDesc getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
 
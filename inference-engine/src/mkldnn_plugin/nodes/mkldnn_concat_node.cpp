@@ -55,18 +55,25 @@ void MKLDNNConcatNode::getSupportedDescriptors() {
     }
 }
 
+InferenceEngine::Precision MKLDNNConcatNode::getDataPrecision() {
+    // int8 data between two int8 convolutions passes through the concatenation as is
+    InferenceEngine::Precision precision = getCnnLayer()->outData[0]->getPrecision();
+    if (precision != InferenceEngine::Precision::U8 && precision != InferenceEngine::Precision::I8)
+        return InferenceEngine::Precision::FP32;
+    for (auto &input : getCnnLayer()->insData) {
+        if (input.lock()->getPrecision() != precision)
+            return InferenceEngine::Precision::FP32;
+    }
+    return precision;
+}
+
 void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
-        precision = InferenceEngine::Precision::FP32;
+    InferenceEngine::Precision precision = getDataPrecision();
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
-    precision = getCnnLayer()->outData[0]->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
-        precision = InferenceEngine::Precision::FP32;
-    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+    auto outputDataType = inputDataType;
 
     MKLDNNDims dstDims = getChildEdgeAt(0)->getDims();
     InferenceEngine::LayerConfig config;
@@ -104,7 +111,8 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    if (axis != 1 || hasEltwise)
+    // The inputs are views of the output along any axis except the batch one, which may be cut by the dynamic batch
+    if (axis == 0 || hasEltwise)
         return;
 
     auto numOfDim = static_cast<size_t>(dstDims.ndims());
@@ -127,11 +135,11 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    config.outConfs[0].desc = TensorDesc(Precision::FP32, dstDims.ToSizeVector(), {dstDims.ToSizeVector(), order, offset, offsets, strides});
+    config.outConfs[0].desc = TensorDesc(precision, dstDims.ToSizeVector(), {dstDims.ToSizeVector(), order, offset, offsets, strides});
     for (size_t i = 0; i < getParentEdges().size(); i++) {
         auto parentEdge = getParentEdgeAt(i);
         config.inConfs[i].inPlace = 0;
-        config.inConfs[i].desc = TensorDesc(Precision::FP32, parentEdge->getDims().ToSizeVector(),
+        config.inConfs[i].desc = TensorDesc(precision, parentEdge->getDims().ToSizeVector(),
                                             {parentEdge->getDims().ToSizeVector(), order, offset, offsets, strides});
     }
 
@@ -159,7 +167,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                     strides[numOfDim - i] = strides[numOfDim - i + 1] * blkDims[numOfDim - i + 1];
                 }
             }
-            config.outConfs[0].desc = TensorDesc(Precision::FP32, dstDims.ToSizeVector(), {blkDims, order, offset, offsets, strides});
+            config.outConfs[0].desc = TensorDesc(precision, dstDims.ToSizeVector(), {blkDims, order, offset, offsets, strides});
 
             bool canInplace = true;
             for (size_t i = 0; canInplace && i < getParentEdges().size(); i++) {
@@ -170,7 +178,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
                 blkDims[1] = blkDims[1] / sizeS + (blkDims[1] % sizeS ? 1 : 0);
                 blkDims.push_back(sizeS);
-                config.inConfs[i].desc =  TensorDesc(Precision::FP32, parentEdge->getDims().ToSizeVector(),
+                config.inConfs[i].desc =  TensorDesc(precision, parentEdge->getDims().ToSizeVector(),
                                                      {blkDims, order, offset, offsets, strides});
             }
             if (canInplace)
@@ -180,14 +188,8 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 }
 
 void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
-    InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
-        precision = InferenceEngine::Precision::FP32;
-    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
-    precision = getCnnLayer()->outData[0]->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
-        precision = InferenceEngine::Precision::FP32;
-    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getDataPrecision());
+    auto outputDataType = inputDataType;
 
     bool hasUnknown = false;
     std::vector<size_t> canSelectPrimitive;
@@ -231,7 +233,7 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
                 canOptimize = false;
         }
     }
-    if (hasUnknown && axis == 1) {
+    if (hasUnknown && axis > 0) {
         if (canSelectPrimitive.size() == 1) {
             selectPrimitiveDescriptorByIndex(static_cast<int>(canSelectPrimitive[0]));
             return;
@@ -336,7 +338,7 @@ bool MKLDNNConcatNode::isOptimized() const {
 }
 
 void MKLDNNConcatNode::createPrimitive() {
-    if (prim || isOptimized())
+    if (prim || copy || isOptimized())
         return;
 
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
@@ -345,6 +347,23 @@ void MKLDNNConcatNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
 
+    // the inputs are copied in parallel in their own layouts, the reorders to the layout of the output are not needed
+    bool sameDataType = true;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr() || srcMemPtr->GetDataType() != dstMemPtr->GetDataType())
+            sameDataType = false;
+    }
+    if (sameDataType) {
+        copy.reset(new MKLDNNAxisCopy(dstMemPtr, getChildEdgeAt(0)->getDims(), axis));
+        for (size_t i = 0, axisOffset = 0; i < getParentEdges().size(); i++) {
+            auto dims = getParentEdgeAt(i)->getDims();
+            copy->addPart(getParentEdgeAt(i)->getMemoryPtr(), dims, axisOffset);
+            axisOffset += dims[axis];
+        }
+        return;
+    }
+
     std::vector<memory::primitive_desc> srcs_pd;
     std::vector<primitive::at> srcs_p;
 
@@ -378,6 +397,16 @@ void MKLDNNConcatNode::createPrimitive() {
     prim.reset(new concat(primitive_desc, srcs_p, getChildEdgeAt(0)->getMemory().GetPrimitive()));
 }
 
+void MKLDNNConcatNode::execute(mkldnn::stream strm) {
+    if (isOptimized())
+        return;
+    if (copy) {
+        copy->concat(batchToProcess());
+        return;
+    }
+    MKLDNNNode::execute(strm);
+}
+
 void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
     if (!isOptimized()) {
         MKLDNNNode::initOptimalPrimitiveDescriptor();
@@ -7,6 +7,8 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <mkldnn_axis_copy.h>
+#include <memory>
 #include <string>
 
 namespace MKLDNNPlugin {
@@ -21,13 +23,18 @@ public:
     void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
     void selectOptimalPrimitiveDescriptor() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
 
     bool isOptimized() const;
 
 private:
+    InferenceEngine::Precision getDataPrecision();
+
     static Register<MKLDNNConcatNode> reg;
     size_t axis = 0;
+    // copies the inputs when the concat is not in place, the mkldnn concat is used if it cannot
+    std::unique_ptr<MKLDNNAxisCopy> copy;
 };
 
 }  // namespace MKLDNNPlugin
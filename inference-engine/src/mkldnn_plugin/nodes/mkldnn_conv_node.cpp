@@ -10,8 +10,13 @@
 #include "desc_iterator.hpp"
 #include "mkldnn_eltwise_node.h"
 #include <ie_layers.h>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <algorithm>
 #include <string>
 #include <vector>
+#include <ie_parallel_for.hpp>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 
@@ -20,7 +25,7 @@ using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
 MKLDNNConvolutionNode::MKLDNNConvolutionNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng)
-        : MKLDNNNode(layer, eng), withBiases(false) {
+        : MKLDNNNode(layer, eng), isInt8(false), withBiases(false) {
     internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
         return MKLDNNMemoryDesc(primitive_desc_it.weights_primitive_desc(0).desc());
     });
@@ -29,21 +34,29 @@ MKLDNNConvolutionNode::MKLDNNConvolutionNode(const InferenceEngine::CNNLayerPtr&
             return MKLDNNMemoryDesc();
         return MKLDNNMemoryDesc(primitive_desc_it.weights_primitive_desc(1).desc());
     });
+
+    auto wScale = layer->blobs.find("w-scale");
+    isInt8 = layer->precision == Precision::I8 && wScale != layer->blobs.end();
+    if (isInt8) {
+        // the result is brought to the range of the output of the normalizer: (w-scale / o-scale) * accumulator
+        auto oScale = layer->blobs.find("o-scale");
+        if (oScale != layer->blobs.end() && oScale->second->size() != wScale->second->size())
+            THROW_IE_EXCEPTION << "Convolution " << getName() << " has different sizes of w-scale and o-scale.";
+
+        const float *wScaleData = wScale->second->cbuffer().as<const float *>();
+        for (size_t c = 0; c < wScale->second->size(); c++) {
+            float scale = wScaleData[c];
+            if (oScale != layer->blobs.end())
+                scale /= oScale->second->cbuffer().as<const float *>()[c];
+            outputScales.push_back(scale);
+        }
+    }
 }
 
 void MKLDNNConvolutionNode::getSupportedDescriptors() {
     if (!descs.empty())
         return;
 
-    InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
-        precision = InferenceEngine::Precision::FP32;
-    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
-    precision = getCnnLayer()->outData[0]->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
-        precision = InferenceEngine::Precision::FP32;
-    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
-
     auto * convLayer = dynamic_cast<ConvolutionLayer*>(getCnnLayer().get());
     if (convLayer == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert convolution layer.";
@@ -54,9 +67,11 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         THROW_IE_EXCEPTION << "Incorrect number of output edges.";
 
-    if (getParentEdgeAt(0)->getDims().ndims() != 4) {
-        THROW_IE_EXCEPTION << "Convolution layer. Unsupported mode, only 4D blob as input.";
+    int ndims = getParentEdgeAt(0)->getDims().ndims();
+    if (ndims != 4 && ndims != 5) {
+        THROW_IE_EXCEPTION << "Convolution layer. Unsupported mode, only 4D and 5D blobs as input.";
     }
+    bool is3D = ndims == 5;
 
     isMerged = (!getMergeWith().empty());  // grouped convolution was constructed from split->concat subgraph
     isGrouped = convLayer->_group != 1;    // group info available from IR
@@ -80,25 +95,49 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
     }
 
     weightDims = { groupOC, groupIC, convLayer->_kernel_y, convLayer->_kernel_x};
+    if (is3D) weightDims.insert(weightDims.begin() + 2, convLayer->_kernel_z);
     biasesDims = { groupOC * groupNum};
 
     if (isGrouped || isMerged) weightDims.insert(weightDims.begin(), groupNum);
 
-    withBiases = (convLayer->_biases != nullptr && convLayer->_biases->size() != 0);
+    withBiases = (convLayer->_biases != nullptr && convLayer->_biases->size() != 0) || !inputMean.empty();
+
+    // the ScaleShift and BatchNormalization fused to the convolution are folded into its weights and biases
+    MKLDNNChannelAffine affine(fusedWith, biasesDims[0]);
+    withBiases |= affine.hasShift();
 
     internalBlobs.push_back(createInternalBlob(weightDims, true));
     if (withBiases) {
-        internalBlobs.push_back(createInternalBlob(biasesDims, false));
+        if (convLayer->_biases != nullptr && convLayer->_biases->size() != 0) {
+            internalBlobs.push_back(createInternalBlob(biasesDims, false));
+        } else {
+            Blob::Ptr biases = make_shared_blob<float>(TensorDesc(Precision::FP32, biasesDims, Layout::C));
+            biases->allocate();
+            memset(biases->buffer(), 0, biases->byteSize());
+            internalBlobs.push_back(biases);
+        }
     }
+    if (!inputMean.empty())
+        foldInputMean();
+    if (!affine.empty())
+        foldChannelAffine(affine);
+    if (inputScale != 1.f)
+        foldInputScale();
 
     stride = {static_cast<int>(convLayer->_stride_y), static_cast<int>(convLayer->_stride_x)};
     dilation = {static_cast<int>(convLayer->_dilation_y) - 1, static_cast<int>(convLayer->_dilation_x) - 1};
     paddingL = {static_cast<int>(convLayer->_padding_y), static_cast<int>(convLayer->_padding_x)};
     paddingR = {0, 0};
+    if (is3D) {
+        stride.insert(stride.begin(), static_cast<int>(convLayer->_stride_z));
+        dilation.insert(dilation.begin(), static_cast<int>(convLayer->_dilation_z) - 1);
+        paddingL.insert(paddingL.begin(), static_cast<int>(convLayer->_padding_z));
+        paddingR.insert(paddingR.begin(), 0);
+    }
 
     MKLDNNDims weightsDims = MKLDNNDims(weightDims);
 
-    for (int i = 0; i < 2; i++) {
+    for (int i = 0; i < ndims - 2; i++) {
         int with_group = (isGrouped || isMerged) ? 1 : 0;
         int krn = weightsDims[with_group + 2 + i];
         int src = getParentEdgeAt(0)->getDims()[2 + i];
@@ -125,6 +164,63 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
         }
     }
 
+    // the folded weights of a pointwise convolution, which fuses only the activations
+    bool pointwise = !isInt8 && !isGrouped && !isMerged && !withSum && !is3D &&
+                     weightDims[2] == 1 && weightDims[3] == 1 && stride[0] == 1 && stride[1] == 1 &&
+                     dilation[0] == 0 && dilation[1] == 0 && paddingL[0] == 0 && paddingL[1] == 0 &&
+                     paddingR[0] == 0 && paddingR[1] == 0;
+    for (auto &node : fusedWith)
+        pointwise &= dynamic_cast<MKLDNNConvolutionNode *>(node.get()) == nullptr &&
+                     dynamic_cast<MKLDNNEltwiseNode *>(node.get()) == nullptr;
+    const float *weights = internalBlobs[0]->cbuffer().as<const float *>();
+    if (pointwise && internalBlobs[0]->getTensorDesc().getPrecision() == Precision::FP32 &&
+            MKLDNNSparseWeights::isSparse(weights, internalBlobs[0]->size())) {
+        sparseWeights.reset(new MKLDNNSparseWeights(getEngine(), weights, static_cast<int>(weightDims[0]),
+                                                    static_cast<int>(weightDims[1])));
+        if (withBiases) {
+            const float *biases = internalBlobs[1]->cbuffer().as<const float *>();
+            sparseBiases.assign(biases, biases + internalBlobs[1]->size());
+        }
+    }
+
+    if (isInt8 && is3D) {
+        // mkl-dnn has no int8 3D convolution, the weights are dequantized for the fp32 primitives
+        dequantizeWeights();
+    } else if (isInt8) {
+        // the int8 implementations of mkl-dnn are built for the channels last layout
+        MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), memory::u8, memory::nhwc);
+        MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), getInt8OutputDataType(), memory::nhwc);
+        createDescriptor({in_candidate}, {out_candidate});
+    } else {
+        createFP32Descriptors();
+    }
+}
+
+void MKLDNNConvolutionNode::createFP32Descriptors() {
+    InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
+    if (precision != InferenceEngine::Precision::FP32)
+        precision = InferenceEngine::Precision::FP32;
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+    precision = getCnnLayer()->outData[0]->getPrecision();
+    if (precision != InferenceEngine::Precision::FP32)
+        precision = InferenceEngine::Precision::FP32;
+    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+
+    size_t IC = getCnnLayer()->input()->getDims()[1];
+
+    if (getParentEdgeAt(0)->getDims().ndims() == 5) {
+        // mkl-dnn blocks the channels of the 5D tensors by 16 only
+        MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType, memory::ncdhw);
+        MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType, memory::ncdhw);
+        createDescriptor({in_candidate}, {out_candidate});
+
+        if (IC != 3 && IC != 1)
+            in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), outputDataType, memory::nCdhw16c);
+        out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw16c);
+        createDescriptor({in_candidate}, {out_candidate});
+        return;
+    }
+
     MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType, memory::nchw);
     MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType, memory::nchw);
     createDescriptor({in_candidate}, {out_candidate});
@@ -183,6 +279,7 @@ void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
 
     mkldnn::primitive_attr attr;
     attr.set_post_ops(ops);
+    addInt8Attributes(attr);
 
     for (auto& desc : descs) {
         try {
@@ -226,11 +323,167 @@ void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
             continue;
         }
     }
+
+    if (sparseWeights) {
+        auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(Precision::FP32);
+        InferenceEngine::LayerConfig config;
+        config.dynBatchSupport = true;
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), dataType, memory::nchw);
+        config.inConfs.push_back(dataConfig);
+        dataConfig.desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dataType, memory::nchw);
+        config.outConfs.push_back(dataConfig);
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::sparse_sse42_1x1);
+    }
+
+    if (isInt8 && supportedPrimitiveDescriptors.empty()) {
+        // the CPU has no int8 implementation, the dequantized weights are used by the fp32 primitives
+        dequantizeWeights();
+        initSupportedPrimitiveDescriptors();
+    }
 }
 
+void MKLDNNConvolutionNode::addInt8Attributes(mkldnn::primitive_attr &attr) const {
+    if (!isInt8)
+        return;
+
+    attr.set_int_output_round_mode(mkldnn::round_nearest);
+    // the mask selects the channels dimension of the destination for the per channel scales
+    attr.set_output_scales(outputScales.size() > 1 ? 1 << 1 : 0, outputScales);
+}
+
+mkldnn::memory::data_type MKLDNNConvolutionNode::getInt8OutputDataType() {
+    // the fused ReLU makes the output non-negative, so the unsigned type keeps one more bit of it
+    for (auto &node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode && activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_relu &&
+                activationNode->getAlpha() == 0.0f)
+            return memory::u8;
+    }
+    return memory::s8;
+}
+
+void MKLDNNConvolutionNode::dequantizeWeights() {
+    isInt8 = false;
+    descs.clear();
+
+    for (auto &internalBlob : internalBlobs) {
+        const auto &desc = internalBlob->getTensorDesc();
+        if (outputScales.empty() || internalBlob->size() % outputScales.size() != 0)
+            THROW_IE_EXCEPTION << "Cannot dequantize the weights of convolution " << getName() << ".";
+
+        InferenceEngine::TBlob<float>::Ptr fp32Blob = InferenceEngine::make_shared_blob<float>(
+                InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, desc.getDims(), desc.getLayout()));
+        fp32Blob->allocate();
+        float *dst = fp32Blob->data();
+        size_t channelSize = internalBlob->size() / outputScales.size();
+        for (size_t i = 0; i < internalBlob->size(); i++) {
+            float value = desc.getPrecision() == InferenceEngine::Precision::I32 ?
+                          internalBlob->cbuffer().as<const int32_t *>()[i] :
+                          internalBlob->cbuffer().as<const int8_t *>()[i];
+            dst[i] = value * outputScales[i / channelSize];
+        }
+        internalBlob = fp32Blob;
+    }
+
+    createFP32Descriptors();
+}
+
+
+void MKLDNNConvolutionNode::foldChannelAffine(const MKLDNNChannelAffine &affine) {
+    float *weights = internalBlobs[0]->buffer().as<float *>();
+    size_t channelSize = internalBlobs[0]->size() / affine.scale.size();
+    for (size_t i = 0; i < internalBlobs[0]->size(); i++)
+        weights[i] *= affine.scale[i / channelSize];
+
+    if (withBiases)
+        affine.foldBiases(internalBlobs[1]->buffer().as<float *>());
+}
+
+void MKLDNNConvolutionNode::foldInputMean() {
+    // W * (x - mean) + b = W * x + (b - W * mean) per output channel when there is no padding
+    size_t OC = biasesDims[0];
+    size_t channelSize = internalBlobs[0]->size() / OC;
+    size_t kernelSize = 1;
+    for (size_t i = weightDims.size() - (getParentEdgeAt(0)->getDims().ndims() - 2); i < weightDims.size(); i++)
+        kernelSize *= weightDims[i];
+    size_t groupIC = channelSize / kernelSize;
+    size_t groupOC = OC / (inputMean.size() / groupIC);
+
+    const float *weights = internalBlobs[0]->cbuffer().as<const float *>();
+    float *biases = internalBlobs[1]->buffer().as<float *>();
+    for (size_t oc = 0; oc < OC; oc++) {
+        const float *mean = &inputMean[(oc / groupOC) * groupIC];
+        const float *w = weights + oc * channelSize;
+        float sum = 0.f;
+        for (size_t ic = 0; ic < groupIC; ic++)
+            for (size_t k = 0; k < kernelSize; k++)
+                sum += w[ic * kernelSize + k] * mean[ic];
+        biases[oc] -= sum;
+    }
+}
+
+bool MKLDNNConvolutionNode::isSparse() const {
+    auto selected_pd = getSelectedPrimitiveDescriptor();
+    return sparseWeights && selected_pd != nullptr &&
+           selected_pd->getImplementationType() == impl_desc_type::sparse_sse42_1x1;
+}
+
+void MKLDNNConvolutionNode::executeSparse() {
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const auto &dims = dstMemory.GetDims();
+    const int IC = sparseWeights->getCols();
+    const int OC = sparseWeights->getRows();
+    const int pixels = dims[2] * dims[3];
+    const float *biases = sparseBiases.empty() ? nullptr : sparseBiases.data();
+
+    for (int n = 0; n < batchToProcess(); n++) {
+        float *dst = dst_ptr + static_cast<size_t>(n) * OC * pixels;
+        sparseWeights->multiplyChannels(src_ptr + static_cast<size_t>(n) * IC * pixels, dst, pixels, biases);
+        for (auto &node : fusedWith) {
+            auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+            if (activationNode) {
+                parallel_for(OC, [&](int oc) {
+                    activationNode->apply(dst + static_cast<size_t>(oc) * pixels, pixels);
+                });
+            }
+        }
+    }
+}
+
+void MKLDNNConvolutionNode::execute(mkldnn::stream strm) {
+    if (isSparse()) {
+        executeSparse();
+        return;
+    }
+    MKLDNNNode::execute(strm);
+}
+
+void MKLDNNConvolutionNode::foldInputScale() {
+    // the accumulators of the unscaled input are 1 / inputScale times larger, so are the biases added to them
+    for (auto &scale : outputScales)
+        scale *= inputScale;
+    if (!withBiases || internalBlobs[1]->getTensorDesc().getPrecision() != Precision::I32)
+        return;
+    int32_t *biases = internalBlobs[1]->buffer().as<int32_t *>();
+    for (size_t i = 0; i < internalBlobs[1]->size(); i++) {
+        double bias = std::round(biases[i] / static_cast<double>(inputScale));
+        bias = std::min<double>(std::max<double>(bias, std::numeric_limits<int32_t>::min()),
+                                std::numeric_limits<int32_t>::max());
+        biases[i] = static_cast<int32_t>(bias);
+    }
+}
 
 void MKLDNNConvolutionNode::createPrimitive() {
-    if (prim)
+    if (prim || isSparse())
         return;
 
     mkldnn::post_ops ops;
@@ -252,14 +505,14 @@ void MKLDNNConvolutionNode::createPrimitive() {
         if (convolutionNode) {
             auto* convLayer = reinterpret_cast<ConvolutionLayer*>(convolutionNode->getCnnLayer().get());
 
-            DWConvInternalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+            DWConvInternalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine(), getAllocator())));
             MKLDNNDims dwWeightsDims({dw_conv_oc, 1, 1, dw_conv_kh, dw_conv_kw});
             DWConvInternalBlobMemory[0]->Create(dwWeightsDims, memory::data_type::f32, memory::format::Goihw8g);
 
             DWConvInternalBlobMemory[0]->SetData(memory::data_type::f32, memory::goihw, convLayer->_weights->buffer(),
                                dwWeightsDims.size() * MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
 
-            DWConvInternalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+            DWConvInternalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine(), getAllocator())));
             MKLDNNDims dwBiasesDims({dw_conv_oc});
             DWConvInternalBlobMemory[1]->Create(dwBiasesDims, memory::data_type::f32, memory::format::x);
             DWConvInternalBlobMemory[1]->SetData(memory::data_type::f32, memory::x, convLayer->_biases->buffer(),
@@ -282,6 +535,7 @@ void MKLDNNConvolutionNode::createPrimitive() {
 
     mkldnn::primitive_attr attr;
     attr.set_post_ops(ops);
+    addInt8Attributes(attr);
 
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
@@ -322,6 +576,10 @@ void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::
     MKLDNNDims blocked_weightDims(weightDims);
     MKLDNNDims blocked_biasesDims(biasesDims);
 
+    // the auto blocking of the weights in prepareMemory knows the 2D layouts only
+    if (in_candidate.getDims().ndims() == 5 && (in_candidate.blocksExtended() || out_candidate.blocksExtended()))
+        return;
+
     if (!isGrouped && !isMerged) {
         if (in_fmt == memory::nChw16c) {
             blocked_weightDims[I_IND] = rnd_up(blocked_weightDims[I_IND], 16);
@@ -349,12 +607,16 @@ void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::
         }
     }
 
-    MKLDNNMemoryDesc wgh_candidate{blocked_weightDims, in_candidate.getDataType(), memory::any};
+    // int8 convolutions take signed weights and accumulate the biases in int32
+    auto wdt = isInt8 ? memory::s8 : in_candidate.getDataType();
+    auto bdt = isInt8 ? memory::s32 : in_candidate.getDataType();
+
+    MKLDNNMemoryDesc wgh_candidate{blocked_weightDims, wdt, memory::any};
 
     for (auto alg : {algorithm::convolution_winograd, algorithm::convolution_direct}) {
         std::shared_ptr<mkldnn::convolution_forward::desc> conv_desc;
         if (withBiases) {
-            MKLDNNMemoryDesc bias_candidate{blocked_biasesDims, in_candidate.getDataType(), memory::any};
+            MKLDNNMemoryDesc bias_candidate{blocked_biasesDims, bdt, memory::any};
 
             conv_desc.reset(new convolution_forward::desc(prop_kind::forward_scoring, alg, in_candidate,
                                                           wgh_candidate, bias_candidate, out_candidate,
@@ -371,7 +633,7 @@ void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::
 
 void MKLDNNConvolutionNode::initDescriptor(const InferenceEngine::LayerConfig& config) {
     auto* selectedPD = getSelectedPrimitiveDescriptor();
-    if (!selectedPD) {
+    if (!selectedPD || isSparse()) {
         return;
     }
     bool addedNewDesc = false;
@@ -415,6 +677,7 @@ void MKLDNNConvolutionNode::initDescriptor(const InferenceEngine::LayerConfig& c
 
     mkldnn::primitive_attr attr;
     attr.set_post_ops(ops);
+    addInt8Attributes(attr);
 
     InferenceEngine::LayerConfig rightConfig = selectedPD->getConfig();
     size_t selected_count = 0;
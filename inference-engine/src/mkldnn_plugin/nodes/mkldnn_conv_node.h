@@ -7,6 +7,8 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "mkldnn_sparse_weights.h"
+#include "mkldnn_channel_affine.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -23,14 +25,60 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void initDescriptor(const InferenceEngine::LayerConfig& config) override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     void initSupportedPrimitiveDescriptors() override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
     }
 
+    // the convolution was quantized by CNNNetworkInt8Normalizer and runs int8 primitives
+    bool isInt8Convolution() const {
+        return isInt8;
+    }
+    // scales of the int32 accumulators per output channel, they requantize the result of an int8 convolution
+    const std::vector<float>& getOutputScales() const {
+        return outputScales;
+    }
+    void setOutputScales(const std::vector<float>& scales) {
+        outputScales = scales;
+    }
+    mkldnn::memory::data_type getInt8OutputDataType();
+
+    /**
+     * @brief Sets the per channel mean subtracted from the input, it is folded into the biases
+     * (the convolution has to be without padding)
+     */
+    void setInputMean(const std::vector<float>& mean) {
+        inputMean = mean;
+    }
+    bool hasInputMean() const {
+        return !inputMean.empty();
+    }
+
+    /**
+     * @brief Sets the scale quantizing the input of the int8 convolution, which then reads the U8 input as it is,
+     * the scale is folded into the output scales and the biases
+     */
+    void setInputScale(float scale) {
+        inputScale = scale;
+    }
+
 private:
+    void createFP32Descriptors();
+    void addInt8Attributes(mkldnn::primitive_attr &attr) const;
+    void foldChannelAffine(const MKLDNNChannelAffine &affine);
+    void foldInputMean();
+    void foldInputScale();
+    void dequantizeWeights();
+    bool isSparse() const;
+    void executeSparse();
+
     static Register<MKLDNNConvolutionNode> reg;
+    bool isInt8;
+    std::vector<float> outputScales;
+    std::vector<float> inputMean;
+    float inputScale = 1.f;
     bool withBiases;
     bool withSum;
     bool isDW;
@@ -51,6 +99,10 @@ private:
     int dw_conv_sh;
     int dw_conv_sw;
     std::vector<MKLDNNMemoryPtr> DWConvInternalBlobMemory;
+
+    // the pruned 1x1 convolution gets the sparse kernel besides the primitives of mkl-dnn
+    MKLDNNSparseWeights::Ptr sparseWeights;
+    std::vector<float> sparseBiases;
 };
 
 }  // namespace MKLDNNPlugin
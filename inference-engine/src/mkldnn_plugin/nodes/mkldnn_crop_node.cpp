@@ -7,8 +7,10 @@
 #include <ie_layers.h>
 #include <string>
 #include <algorithm>
+#include <limits>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -84,20 +86,77 @@ void MKLDNNCropNode::initSupportedPrimitiveDescriptors() {
     config.outConfs[0].constant = false;
     config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmt);
 
-    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+    addSupportedPrimitiveDescriptors(config, fmt);
 
     if (channelAxis >= 0 && dims[channelAxis] % 8 == 0) {
         fmt = memory::format::nChw8c;
         config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, fmt);
         config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmt);
-        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+        addSupportedPrimitiveDescriptors(config, fmt);
         if (dims[channelAxis] % 16 == 0) {
             fmt = memory::format::nChw16c;
             config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, fmt);
             config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmt);
-            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+            addSupportedPrimitiveDescriptors(config, fmt);
+        }
+    }
+}
+
+void MKLDNNCropNode::addSupportedPrimitiveDescriptors(InferenceEngine::LayerConfig config, memory::format fmt) {
+    // The output as a strided view of the input goes first, so it is preferred over the copy of the same format.
+    // The view of a blocked format is possible only if the cropped channels start from the beginning of a block.
+    int blockSize = 1;
+    if (fmt == memory::format::nChw8c)
+        blockSize = 8;
+    else if (fmt == memory::format::nChw16c)
+        blockSize = 16;
+    if (offsets[1] % blockSize == 0) {
+        InferenceEngine::LayerConfig viewConfig = config;
+        const auto& inBlocking = config.inConfs[0].desc.getBlockingDesc();
+        const auto& outBlocking = config.outConfs[0].desc.getBlockingDesc();
+        viewConfig.outConfs[0].inPlace = 0;
+        viewConfig.outConfs[0].desc = TensorDesc(config.outConfs[0].desc.getPrecision(), config.outConfs[0].desc.getDims(),
+                                                 {outBlocking.getBlockDims(), outBlocking.getOrder(),
+                                                  std::numeric_limits<size_t>::max(), outBlocking.getOffsetPaddingToData(),
+                                                  inBlocking.getStrides()});
+        supportedPrimitiveDescriptors.emplace_back(viewConfig, impl_desc_type::unknown);
+    }
+    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+}
+
+bool MKLDNNCropNode::isOptimized() const {
+    return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].inPlace >= 0;
+}
+
+void MKLDNNCropNode::initOptimalPrimitiveDescriptor() {
+    if (!isOptimized()) {
+        MKLDNNNode::initOptimalPrimitiveDescriptor();
+        return;
+    }
+
+    auto config = getSelectedPrimitiveDescriptor()->getConfig();
+    if (isInitConfig(config))
+        return;
+
+    // the output starts from the first cropped element of the input and keeps the strides of the input
+    const auto& inBlocking = config.inConfs[0].desc.getBlockingDesc();
+    const auto& outBlocking = config.outConfs[0].desc.getBlockingDesc();
+    size_t offset = inBlocking.getOffsetPadding();
+    for (size_t i = 0; i < outBlocking.getBlockDims().size(); i++) {
+        size_t dim = outBlocking.getOrder()[i];
+        size_t blockSize = 1;
+        for (size_t j = i + 1; j < outBlocking.getOrder().size(); j++) {
+            if (outBlocking.getOrder()[j] == dim)
+                blockSize *= outBlocking.getBlockDims()[j];
         }
+        // the offset of the inner block of the dimension is zero, it is checked for the blocked formats
+        size_t dimOffset = i == dim ? offsets[dim] / blockSize : 0;
+        offset += dimOffset * inBlocking.getStrides()[i];
     }
+    config.outConfs[0].desc = TensorDesc(config.outConfs[0].desc.getPrecision(), config.outConfs[0].desc.getDims(),
+                                         {outBlocking.getBlockDims(), outBlocking.getOrder(), offset,
+                                          outBlocking.getOffsetPaddingToData(), inBlocking.getStrides()});
+    initDescriptor(config);
 }
 
 void MKLDNNCropNode::createPrimitive() {
@@ -112,6 +171,9 @@ void MKLDNNCropNode::createPrimitive() {
 }
 
 void MKLDNNCropNode::execute(mkldnn::stream strm) {
+    if (isOptimized())
+        return;
+
     auto& parentMem = getParentEdgeAt(0)->getMemory();
 
     int m_block_size = 1;
@@ -150,24 +212,23 @@ void MKLDNNCropNode::execute(mkldnn::stream strm) {
     float *dst_data = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
             getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-#   pragma omp parallel for collapse(2) schedule(static)
-    for (int n = 0; n < ON; ++n) {
-        for (int c = 0; c < OC; c += m_block_size) {
-            for (int h = 0; h < OH; ++h) {
-                int dst_ind =
-                        n*OC*OH*OW + c*OH*OW +
-                        h*OW*m_block_size;
-
-                int src_ind =
-                        (n+OFFSET_N)*IC*IH*IW +
-                        (c+OFFSET_C)*IH*IW +
-                        (h+OFFSET_H)*IW*m_block_size +
-                        OFFSET_W*m_block_size;
-
-                memcpy(dst_data + dst_ind, src_data + src_ind, m_inner_dim * sizeof(float));
-            }
+    const int OCB = (OC + m_block_size - 1) / m_block_size;
+    parallel_nd(ON, OCB, [&](int n, int cb) {
+        const int c = cb * m_block_size;
+        for (int h = 0; h < OH; ++h) {
+            int dst_ind =
+                    n*OC*OH*OW + c*OH*OW +
+                    h*OW*m_block_size;
+
+            int src_ind =
+                    (n+OFFSET_N)*IC*IH*IW +
+                    (c+OFFSET_C)*IH*IW +
+                    (h+OFFSET_H)*IW*m_block_size +
+                    OFFSET_W*m_block_size;
+
+            memcpy(dst_data + dst_ind, src_data + src_ind, m_inner_dim * sizeof(float));
         }
-    }
+    });
 }
 
 bool MKLDNNCropNode::created() const {
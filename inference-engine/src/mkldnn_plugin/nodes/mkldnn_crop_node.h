@@ -26,7 +26,12 @@ public:
         return false;
     }
 
+    bool isOptimized() const;
+    void initOptimalPrimitiveDescriptor() override;
+
 private:
+    void addSupportedPrimitiveDescriptors(InferenceEngine::LayerConfig config, mkldnn::memory::format fmt);
+
     static Register<MKLDNNCropNode> reg;
     int channelAxis = 1;
     std::vector<int> offsets;
@@ -5,10 +5,13 @@
 
 #include "mkldnn_deconv_node.h"
 #include "desc_iterator.hpp"
+#include "mkldnn_channel_affine.h"
 #include <ie_layers.h>
 #include <mkldnn.hpp>
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <ie_parallel_for.hpp>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 
@@ -16,6 +19,18 @@ using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+inline int div_up(const int a, const int b) {
+    return (a + b - 1) / b;
+}
+
+inline int div_floor(const int a, const int b) {
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+}  // namespace
+
 MKLDNNDeconvolutionNode::MKLDNNDeconvolutionNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {
     internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
         return MKLDNNMemoryDesc(primitive_desc_it.weights_primitive_desc(0).desc());
@@ -80,6 +95,32 @@ void MKLDNNDeconvolutionNode::getSupportedDescriptors() {
 
     internalBlobs.push_back(createInternalBlob(weightDims, true));
 
+    // the ScaleShift and BatchNormalization fused to the layer are folded into its weights and biases, the weights
+    // are [group][in channels][out channels][kh][kw]
+    MKLDNNChannelAffine affine(fusedWith, deconvLayer->_out_depth);
+    if (!affine.empty()) {
+        if (internalBlobs[0]->precision() != InferenceEngine::Precision::FP32)
+            THROW_IE_EXCEPTION << "Cannot fold the fused layers into the weights of layer " << deconvLayer->name;
+        float *weights = internalBlobs[0]->buffer().as<float *>();
+        const size_t groupOC = deconvLayer->_out_depth / (withGroups ? deconvLayer->_group : 1);
+        const size_t kernelSize = deconvLayer->_kernel_y * deconvLayer->_kernel_x;
+        const size_t groupSize = internalBlobs[0]->size() / (withGroups ? deconvLayer->_group : 1);
+        for (size_t i = 0; i < internalBlobs[0]->size(); i++)
+            weights[i] *= affine.scale[i / groupSize * groupOC + i / kernelSize % groupOC];
+
+        if (withBiases || affine.hasShift()) {
+            InferenceEngine::Blob::Ptr foldedBiases = make_shared_blob<float>(
+                    TensorDesc(InferenceEngine::Precision::FP32, {deconvLayer->_out_depth}, Layout::C));
+            foldedBiases->allocate();
+            float *data = foldedBiases->buffer().as<float *>();
+            for (size_t c = 0; c < deconvLayer->_out_depth; c++)
+                data[c] = withBiases ? biases->cbuffer().as<const float *>()[c] : 0.f;
+            affine.foldBiases(data);
+            biases = foldedBiases;
+            withBiases = true;
+        }
+    }
+
     stride = {static_cast<int>(deconvLayer->_stride_y), static_cast<int>(deconvLayer->_stride_x)};
     paddingL = {static_cast<int>(deconvLayer->_padding_y), static_cast<int>(deconvLayer->_padding_x)};
     dilation = {static_cast<int>(deconvLayer->_dilation_y) - 1, static_cast<int>(deconvLayer->_dilation_x) - 1};
@@ -98,6 +139,12 @@ void MKLDNNDeconvolutionNode::getSupportedDescriptors() {
         paddingR[i] = (dst - calc_dst) * stride[i];
     }
 
+    // the backward data convolution goes through the zeros between the input pixels of the upsampling
+    canUseSubPixel = !withGroups && stride[0] > 1 && stride[1] > 1 && dilation[0] == 0 && dilation[1] == 0 &&
+                     getParentEdgeAt(0)->getDims().ndims() == 4 &&
+                     deconvLayer->_weights->precision() == InferenceEngine::Precision::FP32 &&
+                     (!withBiases || biases->precision() == InferenceEngine::Precision::FP32);
+
     for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
         MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType, format);
         MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType, format);
@@ -105,7 +152,119 @@ void MKLDNNDeconvolutionNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNDeconvolutionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    MKLDNNNode::initSupportedPrimitiveDescriptors();
+    if (!canUseSubPixel)
+        return;
+
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
+    auto srcDims = getParentEdgeAt(0)->getDims();
+    auto dstDims = getChildEdgeAt(0)->getDims();
+
+    // the same layout of the input and the output, the blocks of the channels are not padded
+    for (auto format : {memory::nchw, memory::nChw8c, memory::nChw16c}) {
+        int block = format == memory::nChw16c ? 16 : format == memory::nChw8c ? 8 : 1;
+        if (srcDims[1] % block != 0 || dstDims[1] % block != 0)
+            continue;
+
+        InferenceEngine::LayerConfig config;
+        config.dynBatchSupport = true;
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(srcDims, dataType, format);
+        config.inConfs.push_back(dataConfig);
+        dataConfig.desc = MKLDNNMemoryDesc(dstDims, dataType, format);
+        config.outConfs.push_back(dataConfig);
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::gemm_subpixel});
+    }
+}
+
+bool MKLDNNDeconvolutionNode::isSubPixel() const {
+    auto selected_pd = getSelectedPrimitiveDescriptor();
+    return selected_pd != nullptr && selected_pd->getImplementationType() == impl_desc_type::gemm_subpixel;
+}
+
+void MKLDNNDeconvolutionNode::executeSubPixel() {
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const float *bias = withBiases ? biases->buffer().as<const float*>() : nullptr;
+
+    const auto &srcDims = srcMemory.GetDims();
+    const auto &dstDims = dstMemory.GetDims();
+    const int IC = srcDims[1], IH = srcDims[2], IW = srcDims[3];
+    const int OC = dstDims[1], OH = dstDims[2], OW = dstDims[3];
+    const int KH = weightsDims[2], KW = weightsDims[3];
+    const int SH = stride[0], PH = paddingL[0];
+    const int block = dstMemory.GetFormat() == memory::nChw16c ? 16 : dstMemory.GetFormat() == memory::nChw8c ? 8 : 1;
+    const int taps = OC * KH * KW;
+    const int batch = batchToProcess();
+    const int bands = div_up(OH, bandRows);
+
+    parallel_nd(batch, bands, [&](int n, int b) {
+        float *products = buffers.data() + bufferSize * parallel_get_thread_num();
+        const float *src = src_ptr + static_cast<size_t>(n) * IC * IH * IW;
+        float *dst = dst_ptr + static_cast<size_t>(n) * OC * OH * OW;
+
+        // the input rows reaching the output rows of the band
+        const int oh0 = b * bandRows;
+        const int oh1 = std::min(oh0 + bandRows, OH);
+        const int ih0 = std::max(0, div_floor(oh0 + PH - KH + SH, SH));
+        const int ih1 = std::min(IH - 1, div_floor(oh1 - 1 + PH, SH));
+        const int M = std::max(ih1 - ih0 + 1, 0) * IW;
+
+        // products[co][kh][kw][pixel] of the input rows: column major pixels x input channels times
+        // input channels x taps (the weights are [ic][oc][kh][kw])
+        const float one = 1.0f, zero = 0.0f;
+        if (M > 0 && block == 1) {
+            const int lda = IH * IW;
+            mkldnn_sgemm("N", "T", &M, &taps, &IC, &one, src + ih0 * IW, &lda,
+                         subPixelWeights.data(), &taps, &zero, products, &M);
+        } else if (M > 0) {
+            for (int cb = 0; cb < IC / block; cb++) {
+                const float *A = src + (static_cast<size_t>(cb) * IH * IW + ih0 * IW) * block;
+                const float *B = subPixelWeights.data() + static_cast<size_t>(cb) * block * taps;
+                mkldnn_sgemm("T", "T", &M, &taps, &block, &one, A, &block, B, &taps,
+                             cb == 0 ? &zero : &one, products, &M);
+            }
+        }
+
+        // every output pixel gathers the products of the taps of its phase
+        for (int oc = 0; oc < OC; oc++) {
+            const float b0 = bias ? bias[oc] : 0.0f;
+            for (int oh = oh0; oh < oh1; oh++) {
+                float *o = dst + ((oc / block) * OH * OW + oh * OW) * block + oc % block;
+                for (int ow = 0; ow < OW; ow++)
+                    o[ow * block] = b0;
+                for (int kh = 0; kh < KH; kh++) {
+                    const int t = oh + PH - kh;
+                    if (t < 0 || t % SH != 0 || t / SH >= IH)
+                        continue;
+                    const float *row = products + (oc * KH + kh) * KW * M + (t / SH - ih0) * IW;
+                    for (int ow = 0; ow < OW; ow++) {
+                        float sum = 0.0f;
+                        for (int tap = columnTaps[ow]; tap < columnTaps[ow + 1]; tap++)
+                            sum += row[tapKernelColumns[tap] * M + tapInputColumns[tap]];
+                        o[ow * block] += sum;
+                    }
+                }
+            }
+        }
+    });
+}
+
 void MKLDNNDeconvolutionNode::execute(mkldnn::stream strm) {
+    if (isSubPixel()) {
+        executeSubPixel();
+        return;
+    }
     if (prim) {
         strm.submit({*prim});
     }
@@ -129,11 +288,7 @@ void MKLDNNDeconvolutionNode::execute(mkldnn::stream strm) {
         const int blksize = fmt == memory::nChw16c ? 16 :
                             fmt == memory::nChw8c ? 8 : 1;
 
-#   pragma omp parallel for collapse(4) schedule(static)
-        for (int n = 0; n < N; ++n)
-        for (int c = 0; c < C / blksize; ++c)
-        for (int h = 0; h < H; ++h)
-        for (int w = 0; w < W; ++w) {
+        parallel_nd(N, C / blksize, H, W, [&](int n, int c, int h, int w) {
             const int off =
                     n * C * H * W + c * H * W * blksize +
                     h * W * blksize + w * blksize;
@@ -141,7 +296,7 @@ void MKLDNNDeconvolutionNode::execute(mkldnn::stream strm) {
             for (int bc = 0; bc < blksize; ++bc) {
                 o[bc] += bias[c*blksize + bc];
             }
-        }
+        });
     }
 }
 
@@ -153,6 +308,50 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
     if (prim)
         return;
 
+    if (isSubPixel()) {
+        auto srcDims = getParentEdgeAt(0)->getDims();
+        auto dstDims = getChildEdgeAt(0)->getDims();
+        const int IH = srcDims[2], IW = srcDims[3];
+        const int OH = dstDims[2], OW = dstDims[3];
+        const int KH = weightsDims[2], KW = weightsDims[3];
+        const int taps = dstDims[1] * KH * KW;
+
+        if (subPixelWeights.empty()) {
+            const float *weights = internalBlobs[0]->buffer().as<const float*>();
+            subPixelWeights.assign(weights, weights + static_cast<size_t>(srcDims[1]) * taps);
+        }
+
+        columnTaps.assign(1, 0);
+        tapKernelColumns.clear();
+        tapInputColumns.clear();
+        for (int ow = 0; ow < OW; ow++) {
+            for (int kw = 0; kw < KW; kw++) {
+                const int t = ow + paddingL[1] - kw;
+                if (t < 0 || t % stride[1] != 0 || t / stride[1] >= IW)
+                    continue;
+                tapKernelColumns.push_back(kw);
+                tapInputColumns.push_back(t / stride[1]);
+            }
+            columnTaps.push_back(static_cast<int>(tapKernelColumns.size()));
+        }
+
+        // the products of the input rows of a band take a half of L2, a band of B output rows reads
+        // at most (B + KH - 2) / stride + 2 input rows
+        const size_t halfL2 = mkldnn_get_cache_size(2, true) / 2;
+        const int inputRows = std::max(2, static_cast<int>(halfL2 / (sizeof(float) * taps * IW)));
+        bandRows = std::max(1, (inputRows - 2) * stride[0] - KH + 2);
+
+        // enough bands to keep all the threads busy on a small batch
+        const int threads = parallel_get_max_threads();
+        const int bandsPerImage = div_up(threads, std::max(dstDims[0], 1));
+        bandRows = std::max(1, std::min(bandRows, OH / bandsPerImage));
+
+        const int maxRows = std::min(IH, (bandRows + KH - 2) / stride[0] + 2);
+        bufferSize = static_cast<size_t>(taps) * maxRows * IW;
+        buffers.resize(bufferSize * threads);
+        return;
+    }
+
     auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
             convolution_backward_data::desc, convolution_forward::primitive_desc>();
 
@@ -19,6 +19,7 @@ public:
     ~MKLDNNDeconvolutionNode() override = default;
 
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void createPrimitive() override;
@@ -32,6 +33,9 @@ public:
     MKLDNNMemoryDesc getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
 
 private:
+    bool isSubPixel() const;
+    void executeSubPixel();
+
     bool withBiases;
     bool withGroups;
     bool isDW;
@@ -44,6 +48,17 @@ private:
     InferenceEngine::Blob::Ptr biases;
     std::vector<std::shared_ptr<mkldnn::convolution_forward::desc>> descs_fwd;
     std::vector<std::shared_ptr<mkldnn::convolution_backward_data::desc>> descs_bwd;
+
+    // The strided deconvolution as one gemm per band of the output rows: the products of the input pixels of the
+    // band with all the taps of the kernel, [out channels][kh][kw] x pixels, are gathered to the output pixels
+    // (the sub-pixel convolutions of the phases of the output), no zeros are inserted between the input pixels.
+    bool canUseSubPixel = false;
+    std::vector<float> subPixelWeights;
+    // the taps of the output columns: the first tap of the column, the kernel column and the input column of a tap
+    std::vector<int> columnTaps, tapKernelColumns, tapInputColumns;
+    int bandRows = 1;
+    size_t bufferSize = 0;
+    std::vector<float> buffers;
 };
 
 }  // namespace MKLDNNPlugin
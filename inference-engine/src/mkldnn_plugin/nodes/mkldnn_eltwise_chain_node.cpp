@@ -0,0 +1,396 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_eltwise_chain_node.h"
+#include "mkldnn_activation_node.h"
+#include "mkldnn_depthwise_node.h"
+#include <ie_layers.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the values processed by all the layers of the chain before the next chunk, 4 KB stay in L1
+const size_t chunkSize = 1024;
+
+// calls f(i, c) for the values of the chunk, c is the offset of the channel of the value:
+// period 1 - one channel, 0 - the channel of every value, otherwise the channels repeat with the period (blocked layout)
+template <typename F>
+inline void forEachValue(size_t size, size_t period, F f) {
+    if (period == 1) {
+        for (size_t i = 0; i < size; i++)
+            f(i, 0);
+    } else if (period == 0) {
+        for (size_t i = 0; i < size; i++)
+            f(i, i);
+    } else {
+        for (size_t i = 0; i < size; i += period) {
+            for (size_t c = 0; c < period && i + c < size; c++)
+                f(i + c, c);
+        }
+    }
+}
+
+bool isFP32Blob(const Blob::Ptr &blob, size_t channels) {
+    return blob && blob->precision() == Precision::FP32 && (blob->size() == 1 || blob->size() == channels);
+}
+
+std::vector<float> perChannel(const Blob::Ptr &blob, size_t channels, float defaultValue) {
+    std::vector<float> values(channels, defaultValue);
+    if (!blob)
+        return values;
+    const float *data = blob->cbuffer().as<const float *>();
+    for (size_t c = 0; c < channels; c++)
+        values[c] = data[blob->size() == 1 ? 0 : c];
+    return values;
+}
+
+}  // namespace
+
+MKLDNNEltwiseChainNode::MKLDNNEltwiseChainNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng)
+        : MKLDNNNode(layer, eng) {
+    setType(EltwiseChain);
+}
+
+bool MKLDNNEltwiseChainNode::canChain(const MKLDNNNodePtr& node) {
+    if (!node->getCnnLayer() || node->getParentEdges().size() != 1 || node->getChildEdges().empty())
+        return false;
+
+    if (node->getType() == Power) {
+        return true;
+    } else if (node->getType() == Activation) {
+        return dynamic_cast<MKLDNNActivationNode *>(node.get()) != nullptr;
+    } else if (node->getType() == Depthwise) {
+        auto dims = node->getParentEdgeAt(0)->getDims();
+        if (dims.ndims() < 2)
+            return false;
+        size_t channels = static_cast<size_t>(dims[1]);
+        auto *scaleShift = dynamic_cast<ScaleShiftLayer *>(node->getCnnLayer().get());
+        if (scaleShift)
+            return isFP32Blob(scaleShift->_weights, channels) &&
+                   (!scaleShift->_biases || isFP32Blob(scaleShift->_biases, channels));
+        auto *prelu = dynamic_cast<PReLULayer *>(node->getCnnLayer().get());
+        return prelu && isFP32Blob(prelu->_weights, channels);
+    }
+    return false;
+}
+
+bool MKLDNNEltwiseChainNode::canStartChain(const MKLDNNNodePtr& node) {
+    if (canChain(node))
+        return true;
+
+    auto *eltwiseLayer = dynamic_cast<EltwiseLayer *>(node->getCnnLayer().get());
+    if (node->getType() != Eltwise || !eltwiseLayer || node->getParentEdges().size() < 2 ||
+            (!eltwiseLayer->coeff.empty() && eltwiseLayer->coeff.size() != node->getParentEdges().size()))
+        return false;
+    if (eltwiseLayer->_operation != EltwiseLayer::Sum && eltwiseLayer->_operation != EltwiseLayer::Prod &&
+            eltwiseLayer->_operation != EltwiseLayer::Max)
+        return false;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        if (node->getParentEdgeAt(i)->getDims() != node->getChildEdgeAt(0)->getDims())
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNEltwiseChainNode::getSupportedDescriptors() {
+    if (fusedWith.empty())
+        THROW_IE_EXCEPTION << "Elementwise chain " << getName() << " has no layers.";
+    if (getParentEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of input edges.";
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges.";
+
+    auto dims = getChildEdgeAt(0)->getDims();
+    size_t channels = dims.ndims() > 1 ? static_cast<size_t>(dims[1]) : 1;
+
+    ops.clear();
+    withEltwise = false;
+    for (size_t i = 0; i < fusedWith.size(); i++) {
+        auto &node = fusedWith[i];
+        if (node->getType() == Eltwise) {
+            if (i != 0)
+                THROW_IE_EXCEPTION << "Eltwise " << node->getName() << " can only start the elementwise chain.";
+            auto *eltwiseLayer = dynamic_cast<EltwiseLayer *>(node->getCnnLayer().get());
+            withEltwise = true;
+            eltwiseOp = eltwiseLayer->_operation;
+            eltwiseScales.clear();
+            for (size_t j = 0; j < getParentEdges().size(); j++)
+                eltwiseScales.push_back(eltwiseLayer->coeff.empty() ? 1.0f : eltwiseLayer->coeff[j]);
+            continue;
+        }
+
+        Op op;
+        op.type = node->getType();
+        op.algorithm = algorithm_undef;
+        op.alpha = 0.0f;
+        op.beta = 0.0f;
+        op.power = 1.0f;
+        if (op.type == Power) {
+            auto *powerLayer = dynamic_cast<PowerLayer *>(node->getCnnLayer().get());
+            if (powerLayer == nullptr)
+                THROW_IE_EXCEPTION << "Cannot convert power layer.";
+            op.alpha = powerLayer->scale;
+            op.beta = powerLayer->offset;
+            op.power = powerLayer->power;
+        } else if (op.type == Activation) {
+            auto *activation = dynamic_cast<MKLDNNActivationNode *>(node.get());
+            op.algorithm = activation->getAlgorithm();
+            op.alpha = activation->getAlpha();
+            op.beta = activation->getBeta();
+        } else if (op.type == Depthwise) {
+            auto *depthwise = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+            op.algorithm = depthwise->getAlgorithm();
+            auto *weightable = dynamic_cast<WeightableLayer *>(node->getCnnLayer().get());
+            op.weights = perChannel(weightable->_weights, channels, 1.0f);
+            op.biases = perChannel(weightable->_biases, channels, 0.0f);
+        } else {
+            THROW_IE_EXCEPTION << "Layer " << node->getName() << " cannot run in the elementwise chain.";
+        }
+        ops.push_back(op);
+    }
+}
+
+void MKLDNNEltwiseChainNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(Precision::FP32);
+    auto dims = getChildEdgeAt(0)->getDims();
+
+    // the blocked layouts without the padded channels, the values of the padding are not computed
+    std::vector<memory::format> formats;
+    if (dims.ndims() == 4) {
+        formats.push_back(memory::nchw);
+        if (dims[1] % 8 == 0)
+            formats.push_back(memory::nChw8c);
+        if (dims[1] % 16 == 0)
+            formats.push_back(memory::nChw16c);
+    } else {
+        formats.push_back(MKLDNNMemory::GetPlainFormat(dims));
+    }
+
+    for (auto format : formats) {
+        InferenceEngine::LayerConfig config;
+        config.dynBatchSupport = true;
+        for (size_t i = 0; i < getParentEdges().size(); i++) {
+            InferenceEngine::DataConfig dataConfig;
+            dataConfig.inPlace = -1;
+            dataConfig.constant = false;
+            dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), dataType, format);
+            config.inConfs.push_back(dataConfig);
+        }
+
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, format);
+        config.outConfs.push_back(dataConfig);
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::ref});
+    }
+}
+
+void MKLDNNEltwiseChainNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+}
+
+void MKLDNNEltwiseChainNode::applyEltwise(const std::vector<const float*>& srcs, size_t offset, float* dst,
+                                          size_t size) const {
+    if (eltwiseOp == EltwiseLayer::Sum) {
+        const float scale0 = eltwiseScales[0];
+        const float *src0 = srcs[0] + offset;
+        for (size_t i = 0; i < size; i++)
+            dst[i] = scale0 * src0[i];
+        for (size_t j = 1; j < srcs.size(); j++) {
+            const float scale = eltwiseScales[j];
+            const float *src = srcs[j] + offset;
+            for (size_t i = 0; i < size; i++)
+                dst[i] += scale * src[i];
+        }
+    } else if (eltwiseOp == EltwiseLayer::Prod) {
+        const float *src0 = srcs[0] + offset;
+        const float *src1 = srcs[1] + offset;
+        for (size_t i = 0; i < size; i++)
+            dst[i] = src0[i] * src1[i];
+        for (size_t j = 2; j < srcs.size(); j++) {
+            const float *src = srcs[j] + offset;
+            for (size_t i = 0; i < size; i++)
+                dst[i] *= src[i];
+        }
+    } else {
+        const float *src0 = srcs[0] + offset;
+        const float *src1 = srcs[1] + offset;
+        for (size_t i = 0; i < size; i++)
+            dst[i] = std::max(src0[i], src1[i]);
+        for (size_t j = 2; j < srcs.size(); j++) {
+            const float *src = srcs[j] + offset;
+            for (size_t i = 0; i < size; i++)
+                dst[i] = std::max(dst[i], src[i]);
+        }
+    }
+}
+
+void MKLDNNEltwiseChainNode::applyOp(const Op& op, const float* src, float* dst, size_t size,
+                                     size_t channel, size_t period) const {
+    const float alpha = op.alpha;
+    const float beta = op.beta;
+    if (op.type == Power) {
+        const float power = op.power;
+        if (power == 1.0f) {
+            for (size_t i = 0; i < size; i++)
+                dst[i] = src[i] * alpha + beta;
+        } else {
+            for (size_t i = 0; i < size; i++)
+                dst[i] = std::pow(src[i] * alpha + beta, power);
+        }
+    } else if (op.type == Depthwise) {
+        const float *weights = op.weights.data() + channel;
+        const float *biases = op.biases.data() + channel;
+        if (op.algorithm == depthwise_scale_shift) {
+            forEachValue(size, period, [&](size_t i, size_t c) {
+                dst[i] = src[i] * weights[c] + biases[c];
+            });
+        } else {
+            forEachValue(size, period, [&](size_t i, size_t c) {
+                dst[i] = src[i] >= 0.0f ? src[i] : src[i] * weights[c];
+            });
+        }
+    } else {
+        switch (op.algorithm) {
+            case eltwise_relu:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = src[i] > 0.0f ? src[i] : src[i] * alpha;
+                break;
+            case eltwise_elu:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = src[i] > 0.0f ? src[i] : alpha * std::expm1(src[i]);
+                break;
+            case eltwise_tanh:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = std::tanh(src[i]);
+                break;
+            case eltwise_logistic:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = (1.0f + std::tanh(src[i] / 2.0f)) / 2.0f;
+                break;
+            case eltwise_square:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = src[i] * src[i];
+                break;
+            case eltwise_abs:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = std::fabs(src[i]);
+                break;
+            case eltwise_sqrt:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = src[i] > 0.0f ? std::sqrt(src[i]) : 0.0f;
+                break;
+            case eltwise_linear:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = alpha * src[i] + beta;
+                break;
+            case eltwise_bounded_relu:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = std::min(std::max(src[i], 0.0f), alpha);
+                break;
+            case eltwise_soft_relu:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = std::log(1.0f + std::exp(src[i]));
+                break;
+            case eltwise_clamp:
+                for (size_t i = 0; i < size; i++)
+                    dst[i] = src[i] > alpha ? alpha : (src[i] < beta ? beta : src[i]);
+                break;
+            default:
+                THROW_IE_EXCEPTION << "Unsupported activation in the elementwise chain " << getName();
+        }
+    }
+}
+
+void MKLDNNEltwiseChainNode::execute(mkldnn::stream strm) {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    std::vector<const float*> src_ptrs;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemory = getParentEdgeAt(i)->getMemory();
+        src_ptrs.push_back(reinterpret_cast<const float*>(srcMemory.GetData()) +
+                srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding);
+    }
+
+    memory::dims dims = dstMemory.GetDims();
+    const size_t batchSize = dstMemory.GetSize() / sizeof(float) / dims[0];
+    const size_t channels = dims.size() > 1 ? static_cast<size_t>(dims[1]) : 1;
+    const size_t spatial = batchSize / channels;
+
+    size_t block = 1;
+    if (dstMemory.GetFormat() == memory::nChw8c)
+        block = 8;
+    else if (dstMemory.GetFormat() == memory::nChw16c)
+        block = 16;
+
+    // the rows are the runs of the values of one channel (plain layout), of one block of the channels (blocked layout)
+    // or of all the channels of the batch (no spatial dimensions)
+    size_t rowSize, rowsPerBatch, period;
+    if (block > 1) {
+        rowSize = spatial * block;
+        rowsPerBatch = channels / block;
+        period = block;
+    } else if (spatial > 1) {
+        rowSize = spatial;
+        rowsPerBatch = channels;
+        period = 1;
+    } else {
+        rowSize = batchSize;
+        rowsPerBatch = 1;
+        period = 0;
+    }
+    const int rows = static_cast<int>(rowsPerBatch * batchToProcess());
+    const int chunks = static_cast<int>((rowSize + chunkSize - 1) / chunkSize);
+
+    parallel_nd(rows, chunks, [&](int r, int k) {
+        const size_t start = static_cast<size_t>(k) * chunkSize;
+        const size_t size = std::min(chunkSize, rowSize - start);
+        const size_t offset = static_cast<size_t>(r) * rowSize + start;
+        const size_t channel = period == 0 ? start : (r % rowsPerBatch) * block;
+        float *dst = dst_ptr + offset;
+
+        const float *src = src_ptrs[0] + offset;
+        if (withEltwise) {
+            applyEltwise(src_ptrs, offset, dst, size);
+            src = dst;
+        }
+        for (const auto &op : ops) {
+            applyOp(op, src, dst, size, channel, period);
+            src = dst;
+        }
+        if (src != dst)
+            memcpy(dst, src, size * sizeof(float));
+    });
+}
+
+bool MKLDNNEltwiseChainNode::created() const {
+    return getType() == EltwiseChain;
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <ie_layers.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The chain of the elementwise layers built by the graph optimizer: an optional Eltwise of several inputs
+ * followed by the Power, Activation, ScaleShift and PReLU layers, each feeding only the next one.
+ * The node runs the layers one after another over the chunks of the data fitting the L1 cache, so the inputs are
+ * read and the output is written once instead of once per layer.
+ */
+class MKLDNNEltwiseChainNode : public MKLDNNNode {
+public:
+    MKLDNNEltwiseChainNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
+    ~MKLDNNEltwiseChainNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    /**
+     * @brief Checks that the node of one input can run in the chain
+     */
+    static bool canChain(const MKLDNNNodePtr& node);
+    /**
+     * @brief Checks that the node can start the chain, i.e. can run in it or is the Eltwise
+     */
+    static bool canStartChain(const MKLDNNNodePtr& node);
+
+private:
+    struct Op {
+        Type type;
+        // the activation algorithm and its parameters, the scale, the shift and the power of Power
+        mkldnn::algorithm algorithm;
+        float alpha;
+        float beta;
+        float power;
+        // per channel weights and biases of ScaleShift and PReLU
+        std::vector<float> weights;
+        std::vector<float> biases;
+    };
+
+    void applyOp(const Op& op, const float* src, float* dst, size_t size, size_t channel, size_t period) const;
+    void applyEltwise(const std::vector<const float*>& srcs, size_t offset, float* dst, size_t size) const;
+
+    std::vector<Op> ops;
+    bool withEltwise = false;
+    InferenceEngine::EltwiseLayer::eOperation eltwiseOp = InferenceEngine::EltwiseLayer::Sum;
+    std::vector<float> eltwiseScales;
+};
+
+}  // namespace MKLDNNPlugin
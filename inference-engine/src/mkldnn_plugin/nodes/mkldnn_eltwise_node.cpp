@@ -4,6 +4,7 @@
 //
 
 #include "mkldnn_eltwise_node.h"
+#include "mkldnn_tile_node.h"
 #include <ie_layers.h>
 #include <string>
 #include <vector>
@@ -12,11 +13,61 @@
 #include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+// the input of the eltwise, the broadcast one is the input of the tile repeated along the axis
+struct EltwiseSource {
+    const float *ptr;
+    size_t tiles;
+    size_t inner;
+
+    bool dense() const {
+        return tiles == 1;
+    }
+    size_t index(size_t i) const {
+        return dense() ? i : i / (tiles * inner) * inner + i % inner;
+    }
+};
+
+template <typename Op>
+void eltwisePass(float *dst, const EltwiseSource &a, const EltwiseSource &b, size_t size, Op op) {
+    if (a.dense() && b.dense()) {
+        parallel_for(size, [&](size_t i) {
+            dst[i] = op(a.ptr[i], b.ptr[i]);
+        });
+    } else if (a.dense() || b.dense()) {
+        const EltwiseSource &bc = a.dense() ? b : a;
+        const float *dense = a.dense() ? a.ptr : b.ptr;
+        const bool denseFirst = a.dense();
+        const int outer = static_cast<int>(size / (bc.tiles * bc.inner));
+        const int tiles = static_cast<int>(bc.tiles);
+        const size_t inner = bc.inner;
+        parallel_nd(outer, tiles, [&](int o, int t) {
+            const float *row = bc.ptr + o * inner;
+            const size_t base = (static_cast<size_t>(o) * tiles + t) * inner;
+            if (denseFirst) {
+                for (size_t j = 0; j < inner; j++)
+                    dst[base + j] = op(dense[base + j], row[j]);
+            } else {
+                for (size_t j = 0; j < inner; j++)
+                    dst[base + j] = op(row[j], dense[base + j]);
+            }
+        });
+    } else {
+        parallel_for(size, [&](size_t i) {
+            dst[i] = op(a.ptr[a.index(i)], b.ptr[b.index(i)]);
+        });
+    }
+}
+
+}  // namespace
+
 MKLDNNEltwiseNode::MKLDNNEltwiseNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
 
 bool MKLDNNEltwiseNode::isSum() {
@@ -116,9 +167,20 @@ void MKLDNNEltwiseNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
 
+    // the operations are commutative, so the input placed in the memory of the output is read first
+    inputOrder.clear();
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        if (getParentEdgeAt(i)->getMemoryPtr() &&
+                getParentEdgeAt(i)->getMemoryPtr()->GetData() == dstMemPtr->GetData())
+            inputOrder.insert(inputOrder.begin(), i);
+        else
+            inputOrder.push_back(i);
+    }
+
     std::vector<memory::primitive_desc> srcs_pd;
     std::vector<primitive::at> srcs_p;
-    for (size_t i = 0; i < getParentEdges().size(); i++) {
+    std::vector<float> scales;
+    for (size_t i : inputOrder) {
         auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
         if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr()) {
             auto parent = getParentEdgeAt(i)->getParent();
@@ -128,10 +190,11 @@ void MKLDNNEltwiseNode::createPrimitive() {
         if (op == EltwiseLayer::Sum) {
             srcs_pd.push_back(srcMemPtr->GetPrimitiveDescriptor());
             srcs_p.emplace_back(srcMemPtr->GetPrimitive());
+            scales.push_back(sum_scales[i]);
         }
     }
     if (op == EltwiseLayer::Sum) {
-        auto primitive_desc = sum::primitive_desc(dstMemPtr->GetDescriptor(), sum_scales, srcs_pd);
+        auto primitive_desc = sum::primitive_desc(dstMemPtr->GetDescriptor(), scales, srcs_pd);
         prim = std::shared_ptr<sum>(new sum(primitive_desc, srcs_p, dstMemPtr->GetPrimitive()));
     }
 }
@@ -143,41 +206,38 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
         IE_ASSERT(getParentEdges().size() > 1);
 
         auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
-        auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
-        const float *src0_ptr = reinterpret_cast<const float*>(srcMemory0.GetData()) +
-                srcMemory0.GetDescriptor().data.layout_desc.blocking.offset_padding;
-        const float *src1_ptr = reinterpret_cast<const float*>(srcMemory1.GetData()) +
-                srcMemory1.GetDescriptor().data.layout_desc.blocking.offset_padding;
         float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
                 getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
         const size_t data_size = srcMemory0.GetSize() / sizeof(float) / srcMemory0.GetDims()[0] * batchToProcess();
 
-        if (op == EltwiseLayer::Prod) {
-            #pragma omp parallel for
-            for (int i = 0; i < data_size; i++)
-                dst_ptr[i] = src0_ptr[i] * src1_ptr[i];
-
-            for (int j = 2; j < getParentEdges().size(); j++) {
-                const float *src_ptr = reinterpret_cast<const float *>(getParentEdgeAt(j)->getMemory().GetData()) +
-                        getParentEdgeAt(j)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-                #pragma omp parallel for
-                for (int i = 0; i < data_size; i++)
-                    dst_ptr[i] = dst_ptr[i] * src_ptr[i];
+        auto source = [&](size_t i) -> EltwiseSource {
+            auto tile = std::dynamic_pointer_cast<MKLDNNTileNode>(getParentEdgeAt(i)->getParent());
+            if (tile && tile->isBroadcastView()) {
+                auto& tileInput = tile->getParentEdgeAt(0)->getMemory();
+                memory::dims inDims = tileInput.GetDims();
+                size_t inner = 1;
+                for (size_t d = tile->getAxis(); d < inDims.size(); d++)
+                    inner *= inDims[d];
+                return {reinterpret_cast<const float*>(tileInput.GetData()) +
+                        tileInput.GetDescriptor().data.layout_desc.blocking.offset_padding,
+                        static_cast<size_t>(tile->getTiles()), inner};
             }
-        } else if (op == EltwiseLayer::Max)  {
-            #pragma omp parallel for
-            for (int i = 0; i < data_size; i++)
-                dst_ptr[i] = std::max(src0_ptr[i], src1_ptr[i]);
-
-            for (int j = 2; j < getParentEdges().size(); j++) {
-                const float *src_ptr = reinterpret_cast<const float*>(getParentEdgeAt(j)->getMemory().GetData()) +
-                        getParentEdgeAt(j)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+            auto& srcMemory = getParentEdgeAt(i)->getMemory();
+            return {reinterpret_cast<const float*>(srcMemory.GetData()) +
+                    srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding, 1, data_size};
+        };
+        const EltwiseSource dst = {dst_ptr, 1, data_size};
 
-                #pragma omp parallel for
-                for (int i = 0; i < data_size; i++)
-                    dst_ptr[i] = std::max(dst_ptr[i], src_ptr[i]);
-            }
+        if (op == EltwiseLayer::Prod) {
+            auto prod = [](float a, float b) { return a * b; };
+            eltwisePass(dst_ptr, source(inputOrder[0]), source(inputOrder[1]), data_size, prod);
+            for (size_t j = 2; j < getParentEdges().size(); j++)
+                eltwisePass(dst_ptr, dst, source(inputOrder[j]), data_size, prod);
+        } else if (op == EltwiseLayer::Max)  {
+            auto max = [](float a, float b) { return std::max(a, b); };
+            eltwisePass(dst_ptr, source(inputOrder[0]), source(inputOrder[1]), data_size, max);
+            for (size_t j = 2; j < getParentEdges().size(); j++)
+                eltwisePass(dst_ptr, dst, source(inputOrder[j]), data_size, max);
         }
     }
 }
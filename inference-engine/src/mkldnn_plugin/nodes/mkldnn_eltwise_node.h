@@ -23,6 +23,9 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override;
+    bool canShareInputMemory(size_t inputIdx) const override {
+        return true;
+    }
 
     bool isSum();
     bool isUnitScales();
@@ -31,6 +34,9 @@ private:
     static Register<MKLDNNEltwiseNode> reg;
     InferenceEngine::EltwiseLayer::eOperation op;
     std::vector<float> sum_scales;
+    // the order of reading the inputs: the input sharing the memory of the output first, so it is read before
+    // the output overwrites it
+    std::vector<size_t> inputOrder;
 };
 
 }  // namespace MKLDNNPlugin
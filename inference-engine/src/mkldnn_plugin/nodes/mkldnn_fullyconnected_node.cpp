@@ -4,16 +4,121 @@
 //
 
 #include "mkldnn_fullyconnected_node.h"
+#include "mkldnn_activation_node.h"
+#include "mkldnn_weights_cache.h"
+#include "mkldnn_channel_affine.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <immintrin.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
+#include <precision_utils.h>
+#include <blob_factory.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+// the weights decompressed at once: 4 KB of FP32 stay in L1 while the batch is multiplied by them
+const int weightsBlock = 1024;
+
+// 4 FP16 values (in the low halves of the 32-bit lanes) to FP32: the exponent is rebased by the integer addition,
+// the infinities and the NaNs get the maximal exponent back
+inline __m128 halfToFloat(__m128i h) {
+    const __m128i shiftedExp = _mm_set1_epi32(0x7c00 << 13);
+    const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+    __m128i bits = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+    const __m128i exp = _mm_and_si128(bits, shiftedExp);
+    bits = _mm_add_epi32(bits, _mm_set1_epi32((127 - 15) << 23));
+    // inf and nan keep the max exponent
+    const __m128i infnan = _mm_cmpeq_epi32(exp, shiftedExp);
+    bits = _mm_add_epi32(bits, _mm_and_si128(infnan, _mm_set1_epi32((128 - 16) << 23)));
+    // the denormals are renormalized in the float domain without the denormal arithmetic
+    const __m128i denormal = _mm_cmpeq_epi32(exp, _mm_setzero_si128());
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+    const __m128 renormalized = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1 << 23))), magic);
+    const __m128 value = _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(denormal), renormalized),
+                                   _mm_andnot_ps(_mm_castsi128_ps(denormal), _mm_castsi128_ps(bits)));
+    return _mm_or_ps(value, _mm_castsi128_ps(sign));
+}
+
+void decompress(const ie_fp16 *src, float *dst, int size) {
+    int i = 0;
+    for (; i <= size - 4; i += 4) {
+        __m128i h = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i)));
+        _mm_storeu_ps(dst + i, halfToFloat(h));
+    }
+    if (i < size) {
+        // the tail goes through the same conversion, so every weight is converted alike
+        ie_fp16 tail[4] = {0, 0, 0, 0};
+        float converted[4];
+        std::memcpy(tail, src + i, (size - i) * sizeof(ie_fp16));
+        _mm_storeu_ps(converted, halfToFloat(_mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(tail)))));
+        std::memcpy(dst + i, converted, (size - i) * sizeof(float));
+    }
+}
+
+void decompress(const int8_t *src, float *dst, int size) {
+    int i = 0;
+    for (; i <= size - 4; i += 4) {
+        int32_t packed;
+        std::memcpy(&packed, src + i, sizeof(packed));
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed))));
+    }
+    for (; i < size; i++)
+        dst[i] = static_cast<float>(src[i]);
+}
+
+// BF16 is the upper half of FP32, so the conversion is the shift of the 16 bits
+void decompressBF16(const short *src, float *dst, int size) {
+    int i = 0;
+    for (; i <= size - 4; i += 4) {
+        __m128i h = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i)));
+        _mm_storeu_ps(dst + i, _mm_castsi128_ps(_mm_slli_epi32(h, 16)));
+    }
+    for (; i < size; i++) {
+        uint32_t bits = static_cast<uint32_t>(static_cast<uint16_t>(src[i])) << 16;
+        std::memcpy(dst + i, &bits, sizeof(float));
+    }
+}
+
+inline float dot(const float *a, const float *b, int size) {
+    __m128 sum0 = _mm_setzero_ps(), sum1 = _mm_setzero_ps();
+    int i = 0;
+    for (; i <= size - 8; i += 8) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+    }
+    __m128 v = _mm_add_ps(sum0, sum1);
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+    float sum = _mm_cvtss_f32(v);
+    for (; i < size; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+std::vector<float> toFloats(const Blob::Ptr &blob) {
+    std::vector<float> values(blob->size());
+    if (blob->precision() == Precision::FP16) {
+        PrecisionUtils::f16tof32Arrays(values.data(), blob->cbuffer().as<const short *>(), values.size());
+    } else if (blob->precision() == Precision::FP32) {
+        std::copy_n(blob->cbuffer().as<const float *>(), values.size(), values.begin());
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported precision " << blob->precision() << " of the blob";
+    }
+    return values;
+}
+
+}  // namespace
+
 MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {
     internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
         return MKLDNNMemoryDesc(primitive_desc_it.weights_primitive_desc(0).desc());
@@ -65,12 +170,88 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
                            << inDims.ndims() << " dims.";
     }
 
+    // the ScaleShift and BatchNormalization fused to the layer are folded into its weights and biases
+    MKLDNNChannelAffine affine(fusedWith, fcLayer->_out_num);
+
+    Blob::Ptr weightsBlob = fcLayer->_weights;
+    weightsPrecision = weightsBlob->precision();
+    // the sparse FP32 weights keep the sparse kernel, it reads even less than BF16
+    if (bf16Weights && weightsPrecision == Precision::FP32 && getCnnLayer()->precision == Precision::FP32 &&
+            !MKLDNNSparseWeights::isSparse(weightsBlob->cbuffer().as<const float *>(), weightsBlob->size())) {
+        Blob::Ptr roundedBlob = make_blob_with_precision(TensorDesc(Precision::BF16, {weightsBlob->size()}, Layout::C));
+        roundedBlob->allocate();
+        PrecisionUtils::f32tobf16Arrays(roundedBlob->buffer().as<short *>(), weightsBlob->cbuffer().as<const float *>(),
+                                        weightsBlob->size());
+        weightsBlob = roundedBlob;
+        weightsPrecision = Precision::BF16;
+    }
+    if (weightsPrecision == Precision::FP16 || weightsPrecision == Precision::BF16 ||
+            weightsPrecision == Precision::I8) {
+        const size_t outputs = fcLayer->_out_num;
+        const size_t inputs = MKLDNNDims(weightsDims).size() / outputs;
+        inputSize = static_cast<int>(inputs);
+        if (weightsBlob->size() != outputs * inputs)
+            THROW_IE_EXCEPTION << "Incorrect size of the weights of layer " << fcLayer->name;
+
+        scales.assign(outputs, 1.0f);
+        if (weightsPrecision == Precision::I8) {
+            auto scalesBlob = fcLayer->blobs.find("w-scale");
+            if (scalesBlob == fcLayer->blobs.end() || scalesBlob->second->size() != outputs)
+                THROW_IE_EXCEPTION << "The I8 weights of layer " << fcLayer->name
+                                   << " require the w-scale blob with a scale per output channel";
+            scales = toFloats(scalesBlob->second);
+        }
+        biases.assign(outputs, 0.0f);
+        if (fcLayer->_biases != nullptr && fcLayer->_biases->size() != 0) {
+            if (fcLayer->_biases->size() != outputs)
+                THROW_IE_EXCEPTION << "Incorrect size of the biases of layer " << fcLayer->name;
+            biases = toFloats(fcLayer->_biases);
+        }
+        if (!affine.empty()) {
+            for (size_t o = 0; o < outputs; o++)
+                scales[o] *= affine.scale[o];
+            affine.foldBiases(biases.data());
+        }
+        compressedBlob = weightsBlob;
+        compressedWeights = true;
+        return;
+    }
+
     internalBlobs.push_back(createInternalBlob(weightsDims, true));
 
     bool withBiases = (fcLayer->_biases != nullptr && fcLayer->_biases->size() != 0);
-    if (withBiases) {
+    if (withBiases || affine.hasShift()) {
         biasesDims.push_back(static_cast<int>(fcLayer->_out_num));
-        internalBlobs.push_back(createInternalBlob(biasesDims, false));
+        if (withBiases) {
+            internalBlobs.push_back(createInternalBlob(biasesDims, false));
+        } else {
+            Blob::Ptr zeroBiases = make_shared_blob<float>(TensorDesc(Precision::FP32, biasesDims, Layout::C));
+            zeroBiases->allocate();
+            memset(zeroBiases->buffer(), 0, zeroBiases->byteSize());
+            internalBlobs.push_back(zeroBiases);
+            withBiases = true;
+        }
+    }
+    if (!affine.empty()) {
+        if (internalBlobs[0]->precision() != Precision::FP32)
+            THROW_IE_EXCEPTION << "Cannot fold the fused layers into the weights of layer " << fcLayer->name;
+        float *weights = internalBlobs[0]->buffer().as<float *>();
+        size_t inputs = internalBlobs[0]->size() / fcLayer->_out_num;
+        for (size_t i = 0; i < internalBlobs[0]->size(); i++)
+            weights[i] *= affine.scale[i / inputs];
+        if (withBiases)
+            affine.foldBiases(internalBlobs[1]->buffer().as<float *>());
+    }
+
+    const float *weights = internalBlobs[0]->cbuffer().as<const float *>();
+    if (MKLDNNSparseWeights::isSparse(weights, internalBlobs[0]->size())) {
+        const int outputs = static_cast<int>(fcLayer->_out_num);
+        sparseWeights.reset(new MKLDNNSparseWeights(getEngine(), weights, outputs,
+                                                    static_cast<int>(internalBlobs[0]->size() / outputs)));
+        if (withBiases) {
+            const float *biasesData = internalBlobs[1]->cbuffer().as<const float *>();
+            biases.assign(biasesData, biasesData + internalBlobs[1]->size());
+        }
     }
 
     for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
@@ -81,11 +262,88 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+    if (!compressedWeights)
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+    if (!compressedWeights && !sparseWeights)
+        return;
+
+    // the kernel reads the planar input as the rows of the batch, the order of the weights of the IR
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(Precision::FP32);
+    MKLDNNDims inDims = getParentEdgeAt(0)->getDims();
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    InferenceEngine::DataConfig inConfig;
+    inConfig.inPlace = -1;
+    inConfig.constant = false;
+    inConfig.desc = MKLDNNMemoryDesc(inDims, dataType, inDims.ndims() == 4 ? memory::nchw : memory::nc);
+    config.inConfs.push_back(inConfig);
+
+    InferenceEngine::DataConfig outConfig;
+    outConfig.inPlace = -1;
+    outConfig.constant = false;
+    outConfig.desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dataType, memory::nc);
+    config.outConfs.push_back(outConfig);
+    supportedPrimitiveDescriptors.push_back({config, compressedWeights ? impl_desc_type::gemm_any
+                                                                       : impl_desc_type::sparse_sse42});
+}
+
+bool MKLDNNFullyConnectedNode::isSparse() const {
+    auto selected_pd = getSelectedPrimitiveDescriptor();
+    return sparseWeights && selected_pd != nullptr &&
+           selected_pd->getImplementationType() == impl_desc_type::sparse_sse42;
+}
+
+void MKLDNNFullyConnectedNode::initDescriptor(const InferenceEngine::LayerConfig& config) {
+    // the configuration of the sparse kernel is fixed, it has no descriptor of mkl-dnn to match
+    if (isSparse())
+        return;
+    MKLDNNNode::initDescriptor(config);
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (compressedWeights) {
+        if (compressedMemory)
+            return;
+        auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+        auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+        if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+        if (getSelectedPrimitiveDescriptor() == nullptr)
+            THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+
+        // the compressed weights are shared by the graphs of the streams and the other loads of the model
+        auto dataType = weightsPrecision == Precision::I8 ? memory::s8 : memory::s16;
+        MKLDNNDims dims({static_cast<int>(compressedBlob->size())});
+        MKLDNNMemoryDesc desc(dims, dataType, memory::x);
+        auto createMemory = [&]() -> MKLDNNMemoryPtr {
+            MKLDNNMemoryPtr weightsMemory(new MKLDNNMemory(getEngine()));
+            weightsMemory->Create(dims, dataType, memory::x);
+            weightsMemory->SetData(dataType, memory::x, compressedBlob->buffer(), compressedBlob->byteSize());
+            return weightsMemory;
+        };
+        std::string key = MKLDNNWeightsCache::makeKey(compressedBlob->buffer(), compressedBlob->byteSize(), desc,
+                                                      "compressed_fc");
+        compressedMemory = MKLDNNWeightsCache::findOrCreate(key, createMemory);
+        // the weights of the IR are not needed any more
+        compressedBlob.reset();
+
+        const size_t batch = getParentEdgeAt(0)->getDims()[0];
+        bufferSize = weightsBlock + batch;
+        buffers.resize(bufferSize * parallel_get_max_threads());
         return;
+    }
 
-    auto prim_desc = createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>();
+    if (prim || isSparse())
+        return;
+
+    auto prim_desc = createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(
+            initPrimitiveAttr());
 
     if (internalBlobs.size() > 1) {
         prim.reset(new inner_product_forward(prim_desc,
@@ -101,6 +359,102 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     }
 }
 
+mkldnn::primitive_attr MKLDNNFullyConnectedNode::initPrimitiveAttr() const {
+    mkldnn::post_ops ops;
+    for (auto &node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            ops.append_eltwise(1.0, activationNode->getAlgorithm(), activationNode->getAlpha(),
+                               activationNode->getBeta());
+        }
+    }
+
+    mkldnn::primitive_attr attr;
+    attr.set_post_ops(ops);
+    return attr;
+}
+
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (compressedWeights) {
+        executeCompressed();
+    } else if (isSparse()) {
+        executeSparse();
+    } else {
+        MKLDNNNode::execute(strm);
+    }
+}
+
+void MKLDNNFullyConnectedNode::activate(float* data, size_t size) const {
+    for (const auto &node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode)
+            activationNode->apply(data, size);
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeCompressed() {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const int batch = batchToProcess();
+    const int outputs = static_cast<int>(scales.size());
+    const int inputs = inputSize;
+    const void *weights = compressedMemory->GetData();
+    const Precision::ePrecision precision = weightsPrecision;
+
+    // every row of the weights is read once for the whole batch, the layers with large weights are memory-bound
+    parallel_for(outputs, [&](int o) {
+        float *block = buffers.data() + bufferSize * parallel_get_thread_num();
+        float *sums = block + weightsBlock;
+        std::fill(sums, sums + batch, 0.0f);
+
+        for (int k = 0; k < inputs; k += weightsBlock) {
+            const int size = std::min(weightsBlock, inputs - k);
+            const size_t offset = static_cast<size_t>(o) * inputs + k;
+            if (precision == Precision::FP16)
+                decompress(reinterpret_cast<const ie_fp16 *>(weights) + offset, block, size);
+            else if (precision == Precision::BF16)
+                decompressBF16(reinterpret_cast<const short *>(weights) + offset, block, size);
+            else
+                decompress(reinterpret_cast<const int8_t *>(weights) + offset, block, size);
+            for (int n = 0; n < batch; n++)
+                sums[n] += dot(src_ptr + static_cast<size_t>(n) * inputs + k, block, size);
+        }
+
+        for (int n = 0; n < batch; n++)
+            dst_ptr[static_cast<size_t>(n) * outputs + o] = sums[n] * scales[o] + biases[o];
+    });
+
+    if (!fusedWith.empty()) {
+        parallel_for(batch, [&](int n) {
+            activate(dst_ptr + static_cast<size_t>(n) * outputs, outputs);
+        });
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const int batch = batchToProcess();
+    const int outputs = sparseWeights->getRows();
+    sparseWeights->multiplyRows(src_ptr, dst_ptr, batch, biases.empty() ? nullptr : biases.data());
+
+    if (!fusedWith.empty()) {
+        parallel_for(batch, [&](int n) {
+            activate(dst_ptr + static_cast<size_t>(n) * outputs, outputs);
+        });
+    }
+}
+
 bool MKLDNNFullyConnectedNode::created() const {
     return getType() == FullyConnected;
 }
@@ -125,6 +479,7 @@ memory::format MKLDNNFullyConnectedNode::weightsFormatForSrcFormat(memory::forma
 const std::vector<impl_desc_type>& MKLDNNFullyConnectedNode::getPrimitivesPriority() {
     std::vector<impl_desc_type> priorities = {
             impl_desc_type::unknown,
+            impl_desc_type::sparse_sse42,
             impl_desc_type::gemm_blas,
             impl_desc_type::gemm_avx512,
             impl_desc_type::gemm_avx2,
@@ -154,6 +509,8 @@ const std::vector<impl_desc_type>& MKLDNNFullyConnectedNode::getPrimitivesPriori
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                                 const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    if (compressedWeights)
+        return;
     MKLDNNMemoryDesc in_candidate(inputDesc[0]);
     MKLDNNMemoryDesc out_candidate(outputDesc[0]);
     memory::format weights_fmt = weightsFormatForSrcFormat(in_candidate.getFormat());
@@ -7,6 +7,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "mkldnn_sparse_weights.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -19,7 +20,9 @@ public:
     ~MKLDNNFullyConnectedNode() override = default;
 
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -28,12 +31,48 @@ public:
     const std::vector<impl_desc_type>& getPrimitivesPriority() override;
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
+    void initDescriptor(const InferenceEngine::LayerConfig& config) override;
+    mkldnn::primitive_attr initPrimitiveAttr() const override;
+
+    /**
+     * @brief Makes the node keep its dense FP32 weights in BF16 (see KEY_ENFORCE_BF16), it is set before
+     * the descriptors of the node are enumerated
+     */
+    void setBF16Weights() {
+        bf16Weights = true;
+    }
 
 private:
     static Register<MKLDNNFullyConnectedNode> reg;
     InferenceEngine::SizeVector weightsDims;
     InferenceEngine::SizeVector biasesDims;
     mkldnn::memory::format weightsFormatForSrcFormat(mkldnn::memory::format sourceFormat);
+
+    /**
+     * The weights stored in FP16 or in I8 with the per output channel scales (the w-scale blob) stay compressed
+     * in the memory and are decompressed by the kernel of the node on the fly, a block of a row at a time.
+     * The memory-bound layers with large weights read a half or a quarter of the bytes of the FP32 weights.
+     * The FP32 weights of the BF16 mode are rounded to BF16 at the load and go through the same kernel.
+     */
+    bool compressedWeights = false;
+    bool bf16Weights = false;
+    InferenceEngine::Precision weightsPrecision;
+    InferenceEngine::Blob::Ptr compressedBlob;
+    MKLDNNMemoryPtr compressedMemory;
+    std::vector<float> scales;
+    std::vector<float> biases;
+    int inputSize = 0;
+    // the decompressed block of the weights row and the sums of the batch, per thread
+    size_t bufferSize = 0;
+    std::vector<float> buffers;
+
+    // the FP32 weights pruned enough for the sparse kernel, it is offered besides the primitives of mkl-dnn
+    MKLDNNSparseWeights::Ptr sparseWeights;
+
+    void executeCompressed();
+    bool isSparse() const;
+    void executeSparse();
+    void activate(float* data, size_t size) const;
 };
 
 }  // namespace MKLDNNPlugin
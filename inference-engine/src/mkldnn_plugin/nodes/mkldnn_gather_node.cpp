@@ -0,0 +1,200 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_gather_node.h"
+#include <ie_layers.h>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
+#include <immintrin.h>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the rows are picked at random from a dictionary much larger than the caches, so the row some iterations ahead is
+// requested before it is copied
+const size_t prefetchDistance = 8;
+const size_t cacheLine = 64;
+
+inline void prefetchRow(const float *row, size_t size) {
+    const char *bytes = reinterpret_cast<const char *>(row);
+    for (size_t offset = 0; offset < size * sizeof(float); offset += cacheLine)
+        _mm_prefetch(bytes + offset, _MM_HINT_T0);
+}
+
+inline void addRow(float *dst, const float *row, size_t size) {
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(row + i)));
+    for (; i < size; i++)
+        dst[i] += row[i];
+}
+
+// the row of the dictionary the value of the indices takes, the values out of the dictionary give the rows count
+inline size_t rowIndex(float value, size_t rows) {
+    return value >= 0.f && value < static_cast<float>(rows) ? static_cast<size_t>(value) : rows;
+}
+
+const float *dataOf(const MKLDNNMemory &memory) {
+    return reinterpret_cast<const float *>(memory.GetData()) +
+           memory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+}
+
+}  // namespace
+
+MKLDNNGatherNode::MKLDNNGatherNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
+
+void MKLDNNGatherNode::fuseBagPooling(bool mean) {
+    bagPooling = mean ? BagPooling::Mean : BagPooling::Sum;
+}
+
+size_t MKLDNNGatherNode::getBagSize() const {
+    if (bagPooling == BagPooling::None || inDims.size() < 2)
+        return 0;
+    return inDims[1][inDims[1].ndims() - 1];
+}
+
+void MKLDNNGatherNode::getSupportedDescriptors() {
+    auto * gatherLayer = dynamic_cast<GatherLayer*>(getCnnLayer().get());
+
+    if (gatherLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot convert gather layer.";
+
+    if (getParentEdges().size() != 2)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges.";
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges.";
+
+    auto dictDims = getParentEdgeAt(0)->getDims().ToSizeVector();
+    auto indicesDims = getParentEdgeAt(1)->getDims().ToSizeVector();
+    int rank = static_cast<int>(dictDims.size());
+    axis = gatherLayer->axis < 0 ? gatherLayer->axis + rank : gatherLayer->axis;
+    if (axis < 0 || axis >= rank)
+        THROW_IE_EXCEPTION << "Gather " << getName() << " has the axis out of the dictionary dimensions.";
+
+    outerSize = 1;
+    for (int i = 0; i < axis; i++)
+        outerSize *= dictDims[i];
+    dictRows = dictDims[axis];
+    rowSize = 1;
+    for (int i = axis + 1; i < rank; i++)
+        rowSize *= dictDims[i];
+    indicesSize = 1;
+    for (auto dim : indicesDims)
+        indicesSize *= dim;
+
+    size_t outSize = getChildEdgeAt(0)->getDims().size();
+    size_t rows = bagPooling == BagPooling::None ? outerSize * indicesSize : indicesSize / getBagSize();
+    if (outSize != rows * rowSize)
+        THROW_IE_EXCEPTION << "Gather " << getName() << " has incompatible dimensions of the inputs and the output.";
+}
+
+void MKLDNNGatherNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // the indices come as FP32 like the other inputs of the graph, they are exact up to 2^24 rows
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        auto dims = getParentEdgeAt(i)->getDims();
+        dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+        config.inConfs.push_back(dataConfig);
+    }
+    InferenceEngine::DataConfig dataConfig;
+    dataConfig.inPlace = -1;
+    dataConfig.constant = false;
+    auto dims = getChildEdgeAt(0)->getDims();
+    dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+    config.outConfs.push_back(dataConfig);
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+}
+
+void MKLDNNGatherNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+}
+
+void MKLDNNGatherNode::gatherRows(const float *dict, const float *indices, float *dst) const {
+    const size_t rows = outerSize * indicesSize;
+    parallel_for(rows, [&](size_t r) {
+        const size_t outer = r / indicesSize;
+        const float *dictOuter = dict + outer * dictRows * rowSize;
+        // the threads take the contiguous ranges of the rows, so the row prefetched is the one the thread copies next
+        if (r + prefetchDistance < rows) {
+            size_t ahead = r + prefetchDistance;
+            size_t index = rowIndex(indices[ahead % indicesSize], dictRows);
+            if (index < dictRows)
+                prefetchRow(dict + ((ahead / indicesSize) * dictRows + index) * rowSize, rowSize);
+        }
+
+        float *dstRow = dst + r * rowSize;
+        size_t index = rowIndex(indices[r % indicesSize], dictRows);
+        // the indices out of the dictionary give the zero rows
+        if (index < dictRows)
+            std::memcpy(dstRow, dictOuter + index * rowSize, rowSize * sizeof(float));
+        else
+            std::memset(dstRow, 0, rowSize * sizeof(float));
+    });
+}
+
+void MKLDNNGatherNode::poolBags(const float *dict, const float *indices, float *dst) const {
+    const size_t bagSize = getBagSize();
+    const size_t bags = indicesSize / bagSize;
+    const float scale = bagPooling == BagPooling::Mean ? 1.f / bagSize : 1.f;
+    parallel_for(bags, [&](size_t bag) {
+        const float *bagIndices = indices + bag * bagSize;
+        float *dstRow = dst + bag * rowSize;
+        std::memset(dstRow, 0, rowSize * sizeof(float));
+        for (size_t i = 0; i < bagSize; i++) {
+            if (i + prefetchDistance < bagSize) {
+                size_t index = rowIndex(bagIndices[i + prefetchDistance], dictRows);
+                if (index < dictRows)
+                    prefetchRow(dict + index * rowSize, rowSize);
+            }
+            size_t index = rowIndex(bagIndices[i], dictRows);
+            if (index < dictRows)
+                addRow(dstRow, dict + index * rowSize, rowSize);
+        }
+        if (scale != 1.f) {
+            for (size_t j = 0; j < rowSize; j++)
+                dstRow[j] *= scale;
+        }
+    });
+}
+
+void MKLDNNGatherNode::execute(mkldnn::stream strm) {
+    const float *dict = dataOf(getParentEdgeAt(0)->getMemory());
+    const float *indices = dataOf(getParentEdgeAt(1)->getMemory());
+    float *dst = const_cast<float *>(dataOf(getChildEdgeAt(0)->getMemory()));
+
+    if (bagPooling == BagPooling::None)
+        gatherRows(dict, indices, dst);
+    else
+        poolBags(dict, indices, dst);
+}
+
+bool MKLDNNGatherNode::created() const {
+    return getType() == Gather;
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNGatherNode : public MKLDNNNode {
+public:
+    MKLDNNGatherNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
+    ~MKLDNNGatherNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    /**
+     * @brief The rows gathered for the innermost dimension of the indices (a bag) are summed up or averaged into
+     * one row, as the Pooling (and the Power scaling it to the sum) following the node did
+     */
+    void fuseBagPooling(bool mean);
+    /**
+     * @brief The number of the rows of a bag the fused pooling reduces, 0 before the pooling is fused
+     */
+    size_t getBagSize() const;
+
+private:
+    static Register<MKLDNNGatherNode> reg;
+
+    enum class BagPooling {
+        None,
+        Sum,
+        Mean
+    };
+    BagPooling bagPooling = BagPooling::None;
+
+    int axis = 0;
+    // the dictionary is [outerSize, dictRows, rowSize] around the axis
+    size_t outerSize = 0;
+    size_t dictRows = 0;
+    size_t rowSize = 0;
+    size_t indicesSize = 0;
+
+    void gatherRows(const float *dict, const float *indices, float *dst) const;
+    void poolBags(const float *dict, const float *indices, float *dst) const;
+};
+
+}  // namespace MKLDNNPlugin
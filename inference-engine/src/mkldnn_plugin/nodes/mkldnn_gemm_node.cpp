@@ -0,0 +1,218 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_gemm_node.h"
+#include <ie_layers.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <mkldnn.h>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the offsets of the matrices of the input for every matrix of the output, the broadcast dimensions do not move
+std::vector<size_t> batchOffsets(const SizeVector &inDims, const SizeVector &outDims) {
+    size_t inRank = inDims.size();
+    size_t outRank = outDims.size();
+    size_t batch = 1;
+    for (size_t d = 0; d + 2 < outRank; d++)
+        batch *= outDims[d];
+
+    std::vector<size_t> offsets(batch, 0);
+    for (size_t b = 0; b < batch; b++) {
+        size_t rest = b;
+        size_t stride = inDims[inRank - 1] * inDims[inRank - 2];
+        for (size_t i = 2; i < outRank; i++) {
+            size_t idx = rest % outDims[outRank - 1 - i];
+            rest /= outDims[outRank - 1 - i];
+            if (i < inRank) {
+                if (inDims[inRank - 1 - i] != 1)
+                    offsets[b] += idx * stride;
+                stride *= inDims[inRank - 1 - i];
+            }
+        }
+    }
+    return offsets;
+}
+
+const float *dataOf(const MKLDNNMemory &memory) {
+    return reinterpret_cast<const float *>(memory.GetData()) +
+           memory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+}
+
+}  // namespace
+
+MKLDNNGemmNode::MKLDNNGemmNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
+
+void MKLDNNGemmNode::fuseInputTranspose(size_t input) {
+    if (input == 0)
+        fusedTransposeA = !fusedTransposeA;
+    else
+        fusedTransposeB = !fusedTransposeB;
+}
+
+void MKLDNNGemmNode::fuseOutputTranspose() {
+    transposeOut = !transposeOut;
+}
+
+void MKLDNNGemmNode::fuseScale(float scale) {
+    fusedScale *= scale;
+}
+
+void MKLDNNGemmNode::getSupportedDescriptors() {
+    auto * gemmLayer = dynamic_cast<GemmLayer*>(getCnnLayer().get());
+
+    if (gemmLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot convert gemm layer.";
+
+    if (getParentEdges().size() != 2 && getParentEdges().size() != 3)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges.";
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges.";
+
+    alpha = gemmLayer->alpha * fusedScale;
+    beta = gemmLayer->beta * fusedScale;
+    transposeA = gemmLayer->transpose_a != fusedTransposeA;
+    transposeB = gemmLayer->transpose_b != fusedTransposeB;
+
+    auto dimsA = getParentEdgeAt(0)->getDims();
+    auto dimsB = getParentEdgeAt(1)->getDims();
+    auto dimsOut = getChildEdgeAt(0)->getDims();
+    int rankA = dimsA.ndims();
+    int rankB = dimsB.ndims();
+    int rankOut = dimsOut.ndims();
+    if (rankA < 2 || rankB < 2 || rankOut != std::max(rankA, rankB))
+        THROW_IE_EXCEPTION << "Gemm " << getName() << " has incorrect ranks of the inputs and the output.";
+
+    M = transposeA ? dimsA[rankA - 1] : dimsA[rankA - 2];
+    K = transposeA ? dimsA[rankA - 2] : dimsA[rankA - 1];
+    N = transposeB ? dimsB[rankB - 2] : dimsB[rankB - 1];
+    int KB = transposeB ? dimsB[rankB - 1] : dimsB[rankB - 2];
+    int rowsOut = transposeOut ? N : M;
+    int colsOut = transposeOut ? M : N;
+    if (K != KB || dimsOut[rankOut - 2] != rowsOut || dimsOut[rankOut - 1] != colsOut)
+        THROW_IE_EXCEPTION << "Gemm " << getName() << " has incompatible dimensions of the inputs and the output.";
+}
+
+void MKLDNNGemmNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
+
+    InferenceEngine::LayerConfig config;
+    // the batch of the output is its outer dimension when the output has the matrices of the batch
+    config.dynBatchSupport = getChildEdgeAt(0)->getDims().ndims() > 2;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        auto dims = getParentEdgeAt(i)->getDims();
+        dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+        config.inConfs.push_back(dataConfig);
+    }
+    InferenceEngine::DataConfig dataConfig;
+    dataConfig.inPlace = -1;
+    dataConfig.constant = false;
+    auto dims = getChildEdgeAt(0)->getDims();
+    dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+    config.outConfs.push_back(dataConfig);
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::gemm_any});
+}
+
+void MKLDNNGemmNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+
+    auto outDims = getChildEdgeAt(0)->getDims().ToSizeVector();
+    // the batch dimensions of the output, the matrices are taken by op(A) * op(B)
+    outDims[outDims.size() - 2] = M;
+    outDims[outDims.size() - 1] = N;
+    offsetsA = batchOffsets(getParentEdgeAt(0)->getDims().ToSizeVector(), outDims);
+    offsetsB = batchOffsets(getParentEdgeAt(1)->getDims().ToSizeVector(), outDims);
+    if (getParentEdges().size() == 3) {
+        auto dimsC = getParentEdgeAt(2)->getDims().ToSizeVector();
+        offsetsC = batchOffsets(dimsC, outDims);
+        rowStrideC = dimsC[dimsC.size() - 2] == 1 ? 0 : dimsC.back();
+        colStrideC = dimsC.back() == 1 ? 0 : 1;
+    }
+}
+
+void MKLDNNGemmNode::multiply(const float *A, const float *B, const float *C, float *dst) const {
+    float gemmBeta = 0.f;
+    if (C && beta != 0.f) {
+        // the output starts as the broadcast beta * C, the product is accumulated to it
+        for (int m = 0; m < M; m++) {
+            for (int n = 0; n < N; n++) {
+                float value = beta * C[m * rowStrideC + n * colStrideC];
+                if (transposeOut)
+                    dst[static_cast<size_t>(n) * M + m] = value;
+                else
+                    dst[static_cast<size_t>(m) * N + n] = value;
+            }
+        }
+        gemmBeta = 1.f;
+    }
+
+    // mkldnn_sgemm is column major, the row major matrices are passed to it as the transposed ones
+    const int lda = transposeA ? M : K;
+    const int ldb = transposeB ? K : N;
+    mkldnn_status_t status;
+    if (transposeOut) {
+        // the column major op(A) * op(B) is the row major transposed output
+        status = mkldnn_sgemm(transposeA ? "N" : "T", transposeB ? "N" : "T", &M, &N, &K, &alpha,
+                              A, &lda, B, &ldb, &gemmBeta, dst, &M);
+    } else {
+        // the column major op(B)^T * op(A)^T is the row major output
+        status = mkldnn_sgemm(transposeB ? "T" : "N", transposeA ? "T" : "N", &N, &M, &K, &alpha,
+                              B, &ldb, A, &lda, &gemmBeta, dst, &N);
+    }
+    if (status != mkldnn_success)
+        THROW_IE_EXCEPTION << "Gemm " << getName() << " failed to multiply the matrices.";
+}
+
+void MKLDNNGemmNode::execute(mkldnn::stream strm) {
+    const float *A = dataOf(getParentEdgeAt(0)->getMemory());
+    const float *B = dataOf(getParentEdgeAt(1)->getMemory());
+    const float *C = offsetsC.empty() ? nullptr : dataOf(getParentEdgeAt(2)->getMemory());
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    float *dst = const_cast<float *>(dataOf(dstMemory));
+
+    size_t batch = offsetsA.size();
+    auto outDims = dstMemory.GetDims();
+    if (outDims.size() > 2)
+        batch = batch / outDims[0] * batchToProcess();
+    const size_t matrix = static_cast<size_t>(M) * N;
+
+    auto multiplyBatch = [&](size_t b) {
+        multiply(A + offsetsA[b], B + offsetsB[b], C ? C + offsetsC[b] : nullptr, dst + b * matrix);
+    };
+    // sgemm parallelizes a single product itself, many small products of the heads are run in parallel
+    if (batch >= static_cast<size_t>(parallel_get_max_threads())) {
+        parallel_for(batch, multiplyBatch);
+    } else {
+        for (size_t b = 0; b < batch; b++)
+            multiplyBatch(b);
+    }
+}
+
+bool MKLDNNGemmNode::created() const {
+    return getType() == Gemm;
+}
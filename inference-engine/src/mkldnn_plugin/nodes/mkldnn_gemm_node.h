@@ -0,0 +1,68 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNGemmNode : public MKLDNNNode {
+public:
+    MKLDNNGemmNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
+    ~MKLDNNGemmNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    /**
+     * @brief The Permute swapping the two innermost dimensions of the input (0 or 1) is dropped, the matrices of
+     * the input are read transposed instead
+     */
+    void fuseInputTranspose(size_t input);
+    /**
+     * @brief The Permute swapping the two innermost dimensions of the output is dropped, the matrices of the output
+     * are written transposed instead
+     */
+    void fuseOutputTranspose();
+    /**
+     * @brief The Power scaling the output is dropped, alpha and beta are scaled instead
+     */
+    void fuseScale(float scale);
+
+private:
+    static Register<MKLDNNGemmNode> reg;
+
+    float alpha = 1.f;
+    float beta = 1.f;
+    bool transposeA = false;
+    bool transposeB = false;
+    bool transposeOut = false;
+    // the transposes and the scale of the fused neighbors, applied on top of the params of the layer
+    bool fusedTransposeA = false;
+    bool fusedTransposeB = false;
+    float fusedScale = 1.f;
+
+    int M = 0;
+    int N = 0;
+    int K = 0;
+    // the offsets of the matrices of the inputs for every matrix of the output, the broadcast ones repeat
+    std::vector<size_t> offsetsA;
+    std::vector<size_t> offsetsB;
+    std::vector<size_t> offsetsC;
+    // the matrix of the third input is a row, a column or a scalar when its dimensions are broadcast
+    size_t rowStrideC = 0;
+    size_t colStrideC = 0;
+
+    void multiply(const float *A, const float *B, const float *C, float *dst) const;
+};
+
+}  // namespace MKLDNNPlugin
@@ -202,8 +202,35 @@ void MKLDNNGenericNode::cleanup() {
 }
 
 void MKLDNNGenericNode::execLayer() {
+    // the blobs are rebuilt only if the batch or the memory of an edge has changed since the last inference,
+    // e.g. the infer request binds the edges next to the inputs and the outputs to its blobs
+    int batch = batchToProcess();
+    bool rebind = batch != execBatch || execPointers.size() != getParentEdges().size() + getChildEdges().size();
+    for (size_t i = 0; !rebind && i < getParentEdges().size(); i++)
+        rebind = getParentEdgeAt(i)->getMemory().GetData() != execPointers[i];
+    for (size_t i = 0; !rebind && i < getChildEdges().size(); i++)
+        rebind = getChildEdgeAt(i)->getMemory().GetData() != execPointers[getParentEdges().size() + i];
+    if (rebind)
+        prepareExecBlobs(batch);
+
+    auto * execImpl = dynamic_cast<InferenceEngine::ILayerExecImpl *>(impls[0].get());
+    if (execImpl != nullptr) {
+        InferenceEngine::ResponseDesc resp;
+        InferenceEngine::StatusCode rc = execImpl->execute(execInputs, execOutputs, &resp);
+        if (rc != InferenceEngine::OK) {
+            THROW_IE_EXCEPTION << resp.msg;
+        }
+    }
+}
+
+void MKLDNNGenericNode::prepareExecBlobs(int batch) {
+    execInputs.clear();
+    execOutputs.clear();
+    execPointers.clear();
+    execBatch = -1;
+
     bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
+    auto& inputs = execInputs;
     std::vector<InferenceEngine::TensorDesc> inputDescs;
     std::vector<InferenceEngine::TensorDesc> outputDescs;
     for (size_t i = 0; i < getParentEdges().size(); i++) {
@@ -213,7 +240,7 @@ void MKLDNNGenericNode::execLayer() {
         } else {
             // TODO: Ask the right dims using getShape() from previous node
             inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
-            inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
+            inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batch);
         }
     }
 
@@ -230,7 +257,7 @@ void MKLDNNGenericNode::execLayer() {
             inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
         }
     }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
+    auto& outputs = execOutputs;
     for (size_t i = 0; i < getChildEdges().size(); i++) {
         if (isDynBatch) {
             size_t idx = i >= outputDescs.size() ? 0 : i;
@@ -241,14 +268,12 @@ void MKLDNNGenericNode::execLayer() {
             outputs.push_back(getChildEdgeAt(i)->getBlob());
         }
     }
-    auto * execImpl = dynamic_cast<InferenceEngine::ILayerExecImpl *>(impls[0].get());
-    if (execImpl != nullptr) {
-        InferenceEngine::ResponseDesc resp;
-        InferenceEngine::StatusCode rc = execImpl->execute(inputs, outputs, &resp);
-        if (rc != InferenceEngine::OK) {
-            THROW_IE_EXCEPTION << resp.msg;
-        }
-    }
+
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        execPointers.push_back(getParentEdgeAt(i)->getMemory().GetData());
+    for (size_t i = 0; i < getChildEdges().size(); i++)
+        execPointers.push_back(getChildEdgeAt(i)->getMemory().GetData());
+    execBatch = batch;
 }
 
 MKLDNNGenericNode::~MKLDNNGenericNode() {
@@ -310,14 +335,16 @@ void MKLDNNGenericNode::initDescriptor(const InferenceEngine::LayerConfig &confi
             }
         }
 
+        // the in-place hints of the extension are kept only if the output can replace the input
         for (size_t j = 0; j < rightConfig.inConfs.size(); j++) {
-            if (getParentEdgeAt(j)->getParent()->getChildEdges().size() > 1) {
-                rightConfig.inConfs[j].inPlace = -1;
+            auto &inConf = rightConfig.inConfs[j];
+            if (inConf.inPlace >= 0 && !isInPlaceAllowed(j, static_cast<size_t>(inConf.inPlace))) {
+                inConf.inPlace = -1;
             }
         }
-        for (auto &outConf : rightConfig.outConfs) {
-            if (outConf.inPlace < getParentEdges().size() &&
-                getParentEdgeAt(static_cast<size_t>(outConf.inPlace))->getParent()->getChildEdges().size() > 1) {
+        for (size_t j = 0; j < rightConfig.outConfs.size(); j++) {
+            auto &outConf = rightConfig.outConfs[j];
+            if (outConf.inPlace >= 0 && !isInPlaceAllowed(static_cast<size_t>(outConf.inPlace), j)) {
                 outConf.inPlace = -1;
             }
         }
@@ -344,6 +371,19 @@ void MKLDNNGenericNode::initDescriptor(const InferenceEngine::LayerConfig &confi
     }
 }
 
+bool MKLDNNGenericNode::isInPlaceAllowed(size_t inIdx, size_t outIdx) {
+    if (inIdx >= getParentEdges().size() || outIdx >= getChildEdges().size())
+        return false;
+
+    auto parentEdge = getParentEdgeAt(inIdx);
+    auto parent = parentEdge->getParent();
+    // the input is read by other nodes, or it is the constant data, which is computed once for all requests
+    if (parent->getChildEdges().size() > 1 || (parent->isConstant() && !isConstant()))
+        return false;
+
+    return parentEdge->getDims() == getChildEdgeAt(outIdx)->getDims();
+}
+
 void MKLDNNGenericNode::initOptimalPrimitiveDescriptor() {
     auto config = getSelectedPrimitiveDescriptor()->getConfig();
     if (genericPrimitive) {
@@ -42,10 +42,19 @@ protected:
     std::vector<InferenceEngine::ILayerImpl::Ptr> impls;
 
 private:
+    bool isInPlaceAllowed(size_t inIdx, size_t outIdx);
+    // wraps the memory of the edges to the blobs passed to the extension for the given batch
+    void prepareExecBlobs(int batch);
+
     static Register<MKLDNNGenericNode> reg;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::MKLDNNPlugin::MKLDNNPrimitiveMemory> inputs;
     std::vector<InferenceEngine::MKLDNNPlugin::MKLDNNPrimitiveMemory> outputs;
+    // the blobs of the last inference and the memory of the edges and the batch they were made for
+    std::vector<InferenceEngine::Blob::Ptr> execInputs;
+    std::vector<InferenceEngine::Blob::Ptr> execOutputs;
+    std::vector<void*> execPointers;
+    int execBatch = -1;
 };
 
 }  // namespace MKLDNNPlugin
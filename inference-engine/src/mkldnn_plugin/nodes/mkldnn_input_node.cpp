@@ -5,6 +5,7 @@
 
 #include "mkldnn_input_node.h"
 #include "../mkldnn_extension_utils.h"
+#include <ie_tensor_offset.hpp>
 #include <string>
 
 using namespace mkldnn;
@@ -42,7 +43,8 @@ void MKLDNNInputNode::initSupportedPrimitiveDescriptors() {
     config.dynBatchSupport = true;
     if (getType() == Input || getType() == MemoryInput) {
         InferenceEngine::Precision precision = getCnnLayer()->outData[0]->getPrecision();
-        if (precision == InferenceEngine::Precision::U16 || isMeanImage)
+        if (precision == InferenceEngine::Precision::U16 || precision == InferenceEngine::Precision::BF16 ||
+                isMeanImage || isFP32Output)
             precision = InferenceEngine::Precision::FP32;
         auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
         InferenceEngine::DataConfig dataConfig;
@@ -53,7 +55,8 @@ void MKLDNNInputNode::initSupportedPrimitiveDescriptors() {
         dataConfig.desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, layout);
         config.outConfs.push_back(dataConfig);
     } else if (getType() == Output) {
-        InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
+        // the precision of the output layer is the one of the graph memory (see MKLDNNGraph::CreateGraph)
+        InferenceEngine::Precision precision = getCnnLayer()->precision;
         if (precision == InferenceEngine::Precision::U16) precision = InferenceEngine::Precision::FP32;
         auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
         InferenceEngine::DataConfig dataConfig;
@@ -99,8 +102,15 @@ void MKLDNNInputNode::execute(mkldnn::stream strm) {
     if (constBlob->size() != dstBlob->size()) {
         THROW_IE_EXCEPTION << "Incorrect blob sizes for node " << getName();
     }
-    for (size_t i = 0; i < constBlob->size(); i++) {
-        // srcData without offset() because constBlob should be planar
-        dstData[dstBlob->getTensorDesc().offset(i)] = srcData[i];
-    }
+    // constBlob should be planar, so it is copied as the dense tensor of the dims of the destination
+    const InferenceEngine::TensorDesc &dstDesc = dstBlob->getTensorDesc();
+    InferenceEngine::TensorDesc srcDesc(dstDesc.getPrecision(), dstDesc.getDims(),
+                                        InferenceEngine::TensorDesc::getLayoutByDims(dstDesc.getDims()));
+    InferenceEngine::copyByOffsets(srcData, srcDesc, dstData, dstDesc, 0, constBlob->size());
+}
+
+void MKLDNNInputNode::foldConstant() {
+    MKLDNNNode::foldConstant();
+    // the data is copied to the output edge, which keeps it till the graph is destroyed
+    constBlob.reset();
 }
@@ -22,14 +22,23 @@ public:
     bool created() const override;
 
     void execute(mkldnn::stream strm) override;
+    void foldConstant() override;
     void withMeanImage() {
         isMeanImage = true;
     }
+    /**
+     * @brief Makes the U8 input read by an FP32 convolution held in FP32, so the input is converted while it is
+     * pushed instead of being copied and then converted by the reorder
+     */
+    void withFP32Output() {
+        isFP32Output = true;
+    }
 
 private:
     static Register<MKLDNNInputNode> reg;
     InferenceEngine::Blob::Ptr constBlob;
     bool isMeanImage = false;
+    bool isFP32Output = false;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,354 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_inverted_residual_node.h"
+#include "mkldnn_activation_node.h"
+#include "mkldnn_conv_node.h"
+#include <ie_layers.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <ie_parallel_for.hpp>
+#include <mkldnn.h>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+inline int div_up(const int a, const int b) {
+    return (a + b - 1) / b;
+}
+
+bool isFP32Blob(const Blob::Ptr &blob, size_t size) {
+    return blob && blob->precision() == Precision::FP32 && blob->size() == size;
+}
+
+std::vector<float> copyBlob(const Blob::Ptr &blob, size_t size) {
+    std::vector<float> values(size, 0.0f);
+    if (blob && blob->size() != 0)
+        std::copy_n(blob->cbuffer().as<const float *>(), size, values.begin());
+    return values;
+}
+
+}  // namespace
+
+MKLDNNInvertedResidualNode::MKLDNNInvertedResidualNode(const InferenceEngine::CNNLayerPtr& layer,
+                                                       const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {
+    setType(InvertedResidual);
+}
+
+bool MKLDNNInvertedResidualNode::canFuse(const MKLDNNNodePtr& node, int stage) {
+    auto* convNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get());
+    if ((node->getType() != Convolution && node->getType() != Convolution_Activation) || !convNode ||
+            convNode->isInt8Convolution() || convNode->hasInputMean() || !node->getMergeWith().empty() ||
+            node->getParentEdges().size() != 1 || node->getChildEdges().empty())
+        return false;
+
+    auto* layer = dynamic_cast<ConvolutionLayer *>(node->getCnnLayer().get());
+    auto srcDims = node->getParentEdgeAt(0)->getDims();
+    auto dstDims = node->getChildEdgeAt(0)->getDims();
+    if (!layer || srcDims.ndims() != 4 || dstDims.ndims() != 4 || static_cast<int>(layer->_out_depth) != dstDims[1])
+        return false;
+
+    const size_t weightsSize = layer->_out_depth * static_cast<size_t>(stage == 1 ? 9 : srcDims[1]);
+    if (!isFP32Blob(layer->_weights, weightsSize) ||
+            (layer->_biases && layer->_biases->size() != 0 && !isFP32Blob(layer->_biases, layer->_out_depth)))
+        return false;
+
+    // the projection is linear, the sum with the input follows it
+    if (stage == 2 && !node->getFusedWith().empty())
+        return false;
+    for (auto &fused : node->getFusedWith()) {
+        auto* activation = dynamic_cast<MKLDNNActivationNode *>(fused.get());
+        if (!activation)
+            return false;
+        auto algorithm = activation->getAlgorithm();
+        if (algorithm != eltwise_relu && algorithm != eltwise_bounded_relu && algorithm != eltwise_clamp)
+            return false;
+    }
+
+    if (stage == 1) {
+        return layer->_group == layer->_out_depth && srcDims[1] == dstDims[1] &&
+               layer->_kernel_x == 3 && layer->_kernel_y == 3 && layer->_padding_x == 1 && layer->_padding_y == 1 &&
+               layer->_dilation_x <= 1 && layer->_dilation_y <= 1 && layer->_stride_x == layer->_stride_y &&
+               (layer->_stride_x == 1 || layer->_stride_x == 2) &&
+               dstDims[2] == (srcDims[2] - 1) / static_cast<int>(layer->_stride_y) + 1 &&
+               dstDims[3] == (srcDims[3] - 1) / static_cast<int>(layer->_stride_x) + 1;
+    }
+    return layer->_group == 1 && layer->_kernel_x == 1 && layer->_kernel_y == 1 &&
+           layer->_stride_x == 1 && layer->_stride_y == 1 && layer->_padding_x == 0 && layer->_padding_y == 0 &&
+           dstDims[2] == srcDims[2] && dstDims[3] == srcDims[3];
+}
+
+void MKLDNNInvertedResidualNode::getSupportedDescriptors() {
+    if (fusedWith.size() != 3 && fusedWith.size() != 4)
+        THROW_IE_EXCEPTION << "Inverted residual block " << getName() << " has incorrect number of layers.";
+    withResidual = fusedWith.size() == 4;
+    if (getParentEdges().size() != (withResidual ? 2 : 1))
+        THROW_IE_EXCEPTION << "Incorrect number of input edges.";
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges.";
+
+    auto srcDims = getParentEdgeAt(0)->getDims();
+    auto dstDims = getChildEdgeAt(0)->getDims();
+    inChannels = srcDims[1];
+    height = srcDims[2];
+    width = srcDims[3];
+    outChannels = dstDims[1];
+    outHeight = dstDims[2];
+    outWidth = dstDims[3];
+
+    Stage *stages[] = {&expand, &depthwise, &project};
+    for (int i = 0; i < 3; i++) {
+        auto* layer = dynamic_cast<ConvolutionLayer *>(fusedWith[i]->getCnnLayer().get());
+        if (layer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot convert convolution layer " << fusedWith[i]->getName();
+        if (i == 0)
+            expandedChannels = layer->_out_depth;
+        if (i == 1)
+            stride = layer->_stride_x;
+
+        // the weights are [out][in] matrices (1x1) or [channel][3][3] kernels (depthwise)
+        size_t inSize = i == 0 ? inChannels : (i == 1 ? 9 : expandedChannels);
+        stages[i]->weights = copyBlob(layer->_weights, layer->_out_depth * inSize);
+        stages[i]->biases = copyBlob(layer->_biases, layer->_out_depth);
+        stages[i]->activations.clear();
+        for (auto &fused : fusedWith[i]->getFusedWith()) {
+            auto* activation = dynamic_cast<MKLDNNActivationNode *>(fused.get());
+            if (activation == nullptr)
+                THROW_IE_EXCEPTION << "Layer " << fused->getName() << " cannot run in the inverted residual block.";
+            stages[i]->activations.push_back({activation->getAlgorithm(), activation->getAlpha(),
+                                              activation->getBeta()});
+        }
+    }
+}
+
+void MKLDNNInvertedResidualNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(Precision::FP32);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), dataType, memory::nchw);
+        config.inConfs.push_back(dataConfig);
+    }
+
+    InferenceEngine::DataConfig dataConfig;
+    dataConfig.inPlace = -1;
+    dataConfig.constant = false;
+    dataConfig.desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dataType, memory::nchw);
+    config.outConfs.push_back(dataConfig);
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::gemm_any});
+}
+
+void MKLDNNInvertedResidualNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+
+    // the expanded rows of a band ((rows - 1) * stride + 3 of them) and the depthwise output take a half of L2
+    const size_t halfL2 = mkldnn_get_cache_size(2, true) / 2;
+    const size_t bytesPerRow = sizeof(float) * expandedChannels * (stride * width + outWidth);
+    const size_t fixedBytes = sizeof(float) * expandedChannels * (3 - stride) * width;
+    bandRows = halfL2 > fixedBytes + bytesPerRow ? static_cast<int>((halfL2 - fixedBytes) / bytesPerRow) : 1;
+
+    // enough bands to keep all the threads busy on a small batch
+    const int threads = parallel_get_max_threads();
+    const int batch = getChildEdgeAt(0)->getDims()[0];
+    const int bandsPerImage = div_up(threads, std::max(batch, 1));
+    bandRows = std::max(1, std::min(bandRows, outHeight / bandsPerImage));
+
+    bufferSize = static_cast<size_t>(expandedChannels) *
+                 (static_cast<size_t>((bandRows - 1) * stride + 3) * width + static_cast<size_t>(bandRows) * outWidth);
+    buffers.resize(bufferSize * threads);
+}
+
+void MKLDNNInvertedResidualNode::activate(const Stage& stage, float* data, size_t size) const {
+    for (const auto &activation : stage.activations) {
+        const float alpha = activation.alpha;
+        const float beta = activation.beta;
+        switch (activation.algorithm) {
+            case eltwise_relu:
+                for (size_t i = 0; i < size; i++)
+                    data[i] = data[i] > 0.0f ? data[i] : data[i] * alpha;
+                break;
+            case eltwise_bounded_relu:
+                for (size_t i = 0; i < size; i++)
+                    data[i] = std::min(std::max(data[i], 0.0f), alpha);
+                break;
+            case eltwise_clamp:
+                for (size_t i = 0; i < size; i++)
+                    data[i] = data[i] > alpha ? alpha : (data[i] < beta ? beta : data[i]);
+                break;
+            default:
+                THROW_IE_EXCEPTION << "Unsupported activation in the inverted residual block " << getName();
+        }
+    }
+}
+
+void MKLDNNInvertedResidualNode::expandRows(const float* src, float* dst, int firstRow, int rows) const {
+    const int ld = rows * width;
+    const int r0 = std::max(firstRow, 0);
+    const int r1 = std::min(firstRow + rows, height);
+
+    // the rows out of the image are the zero padding of the depthwise convolution
+    if (r0 != firstRow || r1 != firstRow + rows) {
+        for (int c = 0; c < expandedChannels; c++) {
+            float *channel = dst + static_cast<size_t>(c) * ld;
+            std::fill(channel, channel + (r0 - firstRow) * width, 0.0f);
+            std::fill(channel + std::max(r1 - firstRow, 0) * width, channel + ld, 0.0f);
+        }
+    }
+    if (r1 <= r0)
+        return;
+
+    // column major: the pixels of the rows x the input channels times the input channels x the expanded channels
+    const int M = (r1 - r0) * width;
+    const int N = expandedChannels;
+    const int K = inChannels;
+    const int lda = height * width;
+    const float one = 1.0f, zero = 0.0f;
+    float *out = dst + (r0 - firstRow) * width;
+    mkldnn_sgemm("N", "N", &M, &N, &K, &one, src + static_cast<size_t>(r0) * width, &lda,
+                 expand.weights.data(), &K, &zero, out, &ld);
+
+    for (int c = 0; c < expandedChannels; c++) {
+        float *channel = out + static_cast<size_t>(c) * ld;
+        const float bias = expand.biases[c];
+        for (int i = 0; i < M; i++)
+            channel[i] += bias;
+        activate(expand, channel, M);
+    }
+}
+
+void MKLDNNInvertedResidualNode::depthwiseRows(const float* src, float* dst, int rows, int outRows) const {
+    const int ld = rows * width;
+    const int pixels = outRows * outWidth;
+    // the output columns reading the input columns -1 and width are the first one and the ones after lastInner
+    const int lastInner = (width - 2) / stride;
+
+    for (int c = 0; c < expandedChannels; c++) {
+        const float *in = src + static_cast<size_t>(c) * ld;
+        const float *k = depthwise.weights.data() + c * 9;
+        const float bias = depthwise.biases[c];
+        float *out = dst + static_cast<size_t>(c) * pixels;
+
+        for (int oh = 0; oh < outRows; oh++) {
+            const float *row0 = in + oh * stride * width;
+            const float *row1 = row0 + width;
+            const float *row2 = row1 + width;
+            float *o = out + oh * outWidth;
+
+            auto border = [&](int ow) {
+                float sum = bias;
+                for (int kw = 0; kw < 3; kw++) {
+                    int x = ow * stride - 1 + kw;
+                    if (x < 0 || x >= width)
+                        continue;
+                    sum += k[kw] * row0[x] + k[3 + kw] * row1[x] + k[6 + kw] * row2[x];
+                }
+                o[ow] = sum;
+            };
+
+            border(0);
+            if (stride == 1) {
+                for (int ow = 1; ow <= lastInner; ow++) {
+                    const int x = ow - 1;
+                    o[ow] = bias + k[0] * row0[x] + k[1] * row0[x + 1] + k[2] * row0[x + 2] +
+                                   k[3] * row1[x] + k[4] * row1[x + 1] + k[5] * row1[x + 2] +
+                                   k[6] * row2[x] + k[7] * row2[x + 1] + k[8] * row2[x + 2];
+                }
+            } else {
+                for (int ow = 1; ow <= lastInner && ow < outWidth; ow++) {
+                    const int x = ow * stride - 1;
+                    o[ow] = bias + k[0] * row0[x] + k[1] * row0[x + 1] + k[2] * row0[x + 2] +
+                                   k[3] * row1[x] + k[4] * row1[x + 1] + k[5] * row1[x + 2] +
+                                   k[6] * row2[x] + k[7] * row2[x + 1] + k[8] * row2[x + 2];
+                }
+            }
+            for (int ow = std::max(lastInner + 1, 1); ow < outWidth; ow++)
+                border(ow);
+        }
+        activate(depthwise, out, pixels);
+    }
+}
+
+void MKLDNNInvertedResidualNode::execute(mkldnn::stream strm) {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const float *residual_ptr = nullptr;
+    if (withResidual) {
+        auto& residualMemory = getParentEdgeAt(1)->getMemory();
+        residual_ptr = reinterpret_cast<const float*>(residualMemory.GetData()) +
+                residualMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    }
+
+    const size_t srcBatchSize = static_cast<size_t>(inChannels) * height * width;
+    const size_t outPlane = static_cast<size_t>(outHeight) * outWidth;
+    const size_t dstBatchSize = outChannels * outPlane;
+    const size_t expandedSize = static_cast<size_t>(expandedChannels) * ((bandRows - 1) * stride + 3) * width;
+    const int batch = batchToProcess();
+    const int bands = div_up(outHeight, bandRows);
+
+    parallel_nd(batch, bands, [&](int n, int b) {
+        float *expanded = buffers.data() + bufferSize * parallel_get_thread_num();
+        float *filtered = expanded + expandedSize;
+
+        const int outRow = b * bandRows;
+        const int outRows = std::min(bandRows, outHeight - outRow);
+        const int rows = (outRows - 1) * stride + 3;
+        expandRows(src_ptr + n * srcBatchSize, expanded, outRow * stride - 1, rows);
+        depthwiseRows(expanded, filtered, rows, outRows);
+
+        // the projection accumulates to the biases and the input of the block
+        const int pixels = outRows * outWidth;
+        const size_t offset = n * dstBatchSize + static_cast<size_t>(outRow) * outWidth;
+        float *dst = dst_ptr + offset;
+        for (int c = 0; c < outChannels; c++) {
+            float *channel = dst + c * outPlane;
+            const float bias = project.biases[c];
+            if (residual_ptr) {
+                const float *residual = residual_ptr + offset + c * outPlane;
+                for (int i = 0; i < pixels; i++)
+                    channel[i] = residual[i] + bias;
+            } else {
+                std::fill(channel, channel + pixels, bias);
+            }
+        }
+
+        const int N = outChannels;
+        const int K = expandedChannels;
+        const int ldc = static_cast<int>(outPlane);
+        const float one = 1.0f;
+        mkldnn_sgemm("N", "N", &pixels, &N, &K, &one, filtered, &pixels,
+                     project.weights.data(), &K, &one, dst, &ldc);
+    });
+}
+
+bool MKLDNNInvertedResidualNode::created() const {
+    return getType() == InvertedResidual;
+}
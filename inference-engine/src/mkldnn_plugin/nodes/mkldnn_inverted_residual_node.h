@@ -0,0 +1,68 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <ie_layers.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The inverted residual block of MobileNet v2 built by the graph optimizer: the 1x1 expansion convolution,
+ * the depthwise 3x3 convolution and the 1x1 projection convolution, optionally followed by the sum with the input
+ * of the block (the second input of the node).
+ * The node runs the block over the bands of the output rows: the expanded rows of the band and their depthwise
+ * convolution fit in L2, so the expanded tensor, the largest one of the block, never goes to the memory.
+ */
+class MKLDNNInvertedResidualNode : public MKLDNNNode {
+public:
+    MKLDNNInvertedResidualNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
+    ~MKLDNNInvertedResidualNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    /**
+     * @brief Checks that the convolution node can run as the given stage of the block: 0 - expansion,
+     * 1 - depthwise, 2 - projection
+     */
+    static bool canFuse(const MKLDNNNodePtr& node, int stage);
+
+private:
+    struct Activation {
+        mkldnn::algorithm algorithm;
+        float alpha;
+        float beta;
+    };
+
+    struct Stage {
+        std::vector<float> weights;
+        std::vector<float> biases;
+        std::vector<Activation> activations;
+    };
+
+    void activate(const Stage& stage, float* data, size_t size) const;
+    void expandRows(const float* src, float* dst, int firstRow, int rows) const;
+    void depthwiseRows(const float* src, float* dst, int rows, int outRows) const;
+
+    Stage expand, depthwise, project;
+    bool withResidual = false;
+
+    int inChannels = 0, expandedChannels = 0, outChannels = 0;
+    int height = 0, width = 0, outHeight = 0, outWidth = 0, stride = 1;
+    // the output rows of one band and the size of the per thread buffers
+    int bandRows = 1;
+    size_t bufferSize = 0;
+    std::vector<float> buffers;
+};
+
+}  // namespace MKLDNNPlugin
@@ -7,12 +7,118 @@
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <immintrin.h>
+#include <ie_parallel_for.hpp>
+#include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+// (k + alpha / size * sum)^-beta, alpha is divided by the local size already
+inline float lrnScale(float sum, float k, float alpha, float beta) {
+    float omega = k + alpha * sum;
+    if (beta == 0.75f) {
+        float y = 1.0f / std::sqrt(omega);
+        return y * std::sqrt(y);
+    }
+    return 1.0f / std::pow(omega, beta);
+}
+
+inline __m128 lrnScale(__m128 sum, float k, float alpha, float beta) {
+    __m128 omega = _mm_add_ps(_mm_set1_ps(k), _mm_mul_ps(_mm_set1_ps(alpha), sum));
+    if (beta == 0.75f) {
+        __m128 y = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(omega));
+        return _mm_mul_ps(y, _mm_sqrt_ps(y));
+    }
+    if (beta == 1.0f)
+        return _mm_div_ps(_mm_set1_ps(1.0f), omega);
+    float values[4];
+    _mm_storeu_ps(values, omega);
+    for (int j = 0; j < 4; j++)
+        values[j] = 1.0f / std::pow(values[j], beta);
+    return _mm_loadu_ps(values);
+}
+
+// the LRN across the channels of the planar data [N, C, HW]: the squares of the planes of the window are summed
+// in the vectors of the pixels
+void lrnAcrossPlanar(const float *src, float *dst, int N, int C, int HW, int size, float k, float alpha, float beta) {
+    const int half = (size - 1) / 2;
+
+    parallel_nd(N, C, [&](int n, int c) {
+        const int first = std::max(c - half, 0);
+        const int last = std::min(c + half, C - 1);
+        const float *sample = src + static_cast<size_t>(n) * C * HW;
+        const float *psrc = sample + static_cast<size_t>(c) * HW;
+        float *pdst = dst + (static_cast<size_t>(n) * C + c) * HW;
+
+        int i = 0;
+        for (; i + 4 <= HW; i += 4) {
+            __m128 sum = _mm_setzero_ps();
+            for (int w = first; w <= last; w++) {
+                __m128 v = _mm_loadu_ps(sample + static_cast<size_t>(w) * HW + i);
+                sum = _mm_add_ps(sum, _mm_mul_ps(v, v));
+            }
+            _mm_storeu_ps(pdst + i, _mm_mul_ps(_mm_loadu_ps(psrc + i), lrnScale(sum, k, alpha, beta)));
+        }
+        for (; i < HW; i++) {
+            float sum = 0.0f;
+            for (int w = first; w <= last; w++) {
+                float v = sample[static_cast<size_t>(w) * HW + i];
+                sum += v * v;
+            }
+            pdst[i] = psrc[i] * lrnScale(sum, k, alpha, beta);
+        }
+    });
+}
+
+// the LRN across the channels of the blocked data [N, CB, HW, block], the channels are not padded: the squares of
+// the channels of the block and of the half windows around it are put in a row, so the window sums of the lanes
+// are the sums of the row shifted by every position of the window
+void lrnAcrossBlocked(const float *src, float *dst, int N, int CB, int HW, int block, int size,
+                      float k, float alpha, float beta) {
+    const int half = (size - 1) / 2;
+    const int C = CB * block;
+    const size_t blockStride = static_cast<size_t>(HW) * block;
+    const int rowSize = block + 2 * half;
+    std::vector<float> rows(static_cast<size_t>(rowSize) * parallel_get_max_threads());
+
+    parallel_nd(N, CB, HW, [&](int n, int cb, int p) {
+        float *row = &rows[static_cast<size_t>(rowSize) * parallel_get_thread_num()];
+        const float *sample = src + static_cast<size_t>(n) * CB * blockStride + static_cast<size_t>(p) * block;
+        const float *psrc = sample + cb * blockStride;
+        float *pdst = dst + (static_cast<size_t>(n) * CB + cb) * blockStride + static_cast<size_t>(p) * block;
+
+        for (int j = 0; j < half; j++) {
+            int before = cb * block - half + j;
+            int after = (cb + 1) * block + j;
+            float v = before >= 0 ? sample[(before / block) * blockStride + before % block] : 0.0f;
+            row[j] = v * v;
+            v = after < C ? sample[(after / block) * blockStride + after % block] : 0.0f;
+            row[half + block + j] = v * v;
+        }
+        for (int l = 0; l < block; l += 4) {
+            __m128 v = _mm_loadu_ps(psrc + l);
+            _mm_storeu_ps(row + half + l, _mm_mul_ps(v, v));
+        }
+
+        for (int l = 0; l < block; l += 4) {
+            __m128 sum = _mm_loadu_ps(row + l);
+            for (int j = 1; j <= 2 * half; j++)
+                sum = _mm_add_ps(sum, _mm_loadu_ps(row + l + j));
+            _mm_storeu_ps(pdst + l, _mm_mul_ps(_mm_loadu_ps(psrc + l), lrnScale(sum, k, alpha, beta)));
+        }
+    });
+}
+
+}  // namespace
+
 MKLDNNLrnNode::MKLDNNLrnNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
 
 void MKLDNNLrnNode::getSupportedDescriptors() {
@@ -46,8 +152,42 @@ void MKLDNNLrnNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNLrnNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    MKLDNNNode::initSupportedPrimitiveDescriptors();
+
+    MKLDNNDims dims = getParentEdgeAt(0)->getDims();
+    if (!isAcrossMaps || dims.ndims() != 4)
+        return;
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].constant = false;
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+
+    // the native configs take the data of the producer as is, so the blocked data of the convolutions need no reorder
+    for (auto format : {memory::nchw, memory::nChw8c, memory::nChw16c}) {
+        if ((format == memory::nChw8c && dims[1] % 8 != 0) || (format == memory::nChw16c && dims[1] % 16 != 0))
+            continue;
+        config.inConfs[0].desc = MKLDNNMemoryDesc(dims, memory::f32, format);
+        config.outConfs[0].desc = config.inConfs[0].desc;
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+    }
+}
+
+bool MKLDNNLrnNode::isNative() const {
+    auto selected_pd = getSelectedPrimitiveDescriptor();
+    return selected_pd != nullptr && selected_pd->getImplementationType() == impl_desc_type::unknown;
+}
+
 void MKLDNNLrnNode::createPrimitive() {
-    if (prim)
+    if (prim || isNative())
         return;
 
     auto prim_desc = createPrimitiveDescriptor<lrn_forward::primitive_desc, lrn_forward::desc>();
@@ -56,6 +196,33 @@ void MKLDNNLrnNode::createPrimitive() {
                                getChildEdgeAt(0)->getMemory().GetPrimitive()));
 }
 
+void MKLDNNLrnNode::execute(mkldnn::stream strm) {
+    if (!isNative()) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float *src_data = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_data = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    memory::dims dims = srcMemory.GetDims();
+    const int N = batchToProcess();
+    const int HW = dims[2] * dims[3];
+    // the primitive divides alpha by the local size across the channels
+    const float scaledAlpha = alpha / size;
+
+    if (srcMemory.GetFormat() == memory::nChw8c || srcMemory.GetFormat() == memory::nChw16c) {
+        const int block = srcMemory.GetFormat() == memory::nChw8c ? 8 : 16;
+        lrnAcrossBlocked(src_data, dst_data, N, dims[1] / block, HW, block, size, k, scaledAlpha, beta);
+    } else {
+        lrnAcrossPlanar(src_data, dst_data, N, dims[1], HW, size, k, scaledAlpha, beta);
+    }
+}
+
 bool MKLDNNLrnNode::created() const {
     return getType() == Lrn;
 }
@@ -19,16 +19,24 @@ public:
     ~MKLDNNLrnNode() override = default;
 
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void initOptimalPrimitiveDescriptor() override;
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
     }
 
 private:
+    /**
+     * @brief Checks that the selected config runs the native LRN across the channels of the planar and blocked
+     * layouts, the MKL-DNN primitive runs the reference code for the local sizes other than 5
+     */
+    bool isNative() const;
+
     static Register<MKLDNNLrnNode> reg;
     bool isAcrossMaps;
     int size;
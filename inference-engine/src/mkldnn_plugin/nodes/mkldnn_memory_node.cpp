@@ -49,7 +49,30 @@ const MKLDNNEdgePtr MKLDNNMemoryOutputNode::getChildEdgeAt(size_t idx) const {
     return MKLDNNNode::getChildEdgeAt(idx);
 }
 
+void MKLDNNMemoryOutputNode::setStateMemories(const std::vector<MKLDNNMemoryPtr>& stateMemories,
+                                              const std::vector<MKLDNNMemoryPtr>& newStateMemories) {
+    if (stateMemories.empty() || newStateMemories.empty())
+        THROW_IE_EXCEPTION << "Memory node " << getName() << " cannot swap the states without the memories";
+    this->stateMemories = stateMemories;
+    this->newStateMemories = newStateMemories;
+}
+
+void MKLDNNMemoryOutputNode::swapStates() {
+    setStateData(newStateMemories[0]->GetData(), stateMemories[0]->GetData());
+}
+
+void MKLDNNMemoryOutputNode::setStateData(void* state, void* newState) {
+    for (auto& memory : stateMemories)
+        memory->GetPrimitivePtr()->set_data_handle(state);
+    for (auto& memory : newStateMemories)
+        memory->GetPrimitivePtr()->set_data_handle(newState);
+}
+
 void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
+    // the new state is made current by the graph at the end of the inference
+    if (swapsStates())
+        return;
+
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
     const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
@@ -12,6 +12,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -78,11 +79,57 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     void setInputNode(MKLDNNNode* node) override {
         inputNode = node;
     }
+
+    MKLDNNNode* getInputNode() const {
+        return inputNode;
+    }
+
+    /**
+     * @brief Makes the node swap the state buffers instead of copying the new state to the input sibling.
+     * The state read by the input sibling and the new state produced by the parent are kept in two buffers,
+     * which exchange their roles in swapStates().
+     * @param stateMemories - memories of the edges viewing the state buffer of the input sibling
+     * @param newStateMemories - memories of the edges viewing the buffer the new state is produced to
+     */
+    void setStateMemories(const std::vector<MKLDNNMemoryPtr>& stateMemories,
+                          const std::vector<MKLDNNMemoryPtr>& newStateMemories);
+
+    /**
+     * @brief Makes the new state the current one, called by the graph when the inference is completed
+     */
+    void swapStates();
+
+    bool swapsStates() const {
+        return !stateMemories.empty();
+    }
+
+    /**
+     * @brief Returns the buffer of the current state of the swapping node
+     */
+    void* getStateData() const {
+        return stateMemories[0]->GetData();
+    }
+
+    /**
+     * @brief Returns the buffer the swapping node produces the new state to
+     */
+    void* getNewStateData() const {
+        return newStateMemories[0]->GetData();
+    }
+
+    /**
+     * @brief Points the state memories of the swapping node to the given state buffer and the new state memories
+     * to the given new state buffer, used to infer the states of a sequence (see MKLDNNSequenceBinding)
+     */
+    void setStateData(void* state, void* newState);
+
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     MKLDNNNode* inputNode = nullptr;
+    std::vector<MKLDNNMemoryPtr> stateMemories;
+    std::vector<MKLDNNMemoryPtr> newStateMemories;
     static Register<MKLDNNMemoryOutputNode> reg;
 };
 
@@ -8,6 +8,11 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
+#include <ie_tensor_offset.hpp>
+#include <algorithm>
+#include <cstring>
+#include <xmmintrin.h>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -53,10 +58,15 @@ void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
     config.inConfs[0].constant = false;
     config.outConfs[0].inPlace = -1;
     config.outConfs[0].constant = false;
+
+    // the order moving only the dimensions of size 1 keeps the plain data as is, so the output is a view of the input
+    const bool plainView = isPlainView();
     if (getParentEdgeAt(0)->getDims().ndims() == 4) {
         config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nchw);
         config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nchw);
+        config.outConfs[0].inPlace = plainView ? 0 : -1;
         supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+        config.outConfs[0].inPlace = -1;
 
         auto srcDims = getParentEdgeAt(0)->getDims();
         if (srcDims[1] % 8 == 0) {
@@ -68,14 +78,47 @@ void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
             config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nChw16c);
             supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
         }
+
+        // NCHW -> NHWC of the channels last input (e.g. the output of the int8 convolution) is a view as well,
+        // the selection takes it when the producer writes nhwc
+        if (order == SizeVector{0, 2, 3, 1} && !plainView) {
+            config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nhwc);
+            config.outConfs[0].inPlace = 0;
+            supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+        }
     } else {
-        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::any);
+        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType,
+                                                  plainView ? MKLDNNMemory::GetPlainFormat(getParentEdgeAt(0)->getDims())
+                                                            : memory::any);
         config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType,
                                                    MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims()));
+        config.outConfs[0].inPlace = plainView ? 0 : -1;
         supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
     }
 }
 
+bool MKLDNNPermuteNode::isPlainView() const {
+    auto dims = getParentEdgeAt(0)->getDims().ToSizeVector();
+    size_t last = 0;
+    bool first = true;
+    for (auto ord : order) {
+        if (ord >= dims.size())
+            return false;
+        if (dims[ord] == 1)
+            continue;
+        if (!first && ord < last)
+            return false;
+        last = ord;
+        first = false;
+    }
+    return true;
+}
+
+bool MKLDNNPermuteNode::isView() const {
+    auto selected = getSelectedPrimitiveDescriptor();
+    return selected && selected->getConfig().outConfs[0].inPlace >= 0;
+}
+
 void MKLDNNPermuteNode::createPrimitive() {
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
@@ -87,128 +130,143 @@ void MKLDNNPermuteNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
 }
 
-static void permute_to_0231(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    // Supports only NCHW to NHWC
-    int block_size = 1;
-    if (!MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat())) {
-        block_size = srcMemPtr->GetDescriptor().data.layout_desc.blocking.block_dims[1];
+namespace {
+
+// the 4x4 blocks are transposed in the registers, the edges of the plane element by element
+void transposePlane(const float *src, size_t rows, size_t srcStride, float *dst, size_t cols, size_t dstStride) {
+    size_t r = 0;
+    for (; r + 4 <= rows; r += 4) {
+        size_t c = 0;
+        for (; c + 4 <= cols; c += 4) {
+            const float *s = src + r * srcStride + c;
+            __m128 row0 = _mm_loadu_ps(s);
+            __m128 row1 = _mm_loadu_ps(s + srcStride);
+            __m128 row2 = _mm_loadu_ps(s + 2 * srcStride);
+            __m128 row3 = _mm_loadu_ps(s + 3 * srcStride);
+            _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+            float *d = dst + c * dstStride + r;
+            _mm_storeu_ps(d, row0);
+            _mm_storeu_ps(d + dstStride, row1);
+            _mm_storeu_ps(d + 2 * dstStride, row2);
+            _mm_storeu_ps(d + 3 * dstStride, row3);
+        }
+        for (; c < cols; c++) {
+            for (size_t i = r; i < r + 4; i++)
+                dst[c * dstStride + i] = src[i * srcStride + c];
+        }
     }
+    for (; r < rows; r++) {
+        for (size_t c = 0; c < cols; c++)
+            dst[c * dstStride + r] = src[r * srcStride + c];
+    }
+}
 
-    const int C = srcMemPtr->GetDims()[1];
-    const int H = srcMemPtr->GetDims()[2];
-    const int W = srcMemPtr->GetDims()[3];
-
-    // NHWC
-    const int src_stride = H * W * block_size;
-
-    int src_off = 0;
-    int dst_off = 0;
-
-    for (int n = 0; n < MB; n++) {
-        for (int h = 0; h < H; h++) {
-            for (int w = 0; w < W; w++) {
-                src_off = n * C * H * W + (h * W + w) * block_size;
+}  // namespace
 
-                for (int c = 0; c < C; c += block_size) {
-                    for (int b = 0; b < block_size; b++) {
-                        dst_data[dst_off] = src_data[src_off + b];
-                        dst_off++;
-                    }
+bool MKLDNNPermuteNode::buildPlan(int MB) {
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    auto srcDesc = srcMemPtr->GetDescriptor().data;
+    auto dstDesc = dstMemPtr->GetDescriptor().data;
+    const auto &srcBlocking = srcDesc.layout_desc.blocking;
+    const auto &dstBlocking = dstDesc.layout_desc.blocking;
+    const int ndims = srcDesc.ndims;
+
+    plan.clear();
+    planBatch = MB;
+    if (ndims != static_cast<int>(order.size()) || dstDesc.ndims != ndims)
+        return false;
+
+    // the dimensions of the source in the memory, the blocked dimension is split into the blocks and the elements
+    // of the block, the strides of the destination follow the position of the dimension in the order
+    for (int d = 0; d < ndims; d++) {
+        size_t dstDim = std::find(order.begin(), order.end(), static_cast<size_t>(d)) - order.begin();
+        if (dstDim >= order.size() || dstBlocking.block_dims[dstDim] != 1)
+            return false;
+        const size_t size = d == 0 ? static_cast<size_t>(MB) : static_cast<size_t>(srcDesc.dims[d]);
+        const size_t block = static_cast<size_t>(srcBlocking.block_dims[d]);
+        const size_t dstStride = static_cast<size_t>(dstBlocking.strides[0][dstDim]);
+        if (block == 0 || size % block != 0)
+            return false;
+        plan.push_back({size / block, static_cast<size_t>(srcBlocking.strides[0][d]), dstStride * block});
+        if (block > 1)
+            plan.push_back({block, static_cast<size_t>(srcBlocking.strides[1][d]), dstStride});
+    }
 
-                    src_off += src_stride;
-                }
-            }
+    // the dimensions follow the source memory from the outermost one, then the neighbours contiguous both in the
+    // source and the destination are merged, so e.g. the (0, 2, 3, 1) order becomes a batch of 2D transposes
+    std::stable_sort(plan.begin(), plan.end(), [](const PermuteDim &a, const PermuteDim &b) {
+        return a.srcStride > b.srcStride;
+    });
+    plan.erase(std::remove_if(plan.begin(), plan.end(), [](const PermuteDim &dim) { return dim.size == 1; }),
+               plan.end());
+    std::vector<PermuteDim> merged;
+    for (const auto &dim : plan) {
+        if (!merged.empty() && merged.back().srcStride == dim.size * dim.srcStride &&
+            merged.back().dstStride == dim.size * dim.dstStride) {
+            merged.back().size *= dim.size;
+            merged.back().srcStride = dim.srcStride;
+            merged.back().dstStride = dim.dstStride;
+        } else {
+            merged.push_back(dim);
         }
     }
+    plan.swap(merged);
+    if (plan.empty())
+        plan.push_back({1, 1, 1});
+    return true;
 }
 
-template <size_t scale_H = 0, size_t scale_W = 0>
-static void permute_to_014253(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-    const int C  = srcMemPtr->GetDims()[1];
-    const int CH  = scale_H > 0 ? static_cast<int>(scale_H) : srcMemPtr->GetDims()[2];
-    const int CW  = scale_W > 0 ? static_cast<int>(scale_W) : srcMemPtr->GetDims()[3];
-    const int H  = srcMemPtr->GetDims()[4];
-    const int W  = srcMemPtr->GetDims()[5];
-
-    int src_off = 0;
-    int dst_off = 0;
-
-    for (int n = 0; n < MB; n++) {
-        for (int c = 0; c < C; c++) {
-            for (int h = 0; h < H; h++) {
-                for (int ch = 0; ch < CH; ch++) {
-                    for (int w = 0; w < W; w++) {
-                        for (int cw = 0; cw < CW; cw++) {
-                            src_off = n * C * CH * CW * H * W +
-                                      c * CH * CW * H * W +
-                                      ch * CW * H * W +
-                                      cw * H * W +
-                                      h * W +
-                                      w;
-
-                            dst_data[dst_off] = src_data[src_off];
-                            dst_off++;
-                        }
-                    }
-                }
-            }
+void MKLDNNPermuteNode::executePlan(const float *src_data, float *dst_data) {
+    // the innermost dimension of the source is contiguous, the dimension contiguous in the destination (if any)
+    // is the other side of the 2D transpose, the rest of the dimensions are iterated in parallel
+    const PermuteDim inner = plan.back();
+    size_t transposed = plan.size() - 1;
+    if (inner.srcStride == 1 && inner.dstStride != 1) {
+        for (size_t i = 0; i + 1 < plan.size(); i++) {
+            if (plan[i].dstStride == 1)
+                transposed = i;
         }
     }
-}
 
-static void permute_to_3012(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-    const int C  = srcMemPtr->GetDims()[1];
-    const int H  = srcMemPtr->GetDims()[2];
-    const int W  = srcMemPtr->GetDims()[3];
-
-    int src_off = 0;
-    int dst_off = 0;
-
-    for (int w = 0; w < W; w++) {
-        for (int n = 0; n < MB; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int h = 0; h < H; h++) {
-                     src_off = n * C * H * W +
-                               c * H * W +
-                               h * W +
-                               w;
-
-                     dst_data[dst_off] = src_data[src_off];
-                     dst_off++;
-                }
-            }
-        }
+    std::vector<PermuteDim> outer;
+    for (size_t i = 0; i + 1 < plan.size(); i++) {
+        if (i != transposed)
+            outer.push_back(plan[i]);
     }
-}
+    size_t outerSize = 1;
+    for (const auto &dim : outer)
+        outerSize *= dim.size;
+
+    const size_t tile = 16;
+    const size_t rows = transposed < plan.size() - 1 ? plan[transposed].size : 1;
+    const size_t rowTiles = (rows + tile - 1) / tile;
+
+    parallel_nd(outerSize, rowTiles, [&](size_t o, size_t t) {
+        size_t srcOff = 0;
+        size_t dstOff = 0;
+        size_t idx = o;
+        for (size_t i = outer.size(); i-- > 0;) {
+            const size_t coord = idx % outer[i].size;
+            idx /= outer[i].size;
+            srcOff += coord * outer[i].srcStride;
+            dstOff += coord * outer[i].dstStride;
+        }
 
-std::map<InferenceEngine::SizeVector, MKLDNNPermuteNode::PermuteImpl> MKLDNNPermuteNode::OptimizedCases = {
-        {{0, 2, 3, 1}, MKLDNNPermuteNode::PermuteImpl(permute_to_0231, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return true;
-        })},  // NCHW -> NHWC case
-        {{0, 1, 4, 2, 5, 3}, MKLDNNPermuteNode::PermuteImpl(permute_to_014253<2, 2>, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat()) && srcMemPtr->GetDims()[2] == 2 && srcMemPtr->GetDims()[3] == 2;
-        })},  // Dense upsample convolution case (scale = 2)
-        {{0, 1, 4, 2, 5, 3}, MKLDNNPermuteNode::PermuteImpl(permute_to_014253<0, 0>, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat());
-        })},  // Dense upsample convolution case (generic)
-        {{3, 0, 1, 2}, MKLDNNPermuteNode::PermuteImpl(permute_to_3012, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat());
-        })},  // LPR case
-};
+        if (transposed < plan.size() - 1) {
+            const PermuteDim &row = plan[transposed];
+            const size_t r0 = t * tile;
+            const size_t r1 = std::min(rows, r0 + tile);
+            transposePlane(src_data + srcOff + r0 * row.srcStride, r1 - r0, row.srcStride,
+                           dst_data + dstOff + r0, inner.size, inner.dstStride);
+        } else if (inner.srcStride == 1 && inner.dstStride == 1) {
+            std::memcpy(dst_data + dstOff, src_data + srcOff, inner.size * sizeof(float));
+        } else {
+            for (size_t i = 0; i < inner.size; i++)
+                dst_data[dstOff + i * inner.dstStride] = src_data[srcOff + i * inner.srcStride];
+        }
+    });
+}
 
 void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
@@ -216,9 +274,17 @@ void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
     auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
     auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
 
-    auto perm = OptimizedCases.find(order);
-    if (perm != OptimizedCases.end() && perm->second.isValidParams(srcMemPtr, dstMemPtr)) {
-        perm->second.execute(batchToProcess(), srcMemPtr, dstMemPtr);
+    // the output shares the memory of the input
+    if (isView())
+        return;
+
+    const int MB = batchToProcess();
+    if (planBatch != MB) {
+        planValid = buildPlan(MB);
+    }
+    if (planValid) {
+        executePlan(src_data + srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding,
+                    dst_data + dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding);
     } else {
         auto srcBlob = getParentEdgeAt(0)->getBlob();
         TensorDesc srcDesc = srcBlob->getTensorDesc();
@@ -230,11 +296,12 @@ void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
         }
         TensorDesc dstDesc(InferenceEngine::Precision::FP32, dims, {orderedDims, order});
 
-        size_t dataSize = srcBlob->size() / srcDesc.getDims()[0] * batchToProcess();
-#pragma omp parallel for
-        for (size_t i = 0; i < dataSize; i++) {
-            dst_data[dstDesc.offset(i)] = src_data[srcDesc.offset(i)];
-        }
+        size_t dataSize = srcBlob->size() / srcDesc.getDims()[0] * MB;
+        parallel_nt(0, [&](int ithr, int nthr) {
+            size_t start = 0, end = 0;
+            splitter(dataSize, nthr, ithr, start, end);
+            copyByOffsets(src_data, srcDesc, dst_data, dstDesc, start, end);
+        });
     }
 }
 
@@ -32,16 +32,20 @@ private:
     static Register<MKLDNNPermuteNode> reg;
     InferenceEngine::SizeVector order;
 
-    typedef std::function<void(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr)> permuteImpl;
-    typedef std::function<bool(MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr)> isApplicable;
-    struct PermuteImpl {
-        PermuteImpl(permuteImpl f0, isApplicable f1): execute(std::move(f0)), isValidParams(std::move(f1)) {}
-
-        permuteImpl execute;
-        isApplicable isValidParams;
+    // the permutation as a copy over the dimensions of the source memory, built for the batch being processed
+    struct PermuteDim {
+        size_t size;
+        size_t srcStride;
+        size_t dstStride;
     };
-
-    static std::map<InferenceEngine::SizeVector, PermuteImpl> OptimizedCases;
+    std::vector<PermuteDim> plan;
+    int planBatch = -1;
+    bool planValid = false;
+
+    bool isPlainView() const;
+    bool isView() const;
+    bool buildPlan(int MB);
+    void executePlan(const float *src_data, float *dst_data);
 };
 
 }  // namespace MKLDNNPlugin
@@ -4,6 +4,7 @@
 //
 
 #include "mkldnn_pooling_node.h"
+#include "mkldnn_activation_node.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <mkldnn.hpp>
@@ -23,13 +24,13 @@ void MKLDNNPoolingNode::getSupportedDescriptors() {
         return;
 
     InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
+    // int8 data between two int8 convolutions passes through the pooling as is
+    bool isInt8 = (precision == InferenceEngine::Precision::U8 || precision == InferenceEngine::Precision::I8) &&
+                  precision == getCnnLayer()->outData[0]->getPrecision();
+    if (!isInt8)
         precision = InferenceEngine::Precision::FP32;
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
-    precision = getCnnLayer()->outData[0]->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
-        precision = InferenceEngine::Precision::FP32;
-    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+    auto outputDataType = inputDataType;
 
     auto * cnnLayer = dynamic_cast<PoolingLayer*>(getCnnLayer().get());
     if (cnnLayer == nullptr)
@@ -50,10 +51,18 @@ void MKLDNNPoolingNode::getSupportedDescriptors() {
 
     auto parentDims = getParentEdgeAt(0)->getDims();
     auto childDims = getChildEdgeAt(0)->getDims();
-    if (parentDims.ndims() != 4)
-        THROW_IE_EXCEPTION << "Pooling layer. Unsupported mode, only 4D blob as input.";
+    if (parentDims.ndims() != 4 && parentDims.ndims() != 5)
+        THROW_IE_EXCEPTION << "Pooling layer. Unsupported mode, only 4D and 5D blobs as input.";
+    if (parentDims.ndims() == 5) {
+        if (isInt8)
+            THROW_IE_EXCEPTION << "Pooling layer. Unsupported mode, 5D blob of int8 data.";
+        stride.insert(stride.begin(), static_cast<int>(cnnLayer->_stride_z));
+        paddingL.insert(paddingL.begin(), static_cast<int>(cnnLayer->_padding_z));
+        paddingR.insert(paddingR.begin(), 0);
+        kernel.insert(kernel.begin(), static_cast<int>(cnnLayer->_kernel_z));
+    }
 
-    for (int i = 0; i < 2; i++) {
+    for (int i = 0; i < parentDims.ndims() - 2; i++) {
         int krn = kernel[i];
         int src = getParentEdgeAt(0)->getDims()[2 + i];
         int dst = getChildEdgeAt(0)->getDims()[2 + i];
@@ -63,7 +72,12 @@ void MKLDNNPoolingNode::getSupportedDescriptors() {
     }
 
     // It doesn't support any format
-    for (auto format : getAvailableFormatsForDims(parentDims)) {
+    std::vector<memory::format> formats = getAvailableFormatsForDims(parentDims);
+    if (isInt8)
+        formats = {memory::nhwc};
+    else if (parentDims.ndims() == 5)
+        formats = {memory::ncdhw, memory::nCdhw16c};
+    for (auto format : formats) {
         MKLDNNMemoryDesc in_candidate{parentDims, inputDataType, format};
         MKLDNNMemoryDesc out_candidate{childDims, outputDataType, format};
 
@@ -79,6 +93,24 @@ void MKLDNNPoolingNode::createPrimitive() {
 
     prim.reset(new pooling_forward(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
                                    getChildEdgeAt(0)->getMemory().GetPrimitive()));
+
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    for (auto &node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode == nullptr)
+            THROW_IE_EXCEPTION << "Pooling " << getName() << " has unsupported fused node " << node->getName();
+        eltwise_forward::desc desc(prop_kind::forward_scoring, activationNode->getAlgorithm(),
+                                   dstMemory.GetDescriptor(), activationNode->getAlpha(), activationNode->getBeta());
+        eltwise_forward::primitive_desc activation_desc(desc, getEngine());
+        activations.push_back(eltwise_forward(activation_desc, dstMemory.GetPrimitive(), dstMemory.GetPrimitive()));
+    }
+}
+
+void MKLDNNPoolingNode::execute(mkldnn::stream strm) {
+    MKLDNNNode::execute(strm);
+    // the pooled output is still in the cache
+    if (!activations.empty())
+        strm.submit(activations);
 }
 
 bool MKLDNNPoolingNode::created() const {
@@ -92,7 +124,10 @@ void MKLDNNPoolingNode::createDescriptor(const std::vector<InferenceEngine::Tens
 
     algorithm alg;
     if (type == PoolingLayer::PoolType::AVG) {
-        if (!exclude_pad && (paddingL[0] != 0 || paddingL[1] != 0))
+        bool withPadding = false;
+        for (int pad : paddingL)
+            withPadding |= pad != 0;
+        if (!exclude_pad && withPadding)
             alg = pooling_avg_include_padding;
         else
             alg = pooling_avg_exclude_padding;
@@ -109,7 +144,10 @@ void MKLDNNPoolingNode::createDescriptor(const std::vector<InferenceEngine::Tens
                                       stride, kernel, paddingL, paddingR,
                                       mkldnn::padding_kind::zero));
 
-    if (alg == pooling_avg_include_padding && (paddingR[0] || paddingR[1])) {
+    bool withPaddingR = false;
+    for (int pad : paddingR)
+        withPaddingR |= pad != 0;
+    if (alg == pooling_avg_include_padding && withPaddingR) {
         // In case of AVG including paddings the norm coeff should be calculated
         // with tacking into account original pads. So we need to restore
         // original values (R_padding = L_padding).
@@ -22,6 +22,7 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -35,6 +36,8 @@ private:
     std::vector<int> paddingL;
     std::vector<int> paddingR;
     std::vector<int> kernel;
+    // the fused activations applied in place to the output, the pooling primitive has no post ops
+    std::vector<mkldnn::primitive> activations;
 };
 
 }  // namespace MKLDNNPlugin
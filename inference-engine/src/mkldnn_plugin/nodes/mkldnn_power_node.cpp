@@ -9,6 +9,7 @@
 #include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
 #include <limits>
 
 using namespace mkldnn;
@@ -97,13 +98,13 @@ void MKLDNNPowerNode::execute(mkldnn::stream strm) {
             dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
 
     if (power == 1.0f) {
-        #pragma omp parallel for
-        for (int i = 0; i < data_size; i++)
+        parallel_for(data_size, [&](size_t i) {
             dst_ptr[i] = src_ptr[i] * scale + shift;
+        });
     } else {
-        #pragma omp parallel for
-        for (int i = 0; i < data_size; i++)
+        parallel_for(data_size, [&](size_t i) {
             dst_ptr[i] = pow(src_ptr[i] * scale + shift, power);
+        });
     }
 }
 
@@ -9,6 +9,8 @@
 #include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
+#include <ie_tensor_offset.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -133,38 +135,53 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
         const auto* src_data = srcBlbPtr->cbuffer().as<const float *>();
         auto* dst_data = dstBlbPtr->buffer().as<float *>();
 
-#   pragma omp parallel for
-        for (size_t i = 0; i < data_size; i++) {
-            dst_data[dstBlbPtr->getTensorDesc().offset(i)] = src_data[srcBlbPtr->getTensorDesc().offset(i)];
-        }
+        InferenceEngine::parallel_nt(0, [&](int ithr, int nthr) {
+            size_t start = 0, end = 0;
+            InferenceEngine::splitter(data_size, nthr, ithr, start, end);
+            InferenceEngine::copyByOffsets(src_data, srcBlbPtr->getTensorDesc(), dst_data, dstBlbPtr->getTensorDesc(),
+                                           start, end);
+        });
     }
 }
 
 void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
+    if (lim == dynBatchLim)
+        return;
     dynBatchLim = lim;
     if (prim) {
-        auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
-        auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
-        memory::desc src_d = srcMemPtr->GetDescriptor();
-        memory::desc dst_d = dstMemPtr->GetDescriptor();
-        void *src_data_hdl = srcMemPtr->GetPrimitive().get_data_handle();
-        void *dst_data_hdl = dstMemPtr->GetPrimitive().get_data_handle();
-
-        if (src_blocked && dst_blocked) {
-            src_d = src_blocked->GetDescriptor();
-            dst_d = dst_blocked->GetDescriptor();
-            src_data_hdl = src_blocked->GetPrimitive().get_data_handle();
-            dst_data_hdl = dst_blocked->GetPrimitive().get_data_handle();
+        int batch = batchToProcess();
+        auto cached = batchPrimitives.find(batch);
+        if (cached == batchPrimitives.end()) {
+            auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+            auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+            memory::desc src_d = srcMemPtr->GetDescriptor();
+            memory::desc dst_d = dstMemPtr->GetDescriptor();
+            void *src_data_hdl = srcMemPtr->GetPrimitive().get_data_handle();
+            void *dst_data_hdl = dstMemPtr->GetPrimitive().get_data_handle();
+
+            if (src_blocked && dst_blocked) {
+                src_d = src_blocked->GetDescriptor();
+                dst_d = dst_blocked->GetDescriptor();
+                src_data_hdl = src_blocked->GetPrimitive().get_data_handle();
+                dst_data_hdl = dst_blocked->GetPrimitive().get_data_handle();
+            }
+            BatchPrimitive batchPrim;
+            batchPrim.src_blocked = std::make_shared<MKLDNNMemory>(getEngine());
+            src_d.data.dims[0] = batch;
+            src_d.data.layout_desc.blocking.padding_dims[0] = batch;
+            batchPrim.src_blocked->Create(src_d, src_data_hdl);
+
+            batchPrim.dst_blocked = std::make_shared<MKLDNNMemory>(getEngine());
+            dst_d.data.dims[0] = batch;
+            dst_d.data.layout_desc.blocking.padding_dims[0] = batch;
+            batchPrim.dst_blocked->Create(dst_d, dst_data_hdl);
+            batchPrim.prim = std::make_shared<mkldnn::reorder>(batchPrim.src_blocked->GetPrimitive(),
+                                                               batchPrim.dst_blocked->GetPrimitive());
+            cached = batchPrimitives.emplace(batch, batchPrim).first;
         }
-        src_blocked = std::make_shared<MKLDNNMemory>(getEngine());
-        src_d.data.dims[0] = batchToProcess();
-        src_d.data.layout_desc.blocking.padding_dims[0] = batchToProcess();
-        src_blocked->Create(src_d, src_data_hdl);
-
-        dst_blocked = std::make_shared<MKLDNNMemory>(getEngine());
-        dst_d.data.dims[0] = batchToProcess();
-        dst_d.data.layout_desc.blocking.padding_dims[0] = batchToProcess();
-        dst_blocked->Create(dst_d, dst_data_hdl);
-        prim.reset(new mkldnn::reorder(src_blocked->GetPrimitive(), dst_blocked->GetPrimitive()));
+        // the data handles of the blocked memories are set on the execution
+        src_blocked = cached->second.src_blocked;
+        dst_blocked = cached->second.dst_blocked;
+        prim = cached->second.prim;
     }
 }
@@ -8,6 +8,7 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 #include <string>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -43,6 +44,14 @@ private:
 
     MKLDNNMemoryPtr dst_blocked;
     MKLDNNMemoryPtr src_blocked;
+
+    struct BatchPrimitive {
+        MKLDNNMemoryPtr src_blocked;
+        MKLDNNMemoryPtr dst_blocked;
+        std::shared_ptr<mkldnn::primitive> prim;
+    };
+    /** The reorders of the dynamic batches already processed, so switching the batch does not create them again */
+    std::map<int, BatchPrimitive> batchPrimitives;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,210 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_reorg_yolo_node.h"
+#include <ie_layers.h>
+#include <string>
+#include <vector>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
+#include <immintrin.h>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+const size_t maxChannelsBlock = 16;
+
+// every second element of the source, the even lanes of the pairs of the vectors (YOLOv2 reorganizes with stride 2)
+inline void copyEverySecond(float *dst, const float *src, size_t count) {
+    size_t i = 0;
+    // the last vector reads up to src[2 * i + 7], the condition keeps it inside the row of the source
+    for (; i + 4 < count; i += 4) {
+        __m128 low = _mm_loadu_ps(src + 2 * i);
+        __m128 high = _mm_loadu_ps(src + 2 * i + 4);
+        _mm_storeu_ps(dst + i, _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+    for (; i < count; i++)
+        dst[i] = src[2 * i];
+}
+
+}  // namespace
+
+MKLDNNReorgYoloNode::MKLDNNReorgYoloNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
+
+void MKLDNNReorgYoloNode::getSupportedDescriptors() {
+    auto * reorgLayer = getCnnLayer().get();
+
+    if (reorgLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get reorg yolo layer.";
+
+    if (getParentEdges().size() != 1)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges.";
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges.";
+
+    stride = reorgLayer->GetParamAsInt("stride");
+    if (stride < 1)
+        THROW_IE_EXCEPTION << "ReorgYolo " << getName() << " has incorrect stride " << stride << ".";
+
+    auto inDims = getParentEdgeAt(0)->getDims();
+    auto outDims = getChildEdgeAt(0)->getDims();
+    if (inDims.ndims() != 4 || outDims.ndims() != 4)
+        THROW_IE_EXCEPTION << "ReorgYolo " << getName() << " supports the 4D tensors only.";
+
+    const size_t s = static_cast<size_t>(stride);
+    IC = inDims[1];
+    IH = inDims[2];
+    IW = inDims[3];
+    OC = outDims[1];
+    OH = outDims[2];
+    OW = outDims[3];
+    if (IH % s || IW % s || OC != IC * s * s || OH != IH / s || OW != IW / s || inDims[0] != outDims[0])
+        THROW_IE_EXCEPTION << "ReorgYolo " << getName() << " has incompatible dimensions of the input and the output.";
+}
+
+void MKLDNNReorgYoloNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    InferenceEngine::DataConfig inConfig;
+    inConfig.inPlace = -1;
+    inConfig.constant = false;
+    auto inDims = getParentEdgeAt(0)->getDims();
+    inConfig.desc = MKLDNNMemoryDesc(inDims, dataType, memory::nchw);
+    config.inConfs.push_back(inConfig);
+
+    // the output descriptors are left uninitialized, so the node takes the strided sub-memory the concat following
+    // it offers in place and writes its part of the concatenated feature map directly
+    InferenceEngine::DataConfig outConfig;
+    outConfig.inPlace = -1;
+    outConfig.constant = false;
+    auto outDims = getChildEdgeAt(0)->getDims();
+    for (auto format : {memory::nchw, memory::nChw8c, memory::nChw16c}) {
+        if (format == memory::nChw8c && OC % 8)
+            continue;
+        if (format == memory::nChw16c && OC % 16)
+            continue;
+        outConfig.desc = MKLDNNExtensionUtils::getUninitTensorDesc(MKLDNNMemoryDesc(outDims, dataType, format));
+        config.outConfs = {outConfig};
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+    }
+}
+
+void MKLDNNReorgYoloNode::selectOptimalPrimitiveDescriptor() {
+    // the output is usually concatenated with the feature map of the other branch (YOLOv2 passthrough), the layout
+    // that branch has selected lets the concat take both inputs in place
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto child = getChildEdgeAt(i)->getChild();
+        if (child->getType() != Concatenation)
+            continue;
+        for (size_t j = 0; j < child->getParentEdges().size(); j++) {
+            auto parentEdge = child->getParentEdgeAt(j);
+            auto parent = parentEdge->getParent();
+            if (parent.get() == this || parent->getSelectedPrimitiveDescriptor() == nullptr)
+                continue;
+            const auto &outConfs = parent->getSelectedPrimitiveDescriptor()->getConfig().outConfs;
+            if (outConfs.empty())
+                continue;
+            int num = parentEdge->getInputNum();
+            if (num < 0 || static_cast<size_t>(num) >= outConfs.size())
+                num = 0;
+            const auto &blockDims = outConfs[num].desc.getBlockingDesc().getBlockDims();
+            size_t block = blockDims.size() == 5 ? blockDims[4] : 1;
+            for (size_t k = 0; k < supportedPrimitiveDescriptors.size(); k++) {
+                const auto &desc = supportedPrimitiveDescriptors[k].getConfig().outConfs[0].desc;
+                const auto &ownBlockDims = desc.getBlockingDesc().getBlockDims();
+                if ((ownBlockDims.size() == 5 ? ownBlockDims[4] : 1) == block) {
+                    selectPrimitiveDescriptorByIndex(static_cast<int>(k));
+                    return;
+                }
+            }
+        }
+    }
+    MKLDNNNode::selectOptimalPrimitiveDescriptor();
+}
+
+void MKLDNNReorgYoloNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+}
+
+const float *MKLDNNReorgYoloNode::sourceRow(const float *src, size_t b, size_t oc, size_t oh) const {
+    // the channels of the output are the stride x stride phases of the source channels, the phase is the outer one
+    const size_t s = static_cast<size_t>(stride);
+    const size_t c = oc % IC;
+    const size_t phase = oc / IC;
+    return src + ((b * IC + c) * IH + oh * s + phase / s) * IW + phase % s;
+}
+
+void MKLDNNReorgYoloNode::execute(mkldnn::stream strm) {
+    auto &srcMemory = getParentEdgeAt(0)->getMemory();
+    auto &dstMemory = getChildEdgeAt(0)->getMemory();
+    const float *src = reinterpret_cast<const float *>(srcMemory.GetData()) +
+                       srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    // the destination is addressed through its blocking, it is the sub-memory of the concat when the concat is in place
+    auto dstDesc = dstMemory.GetDescriptor();
+    const auto &blocking = dstDesc.data.layout_desc.blocking;
+    float *dst = reinterpret_cast<float *>(dstMemory.GetData()) + blocking.offset_padding;
+    const size_t block = static_cast<size_t>(blocking.block_dims[1]);
+    const size_t strideN = static_cast<size_t>(blocking.strides[0][0]);
+    const size_t strideC = static_cast<size_t>(blocking.strides[0][1]);
+    const size_t strideH = static_cast<size_t>(blocking.strides[0][2]);
+    const size_t strideW = static_cast<size_t>(blocking.strides[0][3]);
+    const size_t strideLane = static_cast<size_t>(blocking.strides[1][1]);
+    const size_t s = static_cast<size_t>(stride);
+    const size_t batch = batchToProcess();
+
+    if (block == 1) {
+        parallel_nd(batch, OC, OH, [&](size_t b, size_t oc, size_t oh) {
+            const float *srcRow = sourceRow(src, b, oc, oh);
+            float *dstRow = dst + b * strideN + oc * strideC + oh * strideH;
+            if (strideW == 1 && s == 2) {
+                copyEverySecond(dstRow, srcRow, OW);
+            } else {
+                for (size_t ow = 0; ow < OW; ow++)
+                    dstRow[ow * strideW] = srcRow[ow * s];
+            }
+        });
+        return;
+    }
+
+    if (block > maxChannelsBlock || block % 4 || strideLane != 1)
+        THROW_IE_EXCEPTION << "ReorgYolo " << getName() << " does not support the layout of the output.";
+
+    // the block of the channels of a pixel is contiguous, it is filled by the vectors of four channels
+    parallel_nd(batch, OC / block, OH, [&](size_t b, size_t cb, size_t oh) {
+        const float *rows[maxChannelsBlock];
+        for (size_t lane = 0; lane < block; lane++)
+            rows[lane] = sourceRow(src, b, cb * block + lane, oh);
+        float *dstRow = dst + b * strideN + cb * strideC + oh * strideH;
+        for (size_t ow = 0; ow < OW; ow++) {
+            const size_t iw = ow * s;
+            float *dstPixel = dstRow + ow * strideW;
+            for (size_t lane = 0; lane < block; lane += 4) {
+                _mm_storeu_ps(dstPixel + lane, _mm_setr_ps(rows[lane][iw], rows[lane + 1][iw],
+                                                           rows[lane + 2][iw], rows[lane + 3][iw]));
+            }
+        }
+    });
+}
+
+bool MKLDNNReorgYoloNode::created() const {
+    return getType() == ReorgYolo;
+}
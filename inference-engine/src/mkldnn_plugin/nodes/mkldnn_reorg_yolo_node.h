@@ -0,0 +1,41 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNReorgYoloNode : public MKLDNNNode {
+public:
+    MKLDNNReorgYoloNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
+    ~MKLDNNReorgYoloNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+private:
+    static Register<MKLDNNReorgYoloNode> reg;
+
+    int stride = 1;
+    // the source is [N, IC, IH, IW], the destination is [N, IC * stride * stride, IH / stride, IW / stride]
+    size_t IC = 0;
+    size_t IH = 0;
+    size_t IW = 0;
+    size_t OC = 0;
+    size_t OH = 0;
+    size_t OW = 0;
+
+    const float *sourceRow(const float *src, size_t b, size_t oc, size_t oh) const;
+};
+
+}  // namespace MKLDNNPlugin
@@ -82,10 +82,10 @@ void MKLDNNReshapeNode::createPrimitive() {
 
         auto dims = getParentEdgeAt(0)->getDims();
 
-        srcMem.reset(new MKLDNNMemory(getEngine()));
+        srcMem.reset(new MKLDNNMemory(getEngine(), getAllocator()));
         srcMem->Create(dims, inputDataType, MKLDNNMemory::GetPlainFormat(dims));
 
-        dstMem.reset(new MKLDNNMemory(getEngine()));
+        dstMem.reset(new MKLDNNMemory(getEngine(), getAllocator()));
         dstMem->Create(getChildEdgeAt(0)->getDims(), outputDataType,
                        MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims()), srcMem->GetData());
 
@@ -129,6 +129,8 @@ void MKLDNNReshapeNode::createPrimitive() {
 }
 
 void MKLDNNReshapeNode::setDynamicBatchLim(int lim) {
+    if (lim == dynBatchLim)
+        return;
     dynBatchLim = lim;
     if (srcPrim && dstPrim) {
         auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
@@ -7,13 +7,184 @@
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <immintrin.h>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+// the values of the inner dimensions normalized together by the strided softmax, one cache line
+const int stripeSize = 16;
+
+// exp(x) = 2^n * exp(g), |g| <= ln(2) / 2, exp(g) is the polynomial of the Cephes library
+inline __m128 expPs(__m128 x) {
+    x = _mm_max_ps(_mm_min_ps(x, _mm_set1_ps(88.3762626647949f)), _mm_set1_ps(-88.3762626647949f));
+
+    __m128 n = _mm_floor_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)), _mm_set1_ps(0.5f)));
+    __m128 g = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(0.693359375f))),
+                          _mm_mul_ps(n, _mm_set1_ps(-2.12194440e-4f)));
+
+    __m128 y = _mm_set1_ps(1.9875691500e-4f);
+    y = _mm_add_ps(_mm_mul_ps(y, g), _mm_set1_ps(1.3981999507e-3f));
+    y = _mm_add_ps(_mm_mul_ps(y, g), _mm_set1_ps(8.3334519073e-3f));
+    y = _mm_add_ps(_mm_mul_ps(y, g), _mm_set1_ps(4.1665795894e-2f));
+    y = _mm_add_ps(_mm_mul_ps(y, g), _mm_set1_ps(1.6666665459e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, g), _mm_set1_ps(5.0000001201e-1f));
+    y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, _mm_mul_ps(g, g)), g), _mm_set1_ps(1.0f));
+
+    __m128i pow2n = _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127)), 23);
+    return _mm_mul_ps(y, _mm_castsi128_ps(pow2n));
+}
+
+inline float horizontalMax(__m128 v) {
+    v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_max_ss(v, _mm_shuffle_ps(v, v, 1));
+    return _mm_cvtss_f32(v);
+}
+
+inline float horizontalSum(__m128 v) {
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+    return _mm_cvtss_f32(v);
+}
+
+// the softmax of the contiguous rows of the size A
+void softmaxRows(const float *src, float *dst, int rows, int A) {
+    parallel_for(rows, [&](int r) {
+        const float *psrc = src + static_cast<size_t>(r) * A;
+        float *pdst = dst + static_cast<size_t>(r) * A;
+
+        int i = 0;
+        __m128 vmax = _mm_set1_ps(-FLT_MAX);
+        for (; i + 4 <= A; i += 4)
+            vmax = _mm_max_ps(vmax, _mm_loadu_ps(psrc + i));
+        float max = horizontalMax(vmax);
+        for (; i < A; i++)
+            max = std::max(max, psrc[i]);
+
+        __m128 vsum = _mm_setzero_ps();
+        vmax = _mm_set1_ps(max);
+        for (i = 0; i + 4 <= A; i += 4) {
+            __m128 vexp = expPs(_mm_sub_ps(_mm_loadu_ps(psrc + i), vmax));
+            _mm_storeu_ps(pdst + i, vexp);
+            vsum = _mm_add_ps(vsum, vexp);
+        }
+        float sum = horizontalSum(vsum);
+        for (; i < A; i++) {
+            pdst[i] = std::exp(psrc[i] - max);
+            sum += pdst[i];
+        }
+
+        float scale = 1.0f / sum;
+        __m128 vscale = _mm_set1_ps(scale);
+        for (i = 0; i + 4 <= A; i += 4)
+            _mm_storeu_ps(pdst + i, _mm_mul_ps(_mm_loadu_ps(pdst + i), vscale));
+        for (; i < A; i++)
+            pdst[i] *= scale;
+    });
+}
+
+// the softmax along the axis of the size A of the data [outer, A, inner], the inner values are independent
+// and go in the stripes of the vectors
+void softmaxStrided(const float *src, float *dst, int outer, int A, int inner) {
+    const int stripes = (inner + stripeSize - 1) / stripeSize;
+
+    parallel_nd(outer, stripes, [&](int o, int k) {
+        const int size = std::min(stripeSize, inner - k * stripeSize);
+        const size_t offset = static_cast<size_t>(o) * A * inner + k * stripeSize;
+        const float *psrc = src + offset;
+        float *pdst = dst + offset;
+
+        float max[stripeSize];
+        float sum[stripeSize];
+        for (int j = 0; j < size; j++) {
+            max[j] = psrc[j];
+            sum[j] = 0.0f;
+        }
+
+        for (int a = 1; a < A; a++) {
+            const float *row = psrc + static_cast<size_t>(a) * inner;
+            int j = 0;
+            for (; j + 4 <= size; j += 4)
+                _mm_storeu_ps(max + j, _mm_max_ps(_mm_loadu_ps(max + j), _mm_loadu_ps(row + j)));
+            for (; j < size; j++)
+                max[j] = std::max(max[j], row[j]);
+        }
+
+        for (int a = 0; a < A; a++) {
+            const float *row = psrc + static_cast<size_t>(a) * inner;
+            float *out = pdst + static_cast<size_t>(a) * inner;
+            int j = 0;
+            for (; j + 4 <= size; j += 4) {
+                __m128 vexp = expPs(_mm_sub_ps(_mm_loadu_ps(row + j), _mm_loadu_ps(max + j)));
+                _mm_storeu_ps(out + j, vexp);
+                _mm_storeu_ps(sum + j, _mm_add_ps(_mm_loadu_ps(sum + j), vexp));
+            }
+            for (; j < size; j++) {
+                out[j] = std::exp(row[j] - max[j]);
+                sum[j] += out[j];
+            }
+        }
+
+        for (int j = 0; j < size; j++)
+            sum[j] = 1.0f / sum[j];
+
+        for (int a = 0; a < A; a++) {
+            float *out = pdst + static_cast<size_t>(a) * inner;
+            int j = 0;
+            for (; j + 4 <= size; j += 4)
+                _mm_storeu_ps(out + j, _mm_mul_ps(_mm_loadu_ps(out + j), _mm_loadu_ps(sum + j)));
+            for (; j < size; j++)
+                out[j] *= sum[j];
+        }
+    });
+}
+
+// the softmax along the channels of the blocked layout [N, CB, HW, block], the channels are not padded
+void softmaxBlockedChannels(const float *src, float *dst, int N, int CB, int HW, int block) {
+    const size_t blockStride = static_cast<size_t>(HW) * block;
+
+    parallel_nd(N, HW, [&](int n, int p) {
+        const size_t offset = (static_cast<size_t>(n) * CB * HW + p) * block;
+        const float *psrc = src + offset;
+        float *pdst = dst + offset;
+
+        __m128 vmax = _mm_set1_ps(-FLT_MAX);
+        for (int cb = 0; cb < CB; cb++) {
+            for (int j = 0; j < block; j += 4)
+                vmax = _mm_max_ps(vmax, _mm_loadu_ps(psrc + cb * blockStride + j));
+        }
+        vmax = _mm_set1_ps(horizontalMax(vmax));
+
+        __m128 vsum = _mm_setzero_ps();
+        for (int cb = 0; cb < CB; cb++) {
+            for (int j = 0; j < block; j += 4) {
+                __m128 vexp = expPs(_mm_sub_ps(_mm_loadu_ps(psrc + cb * blockStride + j), vmax));
+                _mm_storeu_ps(pdst + cb * blockStride + j, vexp);
+                vsum = _mm_add_ps(vsum, vexp);
+            }
+        }
+
+        __m128 vscale = _mm_set1_ps(1.0f / horizontalSum(vsum));
+        for (int cb = 0; cb < CB; cb++) {
+            for (int j = 0; j < block; j += 4)
+                _mm_storeu_ps(pdst + cb * blockStride + j,
+                              _mm_mul_ps(_mm_loadu_ps(pdst + cb * blockStride + j), vscale));
+        }
+    });
+}
+
+}  // namespace
+
 MKLDNNSoftMaxNode::MKLDNNSoftMaxNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
 
 void MKLDNNSoftMaxNode::getSupportedDescriptors() {
@@ -51,8 +222,98 @@ void MKLDNNSoftMaxNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNSoftMaxNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    MKLDNNNode::initSupportedPrimitiveDescriptors();
+
+    InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
+    if (precision != InferenceEngine::Precision::FP32)
+        precision = InferenceEngine::Precision::FP32;
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+
+    MKLDNNDims dims = getParentEdgeAt(0)->getDims();
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = axis > 0;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].constant = false;
+    config.outConfs[0].inPlace = canBeInPlace() ? 0 : -1;
+    config.outConfs[0].constant = false;
+
+    // the primitive has only the reference code for the innermost axis of the plain data (class scores)
+    size_t inner = 1;
+    for (int i = axis + 1; i < dims.ndims(); i++)
+        inner *= dims[i];
+    memory::format plainFormat = MKLDNNMemory::GetPlainFormat(dims);
+    if (inner == 1 && plainFormat != memory::blocked) {
+        config.inConfs[0].desc = MKLDNNMemoryDesc(dims, dataType, plainFormat);
+        config.outConfs[0].desc = config.inConfs[0].desc;
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+    }
+
+    // the blocked data along any axis, the channels of the blocks must not be padded
+    if (dims.ndims() == 4) {
+        for (auto format : {memory::nChw8c, memory::nChw16c}) {
+            if (dims[1] % (format == memory::nChw8c ? 8 : 16) != 0)
+                continue;
+            config.inConfs[0].desc = MKLDNNMemoryDesc(dims, dataType, format);
+            config.outConfs[0].desc = config.inConfs[0].desc;
+            supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+        }
+    }
+}
+
+void MKLDNNSoftMaxNode::selectOptimalPrimitiveDescriptor() {
+    if (!implPriorities.empty()) {
+        MKLDNNNode::selectOptimalPrimitiveDescriptor();
+        return;
+    }
+
+    // The native configs take the data of the producer as is, the blocked ones are not worth a reorder of the plain
+    // data, which goes to the native code along the innermost axis and to the primitive along the other ones.
+    auto parentEdge = getParentEdgeAt(0);
+    auto parent_spd = parentEdge->getParent()->getSelectedPrimitiveDescriptor();
+    int plainNative = -1;
+    for (size_t i = 0; i < supportedPrimitiveDescriptors.size(); i++) {
+        if (supportedPrimitiveDescriptors[i].getImplementationType() != impl_desc_type::unknown)
+            continue;
+        const auto& inDesc = supportedPrimitiveDescriptors[i].getConfig().inConfs[0].desc;
+        if (parent_spd != nullptr && !parent_spd->getConfig().outConfs.empty()) {
+            int inNum = parentEdge->getInputNum();
+            if (inNum < 0 || inNum >= parent_spd->getConfig().outConfs.size())
+                inNum = 0;
+            if (MKLDNNExtensionUtils::initTensorsAreEqual(inDesc, parent_spd->getConfig().outConfs[inNum].desc)) {
+                selectPrimitiveDescriptorByIndex(static_cast<int>(i));
+                return;
+            }
+        }
+        if (plainNative < 0 && inDesc.getLayout() != InferenceEngine::Layout::BLOCKED)
+            plainNative = static_cast<int>(i);
+    }
+    if (plainNative >= 0) {
+        selectPrimitiveDescriptorByIndex(plainNative);
+        return;
+    }
+
+    std::vector<impl_desc_type> priority;
+    for (auto type : getPrimitivesPriority()) {
+        if (type != impl_desc_type::unknown)
+            priority.push_back(type);
+    }
+    selectPreferPrimitiveDescriptor(priority);
+}
+
+bool MKLDNNSoftMaxNode::isNative() const {
+    auto selected_pd = getSelectedPrimitiveDescriptor();
+    return selected_pd != nullptr && selected_pd->getImplementationType() == impl_desc_type::unknown;
+}
+
 void MKLDNNSoftMaxNode::createPrimitive() {
-    if (prim)
+    if (prim || isNative())
         return;
 
     memory::desc in_candidate = getParentEdgeAt(0)->getMemory().GetDescriptor();
@@ -81,6 +342,49 @@ void MKLDNNSoftMaxNode::createPrimitive() {
                                 getChildEdgeAt(0)->getMemory().GetPrimitive()));
 }
 
+void MKLDNNSoftMaxNode::execute(mkldnn::stream strm) {
+    if (!isNative()) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float *src_data = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_data = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    memory::dims dims = srcMemory.GetDims();
+    if (axis > 0)
+        dims[0] = batchToProcess();
+
+    int block = 1;
+    if (srcMemory.GetFormat() == memory::nChw8c)
+        block = 8;
+    else if (srcMemory.GetFormat() == memory::nChw16c)
+        block = 16;
+
+    if (block > 1 && axis == 1) {
+        softmaxBlockedChannels(src_data, dst_data, dims[0], dims[1] / block, dims[2] * dims[3], block);
+        return;
+    }
+
+    // the data is [outer, axis, inner], the lanes of the blocks are the innermost independent values
+    int outer = 1;
+    int inner = block;
+    for (int i = 0; i < axis; i++)
+        outer *= i == 1 ? dims[1] / block : dims[i];
+    for (int i = axis + 1; i < static_cast<int>(dims.size()); i++)
+        inner *= i == 1 ? dims[1] / block : dims[i];
+
+    if (inner == 1) {
+        softmaxRows(src_data, dst_data, outer, dims[axis]);
+    } else {
+        softmaxStrided(src_data, dst_data, outer, dims[axis], inner);
+    }
+}
+
 bool MKLDNNSoftMaxNode::created() const {
     return getType() == SoftMax;
 }
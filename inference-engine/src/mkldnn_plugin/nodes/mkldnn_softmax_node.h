@@ -22,10 +22,19 @@ public:
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
 
 private:
+    /**
+     * @brief Checks that the selected config runs the native code: the blocked layouts along any axis and the plain
+     * layouts along the innermost axis, the MKL-DNN primitive runs the reference code for them
+     */
+    bool isNative() const;
+
     static Register<MKLDNNSoftMaxNode> reg;
     int axis = 0;
 };
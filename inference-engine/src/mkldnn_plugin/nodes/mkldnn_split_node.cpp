@@ -26,8 +26,8 @@ void MKLDNNSplitNode::getSupportedDescriptors() {
 
     axis = splitLayer->_axis;
 
-    if (axis != 1)
-        THROW_IE_EXCEPTION << "Split support only axis 1.";
+    if (axis == 0)
+        THROW_IE_EXCEPTION << "Split doesn't support the batch axis.";
 
     if (getParentEdges().size() != 1)
         THROW_IE_EXCEPTION << "Incorrect number of input nodes.";
@@ -71,6 +71,8 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
 
     if (srcDims.ndims() < 2)
         THROW_IE_EXCEPTION << "Split " << getName() << " isn't supported 1d blobs";
+    if (axis >= srcDims.ndims())
+        THROW_IE_EXCEPTION << "Split " << getName() << " has incorrect axis " << axis;
 
     auto num_chanels = 0;
     auto dstFirstDims = getChildEdgeAt(0)->getDims();
@@ -83,7 +85,7 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
         config.outConfs[i].inPlace = -1;
         config.outConfs[i].constant = false;
         config.outConfs[i].desc = MKLDNNMemoryDesc(o_Dims, outputDataType, memory::format::any);
-        num_chanels += o_Dims[1];
+        num_chanels += o_Dims[axis];
         for (size_t j = 0; j < dstFirstDims.ndims(); j++) {
             if (j == axis)
                 continue;
@@ -91,7 +93,7 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
                 THROW_IE_EXCEPTION << "Split " << getName() << "has incorrect output dimensions";
         }
     }
-    dstFirstDims[1] = num_chanels;
+    dstFirstDims[axis] = num_chanels;
     if (dstFirstDims.size() != srcDims.size())
         THROW_IE_EXCEPTION << "The sizes of input blob and sum of output blobs are not equal.";
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
@@ -179,36 +181,25 @@ void MKLDNNSplitNode::createPrimitive() {
     }
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+    if (isOptimized())
+        return;
+
+    // the outputs are copied in parallel in their own layouts, the reorders from the layout of the input are not needed
+    copy.reset(new MKLDNNAxisCopy(srcMemPtr, getParentEdgeAt(0)->getDims(), axis));
+    for (size_t i = 0, axisOffset = 0; i < getChildEdges().size(); i++) {
+        auto dims = getChildEdgeAt(i)->getDims();
+        if (axisOffset + dims[axis] > static_cast<size_t>(getParentEdgeAt(0)->getDims()[axis]))
+            THROW_IE_EXCEPTION << "Incorrect configuration of split layer " << getName() << "!";
+        copy->addPart(getChildEdgeAt(i)->getMemoryPtr(), dims, axisOffset);
+        axisOffset += dims[axis];
+    }
 }
 
 void MKLDNNSplitNode::execute(mkldnn::stream strm) {
-    if (isOptimized())
+    if (isOptimized() || !copy)
         return;
 
-    // FIXME: add more optimal implementation
-    MKLDNNDims par_dims = getParentEdgeAt(0)->getDims();
-    int MB = batchToProcess();
-    auto srcBlob = getParentEdgeAt(0)->getBlob();
-    const auto *srcData = srcBlob->cbuffer().as<const float *>();
-    size_t srcSize = getParentEdgeAt(0)->getMemory().GetSize();
-    size_t src_batch_off = srcBlob->getTensorDesc().offset(srcBlob->size() / srcBlob->getTensorDesc().getDims()[0])
-            - srcBlob->getTensorDesc().offset(0);
-
-    for (size_t i = 0, sIdx = 0; i < getChildEdges().size(); i++) {
-        auto dstBlob = getChildEdgeAt(i)->getBlob();
-        auto *dstData = dstBlob->buffer().as<float *>();
-        size_t dst_slice_size = dstBlob->size() / dstBlob->getTensorDesc().getDims()[0];
-        size_t dst_batch_off = dstBlob->getTensorDesc().offset(dst_slice_size) - dstBlob->getTensorDesc().offset(0);
-
-        for (size_t dIdx = 0; dIdx < dst_slice_size; dIdx++, sIdx++) {
-            for (unsigned b = 0; b < MB; b++) {
-                if (sIdx + b*src_batch_off >= srcSize)
-                    THROW_IE_EXCEPTION << "Incorrect configuration of split layer " << getName() << "!";
-                dstData[b * dst_batch_off + dstBlob->getTensorDesc().offset(dIdx)] =
-                        srcData[b * src_batch_off + srcBlob->getTensorDesc().offset(sIdx)];
-            }
-        }
-    }
+    copy->split(batchToProcess());
 }
 
 bool MKLDNNSplitNode::created() const {
@@ -7,6 +7,8 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <mkldnn_axis_copy.h>
+#include <memory>
 #include <string>
 
 namespace MKLDNNPlugin {
@@ -29,6 +31,8 @@ public:
 private:
     static Register<MKLDNNSplitNode> reg;
     size_t axis = 1;
+    // copies the outputs when the split is not in place
+    std::unique_ptr<MKLDNNAxisCopy> copy;
 };
 
 }  // namespace MKLDNNPlugin
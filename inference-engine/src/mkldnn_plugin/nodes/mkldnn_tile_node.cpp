@@ -4,15 +4,40 @@
 //
 
 #include "mkldnn_tile_node.h"
+#include "mkldnn_eltwise_node.h"
 #include <ie_layers.h>
 #include <string>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <xmmintrin.h>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel_for.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+// the rows shorter than this are copied in a loop, the call of memcpy costs more than the copy
+const int shortRow = 16;
+// the output larger than this does not fit the caches, it is written around them
+const size_t streamingSize = 4 * 1024 * 1024;
+
+void streamRow(float *dst, const float *src, size_t size) {
+    size_t i = 0;
+    for (; i < size && (reinterpret_cast<uintptr_t>(dst + i) & 15) != 0; i++)
+        dst[i] = src[i];
+    for (; i + 4 <= size; i += 4)
+        _mm_stream_ps(dst + i, _mm_loadu_ps(src + i));
+    for (; i < size; i++)
+        dst[i] = src[i];
+}
+
+}  // namespace
+
 MKLDNNTileNode::MKLDNNTileNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
 
 void MKLDNNTileNode::getSupportedDescriptors() {
@@ -80,7 +105,21 @@ void MKLDNNTileNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Incorrect number of input edges.";
 }
 
+bool MKLDNNTileNode::isBroadcastView() {
+    // the tiles of the batch change with the dynamic batch, the constant input is released after the load
+    if (axis <= 0 || isConstant() || getChildEdges().size() != 1)
+        return false;
+
+    // the reorder between the tile and the eltwise would read the output, so the consumer is the eltwise itself
+    auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(getChildEdgeAt(0)->getChild());
+    return eltwise && !eltwise->isSum();
+}
+
 void MKLDNNTileNode::execute(mkldnn::stream strm) {
+    // the eltwise reads the input repeated along the axis, the output is not materialized
+    if (isBroadcastView())
+        return;
+
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
     const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
@@ -116,13 +155,32 @@ void MKLDNNTileNode::execute(mkldnn::stream strm) {
         m_outer_dim /= 16;
     }
 
-    for (int i = 0; i < m_outer_dim; ++i) {
-        for (int t = 0; t < tiles; ++t) {
-            memcpy(dst_ptr, src_ptr, m_inner_dim* sizeof(float));
-            dst_ptr += m_inner_dim;
-        }
-        src_ptr += m_inner_dim;
+    const int tilesNum = tiles;
+    if (m_inner_dim < shortRow) {
+        parallel_for(m_outer_dim, [&](int i) {
+            const float *src = src_ptr + static_cast<size_t>(i) * m_inner_dim;
+            float *dst = dst_ptr + static_cast<size_t>(i) * tilesNum * m_inner_dim;
+            for (int t = 0; t < tilesNum; ++t) {
+                for (int j = 0; j < m_inner_dim; ++j)
+                    dst[t * m_inner_dim + j] = src[j];
+            }
+        });
+        return;
     }
+
+    const bool streaming = static_cast<size_t>(m_outer_dim) * tilesNum * m_inner_dim * sizeof(float) >= streamingSize;
+    parallel_nt(0, [&](int ithr, int nthr) {
+        for_2d(ithr, nthr, m_outer_dim, tilesNum, [&](int i, int t) {
+            const float *src = src_ptr + static_cast<size_t>(i) * m_inner_dim;
+            float *dst = dst_ptr + (static_cast<size_t>(i) * tilesNum + t) * m_inner_dim;
+            if (streaming)
+                streamRow(dst, src, m_inner_dim);
+            else
+                memcpy(dst, src, m_inner_dim * sizeof(float));
+        });
+        if (streaming)
+            _mm_sfence();
+    });
 }
 
 bool MKLDNNTileNode::created() const {
@@ -22,6 +22,18 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
+    /**
+     * @brief The single eltwise consumer (except the sum) reads the input of the tile repeated along the axis,
+     * the tile does not write the output then
+     */
+    bool isBroadcastView();
+    int getAxis() const {
+        return axis;
+    }
+    int getTiles() const {
+        return tiles;
+    }
+
 private:
     static Register<MKLDNNTileNode> reg;
     int axis = 0;
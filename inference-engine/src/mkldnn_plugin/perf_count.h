@@ -5,37 +5,161 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief The execution time statistics of one node: the total, min and max time and the histogram of the times.
+ * The times are measured in the time stamp counter ticks, which are converted to microseconds on the read only.
+ * The histogram has 8 buckets per power of two, so the percentiles are estimated within 6% of the actual value.
+ */
 class PerfCount {
+    static constexpr int subBucketBits = 3;
+    static constexpr int subBuckets = 1 << subBucketBits;
+    // the ticks are counted in the units of 16, so the last bucket takes the times longer than ~2^37 ticks
+    static constexpr int unitBits = 4;
+    static constexpr int buckets = 256;
+
     uint64_t duration;
+    uint64_t minTicks;
+    uint64_t maxTicks;
     uint32_t num;
+    std::array<uint32_t, buckets> histogram;
 
-    std::chrono::high_resolution_clock::time_point __start;
-    std::chrono::high_resolution_clock::time_point __finish;
+    uint64_t __start;
 
 public:
-    PerfCount(): duration(0), num(0) {}
+    PerfCount(): duration(0), minTicks(UINT64_MAX), maxTicks(0), num(0), histogram() {}
+
+    uint32_t count() const { return num; }
+
+    uint64_t avg() const { return (num == 0) ? 0 : toMicroseconds(duration / num); }
+    uint64_t minTime() const { return (num == 0) ? 0 : toMicroseconds(minTicks); }
+    uint64_t maxTime() const { return toMicroseconds(maxTicks); }
+
+    /**
+     * @brief Returns the time below which the given percent of the executions took (the nearest rank) estimated
+     * by the middle of its bucket and clamped by the min and max times
+     */
+    uint64_t percentile(double percent) const {
+        if (num == 0)
+            return 0;
+        uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percent / 100.0 * num)));
+        uint64_t seen = 0;
+        for (int i = 0; i < buckets; i++) {
+            seen += histogram[i];
+            if (seen >= rank) {
+                uint64_t ticks = (bucketLow(i) + bucketLow(i + 1)) / 2;
+                return toMicroseconds(std::min(std::max(ticks, minTicks), maxTicks));
+            }
+        }
+        return maxTime();
+    }
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    void merge(const PerfCount &other) {
+        duration += other.duration;
+        minTicks = std::min(minTicks, other.minTicks);
+        maxTicks = std::max(maxTicks, other.maxTicks);
+        num += other.num;
+        for (int i = 0; i < buckets; i++)
+            histogram[i] += other.histogram[i];
+    }
+
+    static uint64_t now() { return __rdtsc(); }
+
+    /**
+     * @brief Returns the frequency of the time stamp counter, which is measured against the steady clock once
+     */
+    static double ticksPerMicrosecond() {
+        static const double frequency = []() {
+            auto start = std::chrono::steady_clock::now();
+            uint64_t startTicks = now();
+            while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10)) {}
+            uint64_t ticks = now() - startTicks;
+            double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            return std::max(1.0, ticks / us);
+        }();
+        return frequency;
+    }
 
 private:
+    static uint64_t toMicroseconds(uint64_t ticks) {
+        return static_cast<uint64_t>(ticks / ticksPerMicrosecond());
+    }
+
+    static int bucketOf(uint64_t ticks) {
+        uint64_t units = ticks >> unitBits;
+        if (units < subBuckets)
+            return static_cast<int>(units);
+#ifdef _MSC_VER
+        unsigned long msb;
+        _BitScanReverse64(&msb, units);
+        int exponent = static_cast<int>(msb);
+#else
+        int exponent = 63 - __builtin_clzll(units);
+#endif
+        int bucket = (exponent - subBucketBits + 1) * subBuckets +
+                     static_cast<int>((units >> (exponent - subBucketBits)) & (subBuckets - 1));
+        return std::min(bucket, buckets - 1);
+    }
+
+    static uint64_t bucketLow(int bucket) {
+        if (bucket < subBuckets)
+            return static_cast<uint64_t>(bucket) << unitBits;
+        int exponent = bucket / subBuckets + subBucketBits - 1;
+        uint64_t units = (static_cast<uint64_t>(subBuckets) | (bucket % subBuckets)) << (exponent - subBucketBits);
+        return units << unitBits;
+    }
+
     void start_itr() {
-        __start = std::chrono::high_resolution_clock::now();
+        __start = now();
     }
 
     void finish_itr() {
-        __finish = std::chrono::high_resolution_clock::now();
-
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        uint64_t ticks = now() - __start;
+        duration += ticks;
+        minTicks = std::min(minTicks, ticks);
+        maxTicks = std::max(maxTicks, ticks);
         num++;
+        histogram[bucketOf(ticks)]++;
     }
 
     friend class PerfHelper;
 };
 
+/**
+ * @brief The statistics of the nodes of a graph indexed by their execution index. Every infer request keeps its own
+ * counters, so the concurrent requests do not mix (or race on) the statistics of each other.
+ */
+class PerfCounters {
+    std::vector<PerfCount> counters;
+
+public:
+    /**
+     * @brief Prepares the counters for the graph of the given number of nodes. The replicas of the graph (the streams)
+     * share the counters, the graph of another size (e.g. reshaped) starts the statistics over.
+     */
+    void prepare(size_t nodes) {
+        if (counters.size() != nodes)
+            counters.assign(nodes, PerfCount());
+    }
+
+    PerfCount &operator[](size_t index) { return counters[index]; }
+    const PerfCount &operator[](size_t index) const { return counters[index]; }
+    size_t size() const { return counters.size(); }
+};
+
 class PerfHelper {
     PerfCount &counter;
 
@@ -47,4 +171,4 @@ public:
 
 }  // namespace MKLDNNPlugin
 
-#define PERF(_counter) PerfHelper __helper##__counter (_counter->PerfCounter());
+#define PERF(_counters, _node) PerfHelper __helper((_counters)[(_node)->execIndex]);
@@ -0,0 +1,51 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_device_async_infer_request.h"
+#include <ie_profiling.hpp>
+
+using namespace MultiDevicePlugin;
+using namespace InferenceEngine;
+
+MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(MultiDeviceInferRequest::Ptr request,
+                                                           const ITaskExecutor::Ptr &taskExecutor,
+                                                           const TaskSynchronizer::Ptr &taskSynchronizer,
+                                                           const ITaskExecutor::Ptr &callbackExecutor)
+        : AsyncInferRequestThreadSafeDefault(request, taskExecutor, taskSynchronizer, callbackExecutor),
+          _multiDeviceInferRequest(request) {
+    std::function<void(InferRequest, StatusCode)> f =
+        [&](InferRequest /*request*/, StatusCode /*sts*/) {
+            setIsRequestBusy(false);
+        };
+
+    _multiDeviceInferRequest->setCallback(f);
+}
+
+void MultiDeviceAsyncInferRequest::StartAsync() {
+    IE_PROFILING_AUTO_SCOPE(MultiDevice_Async)
+    if (!occupyRequest()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+    _multiDeviceInferRequest->startFrame(true);
+}
+
+InferenceEngine::StatusCode MultiDeviceAsyncInferRequest::Wait(int64_t millis_timeout) {
+    auto sts = _multiDeviceInferRequest->waitFrame(millis_timeout);
+    if (sts != StatusCode::RESULT_NOT_READY && sts != StatusCode::REQUEST_BUSY) {
+        setIsRequestBusy(false);
+    }
+    return sts;
+}
+
+void MultiDeviceAsyncInferRequest::SetCompletionCallback(IInferRequest::CompletionCallback callback) {
+    AsyncInferRequestThreadSafeDefault::SetCompletionCallback(callback);
+
+    std::function<void(InferRequest, StatusCode)> f =
+            [&](InferRequest /*request*/, StatusCode sts) {
+                setIsRequestBusy(false);
+                _callbackManager.set_requestStatus(sts);
+                _callbackManager.runCallback();
+            };
+
+    _multiDeviceInferRequest->setCallback(f);
+}
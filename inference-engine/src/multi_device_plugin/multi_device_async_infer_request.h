@@ -0,0 +1,34 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
+#include "multi_device_infer_request.h"
+
+namespace MultiDevicePlugin {
+
+class MultiDeviceAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    typedef std::shared_ptr<MultiDeviceAsyncInferRequest> Ptr;
+
+    MultiDeviceAsyncInferRequest(MultiDeviceInferRequest::Ptr request,
+                                 const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
+                                 const InferenceEngine::TaskSynchronizer::Ptr &taskSynchronizer,
+                                 const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+
+    void StartAsync() override;
+
+    InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
+
+    void SetCompletionCallback(InferenceEngine::IInferRequest::CompletionCallback callback) override;
+
+private:
+    MultiDeviceInferRequest::Ptr _multiDeviceInferRequest;
+};
+
+}  // namespace MultiDevicePlugin
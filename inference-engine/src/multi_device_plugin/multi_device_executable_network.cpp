@@ -0,0 +1,168 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_device_executable_network.h"
+#include "multi_device_infer_request.h"
+#include "multi_device_async_infer_request.h"
+#include "ie_util_internal.hpp"
+
+#include <sstream>
+#include <utility>
+
+#include <ie_plugin_dispatcher.hpp>
+#include "ie_plugin_config.hpp"
+#include "multi-device/multi_device_config.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::MultiDeviceConfigParams;
+using namespace MultiDevicePlugin;
+
+std::vector<MultiDeviceExecutableNetwork::DeviceInformation>
+MultiDeviceExecutableNetwork::parseDevices(const std::string &priorities) {
+    std::vector<DeviceInformation> devices;
+    std::stringstream ss(priorities);
+    std::string device;
+    while (std::getline(ss, device, ',')) {
+        DeviceInformation info = {device, 2};
+        auto openingBracket = device.find('(');
+        if (openingBracket != std::string::npos) {
+            auto closingBracket = device.find(')', openingBracket);
+            std::stringstream requests(device.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+            int numRequests = 0;
+            requests >> numRequests;
+            if (closingBracket == std::string::npos || requests.fail() || numRequests <= 0) {
+                THROW_IE_EXCEPTION << "Wrong number of the requests of the device " << device << " in the "
+                                   << KEY_MULTI_DEVICE_PRIORITIES << " option of multi-device plugin";
+            }
+            info.name = device.substr(0, openingBracket);
+            info.numRequests = static_cast<size_t>(numRequests);
+        }
+        if (info.name.empty()) {
+            THROW_IE_EXCEPTION << "Empty device name in the " << KEY_MULTI_DEVICE_PRIORITIES
+                               << " option of multi-device plugin";
+        }
+        for (auto &&d : devices) {
+            if (d.name == info.name) {
+                THROW_IE_EXCEPTION << "The device " << info.name << " is listed twice in the "
+                                   << KEY_MULTI_DEVICE_PRIORITIES << " option of multi-device plugin";
+            }
+        }
+        devices.push_back(info);
+    }
+    return devices;
+}
+
+MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(ICNNNetwork &network,
+                                                           const std::map<std::string, std::string> &config,
+                                                           const std::vector<IExtensionPtr> &extensions) {
+    auto itPriorities = config.find(KEY_MULTI_DEVICE_PRIORITIES);
+    if (itPriorities == config.end() || itPriorities->second.empty()) {
+        THROW_IE_EXCEPTION << "The " << KEY_MULTI_DEVICE_PRIORITIES << " option of multi-device plugin is not set";
+    }
+
+    auto itBatchSlice = config.find(KEY_MULTI_BATCH_SLICE);
+    if (itBatchSlice != config.end()) {
+        std::stringstream ss(itBatchSlice->second);
+        int sliceBatch = 0;
+        ss >> sliceBatch;
+        if (ss.fail() || sliceBatch < 0) {
+            THROW_IE_EXCEPTION << "Wrong value " << itBatchSlice->second << " of the " << KEY_MULTI_BATCH_SLICE
+                               << " option of multi-device plugin";
+        }
+        _sliceBatch = static_cast<size_t>(sliceBatch);
+    }
+    if (_sliceBatch > 0) {
+        size_t batch = network.getBatchSize();
+        if (batch % _sliceBatch != 0) {
+            THROW_IE_EXCEPTION << "The batch " << batch << " of the network is not a multiple of the "
+                               << KEY_MULTI_BATCH_SLICE << " option " << _sliceBatch;
+        }
+        // the slices are cut along the first dimension of the blobs
+        auto hasBatch = [batch](const TensorDesc &desc) {
+            return !desc.getDims().empty() && desc.getDims()[0] == batch;
+        };
+        InputsDataMap inputs;
+        network.getInputsInfo(inputs);
+        for (auto &&input : inputs) {
+            if (!hasBatch(input.second->getTensorDesc())) {
+                THROW_IE_EXCEPTION << "The input " << input.first << " has no batch dimension to slice";
+            }
+        }
+        OutputsDataMap outputs;
+        network.getOutputsInfo(outputs);
+        for (auto &&output : outputs) {
+            if (!hasBatch(output.second->getTensorDesc())) {
+                THROW_IE_EXCEPTION << "The output " << output.first << " has no batch dimension to slice";
+            }
+        }
+        if (_sliceBatch == batch) {
+            _sliceBatch = 0;
+        }
+    }
+
+    std::vector<MultiDeviceScheduler::DeviceDesc> devices;
+    PluginDispatcher dispatcher({ "" });
+    for (auto &&info : parseDevices(itPriorities->second)) {
+        auto plugin = dispatcher.getPluginByDevice(info.name);
+        if (info.name == "CPU") {
+            for (auto &&ext : extensions) {
+                plugin.AddExtension(ext);
+            }
+        }
+
+        // preparing local version of configs which are supported by plugins
+        std::map<std::string, std::string> tconfig;
+        for (auto &&c : config) {
+            if (c.first == KEY_MULTI_DEVICE_PRIORITIES || c.first == KEY_MULTI_BATCH_SLICE) {
+                continue;
+            }
+            try {
+                plugin.SetConfig({{c.first, c.second}});
+                tconfig[c.first] = c.second;
+            } catch (InferenceEngine::details::InferenceEngineException &) {
+            }
+        }
+
+        // every device gets its own copy of the network, the plugins reject the networks of the other devices
+        auto clonedNetwork = cloneNet(network);
+        clonedNetwork->setTargetDevice(TargetDeviceInfo::fromStr(info.name));
+        if (_sliceBatch > 0) {
+            ResponseDesc resp;
+            if (clonedNetwork->setBatchSize(_sliceBatch, &resp) != OK) {
+                THROW_IE_EXCEPTION << resp.msg;
+            }
+        }
+
+        MultiDeviceScheduler::DeviceDesc desc;
+        desc.name = info.name;
+        desc.network = std::make_shared<ExecutableNetwork>(plugin.LoadNetwork(*clonedNetwork, tconfig));
+        desc.numRequests = info.numRequests;
+        devices.push_back(desc);
+        _plugins.push_back(plugin);
+    }
+
+    _scheduler = std::make_shared<MultiDeviceScheduler>(devices);
+}
+
+MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
+    // the workers and the networks are released before their plugins
+    _scheduler = nullptr;
+}
+
+InferRequestInternal::Ptr MultiDeviceExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                             OutputsDataMap networkOutputs) {
+    return std::make_shared<MultiDeviceInferRequest>(networkInputs, networkOutputs, _scheduler, _sliceBatch);
+}
+
+void MultiDeviceExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
+    auto multiDeviceInferRequest = std::dynamic_pointer_cast<MultiDeviceInferRequest>(
+            CreateInferRequestImpl(_networkInputs, _networkOutputs));
+    multiDeviceInferRequest->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<MultiDeviceAsyncInferRequest>(
+            multiDeviceInferRequest, _taskExecutor, _taskSynchronizer, _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<MultiDeviceAsyncInferRequest>(asyncTreadSafeImpl),
+                       [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_common.h>
+#include <cpp/ie_plugin_cpp.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+
+#include "multi_device_scheduler.h"
+
+namespace MultiDevicePlugin {
+
+/**
+ * @brief The network loaded on every device of KEY_MULTI_DEVICE_PRIORITIES, its infer requests are executed by
+ * the workers of the devices (see MultiDeviceScheduler)
+ */
+class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    typedef std::shared_ptr<MultiDeviceExecutableNetwork> Ptr;
+
+    /**
+     * @brief A device of KEY_MULTI_DEVICE_PRIORITIES and the number of its requests
+     */
+    struct DeviceInformation {
+        std::string name;
+        size_t numRequests;
+    };
+
+    /**
+     * @brief Parses the value of KEY_MULTI_DEVICE_PRIORITIES, e.g. "CPU(4),GPU(8)"
+     */
+    static std::vector<DeviceInformation> parseDevices(const std::string &priorities);
+
+    MultiDeviceExecutableNetwork(InferenceEngine::ICNNNetwork &network,
+                                 const std::map<std::string, std::string> &config,
+                                 const std::vector<InferenceEngine::IExtensionPtr> &extensions);
+
+    ~MultiDeviceExecutableNetwork() override;
+
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
+
+private:
+    // the plugins outlive the networks loaded by them
+    std::vector<InferenceEngine::InferencePlugin> _plugins;
+    MultiDeviceScheduler::Ptr _scheduler;
+    // the batch of the networks of the devices, see KEY_MULTI_BATCH_SLICE
+    size_t _sliceBatch = 0;
+};
+
+}  // namespace MultiDevicePlugin
@@ -0,0 +1,150 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_device_infer_request.h"
+#include <ie_blob.h>
+#include <ie_plugin.hpp>
+#include <blob_factory.hpp>
+
+using namespace MultiDevicePlugin;
+using namespace InferenceEngine;
+
+MultiDeviceInferRequest::MultiDeviceInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                                 InferenceEngine::OutputsDataMap networkOutputs,
+                                                 const MultiDeviceScheduler::Ptr &scheduler,
+                                                 size_t sliceBatch) :
+        InferRequestInternal(networkInputs, networkOutputs),
+        _scheduler(scheduler), _sliceBatch(sliceBatch) {
+    if (_networkOutputs.empty() || _networkInputs.empty()) {
+        THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
+    }
+
+    // the workers are shared by all the requests, so only the inputs and the outputs belong to the request
+    for (auto &&input : _networkInputs) {
+        _inputs[input.first] = make_blob_with_precision(input.second->getTensorDesc());
+        _inputs[input.first]->allocate();
+    }
+    for (auto &&output : _networkOutputs) {
+        _outputs[output.first] = make_blob_with_precision(output.second->getTensorDesc());
+        _outputs[output.first]->allocate();
+    }
+}
+
+MultiDeviceInferRequest::~MultiDeviceInferRequest() {
+    // the running frame refers to the request
+    std::unique_lock<std::mutex> lock(_frameMutex);
+    _frameDone.wait(lock, [this] { return !_frameRunning; });
+}
+
+std::vector<MultiDeviceScheduler::Frame::Ptr> MultiDeviceInferRequest::makeFrames() {
+    auto frame = std::make_shared<MultiDeviceScheduler::Frame>();
+    for (auto &&input : _inputs) {
+        auto it = _preProcData.find(input.first);
+        frame->blobs[input.first] = it != _preProcData.end() ? it->second.getRoiBlob() : input.second;
+    }
+    for (auto &&output : _outputs) {
+        frame->blobs[output.first] = output.second;
+    }
+    if (_sliceBatch == 0) {
+        return {frame};
+    }
+
+    if (!_preProcData.empty()) {
+        THROW_IE_EXCEPTION << "The pre-processing of the inputs is not supported with the batch slices";
+    }
+    size_t batch = frame->blobs.begin()->second->getTensorDesc().getDims()[0];
+    std::vector<MultiDeviceScheduler::Frame::Ptr> slices(batch / _sliceBatch);
+    for (size_t s = 0; s < slices.size(); s++) {
+        slices[s] = std::make_shared<MultiDeviceScheduler::Frame>();
+        for (auto &&blob : frame->blobs) {
+            // the slice is the view of the samples of the blob, the view keeps the blob alive
+            const TensorDesc &desc = blob.second->getTensorDesc();
+            SizeVector dims = desc.getDims();
+            size_t sliceBytes = blob.second->byteSize() / dims[0] * _sliceBatch;
+            dims[0] = _sliceBatch;
+            Blob::Ptr view = make_blob_with_precision(TensorDesc(desc.getPrecision(), dims, desc.getLayout()),
+                                                      blob.second->buffer().as<uint8_t *>() + s * sliceBytes);
+            Blob::Ptr parent = blob.second;
+            slices[s]->blobs[blob.first] = Blob::Ptr(view.get(), [view, parent](Blob *) {});
+        }
+    }
+    return slices;
+}
+
+void MultiDeviceInferRequest::startFrame(bool notify) {
+    auto frames = makeFrames();
+
+    for (auto &&frame : frames) {
+        MultiDeviceScheduler::Frame *framePtr = frame.get();
+        frame->onDone = [this, framePtr, notify](StatusCode sts) {
+            // the request may be started again or destroyed as soon as the last frame is marked done
+            std::function<void(InferRequest, StatusCode)> callback;
+            if (notify) {
+                callback = _callback;
+            }
+            {
+                std::lock_guard<std::mutex> lock(_frameMutex);
+                _executedRequest = framePtr->executedRequest;
+                if (sts != OK) {
+                    _frameStatus = sts;
+                }
+                if (--_pendingFrames > 0) {
+                    return;
+                }
+                if (_frameStatus == RESULT_NOT_READY) {
+                    _frameStatus = OK;
+                }
+                sts = _frameStatus;
+                _frameRunning = false;
+            }
+            _frameDone.notify_all();
+            if (callback) {
+                callback(InferRequest(), sts);
+            }
+        };
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_frameMutex);
+        _frameRunning = true;
+        _pendingFrames = frames.size();
+        _frameStatus = RESULT_NOT_READY;
+    }
+    for (auto &&frame : frames) {
+        _scheduler->Run(frame);
+    }
+}
+
+void MultiDeviceInferRequest::InferImpl() {
+    startFrame(false);
+    auto sts = waitFrame(IInferRequest::WaitMode::RESULT_READY);
+    if (sts != OK) {
+        THROW_IE_EXCEPTION << "Inference of the multi-device network failed with the status " << sts;
+    }
+}
+
+void MultiDeviceInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    perfMap.clear();
+    std::lock_guard<std::mutex> lock(_frameMutex);
+    if (_executedRequest) {
+        perfMap = _executedRequest->GetPerformanceCounts();
+    }
+}
+
+void MultiDeviceInferRequest::setCallback(std::function<void(InferRequest, StatusCode)> &callback) {
+    _callback = callback;
+}
+
+StatusCode MultiDeviceInferRequest::waitFrame(int64_t millis_timeout) {
+    std::unique_lock<std::mutex> lock(_frameMutex);
+    auto isDone = [this] { return !_frameRunning; };
+    if (millis_timeout == IInferRequest::WaitMode::RESULT_READY) {
+        _frameDone.wait(lock, isDone);
+    } else if (millis_timeout != IInferRequest::WaitMode::STATUS_ONLY &&
+               !_frameDone.wait_for(lock, std::chrono::milliseconds(millis_timeout), isDone)) {
+        return RESULT_NOT_READY;
+    }
+    return _frameRunning ? RESULT_NOT_READY : _frameStatus;
+}
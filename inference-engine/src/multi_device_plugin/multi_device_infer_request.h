@@ -0,0 +1,67 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <ie_common.h>
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <cpp/ie_infer_request.hpp>
+
+#include "multi_device_scheduler.h"
+
+namespace MultiDevicePlugin {
+
+/**
+ * @brief The infer request of the multi-device network. The inputs and the outputs are allocated by the request
+ * itself and bound to the worker of the device which executes the frame of the request (see MultiDeviceScheduler).
+ * With KEY_MULTI_BATCH_SLICE the request is executed as the frames of its slices, possibly on different devices.
+ */
+class MultiDeviceInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    typedef std::shared_ptr<MultiDeviceInferRequest> Ptr;
+
+    explicit MultiDeviceInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                     InferenceEngine::OutputsDataMap networkOutputs,
+                                     const MultiDeviceScheduler::Ptr &scheduler,
+                                     size_t sliceBatch = 0);
+
+    ~MultiDeviceInferRequest();
+
+    void InferImpl() override;
+
+    /**
+     * @brief Returns the counters of the worker which executed the last frame (slice) of the request
+     */
+    void
+    GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
+
+    void startFrame(bool notify);
+
+    InferenceEngine::StatusCode waitFrame(int64_t millis_timeout);
+
+    void setCallback(std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)> &callback);
+
+private:
+    std::vector<MultiDeviceScheduler::Frame::Ptr> makeFrames();
+
+    MultiDeviceScheduler::Ptr _scheduler;
+    size_t _sliceBatch;
+    InferenceEngine::InferRequest::Ptr _executedRequest;
+    std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)> _callback;
+    mutable std::mutex _frameMutex;
+    std::condition_variable _frameDone;
+    bool _frameRunning = false;
+    size_t _pendingFrames = 0;
+    InferenceEngine::StatusCode _frameStatus = InferenceEngine::INFER_NOT_STARTED;
+};
+
+}  // namespace MultiDevicePlugin
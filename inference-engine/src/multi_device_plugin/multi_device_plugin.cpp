@@ -0,0 +1,45 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_device_plugin.h"
+#include <memory>
+#include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include "multi_device_executable_network.h"
+
+using namespace InferenceEngine;
+using namespace MultiDevicePlugin;
+
+InferenceEngine::ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network,
+                                                                           const std::map<std::string, std::string> &config) {
+    std::map<std::string, std::string> tconfig = config;
+
+    // we must not override the parameter, but need to copy everything from plugin config
+    for (auto &&c : _config) {
+        if (tconfig.find(c.first) == tconfig.end()) {
+            tconfig[c.first] = c.second;
+        }
+    }
+    return std::make_shared<MultiDeviceExecutableNetwork>(network, tconfig, _extensions);
+}
+
+void Engine::SetConfig(const std::map<std::string, std::string> &config) {
+    for (auto &&i : config) {
+        _config[i.first] = i.second;
+    }
+}
+
+void Engine::AddExtension(InferenceEngine::IExtensionPtr extension) {
+    _extensions.push_back(extension);
+}
+
+INFERENCE_PLUGIN_API(StatusCode) CreatePluginEngine(IInferencePlugin *&plugin, ResponseDesc *resp) noexcept {
+    try {
+        plugin = make_ie_compatible_plugin({{1, 2}, CI_BUILD_NUMBER, "MultiDevicePlugin"}, std::make_shared<Engine>());
+        return OK;
+    }
+    catch (std::exception &ex) {
+        return DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+    }
+}
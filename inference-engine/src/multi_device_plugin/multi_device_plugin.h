@@ -0,0 +1,36 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "inference_engine.hpp"
+#include <memory>
+#include <string>
+#include <map>
+#include <vector>
+#include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+
+namespace MultiDevicePlugin {
+
+/**
+ * @brief The plugin executing the network on several devices at once (see KEY_MULTI_DEVICE_PRIORITIES)
+ */
+class Engine : public InferenceEngine::InferencePluginInternal {
+public:
+    Engine() = default;
+    ~Engine() override = default;
+
+    InferenceEngine::ExecutableNetworkInternal::Ptr
+    LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network,
+                       const std::map<std::string, std::string> &config) override;
+    void SetConfig(const std::map<std::string, std::string> &config) override;
+
+    void AddExtension(InferenceEngine::IExtensionPtr extension) override;
+
+private:
+    std::vector<InferenceEngine::IExtensionPtr> _extensions;
+};
+
+}  // namespace MultiDevicePlugin
@@ -0,0 +1,167 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_device_scheduler.h"
+#include <details/ie_exception.hpp>
+#include "ie_profiling.hpp"
+
+using namespace MultiDevicePlugin;
+using namespace InferenceEngine;
+
+namespace {
+// the weight of the last inference in the moving average of the latency of a device
+const double latencyUpdateRate = 0.1;
+}  // namespace
+
+MultiDeviceScheduler::MultiDeviceScheduler(const std::vector<DeviceDesc> &devices) {
+    if (devices.empty()) {
+        THROW_IE_EXCEPTION << "No devices for the multi-device network";
+    }
+
+    _devices.resize(devices.size());
+    for (size_t d = 0; d < devices.size(); d++) {
+        auto &device = _devices[d];
+        device.desc = devices[d];
+        if (device.desc.numRequests == 0) {
+            THROW_IE_EXCEPTION << "The number of the requests of the device " << device.desc.name << " must be positive";
+        }
+
+        for (size_t r = 0; r < device.desc.numRequests; r++) {
+            auto request = device.desc.network->CreateInferRequestPtr();
+            int index = static_cast<int>(r);
+            request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                    [this, d, index](InferRequest /*request*/, StatusCode sts) {
+                        IE_PROFILING_AUTO_SCOPE(Callback)
+                        onRequestDone(d, index, sts);
+                    });
+            device.requests.push_back(request);
+            device.running.push_back(nullptr);
+            device.startTimes.emplace_back();
+            device.freeRequests.push_back(index);
+        }
+    }
+}
+
+MultiDeviceScheduler::~MultiDeviceScheduler() {
+    // the callbacks of the running workers refer to the scheduler
+    for (auto &&device : _devices) {
+        for (auto &&request : device.requests) {
+            try {
+                request->Wait(IInferRequest::WaitMode::RESULT_READY);
+            } catch (...) {}
+        }
+    }
+}
+
+void MultiDeviceScheduler::Run(const Frame::Ptr &frame) {
+    std::vector<StartedRequest> started;
+    std::vector<FinishedFrame> finished;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        frame->executedRequest = nullptr;
+        _waiting.push_back(frame);
+        schedule(started, finished);
+    }
+    start(started, finished);
+}
+
+void MultiDeviceScheduler::onRequestDone(size_t deviceIndex, int request, StatusCode status) {
+    std::vector<StartedRequest> started;
+    std::vector<FinishedFrame> finished;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto &device = _devices[deviceIndex];
+        Frame::Ptr frame = device.running[request];
+        if (!frame) {
+            return;
+        }
+
+        if (status == OK) {
+            double latency = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - device.startTimes[request]).count();
+            device.latency = device.latency == 0.0 ? latency
+                                                   : device.latency + latencyUpdateRate * (latency - device.latency);
+        }
+        frame->executedRequest = device.requests[request];
+        device.running[request] = nullptr;
+        device.freeRequests.push_back(request);
+        finished.emplace_back(frame, status);
+        schedule(started, finished);
+    }
+    start(started, finished);
+}
+
+int MultiDeviceScheduler::selectDevice() const {
+    int fastest = -1;
+    int fastestFree = -1;
+    auto throughput = [this](int d) {
+        return _devices[d].desc.numRequests / _devices[d].latency;
+    };
+    for (size_t d = 0; d < _devices.size(); d++) {
+        auto &device = _devices[d];
+        if (device.latency == 0.0) {
+            // the devices are measured in the listed order
+            if (!device.freeRequests.empty()) {
+                return static_cast<int>(d);
+            }
+            continue;
+        }
+        int index = static_cast<int>(d);
+        if (fastest < 0 || throughput(index) > throughput(fastest)) {
+            fastest = index;
+        }
+        if (!device.freeRequests.empty() && (fastestFree < 0 || throughput(index) > throughput(fastestFree))) {
+            fastestFree = index;
+        }
+    }
+    if (fastestFree < 0 || fastestFree == fastest) {
+        return fastestFree;
+    }
+
+    // the waiting frames are finished by the busy faster device before the free slower device finishes one of them
+    double backlog = (_waiting.size() / throughput(fastest)) + _devices[fastest].latency;
+    return backlog < _devices[fastestFree].latency ? -1 : fastestFree;
+}
+
+void MultiDeviceScheduler::schedule(std::vector<StartedRequest> &started, std::vector<FinishedFrame> &finished) {
+    while (!_waiting.empty()) {
+        int deviceIndex = selectDevice();
+        if (deviceIndex < 0) {
+            return;
+        }
+        auto &device = _devices[deviceIndex];
+        Frame::Ptr frame = _waiting.front();
+        _waiting.pop_front();
+        int request = device.freeRequests.back();
+        device.freeRequests.pop_back();
+        try {
+            auto &worker = *device.requests[request];
+            for (auto &&blob : frame->blobs) {
+                worker.SetBlob(blob.first.c_str(), blob.second);
+            }
+            device.running[request] = frame;
+            device.startTimes[request] = std::chrono::steady_clock::now();
+            started.emplace_back(deviceIndex, request);
+        } catch (...) {
+            device.freeRequests.push_back(request);
+            frame->executedRequest = device.requests[request];
+            finished.emplace_back(frame, GENERAL_ERROR);
+        }
+    }
+}
+
+void MultiDeviceScheduler::start(const std::vector<StartedRequest> &started,
+                                 const std::vector<FinishedFrame> &finished) {
+    for (auto &&frame : finished) {
+        frame.first->onDone(frame.second);
+    }
+    for (auto &&request : started) {
+        try {
+            _devices[request.first].requests[request.second]->StartAsync();
+        } catch (...) {
+            onRequestDone(request.first, request.second, GENERAL_ERROR);
+        }
+    }
+}
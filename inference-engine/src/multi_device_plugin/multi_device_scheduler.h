@@ -0,0 +1,92 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <ie_common.h>
+#include <ie_blob.h>
+#include <cpp/ie_infer_request.hpp>
+#include <cpp/ie_executable_network.hpp>
+
+namespace MultiDevicePlugin {
+
+/**
+ * @brief Data parallel execution of the network loaded on several devices (see KEY_MULTI_DEVICE_PRIORITIES).
+ * Every device has its own pool of worker requests shared by all the infer requests of the multi-device network.
+ * A frame is executed by the free worker of the device with the best measured throughput, the throughput of a device
+ * is the number of its workers divided by the average latency of their inferences. The frames wait for the busy faster
+ * device instead of going to the free slower one, while the faster device would finish all the waiting frames before
+ * the slower one finishes one of them, so the slower devices are used only when the faster ones are saturated.
+ */
+class MultiDeviceScheduler {
+public:
+    typedef std::shared_ptr<MultiDeviceScheduler> Ptr;
+
+    /**
+     * @brief A network loaded on one device and the number of its workers
+     */
+    struct DeviceDesc {
+        std::string name;
+        InferenceEngine::ExecutableNetwork::Ptr network;
+        size_t numRequests;
+    };
+
+    /**
+     * @brief A frame executed by a worker, the blobs are the inputs and the outputs of the multi-device request
+     */
+    struct Frame {
+        typedef std::shared_ptr<Frame> Ptr;
+
+        std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
+        std::function<void(InferenceEngine::StatusCode)> onDone;
+
+        // the worker which executed the frame, filled when the frame is done
+        InferenceEngine::InferRequest::Ptr executedRequest;
+    };
+
+    explicit MultiDeviceScheduler(const std::vector<DeviceDesc> &devices);
+
+    ~MultiDeviceScheduler();
+
+    /**
+     * @brief Queues the frame to the devices, onDone of the frame is called from the thread of the callback
+     * of the worker
+     */
+    void Run(const Frame::Ptr &frame);
+
+private:
+    struct Device {
+        DeviceDesc desc;
+        std::vector<InferenceEngine::InferRequest::Ptr> requests;
+        std::vector<Frame::Ptr> running;
+        std::vector<std::chrono::steady_clock::time_point> startTimes;
+        std::vector<int> freeRequests;
+        // the moving average of the latency of the workers in milliseconds, 0 until the first frame is done
+        double latency = 0.0;
+    };
+    typedef std::pair<size_t, int> StartedRequest;
+    typedef std::pair<Frame::Ptr, InferenceEngine::StatusCode> FinishedFrame;
+
+    void onRequestDone(size_t device, int request, InferenceEngine::StatusCode status);
+    // the functions below are called under the lock, the collected requests and frames are started and
+    // notified by start() after the lock is released
+    void schedule(std::vector<StartedRequest> &started, std::vector<FinishedFrame> &finished);
+    int selectDevice() const;
+    void start(const std::vector<StartedRequest> &started, const std::vector<FinishedFrame> &finished);
+
+    std::vector<Device> _devices;
+    std::deque<Frame::Ptr> _waiting;
+    std::mutex _mutex;
+};
+
+}  // namespace MultiDevicePlugin
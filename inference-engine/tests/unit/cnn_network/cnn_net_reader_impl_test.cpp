@@ -11,6 +11,10 @@
 #include <gmock/gmock-more-actions.h>
 #include "cnn_network_impl.hpp"
 #include "mock_iformat_parser.hpp"
+#include <file_utils.h>
+#include <ie_util_internal.hpp>
+#include <fstream>
+#include <cstdio>
 
 using namespace testing;
 using namespace InferenceEngine;
@@ -1695,3 +1699,220 @@ TEST_F(CNNNetReaderImplTest, cycleIsDetectedInReader) {
 
     ASSERT_EQ(GENERAL_ERROR, reader.ReadNetwork(model.data(), model.length(), &resp));
 }
+
+TEST_F(CNNNetReaderImplTest, canReadMappedWeights) {
+    std::string model =
+            "<net name=\"Conv\" version=\"2\" batch=\"1\">"
+            "    <layers>"
+            "        <layer name=\"data\" type=\"Input\" precision=\"FP32\" id=\"0\">"
+            "            <output>"
+            "                <port id=\"0\">"
+            "                    <dim>1</dim>"
+            "                    <dim>2</dim>"
+            "                    <dim>1</dim>"
+            "                    <dim>1</dim>"
+            "                </port>"
+            "            </output>"
+            "        </layer>"
+            "        <layer name=\"conv\" type=\"Convolution\" precision=\"FP32\" id=\"1\">"
+            "            <convolution_data stride-x=\"1\" stride-y=\"1\" pad-x=\"0\" pad-y=\"0\" kernel-x=\"1\" kernel-y=\"1\" output=\"2\" group=\"1\"/>"
+            "            <input>"
+            "                <port id=\"1\">"
+            "                    <dim>1</dim>"
+            "                    <dim>2</dim>"
+            "                    <dim>1</dim>"
+            "                    <dim>1</dim>"
+            "                </port>"
+            "            </input>"
+            "            <output>"
+            "                <port id=\"2\">"
+            "                    <dim>1</dim>"
+            "                    <dim>2</dim>"
+            "                    <dim>1</dim>"
+            "                    <dim>1</dim>"
+            "                </port>"
+            "            </output>"
+            "            <weights offset=\"0\" size=\"16\"/>"
+            "            <biases offset=\"16\" size=\"8\"/>"
+            "        </layer>"
+            "    </layers>"
+            "    <edges>"
+            "        <edge from-layer=\"0\" from-port=\"0\" to-layer=\"1\" to-port=\"1\"/>"
+            "    </edges>"
+            "</net>";
+    const float weights[] = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+    const std::string weightsPath = "canReadMappedWeights.bin";
+    {
+        std::ofstream weightsFile(weightsPath, std::ios::binary);
+        weightsFile.write(reinterpret_cast<const char *>(weights), sizeof(weights));
+    }
+
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    ASSERT_EQ(OK, reader.ReadNetwork(model.data(), model.length(), &resp));
+    ASSERT_EQ(OK, reader.ReadWeights(weightsPath.c_str(), true, &resp)) << resp.msg;
+
+    CNNLayerPtr layer;
+    ASSERT_EQ(OK, reader.getNetwork(&resp)->getLayerByName("conv", layer, &resp));
+    auto conv = dynamic_cast<ConvolutionLayer *>(layer.get());
+    ASSERT_NE(nullptr, conv);
+    ASSERT_EQ(4, conv->_weights->size());
+    ASSERT_EQ(2, conv->_biases->size());
+    float *convWeights = conv->_weights->buffer().as<float *>();
+    float *convBiases = conv->_biases->buffer().as<float *>();
+    for (size_t i = 0; i < 4; i++)
+        ASSERT_EQ(weights[i], convWeights[i]);
+    for (size_t i = 0; i < 2; i++)
+        ASSERT_EQ(weights[4 + i], convBiases[i]);
+
+    // the mapping is private, so repacking the weights in place keeps the file intact
+    convWeights[0] = -1.f;
+    float fileWeights[6];
+    FileUtils::readAllFile(weightsPath, fileWeights, sizeof(fileWeights));
+    ASSERT_EQ(weights[0], fileWeights[0]);
+
+    std::remove(weightsPath.c_str());
+}
+
+TEST_F(CNNNetReaderImplTest, canReadLargeNetwork) {
+    const int layersNum = 5000;
+    auto port = [](int id) {
+        return "<port id=\"" + std::to_string(id) + "\"><dim>1</dim><dim>3</dim><dim>8</dim><dim>8</dim></port>";
+    };
+    std::string model = "<net name=\"Chain\" version=\"2\" batch=\"1\"><layers>"
+            "<layer name=\"data\" type=\"Input\" precision=\"FP32\" id=\"0\"><output>" + port(0) + "</output></layer>";
+    std::string edges;
+    for (int i = 1; i <= layersNum; i++) {
+        model += "<layer name=\"relu" + std::to_string(i) + "\" type=\"ReLU\" precision=\"FP32\" id=\"" +
+                 std::to_string(i) + "\"><data negative_slope=\"0\"/><input>" + port(0) + "</input><output>" +
+                 port(1) + "</output></layer>";
+        edges += "<edge from-layer=\"" + std::to_string(i - 1) + "\" from-port=\"" + (i == 1 ? "0" : "1") +
+                 "\" to-layer=\"" + std::to_string(i) + "\" to-port=\"0\"/>";
+    }
+    model += "</layers><edges>" + edges + "</edges></net>";
+
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    ASSERT_EQ(OK, reader.ReadNetwork(model.data(), model.length(), &resp)) << resp.msg;
+
+    auto network = reader.getNetwork(&resp);
+    ASSERT_EQ(layersNum + 1, network->layerCount());
+
+    CNNLayerPtr layer;
+    ASSERT_EQ(OK, network->getLayerByName(("relu" + std::to_string(layersNum)).c_str(), layer, &resp));
+    ASSERT_NE(nullptr, dynamic_cast<ReLULayer *>(layer.get()));
+    ASSERT_EQ("0", layer->params["negative_slope"]);
+}
+
+TEST_F(CNNNetReaderImplTest, canReadBinaryTopology) {
+    std::string model =
+            "<net name=\"Conv\" version=\"2\" batch=\"1\">"
+            "    <layers>"
+            "        <layer name=\"data\" type=\"Input\" precision=\"FP32\" id=\"0\">"
+            "            <output>"
+            "                <port id=\"0\">"
+            "                    <dim>1</dim>"
+            "                    <dim>2</dim>"
+            "                    <dim>1</dim>"
+            "                    <dim>1</dim>"
+            "                </port>"
+            "            </output>"
+            "        </layer>"
+            "        <layer name=\"conv\" type=\"Convolution\" precision=\"FP32\" id=\"1\">"
+            "            <convolution_data stride-x=\"1\" stride-y=\"1\" pad-x=\"0\" pad-y=\"0\" kernel-x=\"1\" kernel-y=\"1\" output=\"2\" group=\"1\"/>"
+            "            <input>"
+            "                <port id=\"1\">"
+            "                    <dim>1</dim>"
+            "                    <dim>2</dim>"
+            "                    <dim>1</dim>"
+            "                    <dim>1</dim>"
+            "                </port>"
+            "            </input>"
+            "            <output>"
+            "                <port id=\"2\">"
+            "                    <dim>1</dim>"
+            "                    <dim>2</dim>"
+            "                    <dim>1</dim>"
+            "                    <dim>1</dim>"
+            "                </port>"
+            "            </output>"
+            "            <weights offset=\"0\" size=\"16\"/>"
+            "            <biases offset=\"16\" size=\"8\"/>"
+            "        </layer>"
+            "        <layer name=\"relu\" type=\"Activation\" precision=\"FP32\" id=\"2\">"
+            "            <data type=\"relu\"/>"
+            "            <input>"
+            "                <port id=\"0\">"
+            "                    <dim>1</dim>"
+            "                    <dim>2</dim>"
+            "                    <dim>1</dim>"
+            "                    <dim>1</dim>"
+            "                </port>"
+            "            </input>"
+            "            <output>"
+            "                <port id=\"1\">"
+            "                    <dim>1</dim>"
+            "                    <dim>2</dim>"
+            "                    <dim>1</dim>"
+            "                    <dim>1</dim>"
+            "                </port>"
+            "            </output>"
+            "        </layer>"
+            "    </layers>"
+            "    <edges>"
+            "        <edge from-layer=\"0\" from-port=\"0\" to-layer=\"1\" to-port=\"1\"/>"
+            "        <edge from-layer=\"1\" from-port=\"2\" to-layer=\"2\" to-port=\"0\"/>"
+            "    </edges>"
+            "</net>";
+    const float weights[] = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+    TBlob<uint8_t>::Ptr weightsBlob(new TBlob<uint8_t>(Precision::U8, C, {sizeof(weights)}));
+    weightsBlob->allocate();
+    memcpy(weightsBlob->buffer(), weights, sizeof(weights));
+
+    CNNNetReaderImpl xmlReader(make_shared<V2FormatParserCreator>());
+    ASSERT_EQ(OK, xmlReader.ReadNetwork(model.data(), model.length(), &resp)) << resp.msg;
+    ASSERT_EQ(OK, xmlReader.SetWeights(weightsBlob, &resp)) << resp.msg;
+
+    const std::string topologyPath = "canReadBinaryTopology.ir";
+    const std::string weightsPath = "canReadBinaryTopology.bin";
+    {
+        std::ofstream topologyFile(topologyPath, std::ios::binary);
+        std::ofstream weightsFile(weightsPath, std::ios::binary);
+        saveNetworkToBinaryIR(*xmlReader.getNetwork(&resp), topologyFile, weightsFile);
+    }
+
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    ASSERT_EQ(OK, reader.ReadNetwork(topologyPath.c_str(), &resp)) << resp.msg;
+    ASSERT_EQ(OK, reader.ReadWeights(weightsPath.c_str(), true, &resp)) << resp.msg;
+
+    auto network = reader.getNetwork(&resp);
+    ASSERT_EQ(3, network->layerCount());
+    ASSERT_EQ(std::string("Conv"), network->getName());
+
+    CNNLayerPtr layer;
+    ASSERT_EQ(OK, network->getLayerByName("conv", layer, &resp));
+    auto conv = dynamic_cast<ConvolutionLayer *>(layer.get());
+    ASSERT_NE(nullptr, conv);
+    ASSERT_EQ(2, conv->_out_depth);
+    ASSERT_EQ(1, conv->insData.size());
+    ASSERT_EQ(std::string("data"), conv->insData[0].lock()->getName());
+    ASSERT_EQ(4, conv->_weights->size());
+    ASSERT_EQ(2, conv->_biases->size());
+    for (size_t i = 0; i < 4; i++)
+        ASSERT_EQ(weights[i], conv->_weights->buffer().as<float *>()[i]);
+    for (size_t i = 0; i < 2; i++)
+        ASSERT_EQ(weights[4 + i], conv->_biases->buffer().as<float *>()[i]);
+
+    ASSERT_EQ(OK, network->getLayerByName("relu", layer, &resp));
+    ASSERT_NE(nullptr, dynamic_cast<ReLULayer *>(layer.get()));
+
+    InputsDataMap inputs;
+    network->getInputsInfo(inputs);
+    ASSERT_EQ(1, inputs.size());
+    ASSERT_EQ((SizeVector{1, 2, 1, 1}), inputs["data"]->getTensorDesc().getDims());
+    OutputsDataMap outputs;
+    network->getOutputsInfo(outputs);
+    ASSERT_EQ(1, outputs.size());
+    ASSERT_NE(outputs.end(), outputs.find("relu"));
+
+    std::remove(topologyPath.c_str());
+    std::remove(weightsPath.c_str());
+}
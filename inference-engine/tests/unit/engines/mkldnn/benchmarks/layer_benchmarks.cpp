@@ -0,0 +1,379 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * The single layer benchmarks of the MKLDNN plugin nodes and the CPU extension kernels.
+ *
+ * Every case is the network of one layer at the shape it has in a well known topology (ResNet-50, MobileNet,
+ * SSD300, ...). The layer is measured with every implementation the node supports on this CPU, the time of one
+ * execution of the node (without the reorders around it), GFLOPS and GB/s are reported in the Google Benchmark
+ * style. The extension kernels are compiled for the ISA of the build and report one implementation ("unknown").
+ *
+ *     MKLDNNLayerBenchmarks [--benchmark_filter=<substring>] [--benchmark_min_time=<seconds>]
+ *                           [--isa=<avx512|avx2|sse42|ref>]
+ *
+ * The filter matches the name of the benchmark "<layer type>/<case>/<implementation>", the ISA keeps the
+ * implementations of the given instruction set only (e.g. --isa=avx2 compares jit_avx2 with jit_avx2_1x1 and
+ * gemm_avx2), the extension kernels are always measured.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "test_graph.hpp"
+#include "tests_common.hpp"
+#include <extension/ext_list.hpp>
+#include <inference_engine/cnn_network_impl.hpp>
+
+using namespace InferenceEngine;
+
+namespace {
+
+struct LayerCase {
+    std::string type;
+    std::string name;
+    // the attributes of the data node of the layer
+    std::string params;
+    std::vector<SizeVector> inputs;
+    SizeVector output;
+    // the number of the weights and biases elements
+    size_t weights;
+    size_t biases;
+    // the floating point operations of one execution, 0 for the data movement layers
+    double flops;
+    bool extension;
+};
+
+struct BenchmarkOptions {
+    std::string filter;
+    std::string isa;
+    double minTime = 0.5;
+};
+
+size_t elements(const SizeVector &dims) {
+    size_t count = 1;
+    for (auto dim : dims)
+        count *= dim;
+    return count;
+}
+
+LayerCase convolution(const std::string &name, size_t ic, size_t ih, size_t iw, size_t oc, size_t kernel,
+                      size_t stride, size_t pad, size_t group = 1) {
+    size_t oh = (ih + 2 * pad - kernel) / stride + 1;
+    size_t ow = (iw + 2 * pad - kernel) / stride + 1;
+    std::ostringstream params;
+    params << "stride-x=\"" << stride << "\" stride-y=\"" << stride << "\" pad-x=\"" << pad << "\" pad-y=\"" << pad
+           << "\" kernel-x=\"" << kernel << "\" kernel-y=\"" << kernel << "\" output=\"" << oc
+           << "\" group=\"" << group << "\"";
+    size_t weights = oc * ic / group * kernel * kernel;
+    return {"Convolution", name, params.str(), {{1, ic, ih, iw}}, {1, oc, oh, ow}, weights, oc,
+            2.0 * oh * ow * weights, false};
+}
+
+LayerCase deconvolution(const std::string &name, size_t ic, size_t ih, size_t iw, size_t oc, size_t kernel,
+                        size_t stride, size_t pad) {
+    size_t oh = (ih - 1) * stride - 2 * pad + kernel;
+    size_t ow = (iw - 1) * stride - 2 * pad + kernel;
+    std::ostringstream params;
+    params << "stride-x=\"" << stride << "\" stride-y=\"" << stride << "\" pad-x=\"" << pad << "\" pad-y=\"" << pad
+           << "\" kernel-x=\"" << kernel << "\" kernel-y=\"" << kernel << "\" output=\"" << oc << "\" group=\"1\"";
+    size_t weights = oc * ic * kernel * kernel;
+    return {"Deconvolution", name, params.str(), {{1, ic, ih, iw}}, {1, oc, oh, ow}, weights, 0,
+            2.0 * ih * iw * weights, false};
+}
+
+LayerCase pooling(const std::string &name, const std::string &method, size_t c, size_t ih, size_t iw,
+                  size_t kernel, size_t stride) {
+    size_t oh = (ih - kernel + stride - 1) / stride + 1;
+    size_t ow = (iw - kernel + stride - 1) / stride + 1;
+    std::ostringstream params;
+    params << "stride-x=\"" << stride << "\" stride-y=\"" << stride << "\" pad-x=\"0\" pad-y=\"0\" kernel-x=\""
+           << kernel << "\" kernel-y=\"" << kernel << "\" pool-method=\"" << method << "\"";
+    return {"Pooling", name, params.str(), {{1, c, ih, iw}}, {1, c, oh, ow}, 0, 0,
+            1.0 * c * oh * ow * kernel * kernel, false};
+}
+
+LayerCase elementwise(const std::string &type, const std::string &name, const std::string &params,
+                      const SizeVector &dims, double flopsPerElement, bool extension = false) {
+    return {type, name, params, {dims}, dims, 0, 0, flopsPerElement * elements(dims), extension};
+}
+
+std::vector<LayerCase> layerCases() {
+    std::vector<LayerCase> cases = {
+        // ResNet-50
+        convolution("resnet50_conv1", 3, 224, 224, 64, 7, 2, 3),
+        convolution("resnet50_res2a_branch2a", 64, 56, 56, 64, 1, 1, 0),
+        convolution("resnet50_res2a_branch2b", 64, 56, 56, 64, 3, 1, 1),
+        convolution("resnet50_res2a_branch2c", 64, 56, 56, 256, 1, 1, 0),
+        convolution("resnet50_res3a_branch1", 256, 56, 56, 512, 1, 2, 0),
+        convolution("resnet50_res4a_branch2b", 256, 14, 14, 256, 3, 1, 1),
+        convolution("resnet50_res5a_branch2b", 512, 7, 7, 512, 3, 1, 1),
+        // MobileNet v1
+        convolution("mobilenet_conv1", 3, 224, 224, 32, 3, 2, 1),
+        convolution("mobilenet_conv2_1_dw", 32, 112, 112, 32, 3, 1, 1, 32),
+        convolution("mobilenet_conv2_1_sep", 32, 112, 112, 64, 1, 1, 0),
+        convolution("mobilenet_conv5_1_dw", 512, 14, 14, 512, 3, 1, 1, 512),
+        convolution("mobilenet_conv5_1_sep", 512, 14, 14, 512, 1, 1, 0),
+        // SSD300
+        convolution("ssd300_conv4_3", 512, 38, 38, 512, 3, 1, 1),
+        convolution("ssd300_fc7", 1024, 19, 19, 1024, 1, 1, 0),
+        convolution("ssd300_conv4_3_norm_mbox_loc", 512, 38, 38, 16, 3, 1, 1),
+
+        deconvolution("fcn_upsample_2x", 256, 28, 28, 256, 4, 2, 1),
+
+        pooling("resnet50_pool1", "max", 64, 112, 112, 3, 2),
+        pooling("resnet50_pool5", "avg", 2048, 7, 7, 7, 1),
+
+        {"InnerProduct", "resnet50_fc1000", "out-size=\"1000\"", {{1, 2048}}, {1, 1000}, 2048 * 1000, 1000,
+         2.0 * 2048 * 1000, false},
+        {"InnerProduct", "alexnet_fc6", "out-size=\"4096\"", {{1, 256, 6, 6}}, {1, 4096}, 9216 * 4096, 4096,
+         2.0 * 9216 * 4096, false},
+
+        elementwise("ReLU", "resnet50_res2a_relu", "negative_slope=\"0\"", {1, 256, 56, 56}, 1),
+        elementwise("Power", "mobilenet_data_scale", "power=\"1\" scale=\"0.017\" shift=\"-2\"", {1, 3, 224, 224}, 2),
+        elementwise("SoftMax", "resnet50_prob", "axis=\"1\"", {1, 1000}, 4),
+        {"Eltwise", "resnet50_res2a", "operation=\"sum\"", {{1, 256, 56, 56}, {1, 256, 56, 56}}, {1, 256, 56, 56},
+         0, 0, 1.0 * 256 * 56 * 56, false},
+        {"Concat", "googlenet_inception_3a_output", "axis=\"1\"", {{1, 64, 28, 28}, {1, 128, 28, 28}},
+         {1, 192, 28, 28}, 0, 0, 0, false},
+        {"LRN", "alexnet_norm1", "alpha=\"0.0001\" beta=\"0.75\" local-size=\"5\" region=\"1\"",
+         {{1, 96, 55, 55}}, {1, 96, 55, 55}, 0, 0, 2.0 * 5 * 96 * 55 * 55, false},
+        {"BatchNormalization", "resnet50_bn_conv1", "epsilon=\"0.00001\"", {{1, 64, 112, 112}}, {1, 64, 112, 112},
+         64, 64, 2.0 * 64 * 112 * 112, false},
+        {"ScaleShift", "resnet50_scale_conv1", "", {{1, 64, 112, 112}}, {1, 64, 112, 112}, 64, 64,
+         2.0 * 64 * 112 * 112, false},
+        {"Permute", "ssd300_conv4_3_norm_mbox_loc_perm", "order=\"0,2,3,1\"", {{1, 16, 38, 38}}, {1, 38, 38, 16},
+         0, 0, 0, false},
+        {"ReorgYolo", "yolo_v2_reorg", "stride=\"2\"", {{1, 64, 26, 26}}, {1, 256, 13, 13}, 0, 0, 0, false},
+
+        // the CPU extension
+        elementwise("MVN", "mvn_56x56", "across_channels=\"0\" normalize_variance=\"1\" eps=\"1e-9\"",
+                    {1, 256, 56, 56}, 5, true),
+        {"Normalize", "ssd300_conv4_3_norm", "across_spatial=\"0\" channel_shared=\"0\" eps=\"1e-10\"",
+         {{1, 512, 38, 38}}, {1, 512, 38, 38}, 512, 0, 4.0 * 512 * 38 * 38, true},
+        elementwise("GRN", "grn_56x56", "bias=\"1\"", {1, 256, 56, 56}, 3, true),
+        {"Interp", "deeplab_interp_2x", "height=\"56\" width=\"56\" pad_beg=\"0\" pad_end=\"0\"",
+         {{1, 256, 28, 28}}, {1, 256, 56, 56}, 0, 0, 7.0 * 256 * 56 * 56, true},
+        {"Resample", "resample_nearest_2x", "type=\"caffe.ResampleParameter.NEAREST\" factor=\"2\" antialias=\"0\"",
+         {{1, 256, 28, 28}}, {1, 256, 56, 56}, 0, 0, 0, true},
+        {"RegionYolo", "yolo_v2_region", "coords=\"4\" classes=\"20\" num=\"5\" do_softmax=\"1\"",
+         {{1, 125, 13, 13}}, {1, 21125}, 0, 0, 3.0 * 125 * 13 * 13, true},
+        {"ArgMax", "resnet50_argmax", "top_k=\"1\" out_max_val=\"0\"", {{1, 1000}}, {1, 1, 1}, 0, 0, 1000, true},
+        {"PriorBox", "ssd300_conv4_3_norm_mbox_priorbox",
+         "min_size=\"30\" max_size=\"60\" aspect_ratio=\"2\" flip=\"1\" clip=\"0\" variance=\"0.1,0.1,0.2,0.2\" "
+         "step=\"8\" offset=\"0.5\"",
+         {{1, 512, 38, 38}, {1, 3, 300, 300}}, {1, 2, 23104}, 0, 0, 0, true},
+    };
+    return cases;
+}
+
+std::string portXml(size_t id, const SizeVector &dims) {
+    std::ostringstream xml;
+    xml << "<port id=\"" << id << "\">";
+    for (auto dim : dims)
+        xml << "<dim>" << dim << "</dim>";
+    xml << "</port>";
+    return xml.str();
+}
+
+std::string modelXml(const LayerCase &layer, const std::string &impl) {
+    size_t id = layer.inputs.size();
+    std::ostringstream xml;
+    xml << "<Net Name=\"" << layer.name << "\" version=\"2\" precision=\"FP32\" batch=\"1\"><layers>";
+    for (size_t i = 0; i < layer.inputs.size(); i++) {
+        xml << "<layer name=\"in" << i << "\" type=\"Input\" precision=\"FP32\" id=\"" << i << "\"><output>"
+            << portXml(0, layer.inputs[i]) << "</output></layer>";
+    }
+    xml << "<layer name=\"" << layer.name << "\" type=\"" << layer.type << "\" precision=\"FP32\" id=\"" << id
+        << "\"><data " << layer.params;
+    if (!impl.empty())
+        xml << " PrimitivesPriority=\"cpu:" << impl << "\"";
+    xml << "/>";
+    if (layer.weights)
+        xml << "<weights offset=\"0\" size=\"" << layer.weights * sizeof(float) << "\"/>";
+    if (layer.biases)
+        xml << "<biases offset=\"" << layer.weights * sizeof(float) << "\" size=\""
+            << layer.biases * sizeof(float) << "\"/>";
+    xml << "<input>";
+    for (size_t i = 0; i < layer.inputs.size(); i++)
+        xml << portXml(i, layer.inputs[i]);
+    xml << "</input><output>" << portXml(id, layer.output) << "</output></layer></layers><edges>";
+    for (size_t i = 0; i < layer.inputs.size(); i++) {
+        xml << "<edge from-layer=\"" << i << "\" from-port=\"0\" to-layer=\"" << id << "\" to-port=\"" << i
+            << "\"/>";
+    }
+    xml << "</edges></Net>";
+    return xml.str();
+}
+
+/**
+ * @brief The graph of one layer with the inputs and the outputs filled
+ */
+struct LayerGraph {
+    MKLDNNGraphTestClass graph;
+    ::MKLDNNPlugin::MKLDNNNodePtr node;
+
+    LayerGraph(const LayerCase &layer, const std::string &impl) {
+        CNNNetReader reader;
+        std::string model = modelXml(layer, impl);
+        reader.ReadNetwork(model.data(), model.length());
+
+        size_t weightsBytes = (layer.weights + layer.biases) * sizeof(float);
+        TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>(Precision::U8, C, {std::max<size_t>(weightsBytes, 1)}));
+        weights->allocate();
+        TestsCommon::fill_data(reinterpret_cast<float *>(weights->buffer().as<uint8_t *>()),
+                               weightsBytes / sizeof(float));
+        reader.SetWeights(weights);
+
+        ::MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr;
+        if (layer.extension) {
+            extMgr = std::make_shared<::MKLDNNPlugin::MKLDNNExtensionManager>();
+            extMgr->AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+        }
+        graph.CreateGraph(reader.getNetwork(), extMgr);
+        for (auto &graphNode : graph.getNodes()) {
+            if (graphNode->getName() == layer.name)
+                node = graphNode;
+        }
+        if (!node)
+            THROW_IE_EXCEPTION << "The layer " << layer.name << " was not found in the graph";
+
+        BlobMap inputs;
+        for (size_t i = 0; i < layer.inputs.size(); i++) {
+            auto input = make_shared_blob<float>(Precision::FP32, TensorDesc::getLayoutByDims(layer.inputs[i]),
+                                                 layer.inputs[i]);
+            input->allocate();
+            TestsCommon::fill_data(input->buffer().as<float *>(), input->size());
+            inputs["in" + std::to_string(i)] = input;
+        }
+        BlobMap outputs;
+        for (auto &output : reader.getNetwork().getOutputsInfo()) {
+            auto blob = make_shared_blob<float>(output.second->getTensorDesc());
+            blob->allocate();
+            outputs[output.first] = blob;
+        }
+        // the first inference touches the memory and initializes the primitives
+        graph.Infer(inputs, outputs);
+    }
+
+    std::string implementation() const {
+        return MKLDNNGraphTestClass::getStrPrimitiveDescriptorType(
+                node->getSelectedPrimitiveDescriptor()->getImplementationType());
+    }
+
+    /**
+     * @brief Executes the node the growing number of times until the time of the batch exceeds the minimal one
+     * @return the time of one execution in microseconds
+     */
+    double measure(double minTime, size_t &iterations) {
+        mkldnn::stream stream(mkldnn::stream::kind::eager);
+        iterations = 1;
+        while (true) {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; i++)
+                node->execute(stream);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (seconds >= minTime || iterations >= (1u << 30))
+                return seconds * 1e6 / iterations;
+            // the next batch is predicted to take 1.4 of the minimal time, as in Google Benchmark
+            double multiplier = seconds > 0 ? std::min(10.0, std::max(2.0, minTime * 1.4 / seconds)) : 10.0;
+            iterations = static_cast<size_t>(iterations * multiplier);
+        }
+    }
+};
+
+/**
+ * @brief Returns the implementations of the node of the case supported on this CPU in the order of their priority
+ */
+std::vector<std::string> supportedImplementations(const LayerCase &layer) {
+    LayerGraph probe(layer, "");
+    std::vector<std::string> impls;
+    for (auto &descriptor : probe.node->getSupportedPrimitiveDescriptors()) {
+        auto impl = MKLDNNGraphTestClass::getStrPrimitiveDescriptorType(descriptor.getImplementationType());
+        if (std::find(impls.begin(), impls.end(), impl) == impls.end())
+            impls.push_back(impl);
+    }
+    return impls;
+}
+
+bool parseOptions(int argc, char *argv[], BenchmarkOptions &options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&](const std::string &flag) {
+            return arg.compare(0, flag.length(), flag) == 0 ? arg.substr(flag.length()) : std::string();
+        };
+        if (!value("--benchmark_filter=").empty()) {
+            options.filter = value("--benchmark_filter=");
+        } else if (!value("--benchmark_min_time=").empty()) {
+            options.minTime = std::stod(value("--benchmark_min_time="));
+        } else if (!value("--isa=").empty()) {
+            options.isa = value("--isa=");
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--benchmark_filter=<substring>]"
+                      << " [--benchmark_min_time=<seconds>] [--isa=<avx512|avx2|sse42|ref>]" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    BenchmarkOptions options;
+    if (!parseOptions(argc, argv, options))
+        return 1;
+
+    std::cout << std::string(104, '-') << std::endl
+              << std::left << std::setw(64) << "Benchmark" << std::right << std::setw(12) << "Time(us)"
+              << std::setw(12) << "Iterations" << std::setw(8) << "GFLOPS" << std::setw(8) << "GB/s" << std::endl
+              << std::string(104, '-') << std::endl;
+
+    int failures = 0;
+    for (auto &layer : layerCases()) {
+        try {
+            std::vector<std::string> impls = layer.extension ? std::vector<std::string>{""}
+                                                             : supportedImplementations(layer);
+            for (auto &impl : impls) {
+                if (!options.isa.empty() && !layer.extension && impl.find(options.isa) == std::string::npos)
+                    continue;
+                std::string name = layer.type + "/" + layer.name + "/" + (impl.empty() ? "unknown" : impl);
+                if (!options.filter.empty() && name.find(options.filter) == std::string::npos)
+                    continue;
+
+                LayerGraph layerGraph(layer, impl);
+                // the priority is a preference, the node falls back to another implementation for the layouts
+                // the requested one does not support
+                if (!impl.empty() && layerGraph.implementation() != impl)
+                    continue;
+
+                size_t iterations = 0;
+                double us = layerGraph.measure(options.minTime, iterations);
+                double bytes = sizeof(float) * (layer.weights + layer.biases + elements(layer.output));
+                for (auto &input : layer.inputs)
+                    bytes += sizeof(float) * elements(input);
+
+                std::cout << std::left << std::setw(64) << name << std::right << std::fixed << std::setprecision(1)
+                          << std::setw(12) << us << std::setw(12) << iterations << std::setprecision(2)
+                          << std::setw(8);
+                if (layer.flops > 0)
+                    std::cout << layer.flops / us / 1e3;
+                else
+                    std::cout << "-";
+                std::cout << std::setw(8) << bytes / us / 1e3 << std::endl;
+            }
+        } catch (const std::exception &e) {
+            std::cerr << layer.type << "/" << layer.name << " failed: " << e.what() << std::endl;
+            failures++;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
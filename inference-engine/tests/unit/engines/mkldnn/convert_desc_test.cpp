@@ -133,3 +133,51 @@ INSTANTIATE_TEST_CASE_P(
 //                TD2mkldnn_test_params{{1, 16, 8, 8}, mkldnn::memory::format::oIhw8i},
 //                TD2mkldnn_test_params{{1, 3, 8, 8}, mkldnn::memory::format::OhIw16o4i}
         ));
+
+struct ROI2mkldnn_test_params {
+    std::vector<size_t> frame_dims;
+    InferenceEngine::Layout layout;
+    InferenceEngine::ROI roi;
+};
+
+class ROIDesc2MKLDNNConvertTests: public TestsCommon,
+                                  public WithParamInterface<ROI2mkldnn_test_params> {
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            ROI2mkldnn_test_params p = ::testing::WithParamInterface<ROI2mkldnn_test_params>::GetParam();
+
+            InferenceEngine::Blob::Ptr frame = InferenceEngine::make_shared_blob<float>(
+                    InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, p.frame_dims, p.layout));
+            frame->allocate();
+            InferenceEngine::Blob::Ptr roi = InferenceEngine::make_shared_blob(frame, p.roi);
+            const InferenceEngine::TensorDesc &tDesc = roi->getTensorDesc();
+            ASSERT_FALSE(MKLDNNPlugin::MKLDNNMemory::IsDenseDesc(tDesc));
+            ASSERT_TRUE(MKLDNNPlugin::MKLDNNMemory::IsDenseDesc(frame->getTensorDesc()));
+
+            MKLDNNPlugin::MKLDNNMemoryDesc desc(tDesc);
+            mkldnn::impl::memory_desc_wrapper dst_d(((mkldnn::memory::desc&)desc).data);
+
+            for (size_t i = 0; i < roi->size(); i++) {
+                ASSERT_EQ(tDesc.offset(i), dst_d.off_l(i));
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(ROIDesc2MKLDNNConvertTests, TestsConvertation) {}
+
+
+INSTANTIATE_TEST_CASE_P(
+        TestsConvertation, ROIDesc2MKLDNNConvertTests,
+        ::testing::Values(
+                ROI2mkldnn_test_params{{1, 3, 16, 20}, InferenceEngine::NCHW, {0, 2, 3, 8, 5}},
+                ROI2mkldnn_test_params{{1, 3, 16, 20}, InferenceEngine::NHWC, {0, 2, 3, 8, 5}},
+                ROI2mkldnn_test_params{{1, 3, 16, 20}, InferenceEngine::NHWC, {0, 0, 0, 20, 7}}
+        ));
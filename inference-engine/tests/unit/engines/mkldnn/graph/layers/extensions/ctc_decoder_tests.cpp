@@ -0,0 +1,224 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+
+using namespace ::testing;
+using namespace std;
+
+struct ctc_decoder_test_params {
+    std::string type;
+
+    size_t T;
+    size_t N;
+    size_t C;
+
+    int merge_repeated;
+
+    // [T, N, C], the last class is the blank
+    std::vector<float> probabilities;
+    // [T, N], the second input is left out when empty
+    std::vector<float> indicators;
+    // [N, T] padded with -1
+    std::vector<float> reference;
+};
+
+// Two equal maxima per time step, one of them past the vector registers: the first one is taken like the scalar
+// loop does, the non-maximal classes differ so that the reductions have something to compare
+static std::vector<float> tied_probabilities(size_t C, const std::vector<std::pair<int, int>>& ties) {
+    std::vector<float> probabilities(ties.size() * C);
+    for (size_t t = 0; t < ties.size(); t++) {
+        for (size_t c = 0; c < C; c++)
+            probabilities[t * C + c] = 0.01f * (c % 7);
+        probabilities[t * C + ties[t].first] = 0.5f;
+        probabilities[t * C + ties[t].second] = 0.5f;
+    }
+    return probabilities;
+}
+
+class MKLDNNCPUExtCTCDecoderTests: public TestsCommon, public WithParamInterface<ctc_decoder_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="CTCDecoder_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+        </layer>_IN2_
+        <layer name="decoder" id="2" type="_TYPE_" precision="FP32">
+            <data beam_width="10" merge_repeated="_MR_" ctc_merge_repeated="_MR_"/>
+            <input>
+                <port id="1">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                    <dim>_C_</dim>
+                </port>_PORT2_
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_N_</dim>
+                    <dim>_T_</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>_EDGE2_
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string in2_t = R"V0G0N(
+        <layer name="in2" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+
+    std::string port2_t = R"V0G0N(
+                <port id="2">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                </port>)V0G0N";
+
+    std::string edge2_t = R"V0G0N(
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="2"/>)V0G0N";
+
+    std::string getModel(ctc_decoder_test_params p) {
+        std::string model = model_t;
+        bool indicators = !p.indicators.empty();
+        REPLACE_WITH_STR(model, "_IN2_", indicators ? in2_t : "");
+        REPLACE_WITH_STR(model, "_PORT2_", indicators ? port2_t : "");
+        REPLACE_WITH_STR(model, "_EDGE2_", indicators ? edge2_t : "");
+
+        REPLACE_WITH_STR(model, "_TYPE_", p.type);
+        REPLACE_WITH_NUM(model, "_T_", p.T);
+        REPLACE_WITH_NUM(model, "_N_", p.N);
+        REPLACE_WITH_NUM(model, "_C_", p.C);
+        REPLACE_WITH_NUM(model, "_MR_", p.merge_repeated);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            ctc_decoder_test_params p = ::testing::WithParamInterface<ctc_decoder_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            InferenceEngine::InputsDataMap in;
+            in = net_reader.getNetwork().getInputsInfo();
+
+            InferenceEngine::BlobMap srcs;
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(in["in1"]->getTensorDesc());
+            src->allocate();
+            ASSERT_EQ(p.probabilities.size(), src->size());
+            std::copy(p.probabilities.begin(), p.probabilities.end(), src->buffer().as<float *>());
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            if (!p.indicators.empty()) {
+                InferenceEngine::Blob::Ptr ind = InferenceEngine::make_shared_blob<float>(in["in2"]->getTensorDesc());
+                ind->allocate();
+                ASSERT_EQ(p.indicators.size(), ind->size());
+                std::copy(p.indicators.begin(), p.indicators.end(), ind->buffer().as<float *>());
+                srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in2", ind));
+            }
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            ASSERT_EQ(p.reference.size(), output->size());
+            const float *dst = output->buffer().as<const float *>();
+            for (size_t i = 0; i < p.reference.size(); i++)
+                ASSERT_EQ(p.reference[i], dst[i]) << "i = " << i;
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtCTCDecoderTests, TestsCTCDecoder) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsCTCDecoder, MKLDNNCPUExtCTCDecoderTests,
+        ::testing::Values(
+                // the class 0 at 0.4 against the blank at 0.6: the greedy path is the blanks only, the beam search
+                // sums the paths of "0" (0.64 against 0.36)
+                ctc_decoder_test_params{"CTCGreedyDecoder", 2, 1, 2, 1, {0.4f, 0.6f, 0.4f, 0.6f}, {},
+                                        {-1, -1}},
+                ctc_decoder_test_params{"CTCBeamSearchDecoder", 2, 1, 2, 1, {0.4f, 0.6f, 0.4f, 0.6f}, {},
+                                        {0, -1}},
+                // the class 0 at 0.8 twice: one label merged (0.96), two without the merge (0.64 against 0.32)
+                ctc_decoder_test_params{"CTCBeamSearchDecoder", 2, 1, 2, 1, {0.8f, 0.2f, 0.8f, 0.2f}, {},
+                                        {0, -1}},
+                ctc_decoder_test_params{"CTCBeamSearchDecoder", 2, 1, 2, 0, {0.8f, 0.2f, 0.8f, 0.2f}, {},
+                                        {0, 0}},
+                // the blank between the repeated classes keeps both of them
+                ctc_decoder_test_params{"CTCBeamSearchDecoder", 3, 1, 3, 1,
+                                        {0.9f, 0.05f, 0.05f, 0.05f, 0.05f, 0.9f, 0.9f, 0.05f, 0.05f}, {},
+                                        {0, 0, -1}},
+                // the second sequence ends before its third step, whose class is not decoded
+                ctc_decoder_test_params{"CTCGreedyDecoder", 3, 2, 3, 1,
+                                        {0.7f, 0.2f, 0.1f,  0.1f, 0.8f, 0.1f,
+                                         0.1f, 0.8f, 0.1f,  0.7f, 0.2f, 0.1f,
+                                         0.1f, 0.1f, 0.8f,  0.1f, 0.8f, 0.1f},
+                                        {0, 0, 1, 1, 1, 0},
+                                        {0, 1, -1, 1, 0, -1}},
+                ctc_decoder_test_params{"CTCBeamSearchDecoder", 3, 2, 3, 1,
+                                        {0.7f, 0.2f, 0.1f,  0.1f, 0.8f, 0.1f,
+                                         0.1f, 0.8f, 0.1f,  0.7f, 0.2f, 0.1f,
+                                         0.1f, 0.1f, 0.8f,  0.1f, 0.8f, 0.1f},
+                                        {0, 0, 1, 1, 1, 0},
+                                        {0, 1, -1, 1, 0, -1}},
+                // the first of the equal maxima: within the vector part, across it and the tail, in the tail
+                // only and against the blank
+                ctc_decoder_test_params{"CTCGreedyDecoder", 4, 1, 37, 1,
+                                        tied_probabilities(37, {{20, 5}, {33, 17}, {35, 34}, {36, 3}}), {},
+                                        {5, 17, 34, 3}},
+                ctc_decoder_test_params{"CTCGreedyDecoder", 4, 1, 9, 1,
+                                        tied_probabilities(9, {{6, 2}, {8, 7}, {4, 1}, {0, 5}}), {},
+                                        {2, 7, 1, 0}}));
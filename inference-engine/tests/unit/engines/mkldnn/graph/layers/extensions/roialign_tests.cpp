@@ -0,0 +1,287 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include <cfloat>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct roialign_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    std::vector<float> rois;
+
+    size_t pooled_h;
+    size_t pooled_w;
+    float spatial_scale;
+    int sampling_ratio;
+    std::string method;
+
+    bool isBlockedFormat;
+};
+
+static float ref_bilinear(const float *src, int H, int W, float y, float x) {
+    if (y < -1.0f || y > H || x < -1.0f || x > W)
+        return 0.0f;
+    y = std::max(y, 0.0f);
+    x = std::max(x, 0.0f);
+    int y_low = std::min(static_cast<int>(y), H - 1);
+    int x_low = std::min(static_cast<int>(x), W - 1);
+    int y_high = std::min(y_low + 1, H - 1);
+    int x_high = std::min(x_low + 1, W - 1);
+    float ly = y_low == H - 1 ? 0.0f : y - y_low;
+    float lx = x_low == W - 1 ? 0.0f : x - x_low;
+    return (1 - ly) * (1 - lx) * src[y_low * W + x_low] + (1 - ly) * lx * src[y_low * W + x_high] +
+           ly * (1 - lx) * src[y_high * W + x_low] + ly * lx * src[y_high * W + x_high];
+}
+
+void ref_roialign(const InferenceEngine::TBlob<float> &src, InferenceEngine::TBlob<float> &dst, roialign_test_params prm) {
+    const float *src_data = src.readOnly();
+    float *dst_data = dst.data();
+
+    int C = prm.in.c;
+    int H = prm.in.h;
+    int W = prm.in.w;
+    int PH = prm.pooled_h;
+    int PW = prm.pooled_w;
+    int R = prm.rois.size() / 5;
+
+    std::fill_n(dst_data, dst.size(), 0.0f);
+    for (int n = 0; n < R; n++) {
+        const float *roi = &prm.rois[n * 5];
+        if (static_cast<int>(roi[0]) == -1)
+            break;
+        float start_w = roi[1] * prm.spatial_scale;
+        float start_h = roi[2] * prm.spatial_scale;
+        float roi_w = std::max(roi[3] * prm.spatial_scale - start_w, 1.0f);
+        float roi_h = std::max(roi[4] * prm.spatial_scale - start_h, 1.0f);
+        float bin_h = roi_h / PH;
+        float bin_w = roi_w / PW;
+        int grid_h = prm.sampling_ratio > 0 ? prm.sampling_ratio : static_cast<int>(std::ceil(bin_h));
+        int grid_w = prm.sampling_ratio > 0 ? prm.sampling_ratio : static_cast<int>(std::ceil(bin_w));
+
+        for (int c = 0; c < C; c++) {
+            const float *src_c = src_data + (static_cast<int>(roi[0]) * C + c) * H * W;
+            for (int ph = 0; ph < PH; ph++) {
+                for (int pw = 0; pw < PW; pw++) {
+                    float acc = prm.method == "max" ? -FLT_MAX : 0.0f;
+                    for (int iy = 0; iy < grid_h; iy++) {
+                        for (int ix = 0; ix < grid_w; ix++) {
+                            float y = start_h + ph * bin_h + (iy + 0.5f) * bin_h / grid_h;
+                            float x = start_w + pw * bin_w + (ix + 0.5f) * bin_w / grid_w;
+                            float value = ref_bilinear(src_c, H, W, y, x);
+                            acc = prm.method == "max" ? std::max(acc, value) : acc + value;
+                        }
+                    }
+                    dst_data[((n * C + c) * PH + ph) * PW + pw] =
+                            prm.method == "max" ? acc : acc / (grid_h * grid_w);
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtROIAlignTests: public TestsCommon, public WithParamInterface<roialign_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="ROIAlign_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_R_</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fakeLayer" id="2" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="roialign" id="3" type="ROIAlign" precision="FP32">
+            <data pooled_h="_PH_" pooled_w="_PW_" spatial_scale="_SS_" sampling_ratio="_SR_" method="_M_"/>
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+                <port id="4">
+                    <dim>_R_</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5">
+                    <dim>_R_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_PH_</dim>
+                    <dim>_PW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="3"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="4"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(roialign_test_params p) {
+        std::string model = model_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+        REPLACE_WITH_NUM(model, "_R_", p.rois.size() / 5);
+
+        REPLACE_WITH_NUM(model, "_PH_", p.pooled_h);
+        REPLACE_WITH_NUM(model, "_PW_", p.pooled_w);
+        REPLACE_WITH_NUM(model, "_SS_", p.spatial_scale);
+        REPLACE_WITH_NUM(model, "_SR_", p.sampling_ratio);
+        REPLACE_WITH_STR(model, "_M_", p.method);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            roialign_test_params p = ::testing::WithParamInterface<roialign_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            auto& nodes = graph.getNodes();
+            for (auto &node : nodes) {
+                if (node->getName() == "roialign") {
+                    ASSERT_EQ(2, node->getSupportedPrimitiveDescriptors().size());
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    // the blocked input is pooled as is
+                    ASSERT_EQ(p.isBlockedFormat ? InferenceEngine::Layout::BLOCKED : InferenceEngine::Layout::NCHW,
+                              node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout());
+                }
+            }
+
+            InferenceEngine::SizeVector dims_src = {p.in.w, p.in.h, p.in.c, p.in.n};
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::SizeVector dims_rois = {5, p.rois.size() / 5};
+            InferenceEngine::Blob::Ptr rois = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NC, dims_rois);
+            rois->allocate();
+            std::copy(p.rois.begin(), p.rois.end(), rois->buffer().as<float *>());
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in2", rois));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_roialign(*srcPtr, dst_ref, p);
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtROIAlignTests, TestsROIAlign) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsROIAlign, MKLDNNCPUExtROIAlignTests,
+        ::testing::Values(
+                roialign_test_params{{2, 20, 15, 17}, {0, 1, 2, 20, 24, 1, 0.5, 3.5, 9, 12, 1, -4, -3, 40, 40},
+                                     7, 7, 0.5f, 2, "avg", false},
+                roialign_test_params{{2, 20, 15, 17}, {0, 1, 2, 20, 24, 1, 0.5, 3.5, 9, 12, 1, -4, -3, 40, 40},
+                                     7, 7, 0.5f, 2, "avg", true},
+                roialign_test_params{{1, 19, 16, 16}, {0, 0, 0, 15, 15, 0, 5, 5, 6, 6, -1, 0, 0, 0, 0},
+                                     4, 3, 1.0f, 0, "avg", false},
+                roialign_test_params{{1, 19, 16, 16}, {0, 0, 0, 15, 15, 0, 5, 5, 6, 6, -1, 0, 0, 0, 0},
+                                     4, 3, 1.0f, 0, "avg", true},
+                roialign_test_params{{1, 8, 10, 12}, {0, 1.5, 2.5, 9, 8, 0, 0, 0, 12, 10},
+                                     2, 2, 1.0f, 0, "max", false},
+                roialign_test_params{{1, 8, 10, 12}, {0, 1.5, 2.5, 9, 8, 0, 0, 0, 12, 10},
+                                     2, 2, 1.0f, 0, "max", true}));
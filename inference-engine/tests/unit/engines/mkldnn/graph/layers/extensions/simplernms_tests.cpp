@@ -0,0 +1,152 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+
+using namespace ::testing;
+using namespace std;
+
+class MKLDNNCPUExtSimplerNMSTests: public TestsCommon {
+protected:
+    std::string model = R"V0G0N(
+<Net Name="SimplerNMS_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>18</dim>
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>36</dim>
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in3" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="proposal" id="3" type="SimplerNMS" precision="FP32">
+            <data cls_threshold="0.500000" max_num_proposals="300" iou_threshold="0.7"
+            min_bbox_size="1" feat_stride="16" pre_nms_topn="10" post_nms_topn="4"
+            scale="8.000000,16.000000,32.000000"/>
+
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>18</dim>
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>36</dim>
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="3"/>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="4"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="5"/>
+    </edges>
+</Net>
+)V0G0N";
+};
+
+// Two proposals of the same score overlap above the IoU threshold: the one of the lower index survives.
+// Both come from the first anchor (ratio 0.5, scale 8, -84 -40 99 55 at the first location) with zero deltas,
+// the second one is shifted by the feature stride, so the boxes are (0, 0, 100, 56) and (0, 0, 116, 56)
+// after the decoding and the clipping and their IoU is 101 / 117.
+TEST_F(MKLDNNCPUExtSimplerNMSTests, TestsSimplerNMSKeepsLowerIndexOnTies) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+    extMgr->AddExtension(cpuExt);
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+    // the foreground score of the first anchor at both locations, the other proposals score zero and are dropped
+    InferenceEngine::Blob::Ptr cls = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
+            InferenceEngine::Precision::FP32, InferenceEngine::NCHW, {2, 1, 18, 1});
+    cls->allocate();
+    float *cls_data = cls->buffer().as<float *>();
+    std::fill_n(cls_data, cls->size(), 0.0f);
+    cls_data[2 * 9 + 0] = 0.9f;
+    cls_data[2 * 9 + 1] = 0.9f;
+
+    InferenceEngine::Blob::Ptr delta = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
+            InferenceEngine::Precision::FP32, InferenceEngine::NCHW, {2, 1, 36, 1});
+    delta->allocate();
+    std::fill_n(delta->buffer().as<float *>(), delta->size(), 0.0f);
+
+    InferenceEngine::Blob::Ptr info = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
+            InferenceEngine::Precision::FP32, InferenceEngine::NC, {3, 1});
+    info->allocate();
+    float *info_data = info->buffer().as<float *>();
+    info_data[0] = 1000.0f;
+    info_data[1] = 1000.0f;
+    info_data[2] = 1.0f;
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", cls));
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in2", delta));
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in3", info));
+
+    InferenceEngine::OutputsDataMap out;
+    out = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::BlobMap outputBlobs;
+
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output;
+    output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    const float expected[] = {0.0f, 0.0f, 0.0f, 100.0f, 56.0f};
+    const float *dst = output->buffer().as<const float *>();
+    for (int i = 0; i < 5; i++)
+        ASSERT_FLOAT_EQ(expected[i], dst[i]) << "i = " << i;
+}
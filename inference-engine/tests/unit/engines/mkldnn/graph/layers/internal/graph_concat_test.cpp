@@ -371,7 +371,7 @@ INSTANTIATE_TEST_CASE_P(
                 concat_test_params {
                         {1, 7, 2, 5},
                         {1, 7, 2, 5},
-                        2, 1, MKLDNNPlugin::impl_desc_type::ref
+                        2, 2, MKLDNNPlugin::impl_desc_type::unknown
                 },
                 concat_test_params {
                         {1, 7, 2, 5},
@@ -386,7 +386,7 @@ INSTANTIATE_TEST_CASE_P(
                 concat_test_params {
                         {1, 7, 2, 13},
                         {1, 7, 2, 17},
-                        3, 1, MKLDNNPlugin::impl_desc_type::ref
+                        3, 2, MKLDNNPlugin::impl_desc_type::unknown
                 },
                 concat_test_params {
                         {1, 8, 8, 16},
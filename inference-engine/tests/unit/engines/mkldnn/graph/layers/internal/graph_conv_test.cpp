@@ -355,6 +355,9 @@ protected:
 
             graph.checkDynBatch(srcs, outputBlobs, MB, MB, checkConvolution, MKLDNNGraphTestClass::CheckDynBatchType::Child);
             graph.checkDynBatch(srcs, outputBlobs, 1, MB, checkConvolution, MKLDNNGraphTestClass::CheckDynBatchType::Child);
+            // the primitives of the batches processed before are reused
+            graph.checkDynBatch(srcs, outputBlobs, MB, MB, checkConvolution, MKLDNNGraphTestClass::CheckDynBatchType::Child);
+            graph.checkDynBatch(srcs, outputBlobs, 1, MB, checkConvolution, MKLDNNGraphTestClass::CheckDynBatchType::Child);
         } catch (const InferenceEngine::details::InferenceEngineException &e) {
             FAIL() << e.what();
         }
@@ -389,3 +392,103 @@ INSTANTIATE_TEST_CASE_P(
                 },
                 conv_test_params{{1, 9, 32, 16},
                                  2, 4, 1, 1, 0, 0, 17, 1, 5, MKLDNNPlugin::impl_desc_type::ref_any, {MKLDNNPlugin::impl_desc_type::ref_any} }));
+
+class MKLDNNGraphInt8ConvolutionTests: public MKLDNNGraphConvolutionTests {
+protected:
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            conv_test_params p = ::testing::WithParamInterface<conv_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t weightsSize = p.krn_w * p.krn_h * p.out_c * p.in.c / p.grp_c;
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C,
+                    {(weightsSize + p.out_c) * sizeof(float)});
+            weights->allocate();
+            // the small integer values keep the accumulators in the range of the int8 output
+            float *weightsData = weights->buffer().as<float *>();
+            for (size_t i = 0; i < weightsSize + p.out_c; i++) {
+                weightsData[i] = static_cast<float>(static_cast<int>(i % 3) - 1);
+            }
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            // the convolution is brought to the form produced by the int8 normalizer with unit scales
+            InferenceEngine::CNNLayerPtr layer = net_reader.getNetwork().getLayerByName("conv1");
+            auto *convLayer = dynamic_cast<InferenceEngine::ConvolutionLayer *>(layer.get());
+            ASSERT_NE(nullptr, convLayer);
+            convLayer->precision = InferenceEngine::Precision::I8;
+
+            auto int8Weights = InferenceEngine::make_shared_blob<int8_t>(InferenceEngine::Precision::I8, InferenceEngine::C, {weightsSize});
+            int8Weights->allocate();
+            for (size_t i = 0; i < weightsSize; i++) {
+                int8Weights->data()[i] = static_cast<int8_t>(weightsData[i]);
+            }
+            auto int32Biases = InferenceEngine::make_shared_blob<int32_t>(InferenceEngine::Precision::I32, InferenceEngine::C, {p.out_c});
+            int32Biases->allocate();
+            for (size_t i = 0; i < p.out_c; i++) {
+                int32Biases->data()[i] = static_cast<int32_t>(weightsData[weightsSize + i]);
+            }
+            auto wScale = InferenceEngine::make_shared_blob<float>(InferenceEngine::Precision::FP32, InferenceEngine::C, {p.out_c});
+            wScale->allocate();
+            std::fill_n(wScale->buffer().as<float *>(), p.out_c, 1.f);
+
+            convLayer->_weights = convLayer->blobs["weights"] = int8Weights;
+            convLayer->_biases = convLayer->blobs["biases"] = int32Biases;
+            convLayer->blobs["w-scale"] = wScale;
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+            float *srcData = src->buffer().as<float *>();
+            for (size_t i = 0; i < src->size(); i++) {
+                srcData[i] = static_cast<float>(i % 4);
+            }
+
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_conv(*srcPtr, weightsData, weightsSize + p.out_c, dst_ref, p);
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphInt8ConvolutionTests, TestsInt8Convolution) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestInt8Convolution, MKLDNNGraphInt8ConvolutionTests,
+        ::testing::Values(
+                conv_test_params{{1, 3, 16, 16},
+                                 3, 3, 1, 1, 1, 1, 16, 1, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                conv_test_params{{1, 16, 8, 8},
+                                 1, 1, 1, 1, 0, 0, 32, 1, 1, MKLDNNPlugin::impl_desc_type::unknown }));
@@ -235,15 +235,20 @@ TEST_P(MKLDNNGraphCropTests, TestCrop) {}
 INSTANTIATE_TEST_CASE_P(
         TestCrop, MKLDNNGraphCropTests,
         ::testing::Values(
-                crop_test_params{{1, 5, 32, 32}, {1, 2, 3}, {2, 5, 4}, {2, 23, 23}, 1, MKLDNNPlugin::impl_desc_type::unknown, {
+                crop_test_params{{1, 5, 32, 32}, {1, 2, 3}, {2, 5, 4}, {2, 23, 23}, 2, MKLDNNPlugin::impl_desc_type::unknown, {
                         [](MKLDNNPlugin::PrimitiveDescInfo impl) {
                             ASSERT_EQ(MKLDNNPlugin::impl_desc_type::unknown, impl.getImplementationType());
                             ASSERT_EQ(1, impl.getConfig().inConfs.size());
                             ASSERT_EQ(1, impl.getConfig().outConfs.size());
+                            ASSERT_EQ(0, impl.getConfig().outConfs.at(0).inPlace);
                             ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().inConfs.at(0).desc.getLayout());
                             ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().outConfs.at(0).desc.getLayout());
+                        },
+                        [](MKLDNNPlugin::PrimitiveDescInfo impl) {
+                            ASSERT_EQ(MKLDNNPlugin::impl_desc_type::unknown, impl.getImplementationType());
+                            ASSERT_EQ(-1, impl.getConfig().outConfs.at(0).inPlace);
                         }}},
-                crop_test_params{{3, 8, 32, 32}, {0, 1, 2, 3}, {1, 0, 20, 20}, {2, 8, 5, 5}, 2, MKLDNNPlugin::impl_desc_type::unknown, {
+                crop_test_params{{3, 8, 32, 32}, {0, 1, 2, 3}, {1, 0, 20, 20}, {2, 8, 5, 5}, 4, MKLDNNPlugin::impl_desc_type::unknown, {
                         [](MKLDNNPlugin::PrimitiveDescInfo impl) {
                             ASSERT_EQ(MKLDNNPlugin::impl_desc_type::unknown, impl.getImplementationType());
                             ASSERT_EQ(1, impl.getConfig().inConfs.size());
@@ -251,8 +256,10 @@ INSTANTIATE_TEST_CASE_P(
                             ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().inConfs.at(0).desc.getLayout());
                             ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().outConfs.at(0).desc.getLayout());
                         }} },
-                crop_test_params{{1, 5, 32, 32}, {3}, {10}, {20}, 1, MKLDNNPlugin::impl_desc_type::unknown },
-                crop_test_params{{1, 5, 32, 20}, {2, 3}, {30, 10}, {2, 10}, 1, MKLDNNPlugin::impl_desc_type::unknown }));
+                crop_test_params{{1, 5, 32, 32}, {3}, {10}, {20}, 2, MKLDNNPlugin::impl_desc_type::unknown },
+                crop_test_params{{1, 5, 32, 20}, {2, 3}, {30, 10}, {2, 10}, 2, MKLDNNPlugin::impl_desc_type::unknown },
+                // the channels are cropped inside the block, so only the plain format may be a view
+                crop_test_params{{1, 16, 8, 8}, {1}, {4}, {8}, 3, MKLDNNPlugin::impl_desc_type::unknown }));
 
 class MKLDNNGraphDynBatchCropTests: public MKLDNNGraphCropTests {
 protected:
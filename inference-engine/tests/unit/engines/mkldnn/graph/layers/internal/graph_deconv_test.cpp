@@ -291,7 +291,10 @@ INSTANTIATE_TEST_CASE_P(
                 deconv_test_params{{2, 8, 5, 5}, 4, 4, 2, 2, 1, 1, 8, 2, 3, {MKLDNNPlugin::impl_desc_type::gemm}},
                 deconv_test_params{{2, 8, 5, 5}, 4, 4, 2, 2, 1, 1, 8, 8, 4, {MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::_dw}},
                 deconv_test_params{{2, 8, 5, 5}, 8, 8, 4, 4, 1, 1, 8, 8, 4, {MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::_dw}},
-                deconv_test_params{{2, 8, 5, 5}, 4, 8, 2, 4, 1, 1, 8, 8, 4, {MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::_dw}}
+                deconv_test_params{{2, 8, 5, 5}, 4, 8, 2, 4, 1, 1, 8, 8, 4, {MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::_dw}},
+                deconv_test_params{{2, 16, 7, 9}, 4, 4, 2, 2, 1, 1, 16, 1, 3, {MKLDNNPlugin::impl_desc_type::gemm_subpixel}},
+                deconv_test_params{{1, 8, 5, 4}, 3, 3, 2, 2, 0, 0, 8, 1, 3, {MKLDNNPlugin::impl_desc_type::gemm_subpixel}},
+                deconv_test_params{{1, 3, 6, 6}, 2, 2, 2, 2, 0, 0, 5, 1, 1, {MKLDNNPlugin::impl_desc_type::gemm_subpixel}}
         ));
 
 class MKLDNNGraphDynBatchDeconvolutionalTests: public MKLDNNGraphDeconvolutionalTests {
@@ -375,5 +378,6 @@ INSTANTIATE_TEST_CASE_P(
                 deconv_test_params{{2, 8, 5, 5}, 4, 4, 2, 2, 1, 1, 8, 2, 3, {MKLDNNPlugin::impl_desc_type::gemm}},
                 deconv_test_params{{2, 8, 5, 5}, 4, 4, 2, 2, 1, 1, 8, 8, 4, {MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::_dw}},
                 deconv_test_params{{2, 8, 5, 5}, 8, 8, 4, 4, 1, 1, 8, 8, 4, {MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::_dw}},
-                deconv_test_params{{2, 8, 5, 5}, 4, 8, 2, 4, 1, 1, 8, 8, 4, {MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::_dw}}
+                deconv_test_params{{2, 8, 5, 5}, 4, 8, 2, 4, 1, 1, 8, 8, 4, {MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::_dw}},
+                deconv_test_params{{2, 16, 7, 9}, 4, 4, 2, 2, 1, 1, 16, 1, 3, {MKLDNNPlugin::impl_desc_type::gemm_subpixel}}
         ));
@@ -304,3 +304,78 @@ INSTANTIATE_TEST_CASE_P(
                 fc_test_params{{1, 3, 227, 227}, 96, 6, MKLDNNPlugin::impl_desc_type::ref, {MKLDNNPlugin::impl_desc_type::ref_any}},
                 fc_test_params{{1, 4, 227, 227}, 8, 6, MKLDNNPlugin::impl_desc_type::ref, {MKLDNNPlugin::impl_desc_type::ref_any}},
                 fc_test_params{{1, 4, 227, 227}, 10, 6, MKLDNNPlugin::impl_desc_type::ref, {MKLDNNPlugin::impl_desc_type::ref_any}}));
+
+class MKLDNNGraphSparseFullyConnectedTests: public MKLDNNGraphFullyConnectedTests {
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            fc_test_params p = ::testing::WithParamInterface<fc_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t weightsSize = p.in.w * p.in.h * p.in.c * p.out_c;
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {(weightsSize + p.out_c) * sizeof(float)});
+            weights->allocate();
+            fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+            // the pruned weights: one of 8 weights is kept
+            float *weightsData = (float *) weights->buffer();
+            for (size_t i = 0; i < weightsSize; i++) {
+                if (i % 8 != 3)
+                    weightsData[i] = 0.0f;
+            }
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+            auto& nodes = graph.getNodes();
+            for (int i = 0; i < nodes.size(); i++) {
+                if (nodes[i]->getType() == MKLDNNPlugin::FullyConnected) {
+                    ASSERT_NE(nullptr, nodes[i]->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.selectedType, nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType() & p.selectedType);
+                }
+            }
+
+            InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+            InferenceEngine::TBlob<float>* srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_innerproduct(*srcPtr, (const float *)weights->buffer(), weights->size() / sizeof(float), dst_ref, p);
+
+            compare(*output, dst_ref, 0.9f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphSparseFullyConnectedTests, TestsSparseFullyConnected) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsSparseFullyConnected, MKLDNNGraphSparseFullyConnectedTests,
+        ::testing::Values(
+                fc_test_params{{1, 3, 227, 227}, 96, 7, MKLDNNPlugin::impl_desc_type::sparse_sse42 },
+                fc_test_params{{3, 4, 13, 11}, 10, 7, MKLDNNPlugin::impl_desc_type::sparse_sse42 },
+                fc_test_params{{2, 4, 13, 11}, 10, 7, MKLDNNPlugin::impl_desc_type::ref, {MKLDNNPlugin::impl_desc_type::ref_any}}));
@@ -0,0 +1,419 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct gemm_test_params {
+    InferenceEngine::SizeVector a;
+    InferenceEngine::SizeVector b;
+    // no third input when empty
+    InferenceEngine::SizeVector c;
+
+    bool transpose_a;
+    bool transpose_b;
+    float alpha;
+    float beta;
+
+    InferenceEngine::SizeVector out;
+};
+
+// the offset of the element of the output index in the input broadcast to the output, the dimensions are
+// aligned to the innermost ones
+static size_t broadcast_offset(const InferenceEngine::SizeVector &dims, const InferenceEngine::SizeVector &idx) {
+    size_t offset = 0;
+    size_t shift = idx.size() - dims.size();
+    for (size_t d = 0; d < dims.size(); d++)
+        offset = offset * dims[d] + (dims[d] == 1 ? 0 : idx[d + shift]);
+    return offset;
+}
+
+void ref_gemm(const float *A, const float *B, const float *C, float *dst, const gemm_test_params &p) {
+    size_t rank = p.out.size();
+    size_t K = p.transpose_a ? p.a[p.a.size() - 2] : p.a.back();
+
+    size_t total = 1;
+    for (auto dim : p.out)
+        total *= dim;
+
+    InferenceEngine::SizeVector idx(rank);
+    for (size_t i = 0; i < total; i++) {
+        size_t rest = i;
+        for (size_t d = rank; d-- > 0;) {
+            idx[d] = rest % p.out[d];
+            rest /= p.out[d];
+        }
+        size_t m = idx[rank - 2];
+        size_t n = idx[rank - 1];
+
+        float sum = 0.f;
+        InferenceEngine::SizeVector idxA(idx), idxB(idx);
+        for (size_t k = 0; k < K; k++) {
+            idxA[rank - 2] = p.transpose_a ? k : m;
+            idxA[rank - 1] = p.transpose_a ? m : k;
+            idxB[rank - 2] = p.transpose_b ? n : k;
+            idxB[rank - 1] = p.transpose_b ? k : n;
+            sum += A[broadcast_offset(p.a, idxA)] * B[broadcast_offset(p.b, idxB)];
+        }
+        dst[i] = p.alpha * sum + (C ? p.beta * C[broadcast_offset(p.c, idx)] : 0.f);
+    }
+}
+
+static std::string dims_to_xml(const InferenceEngine::SizeVector &dims) {
+    std::string xml;
+    for (auto dim : dims)
+        xml += "<dim>" + std::to_string(dim) + "</dim>\n";
+    return xml;
+}
+
+class MKLDNNGraphGemmTests: public TestsCommon,
+                            public WithParamInterface<gemm_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="Gemm_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    __A_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    __B_DIMS__
+                </port>
+            </output>
+        </layer>__C_INPUT__
+        <layer name="gemm" id="3" type="Gemm" precision="FP32">
+            <data alpha="_ALPHA_" beta="_BETA_" transpose_a="_TA_" transpose_b="_TB_"/>
+            <input>
+                <port id="1">
+                    __A_DIMS__
+                </port>
+                <port id="2">
+                    __B_DIMS__
+                </port>__C_PORT__
+            </input>
+            <output>
+                <port id="4">
+                    __OUT_DIMS__
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="2"/>__C_EDGE__
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string c_input_t = R"V0G0N(
+        <layer name="in3" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    __C_DIMS__
+                </port>
+            </output>
+        </layer>)V0G0N";
+
+    std::string c_port_t = R"V0G0N(
+                <port id="3">
+                    __C_DIMS__
+                </port>)V0G0N";
+
+    std::string c_edge_t = R"V0G0N(
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="3"/>)V0G0N";
+
+protected:
+    std::string getModel(gemm_test_params p) {
+        std::string model = model_t;
+        bool hasC = !p.c.empty();
+        REPLACE_WITH_STR(model, "__C_INPUT__", hasC ? c_input_t : "");
+        REPLACE_WITH_STR(model, "__C_PORT__", hasC ? c_port_t : "");
+        REPLACE_WITH_STR(model, "__C_EDGE__", hasC ? c_edge_t : "");
+
+        REPLACE_WITH_STR(model, "__A_DIMS__", dims_to_xml(p.a));
+        REPLACE_WITH_STR(model, "__B_DIMS__", dims_to_xml(p.b));
+        REPLACE_WITH_STR(model, "__C_DIMS__", dims_to_xml(p.c));
+        REPLACE_WITH_STR(model, "__OUT_DIMS__", dims_to_xml(p.out));
+
+        REPLACE_WITH_NUM(model, "_ALPHA_", p.alpha);
+        REPLACE_WITH_NUM(model, "_BETA_", p.beta);
+        REPLACE_WITH_STR(model, "_TA_", p.transpose_a ? "true" : "false");
+        REPLACE_WITH_STR(model, "_TB_", p.transpose_b ? "true" : "false");
+
+        return model;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            gemm_test_params p = ::testing::WithParamInterface<gemm_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+            auto& nodes = graph.getNodes();
+            for (int i = 0; i < nodes.size(); i++) {
+                if (nodes[i]->getType() == MKLDNNPlugin::Gemm) {
+                    ASSERT_EQ(1, nodes[i]->getSupportedPrimitiveDescriptors().size());
+                    ASSERT_NE(nullptr, nodes[i]->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(MKLDNNPlugin::impl_desc_type::gemm_any,
+                              nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
+                }
+            }
+
+            InferenceEngine::BlobMap srcs;
+            std::vector<InferenceEngine::Blob::Ptr> inputs;
+            std::vector<InferenceEngine::SizeVector> dims = {p.a, p.b};
+            if (!p.c.empty())
+                dims.push_back(p.c);
+            for (size_t i = 0; i < dims.size(); i++) {
+                InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims[i], InferenceEngine::TensorDesc::getLayoutByDims(dims[i])});
+                src->allocate();
+                fill_data(src->buffer(), src->size());
+                srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in" + std::to_string(i + 1), src));
+                inputs.push_back(src);
+            }
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_gemm(inputs[0]->buffer().as<const float *>(), inputs[1]->buffer().as<const float *>(),
+                     p.c.empty() ? nullptr : inputs[2]->buffer().as<const float *>(), dst_ref.data(), p);
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphGemmTests, TestsGemm) {}
+
+
+INSTANTIATE_TEST_CASE_P(
+        TestsGemm, MKLDNNGraphGemmTests,
+        ::testing::Values(
+                gemm_test_params{{3, 4}, {4, 5}, {}, false, false, 1.f, 1.f, {3, 5}},
+                gemm_test_params{{4, 3}, {4, 5}, {}, true, false, 0.5f, 1.f, {3, 5}},
+                gemm_test_params{{2, 3, 4}, {2, 5, 4}, {}, false, true, 1.f, 1.f, {2, 3, 5}},
+                gemm_test_params{{2, 4, 3}, {2, 5, 4}, {}, true, true, 2.f, 1.f, {2, 3, 5}},
+                // the batch dimensions of 1 and the missing ones are broadcast
+                gemm_test_params{{2, 3, 3, 4}, {1, 3, 4, 5}, {}, false, false, 1.f, 1.f, {2, 3, 3, 5}},
+                gemm_test_params{{3, 4}, {2, 4, 5}, {}, false, false, 1.f, 1.f, {2, 3, 5}},
+                // the third input scaled by beta, full and broadcast
+                gemm_test_params{{2, 3, 4}, {2, 4, 5}, {2, 3, 5}, false, false, 1.f, 0.5f, {2, 3, 5}},
+                gemm_test_params{{2, 4, 3}, {2, 4, 5}, {1, 5}, true, false, 0.25f, 2.f, {2, 3, 5}},
+                gemm_test_params{{2, 3, 4}, {2, 4, 5}, {3, 5}, false, false, 1.f, 0.f, {2, 3, 5}}));
+
+
+class MKLDNNGraphGemmFusionTests: public TestsCommon {
+protected:
+    // the attention pattern: the Permute of the keys, the product scaled by the Power and the transposed output
+    std::string model = R"V0G0N(
+<Net Name="Gemm_Fusion" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>4</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="permute_in" id="2" type="Permute" precision="FP32">
+            <data order="0,1,3,2"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>4</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="gemm" id="3" type="Gemm" precision="FP32">
+            <data alpha="1" beta="1" transpose_a="false" transpose_b="false"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale" id="4" type="Power" precision="FP32">
+            <power_data power="1" scale="0.5" shift="0"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="permute_out" id="5" type="Permute" precision="FP32">
+            <data order="0,1,3,2"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="1"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="2"/>
+        <edge from-layer="3" from-port="3" to-layer="4" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="5" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+};
+
+TEST_F(MKLDNNGraphGemmFusionTests, TestsGemmFusesTransposesAndScale) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    size_t gemms = 0;
+    for (auto &node : graph.getNodes()) {
+        ASSERT_NE(MKLDNNPlugin::Permute, node->getType()) << node->getName();
+        ASSERT_NE(MKLDNNPlugin::Power, node->getType()) << node->getName();
+        if (node->getType() == MKLDNNPlugin::Gemm)
+            gemms++;
+    }
+    ASSERT_EQ(1, gemms);
+
+    InferenceEngine::SizeVector dimsA = {1, 2, 4, 3};
+    InferenceEngine::SizeVector dimsB = {1, 2, 4, 5};
+    InferenceEngine::Blob::Ptr srcA = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dimsA, InferenceEngine::NCHW});
+    srcA->allocate();
+    fill_data(srcA->buffer(), srcA->size());
+    InferenceEngine::Blob::Ptr srcB = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dimsB, InferenceEngine::NCHW});
+    srcB->allocate();
+    fill_data(srcB->buffer(), srcB->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", srcA));
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in2", srcB));
+
+    InferenceEngine::OutputsDataMap out;
+    out = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::BlobMap outputBlobs;
+
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output;
+    output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    // 0.5 * in1^T * in2 transposed
+    gemm_test_params p = {dimsA, dimsB, {}, true, false, 0.5f, 1.f, {1, 2, 3, 5}};
+    std::vector<float> product(2 * 3 * 5);
+    ref_gemm(srcA->buffer().as<const float *>(), srcB->buffer().as<const float *>(), nullptr, product.data(), p);
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+    float *ref = dst_ref.data();
+    for (size_t b = 0; b < 2; b++)
+        for (size_t n = 0; n < 5; n++)
+            for (size_t m = 0; m < 3; m++)
+                ref[(b * 5 + n) * 3 + m] = product[(b * 3 + m) * 5 + n];
+    compare(*output, dst_ref);
+}
@@ -21,7 +21,7 @@ public:
     MKLDNNTestExecNetwork(InferenceEngine::ICNNNetwork &network, const MKLDNNPlugin::Config &cfg)
             : MKLDNNExecNetwork(network, cfg, {}) {}
     MKLDNNPlugin::MKLDNNGraph& getGraph() {
-        return *graph;
+        return *(graphs[0]);
     }
 };
 
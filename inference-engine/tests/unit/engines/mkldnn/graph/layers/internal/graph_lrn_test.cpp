@@ -210,7 +210,7 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Values(
                 lrn_test_params{
                         {1, 3, 228, 228},
-                        5, 0.0001f, 0.75f, 1, 3, MKLDNNPlugin::impl_desc_type::ref_any, {
+                        5, 0.0001f, 0.75f, 1, 3, MKLDNNPlugin::impl_desc_type::unknown, {
                                 [](MKLDNNPlugin::PrimitiveDescInfo impl) {
                                     ASSERT_EQ(MKLDNNPlugin::impl_desc_type::ref_any, impl.getImplementationType());
                                     ASSERT_EQ(1, impl.getConfig().inConfs.size());
@@ -233,7 +233,9 @@ INSTANTIATE_TEST_CASE_P(
                                     ASSERT_EQ(InferenceEngine::Layout::BLOCKED, impl.getConfig().outConfs.at(0).desc.getLayout());
                                 }
                         }},
-                lrn_test_params{{1, 16, 228, 228}, 5, 0.0001f, 0.75f, 1, 3, MKLDNNPlugin::impl_desc_type::jit}));
+                lrn_test_params{{1, 16, 228, 228}, 5, 0.0001f, 0.75f, 1, 3, MKLDNNPlugin::impl_desc_type::unknown},
+                lrn_test_params{{1, 24, 27, 27}, 3, 0.0001f, 0.75f, 1, 3, MKLDNNPlugin::impl_desc_type::unknown},
+                lrn_test_params{{1, 20, 13, 13}, 7, 0.001f, 0.5f, 1, 3, MKLDNNPlugin::impl_desc_type::unknown}));
 
 class MKLDNNGraphDynBatchLrnTests: public MKLDNNGraphLrnTests {
 protected:
@@ -301,4 +303,5 @@ INSTANTIATE_TEST_CASE_P(
         TestsDynBatchLrn, MKLDNNGraphDynBatchLrnTests,
         ::testing::Values(
                 lrn_test_params{{1, 3, 228, 228}, 5, 0.0001f, 0.75f, 1, 3, MKLDNNPlugin::impl_desc_type::ref_any},
-                lrn_test_params{{1, 16, 228, 228}, 5, 0.0001f, 0.75f, 1, 3, MKLDNNPlugin::impl_desc_type::jit}));
+                lrn_test_params{{1, 16, 228, 228}, 5, 0.0001f, 0.75f, 1, 3, MKLDNNPlugin::impl_desc_type::jit},
+                lrn_test_params{{1, 24, 27, 27}, 3, 0.0001f, 0.75f, 1, 3, MKLDNNPlugin::impl_desc_type::unknown}));
@@ -176,7 +176,7 @@ INSTANTIATE_TEST_CASE_P(
         TestsPermute, MKLDNNGraphPermuteTests,
         ::testing::Values(
                 permute_test_params{{2, 3, 4, 5}, {0, 1, 2, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown},
-                permute_test_params{{2, 3, 4, 5}, {0, 2, 3, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 3, 4, 5}, {0, 2, 3, 1}, 2, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 3, 4, 5}, {3, 0, 1, 2}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 3, 4, 5}, {1, 3, 2, 0}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 3, 4, 5}, {3, 2, 1, 0}, 1, MKLDNNPlugin::impl_desc_type::unknown},
@@ -195,7 +195,12 @@ INSTANTIATE_TEST_CASE_P(
                 permute_test_params{{2, 3, 4, 5, 6}, {0, 3, 2, 4, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 8, 2, 2, 4, 5}, {0, 1, 4, 2, 5, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 8, 3, 3, 4, 5}, {0, 1, 4, 2, 5, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown},
-                permute_test_params{{2, 8, 3, 4}, {3, 0, 1, 2}, 2, MKLDNNPlugin::impl_desc_type::unknown}
+                permute_test_params{{2, 8, 3, 4}, {3, 0, 1, 2}, 2, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{1, 16, 19, 19}, {0, 2, 3, 1}, 4, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 24, 7, 9}, {0, 2, 3, 1}, 3, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{3, 37, 41}, {0, 2, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 16, 1, 1}, {0, 2, 3, 1}, 3, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 5, 1, 7}, {0, 2, 1, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown}
         ));
 
 class MKLDNNGraphDynBatchPermuteTests: public MKLDNNGraphPermuteTests {
@@ -263,7 +268,7 @@ INSTANTIATE_TEST_CASE_P(
         TestsDynBatchPermute, MKLDNNGraphDynBatchPermuteTests,
         ::testing::Values(
                 permute_test_params{{2, 3, 4, 5}, {0, 1, 2, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown},
-                permute_test_params{{2, 3, 4, 5}, {0, 2, 3, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 3, 4, 5}, {0, 2, 3, 1}, 2, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 3, 4, 5}, {0, 2, 1, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 3, 4}, {0, 1, 2}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 3, 4}, {0, 2, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
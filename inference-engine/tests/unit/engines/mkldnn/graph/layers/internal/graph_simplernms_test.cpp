@@ -126,7 +126,7 @@ inline void sort_and_keep_at_most_top_n(std::vector<simpler_nms_proposal_t<data_
     const auto cmp_fn = [](const simpler_nms_proposal_t<data_t>& a,
                            const simpler_nms_proposal_t<data_t>& b)
     {
-        return a.confidence > b.confidence || (a.confidence == b.confidence && a.ord > b.ord);
+        return a.confidence > b.confidence || (a.confidence == b.confidence && a.ord < b.ord);
     };
 
     if (proposals.size() > top_n) {
@@ -98,7 +98,7 @@ void check_softmax_fwd(const InferenceEngine::TBlob<data_t> &src, softmax_test_p
                     double result = 0.0f;
 
                     for (int h = 0; h < H; ++h) {
-                        result += src_data[off(n, c, w, w)];//dst_ptr[map_index(dst_pd, off(n, c, h, w))];
+                        result += src_data[off(n, c, h, w)];//dst_ptr[map_index(dst_pd, off(n, c, h, w))];
                     }
 
                     check_norm(result);
@@ -139,7 +139,7 @@ class MKLDNNGraphSoftMaxTests: public TestsCommon,
             </output>
         </layer>
         <layer name="norm" id="1" type="Softmax" precision="FP32">
-            <data PrimitivesPriority="_IMPLS_"/>
+            <data axis="_AX_" PrimitivesPriority="_IMPLS_"/>
             <input>
                 <port id="1">
                     <dim>_IN_</dim>
@@ -172,6 +172,7 @@ protected:
         REPLACE_WITH_NUM(model, "_IH_", p.in.h);
         REPLACE_WITH_NUM(model, "_IC_", p.in.c);
         REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+        REPLACE_WITH_NUM(model, "_AX_", p.axis);
         std::string impls;
         for (const auto& preferType : p.preferTypes) {
             if (!impls.empty())
@@ -250,7 +251,142 @@ INSTANTIATE_TEST_CASE_P(
         TestsSoftMax, MKLDNNGraphSoftMaxTests,
         ::testing::Values(
                 softmax_test_params{{1, 3, 228, 228}, 1, 3, MKLDNNPlugin::impl_desc_type::jit},
-                softmax_test_params{{1, 3, 228, 228}, 1, 3, MKLDNNPlugin::impl_desc_type::ref, {MKLDNNPlugin::impl_desc_type::ref_any}}));
+                softmax_test_params{{1, 3, 228, 228}, 1, 3, MKLDNNPlugin::impl_desc_type::ref, {MKLDNNPlugin::impl_desc_type::ref_any}},
+                softmax_test_params{{1, 3, 20, 91}, 3, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                softmax_test_params{{1, 1001, 1, 1}, 1, 1, MKLDNNPlugin::impl_desc_type::unknown}));
+
+class MKLDNNGraphBlockedSoftMaxTests: public TestsCommon,
+                                      public WithParamInterface<softmax_test_params> {
+    // the pooling writes the blocked layout
+    std::string model_t = R"V0G0N(
+<Net Name="Softmax_Blocked" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pool" id="1" type="Pooling" precision="FP32">
+            <pooling stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" method="MAX" round="Ceil"/>
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="softmax" id="2" type="Softmax" precision="FP32">
+            <data axis="_AX_"/>
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</Net>
+)V0G0N";
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            softmax_test_params p = ::testing::WithParamInterface<softmax_test_params>::GetParam();
+            std::string model = model_t;
+            REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+            REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+            REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+            REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+            REPLACE_WITH_NUM(model, "_AX_", p.axis);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+            auto& nodes = graph.getNodes();
+            for (int i = 0; i < nodes.size(); i++) {
+                if (nodes[i]->getType() == MKLDNNPlugin::SoftMax) {
+                    ASSERT_LE(p.num_prim_desc, nodes[i]->getSupportedPrimitiveDescriptors().size());
+                    ASSERT_NE(nullptr, nodes[i]->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.selectedType, nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
+                    // the blocked output of the pooling is normalized as is
+                    ASSERT_EQ(InferenceEngine::Layout::BLOCKED,
+                              nodes[i]->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout());
+                }
+            }
+
+            InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            check_softmax_fwd(*output, p);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphBlockedSoftMaxTests, TestsBlockedSoftMax) {}
+
+
+INSTANTIATE_TEST_CASE_P(
+        TestsBlockedSoftMax, MKLDNNGraphBlockedSoftMaxTests,
+        ::testing::Values(
+                softmax_test_params{{1, 32, 17, 19}, 1, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                softmax_test_params{{1, 16, 17, 19}, 2, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                softmax_test_params{{1, 16, 17, 19}, 3, 1, MKLDNNPlugin::impl_desc_type::unknown}));
 
 class MKLDNNGraphDynBatchSoftMaxTests: public MKLDNNGraphSoftMaxTests {
 protected:
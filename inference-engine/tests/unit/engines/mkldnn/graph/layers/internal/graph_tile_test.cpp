@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
 #include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/nodes/mkldnn_tile_node.h"
 #include "mock_mkldnn_primitive.hpp"
 
 #include "test_graph.hpp"
@@ -280,3 +281,177 @@ INSTANTIATE_TEST_CASE_P(
                                     ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().outConfs.at(0).desc.getLayout());
                                 }
                         }}));
+
+class MKLDNNGraphTileEltwiseTests: public TestsCommon,
+                                   public WithParamInterface<tile_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="Tile_Eltwise" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_ON_</dim>
+                    <dim>_OC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="tile" id="2" type="Tile" precision="FP32">
+            <data axis="_AX_" tiles="_TL_"/>
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_ON_</dim>
+                    <dim>_OC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="prod" id="3" type="Eltwise" precision="FP32">
+            <elementwise_data operation="prod"/>
+            <input>
+                <port id="1">
+                    <dim>_ON_</dim>
+                    <dim>_OC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+                <port id="2">
+                    <dim>_ON_</dim>
+                    <dim>_OC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_ON_</dim>
+                    <dim>_OC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="2"/>
+    </edges>
+</Net>
+)V0G0N";
+
+protected:
+    std::string getModel(tile_test_params p) {
+        std::string model = model_t;
+
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_OW_", (p.axis == 3) ? p.in.w*p.tiles : p.in.w);
+        REPLACE_WITH_NUM(model, "_OH_", (p.axis == 2) ? p.in.h*p.tiles : p.in.h);
+        REPLACE_WITH_NUM(model, "_OC_", (p.axis == 1) ? p.in.c*p.tiles : p.in.c);
+        REPLACE_WITH_NUM(model, "_ON_", (p.axis == 0) ? p.in.n*p.tiles : p.in.n);
+
+        REPLACE_WITH_NUM(model, "_AX_", p.axis);
+        REPLACE_WITH_NUM(model, "_TL_", p.tiles);
+
+        return model;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            tile_test_params p = ::testing::WithParamInterface<tile_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+            auto& nodes = graph.getNodes();
+            for (int i = 0; i < nodes.size(); i++) {
+                if (nodes[i]->getType() == MKLDNNPlugin::Tile) {
+                    auto tile = std::dynamic_pointer_cast<MKLDNNPlugin::MKLDNNTileNode>(nodes[i]);
+                    ASSERT_NE(nullptr, tile);
+                    ASSERT_TRUE(tile->isBroadcastView());
+                }
+            }
+
+            InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+            InferenceEngine::TBlob<float>* srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr src2 = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            src2->allocate();
+            fill_data(src2->buffer(), src2->size());
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in2", src2));
+
+            InferenceEngine::BlobMap outputBlobs;
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_tile(*srcPtr, dst_ref, p);
+            float *ref = dst_ref.data();
+            const float *in2 = src2->readOnly();
+            for (size_t i = 0; i < dst_ref.size(); i++)
+                ref[i] *= in2[i];
+
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphTileEltwiseTests, TestsTileEltwise) {}
+
+
+INSTANTIATE_TEST_CASE_P(
+        TestsTileEltwise, MKLDNNGraphTileEltwiseTests,
+        ::testing::Values(
+                tile_test_params{{2, 8, 1, 1}, 3, 24, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                tile_test_params{{2, 1, 5, 7}, 1, 16, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                tile_test_params{{1, 3, 2, 20}, 2, 4, 1, MKLDNNPlugin::impl_desc_type::unknown}));
@@ -445,3 +445,720 @@ TEST_F(MKLDNNGraphOptimizationTests, TestNoFuseCustomActivation) {
     }
     ASSERT_FALSE(fused);
 }
+
+TEST_F(MKLDNNGraphOptimizationTests, TestFuseConvScaleShiftAndFullyConnectedReLU) {
+    std::string model = R"V0G0N(
+<net name="ConvScaleShiftFC" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="3" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+            <weights offset="0" size="36"/>
+        </layer>
+        <layer name="scale1" type="ScaleShift" precision="FP32" id="2">
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+            <weights offset="36" size="12"/>
+            <biases offset="48" size="12"/>
+        </layer>
+        <layer name="fc1" type="FullyConnected" precision="FP32" id="3">
+            <fc_data out-size="4"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="60" size="1200"/>
+            <biases offset="1260" size="16"/>
+        </layer>
+        <layer name="relu1" type="ReLU" precision="FP32" id="4">
+            <input>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>
+    </edges>
+</net>
+
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {1276});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    auto& nodes = graph.getNodes();
+    for (auto &node : nodes) {
+        ASSERT_NE(MKLDNNPlugin::Depthwise, node->getType());
+        ASSERT_NE(MKLDNNPlugin::Activation, node->getType());
+    }
+}
+
+TEST_F(MKLDNNGraphOptimizationTests, TestFoldBatchNormAndScaleShiftIntoDeconvolution) {
+    std::string model = R"V0G0N(
+<net name="DeconvBatchNormScaleShift" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="deconv1" type="Deconvolution" precision="FP32" id="1">
+            <deconvolution_data stride-x="2" stride-y="2" pad-x="0" pad-y="0" kernel-x="2" kernel-y="2" output="3" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="144"/>
+            <biases offset="144" size="12"/>
+        </layer>
+        <layer name="bn1" type="BatchNormalization" precision="FP32" id="2">
+            <batch_norm_data epsilon="1e-05"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="156" size="12"/>
+            <biases offset="168" size="12"/>
+        </layer>
+        <layer name="scale1" type="ScaleShift" precision="FP32" id="3">
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="180" size="12"/>
+            <biases offset="192" size="12"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {204});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    auto& nodes = graph.getNodes();
+    for (auto &node : nodes) {
+        ASSERT_NE(MKLDNNPlugin::Depthwise, node->getType());
+        ASSERT_NE(MKLDNNPlugin::BatchNormalization, node->getType());
+    }
+}
+
+TEST_F(MKLDNNGraphOptimizationTests, TestFuseElementwiseChain) {
+    std::string model = R"V0G0N(
+<net name="ElementwiseChain" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale" type="ScaleShift" precision="FP32" id="1">
+            <input>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+            <weights offset="0" size="64"/>
+            <biases offset="64" size="64"/>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="2">
+            <data negative_slope="0.5"/>
+            <input>
+                <port id="3">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="3">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="5">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {128});
+    weights->allocate();
+    float *weightsData = (float *) weights->buffer();
+    for (size_t c = 0; c < 16; c++) {
+        weightsData[c] = c % 2 ? 1.5f : -1.0f;
+        weightsData[16 + c] = 0.25f * c;
+    }
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    size_t chains = 0;
+    auto& nodes = graph.getNodes();
+    for (auto &node : nodes) {
+        ASSERT_NE(MKLDNNPlugin::Depthwise, node->getType());
+        ASSERT_NE(MKLDNNPlugin::Activation, node->getType());
+        ASSERT_NE(MKLDNNPlugin::Power, node->getType());
+        if (node->getType() == MKLDNNPlugin::EltwiseChain)
+            chains++;
+    }
+    ASSERT_EQ(1, chains);
+
+    InferenceEngine::SizeVector dims = {2, 16, 5, 7};
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::BlobMap outputBlobs;
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+    const float *srcData = src->cbuffer().as<const float *>();
+    float *refData = dst_ref.data();
+    for (size_t i = 0; i < dst_ref.size(); i++) {
+        size_t c = (i / (5 * 7)) % 16;
+        float value = srcData[i] * weightsData[c] + weightsData[16 + c];
+        value = value > 0 ? value : value * 0.5f;
+        refData[i] = value * 2.0f + 1.0f;
+    }
+
+    compare(*output, dst_ref);
+}
+
+TEST_F(MKLDNNGraphOptimizationTests, TestFuseInvertedResidual) {
+    std::string model = R"V0G0N(
+<net name="InvertedResidual" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="expand" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="64" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </output>
+            <weights offset="0" size="2048"/>
+            <biases offset="2048" size="256"/>
+        </layer>
+        <layer name="expand_relu6" type="Clamp" precision="FP32" id="2">
+            <data min="0" max="6"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="dw" type="Convolution" precision="FP32" id="3">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="64" group="64"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </output>
+            <weights offset="2304" size="2304"/>
+            <biases offset="4608" size="256"/>
+        </layer>
+        <layer name="dw_relu" type="ReLU" precision="FP32" id="4">
+            <input>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="project" type="Convolution" precision="FP32" id="5">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="8" group="1"/>
+            <input>
+                <port id="9">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </input>
+            <output>
+                <port id="10">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </output>
+            <weights offset="4864" size="2048"/>
+            <biases offset="6912" size="32"/>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="6">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="11">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+                <port id="12">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </input>
+            <output>
+                <port id="13">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>128</dim>
+                    <dim>128</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>
+        <edge from-layer="4" from-port="8" to-layer="5" to-port="9"/>
+        <edge from-layer="5" from-port="10" to-layer="6" to-port="11"/>
+        <edge from-layer="0" from-port="0" to-layer="6" to-port="12"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    // the expanded tensor (64x128x128) does not fit in L2, so the block is fused
+    const size_t C = 8, CE = 64, H = 128, W = 128;
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {6944});
+    weights->allocate();
+    float *weightsData = (float *) weights->buffer();
+    for (size_t i = 0; i < 6944 / sizeof(float); i++)
+        weightsData[i] = ((i * 37) % 19) / 19.0f - 0.45f;
+    const float *expandWeights = weightsData, *expandBiases = expandWeights + CE * C;
+    const float *dwWeights = expandBiases + CE, *dwBiases = dwWeights + CE * 9;
+    const float *projectWeights = dwBiases + CE, *projectBiases = projectWeights + C * CE;
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    size_t blocks = 0;
+    auto& nodes = graph.getNodes();
+    for (auto &node : nodes) {
+        ASSERT_NE(MKLDNNPlugin::Convolution, node->getType());
+        ASSERT_NE(MKLDNNPlugin::Convolution_Activation, node->getType());
+        ASSERT_NE(MKLDNNPlugin::Eltwise, node->getType());
+        if (node->getType() == MKLDNNPlugin::InvertedResidual)
+            blocks++;
+    }
+    ASSERT_EQ(1, blocks);
+
+    InferenceEngine::SizeVector dims = {1, C, H, W};
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::BlobMap outputBlobs;
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    const float *srcData = src->cbuffer().as<const float *>();
+    std::vector<float> expanded(CE * H * W), filtered(CE * H * W);
+    for (size_t c = 0; c < CE; c++) {
+        for (size_t p = 0; p < H * W; p++) {
+            float value = expandBiases[c];
+            for (size_t k = 0; k < C; k++)
+                value += expandWeights[c * C + k] * srcData[k * H * W + p];
+            expanded[c * H * W + p] = std::min(std::max(value, 0.0f), 6.0f);
+        }
+    }
+    for (size_t c = 0; c < CE; c++) {
+        for (int h = 0; h < static_cast<int>(H); h++) {
+            for (int w = 0; w < static_cast<int>(W); w++) {
+                float value = dwBiases[c];
+                for (int kh = 0; kh < 3; kh++) {
+                    for (int kw = 0; kw < 3; kw++) {
+                        int ih = h + kh - 1, iw = w + kw - 1;
+                        if (ih >= 0 && ih < static_cast<int>(H) && iw >= 0 && iw < static_cast<int>(W))
+                            value += dwWeights[c * 9 + kh * 3 + kw] * expanded[(c * H + ih) * W + iw];
+                    }
+                }
+                filtered[(c * H + h) * W + w] = std::max(value, 0.0f);
+            }
+        }
+    }
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+    float *refData = dst_ref.data();
+    for (size_t c = 0; c < C; c++) {
+        for (size_t p = 0; p < H * W; p++) {
+            float value = projectBiases[c] + srcData[c * H * W + p];
+            for (size_t k = 0; k < CE; k++)
+                value += projectWeights[c * CE + k] * filtered[k * H * W + p];
+            refData[c * H * W + p] = value;
+        }
+    }
+
+    compare(*output, dst_ref);
+}
+
+TEST_F(MKLDNNGraphOptimizationTests, TestFusePoolingAndActivation) {
+    std::string model = R"V0G0N(
+<net name="PoolingReLU" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>6</dim>
+                    <dim>6</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pool1" type="Pooling" precision="FP32" id="1">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" pool-method="avg" exclude-pad="true"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>6</dim>
+                    <dim>6</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>3</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu1" type="ReLU" precision="FP32" id="2">
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>3</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>3</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    auto& nodes = graph.getNodes();
+    for (auto &node : nodes) {
+        ASSERT_NE(MKLDNNPlugin::Activation, node->getType());
+        if (node->getType() == MKLDNNPlugin::Pooling)
+            ASSERT_EQ(1, node->getFusedWith().size());
+    }
+
+    InferenceEngine::SizeVector dims = {1, 8, 6, 6};
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims);
+    src->allocate();
+    float *srcData = src->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++)
+        srcData[i] = static_cast<float>(i % 7) - 3.0f;
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::BlobMap outputBlobs;
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+    float *refData = dst_ref.data();
+    for (size_t c = 0; c < 8; c++) {
+        for (size_t h = 0; h < 3; h++) {
+            for (size_t w = 0; w < 3; w++) {
+                float sum = 0.0f;
+                for (size_t kh = 0; kh < 2; kh++)
+                    for (size_t kw = 0; kw < 2; kw++)
+                        sum += srcData[(c * 6 + h * 2 + kh) * 6 + w * 2 + kw];
+                refData[(c * 3 + h) * 3 + w] = std::max(sum / 4.0f, 0.0f);
+            }
+        }
+    }
+
+    compare(*output, dst_ref);
+}
@@ -6,6 +6,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
 #include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_plugin.h"
+#include "mkldnn_plugin/nodes/mkldnn_memory_node.hpp"
 #include "mock_mkldnn_primitive.hpp"
 
 #include "single_layer_common.hpp"
@@ -3897,6 +3899,117 @@ TEST_F(MKLDNNGraphStructureTests, TestNoRedundantReordersForGrayscaleInput) {
     ASSERT_EQ(reorders_num, 1);
 }
 
+TEST_F(MKLDNNGraphStructureTests, TestSharedReorderForConsumersOfSameLayout) {
+    std::string model = R"V0G0N(
+<net batch="1" name="shared_reorder" version="2">
+	<layers>
+		<layer id="1" name="data" precision="FP32" type="Input">
+			<output>
+				<port id="1">
+					<dim>1</dim>
+					<dim>1</dim>
+					<dim>40</dim>
+					<dim>40</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="2" name="conv1" precision="FP32" type="Convolution">
+			<data dilation-x="1" dilation-y="1" group="1" kernel-x="3" kernel-y="3" output="32" pad-x="0" pad-y="0" stride-x="1" stride-y="1"/>
+			<input>
+				<port id="2">
+					<dim>1</dim>
+					<dim>1</dim>
+					<dim>40</dim>
+					<dim>40</dim>
+				</port>
+			</input>
+			<output>
+				<port id="3">
+					<dim>1</dim>
+					<dim>32</dim>
+					<dim>38</dim>
+					<dim>38</dim>
+				</port>
+			</output>
+			<weights offset="0" size="1152"/>
+			<biases offset="1152" size="128"/>
+		</layer>
+		<layer id="3" name="prob1" precision="FP32" type="SoftMax">
+			<data axis="1"/>
+			<input>
+				<port id="4">
+					<dim>1</dim>
+					<dim>32</dim>
+					<dim>38</dim>
+					<dim>38</dim>
+				</port>
+			</input>
+			<output>
+				<port id="5">
+					<dim>1</dim>
+					<dim>32</dim>
+					<dim>38</dim>
+					<dim>38</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="4" name="prob2" precision="FP32" type="SoftMax">
+			<data axis="1"/>
+			<input>
+				<port id="6">
+					<dim>1</dim>
+					<dim>32</dim>
+					<dim>38</dim>
+					<dim>38</dim>
+				</port>
+			</input>
+			<output>
+				<port id="7">
+					<dim>1</dim>
+					<dim>32</dim>
+					<dim>38</dim>
+					<dim>38</dim>
+				</port>
+			</output>
+		</layer>
+	</layers>
+	<edges>
+		<edge from-layer="1" from-port="1" to-layer="2" to-port="2"/>
+		<edge from-layer="2" from-port="3" to-layer="3" to-port="4"/>
+		<edge from-layer="2" from-port="3" to-layer="4" to-port="6"/>
+	</edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {1280});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    // the consumers reading the output of the convolution in the same layout share a reorder of it
+    std::vector<MKLDNNPlugin::MKLDNNNodePtr> reorders;
+    auto& nodes = graph.getNodes();
+    for (auto &node : nodes) {
+        if (node->getType() != MKLDNNPlugin::Reorder)
+            continue;
+        for (auto &reorder : reorders) {
+            ASSERT_FALSE(reorder->getParentEdgeAt(0)->getParent() == node->getParentEdgeAt(0)->getParent() &&
+                         reorder->getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].desc ==
+                         node->getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].desc);
+        }
+        reorders.push_back(node);
+    }
+}
+
+
 TEST_F(MKLDNNGraphStructureTests, TestFailedPartPlateRecognitionBarrier0001) {
     std::string model = R"V0G0N(
 <net name="net" version="2" batch="1">
@@ -5579,4 +5692,644 @@ TEST_F(MKLDNNGraphStructureTests, TestRefPoolingWithConcat) {
 
     graphInfer(net_reader.getNetwork(), inputBlobs, outputBlobs2, "cpu:ref_any");
     compare(*outputBlobs1.begin()->second, *outputBlobs2.begin()->second);
-}
\ No newline at end of file
+}
+TEST_F(MKLDNNGraphStructureTests, TestThroughputStreamsInfer) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::Config cfg;
+    cfg.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}});
+    ASSERT_EQ(2, cfg.throughputStreams);
+
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), cfg, {}));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    std::pair<std::string, InferenceEngine::DataPtr> item = *net_reader.getNetwork().getOutputsInfo().begin();
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 2, 2}, InferenceEngine::NCHW);
+    InferenceEngine::ResponseDesc resp;
+
+    const size_t requestsNum = 4;
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(requestsNum);
+    std::vector<InferenceEngine::Blob::Ptr> srcs(requestsNum);
+    std::vector<InferenceEngine::TBlob<float>::Ptr> outputs(requestsNum);
+    for (size_t i = 0; i < requestsNum; i++) {
+        execNetwork->CreateInferRequest(requests[i]);
+
+        srcs[i] = InferenceEngine::make_shared_blob<float>(desc);
+        srcs[i]->allocate();
+        float *src_data = srcs[i]->buffer();
+        for (size_t j = 0; j < srcs[i]->size(); j++)
+            src_data[j] = static_cast<float>(i * srcs[i]->size() + j);
+
+        outputs[i] = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        outputs[i]->allocate();
+
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->SetBlob("data", srcs[i], &resp)) << resp.msg;
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->SetBlob(item.first.c_str(), outputs[i], &resp)) << resp.msg;
+    }
+
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->StartAsync(&resp)) << resp.msg;
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+
+    for (size_t i = 0; i < requestsNum; i++) {
+        const float *src_data = srcs[i]->buffer();
+        const float *dst_data = outputs[i]->buffer();
+        for (size_t j = 0; j < outputs[i]->size(); j++)
+            ASSERT_FLOAT_EQ(2.f * src_data[j], dst_data[j]);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestParallelBranchesInfer) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power2" type="Power" precision="FP32" id="2">
+            <power_data power="1" scale="3" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="3">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                        InferenceEngine::PluginConfigParams::YES}});
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = src;
+
+    std::pair<std::string, InferenceEngine::DataPtr> item = *net_reader.getNetwork().getOutputsInfo().begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    const float *src_data = src->buffer();
+    const float *dst_data = output->buffer();
+    for (size_t i = 0; i < output->size(); i++)
+        ASSERT_NEAR(5.f * src_data[i], dst_data[i], 1e-5f);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestOutputBlobWithOtherLayout) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 5}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = src;
+
+    // the graph produces NCHW data, so it has to be reordered to the NHWC blob
+    std::pair<std::string, InferenceEngine::DataPtr> item = *net_reader.getNetwork().getOutputsInfo().begin();
+    InferenceEngine::TensorDesc outDesc(InferenceEngine::Precision::FP32, {1, 3, 4, 5}, InferenceEngine::NHWC);
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(outDesc);
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    const float *src_data = src->buffer();
+    const float *dst_data = output->buffer();
+    const size_t C = 3, H = 4, W = 5;
+    for (size_t c = 0; c < C; c++)
+        for (size_t h = 0; h < H; h++)
+            for (size_t w = 0; w < W; w++)
+                ASSERT_NEAR(2.f * src_data[(c * H + h) * W + w], dst_data[(h * W + w) * C + c], 1e-5f);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestExportImportNetwork) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="2" group="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="0" size="24"/>
+            <biases offset="24" size="8"/>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="2">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {32});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    auto plugin = std::make_shared<MKLDNNPlugin::Engine>();
+    InferenceEngine::IExecutableNetwork::Ptr loadedNetwork;
+    ASSERT_NO_THROW(plugin->LoadNetwork(loadedNetwork, net_reader.getNetwork(), {}));
+
+    const std::string fileName = "mkldnn_exported_network.blob";
+    InferenceEngine::ResponseDesc resp;
+    ASSERT_EQ(InferenceEngine::OK, loadedNetwork->Export(fileName, &resp)) << resp.msg;
+
+    InferenceEngine::IExecutableNetwork::Ptr importedNetwork;
+    ASSERT_NO_THROW(importedNetwork = plugin->ImportNetwork(fileName, {}));
+    std::remove(fileName.c_str());
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    auto infer = [&](InferenceEngine::IExecutableNetwork::Ptr &network, InferenceEngine::Blob::Ptr &output) {
+        InferenceEngine::IInferRequest::Ptr request;
+        ASSERT_EQ(InferenceEngine::OK, network->CreateInferRequest(request, &resp)) << resp.msg;
+        ASSERT_EQ(InferenceEngine::OK, request->SetBlob("data", src, &resp)) << resp.msg;
+        ASSERT_EQ(InferenceEngine::OK, request->Infer(&resp)) << resp.msg;
+        ASSERT_EQ(InferenceEngine::OK, request->GetBlob("relu", output, &resp)) << resp.msg;
+    };
+
+    InferenceEngine::Blob::Ptr refOutput, output;
+    infer(loadedNetwork, refOutput);
+    infer(importedNetwork, output);
+
+    ASSERT_EQ(refOutput->size(), output->size());
+    const float *ref_data = refOutput->buffer();
+    const float *dst_data = output->buffer();
+    for (size_t i = 0; i < output->size(); i++)
+        ASSERT_FLOAT_EQ(ref_data[i], dst_data[i]);
+}
+
+namespace {
+// the output accumulates the inputs, the state is the sum of the input and the previous state
+const std::string accumulatorModel = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="state_read" type="Memory" precision="FP32" id="1">
+            <data id="state" index="1" size="2"/>
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="2">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="out" type="Power" precision="FP32" id="3">
+            <power_data power="1" scale="1" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="new_state" type="Power" precision="FP32" id="4">
+            <power_data power="1" scale="1" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="state_write" type="Memory" precision="FP32" id="5">
+            <data id="state" index="0" size="2"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="4" from-port="1" to-layer="5" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+}  // namespace
+
+TEST_F(MKLDNNGraphStructureTests, TestMemoryStatesAreSwapped) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(accumulatorModel.data(), accumulatorModel.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    size_t swappingNodes = 0;
+    for (auto &node : graph.getNodes()) {
+        auto memoryOutput = std::dynamic_pointer_cast<MKLDNNPlugin::MKLDNNMemoryOutputNode>(node);
+        if (memoryOutput && memoryOutput->swapsStates())
+            swappingNodes++;
+    }
+    ASSERT_EQ(1, swappingNodes);
+
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 4},
+                                                                               InferenceEngine::NC});
+    src->allocate();
+    std::fill_n(src->buffer().as<float *>(), src->size(), 1.f);
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = src;
+
+    auto item = *net_reader.getNetwork().getOutputsInfo().begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    for (int step = 1; step <= 3; step++) {
+        graph.Infer(srcs, outputBlobs);
+        for (size_t i = 0; i < output->size(); i++)
+            ASSERT_FLOAT_EQ(static_cast<float>(step), output->data()[i]) << "step " << step;
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestQueryMemoryState) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(accumulatorModel.data(), accumulatorModel.length()));
+
+    auto plugin = std::make_shared<MKLDNNPlugin::Engine>();
+    InferenceEngine::IExecutableNetwork::Ptr network;
+    ASSERT_NO_THROW(plugin->LoadNetwork(network, net_reader.getNetwork(), {}));
+
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::IInferRequest::Ptr request;
+    ASSERT_EQ(InferenceEngine::OK, network->CreateInferRequest(request, &resp)) << resp.msg;
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 4},
+                                                                               InferenceEngine::NC});
+    src->allocate();
+    std::fill_n(src->buffer().as<float *>(), src->size(), 1.f);
+    ASSERT_EQ(InferenceEngine::OK, request->SetBlob("data", src, &resp)) << resp.msg;
+
+    InferenceEngine::IMemoryState::Ptr state;
+    ASSERT_EQ(InferenceEngine::OK, network->QueryState(state, 0, &resp)) << resp.msg;
+    InferenceEngine::IMemoryState::Ptr noState;
+    ASSERT_EQ(InferenceEngine::OUT_OF_BOUNDS, network->QueryState(noState, 1, &resp));
+    char name[16];
+    ASSERT_EQ(InferenceEngine::OK, state->GetName(name, sizeof(name), &resp)) << resp.msg;
+    ASSERT_STREQ("state", name);
+
+    auto checkState = [&](float expected) {
+        InferenceEngine::Blob::CPtr lastState;
+        ASSERT_EQ(InferenceEngine::OK, state->GetLastState(lastState, &resp)) << resp.msg;
+        ASSERT_EQ(4, lastState->size());
+        for (size_t i = 0; i < lastState->size(); i++)
+            ASSERT_FLOAT_EQ(expected, lastState->cbuffer().as<const float *>()[i]);
+    };
+
+    ASSERT_EQ(InferenceEngine::OK, request->Infer(&resp)) << resp.msg;
+    ASSERT_EQ(InferenceEngine::OK, request->Infer(&resp)) << resp.msg;
+    checkState(2.f);
+
+    ASSERT_EQ(InferenceEngine::OK, state->Reset(&resp)) << resp.msg;
+    checkState(0.f);
+
+    InferenceEngine::Blob::Ptr base = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 4},
+                                                                                InferenceEngine::NC});
+    base->allocate();
+    std::fill_n(base->buffer().as<float *>(), base->size(), 5.f);
+    ASSERT_EQ(InferenceEngine::OK, state->SetState(base, &resp)) << resp.msg;
+    ASSERT_EQ(InferenceEngine::OK, state->Reset(&resp)) << resp.msg;
+    ASSERT_EQ(InferenceEngine::OK, request->Infer(&resp)) << resp.msg;
+    checkState(6.f);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestInferWithReshapedInputs) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::Config config;
+    config.reshapeCacheSize = 1;
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(
+            new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), config, {}));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    execNetwork->CreateInferRequest(inferRequest);
+    std::string outName = net_reader.getNetwork().getOutputsInfo().begin()->first;
+
+    auto inferShape = [&](const InferenceEngine::SizeVector &dims) {
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW);
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+        src->allocate();
+        fill_data(src->buffer(), src->size());
+
+        InferenceEngine::ResponseDesc resp;
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("data", src, &resp)) << resp.msg;
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+
+        InferenceEngine::Blob::Ptr output;
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->GetBlob(outName.c_str(), output, &resp)) << resp.msg;
+        ASSERT_EQ(dims, output->getTensorDesc().getDims());
+        const float *src_data = src->buffer();
+        const float *dst_data = output->buffer();
+        for (size_t i = 0; i < src->size(); i++)
+            ASSERT_NEAR(2.f * src_data[i], dst_data[i], 1e-5f);
+    };
+
+    inferShape({1, 3, 8, 5});
+    inferShape({1, 3, 4, 5});
+    inferShape({1, 3, 8, 5});
+    // the cache keeps one reshaped graph only, so the first one is compiled again
+    inferShape({1, 3, 2, 7});
+    inferShape({1, 3, 8, 5});
+}
@@ -0,0 +1,251 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_tiling.h"
+#include "mkldnn_plugin/mkldnn_blob_pool.h"
+
+#include "single_layer_common.hpp"
+#include "tests_common.hpp"
+#include "../test_graph.hpp"
+
+
+using namespace ::testing;
+using namespace std;
+
+struct tiling_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    // the convolution: kernel, stride and padding, the deconvolution restores the rows with the stride as kernel
+    size_t krn;
+    size_t str;
+    size_t pad;
+
+    // KEY_CPU_BATCH_TILE and KEY_CPU_SPATIAL_TILES
+    int batch_tile;
+    int spatial_tiles;
+};
+
+class MKLDNNGraphTilingTests: public TestsCommon,
+                              public WithParamInterface<tiling_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="Tiling_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" id="1" type="Convolution" precision="FP32">
+            <convolution stride-x="_S_" stride-y="_S_"
+                         pad-x="_P_"    pad-y="_P_"
+                         kernel-x="_K_" kernel-y="_K_"
+                         output="4"     group="1"/>
+
+            <weights offset="0" size="_S1_" />
+            <biases offset="_S1_" size="16" />
+
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>4</dim>
+                    <dim>_CH_</dim>
+                    <dim>_CW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pool1" id="2" type="Pooling" precision="FP32">
+            <pooling stride-x="1" stride-y="1"
+                     pad-x="1" pad-y="1"
+                     kernel-x="3" kernel-y="3"
+                     method="MAX" round="Ceil"/>
+
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>4</dim>
+                    <dim>_CH_</dim>
+                    <dim>_CW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>4</dim>
+                    <dim>_CH_</dim>
+                    <dim>_CW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="deconv1" id="3" type="Deconvolution" precision="FP32">
+            <deconvolution stride-x="_S_" stride-y="_S_"
+                           pad-x="0"      pad-y="0"
+                           kernel-x="_S_" kernel-y="_S_"
+                           output="_IC_"  group="1"/>
+
+            <weights offset="_S2_" size="_S3_" />
+
+            <input>
+                <port id="5">
+                    <dim>_IN_</dim>
+                    <dim>4</dim>
+                    <dim>_CH_</dim>
+                    <dim>_CW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</Net>
+)V0G0N";
+
+protected:
+    size_t convWeightsSize(const tiling_test_params &p) const {
+        return 4 * p.in.c * p.krn * p.krn * sizeof(float);
+    }
+
+    size_t deconvWeightsSize(const tiling_test_params &p) const {
+        return 4 * p.in.c * p.str * p.str * sizeof(float);
+    }
+
+    std::string getModel(const tiling_test_params &p) {
+        std::string model = model_t;
+
+        size_t ch = (p.in.h + 2 * p.pad - p.krn) / p.str + 1;
+        size_t cw = (p.in.w + 2 * p.pad - p.krn) / p.str + 1;
+
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_K_", p.krn);
+        REPLACE_WITH_NUM(model, "_S_", p.str);
+        REPLACE_WITH_NUM(model, "_P_", p.pad);
+        REPLACE_WITH_NUM(model, "_CH_", ch);
+        REPLACE_WITH_NUM(model, "_CW_", cw);
+        REPLACE_WITH_NUM(model, "_OH_", ch * p.str);
+        REPLACE_WITH_NUM(model, "_OW_", cw * p.str);
+
+        REPLACE_WITH_NUM(model, "_S1_", convWeightsSize(p));
+        REPLACE_WITH_NUM(model, "_S2_", convWeightsSize(p) + 16);
+        REPLACE_WITH_NUM(model, "_S3_", deconvWeightsSize(p));
+        return model;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            tiling_test_params p = ::testing::WithParamInterface<tiling_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C,
+                    {convWeightsSize(p) + 16 + deconvWeightsSize(p)});
+            weights->allocate();
+            fill_data(weights->data().as<float*>(), weights->size() / sizeof(float));
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+            InferenceEngine::ICNNNetwork &network = net_reader.getNetwork();
+
+            InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            network.getOutputsInfo(out);
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            // the plain inference of the whole inputs is the reference
+            MKLDNNGraphTestClass refGraph;
+            refGraph.CreateGraph(network);
+            InferenceEngine::TBlob<float>::Ptr dst_ref = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            dst_ref->allocate();
+            InferenceEngine::BlobMap refBlobs;
+            refBlobs[item.first] = dst_ref;
+            refGraph.Infer(srcs, refBlobs);
+
+            auto tiling = std::make_shared<MKLDNNPlugin::MKLDNNGraphTiling>(network, p.batch_tile, p.spatial_tiles);
+            ASSERT_TRUE(tiling->isTiled());
+            auto tileNetwork = tiling->createTileNetwork(network);
+
+            MKLDNNGraphTestClass graph;
+            graph.setTiling(tiling);
+            graph.CreateGraph(*tileNetwork);
+            ASSERT_TRUE(graph.IsTiled());
+
+            // the second inference runs on the tile blobs the first one left in the pool
+            MKLDNNPlugin::MKLDNNBlobPool tilePool;
+            for (int i = 0; i < 2; i++) {
+                InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+                output->allocate();
+                InferenceEngine::BlobMap outputBlobs;
+                outputBlobs[item.first] = output;
+
+                graph.InferTiles(srcs, outputBlobs, nullptr, tilePool);
+
+                compare(*output, *dst_ref);
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphTilingTests, TestsTiling) {}
+
+
+INSTANTIATE_TEST_CASE_P(
+        TestTiling, MKLDNNGraphTilingTests,
+        ::testing::Values(
+                // the bands of the rows: strided and padded convolution, convolution without padding
+                tiling_test_params{{1, 3, 16, 16}, 3, 2, 1, 0, 2},
+                tiling_test_params{{1, 3, 19, 12}, 3, 1, 0, 0, 3},
+                tiling_test_params{{1, 8, 32, 9}, 5, 2, 2, 0, 4},
+                // the tiles of the batch, the last one is partial
+                tiling_test_params{{3, 3, 10, 10}, 3, 2, 1, 2, 0},
+                tiling_test_params{{4, 3, 8, 8}, 3, 1, 1, 1, 0},
+                // both
+                tiling_test_params{{2, 3, 16, 16}, 5, 2, 2, 1, 2}
+        ));
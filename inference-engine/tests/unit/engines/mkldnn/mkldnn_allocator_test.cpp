@@ -0,0 +1,88 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <ie_plugin_config.hpp>
+#include "mkldnn_plugin/mkldnn_allocator.h"
+#include "mkldnn_plugin/mkldnn_memory.h"
+#include "mkldnn_plugin/config.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+class MKLDNNAllocatorTest : public ::testing::Test {
+protected:
+    class CountingAllocator : public IAllocator {
+    public:
+        void Release() noexcept override {
+            delete this;
+        }
+        void *lock(void *handle, LockOp) noexcept override {
+            return handle;
+        }
+        void unlock(void *handle) noexcept override {}
+        void *alloc(size_t size) noexcept override {
+            allocated++;
+            return new char[size];
+        }
+        bool free(void *handle) noexcept override {
+            freed++;
+            delete[] static_cast<char *>(handle);
+            return true;
+        }
+
+        int allocated = 0;
+        int freed = 0;
+    };
+};
+
+TEST_F(MKLDNNAllocatorTest, hugePagesAllocationsAreAligned) {
+    auto allocator = details::shared_from_irelease(new MKLDNNHugePagesAllocator());
+    auto handle = allocator->alloc(100);
+    ASSERT_NE(nullptr, handle);
+    auto ptr = static_cast<char *>(allocator->lock(handle));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % MKLDNNHugePagesAllocator::hugePageSize);
+    std::fill(ptr, ptr + 100, 1);
+    allocator->unlock(handle);
+    ASSERT_TRUE(allocator->free(handle));
+}
+
+TEST_F(MKLDNNAllocatorTest, configSelectsAllocator) {
+    Config config;
+    ASSERT_EQ(nullptr, config.allocator);
+    config.readProperties({{PluginConfigParams::KEY_CPU_MEMORY_ALLOCATOR, PluginConfigParams::CPU_ALLOCATOR_HUGE_PAGES}});
+    ASSERT_NE(nullptr, dynamic_cast<MKLDNNHugePagesAllocator *>(config.allocator.get()));
+    config.readProperties({{PluginConfigParams::KEY_CPU_MEMORY_ALLOCATOR, PluginConfigParams::CPU_ALLOCATOR_SYSTEM}});
+    ASSERT_EQ(nullptr, config.allocator);
+    ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_CPU_MEMORY_ALLOCATOR, "UNKNOWN"}}),
+                 details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNAllocatorTest, memoryIsAllocatedWithAllocatorAndFreedWithPrimitive) {
+    auto counting = new CountingAllocator();
+    auto allocator = details::shared_from_irelease(static_cast<IAllocator *>(counting));
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+
+    std::shared_ptr<mkldnn::memory> primitive;
+    {
+        MKLDNNMemory memory(eng, allocator);
+        memory.Create({1, 3, 4, 4}, mkldnn::memory::f32, mkldnn::memory::nchw);
+        ASSERT_EQ(1, counting->allocated);
+        ASSERT_EQ(0.f, static_cast<float *>(memory.GetData())[47]);
+        primitive = memory.GetPrimitivePtr();
+    }
+    // the primitive keeps the buffer alive
+    ASSERT_EQ(0, counting->freed);
+    primitive.reset();
+    ASSERT_EQ(1, counting->freed);
+
+    // the memory on the user data does not use the allocator
+    float data[48] = {};
+    MKLDNNMemory memory(eng, allocator);
+    memory.Create({1, 3, 4, 4}, mkldnn::memory::f32, mkldnn::memory::nchw, data);
+    ASSERT_EQ(1, counting->allocated);
+}
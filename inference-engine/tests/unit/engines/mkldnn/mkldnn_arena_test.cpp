@@ -0,0 +1,51 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "mkldnn_plugin/mkldnn_arena.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+class MKLDNNArenaTest : public ::testing::Test {};
+
+TEST_F(MKLDNNArenaTest, allocationsAreAlignedAndDoNotOverlap) {
+    MKLDNNArena arena(64);
+    auto first = reinterpret_cast<uintptr_t>(arena.allocate(3, 1));
+    auto second = reinterpret_cast<uintptr_t>(arena.allocate(8, 8));
+    auto third = reinterpret_cast<uintptr_t>(arena.allocate(16, 16));
+
+    ASSERT_EQ(0, second % 8);
+    ASSERT_EQ(0, third % 16);
+    ASSERT_LE(first + 3, second);
+    ASSERT_LE(second + 8, third);
+}
+
+TEST_F(MKLDNNArenaTest, canAllocateMoreThanChunk) {
+    MKLDNNArena arena(64);
+    auto small = static_cast<char *>(arena.allocate(60, 1));
+    auto big = static_cast<char *>(arena.allocate(1000, 64));
+
+    ASSERT_NE(nullptr, small);
+    ASSERT_NE(nullptr, big);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(big) % 64);
+    std::fill(small, small + 60, 1);
+    std::fill(big, big + 1000, 2);
+    ASSERT_EQ(1, small[59]);
+}
+
+TEST_F(MKLDNNArenaTest, sharedObjectsKeepArenaAlive) {
+    auto arena = std::make_shared<MKLDNNArena>();
+    std::weak_ptr<MKLDNNArena> weakArena = arena;
+
+    auto value = std::allocate_shared<std::vector<int>>(MKLDNNArenaAllocator<std::vector<int>>(arena), 10, 7);
+    arena.reset();
+    ASSERT_FALSE(weakArena.expired());
+    ASSERT_EQ(7, (*value)[9]);
+
+    value.reset();
+    ASSERT_TRUE(weakArena.expired());
+}
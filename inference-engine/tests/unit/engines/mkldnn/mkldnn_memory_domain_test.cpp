@@ -0,0 +1,37 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_plugin/mkldnn_memory_domain.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+class MKLDNNMemoryDomainTest : public ::testing::Test {};
+
+TEST_F(MKLDNNMemoryDomainTest, domainIsSharedById) {
+    auto first = MKLDNNMemoryDomain::get("first");
+    ASSERT_EQ(first, MKLDNNMemoryDomain::get("first"));
+    ASSERT_NE(first, MKLDNNMemoryDomain::get("second"));
+}
+
+TEST_F(MKLDNNMemoryDomainTest, workspacesShareMemoryOfLargestOne) {
+    auto domain = MKLDNNMemoryDomain::get("workspaces");
+    auto small = domain->map(4096);
+    if (!small) {
+        // the system has no shared memory, the graphs keep their own workspaces
+        return;
+    }
+    static_cast<char *>(small.get())[100] = 42;
+
+    auto large = domain->map(3 * 4096);
+    ASSERT_EQ(3u * 4096, domain->size());
+    ASSERT_EQ(42, static_cast<char *>(large.get())[100]);
+    static_cast<char *>(large.get())[200] = 7;
+    ASSERT_EQ(7, static_cast<char *>(small.get())[200]);
+    // the growth keeps the smaller mapping valid
+    static_cast<char *>(large.get())[3 * 4096 - 1] = 1;
+    static_cast<char *>(small.get())[4095] = 1;
+}
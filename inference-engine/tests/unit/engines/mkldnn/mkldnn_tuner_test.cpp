@@ -0,0 +1,130 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <cpp/ie_cnn_net_reader.h>
+#include <details/ie_exception.hpp>
+#include "mkldnn_plugin/mkldnn_tuner.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+class MKLDNNTunerTest : public ::testing::Test {
+protected:
+    const std::string model = R"V0G0N(
+<Net Name="Pooling_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pool1" id="1" type="Pooling" precision="FP32">
+            <pooling stride-x="2" stride-y="2" pad-x="0" pad-y="0" kernel-x="2" kernel-y="2" method="max"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    const std::string tuningFile = "mkldnn_tuner_test.txt";
+
+    CNNNetwork readNetwork(CNNNetReader &reader) {
+        reader.ReadNetwork(model.data(), model.length());
+        return reader.getNetwork();
+    }
+
+    Config getConfig(Config::TuningMode mode) {
+        Config config;
+        config.tuningMode = mode;
+        config.tuningFile = tuningFile;
+        return config;
+    }
+
+    void TearDown() override {
+        std::remove(tuningFile.c_str());
+    }
+};
+
+TEST_F(MKLDNNTunerTest, throwsWithoutTuningFile) {
+    Config config;
+    config.tuningMode = Config::TuningMode::Create;
+    ASSERT_THROW(MKLDNNTuner tuner(config), details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNTunerTest, throwsOnMissingFileOfExistingTuning) {
+    ASSERT_THROW(MKLDNNTuner tuner(getConfig(Config::TuningMode::UseExisting)), details::InferenceEngineException);
+    ASSERT_NO_THROW(MKLDNNTuner tuner(getConfig(Config::TuningMode::Create)));
+}
+
+TEST_F(MKLDNNTunerTest, layerKeyDependsOnShapesAndParamsOnly) {
+    CNNNetReader reader;
+    CNNNetwork network = readNetwork(reader);
+    CNNLayerPtr pool = network.getLayerByName("pool1");
+
+    std::string key = MKLDNNTuner::getLayerKey(pool);
+    pool->name = "other_name";
+    pool->params["PrimitivesPriority"] = "cpu:ref_any";
+    ASSERT_EQ(key, MKLDNNTuner::getLayerKey(pool));
+
+    pool->params["kernel-x"] = "3";
+    ASSERT_NE(key, MKLDNNTuner::getLayerKey(pool));
+}
+
+TEST_F(MKLDNNTunerTest, appliesImplementationsOfTuningFile) {
+    CNNNetReader reader;
+    CNNNetwork network = readNetwork(reader);
+    CNNLayerPtr pool = network.getLayerByName("pool1");
+    {
+        std::ofstream file(tuningFile);
+        file << MKLDNNTuner::getLayerKey(pool) << "\tref_any\n";
+    }
+
+    MKLDNNTuner tuner(getConfig(Config::TuningMode::UseExisting));
+    tuner.apply(network);
+    ASSERT_EQ("cpu:ref_any", pool->params["PrimitivesPriority"]);
+}
+
+TEST_F(MKLDNNTunerTest, keepsPrioritiesOfUser) {
+    CNNNetReader reader;
+    CNNNetwork network = readNetwork(reader);
+    CNNLayerPtr pool = network.getLayerByName("pool1");
+    {
+        std::ofstream file(tuningFile);
+        file << MKLDNNTuner::getLayerKey(pool) << "\tref_any\n";
+    }
+    pool->params["PrimitivesPriority"] = "cpu:jit_avx2";
+
+    MKLDNNTuner tuner(getConfig(Config::TuningMode::UseExisting));
+    tuner.apply(network);
+    ASSERT_EQ("cpu:jit_avx2", pool->params["PrimitivesPriority"]);
+}
@@ -0,0 +1,65 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "mkldnn_plugin/mkldnn_weights_cache.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+class MKLDNNWeightsCacheTest : public ::testing::Test {
+protected:
+    mkldnn::engine eng = mkldnn::engine(mkldnn::engine::kind::cpu, 0);
+
+    MKLDNNMemoryPtr repack(const std::vector<float> &weights, const MKLDNNMemoryDesc &desc, int &created) {
+        std::string key = MKLDNNWeightsCache::makeKey(weights.data(), weights.size() * sizeof(float), desc, "");
+        return MKLDNNWeightsCache::findOrCreate(key, [&]() {
+            created++;
+            MKLDNNMemoryPtr memory(new MKLDNNMemory(eng));
+            memory->Create(desc);
+            memory->SetData(mkldnn::memory::f32, mkldnn::memory::oihw, weights.data(),
+                            weights.size() * sizeof(float));
+            return memory;
+        });
+    }
+};
+
+TEST_F(MKLDNNWeightsCacheTest, sameWeightsAreRepackedOnce) {
+    std::vector<float> weights(16 * 16 * 3 * 3, 1.f);
+    std::vector<float> copy = weights;
+    MKLDNNMemoryDesc blocked({16, 16, 3, 3}, mkldnn::memory::f32, mkldnn::memory::OIhw8i8o);
+
+    int created = 0;
+    auto first = repack(weights, blocked, created);
+    auto second = repack(copy, blocked, created);
+    ASSERT_EQ(1, created);
+    ASSERT_EQ(first, second);
+}
+
+TEST_F(MKLDNNWeightsCacheTest, otherWeightsOrFormatAreRepackedSeparately) {
+    std::vector<float> weights(16 * 16 * 3 * 3, 1.f);
+    std::vector<float> other(16 * 16 * 3 * 3, 2.f);
+    MKLDNNMemoryDesc blocked8({16, 16, 3, 3}, mkldnn::memory::f32, mkldnn::memory::OIhw8i8o);
+    MKLDNNMemoryDesc blocked16({16, 16, 3, 3}, mkldnn::memory::f32, mkldnn::memory::OIhw16i16o);
+
+    int created = 0;
+    auto first = repack(weights, blocked8, created);
+    auto second = repack(other, blocked8, created);
+    auto third = repack(weights, blocked16, created);
+    ASSERT_EQ(3, created);
+    ASSERT_NE(first, second);
+    ASSERT_NE(first, third);
+}
+
+TEST_F(MKLDNNWeightsCacheTest, unusedMemoryIsReleased) {
+    std::vector<float> weights(16 * 16 * 3 * 3, 3.f);
+    MKLDNNMemoryDesc blocked({16, 16, 3, 3}, mkldnn::memory::f32, mkldnn::memory::OIhw8i8o);
+
+    int created = 0;
+    repack(weights, blocked, created);
+    repack(weights, blocked, created);
+    ASSERT_EQ(2, created);
+}
@@ -7,6 +7,8 @@
 #include <gmock/gmock-spec-builders.h>
 
 #include "ie_allocator.hpp"
+#include "ie_blob.h"
+#include "pooled_allocator.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -36,3 +38,50 @@ TEST_F(SystemAllocatorTests, canLockAllocatedMemory) {
     ptr [9999] = 11;
     ASSERT_EQ(ptr[9999], 11);
 }
+
+TEST(PooledAllocatorTests, sizeClassesFitTheSizes) {
+    for (size_t size = 1; size < 100000; size += 13) {
+        int sizeClass = PooledAllocator::sizeClass(size);
+        ASSERT_GE(PooledAllocator::classSize(sizeClass), size);
+        if (sizeClass > 0)
+            ASSERT_LT(PooledAllocator::classSize(sizeClass - 1), size);
+    }
+    ASSERT_EQ(-1, PooledAllocator::sizeClass(PooledAllocator::maxClassSize + 1));
+}
+
+TEST(PooledAllocatorTests, reusesFreedBlockOfTheSameClass) {
+    auto allocator = PooledAllocator::shared();
+    void *handle = allocator->alloc(1000);
+    char *ptr = static_cast<char *>(allocator->lock(handle));
+    ptr[999] = 11;
+    allocator->free(handle);
+
+    void *reused = allocator->alloc(900);
+    ASSERT_EQ(handle, reused);
+    allocator->free(reused);
+}
+
+TEST(PooledAllocatorTests, canAllocateOverMaxClassSize) {
+    auto allocator = PooledAllocator::shared();
+    void *handle = allocator->alloc(PooledAllocator::maxClassSize + 1);
+    ASSERT_NE(nullptr, handle);
+    allocator->free(handle);
+}
+
+TEST(SharedMemoryAllocatorTests, blobsOfTheSameSegmentShareTheData) {
+    std::string name = "ie_shm_test_" + std::to_string(reinterpret_cast<uintptr_t>(&name));
+    auto creator = details::shared_from_irelease(CreateSharedMemoryAllocator(name.c_str(), 4096, true));
+    ASSERT_NE(nullptr, creator);
+    ASSERT_EQ(nullptr, CreateSharedMemoryAllocator(name.c_str(), 4096, true));
+    auto opener = details::shared_from_irelease(CreateSharedMemoryAllocator(name.c_str(), 0, false));
+    ASSERT_NE(nullptr, opener);
+
+    TensorDesc desc(Precision::FP32, {1, 1, 32, 32}, Layout::NCHW);
+    auto written = make_shared_blob<float>(desc, creator);
+    written->allocate();
+    auto read = make_shared_blob<float>(desc, opener);
+    read->allocate();
+    written->data()[1023] = 42.f;
+    ASSERT_EQ(42.f, read->data()[1023]);
+    ASSERT_EQ(nullptr, opener->alloc(4097));
+}
@@ -5,6 +5,8 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
+#include <thread>
+#include <future>
 #include <inference_engine.hpp>
 #include <cpp_interfaces/impl/mock_infer_request_internal.hpp>
 #include <cpp_interfaces/impl/mock_async_infer_request_default.hpp>
@@ -29,6 +31,10 @@ public:
     void setRequestBusy() {
         AsyncInferRequestThreadSafeDefault::setIsRequestBusy(true);
     }
+
+    size_t getAsyncTasksCount() const {
+        return _asyncTasks.size();
+    }
 };
 
 class InferRequestThreadSafeDefaultTests : public ::testing::Test {
@@ -217,3 +223,165 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, inlineCallbackRunsOnInferenceThread) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, nullptr);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    std::thread::id inferThread;
+    std::thread::id callbackThread;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                callbackThread = std::this_thread::get_id();
+                ASSERT_EQ(StatusCode::OK, status);
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([&]() {
+        inferThread = std::this_thread::get_id();
+    }));
+
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_NE(std::thread::id(), callbackThread);
+    ASSERT_EQ(inferThread, callbackThread);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, inlineCallbackIsCalledIfAsyncRequestFailed) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, nullptr);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    bool wasCalled = false;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                wasCalled = true;
+                ASSERT_EQ(StatusCode::GENERAL_ERROR, status);
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Throw(std::exception()));
+
+    testRequest->StartAsync();
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
+    ASSERT_TRUE(wasCalled);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, asyncTaskIsReusedByNextInferences) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(5);
+
+    for (int i = 0; i < 5; i++) {
+        testRequest->StartAsync();
+        ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    }
+    ASSERT_EQ(1u, testRequest->getAsyncTasksCount());
+}
+
+class MockPreprocessedInferRequestInternal : public MockInferRequestInternal {
+public:
+    MockPreprocessedInferRequestInternal() : MockInferRequestInternal({}, {}) {}
+
+    bool HasPreprocessing() const override {
+        return true;
+    }
+};
+
+TEST_F(InferRequestThreadSafeDefaultTests, preprocessingStageRunsOnPreprocessExecutor) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    auto preprocessExecutor = std::make_shared<TaskExecutor>();
+    auto preprocessedRequest = make_shared<MockPreprocessedInferRequestInternal>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(preprocessedRequest, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    testRequest->SetPreprocessExecutor(preprocessExecutor);
+
+    std::thread::id preprocessThread;
+    auto probe = std::make_shared<Task>([&]() { preprocessThread = std::this_thread::get_id(); });
+    preprocessExecutor->startTask(probe);
+    probe->wait(-1);
+
+    std::thread::id inferThread;
+    EXPECT_CALL(*preprocessedRequest.get(), InferImpl()).Times(2).WillRepeatedly(Invoke([&]() {
+        inferThread = std::this_thread::get_id();
+    }));
+
+    for (int i = 0; i < 2; i++) {
+        testRequest->StartAsync();
+        ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+        ASSERT_NE(std::thread::id(), inferThread);
+        ASSERT_NE(preprocessThread, inferThread);
+    }
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, statisticsCountPhasesAndLatencies) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    auto statistics = std::make_shared<ExecutionStatistics>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    testRequest->SetStatistics(statistics);
+
+    unsigned int runningInInference = 0;
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(3).WillRepeatedly(Invoke([&]() {
+        runningInInference = statistics->requests(ExecutionStatistics::Running);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }));
+
+    for (int i = 0; i < 3; i++) {
+        testRequest->StartAsync();
+        ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+        ASSERT_EQ(1u, runningInInference);
+    }
+    ASSERT_EQ(0u, statistics->requests(ExecutionStatistics::Queued));
+    ASSERT_EQ(0u, statistics->requests(ExecutionStatistics::Running));
+    ASSERT_EQ(0u, statistics->requests(ExecutionStatistics::Callback));
+
+    auto execution = statistics->execution.histogram();
+    ASSERT_EQ(3u, execution.count);
+    ASSERT_GE(execution.maxMicros, 2000u);
+    ASSERT_GE(execution.percentileMicros(0.5), 2000u);
+    ASSERT_EQ(3u, statistics->queue.histogram().count);
+    ASSERT_EQ(0u, statistics->callback.histogram().count);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, statisticsCountRunningCallbacks) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    auto callbackExecutor = std::make_shared<TaskExecutor>();
+    auto statistics = std::make_shared<ExecutionStatistics>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, callbackExecutor);
+    testRequest->SetStatistics(statistics);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    unsigned int inCallback = 0;
+    unsigned int runningInCallback = 0;
+    std::promise<void> callbackDone;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                inCallback = statistics->requests(ExecutionStatistics::Callback);
+                runningInCallback = statistics->requests(ExecutionStatistics::Running);
+                callbackDone.set_value();
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+
+    testRequest->StartAsync();
+    callbackDone.get_future().wait();
+    ASSERT_EQ(1u, inCallback);
+    ASSERT_EQ(0u, runningInCallback);
+    ASSERT_EQ(1u, statistics->callback.histogram().count);
+}
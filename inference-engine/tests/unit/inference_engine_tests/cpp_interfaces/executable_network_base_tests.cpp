@@ -89,3 +89,79 @@ TEST_F(ExecutableNetworkBaseTests, canCatchUnknownErrorInGetMappedTopology) {
     std::map<std::string, std::vector<PrimitiveInfo::Ptr>> deployedTopology;
     ASSERT_EQ(UNEXPECTED, exeNetwork->GetMappedTopology(deployedTopology, nullptr));
 }
+
+// GetMemoryFootprint
+TEST_F(ExecutableNetworkBaseTests, canForwardGetMemoryFootprint) {
+    MemoryFootprint footprint;
+    EXPECT_CALL(*mock_impl.get(), GetMemoryFootprint(Ref(footprint))).Times(1);
+    ASSERT_EQ(OK, exeNetwork->GetMemoryFootprint(footprint, &dsc));
+}
+
+TEST_F(ExecutableNetworkBaseTests, canReportErrorInGetMemoryFootprint) {
+    EXPECT_CALL(*mock_impl.get(), GetMemoryFootprint(_)).WillOnce(Throw(std::runtime_error("compare")));
+    MemoryFootprint footprint;
+    ASSERT_NE(exeNetwork->GetMemoryFootprint(footprint, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
+// GetMetrics
+TEST_F(ExecutableNetworkBaseTests, canForwardGetMetrics) {
+    ExecutableNetworkMetrics metrics;
+    EXPECT_CALL(*mock_impl.get(), GetMetrics(Ref(metrics))).Times(1);
+    ASSERT_EQ(OK, exeNetwork->GetMetrics(metrics, &dsc));
+}
+
+TEST_F(ExecutableNetworkBaseTests, canReportErrorInGetMetrics) {
+    EXPECT_CALL(*mock_impl.get(), GetMetrics(_)).WillOnce(Throw(std::runtime_error("compare")));
+    ExecutableNetworkMetrics metrics;
+    ASSERT_NE(exeNetwork->GetMetrics(metrics, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
+// Reshape
+TEST_F(ExecutableNetworkBaseTests, canForwardReshape) {
+    ICNNNetwork::InputShapes shapes = {{"data", {1, 3, 300, 300}}};
+    EXPECT_CALL(*mock_impl.get(), Reshape(shapes)).Times(1);
+    ASSERT_EQ(OK, exeNetwork->Reshape(shapes, &dsc));
+}
+
+TEST_F(ExecutableNetworkBaseTests, canReportErrorInReshape) {
+    EXPECT_CALL(*mock_impl.get(), Reshape(_)).WillOnce(Throw(std::runtime_error("compare")));
+    ASSERT_NE(exeNetwork->Reshape({}, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
+// Trim
+TEST_F(ExecutableNetworkBaseTests, canForwardTrim) {
+    EXPECT_CALL(*mock_impl.get(), Trim(true)).Times(1);
+    ASSERT_EQ(OK, exeNetwork->Trim(true, &dsc));
+}
+
+TEST_F(ExecutableNetworkBaseTests, canReportErrorInTrim) {
+    EXPECT_CALL(*mock_impl.get(), Trim(_)).WillOnce(Throw(std::runtime_error("compare")));
+    ASSERT_NE(exeNetwork->Trim(false, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
+TEST_F(ExecutableNetworkBaseTests, canForwardStartAsyncRequests) {
+    IInferRequest::Ptr requests[2];
+    EXPECT_CALL(*mock_impl.get(), StartAsyncRequests(SizeIs(2))).Times(1);
+    ASSERT_EQ(OK, exeNetwork->StartAsyncRequests(requests, 2, &dsc));
+}
+
+TEST_F(ExecutableNetworkBaseTests, canReportErrorInStartAsyncRequests) {
+    EXPECT_CALL(*mock_impl.get(), StartAsyncRequests(_)).WillOnce(Throw(std::runtime_error("compare")));
+    IInferRequest::Ptr requests[1];
+    ASSERT_NE(exeNetwork->StartAsyncRequests(requests, 1, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
+// WaitRequests
+TEST_F(ExecutableNetworkBaseTests, canForwardWaitRequestsAndReturnCompletedIndex) {
+    IInferRequest::Ptr requests[3];
+    EXPECT_CALL(*mock_impl.get(), WaitRequests(SizeIs(3), false, 10, _))
+            .WillOnce(DoAll(SetArgReferee<3>(2), Return(GENERAL_ERROR)));
+    size_t completed = 0;
+    ASSERT_EQ(GENERAL_ERROR, exeNetwork->WaitRequests(requests, 3, false, 10, &completed, &dsc));
+    ASSERT_EQ(2u, completed);
+}
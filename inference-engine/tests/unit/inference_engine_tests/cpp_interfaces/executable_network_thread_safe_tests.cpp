@@ -4,6 +4,7 @@
 //
 
 #include <gtest/gtest.h>
+#include <future>
 #include <cpp_interfaces/impl/mock_executable_thread_safe_default.hpp>
 #include <cpp_interfaces/impl/mock_infer_request_internal.hpp>
 #include <cpp_interfaces/base/ie_executable_network_base.hpp>
@@ -63,3 +64,74 @@ TEST_F(ExecutableNetworkThreadSafeTests, returnErrorIfStartAsyncThrowsException)
     EXPECT_NO_THROW(sts = req->Wait(IInferRequest::WaitMode::RESULT_READY, &dsc));
     ASSERT_EQ(StatusCode::GENERAL_ERROR, sts) << dsc.msg;
 }
+
+TEST_F(ExecutableNetworkThreadSafeTests, canStartAndWaitForAllRequests) {
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    auto secondInferRequestInternal = make_shared<MockInferRequestInternal>(networkInputs, networkOutputs);
+    IInferRequest::Ptr requests[2];
+    EXPECT_CALL(*mockExeNetwork.get(), CreateInferRequestImpl(_, _))
+            .WillOnce(Return(mockInferRequestInternal))
+            .WillOnce(Return(secondInferRequestInternal));
+    ASSERT_EQ(OK, exeNetwork->CreateInferRequest(requests[0], &dsc));
+    ASSERT_EQ(OK, exeNetwork->CreateInferRequest(requests[1], &dsc));
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+    EXPECT_CALL(*secondInferRequestInternal.get(), InferImpl()).WillOnce(Throw(std::runtime_error("")));
+
+    ASSERT_EQ(OK, exeNetwork->StartAsyncRequests(requests, 2, &dsc)) << dsc.msg;
+    ASSERT_EQ(GENERAL_ERROR, exeNetwork->WaitRequests(requests, 2, true, IInferRequest::WaitMode::RESULT_READY,
+                                                      nullptr, &dsc));
+    ASSERT_EQ(OK, requests[0]->Wait(IInferRequest::WaitMode::STATUS_ONLY, &dsc));
+    ASSERT_EQ(GENERAL_ERROR, requests[1]->Wait(IInferRequest::WaitMode::STATUS_ONLY, &dsc));
+    EXPECT_TRUE(Mock::VerifyAndClearExpectations(secondInferRequestInternal.get()));
+}
+
+TEST_F(ExecutableNetworkThreadSafeTests, waitForAnyRequestReturnsStartedOne) {
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    auto secondInferRequestInternal = make_shared<MockInferRequestInternal>(networkInputs, networkOutputs);
+    IInferRequest::Ptr requests[2];
+    EXPECT_CALL(*mockExeNetwork.get(), CreateInferRequestImpl(_, _))
+            .WillOnce(Return(mockInferRequestInternal))
+            .WillOnce(Return(secondInferRequestInternal));
+    ASSERT_EQ(OK, exeNetwork->CreateInferRequest(requests[0], &dsc));
+    ASSERT_EQ(OK, exeNetwork->CreateInferRequest(requests[1], &dsc));
+    EXPECT_CALL(*secondInferRequestInternal.get(), InferImpl()).Times(1);
+
+    size_t completed = 0;
+    ASSERT_EQ(INFER_NOT_STARTED, exeNetwork->WaitRequests(requests, 2, false, IInferRequest::WaitMode::RESULT_READY,
+                                                          &completed, &dsc));
+    ASSERT_EQ(OK, exeNetwork->StartAsyncRequests(&requests[1], 1, &dsc)) << dsc.msg;
+    ASSERT_EQ(OK, exeNetwork->WaitRequests(requests, 2, false, IInferRequest::WaitMode::RESULT_READY,
+                                           &completed, &dsc));
+    ASSERT_EQ(1u, completed);
+    // the completed request is released by the wait
+    EXPECT_CALL(*secondInferRequestInternal.get(), InferImpl()).Times(1);
+    ASSERT_EQ(OK, exeNetwork->StartAsyncRequests(&requests[1], 1, &dsc)) << dsc.msg;
+    ASSERT_EQ(OK, exeNetwork->WaitRequests(&requests[1], 1, true, IInferRequest::WaitMode::RESULT_READY,
+                                           nullptr, &dsc));
+    EXPECT_TRUE(Mock::VerifyAndClearExpectations(secondInferRequestInternal.get()));
+}
+
+TEST_F(ExecutableNetworkThreadSafeTests, trimIsRejectedWhileRequestInfers) {
+    IInferRequest::Ptr req;
+    EXPECT_CALL(*mockExeNetwork.get(), CreateInferRequestImpl(_, _)).WillOnce(Return(mockInferRequestInternal));
+    ASSERT_EQ(OK, exeNetwork->CreateInferRequest(req, &dsc));
+    promise<void> started, finish;
+    auto finished = finish.get_future().share();
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([&]() {
+        started.set_value();
+        finished.wait();
+    }));
+    EXPECT_CALL(*mockExeNetwork.get(), TrimImpl(_)).Times(0);
+
+    ASSERT_EQ(OK, req->StartAsync(&dsc)) << dsc.msg;
+    started.get_future().wait();
+    ASSERT_EQ(REQUEST_BUSY, exeNetwork->Trim(false, &dsc));
+    finish.set_value();
+    ASSERT_EQ(OK, req->Wait(IInferRequest::WaitMode::RESULT_READY, &dsc)) << dsc.msg;
+    EXPECT_TRUE(Mock::VerifyAndClearExpectations(mockExeNetwork.get()));
+
+    EXPECT_CALL(*mockExeNetwork.get(), TrimImpl(true)).Times(1);
+    ASSERT_EQ(OK, exeNetwork->Trim(true, &dsc)) << dsc.msg;
+}
@@ -168,6 +168,44 @@ TEST_F(InferenceEnginePluginInternalTest, failToSetNotAllocatedBlob) {
     ASSERT_EQ(refError, dsc.msg);
 }
 
+TEST_F(InferenceEnginePluginInternalTest, failToSetROIsWithoutResizeAlgorithm) {
+    string inputName = MockNotEmptyICNNNetwork::INPUT_BLOB_NAME;
+    std::string refError = "ROIs can be set only for an input with the resize algorithm and RAW color format";
+    IInferRequest::Ptr inferRequest;
+    getInferRequestWithMockImplInside(inferRequest);
+    Blob::Ptr frame = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 3, 8, 8}, NCHW));
+    frame->allocate();
+
+    ASSERT_NO_THROW(sts = inferRequest->SetROIs(inputName.c_str(), frame, {{0, 0, 0, 4, 4}}, &dsc));
+    ASSERT_EQ(StatusCode::GENERAL_ERROR, sts);
+    dsc.msg[refError.length()] = '\0';
+    ASSERT_EQ(refError, dsc.msg);
+}
+
+TEST_F(InferenceEnginePluginInternalTest, failToSetSequenceStatesWithoutPluginSupport) {
+    std::string refError = "Sequence states are not supported";
+    IInferRequest::Ptr inferRequest;
+    getInferRequestWithMockImplInside(inferRequest);
+
+    ASSERT_NO_THROW(sts = inferRequest->SetSequenceStates({std::make_shared<SequenceState>()}, &dsc));
+    ASSERT_EQ(StatusCode::GENERAL_ERROR, sts);
+    dsc.msg[refError.length()] = '\0';
+    ASSERT_EQ(refError, dsc.msg);
+}
+
+TEST_F(InferenceEnginePluginInternalTest, failToSetUnknownRequestedOutput) {
+    std::string refError = NOT_FOUND_str + "Failed to find the output with name: \'unknown\'";
+    IInferRequest::Ptr inferRequest;
+    getInferRequestWithMockImplInside(inferRequest);
+
+    ASSERT_NO_THROW(sts = inferRequest->SetRequestedOutputs({MockNotEmptyICNNNetwork::OUTPUT_BLOB_NAME}, &dsc));
+    ASSERT_EQ(StatusCode::OK, sts) << dsc.msg;
+    ASSERT_NO_THROW(sts = inferRequest->SetRequestedOutputs({"unknown"}, &dsc));
+    ASSERT_EQ(StatusCode::NOT_FOUND, sts);
+    dsc.msg[refError.length()] = '\0';
+    ASSERT_EQ(refError, dsc.msg);
+}
+
 class InferenceEnginePluginInternal2Test : public ::testing::Test {
 protected:
     shared_ptr<IInferencePlugin> plugin;
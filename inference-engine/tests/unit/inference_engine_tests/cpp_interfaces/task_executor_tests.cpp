@@ -4,6 +4,7 @@
 //
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <gmock/gmock-spec-builders.h>
 #include <cpp_interfaces/ie_task_executor.hpp>
 #include <ie_common.h>
@@ -175,6 +176,64 @@ TEST_F(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     ASSERT_EQ(sharedVar, MAX_NUMBER_OF_TASKS_IN_QUEUE);
 }
 
+TEST_F(TaskExecutorTests, runsTasksOfHigherPriorityFirst) {
+    std::mutex mutex;
+    std::condition_variable condVar;
+    bool isBlocked = true;
+    std::vector<int> order;
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    auto blocking = std::make_shared<Task>([&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condVar.wait(lock, [&isBlocked]() { return !isBlocked; });
+    });
+    auto low1 = std::make_shared<Task>([&]() { order.push_back(1); });
+    auto high = std::make_shared<Task>([&]() { order.push_back(2); });
+    auto low2 = std::make_shared<Task>([&]() { order.push_back(3); });
+    high->setPriority(1);
+
+    taskExecutor->startTask(blocking);
+    taskExecutor->startTask(low1);
+    taskExecutor->startTask(high);
+    taskExecutor->startTask(low2);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isBlocked = false;
+    }
+    condVar.notify_all();
+    low2->wait(-1);
+
+    ASSERT_EQ(order, std::vector<int>({2, 1, 3}));
+}
+
+TEST_F(TaskExecutorTests, canPreemptTaskByTaskOfHigherPriority) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    std::atomic<bool> started{false};
+    std::atomic<bool> highDone{false};
+    bool preempted = false;
+    auto low = std::make_shared<Task>([&]() {
+        started = true;
+        auto start = std::chrono::steady_clock::now();
+        while (!highDone && std::chrono::steady_clock::now() - start < std::chrono::seconds(5)) {
+            preempted = TaskExecutor::preempt(0) || preempted;
+        }
+    });
+    auto high = std::make_shared<Task>([&]() { highDone = true; });
+    high->setPriority(1);
+
+    taskExecutor->startTask(low);
+    while (!started) std::this_thread::yield();
+    taskExecutor->startTask(high);
+    low->wait(-1);
+
+    ASSERT_TRUE(highDone);
+    ASSERT_TRUE(preempted);
+    ASSERT_EQ(Task::Status::TS_DONE, high->getStatus());
+}
+
+TEST_F(TaskExecutorTests, preemptDoesNothingOutsideOfExecutor) {
+    ASSERT_FALSE(TaskExecutor::preempt(0));
+}
+
 // TODO: CVS-11695
 TEST_F(TaskExecutorTests, DISABLED_startAsyncIsNotBlockedByAnotherTask) {
     std::mutex mutex_block_emulation;
@@ -80,3 +80,20 @@ TEST_F(TaskTests, canSyncNThreadsUsingTaskSync) {
     for (auto &status : statuses) ASSERT_NE(Task::Status::TS_BUSY, status);
     ASSERT_EQ(sharedVar, THREAD_NUMBER * NUM_INTERNAL_ITERATIONS);
 }
+
+TEST_F(TaskTests, canWaitWithSpinTime) {
+    std::atomic<bool> release(false);
+    Task::Ptr task = std::make_shared<Task>([&]() {
+        while (!release) std::this_thread::yield();
+    });
+    task->setSpinTime(1000);
+    task->occupy();
+    MetaThread metaThread([&]() {
+        task->runNoThrowNoBusyCheck();
+    });
+
+    ASSERT_EQ(Task::Status::TS_BUSY, task->wait(1));
+    release = true;
+    ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+    metaThread.join();
+}
@@ -0,0 +1,118 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <cpp_interfaces/ie_work_stealing_task_executor.hpp>
+#include <ie_common.h>
+#include "task_tests_utils.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class WorkStealingTaskExecutorTests : public ::testing::Test {};
+
+TEST_F(WorkStealingTaskExecutorTests, canCreateTaskExecutor) {
+    EXPECT_NO_THROW(std::make_shared<WorkStealingTaskExecutor>());
+}
+
+TEST_F(WorkStealingTaskExecutorTests, throwsWithoutInitTasks) {
+    EXPECT_THROW(std::make_shared<WorkStealingTaskExecutor>(std::vector<Task::Ptr>()), InferenceEngineException);
+}
+
+TEST_F(WorkStealingTaskExecutorTests, canCatchException) {
+    auto taskExecutor = std::make_shared<WorkStealingTaskExecutor>(2);
+    auto task = std::make_shared<Task>([]() {
+        THROW_IE_EXCEPTION;
+    });
+    taskExecutor->startTask(task);
+    auto status = task->wait(-1);
+    ASSERT_EQ(status, Task::Status::TS_ERROR);
+    EXPECT_THROW(task->checkException(), InferenceEngineException);
+}
+
+TEST_F(WorkStealingTaskExecutorTests, cannotStartBusyTask) {
+    auto taskExecutor = std::make_shared<WorkStealingTaskExecutor>(1);
+    std::atomic<bool> release(false);
+    auto task = std::make_shared<Task>([&]() {
+        while (!release) std::this_thread::yield();
+    });
+    ASSERT_TRUE(taskExecutor->startTask(task));
+    ASSERT_FALSE(taskExecutor->startTask(task));
+    release = true;
+    ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+}
+
+TEST_F(WorkStealingTaskExecutorTests, initTasksAreDoneInTheirOwnWorkers) {
+    std::atomic<int> initCount(0);
+    std::vector<std::thread::id> initThreads(3);
+    std::vector<Task::Ptr> initTasks;
+    for (size_t i = 0; i < initThreads.size(); i++) {
+        initTasks.push_back(std::make_shared<Task>([&, i]() {
+            initThreads[i] = std::this_thread::get_id();
+            initCount++;
+        }));
+    }
+    auto taskExecutor = std::make_shared<WorkStealingTaskExecutor>(initTasks);
+    ASSERT_EQ(3, initCount);
+    ASSERT_NE(initThreads[0], initThreads[1]);
+    ASSERT_NE(initThreads[1], initThreads[2]);
+    ASSERT_NE(initThreads[0], initThreads[2]);
+}
+
+TEST_F(WorkStealingTaskExecutorTests, idleWorkerStealsTasksOfBusyOne) {
+    auto taskExecutor = std::make_shared<WorkStealingTaskExecutor>(2);
+    std::atomic<bool> release(false);
+    // the tasks are spread in round-robin order, so the first and the third tasks are queued to the same worker
+    auto blockingTask = std::make_shared<Task>([&]() {
+        while (!release) std::this_thread::yield();
+    });
+    auto secondTask = std::make_shared<Task>();
+    auto stolenTask = std::make_shared<Task>();
+    taskExecutor->startTask(blockingTask);
+    taskExecutor->startTask(secondTask);
+    taskExecutor->startTask(stolenTask);
+
+    ASSERT_EQ(Task::Status::TS_DONE, secondTask->wait(-1));
+    ASSERT_EQ(Task::Status::TS_DONE, stolenTask->wait(-1));
+    release = true;
+    ASSERT_EQ(Task::Status::TS_DONE, blockingTask->wait(-1));
+}
+
+TEST_F(WorkStealingTaskExecutorTests, destructorWaitsForAllTasks) {
+    std::atomic<int> done(0);
+    const int tasksNum = 100;
+    std::vector<Task::Ptr> tasks;
+    {
+        WorkStealingTaskExecutor taskExecutor(4);
+        for (int i = 0; i < tasksNum; i++) {
+            tasks.push_back(std::make_shared<Task>([&done]() { done++; }));
+            taskExecutor.startTask(tasks.back());
+        }
+    }
+    ASSERT_EQ(tasksNum, done);
+}
+
+TEST_F(WorkStealingTaskExecutorTests, canStartTasksFromManyThreads) {
+    auto taskExecutor = std::make_shared<WorkStealingTaskExecutor>(4);
+    std::atomic<int> done(0);
+    const int threadsNum = 8;
+    const int tasksPerThread = 50;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < tasksPerThread; i++) {
+                auto task = std::make_shared<Task>([&done]() { done++; });
+                ASSERT_TRUE(taskExecutor->startTask(task));
+                ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    ASSERT_EQ(threadsNum * tasksPerThread, done);
+}
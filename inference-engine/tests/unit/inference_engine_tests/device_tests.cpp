@@ -53,6 +53,13 @@ TEST_F(DeviceTests, internalFindReturnsResponse) {
 }
 #endif
 
+TEST_F(DeviceTests, findsMultiDevicePlugin) {
+    FindPluginRequest request = { TargetDevice::eMULTI };
+    FindPluginResponse result = findPlugin(request);
+    ASSERT_EQ(result.names.size(), 1);
+    ASSERT_EQ(result.names[0], "MultiDevicePlugin");
+}
+
 TEST_F(DeviceTests, returnsProperDeviceName) {
     ASSERT_STREQ(getDeviceName(TargetDevice::eDefault), "Default");
     ASSERT_STREQ(getDeviceName(TargetDevice::eBalanced), "Balanced");
@@ -62,7 +69,8 @@ TEST_F(DeviceTests, returnsProperDeviceName) {
     ASSERT_STREQ(getDeviceName(TargetDevice::eMYRIAD), "MYRIAD");
     ASSERT_STREQ(getDeviceName(TargetDevice::eGNA), "GNA");
     ASSERT_STREQ(getDeviceName(TargetDevice::eHETERO), "HETERO");
+    ASSERT_STREQ(getDeviceName(TargetDevice::eMULTI), "MULTI");
     ASSERT_STREQ(getDeviceName(static_cast<TargetDevice>(-1)), "Unknown device");
     //off by one test - might not be enough
-    ASSERT_STREQ(getDeviceName(static_cast<TargetDevice>((uint8_t)TargetDevice::eHETERO + 1)), "Unknown device");
+    ASSERT_STREQ(getDeviceName(static_cast<TargetDevice>((uint8_t)TargetDevice::eMULTI + 1)), "Unknown device");
 }
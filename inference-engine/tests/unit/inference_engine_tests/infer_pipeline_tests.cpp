@@ -0,0 +1,126 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <ie_infer_pipeline.hpp>
+#include "mock_iasync_infer_request.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class InferPipelineTests : public ::testing::Test {
+protected:
+    vector<MockIInferRequest::Ptr> mockRequests;
+    vector<InferRequest::Ptr> requests;
+
+    void createRequests(size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            auto mock = make_shared<MockIInferRequest>();
+            EXPECT_CALL(*mock, StartAsync(_)).WillRepeatedly(Return(OK));
+            EXPECT_CALL(*mock, Wait(_, _)).WillRepeatedly(Return(OK));
+            mockRequests.push_back(mock);
+            requests.push_back(make_shared<InferRequest>(mock));
+        }
+    }
+
+    static shared_ptr<int> frameValue(const PipelineFrame &frame) {
+        return static_pointer_cast<int>(frame.data);
+    }
+};
+
+TEST_F(InferPipelineTests, sinkReceivesFramesInOrder) {
+    createRequests(3);
+    const int frames = 50;
+    int decoded = 0;
+    atomic<int> inFlight(0);
+    atomic<int> maxInFlight(0);
+    vector<uint64_t> delivered;
+
+    InferPipelineConfig config;
+    config.preprocessWorkers = 3;
+    config.postprocessWorkers = 2;
+    InferPipeline pipeline(requests, config,
+        [&](PipelineFrame &frame) {
+            if (decoded == frames) return false;
+            frame.data = make_shared<int>(decoded++);
+            return true;
+        },
+        [&](PipelineFrame &frame) {
+            ASSERT_TRUE(frame.request != nullptr);
+            int current = ++inFlight;
+            int seen = maxInFlight;
+            while (current > seen && !maxInFlight.compare_exchange_weak(seen, current)) {}
+            // the later frames overtake the earlier ones
+            this_thread::sleep_for(chrono::microseconds((frame.index * 7) % 5 * 100));
+        },
+        [&](PipelineFrame &frame) {
+            *frameValue(frame) *= 2;
+            inFlight--;
+        },
+        [&](PipelineFrame &frame) {
+            ASSERT_TRUE(frame.request == nullptr);
+            ASSERT_EQ(static_cast<int>(frame.index) * 2, *frameValue(frame));
+            delivered.push_back(frame.index);
+        });
+    pipeline.start();
+    pipeline.wait();
+
+    ASSERT_EQ(static_cast<size_t>(frames), delivered.size());
+    for (size_t i = 0; i < delivered.size(); i++)
+        ASSERT_EQ(i, delivered[i]);
+    // every frame between the pre-processing and the post-processing holds a request
+    ASSERT_LE(maxInFlight.load(), 3);
+
+    auto statistics = pipeline.statistics();
+    ASSERT_EQ(5u, statistics.size());
+    for (const auto &stage : statistics)
+        ASSERT_EQ(static_cast<size_t>(frames), stage.frames) << stage.name;
+}
+
+TEST_F(InferPipelineTests, failedStageStopsPipeline) {
+    createRequests(2);
+    int decoded = 0;
+    InferPipeline pipeline(requests, InferPipelineConfig(),
+        [&](PipelineFrame &frame) {
+            decoded++;
+            return true;
+        },
+        [&](PipelineFrame &frame) {
+            if (frame.index == 5) THROW_IE_EXCEPTION << "preprocess failed";
+        },
+        nullptr,
+        [&](PipelineFrame &frame) {});
+    pipeline.start();
+    ASSERT_THROW(pipeline.wait(), details::InferenceEngineException);
+    ASSERT_GE(decoded, 6);
+}
+
+TEST_F(InferPipelineTests, failedInferenceStopsPipeline) {
+    createRequests(1);
+    EXPECT_CALL(*mockRequests[0], Wait(_, _)).WillRepeatedly(Return(GENERAL_ERROR));
+    InferPipeline pipeline(requests, InferPipelineConfig(),
+        [&](PipelineFrame &frame) { return true; },
+        [&](PipelineFrame &frame) {},
+        nullptr,
+        [&](PipelineFrame &frame) {});
+    pipeline.start();
+    ASSERT_THROW(pipeline.wait(), details::InferenceEngineException);
+}
+
+TEST_F(InferPipelineTests, cannotCreatePipelineWithoutRequests) {
+    ASSERT_THROW(InferPipeline(requests, InferPipelineConfig(),
+                               [&](PipelineFrame &frame) { return false; },
+                               [&](PipelineFrame &frame) {},
+                               nullptr,
+                               [&](PipelineFrame &frame) {}),
+                 details::InferenceEngineException);
+}
@@ -72,3 +72,16 @@ TEST_F(LayersTests, throwsOnExpiredDataPtr) {
     ASSERT_THROW(layer.input(), InferenceEngine::details::InferenceEngineException);
 }
 
+
+TEST_F(LayersTests, returnsExactDefaultForMissingParams) {
+    InferenceEngine::CNNLayer layer(getDefaultParamsForLayer());
+    layer.params["present"] = "3";
+    ASSERT_EQ(1e-10f, layer.GetParamAsFloat("missing", 1e-10f));
+    ASSERT_EQ(-5, layer.GetParamAsInt("missing", -5));
+    ASSERT_EQ(7u, layer.GetParamAsUInt("missing", 7u));
+    ASSERT_TRUE(layer.GetParamsAsBool("missing", true));
+    ASSERT_EQ(3.0f, layer.GetParamAsFloat("present", 1.0f));
+    ASSERT_EQ(3, layer.GetParamAsInt("present", 1));
+    ASSERT_EQ(3u, layer.GetParamAsUInt("present", 1u));
+    ASSERT_TRUE(layer.GetParamsAsBool("present", false));
+}
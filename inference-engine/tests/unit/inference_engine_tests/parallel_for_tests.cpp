@@ -0,0 +1,46 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+#include <ie_parallel_for.hpp>
+
+using namespace std;
+using namespace InferenceEngine;
+
+class ParallelForTests: public ::testing::Test {
+};
+
+TEST_F(ParallelForTests, splitterCoversRangeWithoutGaps) {
+    for (size_t n : {0u, 1u, 5u, 17u, 64u}) {
+        size_t expectedStart = 0;
+        for (int tid = 0; tid < 8; tid++) {
+            size_t start, end;
+            splitter(n, 8, tid, start, end);
+            ASSERT_EQ(expectedStart, start);
+            ASSERT_LE(end - start, (n + 7) / 8);
+            expectedStart = end;
+        }
+        ASSERT_EQ(n, expectedStart);
+    }
+}
+
+TEST_F(ParallelForTests, parallelNdVisitsEveryPointOnce) {
+    const int D0 = 3, D1 = 5, D2 = 7;
+    std::vector<std::atomic<int>> hits(D0 * D1 * D2);
+    for (auto &hit : hits) hit = 0;
+
+    parallel_nd(D0, D1, D2, [&](int d0, int d1, int d2) { hits[(d0 * D1 + d1) * D2 + d2]++; });
+    parallel_nd(D0, D1 * D2, [&](int d0, int d1) { hits[d0 * D1 * D2 + d1]++; });
+    parallel_for(hits.size(), [&](size_t i) { hits[i]++; });
+    parallel_for_dynamic(D0 * D1 * D2, [&](int i) { hits[i]++; });
+
+    for (auto &hit : hits) ASSERT_EQ(4, hit);
+}
+
+TEST_F(ParallelForTests, parallelSumAddsInput) {
+    ASSERT_EQ(1 + 99 * 100 / 2, parallel_sum(100, 1, [](int i) { return i; }));
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include "precision_utils.h"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+TEST(PrecisionUtilsTests, f16ArrayConversionMatchesScalarForAllValues) {
+    std::vector<ie_fp16> src(65536);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<ie_fp16>(i);
+
+    std::vector<float> dst(src.size());
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size(), 2.f, 1.f);
+
+    for (size_t i = 0; i < src.size(); i++) {
+        float ref = PrecisionUtils::f16tof32(src[i]) * 2.f + 1.f;
+        ASSERT_EQ(0, std::memcmp(&ref, &dst[i], sizeof(float))) << "value " << i;
+    }
+}
+
+TEST(PrecisionUtilsTests, f32ArrayConversionMatchesScalar) {
+    // a large array is converted in parallel, the values cover the f16 range, denormals, overflow and NaN
+    const size_t size = 1024 * 1024;
+    std::vector<float> src(size);
+    for (size_t i = 0; i < size; i++) {
+        uint32_t bits = static_cast<uint32_t>(i * 2654435761u);
+        bits = (bits & 0x807FFFFF) | ((100 + (i % 60)) << 23);
+        if (i % 997 == 0)
+            bits |= 0x7F800000;
+        std::memcpy(&src[i], &bits, sizeof(float));
+    }
+
+    std::vector<ie_fp16> dst(size);
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), size, 0.5f, 0.25f);
+
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * 0.5f + 0.25f), dst[i]) << "value " << i;
+    }
+}
+
+TEST(PrecisionUtilsTests, bf16ConversionRoundsToNearestEven) {
+    const uint32_t bits[] = {0x3F800000,   // 1.0 is exact
+                             0x3F808000,   // the tie rounds to the even 0x3F80
+                             0x3F818000,   // the tie rounds to the even 0x3F82
+                             0x3F808001,   // above the tie rounds up
+                             0x7F7FFFFF,   // the max float rounds to the infinity
+                             0xFF800000,   // -inf is exact
+                             0x7F800001};  // the signaling NaN stays a NaN
+    const uint16_t expected[] = {0x3F80, 0x3F80, 0x3F82, 0x3F81, 0x7F80, 0xFF80, 0x7FC0};
+    const size_t size = sizeof(bits) / sizeof(bits[0]);
+
+    std::vector<float> src(size);
+    std::memcpy(src.data(), bits, sizeof(bits));
+    std::vector<short> dst(size);
+    PrecisionUtils::f32tobf16Arrays(dst.data(), src.data(), size);
+
+    std::vector<float> back(size);
+    PrecisionUtils::bf16tof32Arrays(back.data(), dst.data(), size);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(expected[i], static_cast<uint16_t>(dst[i])) << "value " << i;
+        uint32_t backBits;
+        std::memcpy(&backBits, &back[i], sizeof(backBits));
+        ASSERT_EQ(static_cast<uint32_t>(expected[i]) << 16, backBits) << "value " << i;
+    }
+}
@@ -0,0 +1,129 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <ie_preprocess.hpp>
+#include "ie_preprocess_data.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class PreProcessColorTests : public ::testing::Test {
+protected:
+    template <typename T>
+    static typename TBlob<T>::Ptr makeBlob(Precision precision, const SizeVector &dims, Layout layout,
+                                           const std::vector<T> &data = {}) {
+        auto blob = make_shared_blob<T>(TensorDesc(precision, dims, layout));
+        blob->allocate();
+        if (!data.empty())
+            std::copy(data.begin(), data.end(), blob->buffer().template as<T *>());
+        return blob;
+    }
+
+    static PreProcessInfo makeInfo(ColorFormat colorFormat, ResizeAlgorithm algorithm) {
+        PreProcessInfo info;
+        info.setColorFormat(colorFormat);
+        info.setResizeAlgorithm(algorithm);
+        return info;
+    }
+
+    template <typename T>
+    static std::vector<T> data(const Blob::Ptr &blob) {
+        auto ptr = blob->cbuffer().as<const T *>();
+        return std::vector<T>(ptr, ptr + blob->size());
+    }
+};
+
+TEST_F(PreProcessColorTests, preProcessingIsRequiredForColorFormat) {
+    PreProcessInfo info;
+    ASSERT_FALSE(info.isPreProcessingRequired());
+    info.setColorFormat(BGRX);
+    ASSERT_TRUE(info.isPreProcessingRequired());
+}
+
+TEST_F(PreProcessColorTests, convertsBGRXToPlanarBGR) {
+    // 1x2 image, the fourth channel is ignored
+    auto image = makeBlob<uint8_t>(Precision::U8, {1, 4, 1, 2}, NHWC, {1, 2, 3, 255, 4, 5, 6, 255});
+    Blob::Ptr out = makeBlob<uint8_t>(Precision::U8, {1, 3, 1, 2}, NCHW);
+
+    PreProcessData preProcess;
+    preProcess.setRoiBlob(image);
+    preProcess.execute(out, makeInfo(BGRX, NO_RESIZE));
+
+    ASSERT_EQ(std::vector<uint8_t>({1, 4, 2, 5, 3, 6}), data<uint8_t>(out));
+}
+
+TEST_F(PreProcessColorTests, convertsRGBToInterleavedFP32BGR) {
+    auto image = makeBlob<uint8_t>(Precision::U8, {1, 3, 1, 2}, NCHW, {1, 2, 3, 4, 5, 6});
+    Blob::Ptr out = makeBlob<float>(Precision::FP32, {1, 3, 1, 2}, NHWC);
+
+    PreProcessData preProcess;
+    preProcess.setRoiBlob(image);
+    preProcess.execute(out, makeInfo(RGB, RESIZE_BILINEAR));
+
+    ASSERT_EQ(std::vector<float>({5.f, 3.f, 1.f, 6.f, 4.f, 2.f}), data<float>(out));
+}
+
+TEST_F(PreProcessColorTests, convertsNV12ToBGR) {
+    // 2x2 image: the Y plane of 4 samples, then a single UV pair
+    auto image = makeBlob<uint8_t>(Precision::U8, {1, 1, 3, 2}, NCHW, {16, 16, 235, 235, 128, 128});
+    Blob::Ptr out = makeBlob<uint8_t>(Precision::U8, {1, 3, 2, 2}, NCHW);
+
+    PreProcessData preProcess;
+    preProcess.setRoiBlob(image);
+    preProcess.execute(out, makeInfo(NV12, NO_RESIZE));
+
+    ASSERT_EQ(std::vector<uint8_t>({0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255}), data<uint8_t>(out));
+}
+
+TEST_F(PreProcessColorTests, downscalesBGRXWithBilinearResize) {
+    // 4x2 image is averaged by 2x2 blocks
+    std::vector<uint8_t> pixels;
+    for (uint8_t v : {10, 20, 30, 40, 30, 40, 50, 60}) {
+        pixels.insert(pixels.end(), {v, static_cast<uint8_t>(v + 1), static_cast<uint8_t>(v + 2), 0});
+    }
+    auto image = makeBlob<uint8_t>(Precision::U8, {1, 4, 2, 4}, NHWC, pixels);
+    Blob::Ptr out = makeBlob<uint8_t>(Precision::U8, {1, 3, 1, 2}, NCHW);
+
+    PreProcessData preProcess;
+    preProcess.setRoiBlob(image);
+    preProcess.execute(out, makeInfo(BGRX, RESIZE_BILINEAR));
+
+    ASSERT_EQ(std::vector<uint8_t>({25, 45, 26, 46, 27, 47}), data<uint8_t>(out));
+}
+
+TEST_F(PreProcessColorTests, downscalesBGRXWithAreaResize) {
+    std::vector<uint8_t> pixels;
+    for (int i = 0; i < 16; i++) {
+        pixels.insert(pixels.end(), {7, 8, 9, 0});
+    }
+    auto image = makeBlob<uint8_t>(Precision::U8, {1, 4, 4, 4}, NHWC, pixels);
+    Blob::Ptr out = makeBlob<uint8_t>(Precision::U8, {1, 3, 2, 2}, NCHW);
+
+    PreProcessData preProcess;
+    preProcess.setRoiBlob(image);
+    preProcess.execute(out, makeInfo(BGRX, RESIZE_AREA));
+
+    ASSERT_EQ(std::vector<uint8_t>({7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9}), data<uint8_t>(out));
+}
+
+TEST_F(PreProcessColorTests, throwsOnDifferentSizeWithoutResize) {
+    auto image = makeBlob<uint8_t>(Precision::U8, {1, 3, 4, 4}, NCHW);
+    Blob::Ptr out = makeBlob<uint8_t>(Precision::U8, {1, 3, 2, 2}, NCHW);
+
+    PreProcessData preProcess;
+    preProcess.setRoiBlob(image);
+    ASSERT_THROW(preProcess.execute(out, makeInfo(BGR, NO_RESIZE)), details::InferenceEngineException);
+}
+
+TEST_F(PreProcessColorTests, throwsOnWrongNV12Size) {
+    auto image = makeBlob<uint8_t>(Precision::U8, {1, 1, 4, 2}, NCHW);
+    Blob::Ptr out = makeBlob<uint8_t>(Precision::U8, {1, 3, 2, 2}, NCHW);
+
+    PreProcessData preProcess;
+    preProcess.setRoiBlob(image);
+    ASSERT_THROW(preProcess.execute(out, makeInfo(NV12, NO_RESIZE)), details::InferenceEngineException);
+}
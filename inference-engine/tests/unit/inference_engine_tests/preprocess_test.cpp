@@ -4,7 +4,10 @@
 //
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
 #include <ie_preprocess.hpp>
+#include "ie_preprocess_data.hpp"
 
 using namespace std;
 
@@ -51,3 +54,159 @@ TEST_F(PreProcessTests, noThrowWithCorrectSizeMeanImage) {
     blob->set({ 1.f, 2.f });
     ASSERT_NO_THROW(info.setMeanImage(blob));
 }
+
+TEST_F(PreProcessTests, resizesAllImagesOfBatch) {
+    using namespace InferenceEngine;
+    const size_t batch = 4;
+    auto image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {batch, 3, 16, 16}, NCHW));
+    image->allocate();
+    auto imageData = image->buffer().as<uint8_t *>();
+    for (size_t i = 0; i < image->size(); i++) {
+        // every plane is filled with its own value
+        imageData[i] = static_cast<uint8_t>(i / (16 * 16));
+    }
+    Blob::Ptr out = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {batch, 3, 8, 8}, NCHW));
+    out->allocate();
+
+    for (auto algorithm : {RESIZE_BILINEAR, RESIZE_AREA}) {
+        PreProcessData preProcess;
+        preProcess.setRoiBlob(image);
+        ASSERT_NO_THROW(preProcess.execute(out, algorithm));
+
+        auto outData = out->cbuffer().as<const uint8_t *>();
+        for (size_t i = 0; i < out->size(); i++) {
+            ASSERT_EQ(i / (8 * 8), outData[i]) << "algorithm " << algorithm << ", element " << i;
+        }
+    }
+}
+
+TEST_F(PreProcessTests, resizesRoisToImagesOfBatch) {
+    using namespace InferenceEngine;
+    // every 8x8 quadrant of the channel of the frame is filled with its own value
+    auto frame = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 16, 16}, NCHW));
+    frame->allocate();
+    auto quadrantValue = [](size_t c, size_t y, size_t x) {
+        return static_cast<uint8_t>(c * 40 + (y / 8) * 20 + (x / 8) * 10);
+    };
+    auto frameData = frame->buffer().as<uint8_t *>();
+    for (size_t c = 0; c < 3; c++)
+        for (size_t y = 0; y < 16; y++)
+            for (size_t x = 0; x < 16; x++)
+                frameData[(c * 16 + y) * 16 + x] = quadrantValue(c, y, x);
+
+    // ROIs of different sizes inside of the quadrants, the last image of the batch is not used
+    std::vector<ROI> rois = {{0, 0, 0, 8, 8}, {1, 9, 1, 6, 4}, {2, 2, 10, 4, 6}};
+    Blob::Ptr out = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {4, 3, 4, 4}, NCHW));
+    out->allocate();
+
+    for (auto algorithm : {RESIZE_BILINEAR, RESIZE_AREA}) {
+        PreProcessData preProcess;
+        preProcess.setRois(frame, rois);
+        ASSERT_NO_THROW(preProcess.execute(out, algorithm));
+
+        auto outData = out->cbuffer().as<const uint8_t *>();
+        for (size_t n = 0; n < rois.size(); n++) {
+            for (size_t c = 0; c < 3; c++) {
+                for (size_t i = 0; i < 16; i++) {
+                    ASSERT_EQ(quadrantValue(c, rois[n].posY, rois[n].posX), outData[(n * 3 + c) * 16 + i])
+                            << "algorithm " << algorithm << ", ROI " << n << ", channel " << c;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(PreProcessTests, reusesResizeTablesOnlyForTheSameSourceLayout) {
+    using namespace InferenceEngine;
+    auto gradient = [](size_t c, size_t y, size_t x) {
+        return static_cast<uint8_t>(c * 60 + y * 3 + x * 2);
+    };
+    auto image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 16, 16}, NCHW));
+    image->allocate();
+    // the left half of the frame has the same content as the image, so the ROI differs only by the row stride
+    auto frame = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 16, 32}, NCHW));
+    frame->allocate();
+    auto imageData = image->buffer().as<uint8_t *>();
+    auto frameData = frame->buffer().as<uint8_t *>();
+    for (size_t c = 0; c < 3; c++) {
+        for (size_t y = 0; y < 16; y++) {
+            for (size_t x = 0; x < 32; x++) {
+                if (x < 16)
+                    imageData[(c * 16 + y) * 16 + x] = gradient(c, y, x);
+                frameData[(c * 16 + y) * 32 + x] = x < 16 ? gradient(c, y, x) : 255;
+            }
+        }
+    }
+    auto makeOut = []() {
+        Blob::Ptr out = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 6}, NCHW));
+        out->allocate();
+        return out;
+    };
+    auto data = [](const Blob::Ptr &blob) {
+        auto ptr = blob->cbuffer().as<const uint8_t *>();
+        return std::vector<uint8_t>(ptr, ptr + blob->size());
+    };
+
+    for (auto algorithm : {RESIZE_BILINEAR, RESIZE_AREA}) {
+        PreProcessData preProcess;
+        auto expected = makeOut();
+        preProcess.setRoiBlob(image);
+        preProcess.execute(expected, algorithm);
+
+        auto fromRoi = makeOut();
+        preProcess.setRois(frame, {{0, 0, 0, 16, 16}});
+        preProcess.execute(fromRoi, algorithm);
+        ASSERT_EQ(data(expected), data(fromRoi)) << "algorithm " << algorithm;
+
+        // the second resize of the same layout takes the cached tables
+        auto again = makeOut();
+        preProcess.setRoiBlob(image);
+        preProcess.execute(again, algorithm);
+        ASSERT_EQ(data(expected), data(again)) << "algorithm " << algorithm;
+    }
+}
+
+TEST_F(PreProcessTests, throwsOnMoreRoisThanBatch) {
+    using namespace InferenceEngine;
+    auto frame = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 16, 16}, NCHW));
+    frame->allocate();
+    Blob::Ptr out = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
+    out->allocate();
+
+    PreProcessData preProcess;
+    preProcess.setRois(frame, {{0, 0, 0, 8, 8}, {1, 8, 8, 8, 8}});
+    ASSERT_THROW(preProcess.execute(out, RESIZE_BILINEAR), details::InferenceEngineException);
+}
+
+// benchmark of the pre-processing, run with --gtest_also_run_disabled_tests
+TEST_F(PreProcessTests, DISABLED_benchmarkResize) {
+    using namespace InferenceEngine;
+    const size_t batch = 32;
+    const int iterations = 10;
+    for (Precision precision : {Precision::U8, Precision::FP32}) {
+        for (auto algorithm : {RESIZE_BILINEAR, RESIZE_AREA}) {
+            Blob::Ptr image, out;
+            if (precision == Precision::U8) {
+                image = make_shared_blob<uint8_t>(TensorDesc(precision, {batch, 3, 480, 640}, NCHW));
+                out = make_shared_blob<uint8_t>(TensorDesc(precision, {batch, 3, 224, 224}, NCHW));
+            } else {
+                image = make_shared_blob<float>(TensorDesc(precision, {batch, 3, 480, 640}, NCHW));
+                out = make_shared_blob<float>(TensorDesc(precision, {batch, 3, 224, 224}, NCHW));
+            }
+            image->allocate();
+            out->allocate();
+
+            PreProcessData preProcess;
+            preProcess.setRoiBlob(image);
+            preProcess.execute(out, algorithm);
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                preProcess.execute(out, algorithm);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            std::cout << precision.name() << (algorithm == RESIZE_BILINEAR ? " bilinear: " : " area: ")
+                      << std::chrono::duration<double, std::milli>(end - start).count() / iterations
+                      << " ms per batch of " << batch << std::endl;
+        }
+    }
+}
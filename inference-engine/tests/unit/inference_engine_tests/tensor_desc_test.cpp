@@ -5,6 +5,7 @@
 
 #include <ie_layouts.h>
 #include <ie_blob.h>
+#include <ie_tensor_offset.hpp>
 #include <gtest/gtest.h>
 #include <random>
 #include <chrono>
@@ -70,3 +71,23 @@ TEST_F(TensorDescTests, CompareNHWCandNCHWLayouts) {
     ASSERT_EQ(descNCHW.getBlockingDesc().getOrder(), nchw);
     ASSERT_EQ(descNHWC.getBlockingDesc().getOrder(), nhwc);
 }
+
+TEST_F(TensorDescTests, TensorOffsetMatchesTensorDescOffset) {
+    TensorDesc planar(Precision::FP32, {2, 3, 4, 5}, Layout::NHWC);
+    TensorDesc padded(Precision::FP32, {2, 3, 4, 5}, BlockingDesc({2, 3, 4, 5}, {0, 1, 2, 3}, 7, {0, 1, 1, 2},
+                                                                  {200, 50, 10, 1}));
+    TensorDesc blocked(Precision::FP32, {2, 12, 3, 4, 5}, BlockingDesc({2, 2, 3, 4, 5, 8}, {0, 1, 2, 3, 4, 1}));
+
+    TensorOffset<4> planarOffset(planar);
+    TensorOffset<4> paddedOffset(padded);
+    TensorOffset<5, true> blockedOffset(blocked);
+    for (size_t i = 0; i < 2 * 3 * 4 * 5; i++) {
+        ASSERT_EQ(planar.offset(i), planarOffset.linear(i));
+        ASSERT_EQ(padded.offset(i), paddedOffset.linear(i));
+    }
+    for (size_t i = 0; i < 2 * 12 * 3 * 4 * 5; i++)
+        ASSERT_EQ(blocked.offset(i), blockedOffset.linear(i));
+
+    ASSERT_TRUE(TensorOffset<4>(TensorDesc(Precision::FP32, {2, 3, 4, 5}, Layout::NCHW)).isDense());
+    ASSERT_FALSE(TensorOffset<5>::fits(blocked));
+}
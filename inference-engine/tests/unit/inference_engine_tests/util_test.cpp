@@ -15,6 +15,7 @@
 #include <ie_util_internal.hpp>
 #include <tests_common.hpp>
 #include <graph_transformer.h>
+#include <graph_tools.hpp>
 #include "ie_utils.hpp"
 
 namespace IE = InferenceEngine;
@@ -839,6 +840,71 @@ TEST(UtilTests, cloneNet_const) {
     ASSERT_EQ("custom_val3", getLayer(cloned, "input3")->params["custom_param3"]);
 }
 
+TEST(UtilTests, cloneNet_sharesWeights) {
+    //
+    // I1-d1-C1-d2
+    //
+    auto net = NetBuilder()
+               .data("data1",IE::SizeVector{1,1,1},IE::Precision::FP32, IE::Layout::CHW)
+               .data("data2",IE::SizeVector{1,1,1},IE::Precision::FP32, IE::Layout::CHW)
+               .layer<IE::CNNLayer>(IE::LayerParams{"input1","input",IE::Precision::FP32})
+               .layer<IE::ConvolutionLayer>(IE::LayerParams{"conv1","Convolution",IE::Precision::FP32})
+
+               .linkToData("input1", "data1")
+               .linkDataTo("data1", "conv1")
+               .linkToData("conv1", "data2")
+
+               .finalize();
+
+    auto conv = std::dynamic_pointer_cast<IE::ConvolutionLayer>(getLayer(net, "conv1"));
+    ASSERT_NE(nullptr, conv);
+    conv->_weights = std::make_shared<IE::TBlob<float>>(IE::Precision::FP32, IE::C, IE::SizeVector{4});
+    conv->_weights->allocate();
+    conv->_biases = std::make_shared<IE::TBlob<float>>(IE::Precision::FP32, IE::C, IE::SizeVector{1});
+    conv->_biases->allocate();
+    conv->blobs["weights"] = conv->_weights;
+    conv->blobs["biases"] = conv->_biases;
+
+    auto cloned = IE::cloneNet({getLayer(net, "conv1")});
+
+    auto clonedConv = std::dynamic_pointer_cast<IE::ConvolutionLayer>(getLayer(cloned, "conv1"));
+    ASSERT_NE(nullptr, clonedConv);
+    ASSERT_NE(conv, clonedConv);
+    EXPECT_EQ(conv->_weights, clonedConv->_weights);
+    EXPECT_EQ(conv->_biases, clonedConv->_biases);
+    EXPECT_EQ(clonedConv->_weights, clonedConv->blobs["weights"]);
+    EXPECT_EQ(clonedConv->_biases, clonedConv->blobs["biases"]);
+}
+
+TEST(UtilTests, releaseWeights) {
+    //
+    // d1-C1-d2
+    //
+    auto net = NetBuilder()
+               .data("data1",IE::SizeVector{1,1,1},IE::Precision::FP32, IE::Layout::CHW)
+               .data("data2",IE::SizeVector{1,1,1},IE::Precision::FP32, IE::Layout::CHW)
+               .layer<IE::ConvolutionLayer>(IE::LayerParams{"conv1","Convolution",IE::Precision::FP32})
+
+               .linkDataTo("data1", "conv1")
+               .linkToData("conv1", "data2")
+
+               .finalize();
+
+    auto conv = std::dynamic_pointer_cast<IE::ConvolutionLayer>(getLayer(net, "conv1"));
+    ASSERT_NE(nullptr, conv);
+    conv->_weights = std::make_shared<IE::TBlob<float>>(IE::Precision::FP32, IE::C, IE::SizeVector{4});
+    conv->_weights->allocate();
+    conv->blobs["weights"] = conv->_weights;
+    std::weak_ptr<IE::Blob> weights = conv->_weights;
+
+    IE::releaseWeights(*net);
+
+    EXPECT_EQ(nullptr, conv->_weights);
+    EXPECT_EQ(nullptr, conv->_biases);
+    EXPECT_TRUE(conv->blobs.empty());
+    EXPECT_TRUE(weights.expired());
+}
+
 TEST(UtilTests, getRootDataObjects) {
     //
     // I1-d1-L1-d7
@@ -1710,3 +1776,69 @@ TEST(UtilTests, replaceLayerWithNewLayer) {
                     layer3Check->insData[1].lock() == data.find("data3")->second);
     }
 }
+
+TEST(UtilTests, graphTransformerRewritesAndRollsBack) {
+    //
+    // I->L1->L2->L3
+    //
+
+    NetBuilder netBuilder;
+    auto net = netBuilder
+               .data("data1", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data2", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data3", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data4", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .layer<IE::CNNLayer>(IE::LayerParams{"input", "Input", IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer1", "ReLU", IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer2", "Power", IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer3", "ReLU", IE::Precision::UNSPECIFIED})
+               .linkToData("input", "data1")
+               .linkData("data1", "data2", "layer1")
+               .linkData("data2", "data3", "layer2")
+               .linkData("data3", "data4", "layer3")
+               .addInput("data1")
+               .finalize();
+
+    const auto& layers = netBuilder.getLayersMap();
+    const auto& data   = netBuilder.getDataMap();
+
+    auto names = [](const std::vector<IE::CNNLayerPtr>& sorted) {
+        std::vector<std::string> result;
+        for (auto& layer : sorted) {
+            result.push_back(layer->name);
+        }
+        return result;
+    };
+
+    IE::GraphTransformer transformer(*net);
+    ASSERT_EQ(names(transformer.sortedLayers()), (std::vector<std::string>{"input", "layer1", "layer2", "layer3"}));
+
+    auto scaleShift = std::make_shared<IE::CNNLayer>(IE::LayerParams{"scaleshift", "ScaleShift", IE::Precision::UNSPECIFIED});
+    int matches = 0;
+    transformer.forEachMatch({"ReLU", "Power"}, [&](const std::vector<IE::CNNLayerPtr>& chain) {
+        ASSERT_EQ(chain.size(), 2);
+        ASSERT_EQ(chain[1], layers.find("layer2")->second);
+        transformer.removeLayer(chain[1]);
+        transformer.insertBetween(chain[0], layers.find("layer3")->second, scaleShift);
+        matches++;
+    });
+    ASSERT_EQ(matches, 1);
+
+    // I->L1->ScaleShift->L3
+    ASSERT_EQ(names(transformer.sortedLayers()), (std::vector<std::string>{"input", "layer1", "scaleshift", "layer3"}));
+    ASSERT_EQ(layers.find("layer3")->second->insData[0].lock()->getCreatorLayer().lock(), scaleShift);
+    ASSERT_EQ(scaleShift->insData[0].lock(), data.find("data2")->second);
+    IE::CNNLayerPtr check;
+    ASSERT_NE(net->getLayerByName("layer2", check, nullptr), IE::OK);
+    ASSERT_EQ(net->getLayerByName("scaleshift", check, nullptr), IE::OK);
+
+    transformer.rollback();
+
+    ASSERT_EQ(names(transformer.sortedLayers()), (std::vector<std::string>{"input", "layer1", "layer2", "layer3"}));
+    ASSERT_EQ(layers.find("layer3")->second->insData[0].lock(), data.find("data3")->second);
+    ASSERT_EQ(data.find("data2")->second->getInputTo().size(), 1);
+    ASSERT_EQ(data.find("data2")->second->getInputTo().begin()->second, layers.find("layer2")->second);
+    ASSERT_EQ(net->getLayerByName("layer2", check, nullptr), IE::OK);
+    ASSERT_NE(net->getLayerByName("scaleshift", check, nullptr), IE::OK);
+    ASSERT_EQ(names(IE::CNNNetSortTopologically(*net)), names(transformer.sortedLayers()));
+}
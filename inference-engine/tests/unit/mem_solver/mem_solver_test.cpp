@@ -4,6 +4,9 @@
 //
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include <string>
 
 #include "memory_solver.hpp"
 #include "details/ie_exception.hpp"
@@ -254,3 +257,136 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, AlignedOffsets) {
+
+    int n = 0;
+    std::vector<Box> boxes{
+            {0, 2, 3, n++},
+            {1, 3, 5, n++},
+            {2, 4, 2, n++},
+    };
+
+    MemorySolver ms(boxes);
+    for (int i = 0; i < n; i++)
+        ms.setAlignment(i, 4);
+    ms.solve();
+
+    for (int i = 0; i < n; i++)
+        EXPECT_EQ(ms.getOffset(i) % 4, 0) << "Box " << i << " is not aligned";
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int off1 = ms.getOffset(box1.id);
+        int off2 = ms.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++)
+    for (int j = i+1; j < n; j++)
+        ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
+
+TEST(MemSolverTest, ThrowsOnWrongAlignment) {
+    MemorySolver ms({{0, 1, 1, 0}});
+    EXPECT_THROW(ms.setAlignment(0, 0), details::InferenceEngineException);
+}
+
+TEST(MemSolverTest, InPlaceBoxesShareOffset) {
+
+    int n = 0;                //  |   ________
+    std::vector<Box> boxes{   //  |  |_0______|____
+            {0, 2, 2, n++},   //  |  |_1_____|_2___|
+            {1, 2, 2, n++},   //  |__|_______|_____|___
+            {2, 3, 2, n++},   //      0  1  2  3
+    };
+
+    MemorySolver ms(boxes);
+    ms.setInPlace(1, 0);
+    EXPECT_EQ(ms.solve(), 4);
+    EXPECT_EQ(ms.getOffset(0), ms.getOffset(1));
+    EXPECT_NE(ms.getOffset(1), ms.getOffset(2));
+}
+
+TEST(MemSolverTest, InPlaceBoxIsMovedOnConflict) {
+
+    int n = 0;
+    std::vector<Box> boxes{
+            {0, 3, 2, n++},
+            {1, 2, 2, n++},
+            {1, 2, 2, n++},
+    };
+
+    MemorySolver ms(boxes);
+    // both boxes alias the first one, but may not alias each other
+    ms.setInPlace(1, 0);
+    ms.setInPlace(2, 0);
+    EXPECT_EQ(ms.solve(), 4);
+    EXPECT_NE(ms.getOffset(1), ms.getOffset(2));
+}
+
+namespace {
+
+/**
+ * Box sets of typical topologies, the sizes are in the units of 64 bytes for the input of 224x224
+ */
+std::vector<Box> linearTopology(const std::vector<int> &sizes) {
+    std::vector<Box> boxes;
+    for (int i = 0; i < static_cast<int>(sizes.size()); i++)
+        boxes.push_back({i, i + 1, sizes[i], i});
+    return boxes;
+}
+
+std::vector<Box> residualTopology(int blocks, int size) {
+    // every block has a shortcut living until the sum at the end of the block
+    std::vector<Box> boxes;
+    int n = 0, t = 0;
+    for (int b = 0; b < blocks; b++) {
+        if (b % 4 == 3) size /= 2;
+        boxes.push_back({t, t + 4, size * 4, n++});  // shortcut
+        boxes.push_back({t + 1, t + 2, size, n++});
+        boxes.push_back({t + 2, t + 3, size, n++});
+        boxes.push_back({t + 3, t + 4, size * 4, n++});
+        t += 4;
+    }
+    return boxes;
+}
+
+std::vector<Box> inceptionTopology(int modules, int size) {
+    // four branches of different depth are concatenated at the end of the module
+    std::vector<Box> boxes;
+    int n = 0, t = 0;
+    for (int m = 0; m < modules; m++) {
+        if (m % 3 == 2) size /= 2;
+        boxes.push_back({t, t + 4, size * 4, n++});  // the input of the module
+        boxes.push_back({t + 1, t + 5, size, n++});
+        boxes.push_back({t + 1, t + 2, size / 2, n++});
+        boxes.push_back({t + 2, t + 5, size, n++});
+        boxes.push_back({t + 2, t + 3, size / 4, n++});
+        boxes.push_back({t + 3, t + 4, size / 4, n++});
+        boxes.push_back({t + 4, t + 5, size, n++});
+        boxes.push_back({t + 4, t + 5, size, n++});
+        t += 5;
+    }
+    return boxes;
+}
+
+}  // namespace
+
+TEST(MemSolverTest, DISABLED_Benchmark) {
+    std::vector<std::pair<std::string, std::vector<Box>>> topologies = {
+        {"alexnet", linearTopology({2352, 4538, 1094, 2916, 676, 1014, 1014, 676, 144, 64, 64, 16})},
+        {"resnet-50", residualTopology(16, 3136)},
+        {"googlenet", inceptionTopology(9, 1568)},
+    };
+
+    for (const auto &topology : topologies) {
+        MemorySolver ms(topology.second);
+        auto begin = std::chrono::high_resolution_clock::now();
+        int required = ms.solve();
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << topology.first << ": " << required << " of " << ms.maxDepth() << " lower bound, "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << " us" << std::endl;
+        EXPECT_LE(ms.maxDepth(), required);
+    }
+}
@@ -51,4 +51,7 @@ public:
 
 	MOCK_METHOD1(SetBatch, void(int));
 	MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+    MOCK_METHOD3(SetROIs_ThreadUnsafe, void(const char *name, const Blob::Ptr &, const std::vector<ROI> &));
+    MOCK_METHOD1(SetSequenceStates_ThreadUnsafe, void(const std::vector<SequenceState::Ptr> &));
+    MOCK_METHOD1(SetRequestedOutputs_ThreadUnsafe, void(const std::vector<std::string> &));
 };
@@ -18,4 +18,5 @@ public:
                  std::shared_ptr<InferRequestInternal>(InputsDataMap networkInputs, OutputsDataMap networkOutputs));
     MOCK_METHOD1(Export, void(const std::string &));
     MOCK_METHOD1(GetMappedTopology, void(std::map<std::string, std::vector<PrimitiveInfo::Ptr>> &));
+    MOCK_METHOD1(TrimImpl, void(bool));
 };
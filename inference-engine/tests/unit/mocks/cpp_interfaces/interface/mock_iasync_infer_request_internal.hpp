@@ -23,4 +23,8 @@ public:
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
 	MOCK_METHOD1(SetBatch, void(int));
+    MOCK_METHOD3(SetROIs, void(const char *, const InferenceEngine::Blob::Ptr &,
+                               const std::vector<InferenceEngine::ROI> &));
+    MOCK_METHOD1(SetSequenceStates, void(const std::vector<InferenceEngine::SequenceState::Ptr> &));
+    MOCK_METHOD1(SetRequestedOutputs, void(const std::vector<std::string> &));
 };
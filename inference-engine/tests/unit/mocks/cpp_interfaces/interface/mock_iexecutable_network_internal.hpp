@@ -29,4 +29,10 @@ public:
     MOCK_METHOD1(Export, void(const std::string &));
     MOCK_METHOD1(GetMappedTopology, void(std::map<std::string, std::vector<PrimitiveInfo::Ptr>> &));
     MOCK_METHOD0(QueryState, std::vector<IMemoryStateInternal::Ptr>());
+    MOCK_METHOD1(GetMemoryFootprint, void(MemoryFootprint &));
+    MOCK_METHOD1(GetMetrics, void(ExecutableNetworkMetrics &));
+    MOCK_METHOD1(Reshape, void(const ICNNNetwork::InputShapes &));
+    MOCK_METHOD1(StartAsyncRequests, void(const std::vector<IInferRequest::Ptr> &));
+    MOCK_METHOD4(WaitRequests, StatusCode(const std::vector<IInferRequest::Ptr> &, bool, int64_t, size_t &));
+    MOCK_METHOD1(Trim, void(bool));
 };
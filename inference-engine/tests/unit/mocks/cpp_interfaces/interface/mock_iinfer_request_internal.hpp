@@ -18,4 +18,8 @@ public:
     MOCK_CONST_METHOD1(GetPerformanceCounts, void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &));
     MOCK_METHOD2(SetBlob, void(const char *name, const InferenceEngine::Blob::Ptr &));
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
+    MOCK_METHOD3(SetROIs, void(const char *name, const InferenceEngine::Blob::Ptr &,
+                               const std::vector<InferenceEngine::ROI> &));
+    MOCK_METHOD1(SetSequenceStates, void(const std::vector<InferenceEngine::SequenceState::Ptr> &));
+    MOCK_METHOD1(SetRequestedOutputs, void(const std::vector<std::string> &));
 };
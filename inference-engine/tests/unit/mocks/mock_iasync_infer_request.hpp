@@ -29,4 +29,8 @@ public:
     MOCK_QUALIFIED_METHOD3(GetBlob, noexcept, StatusCode(const char*, Blob::Ptr&, ResponseDesc*));
     MOCK_QUALIFIED_METHOD3(SetBlob, noexcept, StatusCode(const char*, const Blob::Ptr&, ResponseDesc*));
 	MOCK_QUALIFIED_METHOD2(SetBatch, noexcept, StatusCode(int batch, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD4(SetROIs, noexcept, StatusCode(const char*, const Blob::Ptr&, const std::vector<ROI>&,
+                                                         ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(SetSequenceStates, noexcept, StatusCode(const std::vector<SequenceState::Ptr>&, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(SetRequestedOutputs, noexcept, StatusCode(const std::vector<std::string>&, ResponseDesc*));
 };
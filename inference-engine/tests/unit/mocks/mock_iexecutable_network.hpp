@@ -23,4 +23,11 @@ public:
     MOCK_QUALIFIED_METHOD2(GetMappedTopology, noexcept, StatusCode(std::map<std::string, std::vector<PrimitiveInfo::Ptr>> &, ResponseDesc*));
     MOCK_QUALIFIED_METHOD0(Release, noexcept, void ());
     MOCK_QUALIFIED_METHOD3(QueryState, noexcept, StatusCode(IMemoryState::Ptr &, size_t  , ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(GetMemoryFootprint, noexcept, StatusCode(MemoryFootprint &, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(GetMetrics, noexcept, StatusCode(ExecutableNetworkMetrics &, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(Reshape, noexcept, StatusCode(const ICNNNetwork::InputShapes &, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD3(StartAsyncRequests, noexcept, StatusCode(IInferRequest::Ptr *, size_t, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD6(WaitRequests, noexcept, StatusCode(IInferRequest::Ptr *, size_t, bool, int64_t, size_t *,
+                                                              ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(Trim, noexcept, StatusCode(bool, ResponseDesc*));
 };
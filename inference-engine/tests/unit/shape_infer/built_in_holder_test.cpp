@@ -105,3 +105,20 @@ TEST_P(ShapeInferNotSupportedTest, returnNotFoundOnNotSupported) {
 // TODO: list all not supported later
 INSTANTIATE_TEST_CASE_P(
         NotSupported, ShapeInferNotSupportedTest, ::testing::Values("NOT_SUPPORTED"));
+
+TEST_F(ShapeInferHolderTest, repeatedInferenceReparsesOnlyChangedParams) {
+    IShapeInferImpl::Ptr impl;
+    ASSERT_EQ(OK, BuiltInShapeInferHolder().getShapeInferImpl(impl, "Convolution", &resp)) << resp.msg;
+    params = {{"kernel-x", "3"}, {"kernel-y", "3"}, {"output", "16"}};
+
+    ASSERT_EQ(OK, impl->inferShapes({{1, 3, 32, 32}}, params, blobs, outShapes, &resp)) << resp.msg;
+    ASSERT_EQ(SizeVector({1, 16, 30, 30}), outShapes[0]);
+    ASSERT_EQ(OK, impl->inferShapes({{2, 3, 64, 64}}, params, blobs, outShapes, &resp)) << resp.msg;
+    ASSERT_EQ(SizeVector({2, 16, 62, 62}), outShapes[0]);
+
+    params["output"] = "8";
+    params["stride-x"] = "2";
+    params["stride-y"] = "2";
+    ASSERT_EQ(OK, impl->inferShapes({{2, 3, 64, 64}}, params, blobs, outShapes, &resp)) << resp.msg;
+    ASSERT_EQ(SizeVector({2, 8, 31, 31}), outShapes[0]);
+}
@@ -297,3 +297,22 @@ INSTANTIATE_TEST_CASE_P(
                                       CanInfer(true), padrb({0, 0}), IsTransposed(true))
         )
 );
+
+class BuiltInShapeInferConv3DTest : public BuiltInShapeInferCommon {};
+
+TEST_F(BuiltInShapeInferConv3DTest, inferDepthOfFiveDimInput) {
+    auto impl = getShapeInferImpl("Convolution");
+    ASSERT_NE(nullptr, impl);
+    std::map<std::string, std::string> params = {
+            {"kernel-x", "3"}, {"kernel-y", "3"}, {"kernel-z", "3"},
+            {"stride-x", "1"}, {"stride-y", "2"}, {"stride-z", "2"},
+            {"pad-x",    "1"}, {"pad-y",    "1"}, {"pad-z",    "1"},
+            {"output",   "32"}, {"group",   "1"}
+    };
+    std::map<std::string, Blob::Ptr> blobs;
+    blobs["weights"] = make_shared_blob(Precision::UNSPECIFIED, SizeVector{3 * 3 * 3 * 16 * 32});
+    std::vector<SizeVector> outShapes;
+    sts = impl->inferShapes({{2, 16, 8, 32, 32}}, params, blobs, outShapes, &resp);
+    ASSERT_EQ(int(OK), sts) << resp.msg;
+    ASSERT_EQ(std::vector<SizeVector>({{2, 32, 4, 16, 32}}), outShapes);
+}
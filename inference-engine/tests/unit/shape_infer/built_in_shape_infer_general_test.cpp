@@ -362,6 +362,40 @@ INSTANTIATE_TEST_CASE_P(
                                       MapParams(MapStrStr({{"out_max_val", "0"},
                                                            {"top_k",       "100"}})),
                                       LayerDataName("data"),
+                                      CanInfer(true)),
+                ::testing::make_tuple(LayerType("Gemm"),
+                                      InOutShapes({{{1, 12, 64, 32}, {1, 1, 32, 16}},
+                                                   {{1, 12, 64, 16}}}),
+                                      NewInOutShapes({{{4, 12, 64, 32}, {4, 1, 32, 16}},
+                                                      {{4, 12, 64, 16}}}),
+                                      MapParams(MapStrStr()),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
+                ::testing::make_tuple(LayerType("Gemm"),
+                                      InOutShapes({{{1, 32, 64}, {1, 16, 32}, {1, 1, 16}},
+                                                   {{1, 64, 16}}}),
+                                      NewInOutShapes({{{3, 32, 64}, {3, 16, 32}, {3, 1, 16}},
+                                                      {{3, 64, 16}}}),
+                                      MapParams(MapStrStr({{"transpose_a", "true"},
+                                                           {"transpose_b", "true"},
+                                                           {"alpha",       "0.125"}})),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
+                ::testing::make_tuple(LayerType("Gather"),
+                                      InOutShapes({{{1000, 64}, {1, 1, 20}},
+                                                   {{1, 1, 20, 64}}}),
+                                      NewInOutShapes({{{1000, 64}, {8, 1, 20}},
+                                                      {{8, 1, 20, 64}}}),
+                                      MapParams(MapStrStr()),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
+                ::testing::make_tuple(LayerType("Gather"),
+                                      InOutShapes({{{2, 100, 16}, {5}},
+                                                   {{2, 5, 16}}}),
+                                      NewInOutShapes({{{2, 100, 16}, {7}},
+                                                      {{2, 7, 16}}}),
+                                      MapParams(MapStrStr(std::map<std::string, std::string>{{"axis", "-2"}})),
+                                      LayerDataName("data"),
                                       CanInfer(true))
         )
 );
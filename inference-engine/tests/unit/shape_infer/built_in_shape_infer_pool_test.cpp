@@ -142,3 +142,21 @@ INSTANTIATE_TEST_CASE_P(
                                                       {{1, 3, 227, 113}}}), padrb({0, 0}))
         )
 );
+
+class BuiltInShapeInferPool3DTest : public BuiltInShapeInferCommon {};
+
+TEST_F(BuiltInShapeInferPool3DTest, inferDepthOfFiveDimInput) {
+    auto impl = getShapeInferImpl("Pooling");
+    ASSERT_NE(nullptr, impl);
+    std::map<std::string, std::string> params = {
+            {"kernel-x", "2"}, {"kernel-y", "2"}, {"kernel-z", "2"},
+            {"stride-x", "2"}, {"stride-y", "2"}, {"stride-z", "2"},
+            {"pad-x",    "0"}, {"pad-y",    "0"}, {"pad-z",    "0"},
+            {"pool-method", "max"}
+    };
+    std::map<std::string, Blob::Ptr> blobs;
+    std::vector<SizeVector> outShapes;
+    sts = impl->inferShapes({{1, 8, 16, 28, 28}}, params, blobs, outShapes, &resp);
+    ASSERT_EQ(int(OK), sts) << resp.msg;
+    ASSERT_EQ(std::vector<SizeVector>({{1, 8, 8, 14, 14}}), outShapes);
+}
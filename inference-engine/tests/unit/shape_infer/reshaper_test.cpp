@@ -196,3 +196,60 @@ TEST_F(ReshaperTest, canUpdateFakeImpl) {
             WithArg<3>(Invoke([&](std::vector<SizeVector>& outShape) { outShape.push_back({2}); })), Return(OK)));
     reshaper.run({{"0", {2}}});
 }
+
+TEST_F(ReshaperTest, canReuseCachedShapesOnRepeatedReshape) {
+    EXPECT_CALL(mockNet, getInputsInfo(_)).WillRepeatedly(WithArg<0>(Invoke([&](InputsDataMap& maps) {
+        prepareInputs(maps);
+    })));
+    auto testCreator = std::make_shared<TestEmptyLauncherCreator>();
+    Reshaper reshaper(mockNet, testCreator);
+    auto newImpl = std::make_shared<MockIShapeInferImpl>();
+
+    const char* registered[] = {""};
+    auto extension = std::make_shared<MockShapeInferExtension>();
+    EXPECT_CALL(*extension.get(), getPrimitiveTypes(_, _, _)).WillOnce(DoAll(
+            WithArg<0>(Invoke([&](char**& type) { type = const_cast<char**>(registered); })),
+            WithArg<1>(Invoke([&](unsigned int& size) { size = 1; })),
+            Return(OK)));
+    EXPECT_CALL(*extension.get(), getShapeInferImpl(_, _, _)).WillOnce(DoAll(
+            WithArg<0>(Invoke([&](IShapeInferImpl::Ptr& impl) { impl = newImpl; })),
+            Return(OK)));
+    reshaper.AddExtension(extension);
+
+    EXPECT_CALL(*newImpl.get(), inferShapes(_, _, _, _, _)).
+            Times(2).
+            WillRepeatedly(DoAll(
+            WithArg<3>(Invoke([&](std::vector<SizeVector>& outShape) { outShape.push_back({2}); })), Return(OK)));
+    reshaper.run({{"0", {2}}});
+    reshaper.run({{"0", {3}}});
+    reshaper.run({{"0", {2}}});
+    reshaper.run({{"0", {3}}});
+}
+
+TEST_F(ReshaperTest, canDisableShapesCache) {
+    EXPECT_CALL(mockNet, getInputsInfo(_)).WillRepeatedly(WithArg<0>(Invoke([&](InputsDataMap& maps) {
+        prepareInputs(maps);
+    })));
+    auto testCreator = std::make_shared<TestEmptyLauncherCreator>();
+    Reshaper reshaper(mockNet, testCreator);
+    reshaper.setCacheSize(0);
+    auto newImpl = std::make_shared<MockIShapeInferImpl>();
+
+    const char* registered[] = {""};
+    auto extension = std::make_shared<MockShapeInferExtension>();
+    EXPECT_CALL(*extension.get(), getPrimitiveTypes(_, _, _)).WillOnce(DoAll(
+            WithArg<0>(Invoke([&](char**& type) { type = const_cast<char**>(registered); })),
+            WithArg<1>(Invoke([&](unsigned int& size) { size = 1; })),
+            Return(OK)));
+    EXPECT_CALL(*extension.get(), getShapeInferImpl(_, _, _)).WillOnce(DoAll(
+            WithArg<0>(Invoke([&](IShapeInferImpl::Ptr& impl) { impl = newImpl; })),
+            Return(OK)));
+    reshaper.AddExtension(extension);
+
+    EXPECT_CALL(*newImpl.get(), inferShapes(_, _, _, _, _)).
+            Times(2).
+            WillRepeatedly(DoAll(
+            WithArg<3>(Invoke([&](std::vector<SizeVector>& outShape) { outShape.push_back({2}); })), Return(OK)));
+    reshaper.run({{"0", {2}}});
+    reshaper.run({{"0", {2}}});
+}
@@ -153,12 +153,16 @@ typedef struct
     uint32_t dump_custom_program;                       ///< dump the custom generated program to files 
     const char* compiler_options;                       ///< OpenCL compiler options string.
     const char* single_kernel_name;                     ///< If provided, runs specific layer.
-    uint32_t enable_parallelisation;                    ///< Enables parallel execution of primitives which don't depend on each other. Disabled by default.
+    uint32_t enable_parallelisation;                    ///< Enables parallel execution of primitives which don't depend on each other in an out-of-order queue. Enabled by default.
     const char* engine_log;                             ///< Specifies a file to which engine log should be dumped. Null/empty values means no logging.
     const char* sources_dumps_dir;                      ///< Specifies a directory where sources of cldnn::program objects should be dumped. Null/empty values means no loggins.
     /*cldnn_priority_mode_type*/ int16_t priority_mode; ///< Priority mode (support of OpenCL priority hints in command queue).
     /*cldnn_throttle_mode_type*/ int16_t throttle_mode; ///< Placeholder for throttle mode (support of throttle hints in command queue). It has no effect for now and should be set to cldnn_throttle_disabled.
     uint32_t enable_memory_pool;                        ///< Enables memory usage optimization. memory objects will be reused when possible. 
+    const char* kernels_cache_path;                     ///< Specifies a directory where binaries of compiled OpenCL programs are cached between runs. Null/empty values means no caching.
+    uint32_t compilation_threads;                       ///< Number of threads compiling the OpenCL programs in parallel. 0 means the number of the host cores.
+    void* context;                                      ///< OpenCL context (cl_context) the engine runs on instead of creating its own. Null means a new context.
+    void* queue;                                        ///< OpenCL command queue (cl_command_queue) of the @p context the engine enqueues to. Null means a new queue.
 }  cldnn_engine_configuration;
 
 /// @brief Information about the engine returned by cldnn_get_engine_info().
@@ -180,6 +184,7 @@ typedef struct
     uint8_t supports_fp16_denorms;     ///< Does engine support denormalized FP16.
     uint8_t supports_subgroups_short;  ///< Does engine support cl_intel_subgroups_short.
     uint8_t supports_image;           ///< Does engine support images (CL_DEVICE_IMAGE_SUPPORT cap).
+    uint8_t host_unified_memory;      ///< Does the device share the physical memory with the host (integrated GPU).
 }  cldnn_engine_info;
 /// @}
 
@@ -623,6 +628,25 @@ CLDNN_API void cldnn_set_learning_rate(cldnn_network network, float lr, cldnn_st
 /// @brief Returns learning rate value.
 CLDNN_API float cldnn_get_learning_rate(cldnn_network network, cldnn_status* status);
 
+/// @brief Sets the handler called by the network execution after every @p slice primitives are enqueued.
+/// @details The execution submits the slice and waits for the previous one to complete before calling the handler,
+/// so the device runs at most two slices of the network ahead of the host. The handler may block to let the work
+/// of the other queues of the device run first. @p handler equal to NULL or @p slice equal to 0 removes the handler.
+/// @param[in] handler Pointer to @ref cldnn_event_handler call-back function.
+/// @param[in] param Pointer to the parameter passed to the handler.
+/// @param[in] slice The number of the primitives enqueued between the calls of the handler.
+CLDNN_API void cldnn_set_network_yield_handler(cldnn_network network, cldnn_event_handler handler, void* param, uint32_t slice, cldnn_status* status);
+
+/// @brief Returns non-zero if every primitive of the network can run a batch smaller than the batch of its inputs.
+/// @details Returns 0 if the inputs of the network have different batches.
+CLDNN_API int32_t cldnn_network_supports_runtime_batch(cldnn_network network, cldnn_status* status);
+
+/// @brief Sets the batch processed by the next executions of the network.
+/// @details The inputs keep the layouts of the topology and the executions read and write only their first @p batch
+/// batches. A batch other than the batch of the inputs requires @ref cldnn_network_supports_runtime_batch.
+/// @param[in] batch The batch in [1, the batch of the inputs].
+CLDNN_API void cldnn_set_network_batch(cldnn_network network, uint32_t batch, cldnn_status* status);
+
 /// @brief Returns information about particular primitive.
 /// @details Function fills user provided buffer by primitive description.
 /// @param[in] id Primitive @p id of @p input_layout primitive defined in @p topology.
@@ -706,6 +730,20 @@ CLDNN_API cldnn_memory cldnn_allocate_memory(cldnn_engine engine, cldnn_layout l
 /// @brief Create memory object attached to the buffer allocated by user.
 /// @note User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
 CLDNN_API cldnn_memory cldnn_attach_memory(cldnn_layout layout, void* pointer, size_t size, cldnn_status* status);
+/// @brief Create memory object on @p engine sharing the OpenCL buffer (cl_mem) created by user in the context of the engine.
+/// @note The buffer is retained by the memory object. The kernels reading the buffer are ordered after the commands
+/// enqueued before to the queue of the engine, the commands of the other queues have to complete before.
+CLDNN_API cldnn_memory cldnn_share_buffer(cldnn_engine engine, cldnn_layout layout, void* buffer, cldnn_status* status);
+/// @brief Allocate memory on @p engine in the host memory pinned for the transfers to and from the device.
+/// @details The memory stays mapped while it exists, so locking it costs nothing. The network copies the pinned input
+/// to the memory of the device without waiting for the copy. The device sharing the physical memory with the host
+/// (see ::cldnn_engine_info::host_unified_memory) reads the usual memory of the engine in place, so it is allocated
+/// instead.
+CLDNN_API cldnn_memory cldnn_allocate_host_memory(cldnn_engine engine, cldnn_layout layout, cldnn_status* status);
+/// @brief Copies @p src to @p dst of the same size on the queue of their engine, the pinned host memory
+/// (see cldnn_allocate_host_memory) is transferred by the DMA. The copy is ordered after the commands enqueued before.
+/// @param blocking Waits for the copy to complete if not 0.
+CLDNN_API void cldnn_copy_memory(cldnn_memory src, cldnn_memory dst, int32_t blocking, cldnn_status* status);
 /// @brief Checks if two memory objects refer to the same underlaying buffer.
 CLDNN_API int32_t cldnn_is_the_same_buffer(cldnn_memory mem1, cldnn_memory mem2, cldnn_status* status);
 /// @brief Increment reference counter for the memory object.
@@ -0,0 +1,60 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef GEMM_H
+#define GEMM_H
+
+#include <stdbool.h>
+#include "cldnn.h"
+/// @addtogroup c_api C API
+/// @{
+/// @addtogroup c_topology Network Topology
+/// @{
+/// @addtogroup c_primitives Primitives
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief Multiplies the matrices of the batch: output = alpha * op(input0) * op(input1) + beta * input2.
+/// @details The matrices are the y (rows) and x (columns) of the inputs, b and f are the batch of the matrices.
+/// A batch dimension of size 1 is broadcast to the batch dimension of the other input. The third input is optional,
+/// its matrix is broadcast to the rows and columns of the output.
+CLDNN_BEGIN_PRIMITIVE_DESC(gemm)
+/// @brief Scale of the product of the matrices.
+float alpha;
+/// @brief Scale of the third input added to the product.
+float beta;
+/// @brief The matrices of the first input are transposed before the multiplication.
+bool transpose_input0;
+/// @brief The matrices of the second input are transposed before the multiplication.
+bool transpose_input1;
+CLDNN_END_PRIMITIVE_DESC(gemm)
+
+CLDNN_DECLARE_PRIMITIVE_TYPE_ID(gemm);
+
+#ifdef __cplusplus
+}
+#endif
+
+/// @}
+/// @}
+/// @}
+#endif /* GEMM_H */
+
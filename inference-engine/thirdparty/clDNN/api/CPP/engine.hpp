@@ -59,12 +59,16 @@ struct engine_configuration
     const bool dump_custom_program;             ///< Dump the user OpenCL programs to files
     const std::string compiler_options;         ///< OpenCL compiler options string.
     const std::string single_kernel_name;       ///< If provided, runs specific layer.
-    const bool enable_parallelisation;          ///< Enables parallel execution of primitives which don't depend on each other. Disabled by default.
+    const bool enable_parallelisation;          ///< Enables parallel execution of primitives which don't depend on each other in an out-of-order queue. Enabled by default.
     const std::string engine_log;               ///< Specifies a file to which engine log should be dumped. Empty by default (means no logging).
     const std::string sources_dumps_dir;        ///< Specifies a directory where sources of cldnn::program objects should be dumped. Empty by default (means no dumping).
     const priority_mode_types priority_mode;    ///< Priority mode (support of priority hints in command queue). If cl_khr_priority_hints extension is not supported by current OpenCL implementation, the value must be set to cldnn_priority_disabled.
     const throttle_mode_types throttle_mode;    ///< Placeholder for throttle mode (support of throttle hints in command queue). It has no effect for now and should be set to cldnn_throttle_disabled.
     bool enable_memory_pool;              ///< Enables memory usage optimization. memory objects will be reused when possible (switched off for older drivers then NEO).
+    const std::string kernels_cache_path;       ///< Specifies a directory where binaries of compiled OpenCL programs are cached between runs. Empty by default (means no caching).
+    const uint32_t compilation_threads;         ///< Number of threads compiling the OpenCL programs in parallel. 0 by default (means the number of the host cores).
+    void* const context;                        ///< OpenCL context (cl_context) the engine runs on. Null by default (means a new context).
+    void* const queue;                          ///< OpenCL command queue (cl_command_queue) of the @p context the engine enqueues to. Null by default (means a new queue).
 
     /// @brief Constructs engine configuration with specified options.
     /// @param profiling Enable per-primitive profiling.
@@ -72,6 +76,11 @@ struct engine_configuration
     /// @param dump_custom_program Dump the custom OpenCL programs to files
     /// @param options OpenCL compiler options string.
     /// @param single_kernel If provided, runs specific layer.
+    /// @param primitives_parallelisation Run independent primitives in parallel in an out-of-order queue.
+    /// @param kernels_cache_path Directory where binaries of compiled OpenCL programs are cached between runs.
+    /// @param compilation_threads Number of threads compiling the OpenCL programs, 0 means the number of the host cores.
+    /// @param context OpenCL context (cl_context) created by user the engine runs on, the device of the engine is the first device of the context.
+    /// @param queue OpenCL command queue (cl_command_queue) of the @p context, the profiling and the out-of-order execution follow its properties.
     engine_configuration(
             bool profiling = false,
             bool decorate_kernel_names = false,
@@ -83,7 +92,11 @@ struct engine_configuration
             const std::string& sources_dumps_dir = std::string(),
             priority_mode_types priority_mode = priority_mode_types::disabled,
             throttle_mode_types throttle_mode = throttle_mode_types::disabled,
-            bool memory_pool = true)
+            bool memory_pool = true,
+            const std::string& kernels_cache_path = std::string(),
+            uint32_t compilation_threads = 0,
+            void* context = nullptr,
+            void* queue = nullptr)
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
         , dump_custom_program(dump_custom_program)
@@ -95,6 +108,10 @@ struct engine_configuration
         , priority_mode(priority_mode)
         , throttle_mode(throttle_mode)
         , enable_memory_pool(memory_pool)
+        , kernels_cache_path(kernels_cache_path)
+        , compilation_threads(compilation_threads)
+        , context(context)
+        , queue(queue)
     {}
 
     engine_configuration(const cldnn_engine_configuration& c_conf)
@@ -109,6 +126,10 @@ struct engine_configuration
         , priority_mode(static_cast<priority_mode_types>(c_conf.priority_mode))
         , throttle_mode(static_cast<throttle_mode_types>(c_conf.throttle_mode))
         , enable_memory_pool(c_conf.enable_memory_pool != 0)
+        , kernels_cache_path(c_conf.kernels_cache_path ? c_conf.kernels_cache_path : "")
+        , compilation_threads(c_conf.compilation_threads)
+        , context(c_conf.context)
+        , queue(c_conf.queue)
     {}
 
     /// @brief Implicit conversion to C API @ref ::cldnn_engine_configuration
@@ -125,7 +146,11 @@ struct engine_configuration
             sources_dumps_dir.c_str(),
             static_cast<int16_t>(priority_mode),
             static_cast<int16_t>(throttle_mode),
-            enable_memory_pool
+            enable_memory_pool,
+            kernels_cache_path.c_str(),
+            compilation_threads,
+            context,
+            queue
         };
     }
 };
@@ -0,0 +1,95 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "../C/gemm.h"
+#include "primitive.hpp"
+
+namespace cldnn
+{
+/// @addtogroup cpp_api C++ API
+/// @{
+/// @addtogroup cpp_topology Network Topology
+/// @{
+/// @addtogroup cpp_primitives Primitives
+/// @{
+
+/// @brief Multiplies the matrices of the batch: output = alpha * op(input0) * op(input1) + beta * input2.
+/// @details The matrices are the y (rows) and x (columns) of the inputs, b and f are the batch of the matrices.
+/// A batch dimension of size 1 is broadcast to the batch dimension of the other input. The third input is optional,
+/// its matrix is broadcast to the rows and columns of the output.
+struct gemm : public primitive_base<gemm, CLDNN_PRIMITIVE_DESC(gemm)>
+{
+    CLDNN_DECLARE_PRIMITIVE(gemm)
+
+    /// @brief Constructs gemm primitive.
+    /// @param id This primitive id.
+    /// @param inputs The two matrices to multiply and the optional matrix added to the product.
+    /// @param transpose_input0 The matrices of the first input are transposed.
+    /// @param transpose_input1 The matrices of the second input are transposed.
+    /// @param alpha Scale of the product of the matrices.
+    /// @param beta Scale of the third input.
+    gemm(
+        const primitive_id& id,
+        const std::vector<primitive_id>& inputs,
+        bool transpose_input0 = false,
+        bool transpose_input1 = false,
+        float alpha = 1.0f,
+        float beta = 0.0f,
+        const padding& output_padding = padding()
+    )
+        : primitive_base(id, inputs, output_padding)
+        , alpha(alpha)
+        , beta(beta)
+        , transpose_input0(transpose_input0)
+        , transpose_input1(transpose_input1)
+    {
+    }
+
+    /// @brief Constructs a copy from basic C API @CLDNN_PRIMITIVE_DESC{gemm}
+    gemm(const dto* dto)
+        : primitive_base(dto)
+        , alpha(dto->alpha)
+        , beta(dto->beta)
+        , transpose_input0(dto->transpose_input0)
+        , transpose_input1(dto->transpose_input1)
+    {
+    }
+
+    /// @brief Scale of the product of the matrices.
+    float alpha;
+    /// @brief Scale of the third input added to the product.
+    float beta;
+    /// @brief The matrices of the first input are transposed before the multiplication.
+    bool transpose_input0;
+    /// @brief The matrices of the second input are transposed before the multiplication.
+    bool transpose_input1;
+
+protected:
+    void update_dto(dto& dto) const override
+    {
+        dto.alpha = alpha;
+        dto.beta = beta;
+        dto.transpose_input0 = transpose_input0;
+        dto.transpose_input1 = transpose_input1;
+    }
+};
+/// @}
+/// @}
+/// @}
+}
@@ -58,6 +58,19 @@ struct memory
         });
     }
 
+    /// Allocate memory on @p engine in the host memory pinned for the transfers to and from the device
+    /// @details The memory stays mapped, the network copies the pinned input to the device without waiting for the copy.
+    /// The device sharing the memory with the host gets the usual memory of the engine (see ::cldnn_allocate_host_memory).
+    static memory allocate_host(const engine& engine, const layout& layout)
+    {
+        size_t size = layout.bytes_count();
+        if (size == 0) throw std::invalid_argument("size should be more than 0");
+        return check_status<cldnn_memory>("host memory allocation failed", [&](status_t* status)
+        {
+            return cldnn_allocate_host_memory(engine.get(), layout, status);
+        });
+    }
+
     /// Create memory object attached to the buffer allocated by user.
     /// @param ptr  The pointer to user allocated buffer.
     /// @param size Size (in bytes) of the buffer. Should be equal to @p layout.data_size()
@@ -78,6 +91,19 @@ struct memory
         });
     }
 
+    /// Create memory object on @p engine sharing the OpenCL buffer created by user.
+    /// @param buffer The OpenCL buffer (cl_mem) of the context of the @p engine, at least @p layout.bytes_count() bytes.
+    /// @note The memory object retains the buffer. The commands writing the buffer in other queues than the one
+    /// of the engine have to complete before the network reading it executes.
+    static memory share_buffer(const engine& engine, const layout& layout, void* buffer)
+    {
+        if (!buffer) throw std::invalid_argument("buffer should not be null");
+        return check_status<cldnn_memory>("memory sharing failed", [&](status_t* status)
+        {
+            return cldnn_share_buffer(engine.get(), layout, buffer, status);
+        });
+    }
+
     memory(const memory& other)
         :_impl(other._impl), _layout(other._layout)
         ,_size(other._size), _count(other._count)
@@ -124,6 +150,16 @@ struct memory
         return my_engine == engine.get();
     }
 
+    /// Copies the memory to @p dst of the same size on the queue of the engine (see ::cldnn_copy_memory)
+    /// @param blocking Waits for the copy to complete.
+    void copy_to(const memory& dst, bool blocking = true) const
+    {
+        check_status<void>("memory copy failed", [&](status_t* status)
+        {
+            cldnn_copy_memory(_impl, dst._impl, blocking ? 1 : 0, status);
+        });
+    }
+
     bool is_the_same_buffer(const memory& other) const
     {
         return check_status<bool>("checking if two memories refers to the same buffer failed", [&](status_t* status)
@@ -136,6 +136,26 @@ struct network
         return check_status<float>("get learning rate failed", [&](status_t* status) { return cldnn_get_learning_rate(_impl, status); });
     }
 
+    /// @brief Sets the handler called after every @p slice primitives of the execution are submitted to the device.
+    /// @details The handler may block to let the work of the other queues run between the slices of the network.
+    /// @p handler equal to nullptr removes the handler.
+    void set_yield_handler(void(*handler)(void*), void* param, uint32_t slice)
+    {
+        check_status<void>("set yield handler failed", [&](status_t* status) { cldnn_set_network_yield_handler(_impl, handler, param, slice, status); });
+    }
+
+    /// @brief Returns true if the network can run a batch smaller than the batch of its inputs, see set_batch().
+    bool supports_runtime_batch() const
+    {
+        return check_status<int32_t>("query runtime batch failed", [&](status_t* status) { return cldnn_network_supports_runtime_batch(_impl, status); }) != 0;
+    }
+
+    /// @brief Sets the batch processed by the next executions: the first @p batch batches of the inputs and outputs.
+    void set_batch(uint32_t batch)
+    {
+        check_status<void>("set network batch failed", [&](status_t* status) { cldnn_set_network_batch(_impl, batch, status); });
+    }
+
    
     std::string get_primitive_info(const primitive_id& id) const
     {
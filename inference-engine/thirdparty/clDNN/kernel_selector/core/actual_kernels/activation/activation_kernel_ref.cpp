@@ -38,6 +38,14 @@ namespace kernel_selector {
 
     KernelsData ActivationKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
     {
-        return GetCommonKernelsData(params, options);
+        KernelsData kds = GetCommonKernelsData(params, options);
+
+        // the third global dimension is F*B with the batch slowest, the yxfb work groups put it first
+        const auto& out = static_cast<const activation_params&>(params).output;
+        if (!kds.empty() && out.GetLayout() != DataLayout::yxfb)
+        {
+            SetRuntimeBatch(kds[0].kernels[0], 2, out.Batch().v);
+        }
+        return kds;
     }
 }
\ No newline at end of file
@@ -0,0 +1,120 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "convolution_kernel_bfyx_1x1_image.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    // every work item computes a block of the consecutive pixels of one output feature
+    static const size_t pixelsBlock = 4;
+
+    ParamsKey ConvolutionKernel_bfyx_1x1_image::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputWeightsType(WeightsType::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBiasPerFeature();
+        k.EnableNonBiasTerm();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool ConvolutionKernel_bfyx_1x1_image::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!Parent::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const convolution_params&>(p);
+
+        const auto& input = params.inputs[0];
+        const auto& output = params.output;
+
+        // the pixels of an input feature are read as one contiguous row, and a texel holds 4 input features
+        const bool bOutputSizes = output.X().v != input.X().v || output.Y().v != input.Y().v;
+        const bool bPad = input.X().pad.Total() != 0 || input.Y().pad.Total() != 0 || input.Feature().pad.Total() != 0 || input.Batch().pad.Total() != 0;
+        const bool bFilterSize = params.filterSize.x != 1 || params.filterSize.y != 1;
+        const bool bStride = params.stride.x != 1 || params.stride.y != 1;
+        const bool bFeatures = input.Feature().v % 4 != 0;
+
+        if (bOutputSizes || bPad || bFilterSize || bStride || bFeatures)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    ConvolutionKernelBase::DispatchData ConvolutionKernel_bfyx_1x1_image::SetDefault(const convolution_params& params, int) const
+    {
+        DispatchData runInfo = Parent::SetDefault(params);
+
+        const auto& out = params.output;
+
+        std::vector<size_t> global = { CeilDiv(out.X().v * out.Y().v, pixelsBlock), out.Feature().v, out.Batch().v };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        runInfo.gws0 = global[0];
+        runInfo.gws1 = global[1];
+        runInfo.gws2 = global[2];
+
+        runInfo.lws0 = local[0];
+        runInfo.lws1 = local[1];
+        runInfo.lws2 = local[2];
+
+        // every weight of the small outputs is used by a few pixels only, its reads dominate there
+        runInfo.effiency = out.X().v * out.Y().v <= 64 ? FORCE_PRIORITY_2 : FORCE_PRIORITY_7;
+
+        return runInfo;
+    }
+
+    JitConstants ConvolutionKernel_bfyx_1x1_image::GetJitConstants(const convolution_params& params, const DispatchData& kd) const
+    {
+        auto jit = Parent::GetJitConstants(params, kd);
+
+        const size_t pixels = params.output.X().v * params.output.Y().v;
+
+        jit.AddConstant(MakeJitConstant("PIXELS_BLOCK", pixelsBlock));
+        if (pixels % pixelsBlock)
+            jit.AddConstant(MakeJitConstant("LEFTOVERS", 1));
+
+        return jit;
+    }
+
+    KernelsData ConvolutionKernel_bfyx_1x1_image::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        KernelsData kds = GetCommonKernelsData(params, options);
+
+        // the batch is the third global dimension
+        if (!kds.empty())
+        {
+            SetRuntimeBatch(kds[0].kernels[0], 2, static_cast<const convolution_params&>(params).output.Batch().v);
+        }
+        return kds;
+    }
+}
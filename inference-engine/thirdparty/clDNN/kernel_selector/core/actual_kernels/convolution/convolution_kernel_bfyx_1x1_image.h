@@ -0,0 +1,44 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#pragma once
+
+#include "convolution_kernel_base.h"
+
+namespace kernel_selector
+{
+    // The 1x1 convolution reading the weights from a 4-channel image (image_2d_weights_c4_fyx_b), so the weights
+    // shared by the neighbouring work items come from the texture cache. It is preferred for the small outputs of
+    // the late layers, where the weights outweigh the input. The weights which exceed the image size limits of the
+    // device are rejected by UpdateWeightsParams and keep the buffer kernels.
+    class ConvolutionKernel_bfyx_1x1_image : public ConvolutionKernelBase
+    {
+    public:
+        using Parent = ConvolutionKernelBase;
+        ConvolutionKernel_bfyx_1x1_image() : ConvolutionKernelBase("convolution_gpu_bfyx_1x1_image") {}
+        virtual ~ConvolutionKernel_bfyx_1x1_image() {}
+
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        bool Validate(const Params&, const optional_params&) const override;
+        std::vector<WeightsLayout> GetSupportedWeightLayouts(const convolution_params&) const override { return{ WeightsLayout::image_2d_weights_c4_fyx_b }; }
+        JitConstants GetJitConstants(const convolution_params& params, const DispatchData& kd) const override;
+        DispatchData SetDefault(const convolution_params& params, int autoTuneIndex = -1) const override;
+    };
+}
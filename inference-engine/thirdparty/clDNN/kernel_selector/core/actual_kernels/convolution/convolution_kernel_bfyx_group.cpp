@@ -0,0 +1,123 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "convolution_kernel_bfyx_group.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    ParamsKey ConvolutionKernel_bfyx_Group::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputWeightsType(WeightsType::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableInputLayout(DataLayout::byxf);
+        k.EnableOutputLayout(DataLayout::byxf);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableDilation();
+        k.EnableBiasPerFeature();
+        k.EnableNonBiasTerm();
+        k.EnableBatching();
+        k.EnableSplitSupport();
+        k.EnableDepthwiseSeparableOpt();
+        k.DisableTuning();
+        return k;
+    }
+
+    bool ConvolutionKernel_bfyx_Group::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!Parent::Validate(p, o))
+        {
+            return false;
+        }
+
+        const convolution_params& cp = static_cast<const convolution_params&>(p);
+
+        // the groups are only merged into one buffer by the depthwise separable optimization
+        if (!cp.depthwiseSeparableOpt ||
+            cp.split < 2 ||
+            cp.weights.OFM().v % cp.split != 0 ||
+            cp.output.Feature().v != cp.weights.OFM().v)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    ConvolutionKernelBase::DispatchData ConvolutionKernel_bfyx_Group::SetDefault(const convolution_params& params, int) const
+    {
+        DispatchData runInfo = Parent::SetDefault(params);
+
+        const auto& out = params.output;
+
+        // a work item computes a row of the outputs of one feature, reusing every weight along it
+        const size_t blockWidth = std::min<size_t>(out.X().v, 8);
+
+        std::vector<size_t> global = { CeilDiv(out.X().v, blockWidth), out.Y().v, out.Feature().v * out.Batch().v };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        runInfo.gws0 = global[0];
+        runInfo.gws1 = global[1];
+        runInfo.gws2 = global[2];
+
+        runInfo.lws0 = local[0];
+        runInfo.lws1 = local[1];
+        runInfo.lws2 = local[2];
+
+        runInfo.cldnnStyle.blockWidth = blockWidth;
+        runInfo.cldnnStyle.blockHeight = 1;
+
+        // one dispatch beats the kernel per group, the 3x3 depthwise kernel is still preferred where it applies
+        runInfo.effiency = FORCE_PRIORITY_6;
+
+        return runInfo;
+    }
+
+    JitConstants ConvolutionKernel_bfyx_Group::GetJitConstants(const convolution_params& params, const DispatchData& kd) const
+    {
+        auto jit = Parent::GetJitConstants(params, kd);
+
+        jit.AddConstants({
+            MakeJitConstant("GROUP_OFM_NUM",      params.weights.OFM().v / params.split),
+            MakeJitConstant("OUTPUT_BLOCK_WIDTH", kd.cldnnStyle.blockWidth),
+        });
+
+        return jit;
+    }
+
+    KernelsData ConvolutionKernel_bfyx_Group::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        KernelsData kds = GetCommonKernelsData(params, options);
+
+        // the third global dimension is F*B with the batch slowest
+        const auto& out = static_cast<const convolution_params&>(params).output;
+        if (!kds.empty())
+        {
+            SetRuntimeBatch(kds[0].kernels[0], 2, out.Batch().v);
+        }
+        return kds;
+    }
+}
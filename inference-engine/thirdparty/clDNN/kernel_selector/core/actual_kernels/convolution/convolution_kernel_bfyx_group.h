@@ -0,0 +1,43 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#pragma once
+
+#include "convolution_kernel_base.h"
+
+namespace kernel_selector
+{
+    // Runs all the groups of a grouped convolution in one dispatch. The weights and the biases of the groups are
+    // concatenated into one buffer by the depthwise separable optimization of the program, so it covers any group
+    // count and filter size (the depthwise convolutions other than 3x3 included).
+    class ConvolutionKernel_bfyx_Group : public ConvolutionKernelBase
+    {
+    public:
+        using Parent = ConvolutionKernelBase;
+        ConvolutionKernel_bfyx_Group() : ConvolutionKernelBase("convolution_gpu_bfyx_group") {}
+        virtual ~ConvolutionKernel_bfyx_Group() {}
+
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        bool Validate(const Params&, const optional_params&) const override;
+        std::vector<WeightsLayout> GetSupportedWeightLayouts(const convolution_params&) const override { return{ WeightsLayout::oiyx }; }
+        JitConstants GetJitConstants(const convolution_params& params, const DispatchData& kd) const override;
+        DispatchData SetDefault(const convolution_params& params, int autoTuneIndex = -1) const override;
+    };
+}
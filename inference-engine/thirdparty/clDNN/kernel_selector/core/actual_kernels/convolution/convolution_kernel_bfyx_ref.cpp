@@ -52,6 +52,14 @@ namespace kernel_selector {
 
     KernelsData ConvolutionKernel_bfyx_Ref::GetKernelsData(const Params& params, const optional_params& options) const
     {
-        return GetCommonKernelsData(params, options);
+        KernelsData kds = GetCommonKernelsData(params, options);
+
+        // the third global dimension is F*B with the batch slowest
+        const auto& out = static_cast<const convolution_params&>(params).output;
+        if (!kds.empty() && (out.GetLayout() == DataLayout::bfyx || out.GetLayout() == DataLayout::byxf))
+        {
+            SetRuntimeBatch(kds[0].kernels[0], 2, out.Batch().v);
+        }
+        return kds;
     }
 }
\ No newline at end of file
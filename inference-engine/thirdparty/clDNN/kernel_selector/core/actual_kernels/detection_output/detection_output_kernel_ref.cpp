@@ -0,0 +1,179 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "detection_output_kernel_ref.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        // The sorting runs over the power of two sized buffers
+        size_t RoundUpToPowerOfTwo(size_t value)
+        {
+            size_t result = 1;
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        std::string toString(DetectionOutputCodeType type)
+        {
+            switch (type)
+            {
+            case DetectionOutputCodeType::CORNER:      return "CORNER";
+            case DetectionOutputCodeType::CENTER_SIZE: return "CENTER_SIZE";
+            case DetectionOutputCodeType::CORNER_SIZE: return "CORNER_SIZE";
+            default: return "";
+            }
+        }
+
+        struct DetectionOutputSizes
+        {
+            size_t num_images;
+            size_t num_loc_classes;
+            size_t candidates_capacity;     // per image and class, for the sorting of the confidences
+            size_t kept_per_class;          // the most detections of one class kept by the NMS
+            size_t scratch_capacity;        // the detections of all the classes of an image
+            size_t work_group_size;
+        };
+
+        DetectionOutputSizes GetSizes(const detection_output_params& params)
+        {
+            DetectionOutputSizes sizes;
+            sizes.num_images = params.inputs[0].Batch().v;
+            sizes.num_loc_classes = params.share_location ? 1 : params.num_classes;
+            sizes.candidates_capacity = RoundUpToPowerOfTwo(params.num_priors);
+            sizes.kept_per_class = params.top_k >= 0 ? std::min<size_t>(params.top_k, params.num_priors) : params.num_priors;
+            sizes.scratch_capacity = RoundUpToPowerOfTwo(std::max<size_t>(params.num_classes * sizes.kept_per_class, 1));
+            sizes.work_group_size = std::max<size_t>(1, std::min<size_t>(256, params.engineInfo.maxWorkGroupSize));
+            return sizes;
+        }
+    }
+
+    ParamsKey DetectionOutputKernelRef::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    JitConstants DetectionOutputKernelRef::GetJitConstants(const detection_output_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+        const auto sizes = GetSizes(params);
+
+        jit.AddConstants({
+            MakeJitConstant("NUM_IMAGES",                   sizes.num_images),
+            MakeJitConstant("NUM_CLASSES",                  params.num_classes),
+            MakeJitConstant("NUM_LOC_CLASSES",              sizes.num_loc_classes),
+            MakeJitConstant("NUM_PRIORS",                   params.num_priors),
+            MakeJitConstant("KEEP_TOP_K",                   params.keep_top_k),
+            MakeJitConstant("TOP_K",                        params.top_k),
+            MakeJitConstant("BACKGROUND_LABEL_ID",          params.background_label_id),
+            MakeJitConstant("SHARE_LOCATION",               params.share_location),
+            MakeJitConstant("NMS_THRESHOLD",                params.nms_threshold),
+            MakeJitConstant("ETA",                          params.eta),
+            MakeJitConstant("CODE_TYPE_" + toString(params.code_type), 1),
+            MakeJitConstant("VARIANCE_ENCODED_IN_TARGET",   params.variance_encoded_in_target),
+            MakeJitConstant("CONFIDENCE_THRESHOLD",         params.confidence_threshold),
+            MakeJitConstant("PRIOR_INFO_SIZE",              params.prior_info_size),
+            MakeJitConstant("PRIOR_COORDINATES_OFFSET",     params.prior_coordinates_offset),
+            MakeJitConstant("PRIOR_IS_NORMALIZED",          params.prior_is_normalized),
+            MakeJitConstant("IMAGE_WIDTH",                  params.input_width),
+            MakeJitConstant("IMAGE_HEIGHT",                 params.input_height),
+            MakeJitConstant("DECREASE_LABEL_ID",            params.decrease_label_id),
+            MakeJitConstant("CLIP",                         params.clip),
+            MakeJitConstant("CANDIDATES_CAPACITY",          sizes.candidates_capacity),
+            MakeJitConstant("SCRATCH_CAPACITY",             sizes.scratch_capacity),
+            MakeJitConstant("LWS",                          sizes.work_group_size),
+        });
+
+        return jit;
+    }
+
+    KernelsData DetectionOutputKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        assert(params.GetType() == KernelType::DETECTION_OUTPUT);
+        const detection_output_params& orgParams = static_cast<const detection_output_params&>(params);
+
+        if (orgParams.inputs.size() != 3 || orgParams.keep_top_k <= 0 || orgParams.num_priors == 0)
+        {
+            return{};
+        }
+
+        const auto sizes = GetSizes(orgParams);
+        const size_t num_image_classes = sizes.num_images * orgParams.num_classes;
+
+        KernelData kd = KernelData::Default<detection_output_params>(params, 3);
+        kd.internalBufferSizes = {
+            sizes.num_images * sizes.num_loc_classes * orgParams.num_priors * 4 * sizeof(float),   // decoded boxes
+            num_image_classes * sizes.candidates_capacity * 2 * sizeof(float),                      // (score, prior) pairs
+            num_image_classes * 2 * sizeof(int32_t),                                                // kept counts, offsets
+            sizes.scratch_capacity * 4 * sizeof(float),                                             // (score, label, prior)
+        };
+
+        const char* stages[] = { "DECODE", "NMS", "OUTPUT" };
+        for (size_t i = 0; i < kd.kernels.size(); i++)
+        {
+            DispatchData runInfo;
+            runInfo.fp16UnitUsed = orgParams.inputs[0].GetDType() == Datatype::F16;
+            if (i == 0)
+            {
+                // a work item per prior and location class of every image
+                std::vector<size_t> global = { sizes.num_images * sizes.num_loc_classes * orgParams.num_priors, 1, 1 };
+                auto local = GetOptimalLocalWorkGroupSizes(global);
+                runInfo.gws0 = global[0];
+                runInfo.lws0 = local[0];
+            }
+            else
+            {
+                // a work group per image and class, a single work group selects the detections of all the images
+                runInfo.gws0 = (i == 1 ? num_image_classes : 1) * sizes.work_group_size;
+                runInfo.lws0 = sizes.work_group_size;
+            }
+            runInfo.gws1 = runInfo.gws2 = 1;
+            runInfo.lws1 = runInfo.lws2 = 1;
+
+            auto cldnn_jit = GetJitConstants(orgParams);
+            cldnn_jit.AddConstant(MakeJitConstant(std::string("DETECTION_OUTPUT_STAGE_") + stages[i], 1));
+            auto entry_point = GetEntryPoint(kernelName, orgParams.layerID, options);
+            auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+            auto& kernel = kd.kernels[i];
+            FillCLKernelData(kernel, runInfo, kernelName, jit, entry_point, ROUND_ROBIN, false, false, 3);
+            for (uint32_t buffer = 0; buffer < kd.internalBufferSizes.size(); buffer++)
+            {
+                kernel.arguments.push_back({ ArgumentDescriptor::Types::INTERNAL_BUFFER, buffer });
+            }
+        }
+
+        kd.estimatedTime = FORCE_PRIORITY_9;
+
+        return{ kd };
+    }
+}
@@ -0,0 +1,94 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#pragma once
+
+#include "common_kernel_base.h"
+#include "kernel_selector_params.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // DetectionOutputCodeType
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class DetectionOutputCodeType
+    {
+        CORNER,
+        CENTER_SIZE,
+        CORNER_SIZE,
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // detection_output_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct detection_output_params : public base_params
+    {
+        detection_output_params() : base_params(KernelType::DETECTION_OUTPUT) {}
+
+        uint32_t num_classes;
+        uint32_t num_priors;
+        int32_t keep_top_k;
+        int32_t top_k;
+        int32_t background_label_id;
+        bool share_location;
+        float nms_threshold;
+        float eta;
+        DetectionOutputCodeType code_type;
+        bool variance_encoded_in_target;
+        float confidence_threshold;
+        int32_t prior_info_size;
+        int32_t prior_coordinates_offset;
+        bool prior_is_normalized;
+        int32_t input_width;
+        int32_t input_height;
+        bool decrease_label_id;
+        bool clip;
+
+        virtual ParamsKey GetParamsKey() const
+        {
+            auto k = base_params::GetParamsKey();
+            return k;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // detection_output_optional_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct detection_output_optional_params : optional_params
+    {
+        detection_output_optional_params() : optional_params(KernelType::DETECTION_OUTPUT) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // DetectionOutputKernelRef
+    // Runs the detection output on the device in three kernels: decoding of the boxes, per image and class
+    // sorting of the confidences with the NMS (a work group each) and the selection of the kept detections
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class DetectionOutputKernelRef : public common_kernel_base
+    {
+    public:
+        DetectionOutputKernelRef() : common_kernel_base("detection_output_gpu_ref") {}
+        virtual ~DetectionOutputKernelRef() {}
+
+        using DispatchData = CommonDispatchData;
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        virtual JitConstants GetJitConstants(const detection_output_params& params) const;
+    };
+}
@@ -37,6 +37,34 @@ namespace kernel_selector {
 
     KernelsData EltwiseKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
     {
-        return GetCommonKernelsData(params, options);
+        KernelsData kds = GetCommonKernelsData(params, options);
+        if (kds.empty())
+        {
+            return kds;
+        }
+
+        const eltwise_params& orgParams = static_cast<const eltwise_params&>(params);
+        const auto& out = orgParams.output;
+        const auto& in = orgParams.inputs[0];
+        auto& kernel = kds[0].kernels[0];
+
+        if (orgParams.eltwiseParams.layoutBased || orgParams.eltwiseParams.int8_quantization)
+        {
+            SetRuntimeBatch(kernel, GetTensorFriendlyWorkGroupsBatchDim(in), in.Batch().v);
+        }
+        else
+        {
+            // the flat index of the same dims and the last global dimension of the output dims run the batches one
+            // after another only when the batch is the outermost dimension
+            const auto dims = out.GetDims().size();
+            const auto b = DataTensor::Channelndex(out.GetLayout(), Tensor::DataChannelName::BATCH);
+            if (b == static_cast<int>(dims) - 1)
+            {
+                const size_t dim = CheckInputsOutputNoPitchSameDims(orgParams) ? 0 : std::min<size_t>(b, 2);
+                SetRuntimeBatch(kernel, dim, out.Batch().v);
+            }
+        }
+
+        return kds;
     }
 }
\ No newline at end of file
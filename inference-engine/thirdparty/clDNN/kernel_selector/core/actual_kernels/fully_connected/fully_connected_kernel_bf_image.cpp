@@ -0,0 +1,90 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "fully_connected_kernel_bf_image.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    // every work item accumulates all the batches of its output feature
+    static const size_t maxBatch = 8;
+
+    ParamsKey FullyConnected_bf_image::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputWeightsType(WeightsType::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableInputLayout(DataLayout::bf);
+        k.EnableOutputLayout(DataLayout::bf);
+        k.EnableBiasPerFeature();
+        k.EnableNonBiasTerm();
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool FullyConnected_bf_image::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!Parent::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const fully_connected_params&>(p);
+        const auto& input = params.inputs[0];
+
+        // a texel holds 4 consecutive inputs, the kernel has no tail for the rest
+        const size_t inputsCount = input.LogicalSize() / input.Batch().v;
+        if (inputsCount % 4 != 0 ||
+            input.Batch().v > maxBatch ||
+            params.output.Batch().v != input.Batch().v)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::unique_ptr<FullyConnected_bf_image::DispatchData> FullyConnected_bf_image::SetDefault(const fully_connected_params& arg) const
+    {
+        auto runInfo = Parent::SetDefault(arg);
+
+        std::vector<size_t> global = { arg.output.Feature().v, 1, 1 };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        runInfo->gws0 = global[0];
+        runInfo->gws1 = global[1];
+        runInfo->gws2 = global[2];
+
+        runInfo->lws0 = local[0];
+        runInfo->lws1 = local[1];
+        runInfo->lws2 = local[2];
+
+        return std::move(runInfo);
+    }
+
+    KernelsData FullyConnected_bf_image::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options, DataLayout::bf, { WeightsLayout::image_2d_weights_c4_fyx_b }, FORCE_PRIORITY_3);
+    }
+}
@@ -0,0 +1,41 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#pragma once
+
+#include "fully_connected_kernel_base.h"
+
+namespace kernel_selector
+{
+    // Reads the weights from a 4-channel image (image_2d_weights_c4_fyx_b) through the texture cache. The weights
+    // are read once for all the batches, which makes it the fastest for the small batches where the fully connected
+    // layer is bound by the weights bandwidth. The weights which exceed the image size limits of the device are
+    // rejected by UpdateWeightsParams and keep the buffer kernels.
+    class FullyConnected_bf_image : public FullyConnectedKernelBase
+    {
+    public:
+        using Parent = FullyConnectedKernelBase;
+        FullyConnected_bf_image() : Parent("fully_connected_gpu_bf_image") {}
+
+        KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        ParamsKey GetSupportedKey() const override;
+
+    protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
+        std::unique_ptr<DispatchData> SetDefault(const fully_connected_params& arg) const override;
+    };
+}
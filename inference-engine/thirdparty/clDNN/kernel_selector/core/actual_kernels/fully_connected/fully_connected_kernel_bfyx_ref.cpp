@@ -66,7 +66,14 @@ namespace kernel_selector
 
     KernelsData FullyConnected_bfyx_Ref::GetKernelsData(const Params& params, const optional_params& options) const
     {
-        return GetCommonKernelsData(params, options, DataLayout::bfyx,
+        KernelsData kds = GetCommonKernelsData(params, options, DataLayout::bfyx,
         { WeightsLayout::oiyx, WeightsLayout::oyxi, WeightsLayout::iyxo, WeightsLayout::yxio });
+
+        // a work item per output of one batch, the batch is the second global dimension
+        if (!kds.empty())
+        {
+            SetRuntimeBatch(kds[0].kernels[0], 1, static_cast<const fully_connected_params&>(params).output.Batch().v);
+        }
+        return kds;
     }
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "gemm_kernel_base.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    JitConstants GemmKernelBase::GetJitConstants(const gemm_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+
+        jit.AddConstants({
+            MakeJitConstant("ALPHA", params.alpha),
+            MakeJitConstant("BETA", params.beta),
+            MakeJitConstant("TRANSPOSE_INPUT0", params.transpose_input0),
+            MakeJitConstant("TRANSPOSE_INPUT1", params.transpose_input1),
+            MakeJitConstant("INPUT2_TERM", params.inputs.size() > 2),
+        });
+
+        return jit;
+    }
+
+    KernelsData GemmKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const gemm_params& orgParams = static_cast<const gemm_params&>(params);
+
+        KernelData kd = KernelData::Default<gemm_params>(params);
+
+        const auto& out = orgParams.output;
+        auto& kernel = kd.kernels[0];
+        auto cldnnJit = GetJitConstants(orgParams);
+        auto entryPoint = GetEntryPoint(kernelName, orgParams.layerID, options);
+        auto jit = CreateJit(kernelName, cldnnJit, entryPoint);
+
+        // a work item per element of the output, the matrices of the batch are the third dimension
+        kernel.workGroups.global = { out.X().v, out.Y().v, out.Feature().v * out.Batch().v };
+        kernel.workGroups.local = GetOptimalLocalWorkGroupSizes(kernel.workGroups.global);
+        kernel.kernelString = GetKernelString(kernelName, jit, entryPoint, ROUND_ROBIN);
+        kernel.arguments = GetArgsDesc(static_cast<uint32_t>(orgParams.inputs.size()), false, false);
+
+        kd.estimatedTime = DONT_USE_IF_HAVE_SOMETHING_ELSE;
+
+        return{ kd };
+    }
+}
@@ -0,0 +1,70 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#pragma once
+
+#include "common_kernel_base.h"
+#include "kernel_selector_params.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // gemm_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct gemm_params : public base_params
+    {
+        gemm_params() : base_params(KernelType::GEMM) {}
+
+        float alpha = 1.0f;
+        float beta = 0.0f;
+        bool transpose_input0 = false;
+        bool transpose_input1 = false;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // gemm_optional_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct gemm_optional_params : optional_params
+    {
+        gemm_optional_params() : optional_params(KernelType::GEMM) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GemmKernelBase
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class GemmKernelBase : public common_kernel_base
+    {
+    public:
+        using common_kernel_base::common_kernel_base;
+        virtual ~GemmKernelBase() {}
+
+    protected:
+        virtual JitConstants GetJitConstants(const gemm_params& params) const;
+        KernelsData GetCommonKernelsData(const Params& params, const optional_params& optParams) const;
+
+        bool Validate(const Params& p, const optional_params&) const override
+        {
+            if (p.GetType() != KernelType::GEMM)
+            {
+                return false;
+            }
+
+            const gemm_params& params = static_cast<const gemm_params&>(p);
+            return params.inputs.size() == 2 || params.inputs.size() == 3;
+        }
+    };
+}
@@ -0,0 +1,52 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "gemm_kernel_ref.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector {
+
+    ParamsKey GemmKernelRef::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableInputLayout(DataLayout::yxfb);
+        k.EnableInputLayout(DataLayout::byxf);
+        k.EnableInputLayout(DataLayout::fyxb);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    KernelsData GemmKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        KernelsData kds = GetCommonKernelsData(params, options);
+
+        // the third global dimension is F*B with the batch slowest
+        if (!kds.empty())
+        {
+            SetRuntimeBatch(kds[0].kernels[0], 2, static_cast<const gemm_params&>(params).output.Batch().v);
+        }
+        return kds;
+    }
+}
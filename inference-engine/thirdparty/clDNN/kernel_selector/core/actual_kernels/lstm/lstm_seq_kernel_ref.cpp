@@ -0,0 +1,179 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "lstm_seq_kernel_ref.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        // The positions of the i, o, f and z gates in the weights for the gate orders of lstm_elt_params
+        const size_t gate_positions[][4] = { { 0, 1, 2, 3 }, { 0, 2, 1, 3 } };
+
+        size_t GetHiddenSize(const lstm_seq_params& params)
+        {
+            return params.recurrent.X().v;
+        }
+
+        size_t GetWorkGroupSize(const lstm_seq_params& params)
+        {
+            const size_t max_work_group_size = static_cast<size_t>(params.engineInfo.maxWorkGroupSize);
+            return std::max<size_t>(1, std::min<size_t>(GetHiddenSize(params), std::min<size_t>(256, max_work_group_size)));
+        }
+
+        // The hidden state is kept in the local memory as floats
+        size_t GetHiddenStateBytes(const lstm_seq_params& params)
+        {
+            return GetHiddenSize(params) * sizeof(float);
+        }
+
+        size_t GetRecurrentBytes(const lstm_seq_params& params)
+        {
+            return params.recurrent.LogicalSize() * BytesPerElement(params.recurrent.GetDType());
+        }
+    }
+
+    ParamsKey LSTMSeqKernelRef::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        k.EnableLSTMGEMMBias();
+        k.EnableLSTMGEMMHidden();
+        k.EnableLSTMEltCell();
+        return k;
+    }
+
+    JitConstants LSTMSeqKernelRef::GetJitConstants(const lstm_seq_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+        const auto& input = params.inputs[0];
+        const size_t hidden_size = GetHiddenSize(params);
+        const size_t work_group_size = GetWorkGroupSize(params);
+
+        jit.AddConstants({
+            MakeJitConstant("WEIGHTS",          params.weights),
+            MakeJitConstant("RECURRENT",        params.recurrent),
+            MakeJitConstant("SEQUENCE_LEN",     input.Feature().v),
+            MakeJitConstant("INPUT_SIZE",       input.X().v),
+            MakeJitConstant("HIDDEN_SIZE",      hidden_size),
+            MakeJitConstant("LWS",              work_group_size),
+            MakeJitConstant("UNITS_PER_ITEM",   CeilDiv(hidden_size, work_group_size)),
+        });
+
+        if (params.hasBias)
+        {
+            jit.AddConstants({ MakeJitConstant("BIAS", params.bias), MakeJitConstant("BIAS_TERM", true) });
+        }
+        if (params.hasHidden)
+        {
+            jit.AddConstants({ MakeJitConstant("HIDDEN", params.hidden), MakeJitConstant("HIDDEN_TERM", true) });
+        }
+        if (params.hasCell)
+        {
+            jit.AddConstants({ MakeJitConstant("CELL", params.cell), MakeJitConstant("CELL_TERM", true) });
+        }
+        if (GetHiddenStateBytes(params) + GetRecurrentBytes(params) <= params.engineInfo.maxLocalMemSize)
+        {
+            jit.AddConstant(MakeJitConstant("RECURRENT_IN_SLM", 1));
+        }
+
+        if (params.clip > 0)
+        {
+            std::string psclip = toCodeString(params.clip);
+            std::string nsclip = toCodeString(-params.clip);
+            jit.AddConstants({ MakeJitConstant("CLIP(x)", "((x > " + psclip + ") ? " +
+                psclip + ": (x < " + nsclip + ") ? " + nsclip + " : (x))") });
+        }
+        else
+        {
+            jit.AddConstants({ MakeJitConstant("CLIP(x)", "(x)") });
+        }
+        if (params.input_forget)
+        {
+            jit.AddConstants({ MakeJitConstant("INPUT_FORGET", true) });
+        }
+
+        const auto& positions = gate_positions[params.gate_order];
+        jit.AddConstants({
+            MakeJitConstant("GEMM_OFFSET_I", positions[0] * hidden_size),
+            MakeJitConstant("GEMM_OFFSET_O", positions[1] * hidden_size),
+            MakeJitConstant("GEMM_OFFSET_F", positions[2] * hidden_size),
+            MakeJitConstant("GEMM_OFFSET_Z", positions[3] * hidden_size),
+        });
+
+        return jit;
+    }
+
+    KernelsData LSTMSeqKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        assert(params.GetType() == KernelType::LSTM_SEQ);
+        const lstm_seq_params& orgParams = static_cast<const lstm_seq_params&>(params);
+
+        const size_t hidden_size = GetHiddenSize(orgParams);
+        if (orgParams.inputs.size() != 1 ||
+            hidden_size == 0 ||
+            orgParams.weights.Y().v != 4 * hidden_size ||
+            orgParams.recurrent.Y().v != 4 * hidden_size ||
+            orgParams.weights.X().v != orgParams.inputs[0].X().v ||
+            GetHiddenStateBytes(orgParams) > orgParams.engineInfo.maxLocalMemSize)
+        {
+            return{};
+        }
+
+        KernelData kd = KernelData::Default<lstm_seq_params>(params, 1);
+
+        auto cldnn_jit = GetJitConstants(orgParams);
+        auto entry_point = GetEntryPoint(kernelName, orgParams.layerID, options);
+        auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+        // the work groups of the batch items run the whole sequence independently
+        const size_t work_group_size = GetWorkGroupSize(orgParams);
+        auto& kernel = kd.kernels[0];
+        kernel.workGroups.global = { work_group_size, orgParams.inputs[0].Batch().v, 1 };
+        kernel.workGroups.local = { work_group_size, 1, 1 };
+        kernel.kernelString = GetKernelString(kernelName, jit, entry_point);
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 0 });
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::OUTPUT, 0 });
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::WEIGHTS, 0 });
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::RECURRENT, 0 });
+        if (orgParams.hasBias)
+        {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::BIAS, 0 });
+        }
+        if (orgParams.hasHidden)
+        {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::HIDDEN, 0 });
+        }
+        if (orgParams.hasCell)
+        {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::CELL, 0 });
+        }
+
+        kd.estimatedTime = FORCE_PRIORITY_1;
+
+        return{ kd };
+    }
+}
@@ -0,0 +1,112 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "common_kernel_base.h"
+#include "kernel_selector_params.h"
+#include "lstm_elt_kernel_base.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // lstm_seq_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct lstm_seq_params : public base_params
+    {
+        lstm_seq_params() : base_params(KernelType::LSTM_SEQ) {}
+
+        DataTensor weights;
+        DataTensor recurrent;
+        DataTensor bias;
+        DataTensor hidden;
+        DataTensor cell;
+        bool hasBias = false;
+        bool hasHidden = false;
+        bool hasCell = false;
+        lstm_elt_params::order_type gate_order = lstm_elt_params::offset_iofz;
+        float clip = 0;
+        bool input_forget = false;
+
+        void SetBias(const DataTensor& v) {
+            bias = v;
+            hasBias = true;
+        }
+
+        void SetHidden(const DataTensor& v) {
+            hidden = v;
+            hasHidden = true;
+        }
+
+        void SetCell(const DataTensor& v) {
+            cell = v;
+            hasCell = true;
+        }
+
+        void SetOffsetOrder(int32_t t) {
+            gate_order = static_cast<lstm_elt_params::order_type>(t);
+        }
+
+        virtual ParamsKey GetParamsKey() const override
+        {
+            ParamsKey k = base_params::GetParamsKey();
+
+            if (hasBias)
+            {
+                k.EnableLSTMGEMMBias();
+            }
+
+            if (hasHidden)
+            {
+                k.EnableLSTMGEMMHidden();
+            }
+
+            if (hasCell)
+            {
+                k.EnableLSTMEltCell();
+            }
+
+            return k;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // lstm_seq_optional_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct lstm_seq_optional_params : optional_params
+    {
+        lstm_seq_optional_params() : optional_params(KernelType::LSTM_SEQ) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // LSTMSeqKernelRef
+    // Runs all the timesteps of the sequence in one kernel: a work group per batch item loops over the timesteps with
+    // the hidden state in the local memory and the cell state of the hidden units of every work item in its registers.
+    // The recurrent weights are copied to the local memory when they fit.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LSTMSeqKernelRef : public common_kernel_base
+    {
+    public:
+        LSTMSeqKernelRef() : common_kernel_base("lstm_seq_gpu_bfyx_ref") {}
+        virtual ~LSTMSeqKernelRef() {}
+
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        virtual JitConstants GetJitConstants(const lstm_seq_params& params) const;
+    };
+}
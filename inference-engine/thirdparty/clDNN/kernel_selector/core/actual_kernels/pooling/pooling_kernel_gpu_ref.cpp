@@ -15,6 +15,7 @@
 */
 
 #include "pooling_kernel_gpu_ref.h"
+#include "kernel_selector_utils.h"
  
 namespace kernel_selector 
 {
@@ -48,6 +49,14 @@ namespace kernel_selector
 
     KernelsData PoolingKernelGPURef::GetKernelsData(const Params& params, const optional_params& options) const
     {
-        return GetCommonKernelsData(params, options, FORCE_PRIORITY_9);
+        KernelsData kds = GetCommonKernelsData(params, options, FORCE_PRIORITY_9);
+
+        // the third global dimension of bfyx and byxf is B*F with the batch slowest
+        const auto& out = static_cast<const pooling_params&>(params).output;
+        if (!kds.empty() && (out.GetLayout() == DataLayout::bfyx || out.GetLayout() == DataLayout::byxf))
+        {
+            SetRuntimeBatch(kds[0].kernels[0], 2, out.Batch().v);
+        }
+        return kds;
     }
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "proposal_kernel_ref.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        // The sorting runs over the power of two sized buffer
+        size_t RoundUpToPowerOfTwo(size_t value)
+        {
+            size_t result = 1;
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        size_t GetNumProposals(const proposal_params& params)
+        {
+            const auto& scores = params.inputs[0];
+            return scores.X().v * scores.Y().v * (params.anchors.size() / 4);
+        }
+
+        size_t GetWorkGroupSize(const proposal_params& params)
+        {
+            return std::max<size_t>(1, std::min<size_t>(256, params.engineInfo.maxWorkGroupSize));
+        }
+    }
+
+    ParamsKey ProposalKernelRef::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        return k;
+    }
+
+    JitConstants ProposalKernelRef::GetJitConstants(const proposal_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+        const size_t num_proposals = GetNumProposals(params);
+
+        jit.AddConstants({
+            MakeJitConstant("ANCHORS",                  params.anchors),
+            MakeJitConstant("NUM_ANCHORS",              params.anchors.size() / 4),
+            MakeJitConstant("FEATURE_STRIDE",           params.feature_stride),
+            MakeJitConstant("MIN_BBOX_SIZE",            params.min_bbox_size),
+            MakeJitConstant("PRE_NMS_TOPN",             params.pre_nms_topn),
+            MakeJitConstant("POST_NMS_TOPN",            params.post_nms_topn),
+            MakeJitConstant("IOU_THRESHOLD",            params.iou_threshold),
+            MakeJitConstant("IMAGE_INFO_SIZE",          params.image_info_size),
+            MakeJitConstant("NUM_PROPOSALS",            num_proposals),
+            MakeJitConstant("PROPOSALS_CAPACITY",       RoundUpToPowerOfTwo(num_proposals)),
+            MakeJitConstant("LWS",                      GetWorkGroupSize(params)),
+        });
+
+        return jit;
+    }
+
+    KernelsData ProposalKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        assert(params.GetType() == KernelType::PROPOSAL);
+        const proposal_params& orgParams = static_cast<const proposal_params&>(params);
+
+        const size_t num_proposals = GetNumProposals(orgParams);
+        if (orgParams.inputs.size() != 3 || num_proposals == 0 || orgParams.post_nms_topn <= 0 ||
+            orgParams.inputs[0].Batch().v != 1 || orgParams.inputs[1].Batch().v != 1)
+        {
+            return{};
+        }
+
+        const size_t work_group_size = GetWorkGroupSize(orgParams);
+
+        KernelData kd = KernelData::Default<proposal_params>(params, 2);
+        kd.internalBufferSizes = {
+            num_proposals * 4 * sizeof(float),                                  // decoded boxes
+            RoundUpToPowerOfTwo(num_proposals) * 2 * sizeof(float),             // (confidence, index) pairs
+        };
+
+        const char* stages[] = { "DECODE", "NMS" };
+        for (size_t i = 0; i < kd.kernels.size(); i++)
+        {
+            DispatchData runInfo;
+            runInfo.fp16UnitUsed = orgParams.inputs[0].GetDType() == Datatype::F16;
+            if (i == 0)
+            {
+                // a work item per anchor of every location of the feature map
+                std::vector<size_t> global = { num_proposals, 1, 1 };
+                auto local = GetOptimalLocalWorkGroupSizes(global);
+                runInfo.gws0 = global[0];
+                runInfo.lws0 = local[0];
+            }
+            else
+            {
+                runInfo.gws0 = work_group_size;
+                runInfo.lws0 = work_group_size;
+            }
+            runInfo.gws1 = runInfo.gws2 = 1;
+            runInfo.lws1 = runInfo.lws2 = 1;
+
+            auto cldnn_jit = GetJitConstants(orgParams);
+            cldnn_jit.AddConstant(MakeJitConstant(std::string("PROPOSAL_STAGE_") + stages[i], 1));
+            auto entry_point = GetEntryPoint(kernelName, orgParams.layerID, options);
+            auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+            auto& kernel = kd.kernels[i];
+            FillCLKernelData(kernel, runInfo, kernelName, jit, entry_point, ROUND_ROBIN, false, false, 3);
+            for (uint32_t buffer = 0; buffer < kd.internalBufferSizes.size(); buffer++)
+            {
+                kernel.arguments.push_back({ ArgumentDescriptor::Types::INTERNAL_BUFFER, buffer });
+            }
+        }
+
+        kd.estimatedTime = FORCE_PRIORITY_9;
+
+        return{ kd };
+    }
+}
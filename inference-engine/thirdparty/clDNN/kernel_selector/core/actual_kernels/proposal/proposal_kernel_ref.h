@@ -0,0 +1,73 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#pragma once
+
+#include "common_kernel_base.h"
+#include "kernel_selector_params.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // proposal_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct proposal_params : public base_params
+    {
+        proposal_params() : base_params(KernelType::PROPOSAL) {}
+
+        std::vector<float> anchors;         // (start_x, start_y, end_x, end_y) of every anchor
+        int32_t feature_stride;
+        int32_t min_bbox_size;
+        int32_t pre_nms_topn;
+        int32_t post_nms_topn;
+        float iou_threshold;
+        uint32_t image_info_size;
+
+        virtual ParamsKey GetParamsKey() const
+        {
+            auto k = base_params::GetParamsKey();
+            return k;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // proposal_optional_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct proposal_optional_params : optional_params
+    {
+        proposal_optional_params() : optional_params(KernelType::PROPOSAL) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ProposalKernelRef
+    // Runs the proposal on the device in two kernels: decoding of the boxes of all the anchors and a single work group
+    // sorting the proposals by the confidence and running the NMS over them
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class ProposalKernelRef : public common_kernel_base
+    {
+    public:
+        ProposalKernelRef() : common_kernel_base("proposal_gpu_ref") {}
+        virtual ~ProposalKernelRef() {}
+
+        using DispatchData = CommonDispatchData;
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        virtual JitConstants GetJitConstants(const proposal_params& params) const;
+    };
+}
@@ -49,6 +49,13 @@ namespace kernel_selector
     KernelsData ReorderKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
     {
         const reorder_params& orgParams = static_cast<const reorder_params&>(params);
-        return GetCommonKernelsData(orgParams, options, DONT_USE_IF_HAVE_SOMETHING_ELSE);
+        KernelsData kds = GetCommonKernelsData(orgParams, options, DONT_USE_IF_HAVE_SOMETHING_ELSE);
+
+        // the tensor friendly work groups give the batch a global dimension of its own
+        for (auto& kd : kds)
+        {
+            SetRuntimeBatch(kd.kernels[0], GetTensorFriendlyWorkGroupsBatchDim(orgParams.inputs[0]), orgParams.inputs[0].Batch().v);
+        }
+        return kds;
     }
 }
\ No newline at end of file
@@ -16,94 +16,155 @@
 
 #include "auto_tuner.h"
 #include "auto_tuner_offline.h"
+#include <cstdio>
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <vector>
 
  
 namespace kernel_selector 
 {
-    std::tuple<std::string, int> AutoTuner::LoadKernelOnline(const TuningMode tuningMode, const std::string& tuningFilePath, const std::string& deviceID, const std::string& driverVersion, const std::string& hostVersion, const std::string& hash)
+    namespace
     {
-        std::lock_guard<std::mutex> lock(mutex);
+        const std::string tuningFileHeader = "#clDNN tuning cache v2";
 
-        //First, check if the tuning file has been already loaded to cache
-        auto const& tuningFileCache = onlineCache.find(tuningFilePath);
-        if (tuningFileCache == onlineCache.end())
+        std::string CacheKey(const std::string& tuningFilePath, const std::string& deviceID, const std::string& driverVersion, const std::string& hostVersion)
         {
-            // Load tuning file to cache
-            onlineCache[tuningFilePath] = {};
+            return tuningFilePath + "\n" + deviceID + "\n" + driverVersion + "\n" + hostVersion;
+        }
 
-            std::ifstream tuningFile(tuningFilePath);
-            std::string cachedDeviceId;
-            std::string cachedDriverVersion;
-            std::string cachedHostVersion;
-            std::string cachedhash;
-            std::string cachedkernelName;
-            int cachedIndex;
-            std::string line;
+        std::string EntryLine(const std::string& deviceID, const std::string& driverVersion, const std::string& hostVersion, const std::string& hash, const std::string& implementationName, const int tuneIndex)
+        {
+            return deviceID + "\t" + driverVersion + "\t" + hostVersion + "\t" + hash + "\t" + implementationName + "\t" + std::to_string(tuneIndex) + "\n";
+        }
 
-            if (tuningFile) // Tuning file exists
+        // Appends the lines by a single write, the appends of the other processes are not interleaved with them
+        void AppendLines(const std::string& tuningFilePath, const std::string& lines)
+        {
+            std::ofstream tuningFile(tuningFilePath, std::ofstream::out | std::ofstream::app | std::ofstream::binary);
+            if (!tuningFile.good())
             {
-                // Read device ID
-                tuningFile >> cachedDeviceId;
-                if (!tuningFile.good() || (cachedDeviceId.compare(deviceID) != 0))
-                {
-                    throw std::runtime_error("Tuning file bad structure or wrong device ID. Re-generate cache in TUNE_AND_CACHE mode.");
-                }
+                throw std::runtime_error("Tuning file: " + tuningFilePath + " could not be written!");
+            }
+            tuningFile.write(lines.data(), lines.size());
+            tuningFile.close();
+        }
+    }
 
-                // Read driver version
-                tuningFile >> cachedDriverVersion;
-                if (!tuningFile.good() || (cachedDriverVersion.compare(driverVersion) != 0))
+    void AutoTuner::LoadTuningFile(const TuningMode tuningMode, const std::string& tuningFilePath)
+    {
+        std::ifstream tuningFile(tuningFilePath);
+        if (!tuningFile) // Tuning file doesn't exist
+        {
+            if (tuningMode == TuningMode::TUNING_USE_CACHE)
+            {
+                throw std::runtime_error("Tuning file: " + tuningFilePath + " could not be read! Must provide a valid cache file in USE_CACHE mode.");
+            }
+
+            // Several processes may create the file at once, the repeated header is skipped as a comment
+            AppendLines(tuningFilePath, tuningFileHeader + "\n");
+            return;
+        }
+
+        std::string line;
+        std::getline(tuningFile, line);
+        if (line.compare(0, tuningFileHeader.size(), tuningFileHeader) == 0)
+        {
+            while (std::getline(tuningFile, line))
+            {
+                if (line.empty() || line[0] == '#')
                 {
-                    throw std::runtime_error("Tuning file bad structure or wrong driver version. Re-generate cache in TUNE_AND_CACHE mode.");
+                    continue;
                 }
 
-                // Read host version
-                tuningFile >> cachedHostVersion;
-                if (!tuningFile.good() || (cachedHostVersion.compare(hostVersion) != 0))
+                std::vector<std::string> fields;
+                std::istringstream iss(line);
+                std::string field;
+                while (std::getline(iss, field, '\t'))
                 {
-                    throw std::runtime_error("Tuning file bad structure or wrong host version. Re-generate cache in TUNE_AND_CACHE mode.");
+                    fields.push_back(field);
                 }
-
-                // Read optimal kernel/config data 
-                while (std::getline(tuningFile, line))
+                int cachedIndex = 0;
+                try
                 {
-                    if (line.empty())
+                    if (fields.size() != 6)
                     {
                         continue;
                     }
-                    std::istringstream iss(line);
-                    iss >> cachedhash >> cachedkernelName >> cachedIndex;
-                    if (iss.fail())
-                    {
-                        throw std::runtime_error("Tuning file bad structure. Re-generate cache in TUNE_AND_CACHE mode.");
-                    }
-
-                    // Update tuning cache 
-                    onlineCache[tuningFilePath].td[cachedhash] = std::make_tuple(cachedkernelName, cachedIndex);
+                    cachedIndex = std::stoi(fields[5]);
+                }
+                catch (std::exception&)
+                {
+                    continue; // The line of a writer that did not finish
                 }
 
-                tuningFile.close();
+                onlineCache[CacheKey(tuningFilePath, fields[0], fields[1], fields[2])].td[fields[3]] = std::make_tuple(fields[4], cachedIndex);
             }
-            else // Tuning file doesn't exist
+            return;
+        }
+
+        // The older format: device ID, driver version and host version, then the optimal kernel/config data of the device
+        std::string cachedDeviceId = line;
+        std::string cachedDriverVersion;
+        std::string cachedHostVersion;
+        tuningFile >> cachedDriverVersion >> cachedHostVersion;
+        if (cachedDeviceId.empty() || !tuningFile.good())
+        {
+            throw std::runtime_error("Tuning file bad structure. Re-generate cache in TUNE_AND_CACHE mode.");
+        }
+
+        std::string convertedLines = tuningFileHeader + "\n";
+        auto& tuningData = onlineCache[CacheKey(tuningFilePath, cachedDeviceId, cachedDriverVersion, cachedHostVersion)];
+        while (std::getline(tuningFile, line))
+        {
+            if (line.empty())
             {
-                if (tuningMode == TuningMode::TUNING_USE_CACHE)
-                {
-                    throw std::runtime_error("Tuning file: " + tuningFilePath + " could not be read! Must provide a valid cache file in USE_CACHE mode.");
-                }
+                continue;
+            }
+            std::string cachedhash;
+            std::string cachedkernelName;
+            int cachedIndex;
+            std::istringstream iss(line);
+            iss >> cachedhash >> cachedkernelName >> cachedIndex;
+            if (iss.fail())
+            {
+                throw std::runtime_error("Tuning file bad structure. Re-generate cache in TUNE_AND_CACHE mode.");
+            }
 
-                // Create a new tuning file and write the versions
-                std::ofstream newTuningFile(tuningFilePath, std::ofstream::out);
+            tuningData.td[cachedhash] = std::make_tuple(cachedkernelName, cachedIndex);
+            convertedLines += EntryLine(cachedDeviceId, cachedDriverVersion, cachedHostVersion, cachedhash, cachedkernelName, cachedIndex);
+        }
+        tuningFile.close();
 
-                newTuningFile << deviceID << "\n";
-                newTuningFile << driverVersion << "\n";
-                newTuningFile << hostVersion << "\n";
+        if (tuningMode == TuningMode::TUNING_TUNE_AND_CACHE)
+        {
+            // The new entries are appended in the current format, so the file is converted first; the converted
+            // file replaces the old one at once
+            const std::string convertedPath = tuningFilePath + ".converted";
+            std::remove(convertedPath.c_str());
+            AppendLines(convertedPath, convertedLines);
+            std::remove(tuningFilePath.c_str());
+            if (std::rename(convertedPath.c_str(), tuningFilePath.c_str()) != 0)
+            {
+                throw std::runtime_error("Tuning file: " + tuningFilePath + " could not be converted!");
             }
         }
+    }
+
+    std::tuple<std::string, int> AutoTuner::LoadKernelOnline(const TuningMode tuningMode, const std::string& tuningFilePath, const std::string& deviceID, const std::string& driverVersion, const std::string& hostVersion, const std::string& hash)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        //First, check if the tuning file has been already loaded to cache
+        if (loadedFiles.find(tuningFilePath) == loadedFiles.end())
+        {
+            LoadTuningFile(tuningMode, tuningFilePath);
+            loadedFiles.insert(tuningFilePath);
+        }
 
         // Tuning file is loaded
-        auto const& tuningFileData = onlineCache[tuningFilePath];
+        auto const& tuningFileData = onlineCache[CacheKey(tuningFilePath, deviceID, driverVersion, hostVersion)];
         auto const& hashData = tuningFileData.td.find(hash);
         if (hashData != tuningFileData.td.end())
         {
@@ -117,23 +178,15 @@ namespace kernel_selector
         }
     }
 
-    void AutoTuner::StoreKernel(const std::string& tuningFilePath, const std::string& hash, const std::string& implementationName, const int tuneIndex)
+    void AutoTuner::StoreKernel(const std::string& tuningFilePath, const std::string& deviceID, const std::string& driverVersion, const std::string& hostVersion, const std::string& hash, const std::string& implementationName, const int tuneIndex)
     {
         std::lock_guard<std::mutex> lock(mutex);
 
         // Add the new tuning data to cache
-        onlineCache[tuningFilePath].td[hash] = std::make_tuple(implementationName, tuneIndex);
+        onlineCache[CacheKey(tuningFilePath, deviceID, driverVersion, hostVersion)].td[hash] = std::make_tuple(implementationName, tuneIndex);
 
         // Add the new tuning data to tuning file
-        std::ofstream cachedKernelsFile(tuningFilePath, std::ofstream::out | std::ofstream::app);
-        if (!cachedKernelsFile.good())
-        {
-            throw std::runtime_error("Tuning file: " + tuningFilePath + " could not be written!");
-        }
-        cachedKernelsFile << hash << " ";
-        cachedKernelsFile << implementationName << " ";
-        cachedKernelsFile << tuneIndex << "\n";
-        cachedKernelsFile.close();
+        AppendLines(tuningFilePath, EntryLine(deviceID, driverVersion, hostVersion, hash, implementationName, tuneIndex));
     }
 
     std::tuple<std::string, int> AutoTuner::LoadKernelOffline(const std::string& deviceID, const std::string& hash)
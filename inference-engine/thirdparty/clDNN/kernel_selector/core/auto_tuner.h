@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <set>
 #include "kernel_selector_common.h"
 
 namespace kernel_selector 
@@ -32,11 +33,22 @@ namespace kernel_selector
     public:
         AutoTuner() = default;
         std::tuple<std::string, int> LoadKernelOnline(const TuningMode tuningMode, const std::string& tuningFilePath, const std::string& deviceID, const std::string& driverVersion, const std::string& hostVersion, const std::string& hash);
-        void StoreKernel(const std::string& tuningFilePath, const std::string& hash, const std::string& implementationName, const int tuneIndex);
+        void StoreKernel(const std::string& tuningFilePath, const std::string& deviceID, const std::string& driverVersion, const std::string& hostVersion, const std::string& hash, const std::string& implementationName, const int tuneIndex);
         std::tuple<std::string, int> LoadKernelOffline(const std::string& deviceID, const std::string& hash);
 
     private:    
-        std::map<std::string, tuning_data> onlineCache; // Tuning file name -> kernel/config per hash (hash -> [implementation name, tuning index])
+        /*
+            The tuning file is shared by the devices, the driver versions and the processes. Every line after the header holds
+            one winner with its key: device ID, driver version, host version, hash, implementation name and tuning index,
+            separated by tabs. The new winners are appended by a single write, so the processes tuning the same file do not
+            corrupt it, the files of several hosts are merged by concatenation (the later line of a key wins) and the lines of
+            the other devices and versions are ignored. The files of the older format (versions in the first three lines) are
+            converted on the first load in the tuning mode.
+        */
+        void LoadTuningFile(const TuningMode tuningMode, const std::string& tuningFilePath);
+
+        std::map<std::string, tuning_data> onlineCache; // Tuning file name and versions -> kernel/config per hash (hash -> [implementation name, tuning index])
+        std::set<std::string> loadedFiles;              // Tuning files read to the cache
         std::mutex mutex; // Mutex to synchronize cache updates
         
         /*
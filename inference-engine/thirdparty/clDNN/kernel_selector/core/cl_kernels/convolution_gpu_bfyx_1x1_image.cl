@@ -0,0 +1,102 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "include/include_all.cl"
+
+// The 1x1 convolution with the weights in a 4-channel image with a column per output feature:
+//   weights = image2d [x: FILTER_OFM_NUM, y: FILTER_IFM_NUM / 4]
+// the texel (f, k) holds the weights of the input features 4 * k .. 4 * k + 3 of the output feature f. Every work
+// item computes PIXELS_BLOCK consecutive pixels of one output feature, the input has no padding, so the pixels
+// of an input feature are one contiguous row.
+
+#define PIXELS_COUNT (INPUT0_SIZE_X * INPUT0_SIZE_Y)
+
+#if FP16_UNIT_USED
+    #define READ_WEIGHTS(coord) read_imageh(weights, weights_sampler, coord)
+#else
+    #define READ_WEIGHTS(coord) read_imagef(weights, weights_sampler, coord)
+#endif
+
+inline MAKE_VECTOR_TYPE(UNIT_TYPE, 4) FUNC(read_pixels)(const __global UNIT_TYPE* row, uint p0)
+{
+#if LEFTOVERS
+    // the last block of the row is shorter, the pixels past it are not read
+    if (p0 + PIXELS_BLOCK > PIXELS_COUNT)
+    {
+        MAKE_VECTOR_TYPE(UNIT_TYPE, 4) value = 0;
+        value.s0 = row[0];
+        if (p0 + 1 < PIXELS_COUNT)
+            value.s1 = row[1];
+        if (p0 + 2 < PIXELS_COUNT)
+            value.s2 = row[2];
+        return value;
+    }
+#endif
+    return vload4(0, row);
+}
+
+KERNEL(convolution_gpu_bfyx_1x1_image)(
+    const __global UNIT_TYPE* input,
+    __global UNIT_TYPE* output,
+    __read_only image2d_t weights,
+#if BIAS_TERM
+    const __global UNIT_TYPE* bias,
+#endif
+    uint split_idx)
+{
+    // the sampler is declared here, the kernels of a program share its global scope
+    const sampler_t weights_sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_NONE | CLK_FILTER_NEAREST;
+
+    const uint p0 = get_global_id(0) * PIXELS_BLOCK;
+    const uint f = get_global_id(1);
+    const uint b = get_global_id(2);
+
+    const __global UNIT_TYPE* row = input + INPUT0_OFFSET + b * INPUT0_BATCH_PITCH + p0;
+
+    MAKE_VECTOR_TYPE(UNIT_TYPE, 4) acc = 0;
+    for (uint k = 0; k < FILTER_IFM_NUM / 4; k++)
+    {
+        const MAKE_VECTOR_TYPE(UNIT_TYPE, 4) w = READ_WEIGHTS((int2)(f, k));
+        acc += FUNC_CALL(read_pixels)(row,                            p0) * w.s0;
+        acc += FUNC_CALL(read_pixels)(row +     INPUT0_FEATURE_PITCH, p0) * w.s1;
+        acc += FUNC_CALL(read_pixels)(row + 2 * INPUT0_FEATURE_PITCH, p0) * w.s2;
+        acc += FUNC_CALL(read_pixels)(row + 3 * INPUT0_FEATURE_PITCH, p0) * w.s3;
+        row += 4 * INPUT0_FEATURE_PITCH;
+    }
+
+    UNIT_TYPE values[PIXELS_BLOCK];
+    vstore4(acc, 0, values);
+
+    const uint output_offset = OUTPUT_OFFSET + b * OUTPUT_BATCH_PITCH + f * OUTPUT_FEATURE_PITCH;
+    for (uint n = 0; n < PIXELS_BLOCK; n++)
+    {
+        const uint p = p0 + n;
+#if LEFTOVERS
+        if (p >= PIXELS_COUNT)
+            break;
+#endif
+#if BIAS_TERM
+        const UNIT_TYPE value = values[n] + bias[f];
+#else
+        const UNIT_TYPE value = values[n];
+#endif
+        output[output_offset + (p / OUTPUT_SIZE_X) * OUTPUT_Y_PITCH + (p % OUTPUT_SIZE_X) * OUTPUT_X_PITCH] = ACTIVATION(value, NL_M, NL_N);
+    }
+}
+
+#undef READ_WEIGHTS
+#undef PIXELS_COUNT
@@ -0,0 +1,84 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "include/include_all.cl"
+
+// Runs all the groups of the grouped convolution, the weights of the groups follow each other:
+//   weights = [o: FILTER_ARRAY_NUM * GROUP_OFM_NUM, i: FILTER_IFM_NUM, y: FILTER_SIZE_Y, x: FILTER_SIZE_X]
+//   bias    = [FILTER_ARRAY_NUM * GROUP_OFM_NUM]
+// The output feature f belongs to the group f / GROUP_OFM_NUM, which reads the input features of the same index
+// times FILTER_IFM_NUM. Every work item computes OUTPUT_BLOCK_WIDTH outputs of a row, every weight is read once.
+
+KERNEL(convolution_gpu_bfyx_group)(
+    const __global UNIT_TYPE* input,
+    __global UNIT_TYPE* output,
+    const __global UNIT_TYPE* weights,
+#if BIAS_TERM
+    const __global UNIT_TYPE* bias,
+#endif
+    uint split_idx)
+{
+    const uint x0 = get_global_id(0) * OUTPUT_BLOCK_WIDTH;
+    const uint y = get_global_id(1);
+    const uint f = get_global_id(2) % OUTPUT_FEATURE_NUM;
+    const uint b = get_global_id(2) / OUTPUT_FEATURE_NUM;
+    const uint group = f / GROUP_OFM_NUM;
+
+    const int input_x0 = (int)(x0 * STRIDE_SIZE_X) - PADDING_SIZE_X;
+    const int input_y0 = (int)(y * STRIDE_SIZE_Y) - PADDING_SIZE_Y;
+    const uint input_offset = INPUT0_OFFSET + b * INPUT0_BATCH_PITCH + group * FILTER_IFM_NUM * INPUT0_FEATURE_PITCH;
+    const uint filter_offset = f * FILTER_OFM_PITCH;
+
+    UNIT_TYPE acc[OUTPUT_BLOCK_WIDTH];
+    for (uint n = 0; n < OUTPUT_BLOCK_WIDTH; n++)
+        acc[n] = 0;
+
+    for (uint k = 0; k < FILTER_IFM_NUM; k++)
+    {
+        for (uint j = 0; j < FILTER_SIZE_Y; j++)
+        {
+            const int input_y = input_y0 + (int)(j * DILATION_SIZE_Y);
+            if (input_y < 0 || input_y >= (int)INPUT0_SIZE_Y)
+                continue;
+
+            const uint row_offset = input_offset + k * INPUT0_FEATURE_PITCH + input_y * INPUT0_Y_PITCH;
+            for (uint i = 0; i < FILTER_SIZE_X; i++)
+            {
+                const UNIT_TYPE w = weights[filter_offset + k * FILTER_IFM_PITCH + j * FILTER_Y_PITCH + i * FILTER_X_PITCH];
+                for (uint n = 0; n < OUTPUT_BLOCK_WIDTH; n++)
+                {
+                    const int input_x = input_x0 + (int)(n * STRIDE_SIZE_X + i * DILATION_SIZE_X);
+                    if (input_x >= 0 && input_x < (int)INPUT0_SIZE_X)
+                        acc[n] = mad(input[row_offset + input_x * INPUT0_X_PITCH], w, acc[n]);
+                }
+            }
+        }
+    }
+
+    const uint output_offset = OUTPUT_OFFSET + b * OUTPUT_BATCH_PITCH + f * OUTPUT_FEATURE_PITCH + y * OUTPUT_Y_PITCH;
+    for (uint n = 0; n < OUTPUT_BLOCK_WIDTH; n++)
+    {
+        if (x0 + n >= OUTPUT_SIZE_X)
+            break;
+#if BIAS_TERM
+        const UNIT_TYPE value = acc[n] + bias[f];
+#else
+        const UNIT_TYPE value = acc[n];
+#endif
+        output[output_offset + (x0 + n) * OUTPUT_X_PITCH] = ACTIVATION(value, NL_M, NL_N);
+    }
+}
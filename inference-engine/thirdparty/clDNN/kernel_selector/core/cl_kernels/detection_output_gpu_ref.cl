@@ -0,0 +1,373 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "include/include_all.cl"
+
+// The stages keep the detections in the internal buffers:
+//   boxes      - the decoded boxes [image][location class][prior] as (xmin, ymin, xmax, ymax)
+//   candidates - the (score, prior) pairs of every image and class, sorted and reduced by the NMS in place
+//   counts     - the numbers of the pairs kept for every image and class followed by their offsets in the image
+//   scratch    - the (score, label, prior) detections of all the classes of an image for the keep_top_k selection
+// The indices are stored in the float components as their bits.
+
+#define SCORE_SENTINEL (-FLT_MAX)
+
+inline bool FUNC(scored_prior_before)(float2 a, float2 b)
+{
+    return a.x > b.x || (a.x == b.x && as_int(a.y) < as_int(b.y));
+}
+
+inline bool FUNC(detection_before)(float4 a, float4 b, bool by_label)
+{
+    if (by_label && as_int(a.y) != as_int(b.y))
+        return as_int(a.y) < as_int(b.y);
+    if (a.x != b.x)
+        return a.x > b.x;
+    if (as_int(a.y) != as_int(b.y))
+        return as_int(a.y) < as_int(b.y);
+    return as_int(a.z) < as_int(b.z);
+}
+
+// Bitonic sort of the power of two sized buffer by the work group
+inline void FUNC(sort_scored_priors)(__global float2* data, int size)
+{
+    for (int k = 2; k <= size; k <<= 1)
+    {
+        for (int j = k >> 1; j > 0; j >>= 1)
+        {
+            for (int i = get_local_id(0); i < size; i += LWS)
+            {
+                const int other = i ^ j;
+                if (other > i)
+                {
+                    const float2 a = data[i];
+                    const float2 b = data[other];
+                    const bool swap = (i & k) == 0 ? FUNC_CALL(scored_prior_before)(b, a)
+                                                   : FUNC_CALL(scored_prior_before)(a, b);
+                    if (swap)
+                    {
+                        data[i] = b;
+                        data[other] = a;
+                    }
+                }
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+    }
+}
+
+inline void FUNC(sort_detections)(__global float4* data, int size, bool by_label)
+{
+    for (int k = 2; k <= size; k <<= 1)
+    {
+        for (int j = k >> 1; j > 0; j >>= 1)
+        {
+            for (int i = get_local_id(0); i < size; i += LWS)
+            {
+                const int other = i ^ j;
+                if (other > i)
+                {
+                    const float4 a = data[i];
+                    const float4 b = data[other];
+                    const bool swap = (i & k) == 0 ? FUNC_CALL(detection_before)(b, a, by_label)
+                                                   : FUNC_CALL(detection_before)(a, b, by_label);
+                    if (swap)
+                    {
+                        data[i] = b;
+                        data[other] = a;
+                    }
+                }
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+    }
+}
+
+inline int FUNC(round_up_to_power_of_two)(int value)
+{
+    int result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+inline float FUNC(overlap)(float4 a, float4 b)
+{
+    const bool intersecting = (a.x < b.z) & (b.x < a.z) & (a.y < b.w) & (b.y < a.w);
+    if (!intersecting)
+        return 0.0f;
+    const float intersect_width = min(a.z, b.z) - max(a.x, b.x);
+    const float intersect_height = min(a.w, b.w) - max(a.y, b.y);
+    const float intersect_size = intersect_width * intersect_height;
+    return intersect_size / ((a.z - a.x) * (a.w - a.y) + (b.z - b.x) * (b.w - b.y) - intersect_size);
+}
+
+inline void FUNC(write_detection)(__global UNIT_TYPE* output, int row, int image, int label, float score, float4 box)
+{
+    __global UNIT_TYPE* out = output + OUTPUT_OFFSET + row * OUTPUT_Y_PITCH;
+    out[0] = (UNIT_TYPE)(image);
+    out[1] = (UNIT_TYPE)(DECREASE_LABEL_ID ? label - 1 : label);
+    out[2] = (UNIT_TYPE)(score);
+    out[3] = (UNIT_TYPE)(box.x);
+    out[4] = (UNIT_TYPE)(box.y);
+    out[5] = (UNIT_TYPE)(box.z);
+    out[6] = (UNIT_TYPE)(box.w);
+}
+
+inline float4 FUNC(get_box)(const __global float4* boxes, int image, int label, int prior)
+{
+    return boxes[(image * NUM_LOC_CLASSES + (SHARE_LOCATION ? 0 : label)) * NUM_PRIORS + prior];
+}
+
+KERNEL(detection_output_gpu_ref)(
+    const __global UNIT_TYPE* location,
+    const __global UNIT_TYPE* confidence,
+    const __global UNIT_TYPE* prior_box,
+    __global UNIT_TYPE* output,
+    __global float4* boxes,
+    __global float2* candidates,
+    __global int* counts,
+    __global float4* scratch)
+{
+#ifdef DETECTION_OUTPUT_STAGE_DECODE
+    // a work item decodes the box of one prior
+    const int index = get_global_id(0);
+    const int prior = index % NUM_PRIORS;
+    const int label = (index / NUM_PRIORS) % NUM_LOC_CLASSES;
+    const int image = index / (NUM_PRIORS * NUM_LOC_CLASSES);
+
+    const int loc_index = INPUT0_OFFSET + image * INPUT0_BATCH_PITCH + (prior * NUM_LOC_CLASSES + label) * 4 * INPUT0_FEATURE_PITCH;
+    const float4 bbox = (float4)((float)location[loc_index],
+                                 (float)location[loc_index + INPUT0_FEATURE_PITCH],
+                                 (float)location[loc_index + 2 * INPUT0_FEATURE_PITCH],
+                                 (float)location[loc_index + 3 * INPUT0_FEATURE_PITCH]);
+
+    const int prior_index = prior * PRIOR_INFO_SIZE + PRIOR_COORDINATES_OFFSET;
+    float4 prior_bbox = (float4)((float)prior_box[prior_index],
+                                 (float)prior_box[prior_index + 1],
+                                 (float)prior_box[prior_index + 2],
+                                 (float)prior_box[prior_index + 3]);
+#if !VARIANCE_ENCODED_IN_TARGET
+    const int variance_index = prior_index + NUM_PRIORS * PRIOR_INFO_SIZE;
+    const float4 variance = (float4)((float)prior_box[variance_index],
+                                     (float)prior_box[variance_index + 1],
+                                     (float)prior_box[variance_index + 2],
+                                     (float)prior_box[variance_index + 3]);
+#endif
+#if !PRIOR_IS_NORMALIZED
+    prior_bbox /= (float4)(IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_WIDTH, IMAGE_HEIGHT);
+#endif
+
+    float4 decoded;
+#if defined(CODE_TYPE_CORNER)
+#if VARIANCE_ENCODED_IN_TARGET
+    decoded = prior_bbox + bbox;
+#else
+    decoded = prior_bbox + variance * bbox;
+#endif
+#else
+    const float prior_width = prior_bbox.z - prior_bbox.x;
+    const float prior_height = prior_bbox.w - prior_bbox.y;
+    const float4 prior_size = (float4)(prior_width, prior_height, prior_width, prior_height);
+#if defined(CODE_TYPE_CENTER_SIZE)
+    const float prior_center_x = (prior_bbox.x + prior_bbox.z) / 2.0f;
+    const float prior_center_y = (prior_bbox.y + prior_bbox.w) / 2.0f;
+#if VARIANCE_ENCODED_IN_TARGET
+    const float center_x = bbox.x * prior_width + prior_center_x;
+    const float center_y = bbox.y * prior_height + prior_center_y;
+    const float width = exp(bbox.z) * prior_width;
+    const float height = exp(bbox.w) * prior_height;
+#else
+    const float center_x = variance.x * bbox.x * prior_width + prior_center_x;
+    const float center_y = variance.y * bbox.y * prior_height + prior_center_y;
+    const float width = exp(variance.z * bbox.z) * prior_width;
+    const float height = exp(variance.w * bbox.w) * prior_height;
+#endif
+    decoded = (float4)(center_x - width / 2.0f, center_y - height / 2.0f, center_x + width / 2.0f, center_y + height / 2.0f);
+#else // CODE_TYPE_CORNER_SIZE
+#if VARIANCE_ENCODED_IN_TARGET
+    decoded = prior_bbox + bbox * prior_size;
+#else
+    decoded = prior_bbox + variance * bbox * prior_size;
+#endif
+#endif
+#endif
+
+#if CLIP
+    decoded = clamp(decoded, 0.0f, 1.0f);
+#endif
+
+    boxes[index] = decoded;
+#endif // DETECTION_OUTPUT_STAGE_DECODE
+
+#ifdef DETECTION_OUTPUT_STAGE_NMS
+    // a work group sorts the confidences of one class of an image and runs the NMS over them
+    __local int num_candidates;
+    __local int num_kept;
+    __local int suppressed;
+
+    const int group = get_group_id(0);
+    const int image = group / NUM_CLASSES;
+    const int cls = group % NUM_CLASSES;
+    const int lid = get_local_id(0);
+    __global float2* pairs = candidates + group * CANDIDATES_CAPACITY;
+
+    if (cls == BACKGROUND_LABEL_ID)
+    {
+        if (lid == 0)
+            counts[group] = 0;
+        return;
+    }
+
+    if (lid == 0)
+    {
+        num_candidates = 0;
+        num_kept = 0;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    const int conf_offset = INPUT1_OFFSET + image * INPUT1_BATCH_PITCH;
+    for (int prior = lid; prior < NUM_PRIORS; prior += LWS)
+    {
+        const float score = (float)confidence[conf_offset + (prior * NUM_CLASSES + cls) * INPUT1_FEATURE_PITCH];
+        if (score > CONFIDENCE_THRESHOLD)
+            pairs[atomic_inc(&num_candidates)] = (float2)(score, as_float(prior));
+    }
+    barrier(CLK_LOCAL_MEM_FENCE | CLK_GLOBAL_MEM_FENCE);
+
+    // the order of the candidates (score descending, prior ascending) does not depend on the order they came in
+    const int count = num_candidates;
+    const int sort_size = FUNC_CALL(round_up_to_power_of_two)(count);
+    for (int i = count + lid; i < sort_size; i += LWS)
+        pairs[i] = (float2)(SCORE_SENTINEL, as_float(INT_MAX));
+    barrier(CLK_GLOBAL_MEM_FENCE);
+    FUNC_CALL(sort_scored_priors)(pairs, sort_size);
+
+    const int top_count = (TOP_K >= 0 && count > TOP_K) ? TOP_K : count;
+    float threshold = NMS_THRESHOLD;
+    for (int c = 0; c < top_count; c++)
+    {
+        // the work items compare the candidate with the kept boxes in parallel
+        const float2 candidate = pairs[c];
+        const float4 box = FUNC_CALL(get_box)(boxes, image, cls, as_int(candidate.y));
+        const int kept = num_kept;
+        if (lid == 0)
+            suppressed = 0;
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (int i = lid; i < kept; i += LWS)
+        {
+            const float4 kept_box = FUNC_CALL(get_box)(boxes, image, cls, as_int(pairs[i].y));
+            if (!(FUNC_CALL(overlap)(box, kept_box) <= threshold))
+                suppressed = 1;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        if (!suppressed)
+        {
+            if (lid == 0)
+            {
+                pairs[kept] = candidate;
+                num_kept = kept + 1;
+            }
+            if (ETA < 1.0f && threshold > 0.5f)
+                threshold *= ETA;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE | CLK_GLOBAL_MEM_FENCE);
+    }
+
+    if (lid == 0)
+        counts[group] = num_kept;
+#endif // DETECTION_OUTPUT_STAGE_NMS
+
+#ifdef DETECTION_OUTPUT_STAGE_OUTPUT
+    // a single work group writes the detections of the images one after another
+    __local int num_detections;
+
+    const int lid = get_local_id(0);
+    int row = 0;
+    for (int image = 0; image < NUM_IMAGES; image++)
+    {
+        const __global int* image_counts = counts + image * NUM_CLASSES;
+        __global int* image_offsets = counts + NUM_IMAGES * NUM_CLASSES + image * NUM_CLASSES;
+        if (lid == 0)
+        {
+            int sum = 0;
+            for (int cls = 0; cls < NUM_CLASSES; cls++)
+            {
+                image_offsets[cls] = sum;
+                sum += image_counts[cls];
+            }
+            num_detections = sum;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE | CLK_GLOBAL_MEM_FENCE);
+
+        const int count = num_detections;
+        if (count > KEEP_TOP_K)
+        {
+            // the best keep_top_k detections over all the classes, written grouped by the label
+            for (int cls = 0; cls < NUM_CLASSES; cls++)
+            {
+                const __global float2* pairs = candidates + (image * NUM_CLASSES + cls) * CANDIDATES_CAPACITY;
+                const int offset = image_offsets[cls];
+                for (int i = lid; i < image_counts[cls]; i += LWS)
+                    scratch[offset + i] = (float4)(pairs[i].x, as_float(cls), pairs[i].y, 0.0f);
+            }
+            const int sort_size = FUNC_CALL(round_up_to_power_of_two)(count);
+            for (int i = count + lid; i < sort_size; i += LWS)
+                scratch[i] = (float4)(SCORE_SENTINEL, as_float(INT_MAX), as_float(INT_MAX), 0.0f);
+            barrier(CLK_GLOBAL_MEM_FENCE);
+            FUNC_CALL(sort_detections)(scratch, sort_size, false);
+
+            const int kept_size = FUNC_CALL(round_up_to_power_of_two)(KEEP_TOP_K);
+            for (int i = KEEP_TOP_K + lid; i < kept_size; i += LWS)
+                scratch[i] = (float4)(SCORE_SENTINEL, as_float(INT_MAX), as_float(INT_MAX), 0.0f);
+            barrier(CLK_GLOBAL_MEM_FENCE);
+            FUNC_CALL(sort_detections)(scratch, kept_size, true);
+
+            for (int i = lid; i < KEEP_TOP_K; i += LWS)
+            {
+                const float4 detection = scratch[i];
+                const int label = as_int(detection.y);
+                const float4 box = FUNC_CALL(get_box)(boxes, image, label, as_int(detection.z));
+                FUNC_CALL(write_detection)(output, row + i, image, label, detection.x, box);
+            }
+            row += KEEP_TOP_K;
+        }
+        else
+        {
+            for (int cls = 0; cls < NUM_CLASSES; cls++)
+            {
+                const __global float2* pairs = candidates + (image * NUM_CLASSES + cls) * CANDIDATES_CAPACITY;
+                const int offset = image_offsets[cls];
+                for (int i = lid; i < image_counts[cls]; i += LWS)
+                {
+                    const float4 box = FUNC_CALL(get_box)(boxes, image, cls, as_int(pairs[i].y));
+                    FUNC_CALL(write_detection)(output, row + offset + i, image, cls, pairs[i].x, box);
+                }
+            }
+            row += count;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE | CLK_GLOBAL_MEM_FENCE);
+    }
+
+    // the rest of the rows are marked with the image id -1
+    for (int i = row + lid; i < NUM_IMAGES * KEEP_TOP_K; i += LWS)
+        FUNC_CALL(write_detection)(output, i, -1, DECREASE_LABEL_ID ? 1 : 0, 0.0f, (float4)(0.0f));
+#endif // DETECTION_OUTPUT_STAGE_OUTPUT
+}
+
+#undef SCORE_SENTINEL
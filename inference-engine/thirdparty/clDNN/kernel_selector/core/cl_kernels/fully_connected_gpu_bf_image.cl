@@ -0,0 +1,69 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "include/include_all.cl"
+
+// The weights are a 4-channel image with a column per output feature:
+//   weights = image2d [x: FILTER_OFM_NUM, y: INPUT0_ELEMENTS_COUNT / 4]
+// the texel (o, i) holds the weights of the inputs 4 * i .. 4 * i + 3 of the output o. Every work item computes
+// one output feature of all the batches, so every texel is read once, and the neighbouring work items read the
+// neighbouring texels of a row from the texture cache.
+
+#if FP16_UNIT_USED
+    #define READ_WEIGHTS(coord) read_imageh(weights, weights_sampler, coord)
+#else
+    #define READ_WEIGHTS(coord) read_imagef(weights, weights_sampler, coord)
+#endif
+
+KERNEL(fully_connected_gpu_bf_image)(
+    const __global UNIT_TYPE* input,
+    __global UNIT_TYPE* output,
+    __read_only image2d_t weights
+#if BIAS_TERM
+    , const __global UNIT_TYPE* bias
+#endif
+    )
+{
+    // not at the program scope, which the other kernels compiled into the same program share
+    const sampler_t weights_sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_NONE | CLK_FILTER_NEAREST;
+
+    const uint o = get_global_id(0);
+
+    MAKE_VECTOR_TYPE(UNIT_TYPE, 4) acc[INPUT0_BATCH_NUM];
+    for (uint b = 0; b < INPUT0_BATCH_NUM; b++)
+        acc[b] = 0;
+
+    for (uint i = 0; i < INPUT0_ELEMENTS_COUNT / 4; i++)
+    {
+        const MAKE_VECTOR_TYPE(UNIT_TYPE, 4) w = READ_WEIGHTS((int2)(o, i));
+        for (uint b = 0; b < INPUT0_BATCH_NUM; b++)
+        {
+            acc[b] = mad(vload4(i, input + INPUT0_OFFSET + b * INPUT0_BATCH_PITCH), w, acc[b]);
+        }
+    }
+
+    for (uint b = 0; b < INPUT0_BATCH_NUM; b++)
+    {
+        UNIT_TYPE result = acc[b].s0 + acc[b].s1 + acc[b].s2 + acc[b].s3;
+#if BIAS_TERM
+        result += bias[o];
+#endif
+        output[OUTPUT_OFFSET + b * OUTPUT_BATCH_PITCH + o * OUTPUT_FEATURE_PITCH] = ACTIVATION(result, NL_M, NL_N);
+    }
+}
+
+#undef READ_WEIGHTS
@@ -0,0 +1,90 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "include/include_all.cl"
+
+// Multiplies the matrices of the batch, a work item per element of the output:
+//   input0 = [b: batch, f: batch, y: M, x: K] ([y: K, x: M] when TRANSPOSE_INPUT0)
+//   input1 = [b: batch, f: batch, y: K, x: N] ([y: N, x: K] when TRANSPOSE_INPUT1)
+//   input2 = [b: batch, f: batch, y: M, x: N] optional
+//   output = [b: batch, f: batch, y: M, x: N] = ALPHA * op(input0) * op(input1) + BETA * input2
+// A batch dimension (or a matrix dimension of input2) of size 1 is broadcast.
+
+#if TRANSPOSE_INPUT0
+#define K_SIZE INPUT0_SIZE_Y
+#define INPUT0_ROW_PITCH INPUT0_X_PITCH
+#define INPUT0_K_PITCH INPUT0_Y_PITCH
+#else
+#define K_SIZE INPUT0_SIZE_X
+#define INPUT0_ROW_PITCH INPUT0_Y_PITCH
+#define INPUT0_K_PITCH INPUT0_X_PITCH
+#endif
+
+#if TRANSPOSE_INPUT1
+#define INPUT1_COL_PITCH INPUT1_Y_PITCH
+#define INPUT1_K_PITCH INPUT1_X_PITCH
+#else
+#define INPUT1_COL_PITCH INPUT1_X_PITCH
+#define INPUT1_K_PITCH INPUT1_Y_PITCH
+#endif
+
+#define BROADCAST(size, idx) ((size) == 1 ? 0 : (idx))
+
+KERNEL(gemm_ref)(
+    const __global INPUT0_TYPE* input0,
+    const __global INPUT1_TYPE* input1,
+#if INPUT2_TERM
+    const __global INPUT2_TYPE* input2,
+#endif
+    __global OUTPUT_TYPE* output)
+{
+    const uint x = get_global_id(0);
+    const uint y = get_global_id(1);
+    const uint f = (uint)get_global_id(2) % OUTPUT_FEATURE_NUM;
+    const uint b = (uint)get_global_id(2) / OUTPUT_FEATURE_NUM;
+
+    uint input0_idx = INPUT0_OFFSET + BROADCAST(INPUT0_BATCH_NUM, b) * INPUT0_BATCH_PITCH +
+                      BROADCAST(INPUT0_FEATURE_NUM, f) * INPUT0_FEATURE_PITCH + y * INPUT0_ROW_PITCH;
+    uint input1_idx = INPUT1_OFFSET + BROADCAST(INPUT1_BATCH_NUM, b) * INPUT1_BATCH_PITCH +
+                      BROADCAST(INPUT1_FEATURE_NUM, f) * INPUT1_FEATURE_PITCH + x * INPUT1_COL_PITCH;
+
+    float acc = 0.0f;
+    for (uint k = 0; k < K_SIZE; k++)
+    {
+        acc = mad((float)input0[input0_idx], (float)input1[input1_idx], acc);
+        input0_idx += INPUT0_K_PITCH;
+        input1_idx += INPUT1_K_PITCH;
+    }
+    float result = ALPHA * acc;
+
+#if INPUT2_TERM
+    const uint input2_idx = INPUT2_OFFSET + BROADCAST(INPUT2_BATCH_NUM, b) * INPUT2_BATCH_PITCH +
+                            BROADCAST(INPUT2_FEATURE_NUM, f) * INPUT2_FEATURE_PITCH +
+                            BROADCAST(INPUT2_SIZE_Y, y) * INPUT2_Y_PITCH + BROADCAST(INPUT2_SIZE_X, x) * INPUT2_X_PITCH;
+    result = mad(BETA, (float)input2[input2_idx], result);
+#endif
+
+    const uint output_idx = OUTPUT_OFFSET + b * OUTPUT_BATCH_PITCH + f * OUTPUT_FEATURE_PITCH +
+                            y * OUTPUT_Y_PITCH + x * OUTPUT_X_PITCH;
+    output[output_idx] = (OUTPUT_TYPE)result;
+}
+
+#undef BROADCAST
+#undef INPUT1_K_PITCH
+#undef INPUT1_COL_PITCH
+#undef INPUT0_K_PITCH
+#undef INPUT0_ROW_PITCH
+#undef K_SIZE
@@ -0,0 +1,155 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "include/include_all.cl"
+
+// Runs all the timesteps of the LSTM sequence, a work group per batch item:
+//   input     = [b: batch, f: sequence,  x: input_size,      y: 1]
+//   weights   = [b: 1,     f: direction, x: input_size,      y: 4 * hidden_size]
+//   recurrent = [b: 1,     f: direction, x: hidden_size,     y: 4 * hidden_size]
+//   bias      = [b: 1,     f: 1,         x: 4 * hidden_size, y: direction]
+//   hidden    = [b: batch, f: direction, x: hidden_size,     y: 1]
+//   cell      = [b: batch, f: direction, x: hidden_size,     y: 1]
+//   output    = [b: batch, f: sequence,  x: hidden_size,     y: 1]
+// The hidden state of the previous timestep is kept in the local memory, every work item keeps the cell state of its
+// UNITS_PER_ITEM hidden units in the registers. The gates follow lstm_gemm and lstm_elt of the unrolled sequence.
+
+#define WEIGHT(row, k) ((float)weights[WEIGHTS_OFFSET + (row) * WEIGHTS_Y_PITCH + (k) * WEIGHTS_X_PITCH])
+
+#if RECURRENT_IN_SLM
+#define RECURRENT_WEIGHT(row, k) ((float)slm_recurrent[(row) * HIDDEN_SIZE + (k)])
+#else
+#define RECURRENT_WEIGHT(row, k) ((float)recurrent[RECURRENT_OFFSET + (row) * RECURRENT_Y_PITCH + (k) * RECURRENT_X_PITCH])
+#endif
+
+inline float FUNC(sigmoid)(float x)
+{
+    return 1.0f / (1.0f + exp(-x));
+}
+
+KERNEL(lstm_seq_gpu_bfyx_ref)(
+    const __global UNIT_TYPE* input,
+    __global UNIT_TYPE* output,
+    const __global UNIT_TYPE* weights,
+    const __global UNIT_TYPE* recurrent
+#if BIAS_TERM
+    , const __global UNIT_TYPE* bias
+#endif
+#if HIDDEN_TERM
+    , const __global UNIT_TYPE* initial_hidden
+#endif
+#if CELL_TERM
+    , const __global UNIT_TYPE* initial_cell
+#endif
+    )
+{
+    const uint lid = get_local_id(0);
+    const uint b = get_global_id(1);
+
+    __local float hidden[HIDDEN_SIZE];
+#if RECURRENT_IN_SLM
+    __local UNIT_TYPE slm_recurrent[4 * HIDDEN_SIZE * HIDDEN_SIZE];
+    for (uint i = lid; i < 4 * HIDDEN_SIZE * HIDDEN_SIZE; i += LWS)
+    {
+        const uint row = i / HIDDEN_SIZE;
+        const uint k = i % HIDDEN_SIZE;
+        slm_recurrent[i] = recurrent[RECURRENT_OFFSET + row * RECURRENT_Y_PITCH + k * RECURRENT_X_PITCH];
+    }
+#endif
+
+    // the missing initial state is zero, the same as the first step of the unrolled sequence skipping the terms
+    float cell[UNITS_PER_ITEM];
+    for (uint u = 0; u < UNITS_PER_ITEM; u++)
+    {
+        const uint j = lid + u * LWS;
+        cell[u] = 0.0f;
+        if (j < HIDDEN_SIZE)
+        {
+#if HIDDEN_TERM
+            hidden[j] = (float)initial_hidden[HIDDEN_OFFSET + b * HIDDEN_BATCH_PITCH + j * HIDDEN_X_PITCH];
+#else
+            hidden[j] = 0.0f;
+#endif
+#if CELL_TERM
+            cell[u] = (float)initial_cell[CELL_OFFSET + b * CELL_BATCH_PITCH + j * CELL_X_PITCH];
+#endif
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (uint t = 0; t < SEQUENCE_LEN; t++)
+    {
+        const __global UNIT_TYPE* x = input + INPUT0_OFFSET + b * INPUT0_BATCH_PITCH + t * INPUT0_FEATURE_PITCH;
+        float new_hidden[UNITS_PER_ITEM];
+
+        for (uint u = 0; u < UNITS_PER_ITEM; u++)
+        {
+            const uint j = lid + u * LWS;
+            if (j >= HIDDEN_SIZE)
+                break;
+
+            // (i, o, f, z) gates of the hidden unit
+#if BIAS_TERM
+            float4 gates = (float4)((float)bias[BIAS_OFFSET + (GEMM_OFFSET_I + j) * BIAS_X_PITCH],
+                                    (float)bias[BIAS_OFFSET + (GEMM_OFFSET_O + j) * BIAS_X_PITCH],
+                                    (float)bias[BIAS_OFFSET + (GEMM_OFFSET_F + j) * BIAS_X_PITCH],
+                                    (float)bias[BIAS_OFFSET + (GEMM_OFFSET_Z + j) * BIAS_X_PITCH]);
+#else
+            float4 gates = (float4)(0.0f);
+#endif
+            for (uint k = 0; k < INPUT_SIZE; k++)
+            {
+                const float xk = (float)x[k * INPUT0_X_PITCH];
+                gates += (float4)(WEIGHT(GEMM_OFFSET_I + j, k),
+                                  WEIGHT(GEMM_OFFSET_O + j, k),
+                                  WEIGHT(GEMM_OFFSET_F + j, k),
+                                  WEIGHT(GEMM_OFFSET_Z + j, k)) * xk;
+            }
+            for (uint k = 0; k < HIDDEN_SIZE; k++)
+            {
+                const float hk = hidden[k];
+                gates += (float4)(RECURRENT_WEIGHT(GEMM_OFFSET_I + j, k),
+                                  RECURRENT_WEIGHT(GEMM_OFFSET_O + j, k),
+                                  RECURRENT_WEIGHT(GEMM_OFFSET_F + j, k),
+                                  RECURRENT_WEIGHT(GEMM_OFFSET_Z + j, k)) * hk;
+            }
+
+            float c = FUNC_CALL(sigmoid)(CLIP(gates.s0)) * tanh(CLIP(gates.s3));
+#if INPUT_FORGET
+            c *= 1.0f - gates.s2;
+#endif
+            c += cell[u] * FUNC_CALL(sigmoid)(CLIP(gates.s2));
+            const float h = tanh(c) * FUNC_CALL(sigmoid)(gates.s1);
+
+            cell[u] = c;
+            new_hidden[u] = h;
+            output[OUTPUT_OFFSET + b * OUTPUT_BATCH_PITCH + t * OUTPUT_FEATURE_PITCH + j * OUTPUT_X_PITCH] = (UNIT_TYPE)h;
+        }
+
+        // every work item reads the whole hidden state of the previous step before it is replaced
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for (uint u = 0; u < UNITS_PER_ITEM; u++)
+        {
+            const uint j = lid + u * LWS;
+            if (j < HIDDEN_SIZE)
+                hidden[j] = new_hidden[u];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+}
+
+#undef RECURRENT_WEIGHT
+#undef WEIGHT
@@ -0,0 +1,220 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "include/include_all.cl"
+
+// The stages keep the proposals in the internal buffers:
+//   rois - the decoded boxes of all the anchors as (x0, y0, x1, y1)
+//   keys - the (confidence, index) pairs sorted by the confidence and reduced by the NMS in place
+// The index is stored in the float component as its bits, the filtered out proposals get the lowest confidence.
+
+#define CONFIDENCE_SENTINEL (-FLT_MAX)
+#define EPSILON 0.00001f
+
+// The ties are resolved to the later proposal like the host implementation does
+inline bool FUNC(proposal_before)(float2 a, float2 b)
+{
+    return a.x > b.x || (a.x == b.x && as_int(a.y) > as_int(b.y));
+}
+
+// Bitonic sort of the power of two sized buffer by the work group
+inline void FUNC(sort_proposals)(__global float2* data, int size)
+{
+    for (int k = 2; k <= size; k <<= 1)
+    {
+        for (int j = k >> 1; j > 0; j >>= 1)
+        {
+            for (int i = get_local_id(0); i < size; i += LWS)
+            {
+                const int other = i ^ j;
+                if (other > i)
+                {
+                    const float2 a = data[i];
+                    const float2 b = data[other];
+                    const bool swap = (i & k) == 0 ? FUNC_CALL(proposal_before)(b, a)
+                                                   : FUNC_CALL(proposal_before)(a, b);
+                    if (swap)
+                    {
+                        data[i] = b;
+                        data[other] = a;
+                    }
+                }
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+    }
+}
+
+inline float FUNC(roi_area)(float4 roi)
+{
+    return max(0.0f, roi.w - roi.y + 1.0f) * max(0.0f, roi.z - roi.x + 1.0f);
+}
+
+inline float FUNC(roi_overlap)(float4 a, float4 b)
+{
+    const bool intersecting = (a.x < b.z) & (b.x < a.z) & (a.y < b.w) & (b.y < a.w);
+    if (!intersecting)
+        return 0.0f;
+    const float intersect_width = min(a.z, b.z) - max(a.x, b.x) + 1.0f;
+    const float intersect_height = min(a.w, b.w) - max(a.y, b.y) + 1.0f;
+    const float intersect_size = intersect_width * intersect_height;
+    return intersect_size / (FUNC_CALL(roi_area)(a) + FUNC_CALL(roi_area)(b) - intersect_size);
+}
+
+inline float FUNC(read_image_info)(const __global UNIT_TYPE* image_info, int index)
+{
+    return (float)image_info[INPUT2_OFFSET + index * INPUT2_X_PITCH];
+}
+
+KERNEL(proposal_gpu_ref)(
+    const __global UNIT_TYPE* cls_scores,
+    const __global UNIT_TYPE* bbox_pred,
+    const __global UNIT_TYPE* image_info,
+    __global UNIT_TYPE* output,
+    __global float4* rois,
+    __global float2* keys)
+{
+#ifdef PROPOSAL_STAGE_DECODE
+    // a work item decodes the box of one anchor at one location of the feature map
+    const int index = get_global_id(0);
+    const int anchor = index % NUM_ANCHORS;
+    const int location = index / NUM_ANCHORS;
+    const int x = location % INPUT0_SIZE_X;
+    const int y = location / INPUT0_SIZE_X;
+
+    const int img_h = (int)(FUNC_CALL(read_image_info)(image_info, 0) + EPSILON);
+    const int img_w = (int)(FUNC_CALL(read_image_info)(image_info, 1) + EPSILON);
+#if IMAGE_INFO_SIZE == 4
+    const int min_bbox_x = (int)(MIN_BBOX_SIZE * FUNC_CALL(read_image_info)(image_info, 3));
+    const int min_bbox_y = (int)(MIN_BBOX_SIZE * FUNC_CALL(read_image_info)(image_info, 2));
+#else
+    const int scaled_min_bbox_size = MIN_BBOX_SIZE * (int)(FUNC_CALL(read_image_info)(image_info, 2) + EPSILON);
+#if IMAGE_INFO_SIZE > 4
+    const int min_bbox_x = (int)(scaled_min_bbox_size * FUNC_CALL(read_image_info)(image_info, 4));
+#else
+    const int min_bbox_x = scaled_min_bbox_size;
+#endif
+#if IMAGE_INFO_SIZE > 3
+    const int min_bbox_y = (int)(scaled_min_bbox_size * FUNC_CALL(read_image_info)(image_info, 3));
+#else
+    const int min_bbox_y = scaled_min_bbox_size;
+#endif
+#endif
+
+    const int delta_index = INPUT1_OFFSET + y * INPUT1_Y_PITCH + x * INPUT1_X_PITCH + anchor * 4 * INPUT1_FEATURE_PITCH;
+    const float shift_x = (float)bbox_pred[delta_index];
+    const float shift_y = (float)bbox_pred[delta_index + INPUT1_FEATURE_PITCH];
+    const float log_w = (float)bbox_pred[delta_index + 2 * INPUT1_FEATURE_PITCH];
+    const float log_h = (float)bbox_pred[delta_index + 3 * INPUT1_FEATURE_PITCH];
+    const float confidence = (float)cls_scores[INPUT0_OFFSET + y * INPUT0_Y_PITCH + x * INPUT0_X_PITCH +
+                                               (anchor + NUM_ANCHORS) * INPUT0_FEATURE_PITCH];
+
+    const float anchor_start_x = ANCHORS[anchor * 4];
+    const float anchor_start_y = ANCHORS[anchor * 4 + 1];
+    const float anchor_w = ANCHORS[anchor * 4 + 2] - anchor_start_x + 1.0f;
+    const float anchor_h = ANCHORS[anchor * 4 + 3] - anchor_start_y + 1.0f;
+    const float center_x = anchor_start_x + anchor_w * 0.5f;
+    const float center_y = anchor_start_y + anchor_h * 0.5f;
+
+    const float pred_center_x = shift_x * anchor_w + center_x + x * FEATURE_STRIDE;
+    const float pred_center_y = shift_y * anchor_h + center_y + y * FEATURE_STRIDE;
+    const float half_pred_w = exp(log_w) * anchor_w * 0.5f;
+    const float half_pred_h = exp(log_h) * anchor_h * 0.5f;
+
+    const float4 roi = (float4)(clamp(pred_center_x - half_pred_w, 0.0f, img_w - 1.0f),
+                                clamp(pred_center_y - half_pred_h, 0.0f, img_h - 1.0f),
+                                clamp(pred_center_x + half_pred_w, 0.0f, img_w - 1.0f),
+                                clamp(pred_center_y + half_pred_h, 0.0f, img_h - 1.0f));
+
+    const int bbox_w = (int)roi.z - (int)roi.x + 1;
+    const int bbox_h = (int)roi.w - (int)roi.y + 1;
+    const bool valid = bbox_w >= min_bbox_x && bbox_h >= min_bbox_y && confidence > 0.0f;
+
+    rois[index] = roi;
+    keys[index] = (float2)(valid ? confidence : CONFIDENCE_SENTINEL, as_float(index));
+#endif // PROPOSAL_STAGE_DECODE
+
+#ifdef PROPOSAL_STAGE_NMS
+    // a single work group sorts the proposals and runs the NMS over them
+    __local int num_valid;
+    __local int num_kept;
+    __local int suppressed;
+
+    const int lid = get_local_id(0);
+    if (lid == 0)
+    {
+        num_valid = 0;
+        num_kept = 0;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (int i = lid; i < NUM_PROPOSALS; i += LWS)
+    {
+        if (keys[i].x != CONFIDENCE_SENTINEL)
+            atomic_inc(&num_valid);
+    }
+    for (int i = NUM_PROPOSALS + lid; i < PROPOSALS_CAPACITY; i += LWS)
+        keys[i] = (float2)(CONFIDENCE_SENTINEL, as_float(-1));
+    barrier(CLK_LOCAL_MEM_FENCE | CLK_GLOBAL_MEM_FENCE);
+
+    FUNC_CALL(sort_proposals)(keys, PROPOSALS_CAPACITY);
+
+    const int count = min(num_valid, PRE_NMS_TOPN);
+    for (int c = 0; c < count; c++)
+    {
+        // the work items compare the proposal with the kept ones in parallel
+        const int kept = num_kept;
+        if (kept == POST_NMS_TOPN)
+            break;
+
+        const float2 candidate = keys[c];
+        const float4 roi = rois[as_int(candidate.y)];
+        if (lid == 0)
+            suppressed = 0;
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (int i = lid; i < kept; i += LWS)
+        {
+            if (FUNC_CALL(roi_overlap)(roi, rois[as_int(keys[i].y)]) > IOU_THRESHOLD)
+                suppressed = 1;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        if (!suppressed && lid == 0)
+        {
+            keys[kept] = candidate;
+            num_kept = kept + 1;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE | CLK_GLOBAL_MEM_FENCE);
+    }
+
+    // the rows of the dropped proposals are zeroed
+    const int kept = num_kept;
+    for (int i = lid; i < POST_NMS_TOPN; i += LWS)
+    {
+        const float4 roi = i < kept ? rois[as_int(keys[i].y)] : (float4)(0.0f);
+        __global UNIT_TYPE* out = output + OUTPUT_OFFSET + i * OUTPUT_BATCH_PITCH;
+        out[0] = (UNIT_TYPE)(0.0f);
+        out[1 * OUTPUT_X_PITCH] = (UNIT_TYPE)(roi.x);
+        out[2 * OUTPUT_X_PITCH] = (UNIT_TYPE)(roi.y);
+        out[3 * OUTPUT_X_PITCH] = (UNIT_TYPE)(roi.z);
+        out[4 * OUTPUT_X_PITCH] = (UNIT_TYPE)(roi.w);
+    }
+#endif // PROPOSAL_STAGE_NMS
+}
+
+#undef CONFIDENCE_SENTINEL
+#undef EPSILON
@@ -275,6 +275,37 @@ namespace kernel_selector {
         return sizes;
     }
 
+    // the global dimension of the batch in GetTensorFriendlyWorkGroups (GWS_BATCH)
+    inline size_t GetTensorFriendlyWorkGroupsBatchDim(const DataTensor& t)
+    {
+        auto b = DataTensor::Channelndex(t.GetLayout(), Tensor::DataChannelName::BATCH);
+        auto x = DataTensor::Channelndex(t.GetLayout(), Tensor::DataChannelName::X);
+
+        return (x != -1 && b > x) ? b - 1 : b;
+    }
+
+    // Marks the kernel as able to run a smaller batch than it was compiled for, when the batch is the slowest part of
+    // the global dimension 'dim' and the local size keeps dividing it. The kernel stays batch fixed otherwise.
+    inline void SetRuntimeBatch(clKernelData& kernel, size_t dim, size_t batch)
+    {
+        const auto& global = kernel.workGroups.global;
+        const auto& local = kernel.workGroups.local;
+
+        if (batch == 0 || dim >= global.size() || global[dim] % batch != 0)
+        {
+            return;
+        }
+
+        const size_t perBatch = global[dim] / batch;
+        if (dim < local.size() && local[dim] != 0 && perBatch % local[dim] != 0)
+        {
+            return;
+        }
+
+        kernel.runtimeBatch.dim = static_cast<int>(dim);
+        kernel.runtimeBatch.batch = batch;
+    }
+
     inline std::vector<size_t> GetOptimalLocalWorkGroupSizes(std::vector<size_t> gws)
     {
         const size_t lws_max = 256;
@@ -86,8 +86,41 @@ namespace kernel_selector {
             options.GetType() == kType)
         {
             const ParamsKey requireKey = params.GetParamsKey().Merge(options.GetSupportedKey());
-            for (const auto& implementation : implementations)
+            const std::string decisionKey = params.to_string() + "|" + requireKey.to_string() + "|" + params.engineInfo.deviceId;
+
+            size_t decision = implementations.size();
+            {
+                std::lock_guard<std::mutex> lock(naiveDecisionsMutex);
+                const auto& it = naiveDecisions.find(decisionKey);
+                if (it != naiveDecisions.end())
+                {
+                    decision = it->second;
+                }
+            }
+
+            // The params string does not hold all the fields, so the chosen implementation may reject the params of
+            // the same key, then all the implementations are tried again
+            if (decision < implementations.size())
+            {
+                const auto& implementation = implementations[decision];
+                try
+                {
+                    KernelsData kds = implementation->GetKernelsData(params, options);
+                    if (kds.size() && kds[0].kernels.size())
+                    {
+                        kernelsData = kds;
+                        kernelName = implementation->GetName();
+                    }
+                }
+                catch (std::runtime_error&)
+                {
+                }
+            }
+
+            const bool search = kernelsData.empty();
+            for (size_t i = 0; search && i < implementations.size(); i++)
             {
+                const auto& implementation = implementations[i];
                 const ParamsKey implKey = implementation->GetSupportedKey();
                 if (implKey.Support(requireKey))
                 {
@@ -119,6 +152,7 @@ namespace kernel_selector {
                                 {
                                     kernelsData = kds;
                                     kernelName = implementation->GetName();
+                                    decision = i;
                                 }
                             }
                         }
@@ -129,6 +163,12 @@ namespace kernel_selector {
                     }
                 }
             }
+
+            if (kernelsData.size())
+            {
+                std::lock_guard<std::mutex> lock(naiveDecisionsMutex);
+                naiveDecisions[decisionKey] = decision;
+            }
         }
 
         // TODO: find a better place to located this assignment 
@@ -165,6 +205,13 @@ namespace kernel_selector {
             else // Try to load kernel/config from on-line cache
             {
                 cachedKernelConfig = autoTuner.LoadKernelOnline(options.tuningParams.mode, options.tuningParams.cacheFilePath, params.engineInfo.deviceId, params.engineInfo.driverVersion, params.engineInfo.hostVersion, hash);
+#if ENABLE_OFFLINE_TUNING_CACHE
+                // The layers not tuned on this machine yet take the kernels tuned offline for the device
+                if (std::get<0>(cachedKernelConfig).empty() && options.tuningParams.mode == TuningMode::TUNING_USE_CACHE)
+                {
+                    cachedKernelConfig = autoTuner.LoadKernelOffline(params.engineInfo.deviceId, hash);
+                }
+#endif
             }       
             bool hashFoundInCache = !std::get<0>(cachedKernelConfig).empty();
 
@@ -239,7 +286,7 @@ namespace kernel_selector {
             {
                 kernelsData[0].kernelName = kernelName;
                 kernelsData[0].kernels[0].layerID = params.layerID;
-                autoTuner.StoreKernel(options.tuningParams.cacheFilePath, hash, kernelName, kernelsData[0].autoTuneIndex);
+                autoTuner.StoreKernel(options.tuningParams.cacheFilePath, params.engineInfo.deviceId, params.engineInfo.driverVersion, params.engineInfo.hostVersion, hash, kernelName, kernelsData[0].autoTuneIndex);
             }
         } 
 
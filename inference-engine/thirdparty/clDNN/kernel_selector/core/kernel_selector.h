@@ -21,6 +21,7 @@
 #include "kernel_selector_params.h"
 #include "kernel_runner_interface.h"
 #include "auto_tuner.h"
+#include <mutex>
 
 namespace kernel_selector 
 {
@@ -49,6 +50,12 @@ namespace kernel_selector
         KernelList implementations;
         ForceList forceKernels;
 
+        // The implementations chosen by GetNaiveBestKernel per the params, their key and the device, so the layers of
+        // the same shapes and types (repeated in a network and in the networks built again) generate the kernels of
+        // the only implementation instead of all the supporting ones
+        mutable std::map<std::string, size_t> naiveDecisions;
+        mutable std::mutex naiveDecisionsMutex;
+
         static AutoTuner autoTuner;
     };
 }
\ No newline at end of file
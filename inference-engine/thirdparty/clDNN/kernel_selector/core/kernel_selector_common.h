@@ -172,6 +172,17 @@ namespace kernel_selector {
 
     using Arguments = std::vector<ArgumentDescriptor>;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RuntimeBatch
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The global work size of the dimension 'dim' is 'batch' equal groups of work items and the batch index is the slowest
+    // part of the id (b = id / (global[dim] / batch)), so a smaller batch runs the same kernel on a scaled down global size.
+    struct RuntimeBatch
+    {
+        int     dim = -1;           // -1 - the batch is baked into the kernel
+        size_t  batch = 0;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // clKernelData
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -181,6 +192,7 @@ namespace kernel_selector {
         WorkGroupSizes                  workGroups;
         Arguments                       arguments;
         Scalars                         scalars;
+        RuntimeBatch                    runtimeBatch;
         std::string                     layerID;            // TODO: in order to support run single layer. think about more appropriate place
     };
 
@@ -347,6 +359,10 @@ namespace kernel_selector {
         case KernelType::REORG_YOLO:        return "REORG_YOLO";
         case KernelType::ELTWISE:           return "ELTWISE";
         case KernelType::REORDER:           return "REORDER";
+        case KernelType::DETECTION_OUTPUT:  return "DETECTION_OUTPUT";
+        case KernelType::PROPOSAL:          return "PROPOSAL";
+        case KernelType::LSTM_SEQ:          return "LSTM_SEQ";
+        case KernelType::GEMM:              return "GEMM";
         default:
             return "";
         }
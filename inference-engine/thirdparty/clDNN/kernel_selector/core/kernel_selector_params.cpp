@@ -20,6 +20,17 @@
  
 namespace kernel_selector {
 
+    std::string ParamsKey::to_string() const
+    {
+        std::stringstream s;
+        s << std::hex << key.restrict.raw << "_" << key.machineInfo.raw << "_" << key.enableTuning << "_"
+          << key.inputType.raw << "_" << key.outputType.raw << "_"
+          << key.inputWeightsType.raw << "_" << key.outputWeightsType.raw << "_"
+          << key.inputLayout << "_" << key.outputLayout << "_"
+          << key.weightsInputLayout << "_" << key.weightsOutputLayout;
+        return s.str();
+    }
+
     std::string Params::to_string() const
     {
         std::stringstream s;
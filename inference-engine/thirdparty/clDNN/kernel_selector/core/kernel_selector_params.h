@@ -769,6 +769,9 @@ namespace kernel_selector
             return ret;
         }
 
+        // All the bits of the key, the equal strings are of the equal keys
+        std::string to_string() const;
+
     private:
         Key key;
     };
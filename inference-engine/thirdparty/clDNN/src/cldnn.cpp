@@ -242,7 +242,7 @@ void cldnn_release_engine(cldnn_engine engine, cldnn_status* status)
 
 cldnn_engine_info cldnn_get_engine_info(cldnn_engine engine, cldnn_status* status)
 {
-    return exception_handler<cldnn_engine_info>(CLDNN_ERROR, status, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, [&]() -> cldnn_engine_info
+    return exception_handler<cldnn_engine_info>(CLDNN_ERROR, status, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, [&]() -> cldnn_engine_info
     {
         SHOULD_NOT_BE_NULL(engine, "Engine");
         auto info = api_cast(engine)->get_engine_info();
@@ -259,7 +259,8 @@ cldnn_engine_info cldnn_get_engine_info(cldnn_engine engine, cldnn_status* statu
             info.supports_fp16,
             info.supports_fp16_denorms,
             info.supports_subgroups_short,
-            info.supports_image
+            info.supports_image,
+            info.host_unified_memory
        };
     });
 }
@@ -486,6 +487,36 @@ float cldnn_get_learning_rate(cldnn_network network, cldnn_status* status)
     });
 }
 
+void cldnn_set_network_yield_handler(cldnn_network network, cldnn_event_handler handler, void* param, uint32_t slice, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        if (handler == nullptr || slice == 0)
+            api_cast(network)->set_yield_handler(nullptr, 0);
+        else
+            api_cast(network)->set_yield_handler([handler, param]() { handler(param); }, slice);
+    });
+}
+
+int32_t cldnn_network_supports_runtime_batch(cldnn_network network, cldnn_status* status)
+{
+    return exception_handler<int32_t>(CLDNN_ERROR, status, 0, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        return api_cast(network)->supports_runtime_batch() ? 1 : 0;
+    });
+}
+
+void cldnn_set_network_batch(cldnn_network network, uint32_t batch, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        api_cast(network)->set_batch(batch);
+    });
+}
+
 cldnn_engine cldnn_get_network_engine(cldnn_network network, cldnn_status* status)
 {
     return exception_handler<cldnn_engine>(CLDNN_ERROR, status, nullptr, [&]()
@@ -783,6 +814,45 @@ cldnn_memory cldnn_attach_memory(cldnn_layout layout, void* pointer, size_t size
     });
 }
 
+cldnn_memory cldnn_share_buffer(cldnn_engine engine, cldnn_layout layout, void* buffer, cldnn_status* status)
+{
+    return exception_handler<cldnn_memory>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        SHOULD_NOT_BE_NULL(buffer, "Buffer");
+        if (layout.format < cldnn_format_any || layout.format >= cldnn_format_format_num)
+            throw std::invalid_argument("Unknown format of layout.");
+
+        return init_external_from_internal(api_cast(engine)->share_buffer(layout, buffer));
+    });
+}
+
+cldnn_memory cldnn_allocate_host_memory(cldnn_engine engine, cldnn_layout layout, cldnn_status* status)
+{
+    return exception_handler<cldnn_memory>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        if (layout.format < cldnn_format_any || layout.format >= cldnn_format_format_num)
+            throw std::invalid_argument("Unknown format of layout.");
+
+        return init_external_from_internal(api_cast(engine)->allocate_host_memory(layout));
+    });
+}
+
+void cldnn_copy_memory(cldnn_memory src, cldnn_memory dst, int32_t blocking, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(src, "Source memory");
+        SHOULD_NOT_BE_NULL(dst, "Destination memory");
+        auto engine = api_cast(src)->get_engine();
+        if (!engine)
+            throw std::invalid_argument("the copied memory has to be allocated by an engine");
+
+        engine->copy_memory(*api_cast(src), *api_cast(dst), blocking != 0);
+    });
+}
+
 CLDNN_API int32_t cldnn_is_the_same_buffer(cldnn_memory mem1, cldnn_memory mem2, cldnn_status* status)
 {
     return static_cast<int32_t>(exception_handler<bool>(CLDNN_ERROR, status, false, [&]()
@@ -949,4 +1019,5 @@ PRIMITIVE_TYPE_ID_CALL_IMPL(fully_connected_grad_weights)
 PRIMITIVE_TYPE_ID_CALL_IMPL(lstm)
 PRIMITIVE_TYPE_ID_CALL_IMPL(lstm_gemm)
 PRIMITIVE_TYPE_ID_CALL_IMPL(lstm_elt)
+PRIMITIVE_TYPE_ID_CALL_IMPL(gemm)
 PRIMITIVE_TYPE_ID_CALL_IMPL(softmax_loss_grad)
\ No newline at end of file
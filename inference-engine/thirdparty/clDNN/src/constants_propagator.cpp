@@ -20,10 +20,71 @@
 #include "network_impl.h"
 #include "memory_impl.h"
 
+#include "generic_layer_inst.h"
+#include "reorder_inst.h"
+
 #include "api/CPP/input_layout.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <typeinfo>
+
 using namespace cldnn;
 
+namespace {
+
+std::string layout_key(const layout& l)
+{
+    std::stringstream ss;
+    ss << static_cast<int>(l.data_type) << ' ' << static_cast<int>(l.format.value) << ' ' << l.size
+       << ' ' << l.data_padding.lower_size() << ' ' << l.data_padding.upper_size();
+    return ss.str();
+}
+
+uint64_t content_hash(memory_impl& mem)
+{
+    // FNV-1a over 64-bit words, the tail bytes are hashed one by one
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    mem_lock<uint8_t> lock(mem);
+    const size_t size = mem.size();
+    const uint8_t* data = lock.data();
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; ++i)
+        hash = (hash ^ data[i]) * prime;
+    return hash;
+}
+
+// the reorder kernel of the weights is generated from the layouts, the entry point is unique per program
+std::string weights_reorder_key(const generic_layer& prim)
+{
+    const auto& params = prim.generic_params;
+    if (params.engine == kernel_selector::generic_kernel_params::Engine::GPU && params.clKernel &&
+        params.clKernel->kernelString)
+    {
+        const auto& kernel = *params.clKernel->kernelString;
+        std::string jit = kernel.jit;
+        if (!kernel.entry_point.empty())
+        {
+            for (auto pos = jit.find(kernel.entry_point); pos != std::string::npos; pos = jit.find(kernel.entry_point, pos))
+                jit.erase(pos, kernel.entry_point.size());
+        }
+        return "gpu " + kernel.options + "\n" + jit;
+    }
+    if (params.engine == kernel_selector::generic_kernel_params::Engine::CPU && params.cpuKernel)
+        return std::string("cpu ") + typeid(*params.cpuKernel).name();
+    return{};
+}
+
+}
+
 constants_propagator::constants_propagator(program_impl::ptr program) : prog(program)
 {
 }
@@ -37,7 +98,7 @@ void constants_propagator::visit_node(program_node& node)
 std::list<std::pair<primitive_id, memory_impl::ptr>> constants_propagator::calculate()
 {
     if (!has_non_trivial_constants)
-        return{};
+        return cached_outputs;
 
     build_options bo;
     bo.set_option(build_option::optimize_data(false));
@@ -50,9 +111,14 @@ std::list<std::pair<primitive_id, memory_impl::ptr>> constants_propagator::calcu
     net->reset_execution(true); //wait for computations to complete
     auto outputs = net->get_outputs();
 
-    std::list<std::pair<primitive_id, memory_impl::ptr>> ret;
+    std::list<std::pair<primitive_id, memory_impl::ptr>> ret = cached_outputs;
     for (auto& out : outputs)
+    {
         ret.push_back({ out->id(), &out->output_memory() });
+        auto key = cache_keys.find(out->id());
+        if (key != cache_keys.end())
+            prog->get_engine().cache_constant(key->second, out->output_memory());
+    }
 
     return ret;
 }
@@ -61,6 +127,8 @@ void constants_propagator::handle_constant(program_node& node)
 {
     if (!node.is_type<data>())
     {
+        if (reuse_cached(node))
+            return;
         add_constant(node);
         if (node.has_non_const_user())
             const_outputs.push_back(node.id());
@@ -90,3 +158,41 @@ void constants_propagator::add_constant(program_node& node)
     }
 }
 
+bool constants_propagator::reuse_cached(program_node& node)
+{
+    //only the reorders of the weights are shared: a reorder of a single data primitive, used by the non-const nodes only
+    if (node.get_dependencies().size() != 1 || !node.get_dependency(0).is_type<data>() || node.is_output() ||
+        !node.has_non_const_user())
+        return false;
+    const auto& users = node.get_users();
+    if (std::any_of(users.begin(), users.end(), [](const program_node* user) { return user->is_constant(); }))
+        return false;
+
+    std::string kind;
+    if (node.is_type<generic_layer>())
+    {
+        kind = weights_reorder_key(*node.as<generic_layer>().get_primitive());
+    }
+    else if (node.is_type<reorder>())
+    {
+        auto prim = node.as<reorder>().get_primitive();
+        if (prim->mean.empty() && prim->subtract_per_feature.empty())
+            kind = "reorder";
+    }
+    if (kind.empty())
+        return false;
+
+    auto& weights = node.get_dependency(0).as<data>().get_attached_memory();
+    std::stringstream key;
+    key << kind << '\n' << layout_key(weights.get_layout()) << '\n' << layout_key(node.get_output_layout()) << '\n'
+        << std::hex << content_hash(weights);
+
+    auto cached = prog->get_engine().get_cached_constant(key.str());
+    if (!cached)
+    {
+        cache_keys[node.id()] = key.str();
+        return false;
+    }
+    cached_outputs.push_back({ node.id(), cached });
+    return true;
+}
@@ -22,6 +22,7 @@
 #include "gpu/ocl_toolkit.h"
 #include "gpu/memory_gpu.h"
 #include "gpu/ocl_user_event.h"
+#include <algorithm>
 
 namespace cldnn
 {
@@ -35,9 +36,13 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf)
     result.meaningful_kernels_names = conf.meaningful_kernels_names != 0;
     result.dump_custom_program = conf.dump_custom_program != 0;
     result.single_kernel_name = conf.single_kernel_name;
-    result.host_out_of_order = true; //TODO: enable when barriers in driver will be fixed
+    result.host_out_of_order = conf.enable_parallelisation != 0;
     result.log = conf.engine_log;
     result.ocl_sources_dumps_dir = conf.sources_dumps_dir;
+    result.kernels_cache_path = conf.kernels_cache_path;
+    result.compilation_threads = conf.compilation_threads;
+    result.user_context = static_cast<cl_context>(conf.context);
+    result.user_queue = static_cast<cl_command_queue>(conf.queue);
     result.priority_mode = static_cast<cldnn_priority_mode_type>(conf.priority_mode);
     result.throttle_mode = static_cast<cldnn_throttle_mode_type>(conf.throttle_mode);
     return result;
@@ -61,6 +66,21 @@ memory_impl::ptr engine_impl::allocate_memory(layout layout, primitive_id id, ui
     return _memory_pool.get_memory(layout);
 }
 
+memory_impl::ptr engine_impl::share_host_memory(memory_impl& memory)
+{
+    auto layout = memory.get_layout();
+    if (!get_context()->get_engine_info().host_unified_memory || layout.format.is_image())
+        return nullptr;
+
+    // the driver uses the host memory in place only if it is page aligned and holds whole cache lines
+    void* ptr = memory.lock();
+    memory.unlock();
+    if (reinterpret_cast<uintptr_t>(ptr) % BUFFER_ALIGNMENT != 0 || memory.size() % CACHE_ALIGNMENT != 0)
+        return nullptr;
+
+    return{ new gpu::gpu_buffer(this, layout, ptr), false };
+}
+
 memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, layout new_layout)
 {
     if (memory.get_engine() != this)
@@ -83,6 +103,82 @@ memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, layo
     }
 }
 
+memory_impl::ptr engine_impl::share_buffer(layout layout, void* buffer)
+{
+    if (layout.format.is_image())
+        throw error("sharing of the OpenCL images is not supported", CLDNN_ERROR);
+
+    cl::Buffer cl_buffer(static_cast<cl_mem>(buffer), true);
+    if (cl_buffer.getInfo<CL_MEM_CONTEXT>()() != get_context()->context()())
+        throw error("the shared buffer does not belong to the OpenCL context of the engine", CLDNN_ERROR);
+    if (cl_buffer.getInfo<CL_MEM_SIZE>() < layout.bytes_count())
+        throw error("the shared buffer is smaller than the layout", CLDNN_ERROR);
+
+    return{ new gpu::gpu_buffer(this, layout, cl_buffer), false };
+}
+
+memory_impl::ptr engine_impl::allocate_host_memory(layout layout)
+{
+    if (layout.format.is_image() || get_context()->get_engine_info().host_unified_memory)
+        return allocate_memory(layout);
+
+    try {
+        memory_impl::ptr memory{ new gpu::gpu_buffer(this, layout, gpu::gpu_buffer::pinned_host_tag()), false };
+        get_memory_pool().add_memory_used(layout.bytes_count());
+        return memory;
+    }
+    catch (cl::Error const& err) {
+        throw gpu::ocl_error(err);
+    }
+}
+
+void engine_impl::copy_memory(memory_impl& src, memory_impl& dst, bool blocking)
+{
+    if (src.get_engine() != this || dst.get_engine() != this)
+        throw error("trying to copy memory allocated by a different engine", CLDNN_ERROR);
+    if (src.size() != dst.size() || src.get_layout().format.is_image() || dst.get_layout().format.is_image())
+        throw error("the copied memory has to be buffers of the same size", CLDNN_ERROR);
+
+    auto context = get_context();
+    auto& queue = context->queue();
+    try {
+        // the out of order queue orders the copy after the commands enqueued before and the commands enqueued
+        // after it (e.g. the kernels reading the input) after the copy
+        context->enqueue_barrier();
+        if (src.is_pinned_host() && dst.is_pinned_host())
+        {
+            mem_lock<char> from(src);
+            mem_lock<char> to(dst);
+            std::copy(from.begin(), from.end(), to.begin());
+        }
+        else if (src.is_pinned_host())
+        {
+            mem_lock<char> from(src);
+            queue.enqueueWriteBuffer(static_cast<gpu::gpu_buffer&>(dst).get_buffer(), blocking, 0, dst.size(),
+                                     from.begin());
+        }
+        else if (dst.is_pinned_host())
+        {
+            mem_lock<char> to(dst);
+            queue.enqueueReadBuffer(static_cast<gpu::gpu_buffer&>(src).get_buffer(), blocking, 0, src.size(),
+                                    to.begin());
+        }
+        else
+        {
+            cl::Event copied;
+            queue.enqueueCopyBuffer(static_cast<gpu::gpu_buffer&>(src).get_buffer(),
+                                    static_cast<gpu::gpu_buffer&>(dst).get_buffer(), 0, 0, src.size(), nullptr,
+                                    &copied);
+            if (blocking)
+                copied.wait();
+        }
+        context->enqueue_barrier();
+    }
+    catch (cl::Error const& err) {
+        throw gpu::ocl_error(err);
+    }
+}
+
 bool engine_impl::is_the_same_buffer(const memory_impl& mem1, const memory_impl& mem2)
 {
     if (mem1.get_engine() != this || mem2.get_engine() != this)
@@ -93,6 +189,29 @@ bool engine_impl::is_the_same_buffer(const memory_impl& mem1, const memory_impl&
     return (reinterpret_cast<const gpu::gpu_buffer&>(mem1).get_buffer() == reinterpret_cast<const gpu::gpu_buffer&>(mem2).get_buffer());
 }
 
+memory_impl::ptr engine_impl::get_cached_constant(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(_constants_mutex);
+    auto it = _constants.find(key);
+    if (it == _constants.end())
+        return nullptr;
+    return it->second;
+}
+
+void engine_impl::cache_constant(const std::string& key, memory_impl& memory)
+{
+    std::lock_guard<std::mutex> lock(_constants_mutex);
+    // drop the results no program refers to anymore, so the released networks free their weights
+    for (auto it = _constants.begin(); it != _constants.end();)
+    {
+        if (it->second->get_ref_count() == 1)
+            it = _constants.erase(it);
+        else
+            ++it;
+    }
+    _constants[key] = &memory;
+}
+
 event_impl::ptr engine_impl::create_user_event(bool set)
 {
     try {
@@ -0,0 +1,101 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "gemm_inst.h"
+#include "primitive_type_base.h"
+#include "error_handler.h"
+#include "json_object.h"
+
+#include <algorithm>
+
+namespace cldnn
+{
+primitive_type_id gemm_type_id()
+{
+    static primitive_type_base<gemm> instance;
+    return &instance;
+}
+
+
+layout gemm_inst::calc_output_layout(gemm_node const& node)
+{
+    auto desc = node.get_primitive();
+    auto input0_layout = node.input(0).get_output_layout();
+    auto input1_layout = node.input(1).get_output_layout();
+
+    //   input0{bfyx} = [b: batch, f: batch, y: M (K when transposed), x: K (M when transposed)]
+    //   input1{bfyx} = [b: batch, f: batch, y: K (N when transposed), x: N (K when transposed)]
+    //   output{bfyx} = [b: batch, f: batch, y: M,                      x: N]
+    auto rows = desc->transpose_input0 ? input0_layout.size.spatial[0] : input0_layout.size.spatial[1];
+    auto cols = desc->transpose_input1 ? input1_layout.size.spatial[1] : input1_layout.size.spatial[0];
+    auto batch = std::max(input0_layout.size.batch[0], input1_layout.size.batch[0]);
+    auto feature = std::max(input0_layout.size.feature[0], input1_layout.size.feature[0]);
+
+    return layout(input0_layout.data_type, format::bfyx, tensor(batch, feature, cols, rows));
+}
+
+std::string gemm_inst::to_string(gemm_node const& node)
+{
+    auto desc      = node.get_primitive();
+    auto node_info = node.desc_to_json();
+
+    std::stringstream primitive_description;
+
+    json_composite gemm_info;
+    gemm_info.add("alpha", desc->alpha);
+    gemm_info.add("beta", desc->beta);
+    gemm_info.add("transpose input0", desc->transpose_input0);
+    gemm_info.add("transpose input1", desc->transpose_input1);
+    gemm_info.add("with input2", node.inputs_count() > 2);
+    node_info.add("gemm info", gemm_info);
+    node_info.dump(primitive_description);
+
+    return primitive_description.str();
+}
+
+gemm_inst::typed_primitive_inst(network_impl& network, gemm_node const& node)
+    :parent(network, node)
+{
+    auto desc = node.get_primitive();
+    auto input0_size = node.input(0).get_output_layout().size;
+    auto input1_size = node.input(1).get_output_layout().size;
+    auto output_size = node.get_output_layout().size;
+
+    auto k0 = desc->transpose_input0 ? input0_size.spatial[1] : input0_size.spatial[0];
+    auto k1 = desc->transpose_input1 ? input1_size.spatial[0] : input1_size.spatial[1];
+    CLDNN_ERROR_NOT_EQUAL(node.id(), "input0 columns", k0, "input1 rows", k1, "The matrices of the inputs cannot be multiplied.");
+
+    // a batch dimension of the inputs is either the one of the output or broadcast
+    for (size_t i = 0; i < node.inputs_count(); i++)
+    {
+        auto input_size = node.input(i).get_output_layout().size;
+        CLDNN_ERROR_BOOL(node.id(), "input batch broadcast",
+            (input_size.batch[0] != 1 && input_size.batch[0] != output_size.batch[0]) ||
+            (input_size.feature[0] != 1 && input_size.feature[0] != output_size.feature[0]),
+            "The batch of the input is neither the batch of the output nor broadcast.");
+    }
+    if (node.inputs_count() > 2)
+    {
+        auto input2_size = node.input(2).get_output_layout().size;
+        CLDNN_ERROR_BOOL(node.id(), "input2 matrix broadcast",
+            (input2_size.spatial[1] != 1 && input2_size.spatial[1] != output_size.spatial[1]) ||
+            (input2_size.spatial[0] != 1 && input2_size.spatial[0] != output_size.spatial[0]),
+            "The matrix of input2 is neither the matrix of the output nor broadcast.");
+    }
+}
+}
@@ -30,6 +30,10 @@ namespace cldnn {
             , host_out_of_order(false)
             , log("")
             , ocl_sources_dumps_dir("")
+            , kernels_cache_path("")
+            , compilation_threads(0)
+            , user_context(nullptr)
+            , user_queue(nullptr)
         {}
     }
 }
@@ -90,6 +90,18 @@ static void add_layout_to_jit(kernel_selector::jit_constants& mem_consts, const
     // #define INPUT0_DIMS (uint[]) { b, f, y, x, }
     mem_consts.AddConstant(kernel_selector::MakeJitConstant(name + "_DIMS", l.size.sizes(format::bfyx)));
 
+    // The same sizes as the integer literals, so the loops bounded by them are unrolled by the compiler
+    // #define INPUT0_BATCH_NUM b
+    // #define INPUT0_FEATURE_NUM f
+    // #define INPUT0_SIZE_Y y
+    // #define INPUT0_SIZE_X x
+    mem_consts.AddConstants({
+        kernel_selector::MakeJitConstant(name + "_BATCH_NUM", l.size.batch[0]),
+        kernel_selector::MakeJitConstant(name + "_FEATURE_NUM", l.size.feature[0]),
+        kernel_selector::MakeJitConstant(name + "_SIZE_Y", l.size.spatial[1]),
+        kernel_selector::MakeJitConstant(name + "_SIZE_X", l.size.spatial[0]),
+    });
+
     // Data type
     // #define INPUT0_TYPE float 
     static const std::map<data_types, std::string> dataTypeToIndex{
@@ -20,6 +20,10 @@
 #include "network_impl.h"
 #include "implementation_map.h"
 #include "math_utils.h"
+#include "primitive_gpu_base.h"
+#include "kernel_selector_helper.h"
+#include "detection_output/detection_output_kernel_selector.h"
+#include "detection_output/detection_output_kernel_ref.h"
 
 #include <algorithm>
 #include <stdexcept>
@@ -56,6 +60,71 @@ namespace {
     };
 }
 
+namespace {
+    kernel_selector::DetectionOutputCodeType convert_code_type(prior_box_code_type code_type)
+    {
+        switch (code_type)
+        {
+        case prior_box_code_type::center_size: return kernel_selector::DetectionOutputCodeType::CENTER_SIZE;
+        case prior_box_code_type::corner_size: return kernel_selector::DetectionOutputCodeType::CORNER_SIZE;
+        case prior_box_code_type::corner:
+        default:                               return kernel_selector::DetectionOutputCodeType::CORNER;
+        }
+    }
+}
+
+// Runs the detection output in OpenCL kernels, so the network does not wait for the device before it
+struct detection_output_kernel_gpu : typed_primitive_gpu_impl<detection_output>
+{
+    using parent = typed_primitive_gpu_impl<detection_output>;
+    using parent::parent;
+
+    // Returns nullptr if the kernels do not support the arguments
+    static primitive_impl* create(const detection_output_node& arg)
+    {
+        const auto& prior_box_layout = arg.prior_box().get_output_layout();
+        if (prior_box_layout.data_padding || arg.get_output_layout().data_padding)
+        {
+            return nullptr;
+        }
+
+        auto do_params = get_default_params<kernel_selector::detection_output_params>(arg);
+        auto do_optional_params = get_default_optional_params<kernel_selector::detection_output_optional_params>(arg.get_program());
+
+        do_params.inputs.push_back(convert_data_tensor(arg.confidence().get_output_layout()));
+        do_params.inputs.push_back(convert_data_tensor(prior_box_layout));
+
+        const auto& primitive = arg.get_primitive();
+        do_params.num_classes = primitive->num_classes;
+        do_params.num_priors = prior_box_layout.size.spatial[1] / primitive->prior_info_size;
+        do_params.keep_top_k = primitive->keep_top_k;
+        do_params.top_k = primitive->top_k;
+        do_params.background_label_id = primitive->background_label_id;
+        do_params.share_location = primitive->share_location;
+        do_params.nms_threshold = primitive->nms_threshold;
+        do_params.eta = primitive->eta;
+        do_params.code_type = convert_code_type(primitive->code_type);
+        do_params.variance_encoded_in_target = primitive->variance_encoded_in_target;
+        do_params.confidence_threshold = primitive->confidence_threshold;
+        do_params.prior_info_size = primitive->prior_info_size;
+        do_params.prior_coordinates_offset = primitive->prior_coordinates_offset;
+        do_params.prior_is_normalized = primitive->prior_is_normalized;
+        do_params.input_width = primitive->input_width;
+        do_params.input_height = primitive->input_height;
+        do_params.decrease_label_id = primitive->decrease_label_id;
+        do_params.clip = primitive->clip;
+
+        auto& kernel_selector = kernel_selector::detection_output_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(do_params, do_optional_params);
+        if (best_kernels.empty())
+        {
+            return nullptr;
+        }
+
+        return new detection_output_kernel_gpu(arg, best_kernels[0]);
+    }
+};
+
 struct detection_output_gpu : typed_primitive_impl<detection_output>
 {
     const detection_output_node& outer;
@@ -621,6 +690,10 @@ struct detection_output_gpu : typed_primitive_impl<detection_output>
 
     static primitive_impl* create(const detection_output_node& arg)
     {
+        if (auto kernel_impl = detection_output_kernel_gpu::create(arg))
+        {
+            return kernel_impl;
+        }
         return new detection_output_gpu(arg);
     }
 };
@@ -78,6 +78,7 @@ struct engine_info_internal : cldnn::engine_info
     architectures architecture;
     std::string dev_id;
     std::string driver_version;
+    bool host_unified_memory;          ///< Does the device share the physical memory with the host (integrated GPU).
 private:
     friend class gpu_toolkit;
     explicit engine_info_internal(const gpu_toolkit& context);
@@ -85,6 +85,15 @@ public:
         return parent::execute_impl(tmp_events, instance);
     }
 
+    bool record(primitive_inst& instance, std::vector<std::function<event_impl::ptr()>>& enqueues) override
+    {
+        // the input reorder runs as a nested network
+        if (!_reorders.empty())
+            return false;
+
+        return parent::record(instance, enqueues);
+    }
+
     static primitive_impl* create(const fully_connected_node& arg)
     {
         auto fc_params = get_weights_bias_default_params<kernel_selector::fully_connected_params>(arg);
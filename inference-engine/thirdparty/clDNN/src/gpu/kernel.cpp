@@ -38,6 +38,29 @@ namespace {
         }
     }
 
+    bool same_arguments(const kernel::kernel_arguments_data& lhs, const kernel::kernel_arguments_data& rhs)
+    {
+        return lhs.inputs == rhs.inputs &&
+            lhs.intermediates == rhs.intermediates &&
+            lhs.output == rhs.output &&
+            lhs.weights == rhs.weights &&
+            lhs.recurrent == rhs.recurrent &&
+            lhs.hidden == rhs.hidden &&
+            lhs.cell == rhs.cell &&
+            lhs.bias == rhs.bias &&
+            lhs.lstm_packed == rhs.lstm_packed &&
+            lhs.weights_quantization_factors == rhs.weights_quantization_factors &&
+            lhs.output_calibration_factors == rhs.output_calibration_factors &&
+            lhs.lookup_table == rhs.lookup_table &&
+            lhs.scale_table == rhs.scale_table &&
+            lhs.slope == rhs.slope &&
+            lhs.prev_weights_grad == rhs.prev_weights_grad &&
+            lhs.prev_bias_grad == rhs.prev_bias_grad &&
+            lhs.split == rhs.split &&
+            lhs.lr == rhs.lr &&
+            lhs.scalars == rhs.scalars;
+    }
+
     void set_arguments(
         cl::Kernel& kernel,
         const kernel_selector::kernel_arguments& args,
@@ -223,12 +246,27 @@ event_impl::ptr kernel::run(
     const std::vector<event_impl::ptr>& dependencies,
     const kernel_arguments_data& args) const
 {
-    auto clkernel = context()->get_kernels_cache().get_kernel(_kernel_id, _one_time_kernel);
-    try {
-        set_arguments(clkernel, kernel_data.arguments, args);
-    }
-    catch (cl::Error const& err) {
-        throw ocl_error(err);
+    auto& cache = context()->get_kernels_cache();
+    auto clkernel = cache.get_kernel(_kernel_id, _one_time_kernel);
+
+    // the memory held by the last arguments cannot be released, so the same pointers mean the same buffers
+    const bool arguments_set = !_one_time_kernel && _last_args &&
+        cache.get_arguments_owner(_kernel_id) == this && same_arguments(*_last_args, args);
+    if (!arguments_set)
+    {
+        cache.set_arguments_owner(_kernel_id, nullptr);
+        try {
+            set_arguments(clkernel, kernel_data.arguments, args);
+        }
+        catch (cl::Error const& err) {
+            throw ocl_error(err);
+        }
+
+        if (!_one_time_kernel)
+        {
+            _last_args.reset(new kernel_arguments_data(args));
+            cache.set_arguments_owner(_kernel_id, this);
+        }
     }
 
     return context()->enqueue_kernel(clkernel, toNDRange(kernel_data.workGroups.global), toNDRange(kernel_data.workGroups.local), dependencies);
@@ -53,6 +53,7 @@ public:
 
         _kernel_id = other._kernel_id;
         _one_time_kernel = other._one_time_kernel;
+        _last_args.reset();
 
         return *this;
     }
@@ -76,7 +77,7 @@ public:
         memory_impl::cptr prev_weights_grad;
         memory_impl::cptr prev_bias_grad;
         int32_t           split          = 0;
-        float             lr;
+        float             lr             = 0.f;
         const kernel_selector::kernel_scalar_arguments* scalars = nullptr;
     };
 
@@ -86,6 +87,11 @@ public:
         const kernel_selector::cl_kernel_data& kernel_data,
         const std::vector<event_impl::ptr>& dependencies,
         const kernel_arguments_data& args) const;
+
+private:
+    // The arguments of the last run, the next runs with the same memory do not set them again
+    // while no other kernel of the same code set its own ones.
+    mutable std::unique_ptr<kernel_arguments_data> _last_args;
 };
 
 } }
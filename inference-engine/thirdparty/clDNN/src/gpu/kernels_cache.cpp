@@ -22,6 +22,15 @@
 #include <sstream>
 #include <fstream>
 #include <set>
+#include <iomanip>
+#include <iterator>
+#include <cstdio>
+#include <functional>
+#include <exception>
+#include <thread>
+#include <random>
+#include <chrono>
+#include <cstdint>
 
 #include "kernel_selector_helper.h"
 
@@ -110,6 +119,92 @@ namespace {
             options.find("-D") == std::string::npos &&
             options.find("-I") == std::string::npos;
     }
+
+    std::string get_program_cache_file(const std::string& cache_dir, const kernels_cache::source_code& sources,
+                                       const std::string& options, const cl::Device& device)
+    {
+        // the binary is valid only for exactly the same sources and build options on the same device and driver
+        std::string key = options + "\n" + device.getInfo<CL_DEVICE_NAME>() + "\n" +
+                          device.getInfo<CL_DEVICE_VERSION>() + "\n" + device.getInfo<CL_DRIVER_VERSION>() + "\n";
+        for (const auto& s : sources)
+            key += s;
+
+        std::stringstream file_name;
+        file_name << cache_dir;
+        if (cache_dir.back() != '/')
+            file_name << '/';
+        file_name << "clDNN_program_" << std::hex << std::setw(2 * sizeof(size_t)) << std::setfill('0')
+                  << std::hash<std::string>()(key) << "_" << std::dec << key.size() << ".bin";
+        return file_name.str();
+    }
+
+    // the header of the cache files: a file of another format, size or content is not loaded
+    struct program_binary_header
+    {
+        char magic[8];
+        uint64_t size;
+        uint64_t hash;
+    };
+    const char program_binary_magic[8] = { 'c', 'l', 'D', 'N', 'N', 'b', 'i', 'n' };
+
+    uint64_t hash_program_binary(const std::vector<unsigned char>& binary)
+    {
+        return std::hash<std::string>()(std::string(binary.begin(), binary.end()));
+    }
+
+    bool load_program_binary(const std::string& file_name, std::vector<unsigned char>& binary)
+    {
+        std::ifstream file(file_name, std::ios::binary);
+        if (!file)
+            return false;
+
+        program_binary_header header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            !std::equal(std::begin(program_binary_magic), std::end(program_binary_magic), header.magic) ||
+            header.size == 0)
+            return false;
+
+        binary.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        // a truncated or damaged file is rebuilt from the sources and replaced
+        return binary.size() == header.size && hash_program_binary(binary) == header.hash;
+    }
+
+    // the suffix of the temporary files, unique for the threads of all the processes writing to the cache
+    std::string get_unique_suffix()
+    {
+        std::random_device random;
+        std::stringstream suffix;
+        suffix << std::hex << std::hash<std::thread::id>()(std::this_thread::get_id()) << "_"
+               << std::chrono::steady_clock::now().time_since_epoch().count() << "_" << random();
+        return suffix.str();
+    }
+
+    void save_program_binary(const std::string& file_name, const std::vector<unsigned char>& binary)
+    {
+        // the binary is written to a temporary file of the writer first and renamed, so the readers never open a
+        // partially written file and the writers of the same program do not write to the same file
+        const std::string tmp_file_name = file_name + "." + get_unique_suffix() + ".tmp";
+        {
+            std::ofstream file(tmp_file_name, std::ios::binary);
+            if (!file)
+                return; // caching is optional, the program is already built
+            program_binary_header header;
+            std::copy(std::begin(program_binary_magic), std::end(program_binary_magic), header.magic);
+            header.size = binary.size();
+            header.hash = hash_program_binary(binary);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+            if (!file)
+            {
+                file.close();
+                std::remove(tmp_file_name.c_str());
+                return;
+            }
+        }
+        // the rename fails where it does not replace the files (the file written by another writer is kept)
+        if (std::rename(tmp_file_name.c_str(), file_name.c_str()) != 0)
+            std::remove(tmp_file_name.c_str());
+    }
 }
 
 kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code& kernels_source_code) const 
@@ -214,92 +309,109 @@ kernels_cache::kernel_id kernels_cache::set_kernel_source(const std::shared_ptr<
     return id;
 }
 
-kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source) const
-{
-    static uint32_t current_file_index = 0;
+namespace {
+    struct program_part
+    {
+        const kernels_cache::program_code* program;
+        size_t index;
+        std::string dump_file_name;
 
-    bool dump_sources = !_context.get_configuration().ocl_sources_dumps_dir.empty() || program_source.dump_custom_program;
+        kernels_cache::kernels_map kernels;
+        kernels_binaries_vector binaries;
+        std::string err_log; //build log of the part, only filled when it failed to compile
+        std::exception_ptr error;
+    };
 
-    std::string dump_file_name = "";
-    if (dump_sources)
+    void build_program_part(const gpu_toolkit& context, program_part& part)
     {
-        dump_file_name = _context.get_configuration().ocl_sources_dumps_dir;
-        if (!dump_file_name.empty() && dump_file_name.back() != '/')
-            dump_file_name += '/';
+        const auto& program_source = *part.program;
+        const auto& sources = program_source.source[part.index];
 
-        dump_file_name += "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
-    }
+        const std::string& cache_dir = context.get_configuration().kernels_cache_path;
+        const bool use_cache = !cache_dir.empty();
+        const bool dump_sources = !part.dump_file_name.empty();
 
-    try
-    {
-        kernels_map kmap;
-        std::string err_log; //accumulated build log from all program's parts (only contains messages from parts which failed to compile)
+        boost::optional<std::ofstream> dump_file;
+        if (dump_sources)
+        {
+            dump_file.emplace(part.dump_file_name);
+            for (auto& s : sources)
+                dump_file.get() << s;
+        }
 
-        uint32_t part_idx = 0;
-        for (const auto& sources : program_source.source)
+        try
         {
-            auto current_dump_file_name = dump_file_name + std::to_string(part_idx++) + ".cl";
-            boost::optional<std::ofstream> dump_file;
+            cl::Program program;
+            bool loaded_from_cache = false;
+            std::string cache_file_name;
 
-            if (dump_sources)
+            if (use_cache)
             {
-                dump_file.emplace(current_dump_file_name);
-                for (auto& s : sources)
-                    dump_file.get() << s;
+                cache_file_name = get_program_cache_file(cache_dir, sources, program_source.options, context.device());
+                std::vector<unsigned char> binary;
+                if (load_program_binary(cache_file_name, binary))
+                {
+                    try
+                    {
+                        program = cl::Program(context.context(), { context.device() }, cl::Program::Binaries{ binary });
+                        program.build({ context.device() }, program_source.options.c_str());
+                        loaded_from_cache = true;
+                    }
+                    catch (const cl::Error&)
+                    {
+                        // the cached binary is rejected by the driver, so it is rebuilt from the sources and replaced
+                    }
+                }
             }
 
-            try
+            if (!loaded_from_cache)
             {
-                cl::Program program(_context.context(), sources);
-                program.build({ _context.device() }, program_source.options.c_str());
-                ///Store kernels for serialization process.
-                _context.store_binaries(program.getInfo<CL_PROGRAM_BINARIES>());
-
-                if (dump_sources)
-                {
-                    dump_file.get() << "\n/* Build Log:\n";
-                    for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
-                        dump_file.get() << p.second << "\n";
+                program = cl::Program(context.context(), sources);
+                program.build({ context.device() }, program_source.options.c_str());
+            }
 
-                    dump_file.get() << "*/\n";
-                }
+            part.binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+            if (use_cache && !loaded_from_cache && part.binaries.size() == 1)
+                save_program_binary(cache_file_name, part.binaries[0]);
 
-                cl::vector<cl::Kernel> kernels;
-                program.createKernels(&kernels);
+            if (dump_sources)
+            {
+                dump_file.get() << "\n/* Build Log:\n";
+                for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
+                    dump_file.get() << p.second << "\n";
 
-                for (auto& k : kernels)
-                {
-                    auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
-                    kmap.emplace(kernel_name, k);
-                }
+                dump_file.get() << "*/\n";
             }
-            catch (const cl::BuildError& err)
-            {
-                if (dump_sources)
-                    dump_file.get() << "\n/* Build Log:\n";
 
-                for (auto& p : err.getBuildLog())
-                {
-                    if (dump_sources)
-                        dump_file.get() << p.second << "\n";
-                
-                    err_log += p.second + '\n';
-                }
+            cl::vector<cl::Kernel> kernels;
+            program.createKernels(&kernels);
 
-                if (dump_sources)
-                    dump_file.get() << "*/\n";
+            for (auto& k : kernels)
+            {
+                auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
+                part.kernels.emplace(kernel_name, k);
             }
-            
         }
+        catch (const cl::BuildError& err)
+        {
+            if (dump_sources)
+                dump_file.get() << "\n/* Build Log:\n";
 
-        if (!err_log.empty())
-            throw std::runtime_error("Program build failed:\n" + std::move(err_log));
+            for (auto& p : err.getBuildLog())
+            {
+                if (dump_sources)
+                    dump_file.get() << p.second << "\n";
 
-        return kmap;
-    }
-    catch (const cl::Error& err)
-    {
-        throw ocl_error(err);
+                part.err_log += p.second + '\n';
+            }
+
+            if (dump_sources)
+                dump_file.get() << "*/\n";
+        }
+        catch (...)
+        {
+            part.error = std::current_exception();
+        }
     }
 }
 
@@ -316,6 +428,21 @@ kernels_cache::kernel_type kernels_cache::get_kernel(kernel_id id, bool one_time
     }
 }
 
+std::string kernels_cache::get_dump_file_name(const program_code& program_source) const
+{
+    static uint32_t current_file_index = 0;
+
+    bool dump_sources = !_context.get_configuration().ocl_sources_dumps_dir.empty() || program_source.dump_custom_program;
+    if (!dump_sources)
+        return std::string();
+
+    std::string dump_file_name = _context.get_configuration().ocl_sources_dumps_dir;
+    if (!dump_file_name.empty() && dump_file_name.back() != '/')
+        dump_file_name += '/';
+
+    return dump_file_name + "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
+}
+
 void kernels_cache::build_all()
 {
     if (!_pending_compilation)
@@ -325,24 +452,87 @@ void kernels_cache::build_all()
 
     auto sorted_program_code = get_program_source(_kernels_code);
 
-    _one_time_kernels.clear();
+    // every part of every program is compiled by a separate clBuildProgram, so the parts are built in parallel
+    std::vector<program_part> parts;
     for (auto& program : sorted_program_code)
     {
-        auto kernels = build_program(program.second);
+        auto dump_file_name = get_dump_file_name(program.second);
+        for (size_t i = 0; i < program.second.source.size(); i++)
+        {
+            program_part part;
+            part.program = &program.second;
+            part.index = i;
+            if (!dump_file_name.empty())
+                part.dump_file_name = dump_file_name + std::to_string(i) + ".cl";
+            parts.push_back(std::move(part));
+        }
+    }
+
+    size_t threads_count = _context.get_configuration().compilation_threads;
+    if (threads_count == 0)
+        threads_count = std::max(1u, std::thread::hardware_concurrency());
+    threads_count = std::min(threads_count, parts.size());
+
+    std::atomic<size_t> next_part{ 0 };
+    auto build_parts = [&]()
+    {
+        for (size_t i = next_part++; i < parts.size(); i = next_part++)
+            build_program_part(_context, parts[i]);
+    };
+
+    if (threads_count > 1)
+    {
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < threads_count; t++)
+            threads.emplace_back(build_parts);
+        build_parts();
+        for (auto& t : threads)
+            t.join();
+    }
+    else
+    {
+        build_parts();
+    }
 
-        for (auto& k : kernels)
+    // the results are collected in the order of the parts, so the stored binaries do not depend on the timing
+    try
+    {
+        std::string err_log; //accumulated build log from all program's parts (only contains messages from parts which failed to compile)
+        _one_time_kernels.clear();
+        for (auto& part : parts)
         {
-            const auto& entry_point = k.first;
-            const auto& k_id = program.second.entry_point_to_id[entry_point];
-            if (program.second.one_time)
-            {
-                _one_time_kernels[k_id] = k.second;
-            }
-            else
+            if (part.error)
+                std::rethrow_exception(part.error);
+            err_log += part.err_log;
+            if (!part.err_log.empty())
+                continue;
+
+            ///Store kernels for serialization process.
+            _context.store_binaries(part.binaries);
+
+            for (auto& k : part.kernels)
             {
-                _kernels[k_id] = k.second;
+                const auto id = part.program->entry_point_to_id.find(k.first);
+                if (id == part.program->entry_point_to_id.end())
+                    continue;
+                const auto& k_id = id->second;
+                if (part.program->one_time)
+                {
+                    _one_time_kernels[k_id] = k.second;
+                }
+                else
+                {
+                    _kernels[k_id] = k.second;
+                }
             }
         }
+
+        if (!err_log.empty())
+            throw std::runtime_error("Program build failed:\n" + std::move(err_log));
+    }
+    catch (const cl::Error& err)
+    {
+        throw ocl_error(err);
     }
 
     _kernels_code.clear();
@@ -77,16 +77,24 @@ private:
     std::atomic<bool> _pending_compilation{ false };
     std::map<std::string, kernel_type> _kernels;
     std::map<std::string, kernel_type> _one_time_kernels; // These kernels are intended to be executed only once (can be removed later from the cache).
+    std::map<std::string, const void*> _arguments_owners; // The kernels of the same code share the cl::Kernel and its arguments.
 
     sorted_code get_program_source(const kernels_code& kernels_source_code) const;
     friend class gpu_toolkit;
     explicit kernels_cache(gpu_toolkit& context);
-    kernels_map build_program(const program_code& pcode) const;
+    std::string get_dump_file_name(const program_code& pcode) const;
 
 public:
     kernel_id set_kernel_source(const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program, bool one_time_kernel);
     kernel_type get_kernel(kernel_id id, bool one_time_kernel);
     gpu_toolkit& get_context() { return _context; }
+    //the object which set the current arguments of the kernel, the arguments are kept until another one sets its own
+    const void* get_arguments_owner(const kernel_id& id) const
+    {
+        auto it = _arguments_owners.find(id);
+        return it == _arguments_owners.end() ? nullptr : it->second;
+    }
+    void set_arguments_owner(const kernel_id& id, const void* owner) { _arguments_owners[id] = owner; }
     //forces compilation of all pending kernels/programs
     void build_all();
 };
@@ -50,6 +50,12 @@ public:
         return parent::execute_impl(tmp_events, instance);
     }
 
+    bool record(primitive_inst&, std::vector<std::function<event_impl::ptr()>>&) override
+    {
+        // the output is cleared on the host before the kernel
+        return false;
+    }
+
     static primitive_impl* create(const max_unpooling_node& arg)
     {
         auto max_unpooling_params = get_default_params<kernel_selector::max_unpooling_params>(arg);
@@ -21,11 +21,20 @@
 
 namespace cldnn { namespace gpu {
 
+namespace {
+// the buffers of the device sharing the physical memory with the host are allocated in the host accessible memory,
+// so mapping them doesn't copy the data
+cl_mem_flags buffer_flags(const gpu_toolkit& context)
+{
+    return CL_MEM_READ_WRITE | (context.get_engine_info().host_unified_memory ? CL_MEM_ALLOC_HOST_PTR : 0);
+}
+}
+
 gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout)
     : memory_impl(engine, layout)
     , _context(engine->get_context())
     , _lock_count(0)
-    , _buffer(_context->context(), CL_MEM_READ_WRITE, size())
+    , _buffer(_context->context(), buffer_flags(*_context), size())
     , _mapped_ptr(nullptr)
 {
     void* ptr = gpu_buffer::lock();
@@ -43,6 +52,37 @@ gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layo
 
 }
 
+gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, void* host_ptr)
+    : memory_impl(engine, new_layout)
+    , _context(engine->get_context())
+    , _lock_count(0)
+    , _buffer(_context->context(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, size(), host_ptr)
+    , _mapped_ptr(nullptr)
+{
+
+}
+
+gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, pinned_host_tag)
+    : memory_impl(engine, new_layout)
+    , _context(engine->get_context())
+    , _lock_count(0)
+    , _buffer(_context->context(), CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, size())
+    , _mapped_ptr(nullptr)
+    , _pinned_host(true)
+{
+    // the lock is never released
+    gpu_buffer::lock();
+}
+
+gpu_buffer::~gpu_buffer() {
+    if (_pinned_host && _mapped_ptr) {
+        try {
+            _context->queue().enqueueUnmapMemObject(_buffer, _mapped_ptr);
+        }
+        catch (...) {}
+    }
+}
+
 void* gpu_buffer::lock() {
     std::lock_guard<std::mutex> locker(_mutex);
     if (0 == _lock_count) {
@@ -62,9 +62,17 @@ struct gpu_buffer : public memory_impl {
     friend cldnn::memory_pool;
 
     gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const cl::Buffer& buffer);
+    // uses the host memory as the storage of the buffer (CL_MEM_USE_HOST_PTR), the memory is not initialized
+    gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, void* host_ptr);
+    // the host memory pinned for the transfers (CL_MEM_ALLOC_HOST_PTR), mapped until the buffer is destroyed, so the
+    // transfers read and write the mapped memory (see engine_impl::copy_memory)
+    struct pinned_host_tag {};
+    gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, pinned_host_tag);
+    ~gpu_buffer();
     void* lock() override;
     void unlock() override;
     void fill(unsigned char pattern, event_impl::ptr ev) override;
+    bool is_pinned_host() const override { return _pinned_host; }
     const cl::Buffer& get_buffer() const {
         assert(0 == _lock_count);
         return _buffer;
@@ -78,6 +86,7 @@ private:
     unsigned _lock_count;
     cl::Buffer _buffer;
     void* _mapped_ptr;
+    bool _pinned_host = false;
 };
 
 struct gpu_image2d : public memory_impl {
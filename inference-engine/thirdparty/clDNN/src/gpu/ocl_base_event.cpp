@@ -48,6 +48,12 @@ void base_event::wait_impl()
             get_context()->log(0, "Wait for event: " + std::to_string(_queue_stamp));
         }
     }
+    else if (!get_context()->get_configuration().host_out_of_order)
+    {
+        // the in-order queue does not create the events of the kernels nobody waits on,
+        // such a kernel completed once all the commands enqueued so far did
+        get_context()->queue().finish();
+    }
 }
 
 bool base_event::is_set_impl()
@@ -56,6 +62,10 @@ bool base_event::is_set_impl()
     {
         return _event.getInfo<CL_EVENT_COMMAND_EXECUTION_STATUS>() == CL_COMPLETE;
     }
+    if (!get_context()->get_configuration().host_out_of_order)
+    {
+        wait_impl();
+    }
     return true;
 }
 
@@ -117,6 +117,29 @@ namespace {
 
 cl::Device get_gpu_device(const configuration& config, cl_platform_id& platform_id)
 {
+    if (config.user_context)
+    {
+        // the engine runs on the device of the queue or on the first device of the context created by user
+        cl::Context context(config.user_context, true);
+        auto devices = context.getInfo<CL_CONTEXT_DEVICES>();
+        if (devices.empty())
+            throw std::invalid_argument("The OpenCL context passed to the engine has no devices");
+
+        cl::Device device = devices[0];
+        if (config.user_queue)
+        {
+            cl::CommandQueue queue(config.user_queue, true);
+            if (queue.getInfo<CL_QUEUE_CONTEXT>()() != config.user_context)
+                throw std::invalid_argument("The OpenCL queue passed to the engine does not belong to its context");
+            device = queue.getInfo<CL_QUEUE_DEVICE>();
+        }
+
+        platform_id = device.getInfo<CL_DEVICE_PLATFORM>();
+        return device;
+    }
+    if (config.user_queue)
+        throw std::invalid_argument("The OpenCL queue is passed to the engine without its context");
+
     std::list<std::string> reasons;
     cl_uint n = 0;
 
@@ -173,7 +196,7 @@ gpu_toolkit::gpu_toolkit(const configuration& config)
     : _configuration(config)
     , _device(get_gpu_device(config, _platform_id))
     , _neo_driver(strstr(get_device_version().c_str(), "NEO") ? true : false)
-    , _context(_device)
+    , _context(config.user_context ? cl::Context(config.user_context, true) : cl::Context(_device))
     , _command_queue(_context,
                      _device,
                      (config.enable_profiling
@@ -196,7 +219,15 @@ gpu_toolkit::gpu_toolkit(const configuration& config)
                 CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE :
                 0);
 
-    if (_configuration.priority_mode != cldnn_priority_disabled)
+    if (_configuration.user_queue)
+    {
+        // the kernels are ordered with the commands of the user, so the queue is taken as it is
+        _command_queue = cl::CommandQueue(_configuration.user_queue, true);
+        auto user_properties = _command_queue.getInfo<CL_QUEUE_PROPERTIES>();
+        _configuration.enable_profiling = (user_properties & CL_QUEUE_PROFILING_ENABLE) != 0;
+        _configuration.host_out_of_order = (user_properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) != 0;
+    }
+    else if (_configuration.priority_mode != cldnn_priority_disabled)
     {
         if (extension_supported("cl_khr_priority_hints") &&
             extension_supported("cl_intelx_create_command_queue"))
@@ -287,6 +318,10 @@ gpu_toolkit::gpu_toolkit(const configuration& config)
             << "    out-of-order: "        << std::boolalpha << _configuration.host_out_of_order << "\n"
             << "    engine log: "          << _configuration.log << "\n"
             << "    sources dumps: "       << _configuration.ocl_sources_dumps_dir << "\n"
+            << "    kernels cache: "       << _configuration.kernels_cache_path << "\n"
+            << "    compilation threads: " << _configuration.compilation_threads << "\n"
+            << "    user context: "        << std::boolalpha << (_configuration.user_context != nullptr) << "\n"
+            << "    user queue: "          << std::boolalpha << (_configuration.user_queue != nullptr) << "\n"
             << "\nEngine info:\n"
             << "    configuration: "       << std::to_string(_engine_info.configuration) << "\n"
             << "    model: "               << std::to_string(_engine_info.model) << "\n"
@@ -310,7 +345,8 @@ event_impl::ptr gpu_toolkit::enqueue_kernel(cl::Kernel const& kern, cl::NDRange
     {
         for (auto& dep : deps)
             if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
-                dep_events.push_back(ocl_ev->get());
+                if (ocl_ev->get().get() != nullptr)
+                    dep_events.push_back(ocl_ev->get());
     }
     else
     {
@@ -320,7 +356,8 @@ event_impl::ptr gpu_toolkit::enqueue_kernel(cl::Kernel const& kern, cl::NDRange
 
     cl::Event ret_ev;
     try {
-        if (!_configuration.host_out_of_order || _output_event || _configuration.enable_profiling)
+        // the kernels of the in-order queue complete in the enqueue order, so only the events somebody waits on are created
+        if (_output_event || _configuration.enable_profiling)
         {
             _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
         }
@@ -360,10 +397,11 @@ event_impl::ptr gpu_toolkit::enqueue_marker(std::vector<event_impl::ptr> const&
             std::vector<cl::Event> dep_events;
             for (auto& dep : deps)
                 if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
-                    dep_events.push_back(ocl_ev->get());
+                    if (ocl_ev->get().get() != nullptr)
+                        dep_events.push_back(ocl_ev->get());
 
             try {
-                _command_queue.enqueueMarkerWithWaitList(&dep_events, &ret_ev);
+                _command_queue.enqueueMarkerWithWaitList(dep_events.empty() ? nullptr : &dep_events, &ret_ev);
             } 
             catch (cl::Error const& err) {
                 throw ocl_error(err);
@@ -391,6 +429,23 @@ event_impl::ptr gpu_toolkit::enqueue_marker(std::vector<event_impl::ptr> const&
     }
 }
 
+event_impl::ptr gpu_toolkit::enqueue_completion_marker()
+{
+    // the marker without the wait list waits for all the previous commands of both the in-order and the out-of-order queue
+    cl::Event ret_ev;
+    try {
+        _command_queue.enqueueMarkerWithWaitList(nullptr, &ret_ev);
+    }
+    catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    if (logging_enabled())
+        log(_queue_counter + 1, "Completion marker");
+
+    return{ new base_event(shared_from_this(), ret_ev, ++_queue_counter), false };
+}
+
 void gpu_toolkit::flush()
 {
     if (logging_enabled())
@@ -424,12 +479,21 @@ void gpu_toolkit::wait_for_events(std::vector<event_impl::ptr> const & events)
         log(0, "Wait for events: " + events_list_to_string(events));
 
     std::vector<cl::Event> clevents;
+    bool skipped_events = false;
     for (auto& ev : events)
         if (auto ocl_ev = dynamic_cast<base_event*>(ev.get()))
-            clevents.push_back(ocl_ev->get());
+        {
+            if (ocl_ev->get().get() != nullptr)
+                clevents.push_back(ocl_ev->get());
+            else
+                skipped_events = true;
+        }
 
     try {
-        cl::WaitForEvents(clevents);
+        if (skipped_events && !_configuration.host_out_of_order)
+            _command_queue.finish();
+        if (!clevents.empty())
+            cl::WaitForEvents(clevents);
     }
     catch (cl::Error const& err) {
         throw ocl_error(err);
@@ -460,26 +524,32 @@ void gpu_toolkit::sync_events(std::vector<event_impl::ptr> const & deps)
     }
 
     if (needs_barrier)
-    {
-        try {
-            if (_output_event)
-            { 
-                _command_queue.enqueueBarrierWithWaitList(nullptr, &_last_barrier_ev);
-            }
-            else
-            {
-                _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
-            }
-            
+        enqueue_barrier();
+}
+
+void gpu_toolkit::enqueue_barrier()
+{
+    if (!_configuration.host_out_of_order)
+        return;
+
+    try {
+        if (_output_event)
+        { 
+            _command_queue.enqueueBarrierWithWaitList(nullptr, &_last_barrier_ev);
         }
-        catch (cl::Error const& err) {
-            throw ocl_error(err);
+        else
+        {
+            _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
         }
-
-        _last_barrier = ++_queue_counter;
-        if (logging_enabled())
-            log(_last_barrier, "Barrier");
+        
     }
+    catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    _last_barrier = ++_queue_counter;
+    if (logging_enabled())
+        log(_last_barrier, "Barrier");
 }
 
 std::ofstream& gpu_toolkit::open_log()
@@ -67,6 +67,10 @@ struct configuration
     bool host_out_of_order;
     std::string log;
     std::string ocl_sources_dumps_dir;
+    std::string kernels_cache_path;
+    uint32_t compilation_threads;
+    cl_context user_context;
+    cl_command_queue user_queue;
     cldnn_priority_mode_type priority_mode;
     cldnn_throttle_mode_type throttle_mode;
 };
@@ -141,6 +145,10 @@ public:
 
     event_impl::ptr enqueue_kernel(cl::Kernel const& kern, cl::NDRange const& global, cl::NDRange const& local, std::vector<event_impl::ptr> const& deps);
     event_impl::ptr enqueue_marker(std::vector<event_impl::ptr> const& deps);
+    // the marker completing after all the commands enqueued before it
+    event_impl::ptr enqueue_completion_marker();
+    // the commands enqueued after the barrier wait for the ones enqueued before it, nothing to do in the in-order queue
+    void enqueue_barrier();
     void flush();
     void release_pending_memory();
     void wait_for_events(std::vector<event_impl::ptr> const& events);
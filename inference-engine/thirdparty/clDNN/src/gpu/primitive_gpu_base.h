@@ -41,6 +41,8 @@ struct typed_primitive_gpu_impl : public typed_primitive_impl<PType>
     kernel_selector::kernel_data _kernel_data;
     std::vector<gpu::kernel> _kernels;
     std::vector<memory_impl::cptr> _intermediates_memory;
+    // the kernel data of the last smaller network batch, see batch_kernel_data
+    std::vector<kernel_selector::cl_kernel_data> _batch_kernels;
 
     typed_primitive_gpu_impl(const typed_program_node<PType>& arg, const kernel_selector::kernel_data& kd)
         : typed_primitive_impl<PType>(kd.weightsReorderParams, kd.kernelName)
@@ -99,6 +101,44 @@ protected:
         return 1;
     }
 
+    // the kernel data of the network batch: the global size of the batch dimension scaled down from the built batch
+    const kernel_selector::cl_kernel_data& batch_kernel_data(size_t kernel_idx, uint32_t batch)
+    {
+        const auto& kernel_data = _kernel_data.kernels[kernel_idx];
+        const auto& runtime_batch = kernel_data.runtimeBatch;
+        if (runtime_batch.dim < 0 || batch == 0 || batch >= runtime_batch.batch)
+        {
+            return kernel_data;
+        }
+
+        if (_batch_kernels.empty())
+        {
+            _batch_kernels = _kernel_data.kernels;
+        }
+
+        auto& global = _batch_kernels[kernel_idx].workGroups.global;
+        global[runtime_batch.dim] = kernel_data.workGroups.global[runtime_batch.dim] / runtime_batch.batch * batch;
+        return _batch_kernels[kernel_idx];
+    }
+
+    bool supports_runtime_batch(uint32_t max_batch) const override
+    {
+        // the optimized out primitives run no kernels
+        if (_outer.can_be_optimized())
+        {
+            return true;
+        }
+
+        for (const auto& kernel_data : _kernel_data.kernels)
+        {
+            if (kernel_data.runtimeBatch.dim < 0 || kernel_data.runtimeBatch.batch != max_batch)
+            {
+                return false;
+            }
+        }
+        return !_kernel_data.kernels.empty();
+    }
+
     event_impl::ptr aggregate_events(const std::vector<event_impl::ptr>& events) const
     {
         if (events.size() == 1)
@@ -107,6 +147,34 @@ protected:
         return events_waiter(_outer.get_program().get_engine().get_context()).run(events);
     }
 
+    // the primitives executed on the host wait on the events of their inputs
+    bool needs_output_event(typed_primitive_inst<PType>& instance) const
+    {
+        for (const auto& user : instance.node.get_users())
+        {
+            if (user->type() == detection_output::type_id() ||
+                user->type() == prior_box::type_id() ||
+                user->type() == proposal::type_id())
+            {
+                return true;
+            }
+        }
+        return instance.node.is_output();
+    }
+
+    kernel::kernel_arguments_data get_kernel_arguments(typed_primitive_inst<PType>& instance, size_t kernel_idx, int32_t split_idx) const
+    {
+        auto args = get_arguments(instance, split_idx);
+        args.scalars = &_kernel_data.kernels[kernel_idx].scalars;
+        args.split = split_idx;
+
+        for (const auto& m : _intermediates_memory)
+        {
+            args.intermediates.push_back(m);
+        }
+        return args;
+    }
+
     virtual event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, typed_primitive_inst<PType>& instance) override
     {
         const bool validated = validate(instance);
@@ -121,6 +189,8 @@ protected:
 
         // TODO - split should be handle in kernel selector by providing multiple kernels.
         auto split = get_split();
+        const bool output_event = needs_output_event(instance);
+        const auto batch = instance.get_network().get_batch();
 
         // we iterate over split first in order to be able parallelism with OOOQ mechanism.
         for (size_t k = 0; k < _kernels.size(); ++k)
@@ -128,38 +198,10 @@ protected:
             std::vector<event_impl::ptr> new_events;
             for (decltype(split) i = 0; i < split; i++)
             {
-                auto args = get_arguments(instance, i);
-                args.scalars = &_kernel_data.kernels[k].scalars;
-                args.split = i;
+                auto args = get_kernel_arguments(instance, k, i);
+                _kernels[k].set_output_event(output_event);
 
-                for (const auto& m : _intermediates_memory)
-                {
-                    args.intermediates.push_back(m);
-                }
-
-                //is any user of the prim's users is an detecion output, set prim as a output event (event won't be nullptr)
-                auto users = instance.node.get_users();
-                bool next_prim_is_cpu = false;
-                for (const auto& user : users)
-                {
-                    if (user->type() == detection_output::type_id() ||
-                        user->type() == prior_box::type_id() ||
-                        user->type() == proposal::type_id())
-                    {
-                        next_prim_is_cpu = true;
-                        break;
-                    }
-                }
-                if (next_prim_is_cpu)
-                {
-                    _kernels[k].set_output_event(true);
-                }
-                else
-                {
-                    _kernels[k].set_output_event(instance.node.is_output());
-                }
-    
-                auto event = _kernels[k].run(_kernel_data.kernels[k], tmp_events, args);
+                auto event = _kernels[k].run(batch_kernel_data(k, batch), tmp_events, args);
                 new_events.push_back(event);
             }
 
@@ -168,6 +210,34 @@ protected:
 
         return aggregate_events(tmp_events);
     }
+
+    bool record(primitive_inst& instance, std::vector<std::function<event_impl::ptr()>>& enqueues) override
+    {
+        auto& typed_instance = reinterpret_cast<typed_primitive_inst<PType>&>(instance);
+        if (optimized_out(typed_instance))
+        {
+            return true;
+        }
+
+        auto split = get_split();
+        const bool output_event = needs_output_event(typed_instance);
+        const auto batch = instance.get_network().get_batch();
+        for (size_t k = 0; k < _kernels.size(); ++k)
+        {
+            // the network records again when its batch changes
+            const auto* kernel_data = &batch_kernel_data(k, batch);
+            for (decltype(split) i = 0; i < split; i++)
+            {
+                auto args = get_kernel_arguments(typed_instance, k, i);
+                enqueues.push_back([this, k, kernel_data, args, output_event]()
+                {
+                    _kernels[k].set_output_event(output_event);
+                    return _kernels[k].run(*kernel_data, {}, args);
+                });
+            }
+        }
+        return true;
+    }
 };
 
 } }
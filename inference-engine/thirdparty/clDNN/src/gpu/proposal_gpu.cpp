@@ -22,6 +22,10 @@
 #include "engine_impl.h"
 #include "math_utils.h"
 #include "error_handler.h"
+#include "primitive_gpu_base.h"
+#include "kernel_selector_helper.h"
+#include "proposal/proposal_kernel_selector.h"
+#include "proposal/proposal_kernel_ref.h"
 
 #include <algorithm>
 #include <string>
@@ -186,6 +190,50 @@ namespace {
 *                                                                          *
 ****************************************************************************/
 
+// Runs the proposal in OpenCL kernels, so the network does not wait for the device before it
+struct proposal_kernel_gpu : typed_primitive_gpu_impl<proposal>
+{
+    using parent = typed_primitive_gpu_impl<proposal>;
+    using parent::parent;
+
+    // Returns nullptr if the kernels do not support the arguments
+    static primitive_impl* create(const proposal_node& arg)
+    {
+        if (arg.get_output_layout().data_padding)
+        {
+            return nullptr;
+        }
+
+        auto proposal_params = get_default_params<kernel_selector::proposal_params>(arg);
+        auto proposal_optional_params = get_default_optional_params<kernel_selector::proposal_optional_params>(arg.get_program());
+
+        const auto& image_info_layout = arg.image_info().get_output_layout();
+        proposal_params.inputs.push_back(convert_data_tensor(arg.bbox_pred().get_output_layout()));
+        proposal_params.inputs.push_back(convert_data_tensor(image_info_layout));
+
+        const auto& primitive = arg.get_primitive();
+        for (const auto& anchor : proposal_inst::calculate_anchors(arg))
+        {
+            proposal_params.anchors.insert(proposal_params.anchors.end(), { anchor.start_x, anchor.start_y, anchor.end_x, anchor.end_y });
+        }
+        proposal_params.feature_stride = primitive->feature_stride;
+        proposal_params.min_bbox_size = primitive->min_bbox_size;
+        proposal_params.pre_nms_topn = primitive->pre_nms_topn;
+        proposal_params.post_nms_topn = primitive->post_nms_topn;
+        proposal_params.iou_threshold = primitive->iou_threshold;
+        proposal_params.image_info_size = (uint32_t)image_info_layout.size.count();
+
+        auto& kernel_selector = kernel_selector::proposal_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(proposal_params, proposal_optional_params);
+        if (best_kernels.empty())
+        {
+            return nullptr;
+        }
+
+        return new proposal_kernel_gpu(arg, best_kernels[0]);
+    }
+};
+
 struct proposal_gpu : typed_primitive_impl<proposal>
 {
     const proposal_node& outer;
@@ -350,6 +398,10 @@ struct proposal_gpu : typed_primitive_impl<proposal>
         CLDNN_ERROR_BOOL(arg.id(), "Batching", !hasSingleBatchOutput(arg.bbox_pred()), "Proposal doesn't support batching.");
         CLDNN_ERROR_BOOL(arg.id(), "Batching", !hasSingleBatchOutput(arg.cls_score()), "Proposal doesn't support batching.");
 
+        if (auto kernel_impl = proposal_kernel_gpu::create(arg))
+        {
+            return kernel_impl;
+        }
         return new proposal_gpu(arg);
     }
 };
@@ -36,6 +36,18 @@ public:
         return events_waiter.run(events);
     }
 
+    bool record(primitive_inst&, std::vector<std::function<event_impl::ptr()>>&) override
+    {
+        // the replay does not wait on any events
+        return true;
+    }
+
+    bool supports_runtime_batch(uint32_t) const override
+    {
+        // the data and the prior boxes do not depend on the batch, the inputs are attached by the user
+        return true;
+    }
+
     static primitive_impl* create_data(const data_node& data)
     {
         return new wait_for_events_gpu(data);
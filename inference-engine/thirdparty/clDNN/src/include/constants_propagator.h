@@ -20,6 +20,9 @@
 #include "program_impl.h"
 #include "data_inst.h"
 
+#include <map>
+#include <string>
+
 namespace cldnn
 {
 
@@ -38,9 +41,13 @@ private:
     std::list<typed_program_node<data>*> const_inputs;
     std::vector<primitive_id> const_outputs;
     bool has_non_trivial_constants = false;
+    // the reorders of the weights taken from the cache of the engine and the keys of the ones to add to it
+    std::list<std::pair<primitive_id, memory_impl::ptr>> cached_outputs;
+    std::map<primitive_id, std::string> cache_keys;
 
     void handle_constant(program_node& node);
     void add_constant(program_node& node);
+    bool reuse_cached(program_node& node);
 };
 
 }
@@ -34,6 +34,7 @@ class typed_program_node<detection_output> : public typed_program_node_base<dete
 public:
     using parent::parent;
 
+    decltype(auto) input() const { return get_dependency(0); }
     decltype(auto) location() const { return get_dependency(0); }
     decltype(auto) confidence() const { return get_dependency(1); }
     decltype(auto) prior_box() const { return get_dependency(2); }
@@ -25,8 +25,11 @@
 
 #include "gpu/engine_info.h"
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <string>
 
 namespace cldnn {
 namespace gpu { 
@@ -55,8 +58,23 @@ public:
     refcounted_obj_ptr<memory_impl> allocate_memory(layout layout);
     refcounted_obj_ptr<memory_impl> allocate_memory(layout layout, primitive_id, uint32_t, std::set<primitive_id>, bool reusable = true);
     refcounted_obj_ptr<memory_impl> reinterpret_buffer(const memory_impl& memory, layout new_layout);
+    // the buffer using the host memory of the other engine (see memory::attach) without a copy, nullptr if the device
+    // can't access the memory directly
+    refcounted_obj_ptr<memory_impl> share_host_memory(memory_impl& memory);
+    // the buffer over the OpenCL buffer (cl_mem) created by user in the context of the engine
+    refcounted_obj_ptr<memory_impl> share_buffer(layout layout, void* buffer);
+    // the host memory pinned for the transfers of the discrete device, the device sharing the memory with the host
+    // reads the usual memory of the engine in place
+    refcounted_obj_ptr<memory_impl> allocate_host_memory(layout layout);
+    // copies the buffers of the same size on the queue, the pinned host memory is transferred by the DMA
+    void copy_memory(memory_impl& src, memory_impl& dst, bool blocking);
     bool is_the_same_buffer(const memory_impl& mem1, const memory_impl& mem2);
 
+    // the results of the weights reorders computed by the constants propagation, shared by the programs of the engine
+    // (the dynamic batch variants and the identical networks), the key describes the reorder and the weights content
+    refcounted_obj_ptr<memory_impl> get_cached_constant(const std::string& key);
+    void cache_constant(const std::string& key, memory_impl& memory);
+
     refcounted_obj_ptr<event_impl> create_user_event(bool set = false);
     void wait_for_events(std::vector<event_impl::ptr> const& events);
 
@@ -94,6 +112,8 @@ private:
     engine_configuration _configuration;
     std::shared_ptr<gpu_toolkit> _context;
 	memory_pool _memory_pool;
+    std::mutex _constants_mutex;
+    std::map<std::string, refcounted_obj_ptr<memory_impl>> _constants;
 };
 }
 
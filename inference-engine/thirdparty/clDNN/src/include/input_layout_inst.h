@@ -48,6 +48,10 @@ public:
     typed_primitive_inst(network_impl& network, input_layout_node const& node);
 
     void set_data(memory_impl& mem);
+
+private:
+    // the output is the host memory of the last input, it can't be overwritten by the copy of the next one
+    bool _shares_host_memory = false;
 };
 
 using input_layout_inst = typed_primitive_inst<input_layout>;
@@ -34,6 +34,8 @@
 #include "kernel_selector_helper.h"
 #include <boost/optional.hpp>
 
+#include <array>
+#include <list>
 #include <vector>
 
 namespace cldnn
@@ -75,6 +77,16 @@ public:
     };
 
 private:
+    //the formats of the convolution input the cost model chooses from, bfyx also covers bf8_xy16 of 1x1 f32 convolutions
+    enum class conv_format
+    {
+        bfyx,
+        byxf,
+        yxfb,
+        count
+    };
+    using conv_format_costs = std::array<float, static_cast<size_t>(conv_format::count)>;
+
     optimization_attributes _optimization_attributes;
     // TODO: Remove once we will get full support for input/output padding in all primitive implementations.
     bool _output_size_handling_enabled;
@@ -105,6 +117,9 @@ private:
     std::map<cache_key, std::shared_ptr<reorder>> _cached_reorders;
     std::map<cache_key, std::shared_ptr<generic_layer>> _cached_generic_layers;
 
+    //input formats of the convolutions chosen by assign_convolution_formats
+    std::map<primitive_id, conv_format> _assigned_formats;
+
     layout get_expected_layout(layout const& current_layout, data_type type, convolution_node const& node, layout const& output_or_weights_layout);
     layout get_expected_layout(layout const& current_layout, data_type type, deconvolution_node const& node, layout const& output_or_weights_layout);
     layout get_expected_layout(layout const& current_layout, data_type type, fully_connected_node const& node, layout const& output_or_weights_layout);
@@ -117,6 +132,9 @@ private:
     bool users_for_convolution_byxf_opt(program_node const& node, uint32_t depth);
     bool deps_depth_in_same_format(program_node const& node, const cldnn::format format, uint32_t depth);
 
+    conv_format get_convolution_format(layout const& current_layout, layout const& weights_layout, convolution_node const& node);
+    conv_format_costs estimate_convolution_costs(convolution_node& node);
+
     //pair.first is reorder (may be nullptr if reorder is not needed), pair.second tells if returned reorder was cached (no need to add it to 'ouputs' etc.)
     //for pair.first == nullptr, pair.second == true
     std::pair<std::shared_ptr<cldnn::reorder>, bool>
@@ -177,5 +195,10 @@ public:
         data_type type);
 
     void set_optimization_attribute(optimization_attributes_type attribute, int32_t val);
+
+    //chooses the input formats of all the convolutions at once, minimizing the estimated time of the convolution kernels
+    //plus the reorders between the convolutions of different formats (and from the inputs in other formats).
+    //get_reorder returns the reorders to the chosen formats afterwards, the convolutions left out keep the per-layer rules.
+    void assign_convolution_formats(std::list<program_node*> const& processing_order);
 };
 }
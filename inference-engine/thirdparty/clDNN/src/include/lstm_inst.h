@@ -38,7 +38,7 @@ public:
     }
     decltype(auto) inital_cell() const {
         // This doesn't scale. We should use a map to get the dependencies index at primitive level
-        return get_dependency(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 2));
+        return get_dependency(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 3));
     }
     decltype(auto) peepholes() const { return get_dependency(6); }
     bool bias_term() const { return !get_primitive()->bias.empty(); }
@@ -47,6 +47,14 @@ public:
     bool initial_cell_term() const { return !get_primitive()->initial_cell.empty(); }
     auto activations() const { return get_primitive()->activations; }
     auto activation_params() const { return get_primitive()->activation_params; }
+    int32_t offset_order() const { return get_primitive()->offset_order; }
+    float clip() const {
+        float clip_val = get_primitive()->clip;
+        if (clip_val < 0)
+            throw std::range_error("Clip value < 0");
+        return clip_val;
+    }
+    bool input_forget() const { return get_primitive()->input_forget; }
 };
 
 using lstm_node = typed_program_node<lstm>;
@@ -71,7 +79,7 @@ public:
         return dep_memory(bias_term() ? 4 : 3);
     }
     decltype(auto) initial_cell_memory() const {
-        return dep_memory(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 2));
+        return dep_memory(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 3));
     }
     decltype(auto) peepholes_memory() const { return dep_memory(6); }
     bool bias_term() const { return !argument.bias.empty(); }
@@ -40,6 +40,8 @@ struct memory_impl : refcounted_obj<memory_impl>
     virtual void fill(unsigned char pattern, event_impl::ptr ev) = 0;
     size_t size() const { return _layout.bytes_count(); }
     virtual bool is_allocated_by(const engine_impl& engine) const { return &engine == _engine.get(); }
+    // the host memory pinned for the transfers of the discrete device, see engine_impl::allocate_host_memory
+    virtual bool is_pinned_host() const { return false; }
     const refcounted_obj_ptr<engine_impl>& get_engine() const { return _engine; }
     const layout& get_layout() const { return _layout; }
 protected:
@@ -105,7 +105,6 @@ struct padded_pool_comparer
 // - resolve engine <--> memory_pool circular dependency
 // - add padded buffers pool
 // - add decreasing memory limit in gpu_buffer/image dctor
-// - add support for multi networks reuse
 
 class memory_pool
 {
@@ -129,6 +128,7 @@ public:
     refcounted_obj_ptr<memory_impl> get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions);
     refcounted_obj_ptr<memory_impl> get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t network_id);
     void clear_pool();
+    void release_network_memory(uint32_t network_id); // frees the buffers no other network uses
     void color_graph(const program_impl&);
     void dump_memory_pool(const program_impl&, std::string, std::string);
 
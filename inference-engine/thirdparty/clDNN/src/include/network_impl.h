@@ -25,6 +25,7 @@
 #include "program_impl.h"
 #include "refcounted_obj.h"
 
+#include <functional>
 #include <map>
 #include <vector>
 #include <unordered_map>
@@ -39,6 +40,7 @@ struct network_impl : public refcounted_obj<network_impl>
 public:
     network_impl(const program_impl& program, bool is_internal = false);
     network_impl(engine_impl& engine, const topology_impl& topo, const build_options& options = build_options(), bool is_internal = false);
+    ~network_impl();
 
     const program_impl& get_program() const { return *_program; }
     engine_impl& get_engine() const { return _program->get_engine(); }
@@ -49,6 +51,15 @@ public:
     void set_learning_rate(const float lr);
     float get_learning_rate();
 
+    // the handler called after every 'slice' primitives are submitted, see cldnn_set_network_yield_handler
+    void set_yield_handler(std::function<void()> handler, uint32_t slice);
+
+    // the executions process only the first 'batch' of the inputs, see cldnn_set_network_batch
+    bool supports_runtime_batch() const;
+    void set_batch(uint32_t batch);
+    uint32_t get_batch() const { return _batch ? _batch : _max_batch; }
+    uint32_t get_max_batch() const { return _max_batch; }
+
     auto const& get_outputs() { return _outputs; }
 
     const std::vector<std::shared_ptr<const primitive_inst>>& get_outputs() const
@@ -90,7 +101,27 @@ private:
 
     std::unordered_map<primitive_id, event_impl::ptr> _events;
 
+    // The enqueues of the primitives recorded by the last execution, the next executions replay them
+    // until the input memory or the learning rate changes
+    struct recorded_primitive
+    {
+        std::shared_ptr<primitive_inst> inst;
+        std::vector<std::function<event_impl::ptr()>> enqueues;
+    };
+    std::vector<recorded_primitive> _recorded;
+    bool _recorded_valid = false;
+
+    std::function<void()> _yield_handler;
+    uint32_t _yield_slice = 0;
+
+    // the batch of the inputs the network is built for (0 if they differ) and the batch set for the executions
+    uint32_t _max_batch = 0;
+    uint32_t _batch = 0;
+
     void allocate_primitive_instance(program_node const& node);
+    void record_execution();
+    void replay_execution();
+    void yield_point(size_t executed, event_impl::ptr& slice_end);
 };
 }
 
@@ -28,6 +28,7 @@
 #include "network_impl.h"
 #include "program_node.h"
 
+#include <functional>
 #include <memory>
 #include <vector>
 #include <boost/optional.hpp>
@@ -60,6 +61,20 @@ struct primitive_impl
 
     virtual event_impl::ptr execute(const std::vector<event_impl::ptr>& events, primitive_inst& instance) = 0;
 
+    // Appends the enqueues of the last execution to the sequence the network replays while its inputs do not change.
+    // Returns false if the implementation does more than enqueuing the same kernels (host code, nested networks).
+    virtual bool record(primitive_inst& /*instance*/, std::vector<std::function<event_impl::ptr()>>& /*enqueues*/)
+    {
+        return false;
+    }
+
+    // Returns true if the implementation processes only the first batches of the built 'max_batch' when the network
+    // batch is set to a smaller one (see network_impl::set_batch) and keeps the same results for them.
+    virtual bool supports_runtime_batch(uint32_t /*max_batch*/) const
+    {
+        return false;
+    }
+
 	std::string get_kernel_name() { return kernel_name; };
 
     // TODO: added a derived class for weights reordering (maybe for all static data reordering)
@@ -109,6 +124,7 @@ public:
     }
 
     event_impl::ptr execute(const std::vector<event_impl::ptr>& events);
+    bool record(std::vector<std::function<event_impl::ptr()>>& enqueues) { return _impl->record(*this, enqueues); }
 
     auto output_changed() const { return _output_changed; }
     void reset_output_change() { _output_changed = false; }
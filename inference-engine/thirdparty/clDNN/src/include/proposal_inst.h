@@ -28,6 +28,7 @@ struct typed_program_node<proposal> : public typed_program_node_base<proposal>
     using parent = typed_program_node_base<proposal>;
     using parent::parent;
 
+    decltype(auto) input() const { return get_dependency(0); }
     decltype(auto) cls_score() const { return get_dependency(0); }
     decltype(auto) bbox_pred() const { return get_dependency(1); }
     decltype(auto) image_info() const { return get_dependency(2); }
@@ -85,6 +86,7 @@ public:
 
     static layout calc_output_layout(proposal_node const& node);
     static std::string to_string(proposal_node const& node);
+    static std::vector<anchor> calculate_anchors(proposal_node const& node);
 
 public:    
     typed_primitive_inst(network_impl& network, proposal_node const& desc);
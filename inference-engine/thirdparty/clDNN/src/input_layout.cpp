@@ -39,12 +39,35 @@ void input_layout_inst::set_data(memory_impl& mem)
 
     CLDNN_ERROR_LAYOUT_MISMATCH("input layout", "memory layout", mem.get_layout(), "output memory layout", node.get_output_layout(), "");
 
-    if (mem.is_allocated_by(get_network().get_engine()))
+    if (mem.is_pinned_host() && mem.is_allocated_by(get_network().get_engine()))
+    {
+        // the pinned host memory of the discrete device is copied to the device memory by the DMA, the kernels reading
+        // the input are enqueued after the copy without waiting for it
+        if (_shares_host_memory || _output->is_pinned_host())
+        {
+            _output = allocate_output();
+            _shares_host_memory = false;
+        }
+        get_network().get_engine().copy_memory(mem, *_output, false);
+    }
+    else if (mem.is_allocated_by(get_network().get_engine()))
     {
         _output = &mem;
+        _shares_host_memory = false;
+    }
+    else if (auto shared_mem = get_network().get_engine().share_host_memory(mem))
+    {
+        // the device reads the input from the host memory directly
+        _output = shared_mem;
+        _shares_host_memory = true;
     }
     else
     {
+        if (_shares_host_memory)
+        {
+            _output = allocate_output();
+            _shares_host_memory = false;
+        }
         mem_lock<char> src(&mem);
         mem_lock<char> dst(_output);
         std::copy(src.begin(), src.end(), dst.begin());
@@ -28,6 +28,10 @@
 
 #include "eltwise_inst.h"
 #include "pooling_inst.h"
+#include "activation_inst.h"
+
+#include <limits>
+#include <set>
 
 using namespace cldnn;
 
@@ -52,6 +56,29 @@ namespace {
 
         return true;
     }
+
+    //the costs of the format assignment are in the floating point operations the device runs in the same time,
+    //the integrated GPUs run ~16 operations per byte of the memory bandwidth (~400 GFLOPS over ~25 GB/s)
+    const float flops_per_byte = 16.f;
+    //the dispatch of one more kernel (~5us)
+    const float kernel_launch_flops = 2.e6f;
+    //the throughput of the convolution kernels in the formats the per-layer rules do not choose,
+    //relative to the throughput in the chosen one
+    const float other_format_efficiency = 0.75f;
+    //the iterated conditional modes stop after this number of sweeps even if the formats still change
+    const size_t max_assignment_sweeps = 8;
+
+    float reorder_cost(layout const& l)
+    {
+        //the reorder reads and writes the whole tensor
+        return kernel_launch_flops + 2.f * flops_per_byte * static_cast<float>(l.bytes_count());
+    }
+
+    //primitives that run in the format of their inputs, the convolutions they connect share the format without reorders
+    bool keeps_format(program_node const& node)
+    {
+        return node.is_type<eltwise>() || node.is_type<pooling>() || node.is_type<activation>();
+    }
 }
 
 layout_optimizer::layout_optimizer(bool output_size_handling_enabled)
@@ -169,6 +196,269 @@ bool layout_optimizer::deps_depth_in_same_format(program_node const& node, const
     return same_format;
 }
 
+layout_optimizer::conv_format layout_optimizer::get_convolution_format(layout const& current_layout, layout const& weights_layout, convolution_node const& node)
+{
+    auto assigned = _assigned_formats.find(node.id());
+    if (assigned != _assigned_formats.end())
+    {
+        //TODO: remove this condition when yxfb optimizations will be disabled
+        if (assigned->second == conv_format::byxf && current_layout.format == cldnn::format::yxfb)
+            return conv_format::bfyx;
+        return assigned->second;
+    }
+
+    //the per-layer rules, for the convolutions added after the assignment
+    auto prim = node.get_primitive();
+    if (current_layout.data_type == data_types::f16 &&
+        convolution_byxf_opt(current_layout, weights_layout, prim) &&
+        (users_for_convolution_byxf_opt(node, 2) || deps_depth_in_same_format(node, cldnn::format::byxf, 2)) &&
+        //TODO: remove this condition when yxfb optimizations will be disabled
+        current_layout.format != cldnn::format::yxfb &&
+        current_layout.size.batch[0] == 1 &&
+        !node.get_transposed())
+        return conv_format::byxf;
+
+    if (convolution_bfyx_opt(current_layout, weights_layout, prim) ||
+        (_output_size_handling_enabled && prim->with_output_size) ||
+        node.get_transposed())
+        return conv_format::bfyx;
+
+    return conv_format::yxfb;
+}
+
+layout_optimizer::conv_format_costs layout_optimizer::estimate_convolution_costs(convolution_node& node)
+{
+    auto prim = node.get_primitive();
+    auto input_layout = node.get_dependency(0).get_output_layout();
+    auto weights_layout = node.weights(0).get_output_layout();
+    auto output_layout = node.get_output_layout();
+
+    //the formats the kernels support for the convolution and the one the per-layer rules consider the fastest
+    bool bfyx_only = (_output_size_handling_enabled && prim->with_output_size) || node.get_transposed();
+    bool byxf_supported = input_layout.data_type == data_types::f16 &&
+        input_layout.size.batch[0] == 1 &&
+        !bfyx_only &&
+        convolution_byxf_opt(input_layout, weights_layout, prim);
+
+    auto preferred = conv_format::yxfb;
+    if (byxf_supported)
+        preferred = conv_format::byxf;
+    else if (bfyx_only || convolution_bfyx_opt(input_layout, weights_layout, prim))
+        preferred = conv_format::bfyx;
+
+    //the weights hold the input features and the kernel size of one split
+    auto flops = 2.f * static_cast<float>(output_layout.count()) *
+        weights_layout.size.feature[0] * weights_layout.size.spatial[0] * weights_layout.size.spatial[1];
+
+    conv_format_costs costs;
+    costs.fill(std::numeric_limits<float>::infinity());
+    for (auto format : { conv_format::bfyx, conv_format::byxf, conv_format::yxfb })
+    {
+        if ((format == conv_format::byxf && !byxf_supported) || (format == conv_format::yxfb && bfyx_only))
+            continue;
+
+        costs[static_cast<size_t>(format)] = kernel_launch_flops + (format == preferred ? flops : flops / other_format_efficiency);
+    }
+    return costs;
+}
+
+void layout_optimizer::assign_convolution_formats(std::list<program_node*> const& processing_order)
+{
+    const size_t formats_count = static_cast<size_t>(conv_format::count);
+    const size_t none = std::numeric_limits<size_t>::max();
+
+    //the convolutions are the nodes of the assignment, the int8 ones keep the format of their input
+    std::vector<convolution_node*> convs;
+    std::map<program_node const*, size_t> conv_index;
+    for (auto node : processing_order)
+    {
+        if (!node->is_type<convolution>() || node->get_dependency(0).get_output_layout().data_type == data_types::i8)
+            continue;
+
+        conv_index[node] = convs.size();
+        convs.push_back(&node->as<convolution>());
+    }
+
+    if (convs.empty())
+        return;
+
+    struct edge
+    {
+        size_t from;
+        size_t to;
+        float cost;
+    };
+
+    //the kernel cost of every format of the convolution plus the reorders from the other producers of its input,
+    //and the edges to the convolutions producing its input through the primitives keeping the format
+    std::vector<conv_format_costs> node_costs(convs.size());
+    std::vector<edge> edges;
+    for (size_t i = 0; i < convs.size(); i++)
+    {
+        node_costs[i] = estimate_convolution_costs(*convs[i]);
+
+        auto& input = convs[i]->get_dependency(0);
+        //the reorder feeding the convolution is changed to output the assigned format (see program_impl::reorder_inputs)
+        if (input.is_type<reorder>())
+            continue;
+
+        auto input_reorder_cost = reorder_cost(input.get_output_layout());
+        std::vector<program_node*> producers = { &input };
+        std::set<program_node*> visited;
+        while (!producers.empty())
+        {
+            auto producer = producers.back();
+            producers.pop_back();
+            if (!visited.insert(producer).second)
+                continue;
+
+            auto producer_conv = conv_index.find(producer);
+            if (producer_conv != conv_index.end())
+            {
+                edges.push_back({ producer_conv->second, i, input_reorder_cost });
+            }
+            else if (keeps_format(*producer))
+            {
+                for (auto dep : producer->get_dependencies())
+                    if (!dep->is_type<data>())
+                        producers.push_back(dep);
+            }
+            else
+            {
+                auto producer_format = producer->get_output_layout().format;
+                if (producer_format != cldnn::format::bfyx)
+                    node_costs[i][static_cast<size_t>(conv_format::bfyx)] += input_reorder_cost;
+                if (producer_format != cldnn::format::byxf)
+                    node_costs[i][static_cast<size_t>(conv_format::byxf)] += input_reorder_cost;
+                if (producer_format != cldnn::format::yxfb)
+                    node_costs[i][static_cast<size_t>(conv_format::yxfb)] += input_reorder_cost;
+            }
+        }
+    }
+
+    std::vector<std::vector<size_t>> node_edges(convs.size());
+    std::vector<size_t> in_edges(convs.size(), 0);
+    std::vector<size_t> out_edges(convs.size(), 0);
+    for (size_t e = 0; e < edges.size(); e++)
+    {
+        node_edges[edges[e].from].push_back(e);
+        node_edges[edges[e].to].push_back(e);
+        out_edges[edges[e].from]++;
+        in_edges[edges[e].to]++;
+    }
+
+    auto cheapest = [&](conv_format_costs const& costs)
+    {
+        size_t best = 0;
+        for (size_t f = 1; f < formats_count; f++)
+            if (costs[f] < costs[best])
+                best = f;
+        return best;
+    };
+
+    std::vector<size_t> assigned(convs.size());
+    for (size_t i = 0; i < convs.size(); i++)
+        assigned[i] = cheapest(node_costs[i]);
+
+    //the costs of the formats of the convolution given the formats of its neighbours, except the skipped ones
+    auto costs_with_neighbours = [&](size_t i, size_t skip_first, size_t skip_second)
+    {
+        auto costs = node_costs[i];
+        for (auto e : node_edges[i])
+        {
+            auto neighbour = edges[e].from == i ? edges[e].to : edges[e].from;
+            if (neighbour == skip_first || neighbour == skip_second)
+                continue;
+
+            for (size_t f = 0; f < formats_count; f++)
+                if (f != assigned[neighbour])
+                    costs[f] += edges[e].cost;
+        }
+        return costs;
+    };
+
+    //the chains of convolutions connected by single edges are assigned exactly by dynamic programming,
+    //with the neighbours outside the chain fixed
+    std::vector<size_t> next(convs.size(), none);
+    std::vector<float> link_cost(convs.size(), 0.f);
+    std::vector<bool> has_prev(convs.size(), false);
+    for (auto& e : edges)
+    {
+        if (out_edges[e.from] == 1 && in_edges[e.to] == 1)
+        {
+            next[e.from] = e.to;
+            link_cost[e.to] = e.cost;
+            has_prev[e.to] = true;
+        }
+    }
+
+    for (size_t start = 0; start < convs.size(); start++)
+    {
+        if (has_prev[start])
+            continue;
+
+        std::vector<size_t> chain;
+        for (auto i = start; i != none; i = next[i])
+            chain.push_back(i);
+
+        std::vector<conv_format_costs> best(chain.size());
+        std::vector<std::array<size_t, static_cast<size_t>(conv_format::count)>> best_prev(chain.size());
+        for (size_t k = 0; k < chain.size(); k++)
+        {
+            auto prev = k > 0 ? chain[k - 1] : none;
+            auto local = costs_with_neighbours(chain[k], prev, next[chain[k]]);
+            for (size_t f = 0; f < formats_count; f++)
+            {
+                best[k][f] = local[f];
+                if (k == 0)
+                    continue;
+
+                auto prev_best = std::numeric_limits<float>::infinity();
+                for (size_t g = 0; g < formats_count; g++)
+                {
+                    auto cost = best[k - 1][g] + (g == f ? 0.f : link_cost[chain[k]]);
+                    if (cost < prev_best)
+                    {
+                        prev_best = cost;
+                        best_prev[k][f] = g;
+                    }
+                }
+                best[k][f] += prev_best;
+            }
+        }
+
+        auto f = cheapest(best.back());
+        for (size_t k = chain.size(); k-- > 0;)
+        {
+            assigned[chain[k]] = f;
+            f = best_prev[k][f];
+        }
+    }
+
+    //the branches and joins of the graph are settled by the iterated conditional modes: every convolution takes its
+    //cheapest format given the current formats of its neighbours until no format changes
+    for (size_t sweep = 0; sweep < max_assignment_sweeps; sweep++)
+    {
+        bool changed = false;
+        for (size_t i = 0; i < convs.size(); i++)
+        {
+            auto costs = costs_with_neighbours(i, none, none);
+            auto best = cheapest(costs);
+            if (costs[best] < costs[assigned[i]])
+            {
+                assigned[i] = best;
+                changed = true;
+            }
+        }
+
+        if (!changed)
+            break;
+    }
+
+    for (size_t i = 0; i < convs.size(); i++)
+        _assigned_formats[convs[i]->id()] = static_cast<conv_format>(assigned[i]);
+}
+
 layout layout_optimizer::get_expected_layout(layout const& current_layout, data_type type, convolution_node const& node, layout const& output_or_weights_layout)
 {
     auto prim = node.get_primitive();
@@ -189,27 +479,22 @@ layout layout_optimizer::get_expected_layout(layout const& current_layout, data_
         break;
 
     case data_type::input: //convolution input
-
-        if (current_layout.data_type == data_types::f16 &&
-            layout_optimizer::convolution_byxf_opt(current_layout, output_or_weights_layout, prim) &&
-            (users_for_convolution_byxf_opt(node, 2) || deps_depth_in_same_format(node, cldnn::format::byxf, 2)) &&
-            //TODO: remove this condition when yxfb optimizations will be disabled
-            current_layout.format != cldnn::format::yxfb &&
-            current_layout.size.batch[0] == 1 &&
-            !node.get_transposed())
+    {
+        // MMAD case
+        if (current_layout.data_type == data_types::i8)
         {
             expected_tensor = current_layout.size;
-            expected_format = cldnn::format::byxf;
+            expected_format = current_layout.format;//cldnn::format::byxf_af32;
+            break;
         }
-        // MMAD case
-        else if (current_layout.data_type == data_types::i8)
+
+        auto conv_format = get_convolution_format(current_layout, output_or_weights_layout, node);
+        if (conv_format == layout_optimizer::conv_format::byxf)
         {
             expected_tensor = current_layout.size;
-            expected_format = current_layout.format;//cldnn::format::byxf_af32;
+            expected_format = cldnn::format::byxf;
         }
-        else if (layout_optimizer::convolution_bfyx_opt(current_layout, output_or_weights_layout, prim)
-            || (_output_size_handling_enabled && prim->with_output_size) ||
-            node.get_transposed())
+        else if (conv_format == layout_optimizer::conv_format::bfyx)
         {
             if (current_layout.data_type == data_types::f32 &&
                 current_layout.size.batch[0] % 16 == 0 &&
@@ -239,6 +524,7 @@ layout layout_optimizer::get_expected_layout(layout const& current_layout, data_
         }
 
         break;
+    }
 
     default:
         throw std::runtime_error("Unsupported data type in layout_optimizer::get_expected_layout for convolution primitive");
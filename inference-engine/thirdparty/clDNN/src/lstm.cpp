@@ -32,17 +32,15 @@ primitive_type_id lstm_type_id()
 layout lstm_inst::calc_output_layout(lstm_node const& node)
 {
     auto input_layout = node.input().get_output_layout();
-    auto hidden_layout = node.inital_hidden().get_output_layout();
+    auto recurrent_layout = node.recurrent().get_output_layout();
 
-    // input     = [        1,  sequence,           batch,      input_size ]
-    // weights   = [        1, direction, 4 * hidden_size,      input_size ]
-    // recurrent = [        1, direction, 4 * hidden_size,     hidden_size ]
-    // biases    = [        1,         1,       direction, 4 * hidden_size ]
-    // hidden    = [        1, direction,           batch,     hidden_size ]
-    // cell      = [        1, direction,           batch,     hidden_size ]
-    // output    = [ sequence, direction,           batch,     hidden_size ]    
-	auto result = layout(input_layout.data_type, format::bfyx,
-                  tensor(hidden_layout.size.feature[0], input_layout.size.feature[0], hidden_layout.size.spatial[0], hidden_layout.size.spatial[1]));
+    // The lstm node is kept only when the whole sequence is its single input (see program_impl::handle_lstm),
+    // the output is the concatenation of the hidden states of all the timesteps, the same as of the unrolled sequence.
+    // input     = [b: batch, f: sequence,  x: input_size,  y: 1               ]
+    // recurrent = [b: 1,     f: direction, x: hidden_size, y: 4 * hidden_size ]
+    // output    = [b: batch, f: sequence,  x: hidden_size, y: 1               ]
+    auto result = layout(input_layout.data_type, format::bfyx,
+                  tensor(input_layout.size.batch[0], input_layout.size.feature[0], recurrent_layout.size.spatial[0], 1));
     return result;
 }
 
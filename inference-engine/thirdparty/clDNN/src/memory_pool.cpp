@@ -200,6 +200,36 @@ namespace cldnn
         _non_padded_pool.clear();
     }
 
+    void memory_pool::release_network_memory(uint32_t network_id)
+    {
+        auto release_users = [network_id](memory_set& users)
+        {
+            for (auto it = users.begin(); it != users.end();)
+                it = it->_network_id == network_id ? users.erase(it) : std::next(it);
+            return users.empty();
+        };
+        // the records of these pools do not hold the reference of the engine (see get_from_non_padded_pool),
+        // so it is restored before the memory releases it
+        for (auto pool : { &_non_padded_pool, &_no_reusable_pool })
+        {
+            for (auto it = pool->begin(); it != pool->end();)
+            {
+                if (release_users(it->second._users))
+                {
+                    _engine->add_ref();
+                    it = pool->erase(it);
+                }
+                else
+                    ++it;
+            }
+        }
+        for (auto it = _padded_pool.begin(); it != _padded_pool.end();)
+        {
+            it->second.remove_if([&](memory_record& record) { return release_users(record._users); });
+            it = it->second.empty() ? _padded_pool.erase(it) : std::next(it);
+        }
+    }
+
     memory_pool::memory_pool(engine_impl& engine)
         : _engine(&engine)
         , _temp_memory_used(0)
@@ -214,6 +244,10 @@ namespace cldnn
         using namespace std;
         ofstream log(path);
 
+        // the pool is shared by all the networks of the engine, so the usage covers the networks loaded before
+        log << "Memory used: " << _temp_memory_used << endl;
+        log << "Peak memory used: " << _max_peak_memory_used << endl;
+
         log << "\nNon-padded pool:" <<endl;
         log << "Size\tUsers:" << endl;
         for (const auto& record : _non_padded_pool)
@@ -236,6 +270,16 @@ namespace cldnn
                 log << endl;
             }
         }
+
+        log << "\n--- Across networks pool: ---" << endl;
+        log << "Size\tUsers:" << endl;
+        for (const auto& record : _no_reusable_pool)
+        {
+            log << record.first;
+            for (const auto& usr : record.second._users)
+                log << ", " << usr;
+            log << endl;
+        }
         log << dep;
         log.close();
         color_graph(program);
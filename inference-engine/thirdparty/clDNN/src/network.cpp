@@ -48,6 +48,12 @@ network_impl::network_impl(const program_impl& program, bool is_internal)
     build_insts_deps();
     build_exec_order();
 
+    for (auto& input : _inputs)
+    {
+        auto batch = static_cast<uint32_t>(_program->get_node(input->id()).get_output_layout().size.batch[0]);
+        _max_batch = (input == _inputs.front() || _max_batch == batch) ? batch : 0;
+    }
+
     _program->dump_memory_pool();
 }
 
@@ -56,6 +62,13 @@ network_impl::network_impl(engine_impl& engine, const topology_impl& topo, const
 {
 }
 
+network_impl::~network_impl()
+{
+    // the buffers of the memory pool used only by this network are freed, so a destroyed network does not keep them
+    if (!_internal)
+        get_engine().get_memory_pool().release_network_memory(net_id);
+}
+
 void network_impl::reset_execution(bool wait)
 {
     if (wait && _events.size() > 0)
@@ -94,12 +107,18 @@ void network_impl::set_input_data(const primitive_id& id, memory_impl& data)
 
     //Wait for previous execution completion
     reset_execution(true);
+    auto prev_output = &input->output_memory();
     input->set_data(data);
+
+    // the recorded kernels take the input memory of the recording
+    if (&input->output_memory() != prev_output)
+        _recorded_valid = false;
 }
 
 void network_impl::set_learning_rate(const float lr)
 {
     _learning_rate = lr;
+    _recorded_valid = false;
 }
 
 float network_impl::get_learning_rate()
@@ -107,6 +126,39 @@ float network_impl::get_learning_rate()
     return _learning_rate;
 }
 
+bool network_impl::supports_runtime_batch() const
+{
+    if (_max_batch == 0)
+        return false;
+
+    for (auto& inst : _exec_order)
+    {
+        auto impl = inst->get_impl();
+        if (!impl || !impl->supports_runtime_batch(_max_batch))
+            return false;
+    }
+    return true;
+}
+
+void network_impl::set_batch(uint32_t batch)
+{
+    if (batch == 0 || batch > _max_batch)
+        throw std::invalid_argument("the network batch must be in [1, " + std::to_string(_max_batch) + "]");
+
+    if (batch == get_batch())
+        return;
+
+    if (batch != _max_batch && !supports_runtime_batch())
+        throw std::runtime_error("the network cannot run a batch other than the one it is built for");
+
+    //Wait for previous execution completion
+    reset_execution(true);
+    _batch = batch;
+
+    // the recorded kernels take the work sizes of the recording
+    _recorded_valid = false;
+}
+
 std::string network_impl::get_primitive_info(const primitive_id& id) const
 {    
     const auto& node = _program->get_node(id);
@@ -174,9 +226,22 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
     //Wait for previous execution completion
     reset_execution(false);
 
-    for (auto& inst : _exec_order)
+    if (_recorded_valid && events.empty())
     {
-        execute_primitive(inst, events);
+        replay_execution();
+    }
+    else
+    {
+        size_t executed = 0;
+        event_impl::ptr slice_end;
+        for (auto& inst : _exec_order)
+        {
+            execute_primitive(inst, events);
+            yield_point(++executed, slice_end);
+        }
+
+        if (events.empty())
+            record_execution();
     }
 
     for (auto& dout : _data_outputs) //data primitives are not executed so if they are marked as output we need to add them valid events manually
@@ -275,6 +340,72 @@ refcounted_obj_ptr<event_impl> network_impl::execute_primitive(const std::shared
     return ev;
 }
 
+void network_impl::record_execution()
+{
+    _recorded.clear();
+    _recorded_valid = false;
+
+    // the replay relies on the enqueue order of the kernels and creates only the events of the outputs
+    auto context = get_engine().get_context();
+    if (context->get_configuration().host_out_of_order ||
+        context->get_configuration().enable_profiling ||
+        context->enabled_single_kernel())
+        return;
+
+    std::vector<recorded_primitive> recorded;
+    recorded.reserve(_exec_order.size());
+    for (auto& inst : _exec_order)
+    {
+        recorded_primitive prim{ inst, {} };
+        if (!inst->record(prim.enqueues))
+            return;
+
+        recorded.push_back(std::move(prim));
+    }
+
+    _recorded = std::move(recorded);
+    _recorded_valid = true;
+}
+
+void network_impl::replay_execution()
+{
+    event_impl::ptr last_event;
+    size_t executed = 0;
+    event_impl::ptr slice_end;
+    for (auto& prim : _recorded)
+    {
+        for (auto& enqueue : prim.enqueues)
+        {
+            last_event = enqueue();
+        }
+
+        // the queue is in order, so the last kernel enqueued completes after the inputs of the primitive
+        _events[prim.inst->id()] = last_event ? last_event : get_engine().create_user_event(true);
+        yield_point(++executed, slice_end);
+    }
+}
+
+void network_impl::set_yield_handler(std::function<void()> handler, uint32_t slice)
+{
+    _yield_handler = handler;
+    _yield_slice = handler ? slice : 0;
+}
+
+void network_impl::yield_point(size_t executed, event_impl::ptr& slice_end)
+{
+    if (!_yield_handler || executed % _yield_slice != 0 || executed == _exec_order.size())
+        return;
+
+    // the device keeps at most two slices of the network: the previous one completes while the next one is queued,
+    // so the handler lets the other queues in after a slice instead of after the whole network
+    auto marker = get_engine().get_context()->enqueue_completion_marker();
+    get_engine().flush_network();
+    if (slice_end)
+        slice_end->wait();
+    slice_end = marker;
+    _yield_handler();
+}
+
 void network_impl::allocate_primitive_instance(program_node const& node)
 {
     if (_primitives.count(node.id()))
@@ -20,6 +20,8 @@
 #include "json_object.h"
 
 #include <cmath>
+#include <iomanip>
+#include <sstream>
 
 namespace cldnn
 {
@@ -182,14 +184,38 @@ void prior_box_node::calc_result()
 
     CLDNN_ERROR_BOOL(id(), "Prior box padding", is_padded(), "Prior-box layer doesn't support output padding.");
 
+    // the priors depend only on the arguments and the shapes, so the programs of the engine (the dynamic batch
+    // variants, the streams and the other loads of the network) share one read-only buffer of them
+    auto& engine = get_program().get_engine();
+    const auto input_layout = input().get_output_layout();
+    const auto output_layout = get_output_layout();
+    std::stringstream key;
+    key << std::setprecision(9) << "prior_box\n" << argument.img_size << ' ' << argument.flip << ' ' << argument.clip
+        << ' ' << argument.step_width << ' ' << argument.step_height << ' ' << argument.offset << ' '
+        << argument.scale_all_sizes;
+    for (const auto* values : { &argument.min_sizes, &argument.max_sizes, &argument.aspect_ratios, &argument.variance })
+    {
+        key << '\n';
+        for (float value : *values)
+            key << value << ' ';
+    }
+    // the batch of the input does not change the priors
+    key << '\n' << static_cast<int>(input_layout.data_type) << ' ' << input_layout.size.spatial[0] << ' '
+        << input_layout.size.spatial[1] << '\n' << static_cast<int>(output_layout.data_type) << ' ' << output_layout.size;
+
+    result = engine.get_cached_constant(key.str());
+    if (result != nullptr)
+        return;
+
     //allocate storage
-    result = get_program().get_engine().allocate_memory(get_output_layout());
+    result = engine.allocate_memory(output_layout);
 
     //perform calculations
     if (input().get_output_layout().data_type == data_types::f16)
         calculate_prior_box_output<data_type_to_type<data_types::f16>::type>(*result, input().get_output_layout(), *typed_desc());
     else
         calculate_prior_box_output<data_type_to_type<data_types::f32>::type>(*result, input().get_output_layout(), *typed_desc());
+    engine.cache_constant(key.str(), *result);
 }
 
 layout prior_box_inst::calc_output_layout(prior_box_node const& node)
@@ -65,6 +65,7 @@
 #include "kernel_selector_helper.h"
 #include "sliding_window_utils.h"
 #include "error_handler.h"
+#include "api_impl.h"
 
 #include <fstream>
 #include <algorithm>
@@ -214,6 +215,44 @@ namespace {
         return layout(mem_layout.data_type, mem_layout.format, { split * mem_layout.size.batch[0], mem_layout.size.feature[0], mem_layout.size.spatial[0], mem_layout.size.spatial[1] });
     }
 
+    //helper functions reading and writing the f32 and f16 buffers of the data primitives as floats (for the folding on cpu side)
+    bool is_float_buffer(layout const& l)
+    {
+        return (l.data_type == data_types::f32 || l.data_type == data_types::f16) && l.get_linear_size() == l.count();
+    }
+
+    std::vector<float> read_floats(memory_impl& mem)
+    {
+        std::vector<float> values(mem.get_layout().count());
+        if (mem.get_layout().data_type == data_types::f16)
+        {
+            mem_lock<uint16_t> src{ mem };
+            std::transform(src.data(), src.data() + values.size(), values.begin(), half_to_float);
+        }
+        else
+        {
+            mem_lock<float> src{ mem };
+            std::copy(src.data(), src.data() + values.size(), values.begin());
+        }
+        return values;
+    }
+
+    memory_impl::ptr write_floats(engine_impl& engine, layout const& l, std::vector<float> const& values)
+    {
+        memory_impl::ptr mem = engine.allocate_memory(l);
+        if (l.data_type == data_types::f16)
+        {
+            mem_lock<uint16_t> dst{ mem };
+            std::transform(values.begin(), values.end(), dst.data(), float_to_half);
+        }
+        else
+        {
+            mem_lock<float> dst{ mem };
+            std::copy(values.begin(), values.end(), dst.data());
+        }
+        return mem;
+    }
+
     // pair.first tells whether l1 and l2 are absolutely identical
     // pair.second tells whether l1 and l2 can be reinterpreted to each other without need of reordering
     // note: layouts can only be considered identical if data size described by both layouts match (so no data are genereted nor dropped)
@@ -251,6 +290,57 @@ namespace {
 
         return{ false, false };
     }
+
+    //the fused lstm kernel keeps the hidden state in the local memory, 16KB of it are available on every device
+    const int32_t max_fused_lstm_hidden_size = 4096;
+
+    //returns the sequence the timesteps of the lstm node are cut from when the node can run as a single kernel looping
+    //over the timesteps (see lstm_gpu), nullptr when it is unrolled into lstm_gemm and lstm_elt primitives
+    program_node* get_lstm_sequence(program_node& node)
+    {
+        auto lstm_prim = node.as<lstm>().get_primitive();
+        auto timesteps = lstm_prim->input.size();
+        if (timesteps == 0)
+            return nullptr;
+
+        //the stacked lstm nodes take the hidden states of the timesteps as separate inputs
+        for (auto user : node.get_users())
+        {
+            if (user->is_type<lstm>())
+                return nullptr;
+        }
+
+        auto& first_timestep = node.get_dependency(0);
+        if (!first_timestep.is_type<crop>() || first_timestep.get_dependencies().size() != 1)
+            return nullptr;
+
+        auto& sequence = first_timestep.get_dependency(0);
+        auto sequence_layout = sequence.get_output_layout();
+        if (sequence_layout.format != format::bfyx ||
+            (sequence_layout.data_type != data_types::f32 && sequence_layout.data_type != data_types::f16) ||
+            sequence_layout.size.feature[0] != static_cast<tensor::value_type>(timesteps))
+            return nullptr;
+
+        auto timestep_size = sequence_layout.size;
+        timestep_size.feature[0] = 1;
+        for (size_t i = 0; i < timesteps; i++)
+        {
+            auto& timestep = node.get_dependency(i);
+            if (!timestep.is_type<crop>() || timestep.get_dependencies().size() != 1 || &timestep.get_dependency(0) != &sequence)
+                return nullptr;
+
+            auto crop_prim = timestep.as<crop>().get_primitive();
+            if (crop_prim->offsets != tensor(0, static_cast<tensor::value_type>(i), 0, 0) || crop_prim->reference_input != timestep_size)
+                return nullptr;
+        }
+
+        //the recurrent weights follow the timesteps and the weights
+        auto recurrent_layout = node.get_dependency(timesteps + 1).get_output_layout();
+        if (recurrent_layout.size.feature[0] != 1 || recurrent_layout.size.spatial[0] > max_fused_lstm_hidden_size)
+            return nullptr;
+
+        return &sequence;
+    }
 }
 
 program_impl::program_impl(engine_impl& engine_ref, topology_impl const& topology, build_options const& options, bool is_internal)
@@ -420,9 +510,8 @@ void program_impl::pre_optimize_graph()
 {
     trim_to_outputs(); dump_program("3_trimmed", true);
 
-    // TODO: uncomment as soon as IE will enable OOOQ by default
-    //if (get_engine().configuration().enable_parallelisation)
-    reorder_nodes_for_parallel_execution();
+    if (get_engine().configuration().enable_parallelisation)
+        reorder_nodes_for_parallel_execution();
 
     analyze_output_size_handling_need();
 
@@ -791,6 +880,50 @@ void program_impl::handle_lstm()
         // replace lstm node with lstm_gemm and lstm_elt nodes
         if (node->is_type<lstm>()) {
 
+            //the timesteps cut from a single sequence run as one kernel looping over the sequence on the device, so the
+            //program does not grow with the sequence length: the lstm node is recreated with the sequence as its input
+            auto sequence = get_lstm_sequence(*node);
+            if (sequence != nullptr)
+            {
+                auto lstm_node = node;
+                auto lstm_prim = lstm_node->as<lstm>().typed_desc();
+                auto timesteps_count = lstm_prim->input.size();
+                auto& deps = lstm_node->get_dependencies();
+                std::vector<program_node*> timesteps(deps.begin(), deps.begin() + timesteps_count);
+                std::vector<program_node*> lstm_params(deps.begin() + timesteps_count, deps.end());
+                std::list<program_node*> users = lstm_node->get_users();
+                nodes_map.erase(node_itr);
+
+                auto fused_prim = std::make_shared<lstm>(lstm_prim->id, std::vector<primitive_id>{ sequence->id() },
+                    lstm_prim->weights, lstm_prim->recurrent, lstm_prim->bias, lstm_prim->initial_hidden, lstm_prim->initial_cell,
+                    lstm_prim->peepholes, lstm_prim->clip, lstm_prim->input_forget, lstm_prim->activations,
+                    lstm_prim->activation_params, lstm_prim->offset_order, lstm_prim->output_padding);
+                auto& fused_node = get_or_create(fused_prim);
+                add_connection(*sequence, fused_node);
+                for (auto lstm_param : lstm_params)
+                    add_connection(*lstm_param, fused_node);
+                for (auto user : users)
+                {
+                    std::replace(user->dependencies.begin(), user->dependencies.end(), lstm_node.get(), &fused_node);
+                    fused_node.users.push_back(user);
+                }
+                lstm_node->users.clear();
+                remove_all_connections(*lstm_node);
+
+                for (auto timestep : timesteps)
+                {
+                    if (!timestep->get_users().empty())
+                        continue;
+
+                    if (itr != nodes_map.end() && itr->second.get() == timestep)
+                        ++itr;
+                    remove_all_connections(*timestep);
+                    optimized_out.push_back(timestep->id());
+                    nodes_map.erase(timestep->id());
+                }
+                continue;
+            }
+
             auto lstm_prim = node->as<lstm>().typed_desc();
             std::vector<primitive_id> output_ids_offsets;
             std::list<program_node*> concat_depends;
@@ -1698,6 +1831,9 @@ void program_impl::reorder_inputs(layout_optimizer& lo)
             lo.set_optimization_attribute(layout_optimizer::optimization_attributes_type::bfyx_only_layer, 1);
     }
 
+    //choose the formats of all the convolutions before inserting the reorders, so the cost of the reorders between them is known
+    lo.assign_convolution_formats(processing_order);
+
     const auto reorder_input = [this, &lo](typed_program_node<convolution>& conv_node)
     {
         auto conv_prim = conv_node.get_primitive();
@@ -1974,9 +2110,15 @@ void program_impl::prepare_depthwise_sep_opt()
 {
     const auto prepare_depthwise_sep_opt = [this](auto& node) -> void
     {
-        //enable optimization only when IFM / split <= 8 (otherwise scheduling multiple opt kernels is better) and split >= 16
-        if (!(node.get_dependency(0).get_output_layout().size.feature[0] / node.get_primitive()->split() <= 8) ||
-            !(node.get_primitive()->split() >= 16))
+        //enable optimization only when IFM / split <= 8 (otherwise scheduling multiple opt kernels is better) and split >= 16,
+        //the convolutions have the grouped kernel running all the splits in one dispatch, so they merge from 4 splits
+        const auto split = node.get_primitive()->split();
+        if (node.template is_type<convolution>())
+        {
+            if (split < 4)
+                return;
+        }
+        else if (!(node.get_dependency(0).get_output_layout().size.feature[0] / split <= 8) || !(split >= 16))
             return;
 
         //make sure the weights and biases are data type and
@@ -2562,32 +2704,28 @@ void program_impl::prepare_buffer_fusing()
             if (node.get_dependencies().size() == 1 &&
                 node.get_users().size() > 0)
             {
-                // optimization is avaiable for croping across depth(features) only
-                // if output padding has defined padding accross featuers already it wouldn't
-                // work because it expect to have zeros in the padded area.
+                // the crop becomes a padded view of its input along any of the axes (so do the crops the splits are replaced with).
+                // if output padding is defined already it wouldn't work because it expect to have zeros in the padded area.
+                // the padding of the input is final, unless a concatenation still puts the input in place
                 auto format = node.get_output_layout().format;
                 auto crop_prim = node.get_primitive();
-                auto input_layout = node.get_dependency(0).get_output_layout();
+                auto& input = node.get_dependency(0);
+                auto input_layout = input.get_output_layout();
+                auto in_padd = input_layout.data_padding;
                 auto out_padd = node.get_output_layout().data_padding;
-                if (format == format::bfyx &&
-                    crop_prim->reference_input.batch[0] == input_layout.size.batch[0] &&
-                    crop_prim->reference_input.spatial[0] == input_layout.size.spatial[0] &&
-                    crop_prim->reference_input.spatial[1] == input_layout.size.spatial[1] &&
-                    out_padd.lower_size().feature[0] == 0 &&
-                    out_padd.upper_size().feature[0] == 0 &&
-                    out_padd.lower_size().batch[0] == 0 &&
-                    out_padd.upper_size().batch[0] == 0 &&
-                    out_padd.lower_size().spatial[0] == 0 &&
-                    out_padd.lower_size().spatial[1] == 0 &&
-                    out_padd.upper_size().spatial[0] == 0 &&
-                    out_padd.upper_size().spatial[1] == 0)
+                bool input_concatenated = std::any_of(input.get_users().begin(), input.get_users().end(),
+                    [](const program_node* user) { return user->is_type<concatenation>(); });
+                if ((format == format::bfyx || format == format::yxfb) &&
+                    format == input_layout.format &&
+                    !out_padd &&
+                    !input_concatenated)
                 {
                     //  Regular crop
                     //  crop input buffer
                     //  |___________data____________|
                     //
                     //  crop output buffer
-                    //  |-------->| offsets[f]  |<--|
+                    //  |-------->| offsets     |<--|
                     //            |_____data____|
                     //             <------------>
                     //           reference size
@@ -2595,11 +2733,15 @@ void program_impl::prepare_buffer_fusing()
                     //  Inplace crop
                     //  crop output buffer
                     //  |_low_pad_|__data_size__|___|<-upper pad
+                    std::vector<tensor::value_type> lower(4, 0);
+                    std::vector<tensor::value_type> upper(4, 0);
+                    for (size_t i = 0; i < lower.size(); i++) // b, f, x, y
+                    {
+                        lower[i] = in_padd.lower_size().raw[i] + crop_prim->offsets.raw[i];
+                        upper[i] = in_padd.upper_size().raw[i] + input_layout.size.raw[i] - crop_prim->offsets.raw[i] - crop_prim->reference_input.raw[i];
+                    }
 
-                    node.set_output_padding(padding(
-                    { out_padd.lower_size().batch[0], crop_prim->offsets.feature[0], out_padd.lower_size().spatial[0], out_padd.lower_size().spatial[1] },
-                    { out_padd.upper_size().batch[0], input_layout.size.feature[0] - crop_prim->offsets.feature[0] - crop_prim->reference_input.feature[0],
-                        out_padd.upper_size().spatial[0], out_padd.upper_size().spatial[1] }));
+                    node.set_output_padding(padding(lower, upper));
                     node.can_be_optimized(true);
                 }
             }
@@ -2683,12 +2825,109 @@ void program_impl::prepare_primitive_fusing()
 {
     bool is_debug = options.get<build_option_type::debug>()->enabled();
 
+    //First loop folds the constant scales (with their biases) following the convolutions into the convolution weights and biases,
+    //so the activations following the scales are fused into the convolutions by the second loop
     auto itr = processing_order.begin(); //note we need to use iterators since currently processed element can be removed
     while (itr != processing_order.end())
     {
         auto node_itr = itr++;
         auto& node = (*node_itr);
 
+        do_for_types<scale>(*node, [this, is_debug](scale_node& node)
+        {
+            auto& input = node.input();
+
+            //Restrictions:
+            // - inputs cannot be padded
+            // - primitives input cannot be output
+            // - the scale and the bias are the constant data
+            // - the convolution has no other users, no activation and is not quantized
+            if (node.has_padded_dependency() || (input.is_output() && !is_debug) || !input.is_type<convolution>() ||
+                input.get_users().size() != 1 || input.get_fused_activation_func() != activation_none ||
+                !node.scale_in().is_type<data>() || (node.bias_term() && !node.bias().is_type<data>()))
+                return;
+
+            auto& conv = input.as<convolution>();
+            if (conv.get_primitive()->with_activation || conv.weights_quantization_term() || conv.output_calibration_term() || conv.get_depthwise_sep_opt() ||
+                conv.get_transposed() || (node.bias_term() && !conv.bias_term()) ||
+                node.get_output_layout().data_type != conv.get_output_layout().data_type)
+                return;
+
+            //the scale is a scalar or holds a value per output feature, the bias is of the same size
+            const auto ofm = conv.get_output_layout().size.feature[0];
+            const auto& scale_layout = node.scale_in().get_output_layout();
+            if (!is_float_buffer(scale_layout) || (scale_layout.count() != 1 &&
+                (scale_layout.count() != static_cast<size_t>(ofm) || scale_layout.size.feature[0] != ofm)))
+                return;
+            if (node.bias_term() && (!is_float_buffer(node.bias().get_output_layout()) ||
+                node.bias().get_output_layout().count() != scale_layout.count()))
+                return;
+
+            //the weights (bfyx, the output features outermost) and the biases are changed, so they must not be shared
+            const auto split = conv.get_split();
+            for (int32_t i = 0; i < split; i++)
+            {
+                auto& weights = conv.weights(i);
+                if (!weights.is_type<data>() || weights.get_users().size() != 1 || weights.get_output_layout().format != format::bfyx ||
+                    !is_float_buffer(weights.get_output_layout()) ||
+                    weights.get_output_layout().size.batch[0] * split != ofm)
+                    return;
+                if (conv.bias_term() && (!conv.bias(i).is_type<data>() || conv.bias(i).get_users().size() != 1 ||
+                    !is_float_buffer(conv.bias(i).get_output_layout()) ||
+                    conv.bias(i).get_output_layout().count() * split != static_cast<size_t>(ofm)))
+                    return;
+            }
+
+            auto scales = read_floats(node.scale_in().as<data>().get_attached_memory());
+            auto shifts = node.bias_term() ? read_floats(node.bias().as<data>().get_attached_memory()) : std::vector<float>(scales.size(), 0.f);
+            const size_t ofm_per_split = static_cast<size_t>(ofm / split);
+            for (int32_t i = 0; i < split; i++)
+            {
+                auto& weights = conv.weights(i).as<data>();
+                auto values = read_floats(weights.get_attached_memory());
+                const size_t weights_per_ofm = values.size() / ofm_per_split;
+                for (size_t o = 0; o < ofm_per_split; o++)
+                {
+                    const float s = scales[scales.size() == 1 ? 0 : i * ofm_per_split + o];
+                    for (size_t w = 0; w < weights_per_ofm; w++)
+                        values[o * weights_per_ofm + w] *= s;
+                }
+                //new buffers are attached since the memory of the data primitives may be shared with other programs
+                weights.attach_memory(*write_floats(*engine, weights.get_output_layout(), values), false);
+
+                if (!conv.bias_term())
+                    continue;
+                auto& bias = conv.bias(i).as<data>();
+                auto biases = read_floats(bias.get_attached_memory());
+                for (size_t o = 0; o < ofm_per_split; o++)
+                {
+                    const size_t f = scales.size() == 1 ? 0 : i * ofm_per_split + o;
+                    biases[o] = biases[o] * scales[f] + shifts[f];
+                }
+                bias.attach_memory(*write_floats(*engine, bias.get_output_layout(), biases), false);
+            }
+
+            input.set_output_padding(node.get_output_layout().data_padding);
+
+            std::vector<program_node*> constants = { &node.scale_in() };
+            if (node.bias_term())
+                constants.push_back(&node.bias());
+            for (auto constant : constants)
+            {
+                remove_connection(*constant, node);
+                remove_if_dangling(*constant);
+            }
+            extract_and_remove(node);
+        });
+    }
+
+    //Second loop fuses the activations into the preceding primitives
+    itr = processing_order.begin();
+    while (itr != processing_order.end())
+    {
+        auto node_itr = itr++;
+        auto& node = (*node_itr);
+
         do_for_types<activation>(*node, [this, is_debug](activation_node& node)
         {
 
@@ -2723,7 +2962,7 @@ void program_impl::prepare_primitive_fusing()
         });
     }
 
-    //Second loop tries fusing several reorders one by one (if present) into one reorder
+    //Third loop tries fusing several reorders one by one (if present) into one reorder
     itr = processing_order.begin();
     while (itr != processing_order.end())
     {
@@ -99,12 +99,21 @@ std::string proposal_inst::to_string(proposal_node const& node)
     return primitive_description.str();
 }
 
-proposal_inst::typed_primitive_inst(network_impl& network, proposal_node const& node)
-    :parent(network, node)
+std::vector<proposal_inst::anchor> proposal_inst::calculate_anchors(proposal_node const& node)
 {
+    auto desc = node.get_primitive();
+
 //    std::vector<float> default_ratios = { 0.5f, 1.0f, 2.0f };
     int default_size = 16;
-    generate_anchors(default_size, argument.ratios, argument.scales, _anchors);
+    std::vector<anchor> anchors;
+    generate_anchors(default_size, desc->ratios, desc->scales, anchors);
+    return anchors;
+}
+
+proposal_inst::typed_primitive_inst(network_impl& network, proposal_node const& node)
+    :parent(network, node)
+    , _anchors(calculate_anchors(node))
+{
 }
 
 static void calc_basic_params(
@@ -0,0 +1,85 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/convolution.hpp>
+
+#include "test_utils/test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+    const std::vector<float> input_values = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 2.0f, 2.0f, 3.0f, 4.0f, 6.0f,
+                                              3.0f, 3.0f, 3.0f, 5.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+
+    // 2x3 filter over the 4x5 input with the stride 2 in y, the weights are reordered for the yxfb convolution
+    void run_and_check(const engine& eng, const std::vector<float>& weights_values)
+    {
+        auto input = memory::allocate(eng, { data_types::f32, format::yxfb, { 1, 1, 5, 4 } });
+        auto weights = memory::allocate(eng, { data_types::f32, format::bfyx, { 1, 1, 3, 2 } });
+        set_values(input, input_values);
+        set_values(weights, weights_values);
+
+        topology tpl(
+            input_layout("input", input.get_layout()),
+            data("weights", weights),
+            convolution("conv", "input", { "weights" }, { 1, 1, 1, 2 }));
+
+        network net(eng, tpl);
+        net.set_input_data("input", input);
+        auto output = net.execute().at("conv").get_memory();
+        auto output_ptr = output.pointer<float>();
+
+        for (int y = 0; y < 2; ++y)
+        {
+            for (int x = 0; x < 3; ++x)
+            {
+                float expected = 0.f;
+                for (int ky = 0; ky < 2; ++ky)
+                    for (int kx = 0; kx < 3; ++kx)
+                        expected += input_values[(y * 2 + ky) * 5 + x + kx] * weights_values[ky * 3 + kx];
+                EXPECT_FLOAT_EQ(expected, output_ptr[y * 3 + x]);
+            }
+        }
+    }
+}
+
+TEST(constants_cache, same_weights_in_new_memory)
+{
+    engine eng;
+
+    // the second network takes the reordered weights of the first one
+    run_and_check(eng, { 1.0f, 2.0f, 1.0f, 2.0f, 1.0f, 2.0f });
+    run_and_check(eng, { 1.0f, 2.0f, 1.0f, 2.0f, 1.0f, 2.0f });
+}
+
+TEST(constants_cache, different_weights_of_same_layout)
+{
+    engine eng;
+
+    // the weights differ in the content only, so the second network reorders its own weights
+    run_and_check(eng, { 1.0f, 2.0f, 1.0f, 2.0f, 1.0f, 2.0f });
+    run_and_check(eng, { -1.0f, 0.5f, 3.0f, 0.0f, 2.0f, -2.0f });
+}
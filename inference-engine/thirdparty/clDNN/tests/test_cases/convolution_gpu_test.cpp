@@ -33,6 +33,8 @@
 #include <thread>
 #include <fstream>
 #include <api/CPP/reorder.hpp>
+#include <api/CPP/scale.hpp>
+#include <api/CPP/activation.hpp>
 
 using namespace cldnn;
 using namespace tests;
@@ -1555,6 +1557,82 @@ TEST(convolution_f32_fw_gpu, basic_wsiz2x2_wstr2x2_in4x4x2x2_nopad_split2_depthw
     }
 }
 
+TEST(convolution_f32_fw_gpu, wsiz3x3_in3x3x8x1_pad1_split4_grouped) {
+    //  Test for the grouped kernel: 4 groups of 2 input features and 1 output feature each run in one dispatch,
+    //  the weights of the group g are all g + 1 and its bias is g, so every output is (g + 1) * (the sum of the
+    //  inputs of the group under the 3x3 filter) + g
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 8, 3, 3 } });
+
+    std::vector<float> input_vec(8 * 3 * 3);
+    for (size_t i = 0; i < input_vec.size(); i++)
+        input_vec[i] = static_cast<float>(i % 7) - 3.0f;
+    set_values(input, input_vec);
+
+    topology topology(input_layout("input", input.get_layout()));
+
+    std::vector<primitive_id> weights_vec;
+    std::vector<primitive_id> bias_vec;
+
+    for (uint32_t g = 0; g < 4; g++)
+    {
+        auto weights = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 2, 3, 3 } });
+        auto biases = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 1, 1 } });
+
+        set_values(weights, std::vector<float>(2 * 3 * 3, static_cast<float>(g + 1)));
+        set_values(biases, { static_cast<float>(g) });
+
+        weights_vec.push_back("weights_" + std::to_string(g));
+        bias_vec.push_back("biases_" + std::to_string(g));
+
+        topology.add(
+            data(weights_vec.back(), weights),
+            data(bias_vec.back(), biases)
+        );
+    }
+
+    topology.add(
+        convolution(
+            "conv",
+            "input",
+            weights_vec,
+            bias_vec,
+            { 1,1,1,1 },
+            { 0,0,-1,-1 },
+            { 1,1,1,1 })
+    );
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "conv");
+
+    auto output_prim = outputs.begin()->second.get_memory();
+    EXPECT_EQ(output_prim.get_layout().size, tensor(1, 4, 3, 3));
+
+    auto output_ptr = output_prim.pointer<float>();
+
+    for (int g = 0; g < 4; g++)
+    {
+        for (int y = 0; y < 3; y++)
+        {
+            for (int x = 0; x < 3; x++)
+            {
+                float sum = 0.0f;
+                for (int f = 2 * g; f < 2 * g + 2; f++)
+                    for (int ky = std::max(y - 1, 0); ky <= std::min(y + 1, 2); ky++)
+                        for (int kx = std::max(x - 1, 0); kx <= std::min(x + 1, 2); kx++)
+                            sum += input_vec[(f * 3 + ky) * 3 + kx];
+
+                EXPECT_FLOAT_EQ((g + 1) * sum + g, output_ptr[(g * 3 + y) * 3 + x]);
+            }
+        }
+    }
+}
+
 TEST(convolution_f32_fw_gpu, basic_wsiz1x1_wstr2x2_in1x1x4x1_nopad_split2) {
     //  Filter : 1x1
     //  Stride : 2x2
@@ -1959,6 +2037,87 @@ TEST(convolution_gpu, relu_with_negative_slope) {
     EXPECT_FLOAT_EQ(5.0f, get_value<float>(output_ptr, 3));
 }
 
+TEST(convolution_gpu, scale_and_relu_fused_into_convolution) {
+
+    //  Filter : 2x2
+    //  Stride : 2x2
+    //  Input  : 4x4
+    //  Output : 2x2
+    //  Scale  : 2, shift 1, folded into the weights and the bias
+    //
+    //  Input:
+    //  -0.5   1     0.5  2
+    //   1.5  -0.5   0   -1
+    //   0.5   0.5  -1    1
+    //   0.5   2     1.5 -0.5
+    //
+    //  Filter
+    //  -2   0.5
+    //   3.5 1.5
+    //
+    //  Bias
+    //  -2
+    //
+    //  Output:
+    //  9  0
+    //  5  11
+
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::yxfb, { 1, 1, 4, 4 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+    auto biases = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 1, 1 } });
+    auto scale_input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 1, 1 } });
+    auto scale_shift = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 1, 1 } });
+
+    set_values(input, {
+        -0.5f,  1.0f,  0.5f,  2.0f,
+        1.5f, -0.5f,  0.0f, -1.0f,
+        0.5f,  0.5f, -1.0f,  1.0f,
+        0.5f,  2.0f,  1.5f, -0.5f
+    });
+    set_values(weights, { -2.0f, 0.5f, 3.5f, 1.5f });
+    set_values(biases, { -2.0f });
+    set_values(scale_input, { 2.0f });
+    set_values(scale_shift, { 1.0f });
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("biases", biases),
+        data("scale_input", scale_input),
+        data("scale_shift", scale_shift),
+        convolution("conv", "input", { "weights" }, { "biases" }, { 1,1,2,2 }),
+        scale("scale", "conv", "scale_input", "scale_shift"),
+        activation("relu", "scale", activation_relu)
+    );
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    network network(engine, topology, bo);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "relu");
+
+    auto executed = network.get_executed_primitive_ids();
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "scale"), executed.end());
+
+    auto output_prim = outputs.begin()->second.get_memory();
+
+    auto output_ptr = output_prim.pointer<float>();
+
+    EXPECT_FLOAT_EQ(9.0f, get_value<float>(output_ptr, 0));
+    EXPECT_FLOAT_EQ(0.0f, get_value<float>(output_ptr, 1));
+    EXPECT_FLOAT_EQ(5.0f, get_value<float>(output_ptr, 2));
+    EXPECT_FLOAT_EQ(11.0f, get_value<float>(output_ptr, 3));
+
+    // the user memory of the weights stays as it was
+    auto weights_ptr = weights.pointer<float>();
+    EXPECT_FLOAT_EQ(-2.0f, weights_ptr[0]);
+}
+
 TEST(convolution_gpu, DISABLED_two_1x1_kernels_after_each_other) {
 
     engine engine;
@@ -360,3 +360,64 @@ TEST(crop_gpu, basic_in1x4x1x1_split_w_relu) {
         EXPECT_EQ(output_ptr_2[i], out2[i]);
 }
 
+
+TEST(crop_gpu, basic_in2x1x2x2_batch_and_spatial_crops_in_place) {
+    // Tests the crops across the batch and the spatial axes executed as views of their input
+    //                        _ CROP_1(1x1x2x2,offset(1x0x0x0)) --> RELU
+    //                       |
+    //  INPUT(2x1x2x2)--RELU
+    //                       |_
+    //                          CROP_2(2x1x1x2,offset(0x0x1x0)) --> RELU
+    //
+    //  Input (bfyx):
+    //  b0: -1.0  2.0    b1:  5.0 -6.0
+    //      -3.0  4.0         7.0 -8.0
+
+    //  Out1:
+    //  5.0 0.0
+    //  7.0 0.0
+
+    //  Out2:
+    //  b0: 2.0 4.0
+    //  b1: 0.0 0.0
+    // disable memory pool when we want to check optimized out internal results
+    engine_configuration cfg{ false, false, false, std::string(), std::string(), true /*oooq*/, std::string(),std::string(), priority_mode_types::disabled,  throttle_mode_types::disabled, false /*mem_pool*/ };
+    engine engine{ cfg };
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ tensor(spatial(2, 2), feature(1), batch(2)) } });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("relu", "input", activation_relu));
+    topology.add(crop("crop1", "relu", tensor(batch(1), spatial(2, 2), feature(1)), { tensor(feature(0), spatial(0, 0), batch(1)) }));
+    topology.add(crop("crop2", "relu", tensor(batch(2), spatial(1, 2), feature(1)), { tensor(feature(0), spatial(1, 0), batch(0)) }));
+    topology.add(activation("relu1", "crop1", activation_relu));
+    topology.add(activation("relu2", "crop2", activation_relu));
+
+    std::vector<float> input_vec = { -1.f, 2.f, -3.f, 4.f, 5.f, -6.f, 7.f, -8.f };
+    std::vector<float> out1 = { 5.f, 0.f, 7.f, 0.f };
+    std::vector<float> out2 = { 2.f, 4.f, 0.f, 0.f };
+    set_values(input, input_vec);
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    bo.set_option(build_option::debug(true)); //required to have optimized crop despite the fact that it's specified as an output
+
+    network network(engine, topology, bo);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    // check if crops have been executed in place
+    EXPECT_TRUE(outputs.at("crop1").get_memory().is_the_same_buffer(outputs.at("relu").get_memory()));
+    EXPECT_TRUE(outputs.at("crop2").get_memory().is_the_same_buffer(outputs.at("relu").get_memory()));
+
+    auto output = outputs.at("relu1").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    for (size_t i = 0; i < out1.size(); i++)
+        EXPECT_EQ(output_ptr[i], out1[i]);
+
+    auto output_2 = outputs.at("relu2").get_memory();
+    auto output_ptr_2 = output_2.pointer<float>();
+
+    for (size_t i = 0; i < out2.size(); i++)
+        EXPECT_EQ(output_ptr_2[i], out2[i]);
+}
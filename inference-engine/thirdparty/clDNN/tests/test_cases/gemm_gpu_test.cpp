@@ -0,0 +1,184 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include "api/CPP/gemm.hpp"
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+std::vector<float> make_values(size_t count, int seed) {
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; i++)
+        values[i] = static_cast<float>(static_cast<int>((i * 7 + seed) % 13) - 6) * 0.125f;
+    return values;
+}
+
+// alpha * op(input0) * op(input1) + beta * input2 over the bfyx matrices, the batch and the matrix of input2 of size 1
+// are broadcast
+std::vector<float> ref_gemm(const std::vector<float>& input0, const tensor& size0, bool transpose0,
+                            const std::vector<float>& input1, const tensor& size1, bool transpose1,
+                            const std::vector<float>* input2, const tensor& size2,
+                            float alpha, float beta, const tensor& output_size) {
+    const int B = output_size.batch[0], F = output_size.feature[0];
+    const int M = output_size.spatial[1], N = output_size.spatial[0];
+    const int K = transpose0 ? size0.spatial[1] : size0.spatial[0];
+
+    auto at = [](const std::vector<float>& values, const tensor& size, int b, int f, int y, int x) {
+        b = size.batch[0] == 1 ? 0 : b;
+        f = size.feature[0] == 1 ? 0 : f;
+        y = size.spatial[1] == 1 ? 0 : y;
+        x = size.spatial[0] == 1 ? 0 : x;
+        return values[((b * size.feature[0] + f) * size.spatial[1] + y) * size.spatial[0] + x];
+    };
+
+    std::vector<float> output(output_size.count());
+    for (int b = 0; b < B; b++) {
+        for (int f = 0; f < F; f++) {
+            for (int m = 0; m < M; m++) {
+                for (int n = 0; n < N; n++) {
+                    float acc = 0.f;
+                    for (int k = 0; k < K; k++) {
+                        acc += (transpose0 ? at(input0, size0, b, f, k, m) : at(input0, size0, b, f, m, k)) *
+                               (transpose1 ? at(input1, size1, b, f, n, k) : at(input1, size1, b, f, k, n));
+                    }
+                    float value = alpha * acc;
+                    if (input2)
+                        value += beta * at(*input2, size2, b, f, m, n);
+                    output[((b * F + f) * M + m) * N + n] = value;
+                }
+            }
+        }
+    }
+    return output;
+}
+
+void test_gemm(const tensor& size0, bool transpose0, const tensor& size1, bool transpose1,
+               const tensor* size2, float alpha, float beta, const tensor& output_size) {
+    engine engine;
+
+    auto input0 = memory::allocate(engine, { data_types::f32, format::bfyx, size0 });
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, size1 });
+    auto values0 = make_values(size0.count(), 1);
+    auto values1 = make_values(size1.count(), 5);
+    set_values(input0, values0);
+    set_values(input1, values1);
+
+    topology topology;
+    topology.add(input_layout("input0", input0.get_layout()));
+    topology.add(input_layout("input1", input1.get_layout()));
+    std::vector<primitive_id> inputs = { "input0", "input1" };
+
+    std::vector<float> values2;
+    if (size2) {
+        values2 = make_values(size2->count(), 9);
+        topology.add(input_layout("input2", { data_types::f32, format::bfyx, *size2 }));
+        inputs.push_back("input2");
+    }
+    topology.add(gemm("gemm", inputs, transpose0, transpose1, alpha, beta));
+
+    network network(engine, topology);
+    network.set_input_data("input0", input0);
+    network.set_input_data("input1", input1);
+    if (size2) {
+        auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, *size2 });
+        set_values(input2, values2);
+        network.set_input_data("input2", input2);
+    }
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "gemm");
+
+    auto output = outputs.at("gemm").get_memory();
+    ASSERT_EQ(output_size, output.get_layout().size);
+    auto output_ptr = output.pointer<float>();
+
+    auto ref = ref_gemm(values0, size0, transpose0, values1, size1, transpose1, size2 ? &values2 : nullptr,
+                        size2 ? *size2 : tensor(), alpha, beta, output_size);
+    for (size_t i = 0; i < ref.size(); i++) {
+        EXPECT_NEAR(ref[i], output_ptr[i], 1e-5f) << "index " << i;
+    }
+}
+}  // namespace
+
+TEST(gemm_gpu, basic_2x3_by_3x2) {
+    //  Input0 : 1x1x2x3 (rows x columns)
+    //  Input1 : 1x1x3x2
+    //  Output : 1x1x2x2
+    engine engine;
+
+    auto input0 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 3, 2 } });
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 3 } });
+    set_values(input0, { 1.f, 2.f, 3.f,
+                         4.f, 5.f, 6.f });
+    set_values(input1, { 1.f, -1.f,
+                         0.f, 2.f,
+                         -2.f, 0.5f });
+
+    topology topology;
+    topology.add(input_layout("input0", input0.get_layout()));
+    topology.add(input_layout("input1", input1.get_layout()));
+    topology.add(gemm("gemm", { "input0", "input1" }));
+
+    network network(engine, topology);
+    network.set_input_data("input0", input0);
+    network.set_input_data("input1", input1);
+    auto outputs = network.execute();
+
+    auto output = outputs.at("gemm").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    std::vector<float> expected = { -5.f, 4.5f,
+                                    -8.f, 9.f };
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_FLOAT_EQ(expected[i], output_ptr[i]);
+    }
+}
+
+TEST(gemm_gpu, transpose_input0) {
+    test_gemm({ 2, 3, 3, 4 }, true, { 2, 3, 5, 4 }, false, nullptr, 0.5f, 0.f, { 2, 3, 5, 3 });
+}
+
+TEST(gemm_gpu, transpose_input1) {
+    test_gemm({ 2, 3, 4, 3 }, false, { 2, 3, 4, 5 }, true, nullptr, 1.f, 0.f, { 2, 3, 5, 3 });
+}
+
+TEST(gemm_gpu, transpose_both) {
+    test_gemm({ 1, 2, 3, 4 }, true, { 1, 2, 4, 5 }, true, nullptr, 2.f, 0.f, { 1, 2, 5, 3 });
+}
+
+TEST(gemm_gpu, broadcast_batch) {
+    // the heads of input0 against the one matrix of input1 per batch
+    test_gemm({ 2, 4, 4, 3 }, false, { 2, 1, 5, 4 }, false, nullptr, 1.f, 0.f, { 2, 4, 5, 3 });
+    test_gemm({ 1, 3, 4, 3 }, false, { 2, 3, 5, 4 }, false, nullptr, 1.f, 0.f, { 2, 3, 5, 3 });
+}
+
+TEST(gemm_gpu, input2_with_beta) {
+    tensor full(2, 3, 5, 3);
+    test_gemm({ 2, 3, 4, 3 }, false, { 2, 3, 5, 4 }, false, &full, 1.f, 0.5f, { 2, 3, 5, 3 });
+
+    // a row of input2 broadcast to the rows and the batch of the output
+    tensor row(1, 1, 5, 1);
+    test_gemm({ 2, 3, 3, 4 }, true, { 2, 3, 5, 4 }, false, &row, 0.25f, 2.f, { 2, 3, 5, 3 });
+}
@@ -642,6 +642,14 @@ TEST(lstm_gpu, generic_lstm_offset_order_ifoz_f32) {
     default_offset_type = cldnn_lstm_offset_order_iofz;
 }
 
+TEST(lstm_gpu, generic_lstm_long_sequence_f32) {
+    generic_lstm_gpu_test<float>(200, 1, 2, 8, 4, true, true, true);
+}
+
+TEST(lstm_gpu, generic_lstm_hidden_above_work_group_f32) {
+    generic_lstm_gpu_test<float>(4, 1, 2, 16, 300, true, true, true);
+}
+
 // TODO: Add tests for the following:
 // optional concatenate output
 // optional last hidden
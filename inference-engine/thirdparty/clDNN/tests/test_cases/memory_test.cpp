@@ -409,4 +409,32 @@ TEST(memory_pool, shared_mem_pool_diff_batches) {
     auto outputs_second = network_second.execute();
 
     EXPECT_EQ(engine.get_max_used_device_memory_size(), (uint64_t)3928);
-}
\ No newline at end of file
+}
+
+TEST(memory_pool, host_memory_roundtrip) {
+    // the pinned host memory of the discrete devices is copied to and from the device memory,
+    // the devices sharing the host memory allocate the engine memory instead
+
+    engine_configuration cfg{ false, false, false, std::string(), std::string(), true /*oooq*/ };
+    engine engine{ cfg };
+
+    auto input = memory::allocate_host(engine, { data_types::f32, format::bfyx,{ 1, 1, 2, 2 } });
+    set_values(input, { 1.0f, -2.0f, 3.0f, -4.0f });
+
+    topology topology{
+        input_layout("input", input.get_layout()),
+        activation("relu", "input", activation_relu)
+    };
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    auto output = memory::allocate_host(engine, { data_types::f32, format::bfyx,{ 1, 1, 2, 2 } });
+    outputs.at("relu").get_memory().copy_to(output);
+
+    std::vector<float> expected = { 1.0f, 0.0f, 3.0f, 0.0f };
+    auto ptr = output.pointer<float>();
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_EQ(ptr[i], expected[i]);
+}
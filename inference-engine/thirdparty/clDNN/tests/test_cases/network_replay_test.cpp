@@ -0,0 +1,84 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/reorder.hpp>
+
+#include "test_utils/test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+    topology subtract_chain(const layout& lay)
+    {
+        // out = in - 1 - 2 - 3, only the last reorder has an event
+        topology tpl;
+        tpl.add(input_layout("in", lay));
+        tpl.add(reorder("r0", "in", lay, std::vector<float>{ 1 }));
+        tpl.add(reorder("r1", "r0", lay, std::vector<float>{ 2 }));
+        tpl.add(reorder("r2", "r1", lay, std::vector<float>{ 3 }));
+        return tpl;
+    }
+}
+
+TEST(network_replay, same_input_memory)
+{
+    engine eng;
+
+    auto input_mem = memory::allocate(eng, layout{ data_types::f32, format::bfyx, { 1, 1, 2, 1 } });
+    network net{ eng, subtract_chain(input_mem.get_layout()) };
+
+    for (int run = 0; run < 4; ++run)
+    {
+        // the content of the memory changes, the memory stays the same so the runs after the first one are replayed
+        set_values(input_mem, { 10.f + run, 20.f + run });
+        net.set_input_data("in", input_mem);
+        auto output = net.execute().at("r2").get_memory();
+        auto output_ptr = output.pointer<float>();
+
+        EXPECT_FLOAT_EQ(4.f + run, output_ptr[0]);
+        EXPECT_FLOAT_EQ(14.f + run, output_ptr[1]);
+    }
+}
+
+TEST(network_replay, new_input_memory)
+{
+    engine eng;
+
+    layout lay{ data_types::f32, format::bfyx, { 1, 1, 2, 1 } };
+    network net{ eng, subtract_chain(lay) };
+
+    for (int run = 0; run < 4; ++run)
+    {
+        // a new memory on every run, the recorded kernels must not read the previous one
+        auto input_mem = memory::allocate(eng, lay);
+        set_values(input_mem, { 10.f * run, -10.f * run });
+        net.set_input_data("in", input_mem);
+        auto output = net.execute().at("r2").get_memory();
+        auto output_ptr = output.pointer<float>();
+
+        EXPECT_FLOAT_EQ(10.f * run - 6.f, output_ptr[0]);
+        EXPECT_FLOAT_EQ(-10.f * run - 6.f, output_ptr[1]);
+    }
+}
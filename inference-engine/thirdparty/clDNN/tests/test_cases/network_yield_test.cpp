@@ -0,0 +1,76 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/reorder.hpp>
+
+#include "test_utils/test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+    void count_yield(void* param)
+    {
+        ++*static_cast<int*>(param);
+    }
+}
+
+TEST(network_yield, handler_called_between_slices)
+{
+    engine eng;
+
+    layout lay{ data_types::f32, format::bfyx, { 1, 1, 2, 1 } };
+    topology tpl;
+    tpl.add(input_layout("in", lay));
+    tpl.add(reorder("r0", "in", lay, std::vector<float>{ 1 }));
+    tpl.add(reorder("r1", "r0", lay, std::vector<float>{ 2 }));
+    tpl.add(reorder("r2", "r1", lay, std::vector<float>{ 3 }));
+    tpl.add(reorder("r3", "r2", lay, std::vector<float>{ 4 }));
+
+    network net{ eng, tpl };
+    int yields = 0;
+    net.set_yield_handler(&count_yield, &yields, 1);
+
+    auto input_mem = memory::allocate(eng, lay);
+    for (int run = 0; run < 2; ++run)
+    {
+        // the second run replays the recorded kernels, the slices are kept
+        set_values(input_mem, { 10.f, 20.f });
+        net.set_input_data("in", input_mem);
+        int before = yields;
+        auto output = net.execute().at("r3").get_memory();
+        auto output_ptr = output.pointer<float>();
+
+        EXPECT_GT(yields, before);
+        EXPECT_FLOAT_EQ(0.f, output_ptr[0]);
+        EXPECT_FLOAT_EQ(10.f, output_ptr[1]);
+    }
+
+    // no handler, no calls
+    net.set_yield_handler(nullptr, nullptr, 0);
+    int before = yields;
+    net.set_input_data("in", input_mem);
+    net.execute();
+    EXPECT_EQ(before, yields);
+}
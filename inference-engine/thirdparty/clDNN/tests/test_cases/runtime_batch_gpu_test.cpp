@@ -0,0 +1,108 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include "api/CPP/activation.hpp"
+#include "api/CPP/eltwise.hpp"
+#include "api/CPP/arg_max_min.hpp"
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+// the sizes are not multiples of 4 so that the reference activation and eltwise kernels are selected
+const int32_t x_size = 3, y_size = 3, feature_num = 3, max_batch = 3;
+
+topology make_relu_sum_topology(const layout& input_layout_desc) {
+    topology topology(
+        input_layout("input", input_layout_desc),
+        activation("relu", "input", activation_relu_negative_slope, { 0.5f, 0.f }),
+        eltwise("sum", "input", "relu", eltwise_mode::sum));
+    return topology;
+}
+
+std::vector<float> make_input_values(size_t count) {
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; i++)
+        values[i] = static_cast<float>(static_cast<int>(i % 11) - 5) * 0.25f;
+    return values;
+}
+}  // namespace
+
+TEST(runtime_batch_gpu, relu_sum_matches_per_batch_networks) {
+    engine engine;
+
+    const size_t batch_size = feature_num * y_size * x_size;
+    auto values = make_input_values(max_batch * batch_size);
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { max_batch, feature_num, x_size, y_size } });
+    set_values(input, values);
+
+    network network(engine, make_relu_sum_topology(input.get_layout()));
+    ASSERT_TRUE(network.supports_runtime_batch());
+
+    for (int32_t batch = 1; batch <= max_batch; batch++) {
+        network.set_batch(static_cast<uint32_t>(batch));
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+        auto output = outputs.at("sum").get_memory();
+        auto output_ptr = output.pointer<float>();
+
+        auto ref_input = memory::allocate(engine, { data_types::f32, format::bfyx, { batch, feature_num, x_size, y_size } });
+        set_values(ref_input, std::vector<float>(values.begin(), values.begin() + batch * batch_size));
+        cldnn::network ref_network(engine, make_relu_sum_topology(ref_input.get_layout()));
+        ref_network.set_input_data("input", ref_input);
+        auto ref_outputs = ref_network.execute();
+        auto ref_output = ref_outputs.at("sum").get_memory();
+        auto ref_ptr = ref_output.pointer<float>();
+
+        for (size_t i = 0; i < batch * batch_size; i++) {
+            EXPECT_FLOAT_EQ(ref_ptr[i], output_ptr[i]) << "batch " << batch << " index " << i;
+        }
+    }
+
+    // the full batch is restored after running the smaller ones
+    network.set_batch(max_batch);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+    auto output_ptr = outputs.at("sum").get_memory().pointer<float>();
+    for (size_t i = 0; i < values.size(); i++) {
+        const float relu = values[i] > 0.f ? values[i] : values[i] * 0.5f;
+        EXPECT_FLOAT_EQ(values[i] + relu, output_ptr[i]);
+    }
+}
+
+TEST(runtime_batch_gpu, not_supported_for_kernels_looping_over_batch) {
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { max_batch, feature_num, x_size, y_size } });
+    set_values(input, make_input_values(max_batch * feature_num * y_size * x_size));
+
+    // the batch axis kernel reduces over the whole batch in every work item
+    topology topology(
+        input_layout("input", input.get_layout()),
+        arg_max_min("arg_max", "input", arg_max_min::max, 1, arg_max_min::batch));
+
+    network network(engine, topology);
+    EXPECT_FALSE(network.supports_runtime_batch());
+    EXPECT_ANY_THROW(network.set_batch(1));
+}
@@ -66,6 +66,16 @@ struct cpu_inner_product_fwd_pd_t: public inner_product_fwd_pd_t {
         , bias_pd_(engine_, &desc_.bias_desc) {}
     virtual ~cpu_inner_product_fwd_pd_t() {}
 
+    /* the only supported attribute is a single eltwise post-op, which is
+     * applied to the result of the inner product */
+    bool attr_ok() const {
+        const auto &p = this->attr()->post_ops_;
+        return true
+            && this->attr()->round_mode_ == round_mode::nearest
+            && this->attr()->output_scales_.has_default_values()
+            && (p.len_ == 0 || (p.len_ == 1 && p.entry_[0].is_eltwise()));
+    }
+
     virtual const cpu_memory_pd_t *src_pd(int index = 0) const override
     { return index == 0 ? &src_pd_ : nullptr; }
     virtual const cpu_memory_pd_t *dst_pd(int index = 0) const override
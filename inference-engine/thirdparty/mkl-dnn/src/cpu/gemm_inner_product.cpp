@@ -19,6 +19,7 @@
 #include "mkldnn_thread.hpp"
 
 #include "gemm_inner_product.hpp"
+#include "ref_eltwise.hpp"
 #include "os_blas.hpp"
 
 /* TODO: check if jit gemm should be made available for inner_product
@@ -102,6 +103,15 @@ void gemm_inner_product_fwd_t<data_type>::execute_forward() {
 #       pragma omp parallel for schedule(static)
         for (cblas_int mb = 0; mb < MB; mb++)
             cblas_axpy<data_type>(OC, 1.0, bias, 1, dst + dst_d.blk_off(mb), 1);
+
+    const auto &post_ops = conf_.attr()->post_ops_;
+    if (post_ops.len_ == 1) {
+        const auto &e = post_ops.entry_[0].eltwise;
+        ref_eltwise_scalar_fwd_t eltwise(e.alg, e.alpha, e.beta);
+#       pragma omp parallel for schedule(static)
+        for (int i = 0; i < MB * OC; i++)
+            dst[i] = eltwise.compute_scalar(dst[i]);
+    }
 #endif
 }
 
@@ -27,6 +27,7 @@
 #include "mkldnn_thread.hpp"
 #include "utils.hpp"
 #include "jit_uni_depthwise.hpp"
+#include "jit_kernel_cache.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -123,7 +124,8 @@ struct _jit_avx2_1x1_convolution_fwd_t: public cpu_primitive_t {
         , kernel_(nullptr), rtus_driver_(nullptr), ws_per_thread_(0)
         , scratch_(nullptr), dw_conv_buffer_size_(0), dw_conv_buffer_(nullptr)
     {
-        kernel_ = new jit_avx2_1x1_conv_kernel_f32(conf_.jcp_, *conf_.attr());
+        kernel_ = get_jit_kernel<jit_avx2_1x1_conv_kernel_f32>(
+                conf_.jcp_, *conf_.attr());
         if (conf_.jcp_.with_dw_conv) {
             kernel_dw_ = new jit_uni_dw_conv_row_f32<avx2>(conf_.jcp_dw);
         }
@@ -139,7 +141,6 @@ struct _jit_avx2_1x1_convolution_fwd_t: public cpu_primitive_t {
         }
     }
     ~_jit_avx2_1x1_convolution_fwd_t() {
-        delete kernel_;
         delete rtus_driver_;
         free(scratch_);
 
@@ -165,7 +166,7 @@ private:
     void execute_forward_fusing();
 
     pd_t conf_;
-    jit_avx2_1x1_conv_kernel_f32 *kernel_;
+    std::shared_ptr<jit_avx2_1x1_conv_kernel_f32> kernel_;
     jit_uni_dw_conv_row_f32<avx2> *kernel_dw_;
 
     /* reduction to unit stride */
@@ -25,6 +25,7 @@
 #include "jit_avx2_conv_kernel_f32.hpp"
 #include "mkldnn_thread.hpp"
 #include "jit_uni_depthwise.hpp"
+#include "jit_kernel_cache.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -110,7 +111,8 @@ struct _jit_avx2_convolution_fwd_t: public cpu_primitive_t {
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd),
           dw_conv_buffer_size_(0), dw_conv_buffer_(nullptr)
     {
-        kernel_ = new jit_avx2_conv_fwd_kernel_f32(conf_.jcp_, *conf_.attr());
+        kernel_ = get_jit_kernel<jit_avx2_conv_fwd_kernel_f32>(
+                conf_.jcp_, *conf_.attr());
         if (conf_.jcp_.with_dw_conv) {
             kernel_dw_ = new jit_uni_dw_conv_row_f32<avx2>(conf_.jcp_dw);
         }
@@ -124,8 +126,6 @@ struct _jit_avx2_convolution_fwd_t: public cpu_primitive_t {
     }
 
     ~_jit_avx2_convolution_fwd_t() {
-        delete kernel_;
-
         if (conf_.jcp_.with_dw_conv) {
             delete kernel_dw_;
             free(dw_conv_buffer_);
@@ -148,7 +148,7 @@ private:
     void execute_forward_fusing();
 
     pd_t conf_;
-    jit_avx2_conv_fwd_kernel_f32 *kernel_;
+    std::shared_ptr<jit_avx2_conv_fwd_kernel_f32> kernel_;
     jit_uni_dw_conv_row_f32<avx2> *kernel_dw_;
 
     /* fuse with dw conv */
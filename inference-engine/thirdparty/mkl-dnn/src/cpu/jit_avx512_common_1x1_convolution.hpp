@@ -24,6 +24,7 @@
 #include "jit_avx512_common_1x1_conv_kernel.hpp"
 #include "jit_uni_1x1_conv_utils.hpp"
 #include "jit_transpose_src_utils.hpp"
+#include "jit_kernel_cache.hpp"
 #include "mkldnn_thread.hpp"
 #include "utils.hpp"
 
@@ -118,8 +119,8 @@ struct _jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
         , kernel_(nullptr), rtus_driver_(nullptr), ws_per_thread_(0)
         , scratch_(nullptr), padded_bias_(nullptr)
     {
-        kernel_ = new jit_avx512_common_1x1_conv_kernel(conf_.jcp_,
-                    *conf_.attr());
+        kernel_ = get_jit_kernel<jit_avx512_common_1x1_conv_kernel>(
+                conf_.jcp_, *conf_.attr());
 
         init_rtus_driver<avx512_common>(this);
 
@@ -133,7 +134,6 @@ struct _jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
     }
 
     ~_jit_avx512_common_1x1_convolution_fwd_t() {
-        delete kernel_;
         delete rtus_driver_;
         free(scratch_);
         free(padded_bias_);
@@ -151,7 +151,7 @@ struct _jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
   private:
     void execute_forward();
     pd_t conf_;
-    jit_avx512_common_1x1_conv_kernel *kernel_;
+    std::shared_ptr<jit_avx512_common_1x1_conv_kernel> kernel_;
     /* reduction to unit stride */
     rtus_driver_t<avx512_common> *rtus_driver_;
     size_t ws_per_thread_;
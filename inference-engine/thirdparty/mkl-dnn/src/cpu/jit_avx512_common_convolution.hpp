@@ -22,6 +22,7 @@
 #include "cpu_engine.hpp"
 #include "jit_avx512_common_conv_kernel.hpp"
 #include "jit_transpose_src_utils.hpp"
+#include "jit_kernel_cache.hpp"
 #include "cpu_reducer.hpp"
 #include "cpu_barrier.hpp"
 
@@ -83,8 +84,8 @@ struct _jit_avx512_common_convolution_fwd_t : public cpu_primitive_t {
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
         , padded_bias_(nullptr)
     {
-        kernel_ = new jit_avx512_common_conv_fwd_kernel(conf_.jcp_,
-                    *conf_.attr());
+        kernel_ = get_jit_kernel<jit_avx512_common_conv_fwd_kernel>(
+                conf_.jcp_, *conf_.attr());
 
         if (conf_.want_padded_bias()) {
             const auto &j = conf_.jcp_;
@@ -95,7 +96,6 @@ struct _jit_avx512_common_convolution_fwd_t : public cpu_primitive_t {
         }
     }
     ~_jit_avx512_common_convolution_fwd_t() {
-        delete kernel_;
         free(padded_bias_);
     };
 
@@ -114,7 +114,7 @@ private:
     void execute_forward();
     void execute_forward_3d();
     pd_t conf_;
-    jit_avx512_common_conv_fwd_kernel *kernel_;
+    std::shared_ptr<jit_avx512_common_conv_fwd_kernel> kernel_;
     dst_data_t *padded_bias_;
 };
 
@@ -298,7 +298,6 @@ struct jit_avx512_common_convolution_bwd_weights_t: public cpu_primitive_t {
     jit_avx512_common_convolution_bwd_weights_t(const pd_t *pd,
             const input_vector &inputs, const output_vector &outputs);
     ~jit_avx512_common_convolution_bwd_weights_t() {
-
         delete kernel_;
         if (trans_kernel_)
             delete trans_kernel_;
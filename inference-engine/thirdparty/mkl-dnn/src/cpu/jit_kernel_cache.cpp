@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <mutex>
+#include <unordered_map>
+
+#include "jit_kernel_cache.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+std::shared_ptr<void> find_or_create_jit_kernel(const std::string &key,
+        const std::function<std::shared_ptr<void>()> &create) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::weak_ptr<void>> kernels;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = kernels.find(key);
+        if (found != kernels.end()) {
+            auto kernel = found->second.lock();
+            if (kernel) return kernel;
+        }
+    }
+
+    /* the generation takes long, the primitives are created in parallel, so
+     * it goes outside of the lock, the first stored kernel wins */
+    auto kernel = create();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = kernels.begin(); it != kernels.end();) {
+        if (it->second.expired()) it = kernels.erase(it);
+        else ++it;
+    }
+    auto &stored = kernels[key];
+    auto existing = stored.lock();
+    if (existing) return existing;
+    stored = kernel;
+    return kernel;
+}
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
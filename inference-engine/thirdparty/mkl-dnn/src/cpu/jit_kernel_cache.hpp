@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CPU_JIT_KERNEL_CACHE_HPP
+#define CPU_JIT_KERNEL_CACHE_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/* Process-wide storage of the generated jit kernels. A kernel is immutable once
+ * generated and gets the data through its call parameters, so the primitives
+ * with the same configuration (e.g. the same convolution shapes in different
+ * layers or different networks) share one kernel. The kernel lives as long as
+ * any primitive uses it. */
+std::shared_ptr<void> find_or_create_jit_kernel(const std::string &key,
+        const std::function<std::shared_ptr<void>()> &create);
+
+/* Returns the kernel of the type generated for the configuration. The bytes of
+ * the configuration make the key, so only the kernels generating the code from
+ * the configuration alone may be shared: the attributes are passed to the
+ * constructor of the kernel but not compared, the kernels reading the post ops
+ * of the attributes (e.g. the int8 ones) keep creating their own code */
+template <typename kernel_t, typename conf_t, typename... args_t>
+std::shared_ptr<kernel_t> get_jit_kernel(const conf_t &conf,
+        const args_t &... args) {
+    static_assert(std::is_pod<conf_t>::value,
+            "the configuration of the kernel is compared bytewise");
+    std::string key(typeid(kernel_t).name());
+    key.append(reinterpret_cast<const char *>(&conf), sizeof(conf));
+    return std::static_pointer_cast<kernel_t>(find_or_create_jit_kernel(key,
+            [&]() { return std::make_shared<kernel_t>(conf, args...); }));
+}
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -23,6 +23,7 @@
 #include "jit_primitive_conf.hpp"
 #include "jit_sse42_conv_kernel_f32.hpp"
 #include "jit_uni_depthwise.hpp"
+#include "jit_kernel_cache.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -109,7 +110,8 @@ struct _jit_sse42_convolution_fwd_t: public cpu_primitive_t {
           dw_conv_buffer_size_(0), dw_conv_buffer_(nullptr)
 
     {
-        kernel_ = new jit_sse42_conv_fwd_kernel_f32(conf_.jcp_, *conf_.attr());
+        kernel_ = get_jit_kernel<jit_sse42_conv_fwd_kernel_f32>(
+                conf_.jcp_, *conf_.attr());
         if (conf_.jcp_.with_dw_conv) {
             kernel_dw_ = new jit_uni_dw_conv_row_f32<sse42>(conf_.jcp_dw);
         }
@@ -123,8 +125,6 @@ struct _jit_sse42_convolution_fwd_t: public cpu_primitive_t {
     }
 
     ~_jit_sse42_convolution_fwd_t() {
-        delete kernel_;
-
         if (conf_.jcp_.with_dw_conv) {
             delete kernel_dw_;
             free(dw_conv_buffer_);
@@ -147,7 +147,7 @@ private:
     void execute_forward_fusing();
 
     pd_t conf_;
-    jit_sse42_conv_fwd_kernel_f32 *kernel_;
+    std::shared_ptr<jit_sse42_conv_fwd_kernel_f32> kernel_;
     jit_uni_dw_conv_row_f32<sse42> *kernel_dw_;
 
     /* fuse with dw conv */
@@ -22,6 +22,7 @@
 #include "cpu_engine.hpp"
 #include "jit_primitive_conf.hpp"
 #include "jit_uni_dw_conv_kernel_f32.hpp"
+#include "jit_kernel_cache.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -89,7 +90,8 @@ struct _jit_uni_dw_convolution_fwd_t: public cpu_primitive_t {
             const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
         , padded_bias_(nullptr) {
-        kernel_ = new jit_uni_dw_conv_fwd_kernel_f32<isa>(conf_.jcp_);
+        kernel_ = get_jit_kernel<jit_uni_dw_conv_fwd_kernel_f32<isa>>(
+                conf_.jcp_);
         if (conf_.want_padded_bias()) {
             padded_bias_ = (float *)malloc(sizeof(float) * conf_.jcp_.oc, 64);
             for (int c = conf_.jcp_.oc_without_padding; c < conf_.jcp_.oc; ++c)
@@ -98,7 +100,6 @@ struct _jit_uni_dw_convolution_fwd_t: public cpu_primitive_t {
     }
 
     ~_jit_uni_dw_convolution_fwd_t() {
-        delete kernel_;
         free(padded_bias_);
     }
 
@@ -112,7 +113,7 @@ struct _jit_uni_dw_convolution_fwd_t: public cpu_primitive_t {
 private:
     void execute_forward();
     pd_t conf_;
-    jit_uni_dw_conv_fwd_kernel_f32<isa> *kernel_;
+    std::shared_ptr<jit_uni_dw_conv_fwd_kernel_f32<isa>> kernel_;
     float *padded_bias_;
 };
 
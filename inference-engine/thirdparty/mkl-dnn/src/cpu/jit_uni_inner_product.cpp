@@ -21,6 +21,7 @@
 #include "gemm/jit_avx2_gemm_f32.hpp"
 #include "gemm/jit_avx512_common_gemm_f32.hpp"
 #include "jit_uni_inner_product.hpp"
+#include "ref_eltwise.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -62,6 +63,15 @@ void jit_uni_inner_product_fwd_t<isa>::execute_forward()
     float alpha = 1.0, beta = 0.0;
     sgemm_->sgemm("T", "N", &OC, &MB, &IC, &alpha, weights, &IC, src, &IC, &beta,
             dst, &OC, bias);
+
+    const auto &post_ops = conf_.attr()->post_ops_;
+    if (post_ops.len_ == 1) {
+        const auto &e = post_ops.entry_[0].eltwise;
+        ref_eltwise_scalar_fwd_t eltwise(e.alg, e.alpha, e.beta);
+#       pragma omp parallel for schedule(static)
+        for (int i = 0; i < MB * OC; i++)
+            dst[i] = eltwise.compute_scalar(dst[i]);
+    }
 }
 
 template <cpu_isa_t isa>
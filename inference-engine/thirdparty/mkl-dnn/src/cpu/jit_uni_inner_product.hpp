@@ -58,7 +58,7 @@ struct jit_uni_inner_product_fwd_t : public cpu_primitive_t {
                 && everyone_is(data_type::f32, desc()->src_desc.data_type,
                         desc()->weights_desc.data_type,
                         desc()->dst_desc.data_type)
-                && attr()->has_default_values()
+                && this->attr_ok()
                 && implication(this->with_bias(),
                         data_type::f32 == desc()->bias_desc.data_type)
                 && dense_gemm_consitency_check(src_pd(), weights_pd(),
@@ -23,6 +23,7 @@
 #include "cpu_pooling_pd.hpp"
 #include "cpu_engine.hpp"
 #include "jit_uni_pool_kernel_f32.hpp"
+#include "jit_kernel_cache.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -95,9 +96,7 @@ struct jit_uni_pooling_fwd_t: public cpu_primitive_t {
     jit_uni_pooling_fwd_t(const pd_t *pd, const input_vector &inputs,
             const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
-    { kernel_ = new jit_uni_pool_kernel_f32<isa>(conf_.jpp_); }
-
-    ~jit_uni_pooling_fwd_t() { delete kernel_; }
+    { kernel_ = get_jit_kernel<jit_uni_pool_kernel_f32<isa>>(conf_.jpp_); }
 
     typedef typename prec_traits<data_type::f32>::type data_t;
 
@@ -111,7 +110,7 @@ private:
     void execute_forward();
     void execute_forward_3d();
     pd_t conf_;
-    jit_uni_pool_kernel_f32<isa> *kernel_;
+    std::shared_ptr<jit_uni_pool_kernel_f32<isa>> kernel_;
 };
 
 template <cpu_isa_t isa>
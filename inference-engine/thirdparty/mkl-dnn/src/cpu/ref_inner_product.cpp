@@ -19,6 +19,7 @@
 #include "mkldnn_thread.hpp"
 
 #include "ref_inner_product.hpp"
+#include "ref_eltwise.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -75,6 +76,11 @@ void ref_inner_product_fwd_t<src_type, wei_type, dst_type, acc_type>
         }
     };
 
+    const auto &post_ops = conf_.attr()->post_ops_;
+    const bool with_eltwise = post_ops.len_ == 1;
+    const auto &e = post_ops.entry_[0].eltwise;
+    ref_eltwise_scalar_fwd_t eltwise(e.alg, e.alpha, e.beta);
+
 #   pragma omp parallel for collapse(2) schedule(static)
     for (int mb = 0; mb < MB; ++mb) {
         for (int oc = 0; oc < OC; ++oc) {
@@ -84,6 +90,8 @@ void ref_inner_product_fwd_t<src_type, wei_type, dst_type, acc_type>
             } else {
                 ker_no_spatial(a, mb, oc);
             }
+            if (with_eltwise)
+                a = (acc_data_t)eltwise.compute_scalar((float)a);
             dst[dst_d.off(mb, oc)] = (dst_data_t)a;
         }
     }
@@ -54,7 +54,7 @@ struct ref_inner_product_fwd_t: public cpu_primitive_t {
                 && desc()->dst_desc.data_type == dst_type
                 && utils::implication(this->with_bias(),
                         desc()->bias_desc.data_type == dst_type)
-                && attr()->has_default_values();
+                && this->attr_ok();
             return ok ? status::success : status::unimplemented;
         }
     };
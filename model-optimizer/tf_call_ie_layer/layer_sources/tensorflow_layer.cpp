@@ -19,6 +19,7 @@
 #include "tensorflow/core/public/session.h"
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/cc/ops/standard_ops.h"
+#include "tensorflow/core/framework/allocator.h"
 
 #include "tensorflow_layer.h"
 #include <algorithm>
@@ -28,6 +29,8 @@
 #include <vector>
 #include <cstdio>
 #include <cmath>
+#include <cstdint>
+#include <memory>
 
 using namespace IECustomExtension;
 using namespace InferenceEngine;
@@ -75,6 +78,41 @@ Status loadGraphDefFromString(const string& protobuf, Session* session)
     return status;
 }
 
+/**
+* \brief Allocator handing the memory of an IE blob to a single TF tensor, so the tensor reads and writes the blob in
+* place. Tensor has no public constructor taking a TensorBuffer, so the buffer of the tensor is created through it.
+* The allocator must outlive the tensor and all the tensors sharing its buffer.
+*/
+class BlobMemoryAllocator : public Allocator
+{
+public:
+    BlobMemoryAllocator(void* data, size_t size) : _data(data), _size(size) {}
+
+    string Name() override { return "ie_blob"; }
+
+    void* AllocateRaw(size_t alignment, size_t num_bytes) override
+    {
+        if (_handed || num_bytes > _size || reinterpret_cast<uintptr_t>(_data) % alignment != 0)
+            return nullptr;
+        _handed = true;
+        return _data;
+    }
+
+    // the memory belongs to the blob
+    void DeallocateRaw(void* ptr) override {}
+
+private:
+    void* _data;
+    size_t _size;
+    bool _handed = false;
+};
+
+// The blobs of the plugin are aligned to the cache line, which satisfies the alignment of the Eigen kernels
+bool IsTensorAligned(const void* data)
+{
+    return reinterpret_cast<uintptr_t>(data) % Allocator::kAllocatorAlignment == 0;
+}
+
 tensorflow::TensorShape SizeVectorToTensorShape(const SizeVector& size_vector)
 {
     TensorShape shape;
@@ -101,6 +139,8 @@ void TensorflowLayer::Execute() noexcept {
     }
 
     // initialize input nodes with values provided by IE inputs
+    // the allocators are declared first, so they outlive the tensors over the blobs
+    vector<unique_ptr<BlobMemoryAllocator>> blob_allocators;
     vector<pair<string, tensorflow::Tensor>> tf_placeholders;
     vector<string> input_names = splitString(input_node_names, ' ', false);
     vector<string> output_tensors = splitString(output_tensors_names, ' ', false);
@@ -115,9 +155,25 @@ void TensorflowLayer::Execute() noexcept {
         vector<size_t> dims_int = vector<size_t>(dims_str.size());
         for(size_t j = 0; j < dims_int.size(); ++j)
             dims_int[j] = stoi(dims_str[j]);
-        tensorflow::Tensor t = tensorflow::Tensor(tensorflow::DataType::DT_FLOAT, TensorShape(SizeVectorToTensorShape(dims_int)));
+        TensorShape shape = SizeVectorToTensorShape(dims_int);
+        if (static_cast<size_t>(shape.num_elements()) != total_size) {
+            cerr << "Input " << input_name << " of " << total_size << " elements does not fit its TF shape "
+                 << shape.DebugString() << "\n";
+            return;
+        }
+
+        // the TF tensor is the IE blob itself, the nhwc blobs are already in the layout of the TF shape
+        if (IsTensorAligned(inputs[i].data)) {
+            blob_allocators.emplace_back(new BlobMemoryAllocator(inputs[i].data, total_size * sizeof(float)));
+            tensorflow::Tensor t(blob_allocators.back().get(), tensorflow::DataType::DT_FLOAT, shape);
+            if (t.IsInitialized() && t.flat<float>().data() == inputs[i].data) {
+                tf_placeholders.push_back(make_pair(input_name, t));
+                continue;
+            }
+        }
 
         // copy data from an IE blob to a TF tensor as FP32
+        tensorflow::Tensor t = tensorflow::Tensor(tensorflow::DataType::DT_FLOAT, shape);
         memcpy(t.flat<float>().data(), inputs[i].data, total_size * sizeof(float));
 
         tf_placeholders.push_back(make_pair(input_name, t));
@@ -143,20 +199,51 @@ void TensorflowLayer::Execute() noexcept {
         for (size_t i = 0; i < outputs[out_id].dims.size(); ++i)
             total_size *= outputs[out_id].dims[i];
 
-        DataType output_data_type = tf_outputs[out_id % tf_outputs.size()].dtype();
+        // Session::Run allocates the outputs, so they are copied once, the nhwc blobs take the TF layout as is
+        const tensorflow::Tensor& tf_output = tf_outputs[out_id % tf_outputs.size()];
+        DataType output_data_type = tf_output.dtype();
         if (output_data_type == DT_FLOAT)
-            memcpy(outputs[out_id].data, tf_outputs[out_id % tf_outputs.size()].flat<float>().data(), total_size * sizeof(float));
+            memcpy(outputs[out_id].data, tf_output.flat<float>().data(), total_size * sizeof(float));
         else
-            memcpy(outputs[out_id].data, tf_outputs[out_id % tf_outputs.size()].flat<int64>().data(), total_size * sizeof(int64));
+            memcpy(outputs[out_id].data, tf_output.flat<int64>().data(), total_size * sizeof(int64));
+    }
+}
+
+bool TensorflowLayer::IsNHWCSubgraph(const CNNLayerPtr& layer)
+{
+    // The IRs with the transposes around the sub-graph pass the TF shapes as they are, the IRs without them pass
+    // the 4D TF tensors as the NCHW dims of the nhwc data
+    auto genLayer = reinterpret_cast<GenericLayer*>(layer.get());
+    vector<string> real_input_dims_str = splitString(genLayer->GetParamAsString("real_input_dims", ""), ';', false);
+    if (real_input_dims_str.size() != layer->insData.size())
+        return false;
+
+    bool has_4d = false;
+    for (size_t i = 0; i < layer->insData.size(); ++i)
+    {
+        SizeVector dims = layer->insData[i].lock()->getTensorDesc().getDims();
+        vector<string> dims_str = splitString(real_input_dims_str[i], ' ', false);
+        SizeVector real_dims(dims_str.size());
+        for (size_t j = 0; j < real_dims.size(); ++j)
+            real_dims[j] = stoi(dims_str[j]);
+
+        if (dims == real_dims)
+            return false;
+        if (dims.size() != 4 || SizeVector{dims[0], dims[2], dims[3], dims[1]} != real_dims)
+            return false;
+        has_4d = true;
     }
+    return has_4d;
 }
 
 vector<InferenceEngine::MKLDNNPlugin::MKLDNNGenericFormats> TensorflowLayer::GetSupportedFormats() noexcept {
+    auto format = _nhwc ? InferenceEngine::MKLDNNPlugin::MemoryFormat::nhwc
+                        : InferenceEngine::MKLDNNPlugin::MemoryFormat::nchw;
     return
          {
             {
-                {InferenceEngine::MKLDNNPlugin::MemoryFormat::nchw}, // input
-                {InferenceEngine::MKLDNNPlugin::MemoryFormat::nchw} // output
+                {format}, // input
+                {format} // output
             }
          };
 }
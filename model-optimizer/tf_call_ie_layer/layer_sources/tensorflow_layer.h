@@ -30,6 +30,7 @@ public:
         const std::string protobuf = genLayer->GetParamAsString("protobuf");
         const std::string input_nodes_names = genLayer->GetParamAsString("input_nodes_names");
         const std::string output_tensors_names = genLayer->GetParamAsString("output_tensors_names");
+        _nhwc = IsNHWCSubgraph(layer);
     }
 
     ~TensorflowLayer() override {}
@@ -39,7 +40,11 @@ public:
     void Execute() noexcept override;
 
 private:
+    static bool IsNHWCSubgraph(const InferenceEngine::CNNLayerPtr& layer);
+
     InferenceEngine::CNNLayerPtr _layer;
+    // the data of the sub-graph is in the nhwc layout of the TF tensors, so it is passed without transposes
+    bool _nhwc;
 };
 
 }  // namespace IECustomExtension